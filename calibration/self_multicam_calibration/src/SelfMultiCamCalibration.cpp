@@ -5,6 +5,7 @@
 
 #include "cauldron/EigenQuaternionParameterization.h"
 #include "cauldron/EigenUtils.h"
+#include "cauldron/Profiler.h"
 #include "camera_calibration/StereoCameraCalibration.h"
 #include "camera_models/CostFunctionFactory.h"
 #include "ceres/ceres.h"
@@ -111,6 +112,8 @@ SelfMultiCamCalibration::processFrames(const ros::Time& stamp,
                                        const std::vector<cv::Mat>& images,
                                        const sensor_msgs::ImuConstPtr& imuMsg)
 {
+    PX_PROFILE_SCOPE("self_multicam_calibration.process_frames");
+
     for (size_t i = 0; i < m_voMap.size(); ++i)
     {
         std::pair<int,int>& item = m_voMap.at(i);
@@ -578,6 +581,8 @@ SelfMultiCamCalibration::processSubGraph(const SparseGraphPtr& graph,
                                          const std::string& vocFilename,
                                          const cv::Mat& matchingMask)
 {
+    PX_PROFILE_SCOPE("self_multicam_calibration.process_subgraph");
+
     graphViz->visualize();
 
     ROS_INFO("Running pose graph optimization...");
@@ -592,6 +597,8 @@ SelfMultiCamCalibration::processSubGraph(const SparseGraphPtr& graph,
 bool
 SelfMultiCamCalibration::runHandEyeCalibration(void)
 {
+    PX_PROFILE_SCOPE("self_multicam_calibration.hand_eye_calibration");
+
     if (m_svo.size() + m_mvo.size() <= 1)
     {
         return false;
@@ -662,6 +669,8 @@ SelfMultiCamCalibration::runPG(const SparseGraphPtr& graph,
                                int nImageMatches,
                                const cv::Mat& matchingMask)
 {
+    PX_PROFILE_SCOPE("self_multicam_calibration.pose_graph");
+
     // For each scene point, record its coordinates with respect to the
     // first camera it was observed in.
     boost::unordered_map<Point3DFeature*, Eigen::Vector3d> scenePointMap;
@@ -829,6 +838,8 @@ void
 SelfMultiCamCalibration::runLimitedBA(const SparseGraphPtr& graph,
                                       SparseGraphViz& graphViz) const
 {
+    PX_PROFILE_SCOPE("self_multicam_calibration.limited_ba");
+
     // run bundle adjustment
     ceres::Problem problem;
 
@@ -927,6 +938,8 @@ void
 SelfMultiCamCalibration::runBA(const SparseGraphPtr& graph,
                                const boost::shared_ptr<SparseGraphViz>& graphViz) const
 {
+    PX_PROFILE_SCOPE("self_multicam_calibration.ba");
+
     // run bundle adjustment
     ceres::Problem problem;
 
@@ -1010,6 +1023,8 @@ SelfMultiCamCalibration::runBA(const SparseGraphPtr& graph,
 void
 SelfMultiCamCalibration::runJointOptimization(const std::vector<std::string>& chessboardDataFilenames)
 {
+    PX_PROFILE_SCOPE("self_multicam_calibration.joint_optimization");
+
     // run full bundle adjustment
     ceres::Problem problem;
 
@@ -1614,6 +1629,8 @@ SelfMultiCamCalibration::runJointOptimization(const std::vector<std::string>& ch
 bool
 SelfMultiCamCalibration::runPoseIMUCalibration(void)
 {
+    PX_PROFILE_SCOPE("self_multicam_calibration.pose_imu_calibration");
+
     // find pose-IMU transform
     std::vector<PoseConstPtr> poseData;
     std::vector<sensor_msgs::ImuConstPtr> imuData;
@@ -1722,6 +1739,8 @@ SelfMultiCamCalibration::reconstructScenePoint(Point2DFeature* f1,
 void
 SelfMultiCamCalibration::mergeMaps(void)
 {
+    PX_PROFILE_SCOPE("self_multicam_calibration.map_merging");
+
     if (m_svo.size() + m_mvo.size() < 2)
     {
         // no maps to merge
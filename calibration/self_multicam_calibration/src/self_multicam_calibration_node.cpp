@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <boost/algorithm/string.hpp>
 #include <boost/dynamic_bitset.hpp>
 #include <boost/filesystem.hpp>
@@ -8,6 +9,7 @@
 #include <iomanip>
 #include <message_filters/subscriber.h>
 #include <message_filters/time_synchronizer.h>
+#include <multicam_msgs/FrameSet.h>
 #include <px_comm/CameraInfo.h>
 #include <px_comm/SetCameraInfo.h>
 #include <ros/ros.h>
@@ -17,6 +19,7 @@
 #include "camera_models/CameraFactory.h"
 #include "camera_systems/CameraSystem.h"
 #include "cauldron/EigenUtils.h"
+#include "cauldron/Profiler.h"
 #include "self_multicam_calibration/SelfMultiCamCalibration.h"
 
 #define N_CAMERAS 4
@@ -39,13 +42,15 @@ parseTokenFromString(std::string& s, std::string& token, size_t& pos)
 bool
 parseConfigFile(const std::string& configFilename,
                 std::vector<std::vector<std::string> >& cameraNs,
-                std::string& imuTopicName)
+                std::string& imuTopicName,
+                std::string& frameSetTopicName)
 {
     bool hasStereo = false;
     bool hasIMU = false;
 
     cameraNs.clear();
     imuTopicName.clear();
+    frameSetTopicName.clear();
 
     std::ifstream ifs(configFilename.c_str());
 
@@ -124,6 +129,16 @@ parseConfigFile(const std::string& configFilename,
 
             hasIMU = true;
         }
+        else if (boost::iequals(token, "frameset"))
+        {
+            // images are read from synchronized frame sets instead of
+            // per-camera image topics
+            if (!parseTokenFromString(s, frameSetTopicName, pos))
+            {
+                ROS_ERROR("The frame set topic is improperly defined.");
+                return false;
+            }
+        }
         else
         {
             ROS_ERROR("Unknown sensor type: %s", token.c_str());
@@ -140,15 +155,11 @@ parseConfigFile(const std::string& configFilename,
 }
 
 void
-voCallback(const sensor_msgs::ImageConstPtr& imageMsg0,
-           const sensor_msgs::ImageConstPtr& imageMsg1,
-           const sensor_msgs::ImageConstPtr& imageMsg2,
-           const sensor_msgs::ImageConstPtr& imageMsg3,
-           const std::list<sensor_msgs::ImuConstPtr>& imuBuffer,
-           boost::shared_ptr<px::SelfMultiCamCalibration> sc)
+processFrames(const ros::Time& stamp,
+              const std::vector<cv::Mat>& images,
+              const std::list<sensor_msgs::ImuConstPtr>& imuBuffer,
+              boost::shared_ptr<px::SelfMultiCamCalibration> sc)
 {
-    ros::Time stamp = imageMsg0->header.stamp;
-
     sensor_msgs::ImuConstPtr imuMsg;
     std::list<sensor_msgs::ImuConstPtr>::const_reverse_iterator rit = imuBuffer.rbegin();
     while (rit != imuBuffer.rend())
@@ -167,6 +178,20 @@ voCallback(const sensor_msgs::ImageConstPtr& imageMsg0,
         return;
     }
 
+    sc->processFrames(stamp, images, imuMsg);
+
+    // keep the thread buffers of the profiler short
+    px::Profiler::instance()->collect();
+}
+
+void
+voCallback(const sensor_msgs::ImageConstPtr& imageMsg0,
+           const sensor_msgs::ImageConstPtr& imageMsg1,
+           const sensor_msgs::ImageConstPtr& imageMsg2,
+           const sensor_msgs::ImageConstPtr& imageMsg3,
+           const std::list<sensor_msgs::ImuConstPtr>& imuBuffer,
+           boost::shared_ptr<px::SelfMultiCamCalibration> sc)
+{
     std::vector<sensor_msgs::ImageConstPtr> imageMsgs;
     imageMsgs.push_back(imageMsg0);
     imageMsgs.push_back(imageMsg1);
@@ -188,7 +213,44 @@ voCallback(const sensor_msgs::ImageConstPtr& imageMsg0,
         return;
     }
 
-    sc->processFrames(stamp, images, imuMsg);
+    processFrames(imageMsg0->header.stamp, images, imuBuffer, sc);
+}
+
+void
+frameSetCallback(const multicam_msgs::FrameSetConstPtr& frameSetMsg,
+                 const std::vector<std::string>& cameraNsVec,
+                 const std::list<sensor_msgs::ImuConstPtr>& imuBuffer,
+                 boost::shared_ptr<px::SelfMultiCamCalibration> sc)
+{
+    std::vector<cv::Mat> images(cameraNsVec.size());
+    for (size_t i = 0; i < cameraNsVec.size(); ++i)
+    {
+        std::vector<std::string>::const_iterator it =
+            std::find(frameSetMsg->camera_ns.begin(), frameSetMsg->camera_ns.end(),
+                      cameraNsVec.at(i));
+        if (it == frameSetMsg->camera_ns.end())
+        {
+            ROS_WARN("Frame set has no image from camera %s.", cameraNsVec.at(i).c_str());
+            return;
+        }
+
+        const sensor_msgs::Image& imageMsg =
+            frameSetMsg->images.at(it - frameSetMsg->camera_ns.begin());
+
+        try
+        {
+            cv_bridge::CvImageConstPtr cv_ptr = cv_bridge::toCvShare(imageMsg, frameSetMsg);
+            cv_ptr->image.copyTo(images.at(i));
+        }
+        catch (cv_bridge::Exception& e)
+        {
+            ROS_ERROR("cv_bridge exception: %s", e.what());
+            return;
+        }
+    }
+
+    // all images in a frame set share the same stamp
+    processFrames(frameSetMsg->header.stamp, images, imuBuffer, sc);
 }
 
 template<class M>
@@ -210,6 +272,7 @@ main(int argc, char** argv)
     bool readIntermediateData = false;
     std::string chessboardDataDir;
     std::string outputDir;
+    std::string traceFilename;
 
     boost::program_options::options_description desc("Allowed options");
     desc.add_options()
@@ -220,6 +283,7 @@ main(int argc, char** argv)
         ("intermediate", boost::program_options::bool_switch(&readIntermediateData), "Read intermediate map data in lieu of VO.")
         ("chessboard-data", boost::program_options::value<std::string>(&chessboardDataDir), "Directory containing chessboard data files.")
         ("output,o", boost::program_options::value<std::string>(&outputDir)->default_value("calib"), "Output directory.")
+        ("trace", boost::program_options::value<std::string>(&traceFilename), "Chrome trace filename for per-stage timing.")
         ;
 
     boost::program_options::variables_map vm;
@@ -234,10 +298,17 @@ main(int argc, char** argv)
 
     ros::init(argc, argv, "extrinsic_calibration");
 
+    if (!traceFilename.empty() && !px::Profiler::instance()->startTrace(traceFilename))
+    {
+        ROS_ERROR("Failed to open trace file %s.", traceFilename.c_str());
+        return 1;
+    }
+
     std::vector<std::vector<std::string> > cameraNs;
     std::string imuTopicName;
+    std::string frameSetTopicName;
 
-    if (!parseConfigFile(configFilename, cameraNs, imuTopicName))
+    if (!parseConfigFile(configFilename, cameraNs, imuTopicName, frameSetTopicName))
     {
         ROS_ERROR("Failed to read configuration file %s", configFilename.c_str());
         return 1;
@@ -264,18 +335,29 @@ main(int argc, char** argv)
 
     std::vector<std::string> camInfoTopicNames;
     std::vector<std::string> camImageTopicNames;
+    std::vector<std::string> resolvedCameraNs;
     for (size_t i = 0; i < cameraNs.size(); ++i)
     {
         for (size_t j = 0; j < cameraNs.at(i).size(); ++j)
         {
             camInfoTopicNames.push_back(cameraNs.at(i).at(j) + "/camera_info");
             camImageTopicNames.push_back(cameraNs.at(i).at(j) + "/image_raw");
+
+            // frame sets identify cameras by their resolved namespace
+            resolvedCameraNs.push_back(ros::names::resolve(cameraNs.at(i).at(j)));
         }
     }
 
     std::vector<std::string> topics;
     topics.insert(topics.end(), camInfoTopicNames.begin(), camInfoTopicNames.end());
-    topics.insert(topics.end(), camImageTopicNames.begin(), camImageTopicNames.end());
+    if (frameSetTopicName.empty())
+    {
+        topics.insert(topics.end(), camImageTopicNames.begin(), camImageTopicNames.end());
+    }
+    else
+    {
+        topics.push_back(frameSetTopicName);
+    }
     topics.push_back(imuTopicName);
 
     rosbag::View view(bag, rosbag::TopicQuery(topics));
@@ -294,7 +376,8 @@ main(int argc, char** argv)
     std::vector<px::CameraPtr> cameras(nCams);
     std::list<sensor_msgs::ImuConstPtr> imuBuffer;
 
-    // for now, assume 4 cameras are present
+    // Bags recorded without frame sets are synchronized per topic;
+    // for now, assume 4 cameras are present.
     message_filters::TimeSynchronizer<sensor_msgs::Image,
                                       sensor_msgs::Image,
                                       sensor_msgs::Image,
@@ -401,7 +484,10 @@ main(int argc, char** argv)
                     return 1;
                 }
 
-                sync.registerCallback(boost::bind(&voCallback, _1, _2, _3, _4, boost::ref(imuBuffer), sc));
+                if (frameSetTopicName.empty())
+                {
+                    sync.registerCallback(boost::bind(&voCallback, _1, _2, _3, _4, boost::ref(imuBuffer), sc));
+                }
 
                 ROS_INFO("Initialized extrinsic calibration.");
             }
@@ -426,6 +512,20 @@ main(int argc, char** argv)
                 }
             }
 
+            if (m.getTopic() == frameSetTopicName)
+            {
+                multicam_msgs::FrameSetConstPtr frameSet = m.instantiate<multicam_msgs::FrameSet>();
+                if (frameSet)
+                {
+                    frameSetCallback(frameSet, resolvedCameraNs, imuBuffer, sc);
+
+                    for (size_t i = 0; i < frameSet->images.size() && i < imagePubs.size(); ++i)
+                    {
+                        imagePubs.at(i).publish(frameSet->images.at(i));
+                    }
+                }
+            }
+
             if (m.getTopic() == imuTopicName)
             {
                 sensor_msgs::ImuConstPtr imu = m.instantiate<sensor_msgs::Imu>();
@@ -458,6 +558,9 @@ main(int argc, char** argv)
     unsigned int calibDuration = static_cast<unsigned int>((ros::Time::now() - calibStartTime).toSec());
     ROS_INFO("Calibration took %u m %u s.", calibDuration / 60, calibDuration % 60);
 
+    px::Profiler::instance()->stopTrace();
+    ROS_INFO_STREAM("Timing statistics:" << std::endl << px::Profiler::instance()->summary());
+
     cameraSystem->writeToDirectory(outputDir);
     ROS_INFO_STREAM("Wrote calibration files to "
                     << boost::filesystem::absolute(boost::filesystem::path(outputDir)).string());
@@ -0,0 +1,538 @@
+#ifndef CELLTRAVERSAL_H
+#define CELLTRAVERSAL_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <Eigen/Dense>
+#include <vector>
+
+namespace px
+{
+
+// Allocation-free grid traversal. Each function calls a visitor once for
+// every cell, in traversal order for lines and rays and in no particular
+// order for circles and spheres. A visitor is any object with
+//
+//   bool operator()(int x, int y);          // 2D
+//   bool operator()(int x, int y, int z);   // 3D
+//
+// that returns false to stop the traversal, in which case the function
+// returns false. The cells are the same as those returned by bresLine,
+// bresCircle, bresFilledCircle and bresFilledSphere in cauldron.h.
+
+template<class Visitor>
+bool visitBresLine(int x0, int y0, int x1, int y1, Visitor& visitor)
+{
+    int dx = std::abs(x1 - x0);
+    int dy = std::abs(y1 - y0);
+
+    int sx = (x0 < x1) ? 1 : -1;
+    int sy = (y0 < y1) ? 1 : -1;
+
+    int err = dx - dy;
+
+    while (1)
+    {
+        if (!visitor(x0, y0))
+        {
+            return false;
+        }
+
+        if (x0 == x1 && y0 == y1)
+        {
+            return true;
+        }
+
+        int e2 = 2 * err;
+        if (e2 > -dy)
+        {
+            err -= dy;
+            x0 += sx;
+        }
+        if (e2 < dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+}
+
+template<class Visitor>
+bool visitBresLine(int x0, int y0, int z0, int x1, int y1, int z1, Visitor& visitor)
+{
+    int d[3] = {std::abs(x1 - x0), std::abs(y1 - y0), std::abs(z1 - z0)};
+    int s[3] = {(x0 < x1) ? 1 : -1, (y0 < y1) ? 1 : -1, (z0 < z1) ? 1 : -1};
+    int p[3] = {x0, y0, z0};
+
+    // step along the driving axis a; b and c follow
+    int a, b, c;
+    if (d[0] >= d[1] && d[0] >= d[2])
+    {
+        a = 0; b = 1; c = 2;
+    }
+    else if (d[1] >= d[0] && d[1] >= d[2])
+    {
+        a = 1; b = 0; c = 2;
+    }
+    else
+    {
+        a = 2; b = 1; c = 0;
+    }
+
+    int da2 = d[a] << 1;
+    int db2 = d[b] << 1;
+    int dc2 = d[c] << 1;
+
+    int e1 = db2 - d[a];
+    int e2 = dc2 - d[a];
+
+    for (int i = 0; i <= d[a]; ++i)
+    {
+        if (!visitor(p[0], p[1], p[2]))
+        {
+            return false;
+        }
+
+        if (e1 > 0)
+        {
+            p[b] += s[b];
+            e1 -= da2;
+        }
+        if (e2 > 0)
+        {
+            p[c] += s[c];
+            e2 -= da2;
+        }
+        e1 += db2;
+        e2 += dc2;
+        p[a] += s[a];
+    }
+
+    return true;
+}
+
+namespace detail
+{
+
+// One octant of a midpoint circle as a sequence (u, v) in which u grows by
+// one per step and v does not grow. The outline of the circle holds
+// (+-u, +-v) and (+-v, +-u). The filled circle holds the spans |x| <= v in
+// rows +-u and |x| <= u in rows +-v, plus both axes.
+class MidpointOctant
+{
+public:
+    MidpointOctant(int r, bool filled)
+     : m_filled(filled)
+    {
+        if (filled)
+        {
+            m_x = 0;
+            m_y = r;
+            m_f = 1 - r;
+            m_ddFx = 1;
+            m_ddFy = -2 * r;
+        }
+        else
+        {
+            m_x = r;
+            m_y = 0;
+            m_f = 1 - r;
+            m_ddFx = 0;
+            m_ddFy = 0;
+        }
+    }
+
+    bool next(int& u, int& v)
+    {
+        if (m_filled)
+        {
+            if (m_x >= m_y)
+            {
+                return false;
+            }
+
+            if (m_f >= 0)
+            {
+                --m_y;
+                m_ddFy += 2;
+                m_f += m_ddFy;
+            }
+
+            ++m_x;
+            m_ddFx += 2;
+            m_f += m_ddFx;
+
+            u = m_x;
+            v = m_y;
+        }
+        else
+        {
+            if (m_x < m_y)
+            {
+                return false;
+            }
+
+            u = m_y;
+            v = m_x;
+
+            ++m_y;
+            if (m_f < 0)
+            {
+                m_f += 2 * m_y + 1;
+            }
+            else
+            {
+                --m_x;
+                m_f += 2 * (m_y - m_x + 1);
+            }
+        }
+
+        return true;
+    }
+
+private:
+    bool m_filled;
+    int m_x, m_y;
+    int m_f;
+    int m_ddFx, m_ddFy;
+};
+
+// Calls visitor(k, w) exactly once for every row k >= 0 of the outline or
+// filled midpoint circle of radius r, where w is the largest |x| of the
+// circle in row k. A row k is produced by the u-steps with u == k, the
+// v-steps with v == k, or both; since u and v are monotonic, both only
+// happen for the last one or two rows of the octant, which are resolved by
+// scanning the octant again.
+template<class RowVisitor>
+bool visitCircleRows(int r, bool filled, RowVisitor& visitor)
+{
+    if (filled && !visitor(0, r))
+    {
+        return false;
+    }
+
+    int u, v;
+    int n = 0, u1 = 0, v1 = 0, un = 0, vn = 0;
+    MidpointOctant octant(r, filled);
+    while (octant.next(u, v))
+    {
+        if (n == 0)
+        {
+            u1 = u;
+            v1 = v;
+        }
+        un = u;
+        vn = v;
+        ++n;
+    }
+
+    if (n > 0)
+    {
+        MidpointOctant rows(r, filled);
+        int uPrev = 0, vPrev = 0;
+        for (int i = 0; i <= n; ++i)
+        {
+            bool hasNext = (i < n) && rows.next(u, v);
+
+            // row vPrev is complete once v changes
+            if (i > 0 && (!hasNext || v != vPrev) &&
+                (vPrev > un || vPrev < u1) && !(filled && vPrev == 0) &&
+                !visitor(vPrev, uPrev))
+            {
+                return false;
+            }
+
+            if (!hasNext)
+            {
+                break;
+            }
+
+            if ((u < vn || u > v1) && !(filled && u == 0) && !visitor(u, v))
+            {
+                return false;
+            }
+
+            uPrev = u;
+            vPrev = v;
+        }
+
+        // rows produced by both u- and v-steps
+        for (int k = std::max(u1, vn); k <= std::min(un, v1); ++k)
+        {
+            if (filled && k == 0)
+            {
+                continue;
+            }
+
+            int w = -1;
+            MidpointOctant overlap(r, filled);
+            while (overlap.next(u, v))
+            {
+                if (u == k)
+                {
+                    w = std::max(w, v);
+                }
+                if (v == k)
+                {
+                    w = std::max(w, u);
+                }
+            }
+
+            if (!visitor(k, w))
+            {
+                return false;
+            }
+        }
+    }
+
+    // the vertical axis of a filled circle reaches row r
+    if (filled && r > 0 && (n == 0 || (v1 < r && un < r)) && !visitor(r, 0))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+template<class Visitor>
+struct FilledCircleRowVisitor
+{
+    FilledCircleRowVisitor(int x0_, int y0_, Visitor& visitor_)
+     : x0(x0_), y0(y0_), visitor(visitor_) {}
+
+    bool operator()(int k, int w)
+    {
+        for (int x = x0 - w; x <= x0 + w; ++x)
+        {
+            if (!visitor(x, y0 + k) || (k != 0 && !visitor(x, y0 - k)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    int x0, y0;
+    Visitor& visitor;
+};
+
+template<class Visitor>
+struct FilledSphereRowVisitor
+{
+    FilledSphereRowVisitor(int x0_, int y0_, int z0_, Visitor& visitor_)
+     : x0(x0_), y0(y0_), z0(z0_), visitor(visitor_) {}
+
+    // visits the disc of radius w at z0 + z
+    struct Disc
+    {
+        Disc(int z_, Visitor& visitor_)
+         : z(z_), visitor(visitor_) {}
+
+        bool operator()(int x, int y)
+        {
+            return visitor(x, y, z);
+        }
+
+        int z;
+        Visitor& visitor;
+    };
+
+    bool operator()(int k, int w)
+    {
+        Disc upper(z0 + k, visitor);
+        FilledCircleRowVisitor<Disc> upperRows(x0, y0, upper);
+        if (!visitCircleRows(w, true, upperRows))
+        {
+            return false;
+        }
+
+        if (k == 0)
+        {
+            return true;
+        }
+
+        Disc lower(z0 - k, visitor);
+        FilledCircleRowVisitor<Disc> lowerRows(x0, y0, lower);
+        return visitCircleRows(w, true, lowerRows);
+    }
+
+    int x0, y0, z0;
+    Visitor& visitor;
+};
+
+// passes the index of the current ray or line to a batch visitor
+template<class Visitor>
+struct IndexedVisitor
+{
+    IndexedVisitor(size_t idx_, Visitor& visitor_)
+     : idx(idx_), visitor(visitor_) {}
+
+    bool operator()(int x, int y, int z)
+    {
+        return visitor(idx, x, y, z);
+    }
+
+    size_t idx;
+    Visitor& visitor;
+};
+
+}
+
+template<class Visitor>
+bool visitBresCircle(int x0, int y0, int r, Visitor& visitor)
+{
+    detail::MidpointOctant octant(r, false);
+
+    int u, v;
+    while (octant.next(u, v))
+    {
+        // (u, v) and (v, u) coincide on the diagonal, and +-0 on the axes
+        int p[8][2] = {{v, u}, {-v, u}, {v, -u}, {-v, -u},
+                       {u, v}, {-u, v}, {u, -v}, {-u, -v}};
+
+        int nPoints = (u == v) ? 4 : 8;
+        for (int i = 0; i < nPoints; ++i)
+        {
+            if ((p[i][0] == 0 && i % 2 == 1) || (p[i][1] == 0 && (i / 2) % 2 == 1))
+            {
+                continue;
+            }
+
+            if (!visitor(x0 + p[i][0], y0 + p[i][1]))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+template<class Visitor>
+bool visitBresFilledCircle(int x0, int y0, int r, Visitor& visitor)
+{
+    detail::FilledCircleRowVisitor<Visitor> rowVisitor(x0, y0, visitor);
+
+    return detail::visitCircleRows(r, true, rowVisitor);
+}
+
+// The sphere is stacked from filled circles whose radii follow the outline
+// of a circle of radius r in the xz-plane.
+template<class Visitor>
+bool visitBresFilledSphere(int x0, int y0, int z0, int r, Visitor& visitor)
+{
+    detail::FilledSphereRowVisitor<Visitor> rowVisitor(x0, y0, z0, visitor);
+
+    return detail::visitCircleRows(r, false, rowVisitor);
+}
+
+// Amanatides-Woo traversal of the voxels of size voxelSize that the
+// segment from p0 to p1 passes through, from the voxel of p0 to the voxel
+// of p1 inclusive. Voxel (i, j, k) spans [i, i + 1) * voxelSize along x,
+// and likewise along y and z. Each step moves to a face neighbor, so the
+// number of visited voxels is one plus the L1 distance between the end
+// voxels.
+template<class Visitor>
+bool visitVoxelRay(const Eigen::Vector3d& p0, const Eigen::Vector3d& p1,
+                   double voxelSize, Visitor& visitor)
+{
+    int voxel[3], step[3], nSteps[3];
+    double tMax[3], tDelta[3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        double a = p0(i) / voxelSize;
+        double b = p1(i) / voxelSize;
+
+        voxel[i] = static_cast<int>(std::floor(a));
+        int endVoxel = static_cast<int>(std::floor(b));
+
+        double d = b - a;
+        if (endVoxel > voxel[i])
+        {
+            step[i] = 1;
+            tDelta[i] = 1.0 / d;
+            tMax[i] = (voxel[i] + 1 - a) * tDelta[i];
+        }
+        else if (endVoxel < voxel[i])
+        {
+            step[i] = -1;
+            tDelta[i] = -1.0 / d;
+            tMax[i] = (a - voxel[i]) * tDelta[i];
+        }
+        else
+        {
+            step[i] = 0;
+            tDelta[i] = 0.0;
+            tMax[i] = 0.0;
+        }
+
+        nSteps[i] = std::abs(endVoxel - voxel[i]);
+    }
+
+    if (!visitor(voxel[0], voxel[1], voxel[2]))
+    {
+        return false;
+    }
+
+    // Only axes with steps left compete, so rounding in tMax cannot step
+    // past the end voxel.
+    while (nSteps[0] + nSteps[1] + nSteps[2] > 0)
+    {
+        int axis = -1;
+        for (int i = 0; i < 3; ++i)
+        {
+            if (nSteps[i] > 0 && (axis == -1 || tMax[i] < tMax[axis]))
+            {
+                axis = i;
+            }
+        }
+
+        voxel[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+        --nSteps[axis];
+
+        if (!visitor(voxel[0], voxel[1], voxel[2]))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Batched traversal of the rays from a common origin, e.g. the sensor, to
+// each endpoint. The visitor is called as visitor(rayIdx, x, y, z); if it
+// returns false, only the current ray is cut short.
+template<class Visitor>
+void visitVoxelRays(const Eigen::Vector3d& origin,
+                    const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& endpoints,
+                    double voxelSize, Visitor& visitor)
+{
+    for (size_t i = 0; i < endpoints.size(); ++i)
+    {
+        detail::IndexedVisitor<Visitor> rayVisitor(i, visitor);
+        visitVoxelRay(origin, endpoints.at(i), voxelSize, rayVisitor);
+    }
+}
+
+// Batched Bresenham lines in grid coordinates from a common origin; see
+// visitVoxelRays.
+template<class Visitor>
+void visitBresLines(const Eigen::Vector3i& origin,
+                    const std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >& endpoints,
+                    Visitor& visitor)
+{
+    for (size_t i = 0; i < endpoints.size(); ++i)
+    {
+        const Eigen::Vector3i& p = endpoints.at(i);
+
+        detail::IndexedVisitor<Visitor> lineVisitor(i, visitor);
+        visitBresLine(origin(0), origin(1), origin(2), p(0), p(1), p(2), lineVisitor);
+    }
+}
+
+}
+
+#endif
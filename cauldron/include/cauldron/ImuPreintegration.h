@@ -0,0 +1,205 @@
+#ifndef IMUPREINTEGRATION_H
+#define IMUPREINTEGRATION_H
+
+#include <cmath>
+#include <Eigen/Dense>
+#include <limits>
+
+namespace px
+{
+
+// On-manifold preintegration of gyro and accelerometer measurements
+// between two frame sets (Forster et al., "On-Manifold Preintegration for
+// Real-Time Visual-Inertial Odometry", T-RO 2017). The deltas are taken in
+// the body frame of the first frame set, so they do not depend on its pose
+// or velocity; to first order, a change of the bias estimates is applied
+// through the bias Jacobians instead of integrating again.
+//
+// Measurements are held constant over each step. The body frame is the
+// system frame, and gravity is given in the world frame.
+class ImuPreintegration
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    ImuPreintegration(const Eigen::Vector3d& gyroBias = Eigen::Vector3d::Zero(),
+                      const Eigen::Vector3d& accelBias = Eigen::Vector3d::Zero());
+
+    // continuous-time white noise densities of the measurements
+    // [rad/s/sqrt(Hz), m/s^2/sqrt(Hz)] and of the bias random walks
+    // [rad/s^2/sqrt(Hz), m/s^3/sqrt(Hz)]
+    double& gyroNoiseDensity(void);
+    double gyroNoiseDensity(void) const;
+    double& accelNoiseDensity(void);
+    double accelNoiseDensity(void) const;
+    double& gyroRandomWalk(void);
+    double gyroRandomWalk(void) const;
+    double& accelRandomWalk(void);
+    double accelRandomWalk(void) const;
+
+    // Clears the deltas and sets the bias estimates they are taken with.
+    void reset(const Eigen::Vector3d& gyroBias, const Eigen::Vector3d& accelBias);
+
+    void integrate(const Eigen::Vector3d& gyro, const Eigen::Vector3d& accel,
+                   double dt);
+
+    double deltaTime(void) const;
+    const Eigen::Matrix3d& deltaR(void) const;
+    const Eigen::Vector3d& deltaV(void) const;
+    const Eigen::Vector3d& deltaP(void) const;
+
+    const Eigen::Vector3d& gyroBias(void) const;
+    const Eigen::Vector3d& accelBias(void) const;
+
+    // covariance of the rotation, velocity and position deltas, in this
+    // order, with the rotation error on the right
+    const Eigen::Matrix<double,9,9>& covariance(void) const;
+
+    const Eigen::Matrix3d& dR_dbg(void) const;
+    const Eigen::Matrix3d& dV_dbg(void) const;
+    const Eigen::Matrix3d& dV_dba(void) const;
+    const Eigen::Matrix3d& dP_dbg(void) const;
+    const Eigen::Matrix3d& dP_dba(void) const;
+
+    // deltas for other bias estimates
+    Eigen::Matrix3d correctedDeltaR(const Eigen::Vector3d& gyroBias) const;
+    Eigen::Vector3d correctedDeltaV(const Eigen::Vector3d& gyroBias,
+                                    const Eigen::Vector3d& accelBias) const;
+    Eigen::Vector3d correctedDeltaP(const Eigen::Vector3d& gyroBias,
+                                    const Eigen::Vector3d& accelBias) const;
+
+    // Predicts the orientation (body to world), velocity and position of
+    // the second frame set from those of the first.
+    void predict(const Eigen::Matrix3d& R_i, const Eigen::Vector3d& v_i,
+                 const Eigen::Vector3d& p_i, const Eigen::Vector3d& gravity,
+                 Eigen::Matrix3d& R_j, Eigen::Vector3d& v_j,
+                 Eigen::Vector3d& p_j) const;
+
+private:
+    double m_gyroNoiseDensity;
+    double m_accelNoiseDensity;
+    double m_gyroRandomWalk;
+    double m_accelRandomWalk;
+
+    Eigen::Vector3d m_gyroBias;
+    Eigen::Vector3d m_accelBias;
+
+    double m_deltaTime;
+    Eigen::Matrix3d m_deltaR;
+    Eigen::Vector3d m_deltaV;
+    Eigen::Vector3d m_deltaP;
+
+    Eigen::Matrix<double,9,9> m_covariance;
+
+    Eigen::Matrix3d m_dR_dbg;
+    Eigen::Matrix3d m_dV_dbg;
+    Eigen::Matrix3d m_dV_dba;
+    Eigen::Matrix3d m_dP_dbg;
+    Eigen::Matrix3d m_dP_dba;
+};
+
+// Unit quaternion of the rotation vector w; first order near zero so that
+// automatic derivatives stay finite at w = 0.
+template<typename T>
+Eigen::Quaternion<T> expQuaternion(const Eigen::Matrix<T,3,1>& w)
+{
+    using std::cos;
+    using std::sin;
+    using std::sqrt;
+
+    T theta2 = w.squaredNorm();
+    if (theta2 > T(std::numeric_limits<double>::epsilon()))
+    {
+        T theta = sqrt(theta2);
+        T k = sin(theta * T(0.5)) / theta;
+
+        return Eigen::Quaternion<T>(cos(theta * T(0.5)), k * w(0), k * w(1), k * w(2));
+    }
+
+    return Eigen::Quaternion<T>(T(1), T(0.5) * w(0), T(0.5) * w(1), T(0.5) * w(2));
+}
+
+// Ceres cost functor for a preintegrated IMU measurement between system
+// poses i and j, each given as the rotation (Eigen quaternion) and
+// translation of Pose, which map the world frame to the system frame, and
+// a block of the velocity in the world frame and the gyro and
+// accelerometer biases. The 15 residuals are the rotation, velocity and
+// position errors and the bias random walks, whitened by the covariance.
+class ImuFactor
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    enum
+    {
+        k_residualCount = 15,
+        k_velocityBiasSize = 9
+    };
+
+    ImuFactor(const ImuPreintegration& preintegration,
+              const Eigen::Vector3d& gravity);
+
+    template<typename T>
+    bool operator()(const T* const q_i, const T* const t_i, const T* const vb_i,
+                    const T* const q_j, const T* const t_j, const T* const vb_j,
+                    T* residuals) const;
+
+private:
+    ImuPreintegration m_preintegration;
+    Eigen::Quaterniond m_deltaQ;
+    Eigen::Vector3d m_gravity;
+
+    Eigen::Matrix<double,15,15> m_sqrtInformation;
+};
+
+template<typename T>
+bool
+ImuFactor::operator()(const T* const q_i, const T* const t_i, const T* const vb_i,
+                      const T* const q_j, const T* const t_j, const T* const vb_j,
+                      T* residuals) const
+{
+    typedef Eigen::Matrix<T,3,1> Vector3;
+
+    // body to world
+    Eigen::Quaternion<T> q_wi = Eigen::Quaternion<T>(q_i).conjugate();
+    Eigen::Quaternion<T> q_wj = Eigen::Quaternion<T>(q_j).conjugate();
+    Vector3 p_i = -(q_wi * Vector3(t_i));
+    Vector3 p_j = -(q_wj * Vector3(t_j));
+
+    Vector3 v_i(vb_i), bg_i(vb_i + 3), ba_i(vb_i + 6);
+    Vector3 v_j(vb_j), bg_j(vb_j + 3), ba_j(vb_j + 6);
+
+    Vector3 dbg = bg_i - m_preintegration.gyroBias().cast<T>();
+    Vector3 dba = ba_i - m_preintegration.accelBias().cast<T>();
+
+    Eigen::Quaternion<T> deltaQ = m_deltaQ.cast<T>() *
+                                  expQuaternion<T>(m_preintegration.dR_dbg().cast<T>() * dbg);
+    Vector3 deltaV = m_preintegration.deltaV().cast<T>() +
+                     m_preintegration.dV_dbg().cast<T>() * dbg +
+                     m_preintegration.dV_dba().cast<T>() * dba;
+    Vector3 deltaP = m_preintegration.deltaP().cast<T>() +
+                     m_preintegration.dP_dbg().cast<T>() * dbg +
+                     m_preintegration.dP_dba().cast<T>() * dba;
+
+    T dt = T(m_preintegration.deltaTime());
+    Vector3 g = m_gravity.cast<T>();
+
+    Eigen::Quaternion<T> q_err = deltaQ.conjugate() * q_wi.conjugate() * q_wj;
+    T sign = q_err.w() < T(0) ? T(-1) : T(1);
+
+    Eigen::Matrix<T,15,1> r;
+    r.template segment<3>(0) = T(2) * sign * q_err.vec();
+    r.template segment<3>(3) = q_wi.conjugate() * (v_j - v_i - g * dt) - deltaV;
+    r.template segment<3>(6) = q_wi.conjugate() * (p_j - p_i - v_i * dt - T(0.5) * g * dt * dt) - deltaP;
+    r.template segment<3>(9) = bg_j - bg_i;
+    r.template segment<3>(12) = ba_j - ba_i;
+
+    Eigen::Map<Eigen::Matrix<T,15,1> > residualVec(residuals);
+    residualVec = m_sqrtInformation.cast<T>() * r;
+
+    return true;
+}
+
+}
+
+#endif
@@ -0,0 +1,144 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <boost/shared_ptr.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
+#include <cstdio>
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace px
+{
+
+// Always-on instrumentation of pipeline stages with scoped timers,
+// counters and histograms. Records are appended to a buffer owned by the
+// calling thread; they are merged into the statistics, and optionally
+// streamed to a Chrome trace file (chrome://tracing, ui.perfetto.dev),
+// only when collect() is called, typically from a low-rate timer.
+//
+// Names must be string literals or otherwise outlive the profiler: only
+// the pointer is stored on the hot path.
+class Profiler
+{
+public:
+    enum RecordType
+    {
+        TIMER,
+        COUNTER,
+        HISTOGRAM
+    };
+
+    class Statistics
+    {
+    public:
+        Statistics();
+
+        void add(double value);
+        // approximate, from log-spaced bins with 10 bins per decade
+        double percentile(double p) const;
+        double mean(void) const;
+
+        std::string name;
+        RecordType type;
+        uint64_t count;
+        double sum;         // seconds for timers
+        double min;
+        double max;
+        std::vector<uint32_t> bins;
+    };
+
+    static Profiler* instance(void);
+
+    // Recording is on by default; disabled calls return immediately.
+    void setEnabled(bool enabled);
+    bool isEnabled(void) const;
+
+    // monotonic time in nanoseconds
+    static uint64_t now(void);
+
+    void addTimer(const char* name, uint64_t startTime, uint64_t endTime);
+    void addCount(const char* name, double value = 1.0);
+    void addSample(const char* name, double value);
+
+    // Drains the thread buffers into the statistics and the trace file.
+    void collect(void);
+
+    void getStatistics(std::vector<Statistics>& statistics) const;
+    void resetStatistics(void);
+
+    // one line per record name with the count, mean and percentiles
+    std::string summary(void) const;
+
+    bool startTrace(const std::string& filename);
+    void stopTrace(void);
+
+    // records dropped since the last collect() because a thread buffer
+    // was full
+    uint64_t droppedRecordCount(void) const;
+
+private:
+    struct Record
+    {
+        const char* name;
+        RecordType type;
+        uint64_t time;
+        double value;       // duration in ns for timers
+    };
+
+    struct ThreadBuffer
+    {
+        boost::mutex mutex;
+        std::vector<Record> records;
+        uint64_t dropped;
+        int threadId;
+    };
+
+    Profiler();
+
+    ThreadBuffer* threadBuffer(void);
+    void record(const char* name, RecordType type, uint64_t time, double value);
+    void writeTraceRecord(const Record& record, int threadId);
+
+    const size_t k_maxThreadBufferSize;
+
+    volatile bool m_enabled;
+    uint64_t m_startTime;
+
+    mutable boost::mutex m_bufferMutex;
+    std::vector<boost::shared_ptr<ThreadBuffer> > m_buffers;
+    boost::thread_specific_ptr<boost::shared_ptr<ThreadBuffer> > m_threadBuffer;
+    int m_threadCount;
+
+    mutable boost::mutex m_statisticsMutex;
+    std::map<std::string, Statistics> m_statistics;
+    std::map<std::string, double> m_counterTotals;
+    uint64_t m_droppedRecordCount;
+
+    FILE* m_traceFile;
+    bool m_traceEmpty;
+};
+
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(const char* name);
+    ~ScopedTimer();
+
+private:
+    const char* m_name;
+    uint64_t m_startTime;
+};
+
+}
+
+#define PX_PROFILE_CONCAT_(a, b) a##b
+#define PX_PROFILE_CONCAT(a, b) PX_PROFILE_CONCAT_(a, b)
+
+// times the enclosing scope
+#define PX_PROFILE_SCOPE(name) \
+    px::ScopedTimer PX_PROFILE_CONCAT(pxScopedTimer, __LINE__)(name)
+
+#endif
@@ -0,0 +1,151 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+#include <cmath>
+#include <stdint.h>
+#include <vector>
+
+namespace px
+{
+
+// xoshiro256** by D. Blackman and S. Vigna: a small, fast generator with
+// 256 bits of state that passes BigCrush. Unlike rand(), it keeps no
+// global state, so each thread can own an instance and draw numbers
+// without contention; a given seed always yields the same sequence.
+class Xoshiro256
+{
+public:
+    typedef uint64_t result_type;
+
+    explicit Xoshiro256(uint64_t seed = 0)
+    {
+        this->seed(seed);
+    }
+
+    // Expands the seed into the state with splitmix64, as recommended by
+    // the authors, so that similar seeds give unrelated sequences.
+    void seed(uint64_t seed)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            seed += 0x9e3779b97f4a7c15ULL;
+
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            m_s[i] = z ^ (z >> 31);
+        }
+
+        m_hasSpareNormal = false;
+        m_spareNormal = 0.0;
+    }
+
+    static result_type min(void) { return 0; }
+    static result_type max(void) { return ~static_cast<result_type>(0); }
+
+    result_type operator()(void)
+    {
+        uint64_t result = rotl(m_s[1] * 5, 7) * 9;
+        uint64_t t = m_s[1] << 17;
+
+        m_s[2] ^= m_s[0];
+        m_s[3] ^= m_s[1];
+        m_s[1] ^= m_s[2];
+        m_s[0] ^= m_s[3];
+
+        m_s[2] ^= t;
+        m_s[3] = rotl(m_s[3], 45);
+
+        return result;
+    }
+
+    // Uniform integer in [0, n), as std::random_shuffle expects. Uses
+    // Lemire's multiply-shift, which is unbiased enough for n << 2^32.
+    long operator()(long n)
+    {
+        return static_cast<long>(((*this)() >> 32) * static_cast<uint64_t>(n) >> 32);
+    }
+
+    // Uniform double in [0, 1) from the upper 53 bits.
+    double uniform(void)
+    {
+        return ((*this)() >> 11) * (1.0 / 9007199254740992.0);
+    }
+
+    double uniform(double a, double b)
+    {
+        return a + (b - a) * uniform();
+    }
+
+    // Standard normal sample by the Marsaglia polar method; every other
+    // call returns the spare sample of the previous one.
+    double normal(void)
+    {
+        if (m_hasSpareNormal)
+        {
+            m_hasSpareNormal = false;
+            return m_spareNormal;
+        }
+
+        double x1, x2, w;
+        do
+        {
+            x1 = 2.0 * uniform() - 1.0;
+            x2 = 2.0 * uniform() - 1.0;
+            w = x1 * x1 + x2 * x2;
+        }
+        while (w >= 1.0 || w == 0.0);
+
+        w = std::sqrt((-2.0 * std::log(w)) / w);
+
+        m_spareNormal = x2 * w;
+        m_hasSpareNormal = true;
+
+        return x1 * w;
+    }
+
+    double normal(double mean, double sigma)
+    {
+        return mean + sigma * normal();
+    }
+
+    // Fills n normal samples with zero mean.
+    void fillNormal(double* samples, int n, double sigma = 1.0)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            samples[i] = sigma * normal();
+        }
+    }
+
+private:
+    static uint64_t rotl(uint64_t x, int k)
+    {
+        return (x << k) | (x >> (64 - k));
+    }
+
+    uint64_t m_s[4];
+
+    bool m_hasSpareNormal;
+    double m_spareNormal;
+};
+
+// Seed from which all thread generators are derived. Setting it reseeds
+// the generators of all threads on their next draw; the i-th thread to
+// draw after that gets a sequence that depends only on the seed and i, so
+// runs with one processing thread are reproducible. The default seed is 0.
+void setRandomSeed(uint64_t seed);
+uint64_t randomSeed(void);
+
+// Generator owned by the calling thread.
+Xoshiro256& threadRng(void);
+
+// Draws k distinct indices from [0, n) with Floyd's algorithm, which takes
+// k draws and no index array. The duplicate check is O(k^2), which suits
+// the minimal sets of RANSAC. Returns false if k > n.
+bool sampleKofN(Xoshiro256& rng, size_t k, size_t n,
+                std::vector<size_t>& samples);
+
+}
+
+#endif
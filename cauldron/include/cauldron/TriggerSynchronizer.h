@@ -0,0 +1,134 @@
+#ifndef TRIGGERSYNCHRONIZER_H
+#define TRIGGERSYNCHRONIZER_H
+
+#include <boost/cstdint.hpp>
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <vector>
+
+namespace px
+{
+
+// Assigns hardware trigger timestamps to camera frames.
+//
+// Trigger events carry a trigger counter and the host time at which the
+// trigger fired. Frames carry the camera's frame counter, the device clock
+// timestamp and the host time at which the frame was received. The two
+// counters differ by an unknown offset, and both wrap around at 2^32.
+//
+// The synchronizer
+// - estimates the counter offset online from the frame arrival times, and
+//   re-estimates it if the current offset stops matching,
+// - estimates the linear relation (offset and drift) between the device
+//   clock and the host clock from matched frames,
+// - waits a bounded amount of time for late trigger events, and
+// - predicts the timestamp from the clock model if the trigger event does
+//   not arrive in time.
+//
+// All timestamps are in nanoseconds.
+class TriggerSynchronizer
+{
+public:
+    enum MatchResult
+    {
+        MATCHED,    // stamp taken from the trigger event
+        PREDICTED,  // stamp predicted from the device clock model
+        FAILED      // no stamp could be assigned
+    };
+
+    // bufferSize: number of trigger events kept (rounded up to a power of 2)
+    // maxWait: maximum time (s) to wait for a late trigger event
+    // forgettingFactor: weight decay of old samples in the clock model
+    explicit TriggerSynchronizer(size_t bufferSize = 64,
+                                 double maxWait = 0.005,
+                                 double forgettingFactor = 0.995);
+
+    void reset(void);
+
+    void addTrigger(uint32_t triggerCounter, uint64_t stamp);
+
+    // Waits at most maxWait for the trigger event of the frame.
+    MatchResult synchronize(uint32_t frameCounter,
+                            uint64_t deviceStamp,
+                            uint64_t arrivalStamp,
+                            uint64_t& stamp);
+
+    // Does not wait for late trigger events.
+    MatchResult trySynchronize(uint32_t frameCounter,
+                               uint64_t deviceStamp,
+                               uint64_t arrivalStamp,
+                               uint64_t& stamp);
+
+    double& maxWait(void);
+
+    // frame counter = trigger counter + counter offset (mod 2^32)
+    uint32_t counterOffset(void);
+    void setCounterOffset(uint32_t counterOffset);
+
+    bool clockModelValid(void);
+    // relative rate difference between the host and device clocks
+    double clockDrift(void);
+
+    size_t matchedCount(void);
+    size_t predictedCount(void);
+    size_t failedCount(void);
+
+private:
+    struct TriggerEvent
+    {
+        uint32_t counter;
+        uint64_t stamp;
+        bool valid;
+    };
+
+    bool findTrigger(uint32_t triggerCounter, uint64_t& stamp) const;
+    bool nearestTrigger(uint64_t stamp, double tolerance,
+                        uint32_t& triggerCounter) const;
+    bool latestTriggerBefore(uint64_t arrivalStamp, uint32_t& triggerCounter) const;
+
+    MatchResult synchronizeLocked(uint32_t frameCounter,
+                                  uint64_t deviceStamp,
+                                  uint64_t arrivalStamp,
+                                  bool mayPredict,
+                                  uint64_t& stamp);
+
+    void updateCounterOffset(uint32_t frameCounter,
+                             uint64_t deviceStamp,
+                             uint64_t arrivalStamp);
+    void updateClockModel(uint64_t deviceStamp, uint64_t stamp);
+    bool predictStamp(uint64_t deviceStamp, uint64_t& stamp) const;
+
+    const size_t k_bufferMask;
+    const size_t k_offsetVotes;
+    const size_t k_offsetDelay;
+    const size_t k_minClockSamples;
+    double m_maxWait;
+
+    boost::mutex m_mutex;
+    boost::condition_variable m_triggerCond;
+    std::vector<TriggerEvent> m_triggers;
+    double m_triggerPeriod;
+
+    uint32_t m_counterOffset;
+    uint32_t m_candidateOffset;
+    size_t m_candidateVotes;
+    // (frame counter, arrival stamp) of recent unmatched frames
+    std::vector<std::pair<uint32_t, uint64_t> > m_unmatchedFrames;
+
+    // weighted least squares of host time against device time,
+    // relative to the first matched sample
+    const double k_forgettingFactor;
+    bool m_clockRefSet;
+    uint64_t m_deviceRef;
+    uint64_t m_stampRef;
+    size_t m_clockSamples;
+    double m_sw, m_sx, m_sy, m_sxx, m_sxy;
+
+    size_t m_matchedCount;
+    size_t m_predictedCount;
+    size_t m_failedCount;
+};
+
+}
+
+#endif
@@ -6,6 +6,8 @@
 #include <Eigen/Dense>
 #include <opencv2/core/core.hpp>
 
+#include "cauldron/Random.h"
+
 namespace px
 {
 
@@ -35,6 +37,29 @@ const T normalizeTheta(const T& theta)
     return normTheta;
 }
 
+// Branch-free wrap into [-pi, pi). Unlike normalizeTheta, the cost does
+// not depend on how far theta is from the interval.
+template<class T>
+const T wrapAngle(const T& theta)
+{
+    const T twoPi = 2.0 * M_PI;
+
+    return theta - twoPi * std::floor((theta + static_cast<T>(M_PI)) * (1.0 / twoPi));
+}
+
+// Batch kernels on plain arrays, written so that the compiler can
+// vectorize them. Input and output arrays may be the same.
+void wrapAngles(const double* theta, double* wrapped, size_t n);
+void wrapAngles(const float* theta, float* wrapped, size_t n);
+void hypot3(const double* x, const double* y, const double* z,
+            double* norm, size_t n);
+void hypot3f(const float* x, const float* y, const float* z,
+             float* norm, size_t n);
+// Scales each vector (x[i], y[i], z[i]) to unit length; zero vectors stay
+// zero.
+void normalize3(double* x, double* y, double* z, size_t n);
+void normalize3f(float* x, float* y, float* z, size_t n);
+
 double d2r(double deg);
 float d2r(float deg);
 double r2d(double rad);
@@ -54,28 +79,30 @@ const T cube(const T& x)
     return x * x * x;
 }
 
+// Draw from a caller-owned generator.
 template<class T>
-const T random(const T& a, const T& b)
+const T random(Xoshiro256& rng, const T& a, const T& b)
 {
-    return static_cast<double>(rand()) / RAND_MAX * (b - a) + a;
+    return rng.uniform() * (b - a) + a;
 }
 
 template<class T>
-const T randomNormal(const T& sigma)
+const T randomNormal(Xoshiro256& rng, const T& sigma)
 {
-    T x1, x2, w;
-
-    do
-    {
-        x1 = 2.0 * random(0.0, 1.0) - 1.0;
-        x2 = 2.0 * random(0.0, 1.0) - 1.0;
-        w = x1 * x1 + x2 * x2;
-    }
-    while (w >= 1.0 || w == 0.0);
+    return rng.normal() * sigma;
+}
 
-    w = sqrt((-2.0 * log(w)) / w);
+// Draw from the generator of the calling thread; see setRandomSeed.
+template<class T>
+const T random(const T& a, const T& b)
+{
+    return random(threadRng(), a, b);
+}
 
-    return x1 * w * sigma;
+template<class T>
+const T randomNormal(const T& sigma)
+{
+    return randomNormal(threadRng(), sigma);
 }
 
 void colorDepthImage(cv::Mat& imgDepth,
@@ -91,6 +118,20 @@ std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > bresCir
 std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > bresFilledCircle(int x0, int y0, int r);
 std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > bresFilledSphere(int x0, int y0, int z0, int r);
 
+// The following overloads write into a caller-owned buffer, which avoids
+// allocations once its capacity suffices. Unlike the functions above, they
+// leave the cells of circles and spheres unsorted. See CellTraversal.h for
+// visitors that need no buffer at all.
+void bresLine(int x0, int y0, int x1, int y1, std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >& cells);
+void bresLine(int x0, int y0, int z0, int x1, int y1, int z1, std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >& cells);
+void bresCircle(int x0, int y0, int r, std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >& cells);
+void bresFilledCircle(int x0, int y0, int r, std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >& cells);
+void bresFilledSphere(int x0, int y0, int z0, int r, std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >& cells);
+
+// Voxels of size voxelSize that the segment from p0 to p1 passes through.
+void voxelRay(const Eigen::Vector3d& p0, const Eigen::Vector3d& p1, double voxelSize,
+              std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >& voxels);
+
 void LLtoUTM(double latitude, double longitude,
              double& utmNorthing, double& utmEasting,
              std::string& utmZone);
@@ -98,6 +139,16 @@ void UTMtoLL(double utmNorthing, double utmEasting,
              const std::string& utmZone,
              double& latitude, double& longitude);
 
+// Batch conversions for a track of points. All points are projected into
+// the zone of the first point, which keeps the coordinates continuous when
+// a track crosses a zone boundary; this zone is returned in utmZone.
+void LLtoUTM(const double* latitudes, const double* longitudes, size_t n,
+             double* utmNorthings, double* utmEastings,
+             std::string& utmZone);
+void UTMtoLL(const double* utmNorthings, const double* utmEastings, size_t n,
+             const std::string& utmZone,
+             double* latitudes, double* longitudes);
+
 long int timestampDiff(uint64_t t1, uint64_t t2);
 
 }
@@ -0,0 +1,307 @@
+#include "cauldron/ImuPreintegration.h"
+
+#include "cauldron/EigenUtils.h"
+
+namespace px
+{
+
+namespace
+{
+
+Eigen::Matrix3d
+expSO3(const Eigen::Vector3d& w)
+{
+    double theta = w.norm();
+    if (theta < 1e-10)
+    {
+        return Eigen::Matrix3d::Identity() + skew(w);
+    }
+
+    return Eigen::AngleAxisd(theta, w / theta).toRotationMatrix();
+}
+
+// right Jacobian of SO(3)
+Eigen::Matrix3d
+rightJacobianSO3(const Eigen::Vector3d& w)
+{
+    double theta = w.norm();
+    Eigen::Matrix3d W = skew(w);
+    if (theta < 1e-5)
+    {
+        return Eigen::Matrix3d::Identity() - 0.5 * W;
+    }
+
+    double theta2 = theta * theta;
+
+    return Eigen::Matrix3d::Identity()
+           - (1.0 - cos(theta)) / theta2 * W
+           + (theta - sin(theta)) / (theta2 * theta) * W * W;
+}
+
+}
+
+ImuPreintegration::ImuPreintegration(const Eigen::Vector3d& gyroBias,
+                                     const Eigen::Vector3d& accelBias)
+ : m_gyroNoiseDensity(1.7e-4)
+ , m_accelNoiseDensity(2.0e-3)
+ , m_gyroRandomWalk(2.0e-5)
+ , m_accelRandomWalk(3.0e-3)
+{
+    reset(gyroBias, accelBias);
+}
+
+double&
+ImuPreintegration::gyroNoiseDensity(void)
+{
+    return m_gyroNoiseDensity;
+}
+
+double
+ImuPreintegration::gyroNoiseDensity(void) const
+{
+    return m_gyroNoiseDensity;
+}
+
+double&
+ImuPreintegration::accelNoiseDensity(void)
+{
+    return m_accelNoiseDensity;
+}
+
+double
+ImuPreintegration::accelNoiseDensity(void) const
+{
+    return m_accelNoiseDensity;
+}
+
+double&
+ImuPreintegration::gyroRandomWalk(void)
+{
+    return m_gyroRandomWalk;
+}
+
+double
+ImuPreintegration::gyroRandomWalk(void) const
+{
+    return m_gyroRandomWalk;
+}
+
+double&
+ImuPreintegration::accelRandomWalk(void)
+{
+    return m_accelRandomWalk;
+}
+
+double
+ImuPreintegration::accelRandomWalk(void) const
+{
+    return m_accelRandomWalk;
+}
+
+void
+ImuPreintegration::reset(const Eigen::Vector3d& gyroBias,
+                         const Eigen::Vector3d& accelBias)
+{
+    m_gyroBias = gyroBias;
+    m_accelBias = accelBias;
+
+    m_deltaTime = 0.0;
+    m_deltaR.setIdentity();
+    m_deltaV.setZero();
+    m_deltaP.setZero();
+
+    m_covariance.setZero();
+
+    m_dR_dbg.setZero();
+    m_dV_dbg.setZero();
+    m_dV_dba.setZero();
+    m_dP_dbg.setZero();
+    m_dP_dba.setZero();
+}
+
+void
+ImuPreintegration::integrate(const Eigen::Vector3d& gyro,
+                             const Eigen::Vector3d& accel,
+                             double dt)
+{
+    if (dt <= 0.0)
+    {
+        return;
+    }
+
+    Eigen::Vector3d w = (gyro - m_gyroBias) * dt;
+    Eigen::Vector3d a = accel - m_accelBias;
+
+    Eigen::Matrix3d dR = expSO3(w);
+    Eigen::Matrix3d Jr = rightJacobianSO3(w);
+    Eigen::Matrix3d Ra = m_deltaR * skew(a);
+
+    double dt2 = dt * dt;
+
+    // propagate the covariance of the deltas before they are updated
+    Eigen::Matrix<double,9,9> A = Eigen::Matrix<double,9,9>::Identity();
+    A.block<3,3>(0,0) = dR.transpose();
+    A.block<3,3>(3,0) = -Ra * dt;
+    A.block<3,3>(6,0) = -0.5 * Ra * dt2;
+    A.block<3,3>(6,3) = Eigen::Matrix3d::Identity() * dt;
+
+    Eigen::Matrix<double,9,3> Bg = Eigen::Matrix<double,9,3>::Zero();
+    Bg.block<3,3>(0,0) = Jr * dt;
+
+    Eigen::Matrix<double,9,3> Ba = Eigen::Matrix<double,9,3>::Zero();
+    Ba.block<3,3>(3,0) = m_deltaR * dt;
+    Ba.block<3,3>(6,0) = 0.5 * m_deltaR * dt2;
+
+    // discrete noise variances
+    double gyroVar = m_gyroNoiseDensity * m_gyroNoiseDensity / dt;
+    double accelVar = m_accelNoiseDensity * m_accelNoiseDensity / dt;
+
+    m_covariance = A * m_covariance * A.transpose()
+                   + gyroVar * Bg * Bg.transpose()
+                   + accelVar * Ba * Ba.transpose();
+
+    // bias Jacobians, position and velocity first as they use the
+    // rotation Jacobian before the step
+    m_dP_dba += m_dV_dba * dt - 0.5 * m_deltaR * dt2;
+    m_dP_dbg += m_dV_dbg * dt - 0.5 * Ra * m_dR_dbg * dt2;
+    m_dV_dba -= m_deltaR * dt;
+    m_dV_dbg -= Ra * m_dR_dbg * dt;
+    m_dR_dbg = dR.transpose() * m_dR_dbg - Jr * dt;
+
+    m_deltaP += m_deltaV * dt + 0.5 * m_deltaR * a * dt2;
+    m_deltaV += m_deltaR * a * dt;
+    m_deltaR = m_deltaR * dR;
+
+    m_deltaTime += dt;
+}
+
+double
+ImuPreintegration::deltaTime(void) const
+{
+    return m_deltaTime;
+}
+
+const Eigen::Matrix3d&
+ImuPreintegration::deltaR(void) const
+{
+    return m_deltaR;
+}
+
+const Eigen::Vector3d&
+ImuPreintegration::deltaV(void) const
+{
+    return m_deltaV;
+}
+
+const Eigen::Vector3d&
+ImuPreintegration::deltaP(void) const
+{
+    return m_deltaP;
+}
+
+const Eigen::Vector3d&
+ImuPreintegration::gyroBias(void) const
+{
+    return m_gyroBias;
+}
+
+const Eigen::Vector3d&
+ImuPreintegration::accelBias(void) const
+{
+    return m_accelBias;
+}
+
+const Eigen::Matrix<double,9,9>&
+ImuPreintegration::covariance(void) const
+{
+    return m_covariance;
+}
+
+const Eigen::Matrix3d&
+ImuPreintegration::dR_dbg(void) const
+{
+    return m_dR_dbg;
+}
+
+const Eigen::Matrix3d&
+ImuPreintegration::dV_dbg(void) const
+{
+    return m_dV_dbg;
+}
+
+const Eigen::Matrix3d&
+ImuPreintegration::dV_dba(void) const
+{
+    return m_dV_dba;
+}
+
+const Eigen::Matrix3d&
+ImuPreintegration::dP_dbg(void) const
+{
+    return m_dP_dbg;
+}
+
+const Eigen::Matrix3d&
+ImuPreintegration::dP_dba(void) const
+{
+    return m_dP_dba;
+}
+
+Eigen::Matrix3d
+ImuPreintegration::correctedDeltaR(const Eigen::Vector3d& gyroBias) const
+{
+    return m_deltaR * expSO3(m_dR_dbg * (gyroBias - m_gyroBias));
+}
+
+Eigen::Vector3d
+ImuPreintegration::correctedDeltaV(const Eigen::Vector3d& gyroBias,
+                                   const Eigen::Vector3d& accelBias) const
+{
+    return m_deltaV + m_dV_dbg * (gyroBias - m_gyroBias)
+                    + m_dV_dba * (accelBias - m_accelBias);
+}
+
+Eigen::Vector3d
+ImuPreintegration::correctedDeltaP(const Eigen::Vector3d& gyroBias,
+                                   const Eigen::Vector3d& accelBias) const
+{
+    return m_deltaP + m_dP_dbg * (gyroBias - m_gyroBias)
+                    + m_dP_dba * (accelBias - m_accelBias);
+}
+
+void
+ImuPreintegration::predict(const Eigen::Matrix3d& R_i, const Eigen::Vector3d& v_i,
+                           const Eigen::Vector3d& p_i, const Eigen::Vector3d& gravity,
+                           Eigen::Matrix3d& R_j, Eigen::Vector3d& v_j,
+                           Eigen::Vector3d& p_j) const
+{
+    double dt = m_deltaTime;
+
+    R_j = R_i * m_deltaR;
+    v_j = v_i + gravity * dt + R_i * m_deltaV;
+    p_j = p_i + v_i * dt + 0.5 * gravity * dt * dt + R_i * m_deltaP;
+}
+
+ImuFactor::ImuFactor(const ImuPreintegration& preintegration,
+                     const Eigen::Vector3d& gravity)
+ : m_preintegration(preintegration)
+ , m_deltaQ(preintegration.deltaR())
+ , m_gravity(gravity)
+{
+    double dt = preintegration.deltaTime();
+
+    Eigen::Matrix<double,15,15> covariance = Eigen::Matrix<double,15,15>::Zero();
+    covariance.block<9,9>(0,0) = preintegration.covariance();
+    covariance.block<3,3>(9,9) = Eigen::Matrix3d::Identity() *
+                                 preintegration.gyroRandomWalk() * preintegration.gyroRandomWalk() * dt;
+    covariance.block<3,3>(12,12) = Eigen::Matrix3d::Identity() *
+                                   preintegration.accelRandomWalk() * preintegration.accelRandomWalk() * dt;
+
+    // r^T Sigma^-1 r = |U r|^2 with U^T U = Sigma^-1
+    Eigen::Matrix<double,15,15> information =
+        covariance.ldlt().solve(Eigen::Matrix<double,15,15>::Identity());
+    information = 0.5 * (information + information.transpose());
+    m_sqrtInformation = information.llt().matrixU();
+}
+
+}
@@ -0,0 +1,463 @@
+#include "cauldron/Profiler.h"
+
+#include <algorithm>
+#include <boost/make_shared.hpp>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <time.h>
+#include <unistd.h>
+
+namespace px
+{
+
+namespace
+{
+
+// histogram bins cover [1e-9, 1e9] with 10 bins per decade; bin 0 holds
+// values below the range and the last bin those above it
+const double k_histMin = 1e-9;
+const int k_binsPerDecade = 10;
+const int k_binCount = 18 * k_binsPerDecade + 2;
+
+void
+writeJsonString(FILE* file, const char* str)
+{
+    fputc('"', file);
+    for (const char* c = str; *c != '\0'; ++c)
+    {
+        if (*c == '"' || *c == '\\')
+        {
+            fputc('\\', file);
+        }
+        fputc(*c, file);
+    }
+    fputc('"', file);
+}
+
+}
+
+Profiler::Statistics::Statistics()
+ : type(TIMER)
+ , count(0)
+ , sum(0.0)
+ , min(std::numeric_limits<double>::max())
+ , max(-std::numeric_limits<double>::max())
+{
+
+}
+
+void
+Profiler::Statistics::add(double value)
+{
+    if (bins.empty())
+    {
+        bins.resize(k_binCount, 0);
+    }
+
+    int bin = 0;
+    if (value > k_histMin)
+    {
+        bin = std::min(static_cast<int>(k_binsPerDecade * log10(value / k_histMin)) + 1,
+                       k_binCount - 1);
+    }
+    ++bins.at(bin);
+
+    ++count;
+    sum += value;
+    min = std::min(min, value);
+    max = std::max(max, value);
+}
+
+double
+Profiler::Statistics::percentile(double p) const
+{
+    if (count == 0)
+    {
+        return 0.0;
+    }
+    if (p <= 0.0)
+    {
+        return min;
+    }
+    if (p >= 1.0)
+    {
+        return max;
+    }
+
+    uint64_t rank = static_cast<uint64_t>(ceil(p * count));
+    rank = std::max(rank, static_cast<uint64_t>(1));
+
+    uint64_t cumCount = 0;
+    for (size_t i = 0; i < bins.size(); ++i)
+    {
+        cumCount += bins.at(i);
+        if (cumCount >= rank)
+        {
+            // geometric center of the bin
+            double value = k_histMin * pow(10.0, (i - 0.5) / k_binsPerDecade);
+
+            return std::max(min, std::min(max, value));
+        }
+    }
+
+    return max;
+}
+
+double
+Profiler::Statistics::mean(void) const
+{
+    if (count == 0)
+    {
+        return 0.0;
+    }
+
+    return sum / count;
+}
+
+Profiler::Profiler()
+ : k_maxThreadBufferSize(1 << 16)
+ , m_enabled(true)
+ , m_startTime(now())
+ , m_threadCount(0)
+ , m_droppedRecordCount(0)
+ , m_traceFile(0)
+ , m_traceEmpty(true)
+{
+
+}
+
+Profiler*
+Profiler::instance(void)
+{
+    // constructed on first use; never destroyed, so that threads still
+    // running at exit can record safely
+    static Profiler* profiler = new Profiler;
+
+    return profiler;
+}
+
+void
+Profiler::setEnabled(bool enabled)
+{
+    m_enabled = enabled;
+}
+
+bool
+Profiler::isEnabled(void) const
+{
+    return m_enabled;
+}
+
+uint64_t
+Profiler::now(void)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+void
+Profiler::addTimer(const char* name, uint64_t startTime, uint64_t endTime)
+{
+    record(name, TIMER, startTime, static_cast<double>(endTime - startTime));
+}
+
+void
+Profiler::addCount(const char* name, double value)
+{
+    record(name, COUNTER, now(), value);
+}
+
+void
+Profiler::addSample(const char* name, double value)
+{
+    record(name, HISTOGRAM, now(), value);
+}
+
+void
+Profiler::collect(void)
+{
+    std::vector<boost::shared_ptr<ThreadBuffer> > buffers;
+    {
+        boost::mutex::scoped_lock lock(m_bufferMutex);
+
+        buffers = m_buffers;
+    }
+
+    // swap the records out so that the recording threads wait no longer
+    // than the swap
+    std::vector<std::vector<Record> > records(buffers.size());
+    uint64_t dropped = 0;
+    for (size_t i = 0; i < buffers.size(); ++i)
+    {
+        ThreadBuffer& buffer = *buffers.at(i);
+
+        boost::mutex::scoped_lock lock(buffer.mutex);
+
+        records.at(i).swap(buffer.records);
+        dropped += buffer.dropped;
+        buffer.dropped = 0;
+    }
+
+    boost::mutex::scoped_lock lock(m_statisticsMutex);
+
+    m_droppedRecordCount = dropped;
+
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        for (size_t j = 0; j < records.at(i).size(); ++j)
+        {
+            const Record& record = records.at(i).at(j);
+
+            Statistics& statistics = m_statistics[record.name];
+            if (statistics.count == 0)
+            {
+                statistics.name = record.name;
+                statistics.type = record.type;
+            }
+
+            switch (record.type)
+            {
+            case TIMER:
+                statistics.add(record.value * 1e-9);
+                break;
+            case COUNTER:
+                statistics.add(record.value);
+                m_counterTotals[record.name] += record.value;
+                break;
+            case HISTOGRAM:
+                statistics.add(record.value);
+                break;
+            }
+
+            if (m_traceFile)
+            {
+                writeTraceRecord(record, buffers.at(i)->threadId);
+            }
+        }
+    }
+
+    if (m_traceFile)
+    {
+        fflush(m_traceFile);
+    }
+}
+
+void
+Profiler::getStatistics(std::vector<Statistics>& statistics) const
+{
+    boost::mutex::scoped_lock lock(m_statisticsMutex);
+
+    statistics.clear();
+    statistics.reserve(m_statistics.size());
+    for (std::map<std::string, Statistics>::const_iterator it = m_statistics.begin();
+             it != m_statistics.end(); ++it)
+    {
+        statistics.push_back(it->second);
+    }
+}
+
+void
+Profiler::resetStatistics(void)
+{
+    boost::mutex::scoped_lock lock(m_statisticsMutex);
+
+    m_statistics.clear();
+    m_counterTotals.clear();
+}
+
+std::string
+Profiler::summary(void) const
+{
+    std::vector<Statistics> statistics;
+    getStatistics(statistics);
+
+    std::ostringstream oss;
+    for (size_t i = 0; i < statistics.size(); ++i)
+    {
+        const Statistics& s = statistics.at(i);
+
+        char line[256];
+        if (s.type == TIMER)
+        {
+            snprintf(line, sizeof(line),
+                     "%-40s n = %8lu | mean = %9.3f ms | p50 = %9.3f ms | p90 = %9.3f ms | p99 = %9.3f ms | max = %9.3f ms\n",
+                     s.name.c_str(), static_cast<unsigned long>(s.count),
+                     s.mean() * 1e3, s.percentile(0.5) * 1e3, s.percentile(0.9) * 1e3,
+                     s.percentile(0.99) * 1e3, s.max * 1e3);
+        }
+        else
+        {
+            snprintf(line, sizeof(line),
+                     "%-40s n = %8lu | mean = %9.3g | p50 = %9.3g | p90 = %9.3g | p99 = %9.3g | max = %9.3g | sum = %.6g\n",
+                     s.name.c_str(), static_cast<unsigned long>(s.count),
+                     s.mean(), s.percentile(0.5), s.percentile(0.9),
+                     s.percentile(0.99), s.max, s.sum);
+        }
+
+        oss << line;
+    }
+
+    return oss.str();
+}
+
+bool
+Profiler::startTrace(const std::string& filename)
+{
+    boost::mutex::scoped_lock lock(m_statisticsMutex);
+
+    if (m_traceFile)
+    {
+        fputs("\n]\n", m_traceFile);
+        fclose(m_traceFile);
+    }
+
+    m_traceFile = fopen(filename.c_str(), "w");
+    if (m_traceFile == 0)
+    {
+        return false;
+    }
+
+    // JSON array format of the Trace Event Format
+    fputc('[', m_traceFile);
+    m_traceEmpty = true;
+
+    return true;
+}
+
+void
+Profiler::stopTrace(void)
+{
+    collect();
+
+    boost::mutex::scoped_lock lock(m_statisticsMutex);
+
+    if (m_traceFile == 0)
+    {
+        return;
+    }
+
+    fputs("\n]\n", m_traceFile);
+    fclose(m_traceFile);
+    m_traceFile = 0;
+}
+
+uint64_t
+Profiler::droppedRecordCount(void) const
+{
+    boost::mutex::scoped_lock lock(m_statisticsMutex);
+
+    return m_droppedRecordCount;
+}
+
+Profiler::ThreadBuffer*
+Profiler::threadBuffer(void)
+{
+    boost::shared_ptr<ThreadBuffer>* holder = m_threadBuffer.get();
+    if (holder == 0)
+    {
+        boost::shared_ptr<ThreadBuffer> buffer;
+
+        {
+            boost::mutex::scoped_lock lock(m_bufferMutex);
+
+            // The pipelines spawn short-lived worker threads for every
+            // frame, so a buffer left by an exited thread is taken over
+            // rather than registering a new one; pending records stay and
+            // are collected as usual.
+            for (size_t i = 0; i < m_buffers.size(); ++i)
+            {
+                if (m_buffers.at(i).unique())
+                {
+                    buffer = m_buffers.at(i);
+                    break;
+                }
+            }
+
+            if (!buffer)
+            {
+                buffer = boost::make_shared<ThreadBuffer>();
+                buffer->dropped = 0;
+                buffer->threadId = m_threadCount++;
+                m_buffers.push_back(buffer);
+            }
+        }
+
+        holder = new boost::shared_ptr<ThreadBuffer>(buffer);
+        m_threadBuffer.reset(holder);
+    }
+
+    return holder->get();
+}
+
+void
+Profiler::record(const char* name, RecordType type, uint64_t time, double value)
+{
+    if (!m_enabled)
+    {
+        return;
+    }
+
+    ThreadBuffer* buffer = threadBuffer();
+
+    boost::mutex::scoped_lock lock(buffer->mutex);
+
+    if (buffer->records.size() >= k_maxThreadBufferSize)
+    {
+        ++buffer->dropped;
+        return;
+    }
+
+    Record record;
+    record.name = name;
+    record.type = type;
+    record.time = time;
+    record.value = value;
+
+    buffer->records.push_back(record);
+}
+
+void
+Profiler::writeTraceRecord(const Record& record, int threadId)
+{
+    fputs(m_traceEmpty ? "\n" : ",\n", m_traceFile);
+    m_traceEmpty = false;
+
+    double ts = (static_cast<int64_t>(record.time - m_startTime)) * 1e-3;
+
+    fputs("{\"name\":", m_traceFile);
+    writeJsonString(m_traceFile, record.name);
+
+    switch (record.type)
+    {
+    case TIMER:
+        fprintf(m_traceFile, ",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d}",
+                ts, record.value * 1e-3, getpid(), threadId);
+        break;
+    case COUNTER:
+        // counters are shown as running totals
+        fprintf(m_traceFile, ",\"ph\":\"C\",\"ts\":%.3f,\"pid\":%d,\"args\":{\"value\":%.17g}}",
+                ts, getpid(), m_counterTotals[record.name]);
+        break;
+    case HISTOGRAM:
+        fprintf(m_traceFile, ",\"ph\":\"C\",\"ts\":%.3f,\"pid\":%d,\"args\":{\"value\":%.17g}}",
+                ts, getpid(), record.value);
+        break;
+    }
+}
+
+ScopedTimer::ScopedTimer(const char* name)
+ : m_name(name)
+ , m_startTime(Profiler::now())
+{
+
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    Profiler::instance()->addTimer(m_name, m_startTime, Profiler::now());
+}
+
+}
@@ -0,0 +1,104 @@
+#include "cauldron/Random.h"
+
+#include <algorithm>
+#include <boost/atomic.hpp>
+#include <boost/thread.hpp>
+
+namespace px
+{
+
+namespace
+{
+
+struct ThreadRng
+{
+    Xoshiro256 rng;
+    unsigned int generation;
+};
+
+boost::mutex g_seedMutex;
+uint64_t g_seed = 0;
+// incremented by setRandomSeed; thread generators compare against it
+boost::atomic<unsigned int> g_generation(0);
+unsigned int g_threadCount = 0;
+
+boost::thread_specific_ptr<ThreadRng> g_threadRng;
+
+void
+seedThreadRng(ThreadRng& threadRng)
+{
+    boost::mutex::scoped_lock lock(g_seedMutex);
+
+    // the ordinal is spread by the golden ratio before mixing into the
+    // seed, so that consecutive threads get unrelated streams
+    threadRng.rng.seed(g_seed ^ (g_threadCount * 0x9e3779b97f4a7c15ULL));
+    threadRng.generation = g_generation.load();
+
+    ++g_threadCount;
+}
+
+}
+
+void
+setRandomSeed(uint64_t seed)
+{
+    boost::mutex::scoped_lock lock(g_seedMutex);
+
+    g_seed = seed;
+    g_threadCount = 0;
+    ++g_generation;
+}
+
+uint64_t
+randomSeed(void)
+{
+    boost::mutex::scoped_lock lock(g_seedMutex);
+
+    return g_seed;
+}
+
+Xoshiro256&
+threadRng(void)
+{
+    ThreadRng* threadRng = g_threadRng.get();
+    if (threadRng == 0)
+    {
+        threadRng = new ThreadRng;
+        g_threadRng.reset(threadRng);
+
+        seedThreadRng(*threadRng);
+    }
+    else if (threadRng->generation != g_generation.load(boost::memory_order_acquire))
+    {
+        seedThreadRng(*threadRng);
+    }
+
+    return threadRng->rng;
+}
+
+bool
+sampleKofN(Xoshiro256& rng, size_t k, size_t n,
+           std::vector<size_t>& samples)
+{
+    samples.clear();
+
+    if (k > n)
+    {
+        return false;
+    }
+
+    for (size_t j = n - k; j < n; ++j)
+    {
+        size_t idx = rng(static_cast<long>(j + 1));
+        if (std::find(samples.begin(), samples.end(), idx) != samples.end())
+        {
+            idx = j;
+        }
+
+        samples.push_back(idx);
+    }
+
+    return true;
+}
+
+}
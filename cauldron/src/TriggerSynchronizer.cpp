@@ -0,0 +1,467 @@
+#include "cauldron/TriggerSynchronizer.h"
+
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <cmath>
+
+namespace px
+{
+
+namespace
+{
+
+size_t
+nextPowerOfTwo(size_t n)
+{
+    size_t p = 1;
+    while (p < n)
+    {
+        p <<= 1;
+    }
+
+    return p;
+}
+
+double
+nsecDiffToSec(uint64_t t1, uint64_t t2)
+{
+    return static_cast<double>(static_cast<int64_t>(t1 - t2)) * 1e-9;
+}
+
+}
+
+TriggerSynchronizer::TriggerSynchronizer(size_t bufferSize,
+                                         double maxWait,
+                                         double forgettingFactor)
+ : k_bufferMask(nextPowerOfTwo(bufferSize) - 1)
+ , k_offsetVotes(3)
+ , k_offsetDelay(2)
+ , k_minClockSamples(10)
+ , m_maxWait(maxWait)
+ , m_triggers(k_bufferMask + 1)
+ , k_forgettingFactor(forgettingFactor)
+{
+    reset();
+}
+
+void
+TriggerSynchronizer::reset(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    for (size_t i = 0; i < m_triggers.size(); ++i)
+    {
+        m_triggers.at(i).valid = false;
+    }
+
+    m_triggerPeriod = 0.0;
+    m_counterOffset = 0;
+    m_candidateOffset = 0;
+    m_candidateVotes = 0;
+    m_unmatchedFrames.clear();
+
+    m_clockRefSet = false;
+    m_deviceRef = 0;
+    m_stampRef = 0;
+    m_clockSamples = 0;
+    m_sw = m_sx = m_sy = m_sxx = m_sxy = 0.0;
+
+    m_matchedCount = 0;
+    m_predictedCount = 0;
+    m_failedCount = 0;
+}
+
+void
+TriggerSynchronizer::addTrigger(uint32_t triggerCounter, uint64_t stamp)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        uint64_t prevStamp;
+        if (findTrigger(triggerCounter - 1, prevStamp) && stamp > prevStamp)
+        {
+            double period = nsecDiffToSec(stamp, prevStamp);
+            if (m_triggerPeriod > 0.0)
+            {
+                m_triggerPeriod = 0.9 * m_triggerPeriod + 0.1 * period;
+            }
+            else
+            {
+                m_triggerPeriod = period;
+            }
+        }
+
+        TriggerEvent& event = m_triggers.at(triggerCounter & k_bufferMask);
+        event.counter = triggerCounter;
+        event.stamp = stamp;
+        event.valid = true;
+    }
+
+    m_triggerCond.notify_all();
+}
+
+TriggerSynchronizer::MatchResult
+TriggerSynchronizer::synchronize(uint32_t frameCounter,
+                                 uint64_t deviceStamp,
+                                 uint64_t arrivalStamp,
+                                 uint64_t& stamp)
+{
+    boost::unique_lock<boost::mutex> lock(m_mutex);
+
+    boost::system_time deadline = boost::get_system_time() +
+        boost::posix_time::microseconds(static_cast<int64_t>(m_maxWait * 1e6));
+
+    while (true)
+    {
+        if (synchronizeLocked(frameCounter, deviceStamp, arrivalStamp,
+                              false, stamp) == MATCHED)
+        {
+            return MATCHED;
+        }
+
+        if (!m_triggerCond.timed_wait(lock, deadline))
+        {
+            break;
+        }
+    }
+
+    return synchronizeLocked(frameCounter, deviceStamp, arrivalStamp,
+                             true, stamp);
+}
+
+TriggerSynchronizer::MatchResult
+TriggerSynchronizer::trySynchronize(uint32_t frameCounter,
+                                    uint64_t deviceStamp,
+                                    uint64_t arrivalStamp,
+                                    uint64_t& stamp)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    return synchronizeLocked(frameCounter, deviceStamp, arrivalStamp,
+                             true, stamp);
+}
+
+double&
+TriggerSynchronizer::maxWait(void)
+{
+    return m_maxWait;
+}
+
+uint32_t
+TriggerSynchronizer::counterOffset(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    return m_counterOffset;
+}
+
+void
+TriggerSynchronizer::setCounterOffset(uint32_t counterOffset)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    m_counterOffset = counterOffset;
+    m_candidateVotes = 0;
+    m_unmatchedFrames.clear();
+}
+
+bool
+TriggerSynchronizer::clockModelValid(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    return m_clockRefSet && m_clockSamples >= k_minClockSamples;
+}
+
+double
+TriggerSynchronizer::clockDrift(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    double det = m_sw * m_sxx - m_sx * m_sx;
+    if (m_clockSamples < k_minClockSamples || det <= 0.0)
+    {
+        return 0.0;
+    }
+
+    return (m_sw * m_sxy - m_sx * m_sy) / det - 1.0;
+}
+
+size_t
+TriggerSynchronizer::matchedCount(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    return m_matchedCount;
+}
+
+size_t
+TriggerSynchronizer::predictedCount(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    return m_predictedCount;
+}
+
+size_t
+TriggerSynchronizer::failedCount(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    return m_failedCount;
+}
+
+bool
+TriggerSynchronizer::findTrigger(uint32_t triggerCounter, uint64_t& stamp) const
+{
+    const TriggerEvent& event = m_triggers.at(triggerCounter & k_bufferMask);
+    if (!event.valid || event.counter != triggerCounter)
+    {
+        return false;
+    }
+
+    stamp = event.stamp;
+
+    return true;
+}
+
+bool
+TriggerSynchronizer::nearestTrigger(uint64_t stamp, double tolerance,
+                                    uint32_t& triggerCounter) const
+{
+    bool found = false;
+    double minDiff = tolerance;
+
+    for (size_t i = 0; i < m_triggers.size(); ++i)
+    {
+        const TriggerEvent& event = m_triggers.at(i);
+        if (!event.valid)
+        {
+            continue;
+        }
+
+        double diff = std::fabs(nsecDiffToSec(event.stamp, stamp));
+        if (diff < minDiff)
+        {
+            minDiff = diff;
+            triggerCounter = event.counter;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+bool
+TriggerSynchronizer::latestTriggerBefore(uint64_t arrivalStamp,
+                                         uint32_t& triggerCounter) const
+{
+    bool found = false;
+    uint64_t latestStamp = 0;
+
+    for (size_t i = 0; i < m_triggers.size(); ++i)
+    {
+        const TriggerEvent& event = m_triggers.at(i);
+        if (!event.valid || event.stamp > arrivalStamp)
+        {
+            continue;
+        }
+
+        if (!found || event.stamp > latestStamp)
+        {
+            latestStamp = event.stamp;
+            triggerCounter = event.counter;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+TriggerSynchronizer::MatchResult
+TriggerSynchronizer::synchronizeLocked(uint32_t frameCounter,
+                                       uint64_t deviceStamp,
+                                       uint64_t arrivalStamp,
+                                       bool mayPredict,
+                                       uint64_t& stamp)
+{
+    if (findTrigger(frameCounter - m_counterOffset, stamp))
+    {
+        m_candidateVotes = 0;
+        m_unmatchedFrames.clear();
+
+        updateClockModel(deviceStamp, stamp);
+
+        ++m_matchedCount;
+        return MATCHED;
+    }
+
+    if (!mayPredict)
+    {
+        return FAILED;
+    }
+
+    // The trigger event did not arrive in time. This happens either
+    // because it is late or lost, or because the counter offset changed.
+    updateCounterOffset(frameCounter, deviceStamp, arrivalStamp);
+
+    if (findTrigger(frameCounter - m_counterOffset, stamp))
+    {
+        updateClockModel(deviceStamp, stamp);
+
+        ++m_matchedCount;
+        return MATCHED;
+    }
+
+    if (predictStamp(deviceStamp, stamp))
+    {
+        ++m_predictedCount;
+        return PREDICTED;
+    }
+
+    ++m_failedCount;
+    return FAILED;
+}
+
+void
+TriggerSynchronizer::updateCounterOffset(uint32_t frameCounter,
+                                         uint64_t deviceStamp,
+                                         uint64_t arrivalStamp)
+{
+    uint32_t triggerCounter;
+
+    uint64_t predictedStamp;
+    if (predictStamp(deviceStamp, predictedStamp))
+    {
+        // Once the clock model is valid, only a trigger event close to the
+        // predicted stamp is evidence for a new offset. This prevents the
+        // event of the previous frame from being taken as a candidate when
+        // trigger events are consistently late.
+        double tolerance = 0.005;
+        if (m_triggerPeriod > 0.0)
+        {
+            tolerance = 0.25 * m_triggerPeriod;
+        }
+
+        if (!nearestTrigger(predictedStamp, tolerance, triggerCounter))
+        {
+            return;
+        }
+    }
+    else
+    {
+        // Without a clock model, the trigger event preceding the frame
+        // arrival is the candidate. The trigger events of the most recent
+        // frames may still be in flight, so vote with a frame that is
+        // k_offsetDelay frames old.
+        m_unmatchedFrames.push_back(std::make_pair(frameCounter, arrivalStamp));
+        if (m_unmatchedFrames.size() <= k_offsetDelay)
+        {
+            return;
+        }
+
+        uint32_t oldFrameCounter = m_unmatchedFrames.front().first;
+        uint64_t oldArrivalStamp = m_unmatchedFrames.front().second;
+        m_unmatchedFrames.erase(m_unmatchedFrames.begin());
+
+        if (!latestTriggerBefore(oldArrivalStamp, triggerCounter))
+        {
+            return;
+        }
+
+        frameCounter = oldFrameCounter;
+    }
+
+    uint32_t candidateOffset = frameCounter - triggerCounter;
+    if (candidateOffset == m_counterOffset)
+    {
+        // consistent with the current offset; the trigger event
+        // for this frame was lost or is late
+        m_candidateVotes = 0;
+        return;
+    }
+
+    if (m_candidateVotes > 0 && candidateOffset == m_candidateOffset)
+    {
+        ++m_candidateVotes;
+    }
+    else
+    {
+        m_candidateOffset = candidateOffset;
+        m_candidateVotes = 1;
+    }
+
+    if (m_candidateVotes >= k_offsetVotes)
+    {
+        m_counterOffset = m_candidateOffset;
+        m_candidateVotes = 0;
+        m_unmatchedFrames.clear();
+    }
+}
+
+void
+TriggerSynchronizer::updateClockModel(uint64_t deviceStamp, uint64_t stamp)
+{
+    if (deviceStamp == 0)
+    {
+        return;
+    }
+
+    if (m_clockRefSet)
+    {
+        // restart the model if the device clock jumped
+        uint64_t predictedStamp;
+        if (predictStamp(deviceStamp, predictedStamp) &&
+            std::fabs(nsecDiffToSec(stamp, predictedStamp)) > 0.5)
+        {
+            m_clockRefSet = false;
+        }
+    }
+
+    if (!m_clockRefSet)
+    {
+        m_deviceRef = deviceStamp;
+        m_stampRef = stamp;
+        m_clockSamples = 0;
+        m_sw = m_sx = m_sy = m_sxx = m_sxy = 0.0;
+        m_clockRefSet = true;
+    }
+
+    double x = nsecDiffToSec(deviceStamp, m_deviceRef);
+    double y = nsecDiffToSec(stamp, m_stampRef);
+
+    m_sw = k_forgettingFactor * m_sw + 1.0;
+    m_sx = k_forgettingFactor * m_sx + x;
+    m_sy = k_forgettingFactor * m_sy + y;
+    m_sxx = k_forgettingFactor * m_sxx + x * x;
+    m_sxy = k_forgettingFactor * m_sxy + x * y;
+
+    ++m_clockSamples;
+}
+
+bool
+TriggerSynchronizer::predictStamp(uint64_t deviceStamp, uint64_t& stamp) const
+{
+    if (!m_clockRefSet || deviceStamp == 0 ||
+        m_clockSamples < k_minClockSamples)
+    {
+        return false;
+    }
+
+    double det = m_sw * m_sxx - m_sx * m_sx;
+    if (det <= 1e-12)
+    {
+        return false;
+    }
+
+    double b = (m_sw * m_sxy - m_sx * m_sy) / det;
+    double a = (m_sy - b * m_sx) / m_sw;
+
+    double x = nsecDiffToSec(deviceStamp, m_deviceRef);
+    double y = a + b * x;
+
+    stamp = m_stampRef + static_cast<int64_t>(llround(y * 1e9));
+
+    return true;
+}
+
+}
@@ -1,7 +1,10 @@
 #include "cauldron/cauldron.h"
 
+#include <algorithm>
 #include <set>
 
+#include "cauldron/CellTraversal.h"
+
 const double WGS84_A = 6378137.0;
 const double WGS84_ECCSQ = 0.00669437999013;
 
@@ -20,6 +23,72 @@ hypot3f(float x, float y, float z)
     return sqrtf(square(x) + square(y) + square(z));
 }
 
+void
+wrapAngles(const double* theta, double* wrapped, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        wrapped[i] = wrapAngle(theta[i]);
+    }
+}
+
+void
+wrapAngles(const float* theta, float* wrapped, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        wrapped[i] = wrapAngle(theta[i]);
+    }
+}
+
+void
+hypot3(const double* x, const double* y, const double* z,
+       double* norm, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        norm[i] = sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+    }
+}
+
+void
+hypot3f(const float* x, const float* y, const float* z,
+        float* norm, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        norm[i] = sqrtf(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+    }
+}
+
+void
+normalize3(double* x, double* y, double* z, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        double norm = sqrt(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        double scale = norm > 0.0 ? 1.0 / norm : 0.0;
+
+        x[i] *= scale;
+        y[i] *= scale;
+        z[i] *= scale;
+    }
+}
+
+void
+normalize3f(float* x, float* y, float* z, size_t n)
+{
+    for (size_t i = 0; i < n; ++i)
+    {
+        float norm = sqrtf(x[i] * x[i] + y[i] * y[i] + z[i] * z[i]);
+        float scale = norm > 0.0f ? 1.0f / norm : 0.0f;
+
+        x[i] *= scale;
+        y[i] *= scale;
+        z[i] *= scale;
+    }
+}
+
 double
 d2r(double deg)
 {
@@ -369,347 +438,182 @@ colormap(const std::string& name, unsigned char idx,
     return false;
 }
 
-std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >
-bresLine(int x0, int y0, int x1, int y1)
+namespace
 {
-    // Bresenham's line algorithm
-    // Find cells intersected by line between (x0,y0) and (x1,y1)
 
-    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells;
+struct CellCollector2
+{
+    explicit CellCollector2(std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >& cells_)
+     : cells(cells_) {}
 
-    int dx = std::abs(x1 - x0);
-    int dy = std::abs(y1 - y0);
+    bool operator()(int x, int y)
+    {
+        cells.push_back(Eigen::Vector2i(x, y));
+        return true;
+    }
 
-    int sx = (x0 < x1) ? 1 : -1;
-    int sy = (y0 < y1) ? 1 : -1;
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >& cells;
+};
 
-    int err = dx - dy;
+struct CellCollector3
+{
+    explicit CellCollector3(std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >& cells_)
+     : cells(cells_) {}
 
-    while (1)
+    bool operator()(int x, int y, int z)
     {
-        cells.push_back(Eigen::Vector2i(x0, y0));
-
-        if (x0 == x1 && y0 == y1)
-        {
-            break;
-        }
-
-        int e2 = 2 * err;
-        if (e2 > -dy)
-        {
-            err -= dy;
-            x0 += sx;
-        }
-        if (e2 < dx)
-        {
-            err += dx;
-            y0 += sy;
-        }
+        cells.push_back(Eigen::Vector3i(x, y, z));
+        return true;
     }
 
-    return cells;
+    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >& cells;
+};
+
+bool
+lessXY(const Eigen::Vector2i& a, const Eigen::Vector2i& b)
+{
+    return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
 }
 
-std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >
-bresLine(int x0, int y0, int z0, int x1, int y1, int z1)
+bool
+lessZXY(const Eigen::Vector3i& a, const Eigen::Vector3i& b)
 {
-    // Bresenham's line algorithm
-    // Find cells intersected by line between (x0,y0,z0) and (x1,y1,z1)
+    if (a(2) != b(2))
+    {
+        return a(2) < b(2);
+    }
 
-    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > cells;
+    return a(0) < b(0) || (a(0) == b(0) && a(1) < b(1));
+}
 
-    int dx = std::abs(x1 - x0);
-    int dy = std::abs(y1 - y0);
-    int dz = std::abs(z1 - z0);
+}
 
-    int dx2 = dx << 1;
-    int dy2 = dy << 1;
-    int dz2 = dz << 1;
+void
+bresLine(int x0, int y0, int x1, int y1,
+         std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >& cells)
+{
+    // Bresenham's line algorithm
+    // Find cells intersected by line between (x0,y0) and (x1,y1)
 
-    int sx = (x0 < x1) ? 1 : -1;
-    int sy = (y0 < y1) ? 1 : -1;
-    int sz = (z0 < z1) ? 1 : -1;
+    cells.clear();
 
-    if ((dx >= dy) && (dx >= dz))
-    {
-        int e1 = dy2 - dx;
-        int e2 = dz2 - dx;
+    CellCollector2 collector(cells);
+    visitBresLine(x0, y0, x1, y1, collector);
+}
 
-        for (int i = 0; i <= dx; ++i)
-        {
-            cells.push_back(Eigen::Vector3i(x0, y0, z0));
+std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >
+bresLine(int x0, int y0, int x1, int y1)
+{
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells;
+    bresLine(x0, y0, x1, y1, cells);
 
-            if (e1 > 0)
-            {
-                y0 += sy;
-                e1 -= dx2;
-            }
-            if (e2 > 0)
-            {
-                z0 += sz;
-                e2 -= dx2;
-            }
-            e1 += dy2;
-            e2 += dz2;
-            x0 += sx;
-        }
-    }
-    else if ((dy >= dx) && (dy >= dz))
-    {
-        int e1 = dx2 - dy;
-        int e2 = dz2 - dy;
+    return cells;
+}
 
-        for (int i = 0; i <= dy; ++i)
-        {
-            cells.push_back(Eigen::Vector3i(x0, y0, z0));
+void
+bresLine(int x0, int y0, int z0, int x1, int y1, int z1,
+         std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >& cells)
+{
+    // Bresenham's line algorithm
+    // Find cells intersected by line between (x0,y0,z0) and (x1,y1,z1)
 
-            if (e1 > 0)
-            {
-                x0 += sx;
-                e1 -= dy2;
-            }
-            if (e2 > 0)
-            {
-                z0 += sz;
-                e2 -= dy2;
-            }
-            e1 += dx2;
-            e2 += dz2;
-            y0 += sy;
-        }
-    }
-    else
-    {
-        int e1 = dy2 - dz;
-        int e2 = dx2 - dz;
+    cells.clear();
 
-        for (int i = 0; i <= dz; ++i)
-        {
-            cells.push_back(Eigen::Vector3i(x0, y0, z0));
+    CellCollector3 collector(cells);
+    visitBresLine(x0, y0, z0, x1, y1, z1, collector);
+}
 
-            if (e1 > 0)
-            {
-                y0 += sy;
-                e1 -= dz2;
-            }
-            if (e2 > 0)
-            {
-                x0 += sx;
-                e2 -= dz2;
-            }
-            e1 += dy2;
-            e2 += dx2;
-            z0 += sz;
-        }
-    }
+std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >
+bresLine(int x0, int y0, int z0, int x1, int y1, int z1)
+{
+    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > cells;
+    bresLine(x0, y0, z0, x1, y1, z1, cells);
 
     return cells;
 }
 
-std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >
-bresCircle(int x0, int y0, int r)
+void
+bresCircle(int x0, int y0, int r,
+           std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >& cells)
 {
     // Bresenham's circle algorithm
     // Find cells intersected by circle with center (x0,y0) and radius r
 
-    std::vector< std::vector<bool> > mask(2 * r + 1);
-
-    for (int i = 0; i < 2 * r + 1; ++i)
-    {
-        mask[i].resize(2 * r + 1);
-        for (int j = 0; j < 2 * r + 1; ++j)
-        {
-            mask[i][j] = false;
-        }
-    }
-
-    int x = r;
-    int y = 0;
-    int r_err = 1 - x;
+    cells.clear();
 
-    while (x >= y)
-    {
-        mask[x + r][y + r] = true;
-        mask[y + r][x + r] = true;
-        mask[-x + r][y + r] = true;
-        mask[-y + r][x + r] = true;
-        mask[-x + r][-y + r] = true;
-        mask[-y + r][-x + r] = true;
-        mask[x + r][-y + r] = true;
-        mask[y + r][-x + r] = true;
-
-        ++y;
-        if (r_err < 0)
-        {
-            r_err += 2 * y + 1;
-        }
-        else
-        {
-            --x;
-            r_err += 2 * (y - x + 1);
-        }
-    }
+    CellCollector2 collector(cells);
+    visitBresCircle(x0, y0, r, collector);
+}
 
+std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >
+bresCircle(int x0, int y0, int r)
+{
     std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells;
-    for (int i = 0; i < 2 * r + 1; ++i)
-    {
-        for (int j = 0; j < 2 * r + 1; ++j)
-        {
-            if (mask[i][j])
-            {
-                cells.push_back(Eigen::Vector2i(i - r + x0, j - r + y0));
-            }
-        }
-    }
+    bresCircle(x0, y0, r, cells);
+
+    // row-major order, as returned by the former mask-based version
+    std::sort(cells.begin(), cells.end(), lessXY);
 
     return cells;
 }
 
-std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >
-bresFilledCircle(int x0, int y0, int r)
+void
+bresFilledCircle(int x0, int y0, int r,
+                 std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >& cells)
 {
     // Bresenham's circle algorithm
     // Find cells intersected and contained by circle with center (x0,y0) and radius r
 
-    std::vector< std::vector<bool> > mask(2 * r + 1);
-
-    for (int i = 0; i < 2 * r + 1; ++i)
-    {
-        mask[i].resize(2 * r + 1);
-        for (int j = 0; j < 2 * r + 1; ++j)
-        {
-            mask[i][j] = false;
-        }
-    }
-
-    int f = 1 - r;
-    int ddF_x = 1;
-    int ddF_y = -2 * r;
-    int x = 0;
-    int y = r;
-
-    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > line;
-
-    line = bresLine(x0, y0 - r, x0, y0 + r);
-    for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
-         it != line.end(); ++it)
-    {
-        Eigen::Vector2i& p = *it;
-
-        mask[p(0) - x0 + r][p(1) - y0 + r] = true;
-    }
-
-    line = bresLine(x0 - r, y0, x0 + r, y0);
-    for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
-         it != line.end(); ++it)
-    {
-        Eigen::Vector2i& p = *it;
-
-        mask[p(0) - x0 + r][p(1) - y0 + r] = true;
-    }
-
-    while (x < y)
-    {
-        if (f >= 0)
-        {
-            y--;
-            ddF_y += 2;
-            f += ddF_y;
-        }
-
-        x++;
-        ddF_x += 2;
-        f += ddF_x;
-
-        line = bresLine(x0 - x, y0 + y, x0 + x, y0 + y);
-        for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
-             it != line.end(); ++it)
-        {
-            Eigen::Vector2i& p = *it;
-
-            mask[p(0) - x0 + r][p(1) - y0 + r] = true;
-        }
+    cells.clear();
 
-        line = bresLine(x0 - x, y0 - y, x0 + x, y0 - y);
-        for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
-             it != line.end(); ++it)
-        {
-            Eigen::Vector2i& p = *it;
+    CellCollector2 collector(cells);
+    visitBresFilledCircle(x0, y0, r, collector);
+}
 
-            mask[p(0) - x0 + r][p(1) - y0 + r] = true;
-        }
+std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >
+bresFilledCircle(int x0, int y0, int r)
+{
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells;
+    bresFilledCircle(x0, y0, r, cells);
 
-        line = bresLine(x0 - y, y0 + x, x0 + y, y0 + x);
-        for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
-             it != line.end(); ++it)
-        {
-            Eigen::Vector2i& p = *it;
+    // row-major order, as returned by the former mask-based version
+    std::sort(cells.begin(), cells.end(), lessXY);
 
-            mask[p(0) - x0 + r][p(1) - y0 + r] = true;
-        }
+    return cells;
+}
 
-        line = bresLine(x0 - y, y0 - x, x0 + y, y0 - x);
-        for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
-             it != line.end(); ++it)
-        {
-            Eigen::Vector2i& p = *it;
+void
+bresFilledSphere(int x0, int y0, int z0, int r,
+                 std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >& cells)
+{
+    // Find cells intersected and contained by sphere with center (x0,y0,z0) and radius r
 
-            mask[p(0) - x0 + r][p(1) - y0 + r] = true;
-        }
-    }
+    cells.clear();
 
-    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells;
-    for (int i = 0; i < 2 * r + 1; ++i)
-    {
-        for (int j = 0; j < 2 * r + 1; ++j)
-        {
-            if (mask[i][j])
-            {
-                cells.push_back(Eigen::Vector2i(i - r + x0, j - r + y0));
-            }
-        }
-    }
-
-    return cells;
+    CellCollector3 collector(cells);
+    visitBresFilledSphere(x0, y0, z0, r, collector);
 }
 
 std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >
 bresFilledSphere(int x0, int y0, int z0, int r)
 {
-    // Find cells intersected and contained by sphere with center (x0,y0,z0) and radius r
-
-    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > zCircle;
-    zCircle = bresCircle(0, 0, r);
-
     std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > cells;
+    bresFilledSphere(x0, y0, z0, r, cells);
 
-    for (size_t i = 0; i < zCircle.size(); ++i)
-    {
-        const Eigen::Vector2i& zCell = zCircle.at(i);
-
-        int z = zCell(0) + z0;
-        int r = zCell(1);
-
-        if (r < 0)
-        {
-            continue;
-        }
-
-        std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > circCells;
-        circCells = bresFilledCircle(x0, y0, r);
-
-        cells.reserve(cells.size() + circCells.size());
+    // slice by slice, each in row-major order
+    std::sort(cells.begin(), cells.end(), lessZXY);
 
-        for (size_t j = 0; j < circCells.size(); ++j)
-        {
-            Eigen::Vector3i p;
-            p << circCells.at(j), z;
+    return cells;
+}
 
-            cells.push_back(p);
-        }
-    }
+void
+voxelRay(const Eigen::Vector3d& p0, const Eigen::Vector3d& p1, double voxelSize,
+         std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >& voxels)
+{
+    voxels.clear();
 
-    return cells;
+    CellCollector3 collector(voxels);
+    visitVoxelRay(p0, p1, voxelSize, collector);
 }
 
 char
@@ -745,26 +649,12 @@ UTMLetterDesignator(double latitude)
     return letterDesignator;
 }
 
-void
-LLtoUTM(double latitude, double longitude,
-        double& utmNorthing, double& utmEasting, std::string& utmZone)
+namespace
 {
-    // converts lat/long to UTM coords.  Equations from USGS Bulletin 1532
-    // East Longitudes are positive, West longitudes are negative.
-    // North latitudes are positive, South latitudes are negative
-    // Lat and Long are in decimal degrees
-    // Written by Chuck Gantz- chuck.gantz@globalstar.com
-
-    double k0 = 0.9996;
-
-    double LongOrigin;
-    double eccPrimeSquared;
-    double N, T, C, A, M;
-
-    double LatRad = latitude * M_PI / 180.0;
-    double LongRad = longitude * M_PI / 180.0;
-    double LongOriginRad;
 
+int
+UTMZoneNumber(double latitude, double longitude)
+{
     int ZoneNumber = static_cast<int>((longitude + 180.0) / 6.0) + 1;
 
     if (latitude >= 56.0 && latitude < 64.0 &&
@@ -779,34 +669,45 @@ LLtoUTM(double latitude, double longitude,
         else if (longitude >= 21.0 && longitude < 33.0) ZoneNumber = 35;
         else if (longitude >= 33.0 && longitude < 42.0) ZoneNumber = 37;
     }
-    LongOrigin = static_cast<double>((ZoneNumber - 1) * 6 - 180 + 3);  //+3 puts origin in middle of zone
-    LongOriginRad = LongOrigin * M_PI / 180.0;
 
-    // compute the UTM Zone from the latitude and longitude
-    std::ostringstream oss;
-    oss << ZoneNumber << UTMLetterDesignator(latitude);
-    utmZone = oss.str();
+    return ZoneNumber;
+}
 
-    eccPrimeSquared = WGS84_ECCSQ / (1.0 - WGS84_ECCSQ);
-
-    N = WGS84_A / sqrt(1.0 - WGS84_ECCSQ * sin(LatRad) * sin(LatRad));
-    T = tan(LatRad) * tan(LatRad);
-    C = eccPrimeSquared * cos(LatRad) * cos(LatRad);
-    A = cos(LatRad) * (LongRad - LongOriginRad);
-
-    M = WGS84_A * ((1.0 - WGS84_ECCSQ / 4.0
-                    - 3.0 * WGS84_ECCSQ * WGS84_ECCSQ / 64.0
-                    - 5.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 256.0)
-                   * LatRad
-                   - (3.0 * WGS84_ECCSQ / 8.0
-                      + 3.0 * WGS84_ECCSQ * WGS84_ECCSQ / 32.0
-                      + 45.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 1024.0)
-                   * sin(2.0 * LatRad)
-                   + (15.0 * WGS84_ECCSQ * WGS84_ECCSQ / 256.0
-                      + 45.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 1024.0)
-                   * sin(4.0 * LatRad)
-                   - (35.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 3072.0)
-                   * sin(6.0 * LatRad));
+// Transverse Mercator projection about the central meridian LongOriginRad,
+// without the southern hemisphere offset. Shared by the scalar and batch
+// versions of LLtoUTM; sin, cos and tan of the latitude are evaluated once.
+inline void
+projectUTM(double latitude, double longitude, double LongOriginRad,
+           double& utmNorthing, double& utmEasting)
+{
+    const double k0 = 0.9996;
+    const double eccPrimeSquared = WGS84_ECCSQ / (1.0 - WGS84_ECCSQ);
+
+    double LatRad = latitude * M_PI / 180.0;
+    double LongRad = longitude * M_PI / 180.0;
+
+    double sinLat = sin(LatRad);
+    double cosLat = cos(LatRad);
+    double tanLat = tan(LatRad);
+
+    double N = WGS84_A / sqrt(1.0 - WGS84_ECCSQ * sinLat * sinLat);
+    double T = tanLat * tanLat;
+    double C = eccPrimeSquared * cosLat * cosLat;
+    double A = cosLat * (LongRad - LongOriginRad);
+
+    double M = WGS84_A * ((1.0 - WGS84_ECCSQ / 4.0
+                           - 3.0 * WGS84_ECCSQ * WGS84_ECCSQ / 64.0
+                           - 5.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 256.0)
+                          * LatRad
+                          - (3.0 * WGS84_ECCSQ / 8.0
+                             + 3.0 * WGS84_ECCSQ * WGS84_ECCSQ / 32.0
+                             + 45.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 1024.0)
+                          * sin(2.0 * LatRad)
+                          + (15.0 * WGS84_ECCSQ * WGS84_ECCSQ / 256.0
+                             + 45.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 1024.0)
+                          * sin(4.0 * LatRad)
+                          - (35.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 3072.0)
+                          * sin(6.0 * LatRad));
 
     utmEasting = k0 * N * (A + (1.0 - T + C) * A * A * A / 6.0
                            + (5.0 - 18.0 * T + T * T + 72.0 * C
@@ -814,17 +715,119 @@ LLtoUTM(double latitude, double longitude,
                            * A * A * A * A * A / 120.0)
                  + 500000.0;
 
-    utmNorthing = k0 * (M + N * tan(LatRad) *
+    utmNorthing = k0 * (M + N * tanLat *
                         (A * A / 2.0 +
                          (5.0 - T + 9.0 * C + 4.0 * C * C) * A * A * A * A / 24.0
                          + (61.0 - 58.0 * T + T * T + 600.0 * C
                             - 330.0 * eccPrimeSquared)
                          * A * A * A * A * A * A / 720.0));
+}
+
+// Inverse of projectUTM; y has the southern hemisphere offset removed.
+inline void
+unprojectUTM(double x, double y, double LongOrigin,
+             double& latitude, double& longitude)
+{
+    const double k0 = 0.9996;
+    const double eccPrimeSquared = WGS84_ECCSQ / (1.0 - WGS84_ECCSQ);
+    const double e1 = (1.0 - sqrt(1.0 - WGS84_ECCSQ)) / (1.0 + sqrt(1.0 - WGS84_ECCSQ));
+
+    double M = y / k0;
+    double mu = M / (WGS84_A * (1.0 - WGS84_ECCSQ / 4.0
+                                - 3.0 * WGS84_ECCSQ * WGS84_ECCSQ / 64.0
+                                - 5.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 256.0));
+
+    double phi1Rad = mu + (3.0 * e1 / 2.0 - 27.0 * e1 * e1 * e1 / 32.0) * sin(2.0 * mu)
+                     + (21.0 * e1 * e1 / 16.0 - 55.0 * e1 * e1 * e1 * e1 / 32.0)
+                     * sin(4.0 * mu)
+                     + (151.0 * e1 * e1 * e1 / 96.0) * sin(6.0 * mu);
+
+    double sinPhi1 = sin(phi1Rad);
+    double cosPhi1 = cos(phi1Rad);
+    double tanPhi1 = tan(phi1Rad);
+
+    double N1 = WGS84_A / sqrt(1.0 - WGS84_ECCSQ * sinPhi1 * sinPhi1);
+    double T1 = tanPhi1 * tanPhi1;
+    double C1 = eccPrimeSquared * cosPhi1 * cosPhi1;
+    double R1 = WGS84_A * (1.0 - WGS84_ECCSQ) /
+                pow(1.0 - WGS84_ECCSQ * sinPhi1 * sinPhi1, 1.5);
+    double D = x / (N1 * k0);
+
+    latitude = phi1Rad - (N1 * tanPhi1 / R1)
+               * (D * D / 2.0 - (5.0 + 3.0 * T1 + 10.0 * C1 - 4.0 * C1 * C1
+                                 - 9.0 * eccPrimeSquared) * D * D * D * D / 24.0
+                  + (61.0 + 90.0 * T1 + 298.0 * C1 + 45.0 * T1 * T1
+                     - 252.0 * eccPrimeSquared - 3.0 * C1 * C1)
+                  * D * D * D * D * D * D / 720.0);
+    latitude *= 180.0 / M_PI;
+
+    longitude = (D - (1.0 + 2.0 * T1 + C1) * D * D * D / 6.0
+                 + (5.0 - 2.0 * C1 + 28.0 * T1 - 3.0 * C1 * C1
+                    + 8.0 * eccPrimeSquared + 24.0 * T1 * T1)
+                 * D * D * D * D * D / 120.0) / cosPhi1;
+    longitude = LongOrigin + longitude / M_PI * 180.0;
+}
+
+}
+
+void
+LLtoUTM(double latitude, double longitude,
+        double& utmNorthing, double& utmEasting, std::string& utmZone)
+{
+    // converts lat/long to UTM coords.  Equations from USGS Bulletin 1532
+    // East Longitudes are positive, West longitudes are negative.
+    // North latitudes are positive, South latitudes are negative
+    // Lat and Long are in decimal degrees
+    // Written by Chuck Gantz- chuck.gantz@globalstar.com
+
+    int ZoneNumber = UTMZoneNumber(latitude, longitude);
+
+    double LongOrigin = static_cast<double>((ZoneNumber - 1) * 6 - 180 + 3);  //+3 puts origin in middle of zone
+    double LongOriginRad = LongOrigin * M_PI / 180.0;
+
+    // compute the UTM Zone from the latitude and longitude
+    std::ostringstream oss;
+    oss << ZoneNumber << UTMLetterDesignator(latitude);
+    utmZone = oss.str();
+
+    projectUTM(latitude, longitude, LongOriginRad, utmNorthing, utmEasting);
+
     if (latitude < 0.0) {
         utmNorthing += 10000000.0; //10000000 meter offset for southern hemisphere
     }
 }
 
+void
+LLtoUTM(const double* latitudes, const double* longitudes, size_t n,
+        double* utmNorthings, double* utmEastings, std::string& utmZone)
+{
+    if (n == 0)
+    {
+        utmZone.clear();
+        return;
+    }
+
+    // the zone and the hemisphere are those of the first point, so that
+    // UTMtoLL with the returned zone inverts all points
+    int ZoneNumber = UTMZoneNumber(latitudes[0], longitudes[0]);
+    char ZoneLetter = UTMLetterDesignator(latitudes[0]);
+
+    double LongOrigin = static_cast<double>((ZoneNumber - 1) * 6 - 180 + 3);
+    double LongOriginRad = LongOrigin * M_PI / 180.0;
+    double northingOffset = (ZoneLetter - 'N') >= 0 ? 0.0 : 10000000.0;
+
+    std::ostringstream oss;
+    oss << ZoneNumber << ZoneLetter;
+    utmZone = oss.str();
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        projectUTM(latitudes[i], longitudes[i], LongOriginRad,
+                   utmNorthings[i], utmEastings[i]);
+        utmNorthings[i] += northingOffset;
+    }
+}
+
 void
 UTMtoLL(double utmNorthing, double utmEasting, const std::string& utmZone,
         double& latitude, double& longitude)
@@ -835,64 +838,32 @@ UTMtoLL(double utmNorthing, double utmEasting, const std::string& utmZone,
     // Lat and Long are in decimal degrees.
     // Written by Chuck Gantz- chuck.gantz@globalstar.com
 
-    double k0 = 0.9996;
-    double eccPrimeSquared;
-    double e1 = (1.0 - sqrt(1.0 - WGS84_ECCSQ)) / (1.0 + sqrt(1.0 - WGS84_ECCSQ));
-    double N1, T1, C1, R1, D, M;
-    double LongOrigin;
-    double mu, phi1, phi1Rad;
-    double x, y;
+    UTMtoLL(&utmNorthing, &utmEasting, 1, utmZone, &latitude, &longitude);
+}
+
+void
+UTMtoLL(const double* utmNorthings, const double* utmEastings, size_t n,
+        const std::string& utmZone, double* latitudes, double* longitudes)
+{
     int ZoneNumber;
     char ZoneLetter;
-    bool NorthernHemisphere;
-
-    x = utmEasting - 500000.0; //remove 500,000 meter offset for longitude
-    y = utmNorthing;
 
+    // the zone string is parsed once for all points
     std::istringstream iss(utmZone);
     iss >> ZoneNumber >> ZoneLetter;
-    if ((ZoneLetter - 'N') >= 0) {
-        NorthernHemisphere = true;//point is in northern hemisphere
-    } else {
-        NorthernHemisphere = false;//point is in southern hemisphere
-        y -= 10000000.0;//remove 10,000,000 meter offset used for southern hemisphere
-    }
-
-    LongOrigin = (ZoneNumber - 1.0) * 6.0 - 180.0 + 3.0;  //+3 puts origin in middle of zone
-
-    eccPrimeSquared = WGS84_ECCSQ / (1.0 - WGS84_ECCSQ);
-
-    M = y / k0;
-    mu = M / (WGS84_A * (1.0 - WGS84_ECCSQ / 4.0
-                         - 3.0 * WGS84_ECCSQ * WGS84_ECCSQ / 64.0
-                         - 5.0 * WGS84_ECCSQ * WGS84_ECCSQ * WGS84_ECCSQ / 256.0));
 
-    phi1Rad = mu + (3.0 * e1 / 2.0 - 27.0 * e1 * e1 * e1 / 32.0) * sin(2.0 * mu)
-              + (21.0 * e1 * e1 / 16.0 - 55.0 * e1 * e1 * e1 * e1 / 32.0)
-              * sin(4.0 * mu)
-              + (151.0 * e1 * e1 * e1 / 96.0) * sin(6.0 * mu);
-    phi1 = phi1Rad / M_PI * 180.0;
+    double northingOffset = 0.0;
+    if ((ZoneLetter - 'N') < 0) {
+        northingOffset = 10000000.0;//remove 10,000,000 meter offset used for southern hemisphere
+    }
 
-    N1 = WGS84_A / sqrt(1.0 - WGS84_ECCSQ * sin(phi1Rad) * sin(phi1Rad));
-    T1 = tan(phi1Rad) * tan(phi1Rad);
-    C1 = eccPrimeSquared * cos(phi1Rad) * cos(phi1Rad);
-    R1 = WGS84_A * (1.0 - WGS84_ECCSQ) /
-         pow(1.0 - WGS84_ECCSQ * sin(phi1Rad) * sin(phi1Rad), 1.5);
-    D = x / (N1 * k0);
+    double LongOrigin = (ZoneNumber - 1.0) * 6.0 - 180.0 + 3.0;  //+3 puts origin in middle of zone
 
-    latitude = phi1Rad - (N1 * tan(phi1Rad) / R1)
-               * (D * D / 2.0 - (5.0 + 3.0 * T1 + 10.0 * C1 - 4.0 * C1 * C1
-                                 - 9.0 * eccPrimeSquared) * D * D * D * D / 24.0
-                  + (61.0 + 90.0 * T1 + 298.0 * C1 + 45.0 * T1 * T1
-                     - 252.0 * eccPrimeSquared - 3.0 * C1 * C1)
-                  * D * D * D * D * D * D / 720.0);
-    latitude *= 180.0 / M_PI;
-
-    longitude = (D - (1.0 + 2.0 * T1 + C1) * D * D * D / 6.0
-                 + (5.0 - 2.0 * C1 + 28.0 * T1 - 3.0 * C1 * C1
-                    + 8.0 * eccPrimeSquared + 24.0 * T1 * T1)
-                 * D * D * D * D * D / 120.0) / cos(phi1Rad);
-    longitude = LongOrigin + longitude / M_PI * 180.0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        unprojectUTM(utmEastings[i] - 500000.0, utmNorthings[i] - northingOffset,
+                     LongOrigin, latitudes[i], longitudes[i]);
+    }
 }
 
 long int
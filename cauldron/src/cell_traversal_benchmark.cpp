@@ -0,0 +1,255 @@
+#include <boost/program_options.hpp>
+#include <boost/random.hpp>
+#include <cstdio>
+#include <iostream>
+#include <time.h>
+
+#include "cauldron/cauldron.h"
+#include "cauldron/CellTraversal.h"
+
+// Compares the allocating bres* functions with their buffer overloads and
+// with the visitors of CellTraversal.h, and measures the Amanatides-Woo
+// voxel traversal on rays as cast from a depth image.
+
+namespace
+{
+
+double
+monotonicTime(void)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// sums the cells so that the traversal cannot be optimized away
+struct CellChecksum
+{
+    CellChecksum()
+     : sum(0) {}
+
+    bool operator()(int x, int y)
+    {
+        sum += x ^ y;
+        return true;
+    }
+
+    bool operator()(int x, int y, int z)
+    {
+        sum += x ^ y ^ z;
+        return true;
+    }
+
+    bool operator()(size_t rayIdx, int x, int y, int z)
+    {
+        sum += x ^ y ^ z;
+        return true;
+    }
+
+    long int sum;
+};
+
+template<class Cells>
+long int
+checksum(const Cells& cells)
+{
+    long int sum = 0;
+    for (size_t i = 0; i < cells.size(); ++i)
+    {
+        for (int j = 0; j < cells.at(i).size(); ++j)
+        {
+            sum ^= cells.at(i)(j);
+        }
+    }
+
+    return sum;
+}
+
+void
+report(const std::string& name, double elapsed, int nCalls, long int sum)
+{
+    printf("%-32s %10.1f ns/call   (checksum %ld)\n",
+           name.c_str(), elapsed / nCalls * 1e9, sum);
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    int nIterations, radius, lineLength, nRays;
+    double voxelSize, maxRange;
+
+    namespace po = boost::program_options;
+    po::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("iterations", po::value<int>(&nIterations)->default_value(20000), "Number of calls per test")
+        ("radius", po::value<int>(&radius)->default_value(8), "Circle and sphere radius (cells)")
+        ("line-length", po::value<int>(&lineLength)->default_value(64), "Maximum line length (cells)")
+        ("rays", po::value<int>(&nRays)->default_value(19200), "Number of rays per batch")
+        ("voxel-size", po::value<double>(&voxelSize)->default_value(0.05), "Voxel size (m)")
+        ("max-range", po::value<double>(&maxRange)->default_value(4.0), "Maximum ray length (m)")
+        ;
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    boost::mt19937 rng(42);
+    boost::uniform_int<int> uniformCell(-lineLength / 2, lineLength / 2);
+    boost::variate_generator<boost::mt19937&, boost::uniform_int<int> > randi(rng, uniformCell);
+
+    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > lineEnds(1024);
+    for (size_t i = 0; i < lineEnds.size(); ++i)
+    {
+        lineEnds.at(i) << randi(), randi(), randi();
+    }
+
+    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > cells3;
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells2;
+
+    // 3D lines
+    {
+        long int sum = 0;
+        double t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            const Eigen::Vector3i& p = lineEnds.at(i % lineEnds.size());
+            sum += checksum(px::bresLine(0, 0, 0, p(0), p(1), p(2)));
+        }
+        report("bresLine 3D (allocating)", monotonicTime() - t, nIterations, sum);
+
+        sum = 0;
+        t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            const Eigen::Vector3i& p = lineEnds.at(i % lineEnds.size());
+            px::bresLine(0, 0, 0, p(0), p(1), p(2), cells3);
+            sum += checksum(cells3);
+        }
+        report("bresLine 3D (buffer)", monotonicTime() - t, nIterations, sum);
+
+        CellChecksum visitor;
+        t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            const Eigen::Vector3i& p = lineEnds.at(i % lineEnds.size());
+            px::visitBresLine(0, 0, 0, p(0), p(1), p(2), visitor);
+        }
+        report("visitBresLine 3D", monotonicTime() - t, nIterations, visitor.sum);
+    }
+
+    // filled circles
+    {
+        long int sum = 0;
+        double t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            sum += checksum(px::bresFilledCircle(i % 7, 0, radius));
+        }
+        report("bresFilledCircle (allocating)", monotonicTime() - t, nIterations, sum);
+
+        sum = 0;
+        t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            px::bresFilledCircle(i % 7, 0, radius, cells2);
+            sum += checksum(cells2);
+        }
+        report("bresFilledCircle (buffer)", monotonicTime() - t, nIterations, sum);
+
+        CellChecksum visitor;
+        t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            px::visitBresFilledCircle(i % 7, 0, radius, visitor);
+        }
+        report("visitBresFilledCircle", monotonicTime() - t, nIterations, visitor.sum);
+    }
+
+    // filled spheres
+    {
+        int nSphereIterations = std::max(1, nIterations / 10);
+
+        long int sum = 0;
+        double t = monotonicTime();
+        for (int i = 0; i < nSphereIterations; ++i)
+        {
+            sum += checksum(px::bresFilledSphere(i % 7, 0, 0, radius));
+        }
+        report("bresFilledSphere (allocating)", monotonicTime() - t, nSphereIterations, sum);
+
+        sum = 0;
+        t = monotonicTime();
+        for (int i = 0; i < nSphereIterations; ++i)
+        {
+            px::bresFilledSphere(i % 7, 0, 0, radius, cells3);
+            sum += checksum(cells3);
+        }
+        report("bresFilledSphere (buffer)", monotonicTime() - t, nSphereIterations, sum);
+
+        CellChecksum visitor;
+        t = monotonicTime();
+        for (int i = 0; i < nSphereIterations; ++i)
+        {
+            px::visitBresFilledSphere(i % 7, 0, 0, radius, visitor);
+        }
+        report("visitBresFilledSphere", monotonicTime() - t, nSphereIterations, visitor.sum);
+    }
+
+    // rays of a depth image: one origin, endpoints in a 60 degree cone
+    {
+        boost::uniform_real<double> uniform(-0.5, 0.5);
+        boost::variate_generator<boost::mt19937&, boost::uniform_real<double> > randu(rng, uniform);
+
+        Eigen::Vector3d origin(0.01, 0.02, 0.03);
+        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > endpoints(nRays);
+        size_t nVoxels = 0;
+        for (int i = 0; i < nRays; ++i)
+        {
+            Eigen::Vector3d d(randu(), randu(), 1.0);
+            endpoints.at(i) = origin + d.normalized() * maxRange * (0.5 + randu());
+
+            px::voxelRay(origin, endpoints.at(i), voxelSize, cells3);
+            nVoxels += cells3.size();
+        }
+
+        int nBatches = std::max(1, nIterations / 1000);
+
+        long int sum = 0;
+        double t = monotonicTime();
+        for (int i = 0; i < nBatches; ++i)
+        {
+            for (int j = 0; j < nRays; ++j)
+            {
+                px::voxelRay(origin, endpoints.at(j), voxelSize, cells3);
+                sum += checksum(cells3);
+            }
+        }
+        double elapsed = monotonicTime() - t;
+        report("voxelRay (buffer)", elapsed, nBatches * nRays, sum);
+
+        CellChecksum visitor;
+        t = monotonicTime();
+        for (int i = 0; i < nBatches; ++i)
+        {
+            px::visitVoxelRays(origin, endpoints, voxelSize, visitor);
+        }
+        double batchElapsed = monotonicTime() - t;
+        report("visitVoxelRays", batchElapsed, nBatches * nRays, visitor.sum);
+
+        printf("%-32s %10.2f ns/voxel  (%.1f voxels/ray)\n", "visitVoxelRays",
+               batchElapsed / (nBatches * nVoxels) * 1e9,
+               static_cast<double>(nVoxels) / nRays);
+    }
+
+    return 0;
+}
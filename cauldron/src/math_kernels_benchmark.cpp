@@ -0,0 +1,290 @@
+#include <boost/program_options.hpp>
+#include <boost/thread.hpp>
+#include <cstdio>
+#include <iostream>
+#include <time.h>
+#include <vector>
+
+#include "cauldron/cauldron.h"
+
+// Compares the scalar helpers of cauldron.h with their batch kernels, and
+// rand() with Xoshiro256 generators when sampling from several threads at
+// once.
+
+namespace
+{
+
+double
+monotonicTime(void)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+void
+report(const std::string& name, double elapsed, size_t nCalls, double sum)
+{
+    printf("%-32s %10.2f ns/element   (checksum %g)\n",
+           name.c_str(), elapsed / nCalls * 1e9, sum);
+}
+
+double
+sum(const std::vector<double>& v)
+{
+    double s = 0.0;
+    for (size_t i = 0; i < v.size(); ++i)
+    {
+        s += v.at(i);
+    }
+
+    return s;
+}
+
+// the former randomNormal, which drew from rand()
+double
+randNormal(void)
+{
+    double x1, x2, w;
+
+    do
+    {
+        x1 = 2.0 * rand() / RAND_MAX - 1.0;
+        x2 = 2.0 * rand() / RAND_MAX - 1.0;
+        w = x1 * x1 + x2 * x2;
+    }
+    while (w >= 1.0 || w == 0.0);
+
+    return x1 * sqrt((-2.0 * log(w)) / w);
+}
+
+struct RandSampler
+{
+    RandSampler(int nSamples, double& result)
+     : m_nSamples(nSamples), m_result(result) {}
+
+    void operator()(void)
+    {
+        double s = 0.0;
+        for (int i = 0; i < m_nSamples; ++i)
+        {
+            s += randNormal();
+        }
+        m_result = s;
+    }
+
+    int m_nSamples;
+    double& m_result;
+};
+
+struct XoshiroSampler
+{
+    XoshiroSampler(int nSamples, uint64_t seed, double& result)
+     : m_nSamples(nSamples), m_rng(seed), m_result(result) {}
+
+    void operator()(void)
+    {
+        double s = 0.0;
+        for (int i = 0; i < m_nSamples; ++i)
+        {
+            s += px::randomNormal(m_rng, 1.0);
+        }
+        m_result = s;
+    }
+
+    int m_nSamples;
+    px::Xoshiro256 m_rng;
+    double& m_result;
+};
+
+template<class Sampler>
+double
+runThreads(std::vector<Sampler>& samplers)
+{
+    double t = monotonicTime();
+
+    boost::thread_group threads;
+    for (size_t i = 0; i < samplers.size(); ++i)
+    {
+        threads.create_thread(boost::ref(samplers.at(i)));
+    }
+    threads.join_all();
+
+    return monotonicTime() - t;
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    int nElements, nIterations, nThreads;
+
+    namespace po = boost::program_options;
+    po::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("elements", po::value<int>(&nElements)->default_value(100000), "Number of elements per batch")
+        ("iterations", po::value<int>(&nIterations)->default_value(20), "Number of batches per test")
+        ("threads", po::value<int>(&nThreads)->default_value(4), "Number of sampling threads")
+        ;
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    size_t nTotal = static_cast<size_t>(nElements) * nIterations;
+
+    px::Xoshiro256 rng(42);
+
+    std::vector<double> x(nElements), y(nElements), z(nElements), out(nElements);
+    for (int i = 0; i < nElements; ++i)
+    {
+        x.at(i) = rng.uniform(-20.0, 20.0);
+        y.at(i) = rng.uniform(-20.0, 20.0);
+        z.at(i) = rng.uniform(-20.0, 20.0);
+    }
+
+    // angle wrapping
+    {
+        double s = 0.0;
+        double t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            for (int j = 0; j < nElements; ++j)
+            {
+                out[j] = px::normalizeTheta(x[j]);
+            }
+            s += sum(out);
+        }
+        report("normalizeTheta", monotonicTime() - t, nTotal, s);
+
+        s = 0.0;
+        t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            px::wrapAngles(&x[0], &out[0], nElements);
+            s += sum(out);
+        }
+        report("wrapAngles", monotonicTime() - t, nTotal, s);
+    }
+
+    // vector norms
+    {
+        double s = 0.0;
+        double t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            for (int j = 0; j < nElements; ++j)
+            {
+                out[j] = px::hypot3(x[j], y[j], z[j]);
+            }
+            s += sum(out);
+        }
+        report("hypot3 (scalar)", monotonicTime() - t, nTotal, s);
+
+        s = 0.0;
+        t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            px::hypot3(&x[0], &y[0], &z[0], &out[0], nElements);
+            s += sum(out);
+        }
+        report("hypot3 (batch)", monotonicTime() - t, nTotal, s);
+    }
+
+    // normal samples
+    {
+        double s = 0.0;
+        double t = monotonicTime();
+        for (size_t i = 0; i < nTotal; ++i)
+        {
+            s += randNormal();
+        }
+        report("polar method (rand)", monotonicTime() - t, nTotal, s);
+
+        s = 0.0;
+        t = monotonicTime();
+        for (size_t i = 0; i < nTotal; ++i)
+        {
+            s += px::randomNormal(rng, 1.0);
+        }
+        report("randomNormal (Xoshiro256)", monotonicTime() - t, nTotal, s);
+
+        s = 0.0;
+        t = monotonicTime();
+        for (size_t i = 0; i < nTotal; ++i)
+        {
+            s += px::randomNormal(1.0);
+        }
+        report("randomNormal (threadRng)", monotonicTime() - t, nTotal, s);
+
+        s = 0.0;
+        t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            rng.fillNormal(&out[0], nElements);
+            s += sum(out);
+        }
+        report("Xoshiro256::fillNormal", monotonicTime() - t, nTotal, s);
+
+        std::vector<double> results(nThreads);
+        size_t nThreadTotal = nTotal / nThreads * nThreads;
+
+        std::vector<RandSampler> randSamplers;
+        std::vector<XoshiroSampler> xoshiroSamplers;
+        for (int i = 0; i < nThreads; ++i)
+        {
+            randSamplers.push_back(RandSampler(nTotal / nThreads, results.at(i)));
+            xoshiroSamplers.push_back(XoshiroSampler(nTotal / nThreads, i, results.at(i)));
+        }
+
+        double elapsed = runThreads(randSamplers);
+        report("polar method (rand, threads)", elapsed, nThreadTotal, sum(results));
+
+        elapsed = runThreads(xoshiroSamplers);
+        report("randomNormal (Xoshiro, threads)", elapsed, nThreadTotal, sum(results));
+    }
+
+    // lat/long to UTM on a track
+    {
+        std::vector<double> lat(nElements), lon(nElements), eastings(nElements);
+        for (int i = 0; i < nElements; ++i)
+        {
+            lat.at(i) = 47.3 + 1e-6 * i;
+            lon.at(i) = 8.5 + 1e-6 * i;
+        }
+
+        std::string zone;
+
+        double s = 0.0;
+        double t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            for (int j = 0; j < nElements; ++j)
+            {
+                px::LLtoUTM(lat[j], lon[j], out[j], eastings[j], zone);
+            }
+            s += sum(out);
+        }
+        report("LLtoUTM (scalar)", monotonicTime() - t, nTotal, s);
+
+        s = 0.0;
+        t = monotonicTime();
+        for (int i = 0; i < nIterations; ++i)
+        {
+            px::LLtoUTM(&lat[0], &lon[0], nElements, &out[0], &eastings[0], zone);
+            s += sum(out);
+        }
+        report("LLtoUTM (batch)", monotonicTime() - t, nTotal, s);
+    }
+
+    return 0;
+}
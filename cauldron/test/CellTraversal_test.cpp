@@ -0,0 +1,574 @@
+#include <boost/random.hpp>
+#include <gtest/gtest.h>
+#include <set>
+
+#include "cauldron/cauldron.h"
+#include "cauldron/CellTraversal.h"
+
+namespace px
+{
+
+// Reference implementations: the cells returned by the bres* functions
+// before they were built on the visitors of CellTraversal.h.
+
+std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >
+legacyBresLine(int x0, int y0, int x1, int y1)
+{
+    // Bresenham's line algorithm
+    // Find cells intersected by line between (x0,y0) and (x1,y1)
+
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells;
+
+    int dx = std::abs(x1 - x0);
+    int dy = std::abs(y1 - y0);
+
+    int sx = (x0 < x1) ? 1 : -1;
+    int sy = (y0 < y1) ? 1 : -1;
+
+    int err = dx - dy;
+
+    while (1)
+    {
+        cells.push_back(Eigen::Vector2i(x0, y0));
+
+        if (x0 == x1 && y0 == y1)
+        {
+            break;
+        }
+
+        int e2 = 2 * err;
+        if (e2 > -dy)
+        {
+            err -= dy;
+            x0 += sx;
+        }
+        if (e2 < dx)
+        {
+            err += dx;
+            y0 += sy;
+        }
+    }
+
+    return cells;
+}
+
+std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >
+legacyBresLine(int x0, int y0, int z0, int x1, int y1, int z1)
+{
+    // Bresenham's line algorithm
+    // Find cells intersected by line between (x0,y0,z0) and (x1,y1,z1)
+
+    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > cells;
+
+    int dx = std::abs(x1 - x0);
+    int dy = std::abs(y1 - y0);
+    int dz = std::abs(z1 - z0);
+
+    int dx2 = dx << 1;
+    int dy2 = dy << 1;
+    int dz2 = dz << 1;
+
+    int sx = (x0 < x1) ? 1 : -1;
+    int sy = (y0 < y1) ? 1 : -1;
+    int sz = (z0 < z1) ? 1 : -1;
+
+    if ((dx >= dy) && (dx >= dz))
+    {
+        int e1 = dy2 - dx;
+        int e2 = dz2 - dx;
+
+        for (int i = 0; i <= dx; ++i)
+        {
+            cells.push_back(Eigen::Vector3i(x0, y0, z0));
+
+            if (e1 > 0)
+            {
+                y0 += sy;
+                e1 -= dx2;
+            }
+            if (e2 > 0)
+            {
+                z0 += sz;
+                e2 -= dx2;
+            }
+            e1 += dy2;
+            e2 += dz2;
+            x0 += sx;
+        }
+    }
+    else if ((dy >= dx) && (dy >= dz))
+    {
+        int e1 = dx2 - dy;
+        int e2 = dz2 - dy;
+
+        for (int i = 0; i <= dy; ++i)
+        {
+            cells.push_back(Eigen::Vector3i(x0, y0, z0));
+
+            if (e1 > 0)
+            {
+                x0 += sx;
+                e1 -= dy2;
+            }
+            if (e2 > 0)
+            {
+                z0 += sz;
+                e2 -= dy2;
+            }
+            e1 += dx2;
+            e2 += dz2;
+            y0 += sy;
+        }
+    }
+    else
+    {
+        int e1 = dy2 - dz;
+        int e2 = dx2 - dz;
+
+        for (int i = 0; i <= dz; ++i)
+        {
+            cells.push_back(Eigen::Vector3i(x0, y0, z0));
+
+            if (e1 > 0)
+            {
+                y0 += sy;
+                e1 -= dz2;
+            }
+            if (e2 > 0)
+            {
+                x0 += sx;
+                e2 -= dz2;
+            }
+            e1 += dy2;
+            e2 += dx2;
+            z0 += sz;
+        }
+    }
+
+    return cells;
+}
+
+std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >
+legacyBresCircle(int x0, int y0, int r)
+{
+    // Bresenham's circle algorithm
+    // Find cells intersected by circle with center (x0,y0) and radius r
+
+    std::vector< std::vector<bool> > mask(2 * r + 1);
+
+    for (int i = 0; i < 2 * r + 1; ++i)
+    {
+        mask[i].resize(2 * r + 1);
+        for (int j = 0; j < 2 * r + 1; ++j)
+        {
+            mask[i][j] = false;
+        }
+    }
+
+    int x = r;
+    int y = 0;
+    int r_err = 1 - x;
+
+    while (x >= y)
+    {
+        mask[x + r][y + r] = true;
+        mask[y + r][x + r] = true;
+        mask[-x + r][y + r] = true;
+        mask[-y + r][x + r] = true;
+        mask[-x + r][-y + r] = true;
+        mask[-y + r][-x + r] = true;
+        mask[x + r][-y + r] = true;
+        mask[y + r][-x + r] = true;
+
+        ++y;
+        if (r_err < 0)
+        {
+            r_err += 2 * y + 1;
+        }
+        else
+        {
+            --x;
+            r_err += 2 * (y - x + 1);
+        }
+    }
+
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells;
+    for (int i = 0; i < 2 * r + 1; ++i)
+    {
+        for (int j = 0; j < 2 * r + 1; ++j)
+        {
+            if (mask[i][j])
+            {
+                cells.push_back(Eigen::Vector2i(i - r + x0, j - r + y0));
+            }
+        }
+    }
+
+    return cells;
+}
+
+std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >
+legacyBresFilledCircle(int x0, int y0, int r)
+{
+    // Bresenham's circle algorithm
+    // Find cells intersected and contained by circle with center (x0,y0) and radius r
+
+    std::vector< std::vector<bool> > mask(2 * r + 1);
+
+    for (int i = 0; i < 2 * r + 1; ++i)
+    {
+        mask[i].resize(2 * r + 1);
+        for (int j = 0; j < 2 * r + 1; ++j)
+        {
+            mask[i][j] = false;
+        }
+    }
+
+    int f = 1 - r;
+    int ddF_x = 1;
+    int ddF_y = -2 * r;
+    int x = 0;
+    int y = r;
+
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > line;
+
+    line = legacyBresLine(x0, y0 - r, x0, y0 + r);
+    for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
+         it != line.end(); ++it)
+    {
+        Eigen::Vector2i& p = *it;
+
+        mask[p(0) - x0 + r][p(1) - y0 + r] = true;
+    }
+
+    line = legacyBresLine(x0 - r, y0, x0 + r, y0);
+    for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
+         it != line.end(); ++it)
+    {
+        Eigen::Vector2i& p = *it;
+
+        mask[p(0) - x0 + r][p(1) - y0 + r] = true;
+    }
+
+    while (x < y)
+    {
+        if (f >= 0)
+        {
+            y--;
+            ddF_y += 2;
+            f += ddF_y;
+        }
+
+        x++;
+        ddF_x += 2;
+        f += ddF_x;
+
+        line = legacyBresLine(x0 - x, y0 + y, x0 + x, y0 + y);
+        for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
+             it != line.end(); ++it)
+        {
+            Eigen::Vector2i& p = *it;
+
+            mask[p(0) - x0 + r][p(1) - y0 + r] = true;
+        }
+
+        line = legacyBresLine(x0 - x, y0 - y, x0 + x, y0 - y);
+        for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
+             it != line.end(); ++it)
+        {
+            Eigen::Vector2i& p = *it;
+
+            mask[p(0) - x0 + r][p(1) - y0 + r] = true;
+        }
+
+        line = legacyBresLine(x0 - y, y0 + x, x0 + y, y0 + x);
+        for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
+             it != line.end(); ++it)
+        {
+            Eigen::Vector2i& p = *it;
+
+            mask[p(0) - x0 + r][p(1) - y0 + r] = true;
+        }
+
+        line = legacyBresLine(x0 - y, y0 - x, x0 + y, y0 - x);
+        for (std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> >::iterator it = line.begin();
+             it != line.end(); ++it)
+        {
+            Eigen::Vector2i& p = *it;
+
+            mask[p(0) - x0 + r][p(1) - y0 + r] = true;
+        }
+    }
+
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells;
+    for (int i = 0; i < 2 * r + 1; ++i)
+    {
+        for (int j = 0; j < 2 * r + 1; ++j)
+        {
+            if (mask[i][j])
+            {
+                cells.push_back(Eigen::Vector2i(i - r + x0, j - r + y0));
+            }
+        }
+    }
+
+    return cells;
+}
+
+std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> >
+legacyBresFilledSphere(int x0, int y0, int z0, int r)
+{
+    // Find cells intersected and contained by sphere with center (x0,y0,z0) and radius r
+
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > zCircle;
+    zCircle = legacyBresCircle(0, 0, r);
+
+    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > cells;
+
+    for (size_t i = 0; i < zCircle.size(); ++i)
+    {
+        const Eigen::Vector2i& zCell = zCircle.at(i);
+
+        int z = zCell(0) + z0;
+        int r = zCell(1);
+
+        if (r < 0)
+        {
+            continue;
+        }
+
+        std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > circCells;
+        circCells = legacyBresFilledCircle(x0, y0, r);
+
+        cells.reserve(cells.size() + circCells.size());
+
+        for (size_t j = 0; j < circCells.size(); ++j)
+        {
+            Eigen::Vector3i p;
+            p << circCells.at(j), z;
+
+            cells.push_back(p);
+        }
+    }
+
+    return cells;
+}
+
+
+struct CellCounter
+{
+    CellCounter(int maxCells_ = -1)
+     : maxCells(maxCells_), nCells(0) {}
+
+    bool operator()(int, int)
+    {
+        ++nCells;
+        return maxCells < 0 || nCells < maxCells;
+    }
+
+    bool operator()(int, int, int)
+    {
+        ++nCells;
+        return maxCells < 0 || nCells < maxCells;
+    }
+
+    int maxCells;
+    int nCells;
+};
+
+struct RayCollector
+{
+    bool operator()(size_t rayIdx, int x, int y, int z)
+    {
+        if (rays.size() <= rayIdx)
+        {
+            rays.resize(rayIdx + 1);
+        }
+        rays.at(rayIdx).push_back(Eigen::Vector3i(x, y, z));
+
+        // cut each ray after 3 voxels
+        return rays.at(rayIdx).size() < 3;
+    }
+
+    std::vector<std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > > rays;
+};
+
+TEST(CellTraversal, LinesMatchLegacy)
+{
+    boost::mt19937 rng(7);
+    boost::uniform_int<int> uniform(-40, 40);
+    boost::variate_generator<boost::mt19937&, boost::uniform_int<int> > randi(rng, uniform);
+
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells2;
+    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > cells3;
+    for (int i = 0; i < 1000; ++i)
+    {
+        int p[6];
+        for (int j = 0; j < 6; ++j)
+        {
+            p[j] = randi();
+        }
+
+        bresLine(p[0], p[1], p[2], p[3], cells2);
+        EXPECT_TRUE(cells2 == legacyBresLine(p[0], p[1], p[2], p[3]));
+
+        bresLine(p[0], p[1], p[2], p[3], p[4], p[5], cells3);
+        EXPECT_TRUE(cells3 == legacyBresLine(p[0], p[1], p[2], p[3], p[4], p[5]));
+    }
+}
+
+TEST(CellTraversal, CirclesMatchLegacy)
+{
+    std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > cells;
+    for (int r = 0; r <= 100; ++r)
+    {
+        EXPECT_TRUE(bresCircle(3, -2, r) == legacyBresCircle(3, -2, r)) << "r = " << r;
+
+        cells = bresFilledCircle(3, -2, r);
+        EXPECT_TRUE(cells == legacyBresFilledCircle(3, -2, r)) << "r = " << r;
+
+        // each cell is visited once
+        CellCounter counter;
+        visitBresFilledCircle(0, 0, r, counter);
+        EXPECT_EQ(static_cast<int>(cells.size()), counter.nCells);
+
+        // the buffer overload holds the same cells
+        std::vector<Eigen::Vector2i, Eigen::aligned_allocator<Eigen::Vector2i> > buffer;
+        bresFilledCircle(3, -2, r, buffer);
+        EXPECT_EQ(cells.size(), buffer.size());
+    }
+}
+
+TEST(CellTraversal, SpheresMatchLegacy)
+{
+    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > cells;
+    for (int r = 0; r <= 20; ++r)
+    {
+        bresFilledSphere(1, 2, 3, r, cells);
+
+        // the legacy sphere holds duplicates where circles overlap
+        std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > legacyCells =
+            legacyBresFilledSphere(1, 2, 3, r);
+
+        std::set<std::vector<int> > legacySet;
+        for (size_t i = 0; i < legacyCells.size(); ++i)
+        {
+            legacySet.insert(std::vector<int>(legacyCells.at(i).data(), legacyCells.at(i).data() + 3));
+        }
+
+        std::set<std::vector<int> > cellSet;
+        for (size_t i = 0; i < cells.size(); ++i)
+        {
+            cellSet.insert(std::vector<int>(cells.at(i).data(), cells.at(i).data() + 3));
+        }
+
+        EXPECT_EQ(cells.size(), cellSet.size()) << "r = " << r;
+        EXPECT_TRUE(cellSet == legacySet) << "r = " << r;
+    }
+}
+
+TEST(CellTraversal, VoxelRay)
+{
+    boost::mt19937 rng(11);
+    boost::uniform_real<double> uniform(-5.0, 5.0);
+    boost::variate_generator<boost::mt19937&, boost::uniform_real<double> > randu(rng, uniform);
+
+    const double voxelSize = 0.25;
+
+    std::vector<Eigen::Vector3i, Eigen::aligned_allocator<Eigen::Vector3i> > voxels;
+    for (int i = 0; i < 1000; ++i)
+    {
+        Eigen::Vector3d p0(randu(), randu(), randu());
+        Eigen::Vector3d p1(randu(), randu(), randu());
+
+        // axis-aligned rays
+        if (i % 10 == 0)
+        {
+            p1(1) = p0(1);
+            p1(2) = p0(2);
+        }
+
+        voxelRay(p0, p1, voxelSize, voxels);
+
+        Eigen::Vector3i v0, v1;
+        for (int j = 0; j < 3; ++j)
+        {
+            v0(j) = std::floor(p0(j) / voxelSize);
+            v1(j) = std::floor(p1(j) / voxelSize);
+        }
+
+        ASSERT_FALSE(voxels.empty());
+        EXPECT_TRUE(voxels.front() == v0);
+        EXPECT_TRUE(voxels.back() == v1);
+        EXPECT_EQ(static_cast<size_t>((v1 - v0).cwiseAbs().sum() + 1), voxels.size());
+
+        // face neighbors, and the segment passes through each voxel
+        for (size_t j = 0; j < voxels.size(); ++j)
+        {
+            if (j > 0)
+            {
+                EXPECT_EQ(1, (voxels.at(j) - voxels.at(j - 1)).cwiseAbs().sum());
+            }
+
+            double tMin = 0.0;
+            double tMax = 1.0;
+            for (int k = 0; k < 3; ++k)
+            {
+                double lo = voxels.at(j)(k) * voxelSize;
+                double hi = lo + voxelSize;
+                double d = p1(k) - p0(k);
+
+                if (std::abs(d) < 1e-12)
+                {
+                    continue;
+                }
+
+                double t0 = (lo - p0(k)) / d;
+                double t1 = (hi - p0(k)) / d;
+
+                tMin = std::max(tMin, std::min(t0, t1));
+                tMax = std::min(tMax, std::max(t0, t1));
+            }
+            EXPECT_LE(tMin, tMax + 1e-9);
+        }
+    }
+}
+
+TEST(CellTraversal, EarlyTermination)
+{
+    CellCounter counter(5);
+    EXPECT_FALSE(visitBresLine(0, 0, 0, 100, 20, 10, counter));
+    EXPECT_EQ(5, counter.nCells);
+
+    CellCounter sphereCounter(7);
+    EXPECT_FALSE(visitBresFilledSphere(0, 0, 0, 10, sphereCounter));
+    EXPECT_EQ(7, sphereCounter.nCells);
+
+    CellCounter rayCounter;
+    EXPECT_TRUE(visitVoxelRay(Eigen::Vector3d(0.1, 0.1, 0.1), Eigen::Vector3d(3.9, 0.1, 0.1),
+                              1.0, rayCounter));
+    EXPECT_EQ(4, rayCounter.nCells);
+
+    // batched rays are cut short individually
+    std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > endpoints;
+    endpoints.push_back(Eigen::Vector3d(10.5, 0.5, 0.5));
+    endpoints.push_back(Eigen::Vector3d(0.5, 1.5, 0.5));
+    endpoints.push_back(Eigen::Vector3d(0.5, -9.5, 0.5));
+
+    RayCollector collector;
+    visitVoxelRays(Eigen::Vector3d(0.5, 0.5, 0.5), endpoints, 1.0, collector);
+
+    ASSERT_EQ(3u, collector.rays.size());
+    EXPECT_EQ(3u, collector.rays.at(0).size());
+    EXPECT_EQ(2u, collector.rays.at(1).size());
+    EXPECT_EQ(3u, collector.rays.at(2).size());
+    EXPECT_TRUE(collector.rays.at(2).back() == Eigen::Vector3i(0, -2, 0));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
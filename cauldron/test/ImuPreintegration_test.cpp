@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "cauldron/ImuPreintegration.h"
+#include "cauldron/Random.h"
+
+namespace px
+{
+
+const double k_dt = 0.005;
+const Eigen::Vector3d k_gravity(0.0, 0.0, -9.81);
+
+Eigen::Matrix3d
+randomRotation(Xoshiro256& rng)
+{
+    Eigen::Vector3d axis(rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0));
+
+    return Eigen::AngleAxisd(rng.uniform(-M_PI, M_PI), axis.normalized()).toRotationMatrix();
+}
+
+// smooth but non-trivial gyro and accelerometer readings
+void
+generateMeasurements(Xoshiro256& rng, int n,
+                     std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& gyro,
+                     std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& accel)
+{
+    Eigen::Vector3d w0(rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0));
+    Eigen::Vector3d a0(rng.uniform(-2.0, 2.0), rng.uniform(-2.0, 2.0), 9.81 + rng.uniform(-2.0, 2.0));
+
+    gyro.clear();
+    accel.clear();
+    for (int i = 0; i < n; ++i)
+    {
+        double t = i * k_dt;
+
+        gyro.push_back(w0 * cos(3.0 * t));
+        accel.push_back(a0 + Eigen::Vector3d(sin(5.0 * t), cos(4.0 * t), 0.5 * sin(2.0 * t)));
+    }
+}
+
+TEST(ImuPreintegration, Stationary)
+{
+    Xoshiro256 rng(1);
+
+    Eigen::Matrix3d R_i = randomRotation(rng);
+    Eigen::Vector3d p_i(1.0, 2.0, 3.0);
+
+    Eigen::Vector3d gyroBias(0.01, -0.02, 0.005);
+    Eigen::Vector3d accelBias(0.1, 0.05, -0.2);
+
+    // a resting IMU measures its biases and the reaction to gravity
+    ImuPreintegration preintegration(gyroBias, accelBias);
+    for (int i = 0; i < 200; ++i)
+    {
+        preintegration.integrate(gyroBias, accelBias - R_i.transpose() * k_gravity, k_dt);
+    }
+    EXPECT_NEAR(1.0, preintegration.deltaTime(), 1e-12);
+
+    Eigen::Matrix3d R_j;
+    Eigen::Vector3d v_j, p_j;
+    preintegration.predict(R_i, Eigen::Vector3d::Zero(), p_i, k_gravity, R_j, v_j, p_j);
+
+    EXPECT_LT((R_j - R_i).norm(), 1e-12);
+    EXPECT_LT(v_j.norm(), 1e-10);
+    EXPECT_LT((p_j - p_i).norm(), 1e-10);
+
+    // uncertainty grows with time
+    for (int i = 0; i < 9; ++i)
+    {
+        EXPECT_GT(preintegration.covariance()(i,i), 0.0);
+    }
+    EXPECT_GT(preintegration.covariance()(6,6), preintegration.covariance()(3,3) * 0.1);
+}
+
+TEST(ImuPreintegration, BiasJacobians)
+{
+    Xoshiro256 rng(2);
+
+    std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > gyro, accel;
+    generateMeasurements(rng, 100, gyro, accel);
+
+    Eigen::Vector3d gyroBias(0.01, -0.02, 0.005);
+    Eigen::Vector3d accelBias(0.1, 0.05, -0.2);
+    Eigen::Vector3d gyroBias2 = gyroBias + Eigen::Vector3d(2e-3, -1e-3, 1.5e-3);
+    Eigen::Vector3d accelBias2 = accelBias + Eigen::Vector3d(-2e-2, 3e-2, 1e-2);
+
+    ImuPreintegration preintegration(gyroBias, accelBias);
+    ImuPreintegration preintegration2(gyroBias2, accelBias2);
+    for (size_t i = 0; i < gyro.size(); ++i)
+    {
+        preintegration.integrate(gyro.at(i), accel.at(i), k_dt);
+        preintegration2.integrate(gyro.at(i), accel.at(i), k_dt);
+    }
+
+    // first-order corrections remove nearly all of the change
+    Eigen::Matrix3d dR = preintegration.correctedDeltaR(gyroBias2).transpose() * preintegration2.deltaR();
+    double changeR = Eigen::AngleAxisd(preintegration.deltaR().transpose() * preintegration2.deltaR()).angle();
+    EXPECT_LT(Eigen::AngleAxisd(dR).angle(), 0.01 * changeR);
+
+    Eigen::Vector3d dV = preintegration.correctedDeltaV(gyroBias2, accelBias2) - preintegration2.deltaV();
+    EXPECT_LT(dV.norm(), 0.01 * (preintegration.deltaV() - preintegration2.deltaV()).norm());
+
+    Eigen::Vector3d dP = preintegration.correctedDeltaP(gyroBias2, accelBias2) - preintegration2.deltaP();
+    EXPECT_LT(dP.norm(), 0.01 * (preintegration.deltaP() - preintegration2.deltaP()).norm());
+}
+
+TEST(ImuPreintegration, Factor)
+{
+    Xoshiro256 rng(3);
+
+    std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > gyro, accel;
+    generateMeasurements(rng, 60, gyro, accel);
+
+    Eigen::Vector3d gyroBias(0.01, -0.02, 0.005);
+    Eigen::Vector3d accelBias(0.1, 0.05, -0.2);
+
+    ImuPreintegration preintegration(gyroBias, accelBias);
+    for (size_t i = 0; i < gyro.size(); ++i)
+    {
+        preintegration.integrate(gyro.at(i), accel.at(i), k_dt);
+    }
+
+    Eigen::Matrix3d R_i = randomRotation(rng);
+    Eigen::Vector3d v_i(0.5, -1.0, 0.2);
+    Eigen::Vector3d p_i(1.0, 2.0, 3.0);
+
+    Eigen::Matrix3d R_j;
+    Eigen::Vector3d v_j, p_j;
+    preintegration.predict(R_i, v_i, p_i, k_gravity, R_j, v_j, p_j);
+
+    // system poses map the world frame to the system frame
+    Eigen::Quaterniond q_i(R_i.transpose()), q_j(R_j.transpose());
+    Eigen::Vector3d t_i = -(R_i.transpose() * p_i);
+    Eigen::Vector3d t_j = -(R_j.transpose() * p_j);
+
+    Eigen::Matrix<double,9,1> vb_i, vb_j;
+    vb_i << v_i, gyroBias, accelBias;
+    vb_j << v_j, gyroBias, accelBias;
+
+    ImuFactor factor(preintegration, k_gravity);
+
+    Eigen::Matrix<double,15,1> residuals;
+    ASSERT_TRUE(factor(q_i.coeffs().data(), t_i.data(), vb_i.data(),
+                       q_j.coeffs().data(), t_j.data(), vb_j.data(),
+                       residuals.data()));
+    EXPECT_LT(residuals.norm(), 1e-6);
+
+    // a position error of 1 cm is many sigma for 0.3 s of integration
+    Eigen::Vector3d t_j2 = t_j + Eigen::Vector3d(0.01, 0.0, 0.0);
+    ASSERT_TRUE(factor(q_i.coeffs().data(), t_i.data(), vb_i.data(),
+                       q_j.coeffs().data(), t_j2.data(), vb_j.data(),
+                       residuals.data()));
+    EXPECT_GT(residuals.norm(), 3.0);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
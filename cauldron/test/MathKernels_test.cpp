@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "cauldron/cauldron.h"
+
+namespace px
+{
+
+TEST(MathKernels, WrapAngles)
+{
+    Xoshiro256 rng(1);
+
+    std::vector<double> theta(1000);
+    for (size_t i = 0; i < theta.size(); ++i)
+    {
+        theta.at(i) = rng.uniform(-100.0, 100.0);
+    }
+    theta.at(0) = 0.0;
+    theta.at(1) = M_PI - 1e-9;
+    theta.at(2) = -M_PI;
+    theta.at(3) = 1e6;
+
+    std::vector<double> wrapped(theta.size());
+    wrapAngles(&theta[0], &wrapped[0], theta.size());
+
+    for (size_t i = 0; i < theta.size(); ++i)
+    {
+        EXPECT_GE(wrapped.at(i), -M_PI);
+        EXPECT_LT(wrapped.at(i), M_PI);
+
+        // equal to normalizeTheta up to the representation of +-pi;
+        // normalizeTheta accumulates rounding errors on large angles
+        double reference = (i == 3) ? std::remainder(theta.at(i), 2.0 * M_PI)
+                                    : normalizeTheta(theta.at(i));
+        double d = wrapped.at(i) - reference;
+        EXPECT_NEAR(0.0, std::min(std::abs(d), std::abs(std::abs(d) - 2.0 * M_PI)), 1e-9);
+    }
+
+    EXPECT_EQ(0.0, wrapped.at(0));
+    EXPECT_DOUBLE_EQ(M_PI - 1e-9, wrapped.at(1));
+    EXPECT_DOUBLE_EQ(-M_PI, wrapped.at(2));
+
+    // in place
+    std::vector<float> thetaf(theta.begin(), theta.end());
+    wrapAngles(&thetaf[0], &thetaf[0], thetaf.size());
+    for (size_t i = 4; i < thetaf.size(); ++i)
+    {
+        double d = thetaf.at(i) - wrapped.at(i);
+        EXPECT_NEAR(0.0, std::min(std::abs(d), std::abs(std::abs(d) - 2.0 * M_PI)), 1e-4);
+    }
+}
+
+TEST(MathKernels, Hypot3AndNormalize3)
+{
+    Xoshiro256 rng(2);
+
+    const size_t n = 257;
+    std::vector<double> x(n), y(n), z(n), norm(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        x.at(i) = rng.normal(0.0, 10.0);
+        y.at(i) = rng.normal(0.0, 10.0);
+        z.at(i) = rng.normal(0.0, 10.0);
+    }
+    x.at(0) = y.at(0) = z.at(0) = 0.0;
+
+    hypot3(&x[0], &y[0], &z[0], &norm[0], n);
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_DOUBLE_EQ(hypot3(x.at(i), y.at(i), z.at(i)), norm.at(i));
+    }
+
+    std::vector<float> xf(x.begin(), x.end()), yf(y.begin(), y.end()), zf(z.begin(), z.end());
+    std::vector<float> normf(n);
+    hypot3f(&xf[0], &yf[0], &zf[0], &normf[0], n);
+
+    normalize3(&x[0], &y[0], &z[0], n);
+    normalize3f(&xf[0], &yf[0], &zf[0], n);
+
+    EXPECT_EQ(0.0, x.at(0));
+    EXPECT_EQ(0.0f, xf.at(0));
+    for (size_t i = 1; i < n; ++i)
+    {
+        EXPECT_NEAR(norm.at(i), normf.at(i), 1e-4);
+        EXPECT_NEAR(1.0, hypot3(x.at(i), y.at(i), z.at(i)), 1e-12);
+        EXPECT_NEAR(1.0, hypot3f(xf.at(i), yf.at(i), zf.at(i)), 1e-6);
+    }
+}
+
+TEST(MathKernels, Xoshiro256)
+{
+    Xoshiro256 rng1(42), rng2(42), rng3(43);
+
+    bool differs = false;
+    for (int i = 0; i < 100; ++i)
+    {
+        Xoshiro256::result_type r = rng1();
+        EXPECT_EQ(r, rng2());
+        differs |= (r != rng3());
+    }
+    EXPECT_TRUE(differs);
+
+    const int n = 200000;
+
+    double sum = 0.0, sumSq = 0.0;
+    for (int i = 0; i < n; ++i)
+    {
+        double u = rng1.uniform();
+        ASSERT_GE(u, 0.0);
+        ASSERT_LT(u, 1.0);
+
+        sum += u;
+        sumSq += u * u;
+    }
+    EXPECT_NEAR(0.5, sum / n, 0.005);
+    EXPECT_NEAR(1.0 / 12.0, sumSq / n - square(sum / n), 0.005);
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        long k = rng1(10);
+        ASSERT_GE(k, 0);
+        ASSERT_LT(k, 10);
+    }
+
+    sum = sumSq = 0.0;
+    for (int i = 0; i < n; ++i)
+    {
+        double v = randomNormal(rng1, 2.0);
+        sum += v;
+        sumSq += v * v;
+    }
+    EXPECT_NEAR(0.0, sum / n, 0.02);
+    EXPECT_NEAR(4.0, sumSq / n, 0.05);
+
+    std::vector<double> samples(n + 1);
+    rng1.fillNormal(&samples[0], samples.size(), 2.0);
+    sum = sumSq = 0.0;
+    for (size_t i = 0; i < samples.size(); ++i)
+    {
+        sum += samples.at(i);
+        sumSq += samples.at(i) * samples.at(i);
+    }
+    EXPECT_NEAR(0.0, sum / samples.size(), 0.02);
+    EXPECT_NEAR(4.0, sumSq / samples.size(), 0.05);
+}
+
+TEST(MathKernels, BatchUTM)
+{
+    // a track around Zurich, and one crossing the equator
+    const double latitudes[][4] = {{47.37, 47.38, 47.39, 47.40},
+                                   {0.01, 0.001, -0.001, -0.01}};
+    const double longitudes[][4] = {{8.54, 8.55, 8.56, 8.57},
+                                    {-78.5, -78.5, -78.5, -78.5}};
+
+    for (int track = 0; track < 2; ++track)
+    {
+        double northings[4], eastings[4];
+        std::string zone;
+        LLtoUTM(latitudes[track], longitudes[track], 4, northings, eastings, zone);
+
+        std::string firstZone;
+        double northing, easting;
+        LLtoUTM(latitudes[track][0], longitudes[track][0], northing, easting, firstZone);
+        EXPECT_EQ(firstZone, zone);
+
+        double lat[4], lon[4];
+        UTMtoLL(northings, eastings, 4, zone, lat, lon);
+
+        for (int i = 0; i < 4; ++i)
+        {
+            double scalarLat, scalarLon;
+            UTMtoLL(northings[i], eastings[i], zone, scalarLat, scalarLon);
+            EXPECT_EQ(scalarLat, lat[i]);
+            EXPECT_EQ(scalarLon, lon[i]);
+
+            EXPECT_NEAR(latitudes[track][i], lat[i], 1e-8);
+            EXPECT_NEAR(longitudes[track][i], lon[i], 1e-8);
+
+            // within the hemisphere of the first point, the batch matches
+            // the scalar conversion
+            std::string pointZone;
+            LLtoUTM(latitudes[track][i], longitudes[track][i], northing, easting, pointZone);
+            if (pointZone == zone)
+            {
+                EXPECT_EQ(northing, northings[i]);
+                EXPECT_EQ(easting, eastings[i]);
+            }
+        }
+
+    }
+
+    // a track is continuous across the equator
+    double northings[4], eastings[4];
+    std::string zone;
+    LLtoUTM(latitudes[1], longitudes[1], 4, northings, eastings, zone);
+    EXPECT_EQ("17N", zone);
+    EXPECT_NEAR(0.002 * 110574.0, northings[1] - northings[2], 1.0);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,150 @@
+#include <boost/thread.hpp>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "cauldron/Profiler.h"
+
+namespace px
+{
+
+const Profiler::Statistics*
+findStatistics(const std::vector<Profiler::Statistics>& statistics,
+               const std::string& name)
+{
+    for (size_t i = 0; i < statistics.size(); ++i)
+    {
+        if (statistics.at(i).name == name)
+        {
+            return &statistics.at(i);
+        }
+    }
+
+    return 0;
+}
+
+struct RecordSamples
+{
+    void operator()(void)
+    {
+        for (int i = 1; i <= 1000; ++i)
+        {
+            PX_PROFILE_SCOPE("test.threads.timer");
+
+            Profiler::instance()->addCount("test.threads.counter");
+            Profiler::instance()->addSample("test.threads.samples", i);
+        }
+    }
+};
+
+TEST(Profiler, Threads)
+{
+    Profiler* profiler = Profiler::instance();
+    profiler->collect();
+    profiler->resetStatistics();
+
+    std::vector<boost::shared_ptr<boost::thread> > threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.push_back(boost::make_shared<boost::thread>(RecordSamples()));
+    }
+    for (size_t i = 0; i < threads.size(); ++i)
+    {
+        threads.at(i)->join();
+    }
+
+    // records of exited threads are still collected
+    profiler->collect();
+    EXPECT_EQ(0u, profiler->droppedRecordCount());
+
+    std::vector<Profiler::Statistics> statistics;
+    profiler->getStatistics(statistics);
+
+    const Profiler::Statistics* timer = findStatistics(statistics, "test.threads.timer");
+    ASSERT_TRUE(timer != 0);
+    EXPECT_EQ(Profiler::TIMER, timer->type);
+    EXPECT_EQ(4000u, timer->count);
+    EXPECT_GE(timer->min, 0.0);
+    EXPECT_LT(timer->max, 1.0);
+
+    const Profiler::Statistics* counter = findStatistics(statistics, "test.threads.counter");
+    ASSERT_TRUE(counter != 0);
+    EXPECT_EQ(Profiler::COUNTER, counter->type);
+    EXPECT_DOUBLE_EQ(4000.0, counter->sum);
+
+    // percentiles are accurate to the bin width of ~26%
+    const Profiler::Statistics* samples = findStatistics(statistics, "test.threads.samples");
+    ASSERT_TRUE(samples != 0);
+    EXPECT_EQ(4000u, samples->count);
+    EXPECT_DOUBLE_EQ(1.0, samples->min);
+    EXPECT_DOUBLE_EQ(1000.0, samples->max);
+    EXPECT_DOUBLE_EQ(500.5, samples->mean());
+    EXPECT_NEAR(500.0, samples->percentile(0.5), 500.0 * 0.26);
+    EXPECT_NEAR(900.0, samples->percentile(0.9), 900.0 * 0.26);
+    EXPECT_DOUBLE_EQ(1.0, samples->percentile(0.0));
+    EXPECT_DOUBLE_EQ(1000.0, samples->percentile(1.0));
+}
+
+TEST(Profiler, Disabled)
+{
+    Profiler* profiler = Profiler::instance();
+    profiler->collect();
+    profiler->resetStatistics();
+
+    profiler->setEnabled(false);
+    {
+        PX_PROFILE_SCOPE("test.disabled.timer");
+    }
+    profiler->setEnabled(true);
+
+    profiler->collect();
+
+    std::vector<Profiler::Statistics> statistics;
+    profiler->getStatistics(statistics);
+    EXPECT_TRUE(statistics.empty());
+}
+
+TEST(Profiler, Trace)
+{
+    Profiler* profiler = Profiler::instance();
+
+    // counter totals start over with the statistics
+    profiler->addCount("test.trace.counter", 5.0);
+    profiler->collect();
+    profiler->resetStatistics();
+
+    std::string filename = "profiler_test_trace.json";
+    ASSERT_TRUE(profiler->startTrace(filename));
+    {
+        PX_PROFILE_SCOPE("test.trace.outer");
+        PX_PROFILE_SCOPE("test.trace.inner");
+
+        profiler->addCount("test.trace.counter", 2.0);
+    }
+    profiler->stopTrace();
+
+    std::ifstream ifs(filename.c_str());
+    ASSERT_TRUE(ifs.is_open());
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    std::string trace = ss.str();
+    std::remove(filename.c_str());
+
+    EXPECT_EQ('[', trace.at(0));
+    EXPECT_EQ("]\n", trace.substr(trace.size() - 2));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"test.trace.outer\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"test.trace.inner\",\"ph\":\"X\""));
+    EXPECT_NE(std::string::npos, trace.find("{\"name\":\"test.trace.counter\",\"ph\":\"C\""));
+    EXPECT_NE(std::string::npos, trace.find("\"args\":{\"value\":2}}"));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,125 @@
+#include <algorithm>
+#include <boost/thread.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "cauldron/cauldron.h"
+#include "cauldron/Random.h"
+
+namespace px
+{
+
+struct DrawSequence
+{
+    DrawSequence(std::vector<uint64_t>& sequence)
+     : m_sequence(sequence) {}
+
+    void operator()(void)
+    {
+        for (size_t i = 0; i < m_sequence.size(); ++i)
+        {
+            m_sequence.at(i) = threadRng()();
+        }
+    }
+
+    std::vector<uint64_t>& m_sequence;
+};
+
+TEST(Random, SampleKofN)
+{
+    Xoshiro256 rng(7);
+
+    std::vector<size_t> sampleIds;
+    EXPECT_FALSE(sampleKofN(rng, 4, 3, sampleIds));
+    EXPECT_TRUE(sampleIds.empty());
+
+    ASSERT_TRUE(sampleKofN(rng, 3, 3, sampleIds));
+    std::sort(sampleIds.begin(), sampleIds.end());
+    EXPECT_EQ(0u, sampleIds.at(0));
+    EXPECT_EQ(1u, sampleIds.at(1));
+    EXPECT_EQ(2u, sampleIds.at(2));
+
+    // all indices are distinct and drawn equally often
+    const size_t n = 10;
+    const int nDraws = 100000;
+    std::vector<int> counts(n, 0);
+    for (int i = 0; i < nDraws; ++i)
+    {
+        ASSERT_TRUE(sampleKofN(rng, 3, n, sampleIds));
+        ASSERT_EQ(3u, sampleIds.size());
+
+        ASSERT_NE(sampleIds.at(0), sampleIds.at(1));
+        ASSERT_NE(sampleIds.at(0), sampleIds.at(2));
+        ASSERT_NE(sampleIds.at(1), sampleIds.at(2));
+
+        for (size_t j = 0; j < sampleIds.size(); ++j)
+        {
+            ASSERT_LT(sampleIds.at(j), n);
+            ++counts.at(sampleIds.at(j));
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i)
+    {
+        EXPECT_NEAR(nDraws * 3.0 / n, counts.at(i), nDraws * 0.01);
+    }
+}
+
+TEST(Random, GlobalSeed)
+{
+    setRandomSeed(123);
+    EXPECT_EQ(123u, randomSeed());
+
+    std::vector<double> sequence1;
+    for (int i = 0; i < 10; ++i)
+    {
+        sequence1.push_back(random(0.0, 1.0));
+        sequence1.push_back(randomNormal(1.0));
+    }
+
+    // reseeding restarts the sequence of this thread
+    setRandomSeed(123);
+
+    std::vector<double> sequence2;
+    for (int i = 0; i < 10; ++i)
+    {
+        sequence2.push_back(random(0.0, 1.0));
+        sequence2.push_back(randomNormal(1.0));
+    }
+
+    EXPECT_TRUE(sequence1 == sequence2);
+
+    setRandomSeed(124);
+    EXPECT_NE(sequence1.front(), random(0.0, 1.0));
+}
+
+TEST(Random, ThreadStreams)
+{
+    std::vector<uint64_t> mainSequence(100), threadSequence1(100), threadSequence2(100);
+
+    setRandomSeed(5);
+    DrawSequence drawMain(mainSequence);
+    drawMain();
+
+    boost::thread thread1((DrawSequence(threadSequence1)));
+    thread1.join();
+
+    // threads get distinct streams, in the order of their first draw
+    EXPECT_TRUE(mainSequence != threadSequence1);
+
+    setRandomSeed(5);
+    drawMain();
+
+    boost::thread thread2((DrawSequence(threadSequence2)));
+    thread2.join();
+
+    EXPECT_TRUE(threadSequence1 == threadSequence2);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,294 @@
+#include <algorithm>
+#include <boost/bind.hpp>
+#include <boost/random.hpp>
+#include <boost/thread.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "cauldron/TriggerSynchronizer.h"
+
+namespace px
+{
+
+// A recorded trigger/frame sequence is a text stream with one event
+// per line, in any order:
+//   t <arrival> <trigger counter> <trigger stamp>
+//   f <arrival> <frame counter> <device stamp> <true stamp>
+// All times are in nanoseconds. The true stamp of a frame is only used
+// to evaluate the synchronizer and may be 0 if unknown.
+struct ReplayEvent
+{
+    char type;
+    uint64_t arrival;
+    uint32_t counter;
+    uint64_t stamp;
+    uint64_t trueStamp;
+
+    bool operator<(const ReplayEvent& other) const
+    {
+        return arrival < other.arrival;
+    }
+};
+
+struct ReplayStatistics
+{
+    size_t frames;
+    size_t matched;
+    size_t predicted;
+    size_t failed;
+    size_t wrong;
+    double maxError;
+};
+
+// Replays a recorded sequence in arrival order. The bounded wait of
+// TriggerSynchronizer::synchronize is simulated by feeding all trigger
+// events that arrive within maxWait of a frame before matching it.
+ReplayStatistics
+replayTriggerSequence(std::istream& is, TriggerSynchronizer& sync,
+                      double maxWait, double tolerance,
+                      size_t warmupFrames)
+{
+    std::vector<ReplayEvent> events;
+
+    std::string line;
+    while (std::getline(is, line))
+    {
+        std::istringstream iss(line);
+
+        ReplayEvent event;
+        event.trueStamp = 0;
+        if (!(iss >> event.type >> event.arrival >> event.counter >> event.stamp))
+        {
+            continue;
+        }
+        if (event.type == 'f')
+        {
+            iss >> event.trueStamp;
+        }
+
+        events.push_back(event);
+    }
+
+    std::stable_sort(events.begin(), events.end());
+
+    ReplayStatistics stats = {0, 0, 0, 0, 0, 0.0};
+
+    uint64_t waitNs = static_cast<uint64_t>(maxWait * 1e9);
+    size_t nextTrigger = 0;
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        const ReplayEvent& event = events.at(i);
+        if (event.type != 'f')
+        {
+            continue;
+        }
+
+        while (nextTrigger < events.size() &&
+               events.at(nextTrigger).arrival <= event.arrival + waitNs)
+        {
+            const ReplayEvent& trigger = events.at(nextTrigger);
+            if (trigger.type == 't')
+            {
+                sync.addTrigger(trigger.counter, trigger.stamp);
+            }
+            ++nextTrigger;
+        }
+
+        uint64_t stamp = 0;
+        TriggerSynchronizer::MatchResult result =
+            sync.trySynchronize(event.counter, event.stamp, event.arrival, stamp);
+
+        ++stats.frames;
+        if (stats.frames <= warmupFrames)
+        {
+            continue;
+        }
+
+        switch (result)
+        {
+        case TriggerSynchronizer::MATCHED:
+            ++stats.matched;
+            break;
+        case TriggerSynchronizer::PREDICTED:
+            ++stats.predicted;
+            break;
+        default:
+            ++stats.failed;
+            continue;
+        }
+
+        if (event.trueStamp != 0)
+        {
+            double error = std::fabs(static_cast<double>(static_cast<int64_t>(stamp - event.trueStamp))) * 1e-9;
+            stats.maxError = std::max(stats.maxError, error);
+            if (error > tolerance)
+            {
+                ++stats.wrong;
+            }
+        }
+    }
+
+    return stats;
+}
+
+struct SequenceParams
+{
+    size_t frames;
+    double period;            // trigger period (s)
+    uint32_t firstTrigger;    // first trigger counter
+    uint32_t counterOffset;   // frame counter - trigger counter
+    double drift;             // device clock rate error
+    double frameLatency;      // trigger to frame arrival (s)
+    double triggerLatency;    // mean trigger to trigger message arrival (s)
+    double triggerJitter;     // std. dev. of trigger message latency (s)
+    double triggerDropRate;   // fraction of lost trigger messages
+};
+
+void
+generateSequence(const SequenceParams& params, std::ostream& os)
+{
+    boost::mt19937 rng(42);
+    boost::normal_distribution<double> normal(0.0, 1.0);
+    boost::uniform_real<double> uniform(0.0, 1.0);
+    boost::variate_generator<boost::mt19937&, boost::normal_distribution<double> > randn(rng, normal);
+    boost::variate_generator<boost::mt19937&, boost::uniform_real<double> > randu(rng, uniform);
+
+    const uint64_t t0 = 1400000000ULL * 1000000000ULL;
+    const uint64_t deviceOffset = 123456789ULL;
+
+    for (size_t i = 0; i < params.frames; ++i)
+    {
+        double t = i * params.period;
+        uint64_t stamp = t0 + static_cast<uint64_t>(t * 1e9);
+
+        uint32_t triggerCounter = params.firstTrigger + static_cast<uint32_t>(i);
+        uint32_t frameCounter = triggerCounter + params.counterOffset;
+
+        uint64_t deviceStamp = deviceOffset + static_cast<uint64_t>(t * (1.0 + params.drift) * 1e9);
+        uint64_t frameArrival = stamp + static_cast<uint64_t>(params.frameLatency * 1e9);
+
+        if (randu() >= params.triggerDropRate)
+        {
+            double latency = std::max(0.0, params.triggerLatency + params.triggerJitter * randn());
+            uint64_t triggerArrival = stamp + static_cast<uint64_t>(latency * 1e9);
+
+            os << "t " << triggerArrival << " " << triggerCounter << " " << stamp << std::endl;
+        }
+
+        os << "f " << frameArrival << " " << frameCounter << " " << deviceStamp << " " << stamp << std::endl;
+    }
+}
+
+SequenceParams
+defaultParams(void)
+{
+    SequenceParams params;
+    params.frames = 1000;
+    params.period = 1.0 / 20.0;
+    params.firstTrigger = 100;
+    params.counterOffset = 0;
+    params.drift = 0.0;
+    params.frameLatency = 0.02;
+    params.triggerLatency = 0.002;
+    params.triggerJitter = 0.0;
+    params.triggerDropRate = 0.0;
+
+    return params;
+}
+
+TEST(TriggerSynchronizer, ExactMatch)
+{
+    std::stringstream ss;
+    generateSequence(defaultParams(), ss);
+
+    TriggerSynchronizer sync;
+    ReplayStatistics stats = replayTriggerSequence(ss, sync, 0.005, 1e-4, 0);
+
+    EXPECT_EQ(1000u, stats.matched);
+    EXPECT_EQ(0u, stats.wrong);
+}
+
+TEST(TriggerSynchronizer, CounterOffsetAndWrapAround)
+{
+    SequenceParams params = defaultParams();
+    params.firstTrigger = 0xFFFFFFFFu - 300u;
+    params.counterOffset = 7;
+
+    std::stringstream ss;
+    generateSequence(params, ss);
+
+    TriggerSynchronizer sync;
+    ReplayStatistics stats = replayTriggerSequence(ss, sync, 0.005, 1e-4, 10);
+
+    EXPECT_EQ(7u, sync.counterOffset());
+    EXPECT_EQ(990u, stats.matched);
+    EXPECT_EQ(0u, stats.wrong);
+}
+
+TEST(TriggerSynchronizer, LateAndLostTriggers)
+{
+    SequenceParams params = defaultParams();
+    params.drift = 50e-6;
+    params.triggerLatency = 0.022;
+    params.triggerJitter = 0.005;
+    params.triggerDropRate = 0.05;
+
+    std::stringstream ss;
+    generateSequence(params, ss);
+
+    TriggerSynchronizer sync;
+    ReplayStatistics stats = replayTriggerSequence(ss, sync, 0.005, 1e-4, 50);
+
+    // every frame after warm-up gets a stamp, and none is off by a frame
+    EXPECT_EQ(0u, stats.failed);
+    EXPECT_EQ(0u, stats.wrong);
+    EXPECT_GT(stats.predicted, 0u);
+    EXPECT_EQ(0u, sync.counterOffset());
+}
+
+TEST(TriggerSynchronizer, DriftEstimation)
+{
+    SequenceParams params = defaultParams();
+    params.drift = 100e-6;
+
+    std::stringstream ss;
+    generateSequence(params, ss);
+
+    TriggerSynchronizer sync;
+    replayTriggerSequence(ss, sync, 0.005, 1e-4, 0);
+
+    ASSERT_TRUE(sync.clockModelValid());
+    EXPECT_NEAR(1.0 / (1.0 + params.drift) - 1.0, sync.clockDrift(), 1e-6);
+}
+
+void
+addTriggerDelayed(TriggerSynchronizer* sync, uint32_t counter, uint64_t stamp)
+{
+    boost::this_thread::sleep(boost::posix_time::milliseconds(2));
+    sync->addTrigger(counter, stamp);
+}
+
+TEST(TriggerSynchronizer, BoundedWait)
+{
+    TriggerSynchronizer sync(64, 0.1);
+
+    boost::thread thread(boost::bind(&addTriggerDelayed, &sync, 5u, 12345u));
+
+    uint64_t stamp = 0;
+    EXPECT_EQ(TriggerSynchronizer::MATCHED, sync.synchronize(5, 0, 0, stamp));
+    EXPECT_EQ(12345u, stamp);
+
+    thread.join();
+
+    // no trigger event and no clock model
+    sync.maxWait() = 0.001;
+    EXPECT_EQ(TriggerSynchronizer::FAILED, sync.synchronize(6, 0, 0, stamp));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
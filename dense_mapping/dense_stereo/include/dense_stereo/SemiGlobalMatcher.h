@@ -0,0 +1,111 @@
+#ifndef SEMIGLOBALMATCHER_H
+#define SEMIGLOBALMATCHER_H
+
+#include <boost/shared_ptr.hpp>
+#include <Eigen/Dense>
+#include <opencv2/core/core.hpp>
+#include <stdint.h>
+#include <vector>
+
+namespace px
+{
+
+// Dense disparity from a rectified stereo pair by semi-global matching
+// (Hirschmueller, 2008) on the Hamming distance between 9x7 census
+// transforms. Costs are aggregated along 8 or 4 paths with 16-bit SIMD
+// on SSE2 and NEON. The matching costs of a row are recomputed in each
+// of the two passes instead of being kept in a cost volume, but the
+// aggregated costs take 2 bytes per pixel and disparity.
+//
+// The right camera must lie on the positive x axis of the left camera, so
+// that a scene point at column u of the left image appears at column
+// u - d of the right image.
+class SemiGlobalMatcher
+{
+public:
+    SemiGlobalMatcher();
+
+    // disparities 0 to disparityCount() - 1 are searched at the matching
+    // resolution; rounded up to a multiple of 16
+    int& disparityCount(void);
+    // penalties, in census bits, for disparity changes of one pixel and of
+    // more than one pixel between neighbors on a path
+    int& smallPenalty(void);
+    int& largePenalty(void);
+    // 8 or 4
+    int& pathCount(void);
+    // the images are halved this many times before matching
+    int& pyramidLevel(void);
+    // a disparity is rejected if its cost is not below
+    // (1 - uniquenessRatio()) times the cost of the best disparity that
+    // is not a neighbor
+    double& uniquenessRatio(void);
+    // maximum difference between the left and right disparity of a
+    // pixel; negative disables the check
+    int& maxLeftRightDifference(void);
+
+    // Matches the rectified 8-bit grayscale images within roi, or the
+    // whole image if roi is empty, with roi in input image pixels.
+    // disparity is CV_32F with subpixel disparities at the matching
+    // resolution, and -1 where there is no valid disparity. confidence is
+    // CV_32F, from 0 for an ambiguous match to 1 for a unique one, and 0
+    // where there is no valid disparity.
+    bool match(const cv::Mat& imageL, const cv::Mat& imageR,
+               cv::Mat& disparity, cv::Mat& confidence,
+               const cv::Rect& roi = cv::Rect());
+
+    // Converts disparities at the matching resolution to a CV_32F depth
+    // image, as DynocMap::castRays() takes it: 0 where the disparity is
+    // invalid, its confidence is below minConfidence, or the depth
+    // exceeds maxDepth (0 for no limit). cameraMatrix is the rectified
+    // camera matrix of the input images.
+    void computeDepth(const cv::Mat& disparity, const cv::Mat& confidence,
+                      const Eigen::Matrix3d& cameraMatrix, double baseline,
+                      cv::Mat& depth,
+                      double minConfidence = 0.0, double maxDepth = 0.0) const;
+
+    // camera matrix of the images at the matching resolution
+    Eigen::Matrix3d scaledCameraMatrix(const Eigen::Matrix3d& cameraMatrix) const;
+
+private:
+    void censusTransform(const cv::Mat& image,
+                         std::vector<uint64_t>& census) const;
+    void computeRowCosts(int row);
+
+    void aggregate(bool forward);
+    void selectDisparities(int row, float* disparity, float* confidence);
+
+    int m_width;
+    int m_height;
+    int m_disparityCount;
+
+    std::vector<uint64_t> m_censusL;
+    std::vector<uint64_t> m_censusR;
+    std::vector<uint8_t> m_rowCosts;
+    // sum over all paths of the path costs of each pixel and disparity
+    std::vector<uint16_t> m_costSums;
+    // path costs of the previous and current pixel on the horizontal
+    // path, and of the previous and current row on the other paths, with
+    // padding around the disparities and a pixel of padding at each end
+    // of a row
+    std::vector<int16_t> m_pixelPathCosts[2];
+    std::vector<int16_t> m_rowPathCosts[2][3];
+    std::vector<int16_t> m_rowMinPathCosts[2][3];
+    std::vector<int> m_bestDisparities;
+    std::vector<int> m_rightDisparities;
+    std::vector<int> m_rightCosts;
+
+    int k_disparityCount;
+    int k_smallPenalty;
+    int k_largePenalty;
+    int k_pathCount;
+    int k_pyramidLevel;
+    double k_uniquenessRatio;
+    int k_maxLeftRightDifference;
+};
+
+typedef boost::shared_ptr<SemiGlobalMatcher> SemiGlobalMatcherPtr;
+
+}
+
+#endif
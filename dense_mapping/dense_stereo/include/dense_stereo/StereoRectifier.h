@@ -0,0 +1,78 @@
+#ifndef STEREORECTIFIER_H
+#define STEREORECTIFIER_H
+
+#include <boost/shared_ptr.hpp>
+#include <Eigen/Dense>
+#include <opencv2/core/core.hpp>
+
+#include "camera_systems/CameraSystem.h"
+
+namespace px
+{
+
+// Undistorts and rectifies the images of two cameras of a camera system
+// to a common pinhole camera, with the right camera on the positive x
+// axis of the rectified left camera. The rectified x axis lies along the
+// baseline and the rectified z axis is as close as possible to the mean
+// of the two optical axes.
+class StereoRectifier
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    StereoRectifier();
+
+    // Finds the first two consecutive cameras that are part of a stereo
+    // pair.
+    static bool findStereoPair(const CameraSystemConstPtr& cameraSystem,
+                               int& cameraIdx1, int& cameraIdx2);
+
+    // Builds the rectification maps. The cameras are swapped if the
+    // second one is to the left of the first. With a focal length of -1,
+    // that of the left camera is used if it is a pinhole camera. With an
+    // empty image size, that of the left camera is used.
+    bool init(const CameraSystemConstPtr& cameraSystem,
+              int cameraIdx1, int cameraIdx2,
+              double focalLength = -1.0,
+              const cv::Size& imageSize = cv::Size());
+
+    void rectify(const cv::Mat& imageL, const cv::Mat& imageR,
+                 cv::Mat& rectImageL, cv::Mat& rectImageR) const;
+
+    int cameraIdxL(void) const;
+    int cameraIdxR(void) const;
+
+    // camera matrix of both rectified images
+    const Eigen::Matrix3d& cameraMatrix(void) const;
+    double baseline(void) const;
+    cv::Size imageSize(void) const;
+
+    // rotations from the left and right camera frames to the rectified
+    // frame
+    const Eigen::Matrix3d& R_rect_camL(void) const;
+    const Eigen::Matrix3d& R_rect_camR(void) const;
+
+    // transform from the rectified left camera frame to the system frame
+    const Eigen::Matrix4d& H_sys_rect(void) const;
+
+private:
+    int m_cameraIdxL;
+    int m_cameraIdxR;
+
+    Eigen::Matrix3d m_cameraMatrix;
+    double m_baseline;
+    cv::Size m_imageSize;
+
+    Eigen::Matrix3d m_R_rect_camL;
+    Eigen::Matrix3d m_R_rect_camR;
+    Eigen::Matrix4d m_H_sys_rect;
+
+    cv::Mat m_mapXL, m_mapYL;
+    cv::Mat m_mapXR, m_mapYR;
+};
+
+typedef boost::shared_ptr<StereoRectifier> StereoRectifierPtr;
+
+}
+
+#endif
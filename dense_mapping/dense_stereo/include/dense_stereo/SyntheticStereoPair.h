@@ -0,0 +1,84 @@
+#ifndef SYNTHETICSTEREOPAIR_H
+#define SYNTHETICSTEREOPAIR_H
+
+#include <Eigen/Dense>
+#include <opencv2/core/core.hpp>
+#include <stdint.h>
+#include <vector>
+
+namespace px
+{
+
+// Renders rectified stereo pairs with known depth for tests and
+// benchmarks: a wall at maxDepth(), a ground plane cameraHeight() below
+// the cameras, and obstacleCount() boxes facing the cameras that stand on
+// the ground at random depths. The surfaces carry value noise textures
+// fixed to the scene, so that both images see the same texture, and each
+// pixel averages 2x2 samples.
+class SyntheticStereoPair
+{
+public:
+    SyntheticStereoPair(int imageWidth, int imageHeight,
+                        double focalLength, double baseline,
+                        uint64_t seed = 0);
+
+    int& obstacleCount(void);
+    double& minDepth(void);
+    double& maxDepth(void);
+    double& cameraHeight(void);
+    // standard deviation of the image noise in gray levels
+    double& pixelNoise(void);
+
+    Eigen::Matrix3d cameraMatrix(void) const;
+    double baseline(void) const;
+
+    // Generates a new scene and renders it. depthL is the CV_32F depth of
+    // each pixel of the left image, and visibleL is a CV_8U mask that is
+    // nonzero where that pixel is also seen by the right camera.
+    void generate(cv::Mat& imageL, cv::Mat& imageR,
+                  cv::Mat& depthL, cv::Mat& visibleL);
+
+    // ground truth disparity of each pixel of the left image
+    void depthToDisparity(const cv::Mat& depth, cv::Mat& disparity) const;
+
+private:
+    enum
+    {
+        WALL = 0,
+        GROUND = 1,
+        // obstacle i is surface OBSTACLE + i
+        OBSTACLE = 2
+    };
+
+    struct Obstacle
+    {
+        double depth;
+        double xMin;
+        double xMax;
+        double yMin;
+    };
+
+    double castRay(double cameraX, double u, double v, int& surface,
+                   double& s, double& t) const;
+    double texture(int surface, double s, double t) const;
+    void render(double cameraX, cv::Mat& image, cv::Mat& depth);
+
+    int m_imageWidth;
+    int m_imageHeight;
+    double m_focalLength;
+    double m_baseline;
+    cv::RNG m_rng;
+
+    std::vector<Obstacle> m_obstacles;
+    uint32_t m_textureSeed;
+
+    int k_obstacleCount;
+    double k_minDepth;
+    double k_maxDepth;
+    double k_cameraHeight;
+    double k_pixelNoise;
+};
+
+}
+
+#endif
@@ -0,0 +1,604 @@
+#include "dense_stereo/SemiGlobalMatcher.h"
+
+#include <algorithm>
+#include <limits>
+#include <opencv2/imgproc/imgproc.hpp>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace px
+{
+
+namespace
+{
+
+const int kCensusHalfWidth = 4;
+const int kCensusHalfHeight = 3;
+// cost of disparities that leave the right image
+const uint8_t kInvalidCost = (2 * kCensusHalfWidth + 1) * (2 * kCensusHalfHeight + 1);
+// path cost of the padding around the disparities, which is never the
+// minimum and cannot overflow when a penalty is added
+const int16_t kPaddingPathCost = 0x3fff;
+// disparities are padded by this many entries on each side so that the
+// path costs of d - 1 and d + 1 can be loaded as vectors
+const int kPadding = 8;
+
+// Updates the path costs L of a pixel from those of its predecessor on
+// the path, prevL, whose minimum is prevMin, and adds them to the cost
+// sums. Returns the minimum of L.
+inline int16_t
+updatePathCosts(const uint8_t* costs, const int16_t* prevL, int16_t prevMin,
+                int16_t* L, uint16_t* sums, int disparityCount,
+                int16_t smallPenalty, int16_t largePenalty)
+{
+#if defined(__SSE2__)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vSmallPenalty = _mm_set1_epi16(smallPenalty);
+    const __m128i vPrevMin = _mm_set1_epi16(prevMin);
+    const __m128i vLargeJump = _mm_adds_epi16(vPrevMin, _mm_set1_epi16(largePenalty));
+
+    __m128i vMin = _mm_set1_epi16(std::numeric_limits<int16_t>::max());
+    for (int d = 0; d < disparityCount; d += 8)
+    {
+        __m128i c = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(costs + d)), zero);
+
+        __m128i l0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prevL + d));
+        __m128i lm = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prevL + d - 1));
+        __m128i lp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prevL + d + 1));
+
+        __m128i m = _mm_min_epi16(l0, _mm_adds_epi16(_mm_min_epi16(lm, lp), vSmallPenalty));
+        m = _mm_min_epi16(m, vLargeJump);
+
+        __m128i l = _mm_subs_epi16(_mm_adds_epi16(c, m), vPrevMin);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(L + d), l);
+        vMin = _mm_min_epi16(vMin, l);
+
+        __m128i* s = reinterpret_cast<__m128i*>(sums + d);
+        _mm_storeu_si128(s, _mm_adds_epu16(_mm_loadu_si128(s), l));
+    }
+
+    vMin = _mm_min_epi16(vMin, _mm_srli_si128(vMin, 8));
+    vMin = _mm_min_epi16(vMin, _mm_srli_si128(vMin, 4));
+    vMin = _mm_min_epi16(vMin, _mm_srli_si128(vMin, 2));
+
+    return static_cast<int16_t>(_mm_cvtsi128_si32(vMin) & 0xffff);
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    const int16x8_t vSmallPenalty = vdupq_n_s16(smallPenalty);
+    const int16x8_t vPrevMin = vdupq_n_s16(prevMin);
+    const int16x8_t vLargeJump = vqaddq_s16(vPrevMin, vdupq_n_s16(largePenalty));
+
+    int16x8_t vMin = vdupq_n_s16(std::numeric_limits<int16_t>::max());
+    for (int d = 0; d < disparityCount; d += 8)
+    {
+        int16x8_t c = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(costs + d)));
+
+        int16x8_t l0 = vld1q_s16(prevL + d);
+        int16x8_t lm = vld1q_s16(prevL + d - 1);
+        int16x8_t lp = vld1q_s16(prevL + d + 1);
+
+        int16x8_t m = vminq_s16(l0, vqaddq_s16(vminq_s16(lm, lp), vSmallPenalty));
+        m = vminq_s16(m, vLargeJump);
+
+        int16x8_t l = vqsubq_s16(vqaddq_s16(c, m), vPrevMin);
+        vst1q_s16(L + d, l);
+        vMin = vminq_s16(vMin, l);
+
+        vst1q_u16(sums + d, vqaddq_u16(vld1q_u16(sums + d), vreinterpretq_u16_s16(l)));
+    }
+
+    int16x4_t vMin4 = vmin_s16(vget_low_s16(vMin), vget_high_s16(vMin));
+    vMin4 = vpmin_s16(vMin4, vMin4);
+    vMin4 = vpmin_s16(vMin4, vMin4);
+
+    return vget_lane_s16(vMin4, 0);
+#else
+    int largeJump = prevMin + largePenalty;
+
+    int16_t minL = std::numeric_limits<int16_t>::max();
+    for (int d = 0; d < disparityCount; ++d)
+    {
+        int m = std::min(static_cast<int>(prevL[d]),
+                         std::min(prevL[d - 1], prevL[d + 1]) + smallPenalty);
+        m = std::min(m, largeJump);
+
+        int16_t l = static_cast<int16_t>(costs[d] + m - prevMin);
+        L[d] = l;
+        minL = std::min(minL, l);
+
+        sums[d] = static_cast<uint16_t>(std::min(sums[d] + l, 0xffff));
+    }
+
+    return minL;
+#endif
+}
+
+}
+
+SemiGlobalMatcher::SemiGlobalMatcher()
+ : m_width(0)
+ , m_height(0)
+ , m_disparityCount(0)
+ , k_disparityCount(64)
+ , k_smallPenalty(8)
+ , k_largePenalty(96)
+ , k_pathCount(8)
+ , k_pyramidLevel(0)
+ , k_uniquenessRatio(0.05)
+ , k_maxLeftRightDifference(1)
+{
+
+}
+
+int&
+SemiGlobalMatcher::disparityCount(void)
+{
+    return k_disparityCount;
+}
+
+int&
+SemiGlobalMatcher::smallPenalty(void)
+{
+    return k_smallPenalty;
+}
+
+int&
+SemiGlobalMatcher::largePenalty(void)
+{
+    return k_largePenalty;
+}
+
+int&
+SemiGlobalMatcher::pathCount(void)
+{
+    return k_pathCount;
+}
+
+int&
+SemiGlobalMatcher::pyramidLevel(void)
+{
+    return k_pyramidLevel;
+}
+
+double&
+SemiGlobalMatcher::uniquenessRatio(void)
+{
+    return k_uniquenessRatio;
+}
+
+int&
+SemiGlobalMatcher::maxLeftRightDifference(void)
+{
+    return k_maxLeftRightDifference;
+}
+
+bool
+SemiGlobalMatcher::match(const cv::Mat& imageL, const cv::Mat& imageR,
+                         cv::Mat& disparity, cv::Mat& confidence,
+                         const cv::Rect& roi)
+{
+    if (imageL.empty() || imageL.type() != CV_8UC1 ||
+        imageR.type() != CV_8UC1 || imageL.size() != imageR.size() ||
+        k_disparityCount <= 0 || k_pyramidLevel < 0 ||
+        (k_pathCount != 4 && k_pathCount != 8))
+    {
+        return false;
+    }
+
+    cv::Mat pyrL = imageL, pyrR = imageR;
+    for (int i = 0; i < k_pyramidLevel; ++i)
+    {
+        cv::pyrDown(pyrL, pyrL);
+        cv::pyrDown(pyrR, pyrR);
+    }
+
+    cv::Rect imageRect(0, 0, pyrL.cols, pyrL.rows);
+
+    cv::Rect matchRect = imageRect;
+    if (roi.area() > 0)
+    {
+        int scale = 1 << k_pyramidLevel;
+
+        cv::Point tl(roi.x / scale, roi.y / scale);
+        cv::Point br((roi.x + roi.width + scale - 1) / scale,
+                     (roi.y + roi.height + scale - 1) / scale);
+
+        matchRect = cv::Rect(tl, br) & imageRect;
+    }
+
+    disparity = cv::Mat(pyrL.size(), CV_32F, cv::Scalar(-1.0f));
+    confidence = cv::Mat::zeros(pyrL.size(), CV_32F);
+
+    if (matchRect.area() == 0)
+    {
+        return true;
+    }
+
+    m_disparityCount = (k_disparityCount + 15) / 16 * 16;
+
+    // the left image is matched within the region of interest, and the
+    // right image up to the largest disparity to its left
+    int x0 = std::max(0, matchRect.x - m_disparityCount + 1);
+    cv::Rect cropRect(x0, matchRect.y,
+                      matchRect.x + matchRect.width - x0, matchRect.height);
+
+    // the census windows reach beyond the cropped images
+    cv::Rect censusRect(cropRect.x - kCensusHalfWidth, cropRect.y - kCensusHalfHeight,
+                        cropRect.width + 2 * kCensusHalfWidth,
+                        cropRect.height + 2 * kCensusHalfHeight);
+    censusRect &= imageRect;
+
+    m_width = cropRect.width;
+    m_height = cropRect.height;
+
+    std::vector<uint64_t> censusL, censusR;
+    censusTransform(pyrL(censusRect), censusL);
+    censusTransform(pyrR(censusRect), censusR);
+
+    // keep the census of the cropped images only
+    m_censusL.resize(m_width * m_height);
+    m_censusR.resize(m_width * m_height);
+    for (int r = 0; r < m_height; ++r)
+    {
+        size_t offset = (r + cropRect.y - censusRect.y) * censusRect.width +
+                        cropRect.x - censusRect.x;
+
+        std::copy(censusL.begin() + offset, censusL.begin() + offset + m_width,
+                  m_censusL.begin() + r * m_width);
+        std::copy(censusR.begin() + offset, censusR.begin() + offset + m_width,
+                  m_censusR.begin() + r * m_width);
+    }
+
+    int disparityStride = m_disparityCount + 2 * kPadding;
+
+    m_rowCosts.resize(m_width * m_disparityCount);
+    m_costSums.assign(static_cast<size_t>(m_width) * m_height * m_disparityCount, 0);
+    for (int i = 0; i < 2; ++i)
+    {
+        m_pixelPathCosts[i].assign(disparityStride, kPaddingPathCost);
+        for (int j = 0; j < 3; ++j)
+        {
+            m_rowPathCosts[i][j].assign((m_width + 2) * disparityStride, kPaddingPathCost);
+            m_rowMinPathCosts[i][j].assign(m_width + 2, 0);
+        }
+    }
+
+    aggregate(true);
+    aggregate(false);
+
+    m_bestDisparities.resize(m_width);
+    m_rightDisparities.resize(m_width);
+    m_rightCosts.resize(m_width);
+
+    int matchOffset = matchRect.x - cropRect.x;
+    std::vector<float> rowDisparities(m_width), rowConfidences(m_width);
+    for (int r = 0; r < m_height; ++r)
+    {
+        selectDisparities(r, rowDisparities.data(), rowConfidences.data());
+
+        float* dst = disparity.ptr<float>(r + matchRect.y) + matchRect.x;
+        float* dstConfidence = confidence.ptr<float>(r + matchRect.y) + matchRect.x;
+        std::copy(rowDisparities.begin() + matchOffset, rowDisparities.end(), dst);
+        std::copy(rowConfidences.begin() + matchOffset, rowConfidences.end(), dstConfidence);
+    }
+
+    return true;
+}
+
+void
+SemiGlobalMatcher::computeDepth(const cv::Mat& disparity, const cv::Mat& confidence,
+                                const Eigen::Matrix3d& cameraMatrix, double baseline,
+                                cv::Mat& depth,
+                                double minConfidence, double maxDepth) const
+{
+    double fb = scaledCameraMatrix(cameraMatrix)(0,0) * baseline;
+
+    depth = cv::Mat::zeros(disparity.size(), CV_32F);
+
+    for (int r = 0; r < disparity.rows; ++r)
+    {
+        const float* d = disparity.ptr<float>(r);
+        const float* c = confidence.ptr<float>(r);
+        float* z = depth.ptr<float>(r);
+
+        for (int i = 0; i < disparity.cols; ++i)
+        {
+            if (d[i] <= 0.0f || c[i] < minConfidence)
+            {
+                continue;
+            }
+
+            double zi = fb / d[i];
+            if (maxDepth > 0.0 && zi > maxDepth)
+            {
+                continue;
+            }
+
+            z[i] = zi;
+        }
+    }
+}
+
+Eigen::Matrix3d
+SemiGlobalMatcher::scaledCameraMatrix(const Eigen::Matrix3d& cameraMatrix) const
+{
+    // pyrDown maps the center of pixel u to (u + 0.5) / 2 - 0.5
+    double scale = 1.0 / (1 << k_pyramidLevel);
+
+    Eigen::Matrix3d K = cameraMatrix;
+    K(0,0) *= scale;
+    K(1,1) *= scale;
+    K(0,2) = (cameraMatrix(0,2) + 0.5) * scale - 0.5;
+    K(1,2) = (cameraMatrix(1,2) + 0.5) * scale - 0.5;
+
+    return K;
+}
+
+void
+SemiGlobalMatcher::censusTransform(const cv::Mat& image,
+                                   std::vector<uint64_t>& census) const
+{
+    cv::Mat border;
+    cv::copyMakeBorder(image, border,
+                       kCensusHalfHeight, kCensusHalfHeight,
+                       kCensusHalfWidth, kCensusHalfWidth,
+                       cv::BORDER_REPLICATE);
+
+    census.assign(image.rows * image.cols, 0);
+
+    // one neighbor at a time along the row, which the compiler vectorizes
+    for (int r = 0; r < image.rows; ++r)
+    {
+        uint64_t* dst = &census[r * image.cols];
+        const uchar* center = border.ptr<uchar>(r + kCensusHalfHeight) + kCensusHalfWidth;
+
+        for (int i = 0; i <= 2 * kCensusHalfHeight; ++i)
+        {
+            for (int j = 0; j <= 2 * kCensusHalfWidth; ++j)
+            {
+                if (i == kCensusHalfHeight && j == kCensusHalfWidth)
+                {
+                    continue;
+                }
+
+                const uchar* src = border.ptr<uchar>(r + i) + j;
+
+                for (int c = 0; c < image.cols; ++c)
+                {
+                    dst[c] = (dst[c] << 1) | static_cast<uint64_t>(src[c] < center[c]);
+                }
+            }
+        }
+    }
+}
+
+void
+SemiGlobalMatcher::computeRowCosts(int row)
+{
+    const uint64_t* censusL = &m_censusL[row * m_width];
+    const uint64_t* censusR = &m_censusR[row * m_width];
+
+    for (int c = 0; c < m_width; ++c)
+    {
+        uint8_t* costs = &m_rowCosts[c * m_disparityCount];
+
+        int dMax = std::min(c + 1, m_disparityCount);
+        int d = 0;
+
+#if defined(__SSE2__)
+        // Hamming distances for disparities d + 1 and d at once
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i m1 = _mm_set1_epi8(0x55);
+        const __m128i m2 = _mm_set1_epi8(0x33);
+        const __m128i m4 = _mm_set1_epi8(0x0f);
+        const __m128i vCensusL = _mm_set1_epi64x(censusL[c]);
+
+        for (; d + 1 < dMax; d += 2)
+        {
+            __m128i x = _mm_xor_si128(vCensusL,
+                                      _mm_loadu_si128(reinterpret_cast<const __m128i*>(censusR + c - d - 1)));
+
+            x = _mm_sub_epi8(x, _mm_and_si128(_mm_srli_epi64(x, 1), m1));
+            x = _mm_add_epi8(_mm_and_si128(x, m2), _mm_and_si128(_mm_srli_epi64(x, 2), m2));
+            x = _mm_and_si128(_mm_add_epi8(x, _mm_srli_epi64(x, 4)), m4);
+            x = _mm_sad_epu8(x, zero);
+
+            costs[d] = _mm_extract_epi16(x, 4);
+            costs[d + 1] = _mm_extract_epi16(x, 0);
+        }
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+        const uint64x2_t vCensusL = vdupq_n_u64(censusL[c]);
+
+        for (; d + 1 < dMax; d += 2)
+        {
+            uint64x2_t x = veorq_u64(vCensusL, vld1q_u64(censusR + c - d - 1));
+            uint64x2_t n = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(vcntq_u8(vreinterpretq_u8_u64(x)))));
+
+            costs[d] = vgetq_lane_u64(n, 1);
+            costs[d + 1] = vgetq_lane_u64(n, 0);
+        }
+#endif
+        for (; d < dMax; ++d)
+        {
+            costs[d] = __builtin_popcountll(censusL[c] ^ censusR[c - d]);
+        }
+        for (; d < m_disparityCount; ++d)
+        {
+            costs[d] = kInvalidCost;
+        }
+    }
+}
+
+void
+SemiGlobalMatcher::aggregate(bool forward)
+{
+    const int disparityStride = m_disparityCount + 2 * kPadding;
+    const int16_t smallPenalty = k_smallPenalty;
+    const int16_t largePenalty = k_largePenalty;
+
+    // the horizontal path runs along the row; the other paths come from
+    // the previous row, diagonally, vertically and anti-diagonally
+    const int step = forward ? 1 : -1;
+    const int prevOffsets[3] = {-step, 0, step};
+    const bool usePath[3] = {k_pathCount == 8, true, k_pathCount == 8};
+
+    // the paths start with zero path costs outside the image
+    for (int i = 0; i < 2; ++i)
+    {
+        for (int j = 0; j < 3; ++j)
+        {
+            std::vector<int16_t>& pathCosts = m_rowPathCosts[i][j];
+            for (int c = 0; c < m_width + 2; ++c)
+            {
+                std::fill(pathCosts.begin() + c * disparityStride + kPadding,
+                          pathCosts.begin() + c * disparityStride + kPadding + m_disparityCount, 0);
+            }
+            std::fill(m_rowMinPathCosts[i][j].begin(), m_rowMinPathCosts[i][j].end(), 0);
+        }
+    }
+
+    int prevRow = 0;
+    for (int r = forward ? 0 : m_height - 1;
+         r >= 0 && r < m_height; r += step)
+    {
+        computeRowCosts(r);
+
+        int curRow = 1 - prevRow;
+
+        std::fill(m_pixelPathCosts[0].begin() + kPadding,
+                  m_pixelPathCosts[0].begin() + kPadding + m_disparityCount, 0);
+        int16_t prevPixelMin = 0;
+        int prevPixel = 0;
+
+        for (int c = forward ? 0 : m_width - 1;
+             c >= 0 && c < m_width; c += step)
+        {
+            const uint8_t* costs = &m_rowCosts[c * m_disparityCount];
+            uint16_t* sums = &m_costSums[(static_cast<size_t>(r) * m_width + c) * m_disparityCount];
+
+            int curPixel = 1 - prevPixel;
+            prevPixelMin = updatePathCosts(costs,
+                                           &m_pixelPathCosts[prevPixel][kPadding], prevPixelMin,
+                                           &m_pixelPathCosts[curPixel][kPadding], sums,
+                                           m_disparityCount, smallPenalty, largePenalty);
+            prevPixel = curPixel;
+
+            for (int i = 0; i < 3; ++i)
+            {
+                if (!usePath[i])
+                {
+                    continue;
+                }
+
+                // pixels are offset by one for the padding
+                int prevC = c + 1 + prevOffsets[i];
+
+                m_rowMinPathCosts[curRow][i][c + 1] =
+                    updatePathCosts(costs,
+                                    &m_rowPathCosts[prevRow][i][prevC * disparityStride + kPadding],
+                                    m_rowMinPathCosts[prevRow][i][prevC],
+                                    &m_rowPathCosts[curRow][i][(c + 1) * disparityStride + kPadding],
+                                    sums, m_disparityCount, smallPenalty, largePenalty);
+            }
+        }
+
+        prevRow = curRow;
+    }
+}
+
+void
+SemiGlobalMatcher::selectDisparities(int row, float* disparity, float* confidence)
+{
+    const uint16_t* rowSums = &m_costSums[static_cast<size_t>(row) * m_width * m_disparityCount];
+
+    // best disparities of the left image, and of the right image from
+    // the same cost sums
+    std::fill(m_rightCosts.begin(), m_rightCosts.end(), std::numeric_limits<int>::max());
+
+    for (int c = 0; c < m_width; ++c)
+    {
+        const uint16_t* sums = &rowSums[c * m_disparityCount];
+        int* rightCosts = &m_rightCosts[c];
+        int* rightDisparities = &m_rightDisparities[c];
+
+        int bestD = 0;
+        int bestCost = std::numeric_limits<int>::max();
+
+        int dMax = std::min(c + 1, m_disparityCount);
+        for (int d = 0; d < dMax; ++d)
+        {
+            int cost = sums[d];
+            if (cost < bestCost)
+            {
+                bestCost = cost;
+                bestD = d;
+            }
+            if (cost < rightCosts[-d])
+            {
+                rightCosts[-d] = cost;
+                rightDisparities[-d] = d;
+            }
+        }
+
+        m_bestDisparities[c] = bestD;
+    }
+
+    for (int c = 0; c < m_width; ++c)
+    {
+        const uint16_t* sums = &rowSums[c * m_disparityCount];
+
+        disparity[c] = -1.0f;
+        confidence[c] = 0.0f;
+
+        int dMax = std::min(c + 1, m_disparityCount);
+        int bestD = m_bestDisparities[c];
+        int bestCost = sums[bestD];
+
+        if (k_maxLeftRightDifference >= 0 &&
+            std::abs(m_rightDisparities[c - bestD] - bestD) > k_maxLeftRightDifference)
+        {
+            continue;
+        }
+
+        // best disparity that is not a neighbor of the best one
+        int secondCost = std::numeric_limits<int>::max();
+        for (int d = 0; d < dMax; ++d)
+        {
+            if (std::abs(d - bestD) > 1 && sums[d] < secondCost)
+            {
+                secondCost = sums[d];
+            }
+        }
+
+        if (secondCost != std::numeric_limits<int>::max() &&
+            bestCost >= (1.0 - k_uniquenessRatio) * secondCost)
+        {
+            continue;
+        }
+
+        float d = bestD;
+        if (bestD > 0 && bestD < dMax - 1)
+        {
+            int denom = sums[bestD - 1] - 2 * bestCost + sums[bestD + 1];
+            if (denom > 0)
+            {
+                d += 0.5f * (sums[bestD - 1] - sums[bestD + 1]) / denom;
+            }
+        }
+
+        disparity[c] = d;
+        if (secondCost == std::numeric_limits<int>::max())
+        {
+            confidence[c] = 1.0f;
+        }
+        else
+        {
+            confidence[c] = 1.0f - static_cast<float>(bestCost) / std::max(secondCost, 1);
+        }
+    }
+}
+
+}
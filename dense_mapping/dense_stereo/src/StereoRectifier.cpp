@@ -0,0 +1,195 @@
+#include "dense_stereo/StereoRectifier.h"
+
+#include <algorithm>
+#include <opencv2/core/eigen.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "camera_models/PinholeCamera.h"
+
+namespace px
+{
+
+StereoRectifier::StereoRectifier()
+ : m_cameraIdxL(-1)
+ , m_cameraIdxR(-1)
+ , m_cameraMatrix(Eigen::Matrix3d::Identity())
+ , m_baseline(0.0)
+ , m_R_rect_camL(Eigen::Matrix3d::Identity())
+ , m_R_rect_camR(Eigen::Matrix3d::Identity())
+ , m_H_sys_rect(Eigen::Matrix4d::Identity())
+{
+
+}
+
+bool
+StereoRectifier::findStereoPair(const CameraSystemConstPtr& cameraSystem,
+                                int& cameraIdx1, int& cameraIdx2)
+{
+    for (int i = 0; i + 1 < cameraSystem->cameraCount(); ++i)
+    {
+        if (cameraSystem->isPartOfStereoPair(i) &&
+            cameraSystem->isPartOfStereoPair(i + 1))
+        {
+            cameraIdx1 = i;
+            cameraIdx2 = i + 1;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool
+StereoRectifier::init(const CameraSystemConstPtr& cameraSystem,
+                      int cameraIdx1, int cameraIdx2,
+                      double focalLength,
+                      const cv::Size& imageSize)
+{
+    if (cameraIdx1 < 0 || cameraIdx1 >= cameraSystem->cameraCount() ||
+        cameraIdx2 < 0 || cameraIdx2 >= cameraSystem->cameraCount() ||
+        cameraIdx1 == cameraIdx2)
+    {
+        return false;
+    }
+
+    m_cameraIdxL = cameraIdx1;
+    m_cameraIdxR = cameraIdx2;
+
+    Eigen::Matrix4d H_camL_camR = cameraSystem->getGlobalCameraPose(m_cameraIdxL).inverse() *
+                                  cameraSystem->getGlobalCameraPose(m_cameraIdxR);
+    if (H_camL_camR(0,3) < 0.0)
+    {
+        std::swap(m_cameraIdxL, m_cameraIdxR);
+
+        H_camL_camR = H_camL_camR.inverse().eval();
+    }
+
+    Eigen::Matrix4d H_sys_camL = cameraSystem->getGlobalCameraPose(m_cameraIdxL);
+
+    CameraConstPtr cameraL = cameraSystem->getCamera(m_cameraIdxL);
+    CameraConstPtr cameraR = cameraSystem->getCamera(m_cameraIdxR);
+
+    Eigen::Vector3d t = H_camL_camR.block<3,1>(0,3);
+    Eigen::Matrix3d R_camL_camR = H_camL_camR.block<3,3>(0,0);
+
+    m_baseline = t.norm();
+    if (m_baseline < 1e-6)
+    {
+        return false;
+    }
+
+    Eigen::Vector3d e1 = t / m_baseline;
+    Eigen::Vector3d z = Eigen::Vector3d::UnitZ() + R_camL_camR.col(2);
+    Eigen::Vector3d e2 = z.cross(e1);
+    if (e2.norm() < 1e-6)
+    {
+        return false;
+    }
+    e2.normalize();
+    Eigen::Vector3d e3 = e1.cross(e2);
+
+    m_R_rect_camL.row(0) = e1.transpose();
+    m_R_rect_camL.row(1) = e2.transpose();
+    m_R_rect_camL.row(2) = e3.transpose();
+    m_R_rect_camR = m_R_rect_camL * R_camL_camR;
+
+    Eigen::Matrix4d H_camL_rect = Eigen::Matrix4d::Identity();
+    H_camL_rect.block<3,3>(0,0) = m_R_rect_camL.transpose();
+    m_H_sys_rect = H_sys_camL * H_camL_rect;
+
+    if (focalLength <= 0.0)
+    {
+        if (cameraL->modelType() != Camera::PINHOLE)
+        {
+            return false;
+        }
+
+        const PinholeCamera::Parameters& params =
+            boost::static_pointer_cast<const PinholeCamera>(cameraL)->getParameters();
+        focalLength = params.fx();
+    }
+
+    m_imageSize = imageSize;
+    if (m_imageSize.area() == 0)
+    {
+        m_imageSize = cv::Size(cameraL->imageWidth(), cameraL->imageHeight());
+    }
+
+    m_cameraMatrix << focalLength, 0.0, (m_imageSize.width - 1) / 2.0,
+                      0.0, focalLength, (m_imageSize.height - 1) / 2.0,
+                      0.0, 0.0, 1.0;
+
+    cv::Mat R_rect_camL, R_rect_camR;
+    cv::eigen2cv(Eigen::Matrix3f(m_R_rect_camL.cast<float>()), R_rect_camL);
+    cv::eigen2cv(Eigen::Matrix3f(m_R_rect_camR.cast<float>()), R_rect_camR);
+
+    cameraL->initUndistortRectifyMap(m_mapXL, m_mapYL,
+                                     focalLength, focalLength, m_imageSize,
+                                     m_cameraMatrix(0,2), m_cameraMatrix(1,2),
+                                     R_rect_camL);
+    cameraR->initUndistortRectifyMap(m_mapXR, m_mapYR,
+                                     focalLength, focalLength, m_imageSize,
+                                     m_cameraMatrix(0,2), m_cameraMatrix(1,2),
+                                     R_rect_camR);
+
+    return true;
+}
+
+void
+StereoRectifier::rectify(const cv::Mat& imageL, const cv::Mat& imageR,
+                         cv::Mat& rectImageL, cv::Mat& rectImageR) const
+{
+    cv::remap(imageL, rectImageL, m_mapXL, m_mapYL, cv::INTER_LINEAR);
+    cv::remap(imageR, rectImageR, m_mapXR, m_mapYR, cv::INTER_LINEAR);
+}
+
+int
+StereoRectifier::cameraIdxL(void) const
+{
+    return m_cameraIdxL;
+}
+
+int
+StereoRectifier::cameraIdxR(void) const
+{
+    return m_cameraIdxR;
+}
+
+const Eigen::Matrix3d&
+StereoRectifier::cameraMatrix(void) const
+{
+    return m_cameraMatrix;
+}
+
+double
+StereoRectifier::baseline(void) const
+{
+    return m_baseline;
+}
+
+cv::Size
+StereoRectifier::imageSize(void) const
+{
+    return m_imageSize;
+}
+
+const Eigen::Matrix3d&
+StereoRectifier::R_rect_camL(void) const
+{
+    return m_R_rect_camL;
+}
+
+const Eigen::Matrix3d&
+StereoRectifier::R_rect_camR(void) const
+{
+    return m_R_rect_camR;
+}
+
+const Eigen::Matrix4d&
+StereoRectifier::H_sys_rect(void) const
+{
+    return m_H_sys_rect;
+}
+
+}
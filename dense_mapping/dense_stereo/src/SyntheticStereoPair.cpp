@@ -0,0 +1,270 @@
+#include "dense_stereo/SyntheticStereoPair.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace px
+{
+
+namespace
+{
+
+// size of a texture cell in pixels at the depth of a surface facing
+// the cameras
+const double kTextureCellPixels = 3.0;
+// size of a texture cell on the ground
+const double kGroundTextureCell = 0.05;
+
+double
+hashNoise(int32_t x, int32_t y, uint32_t seed)
+{
+    uint32_t h = seed ^ (static_cast<uint32_t>(x) * 0x8da6b343u) ^
+                 (static_cast<uint32_t>(y) * 0xd8163841u);
+    h ^= h >> 16;
+    h *= 0x7feb352du;
+    h ^= h >> 15;
+    h *= 0x846ca68bu;
+    h ^= h >> 16;
+
+    return (h & 0xffffff) / static_cast<double>(0x1000000);
+}
+
+double
+valueNoise(double s, double t, uint32_t seed)
+{
+    double fs = std::floor(s);
+    double ft = std::floor(t);
+    int32_t is = static_cast<int32_t>(fs);
+    int32_t it = static_cast<int32_t>(ft);
+
+    double a = s - fs;
+    double b = t - ft;
+
+    return (1.0 - b) * ((1.0 - a) * hashNoise(is, it, seed) + a * hashNoise(is + 1, it, seed)) +
+           b * ((1.0 - a) * hashNoise(is, it + 1, seed) + a * hashNoise(is + 1, it + 1, seed));
+}
+
+}
+
+SyntheticStereoPair::SyntheticStereoPair(int imageWidth, int imageHeight,
+                                         double focalLength, double baseline,
+                                         uint64_t seed)
+ : m_imageWidth(imageWidth)
+ , m_imageHeight(imageHeight)
+ , m_focalLength(focalLength)
+ , m_baseline(baseline)
+ , m_rng(seed + 1)
+ , m_textureSeed(0)
+ , k_obstacleCount(6)
+ , k_minDepth(1.0)
+ , k_maxDepth(10.0)
+ , k_cameraHeight(1.0)
+ , k_pixelNoise(1.0)
+{
+
+}
+
+int&
+SyntheticStereoPair::obstacleCount(void)
+{
+    return k_obstacleCount;
+}
+
+double&
+SyntheticStereoPair::minDepth(void)
+{
+    return k_minDepth;
+}
+
+double&
+SyntheticStereoPair::maxDepth(void)
+{
+    return k_maxDepth;
+}
+
+double&
+SyntheticStereoPair::cameraHeight(void)
+{
+    return k_cameraHeight;
+}
+
+double&
+SyntheticStereoPair::pixelNoise(void)
+{
+    return k_pixelNoise;
+}
+
+Eigen::Matrix3d
+SyntheticStereoPair::cameraMatrix(void) const
+{
+    Eigen::Matrix3d K;
+    K << m_focalLength, 0.0, (m_imageWidth - 1) / 2.0,
+         0.0, m_focalLength, (m_imageHeight - 1) / 2.0,
+         0.0, 0.0, 1.0;
+
+    return K;
+}
+
+double
+SyntheticStereoPair::baseline(void) const
+{
+    return m_baseline;
+}
+
+void
+SyntheticStereoPair::generate(cv::Mat& imageL, cv::Mat& imageR,
+                              cv::Mat& depthL, cv::Mat& visibleL)
+{
+    m_textureSeed = m_rng.next();
+
+    double cx = (m_imageWidth - 1) / 2.0;
+
+    m_obstacles.resize(k_obstacleCount);
+    for (size_t i = 0; i < m_obstacles.size(); ++i)
+    {
+        Obstacle& obstacle = m_obstacles.at(i);
+
+        obstacle.depth = m_rng.uniform(k_minDepth, 0.8 * k_maxDepth);
+
+        // within the field of view of the left camera
+        double halfWidth = m_rng.uniform(0.15, 0.75);
+        double x = m_rng.uniform(-cx, cx) * obstacle.depth / m_focalLength;
+
+        obstacle.xMin = x - halfWidth;
+        obstacle.xMax = x + halfWidth;
+        obstacle.yMin = k_cameraHeight - m_rng.uniform(0.3, 2.0);
+    }
+
+    cv::Mat depthR;
+    render(0.0, imageL, depthL);
+    render(m_baseline, imageR, depthR);
+
+    // a pixel of the left image is visible to the right camera if the
+    // right camera sees the same depth where the pixel projects
+    double fb = m_focalLength * m_baseline;
+
+    visibleL = cv::Mat::zeros(depthL.size(), CV_8U);
+    for (int r = 0; r < depthL.rows; ++r)
+    {
+        const float* z = depthL.ptr<float>(r);
+        const float* zR = depthR.ptr<float>(r);
+        uchar* visible = visibleL.ptr<uchar>(r);
+
+        for (int c = 0; c < depthL.cols; ++c)
+        {
+            int cR = cvRound(c - fb / z[c]);
+            if (cR < 0)
+            {
+                continue;
+            }
+
+            if (std::fabs(zR[cR] - z[c]) < 0.02 * z[c])
+            {
+                visible[c] = 255;
+            }
+        }
+    }
+}
+
+void
+SyntheticStereoPair::depthToDisparity(const cv::Mat& depth, cv::Mat& disparity) const
+{
+    disparity = m_focalLength * m_baseline / depth;
+}
+
+double
+SyntheticStereoPair::castRay(double cameraX, double u, double v, int& surface,
+                             double& s, double& t) const
+{
+    double x = (u - (m_imageWidth - 1) / 2.0) / m_focalLength;
+    double y = (v - (m_imageHeight - 1) / 2.0) / m_focalLength;
+
+    double z = k_maxDepth;
+    surface = WALL;
+
+    if (y > 0.0 && k_cameraHeight / y < z)
+    {
+        z = k_cameraHeight / y;
+        surface = GROUND;
+    }
+
+    for (size_t i = 0; i < m_obstacles.size(); ++i)
+    {
+        const Obstacle& obstacle = m_obstacles.at(i);
+
+        if (obstacle.depth >= z)
+        {
+            continue;
+        }
+
+        double X = cameraX + x * obstacle.depth;
+        double Y = y * obstacle.depth;
+
+        if (X >= obstacle.xMin && X <= obstacle.xMax &&
+            Y >= obstacle.yMin && Y <= k_cameraHeight)
+        {
+            z = obstacle.depth;
+            surface = OBSTACLE + i;
+        }
+    }
+
+    if (surface == GROUND)
+    {
+        s = (cameraX + x * z) / kGroundTextureCell;
+        t = z / kGroundTextureCell;
+    }
+    else
+    {
+        double cell = kTextureCellPixels * z / m_focalLength;
+
+        s = (cameraX + x * z) / cell;
+        t = y * z / cell;
+    }
+
+    return z;
+}
+
+double
+SyntheticStereoPair::texture(int surface, double s, double t) const
+{
+    uint32_t seed = m_textureSeed + surface * 0x9e3779b9u;
+
+    return 0.6 * valueNoise(s, t, seed) +
+           0.4 * valueNoise(2.0 * s, 2.0 * t, seed ^ 0x5bd1e995u);
+}
+
+void
+SyntheticStereoPair::render(double cameraX, cv::Mat& image, cv::Mat& depth)
+{
+    image = cv::Mat(m_imageHeight, m_imageWidth, CV_8U);
+    depth = cv::Mat(m_imageHeight, m_imageWidth, CV_32F);
+
+    for (int r = 0; r < m_imageHeight; ++r)
+    {
+        uchar* dst = image.ptr<uchar>(r);
+        float* z = depth.ptr<float>(r);
+
+        for (int c = 0; c < m_imageWidth; ++c)
+        {
+            int surface;
+            double s, t;
+            z[c] = castRay(cameraX, c, r, surface, s, t);
+
+            double intensity = 0.0;
+            for (int i = 0; i < 4; ++i)
+            {
+                castRay(cameraX, c + 0.5 * (i % 2) - 0.25, r + 0.5 * (i / 2) - 0.25,
+                        surface, s, t);
+
+                intensity += texture(surface, s, t);
+            }
+
+            double noise = (k_pixelNoise > 0.0) ? m_rng.gaussian(k_pixelNoise) : 0.0;
+
+            dst[c] = cv::saturate_cast<uchar>(30.0 + 50.0 * intensity + noise);
+        }
+    }
+}
+
+}
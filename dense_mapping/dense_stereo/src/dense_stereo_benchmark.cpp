@@ -0,0 +1,195 @@
+#include <boost/program_options.hpp>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <time.h>
+
+#include "dense_stereo/SemiGlobalMatcher.h"
+#include "dense_stereo/SyntheticStereoPair.h"
+
+// Matches synthetic stereo pairs with known depth at each pyramid level,
+// with 8 and 4 paths, and over the whole image and a central region of
+// interest. Reports the matching time, the fraction of pixels seen by
+// both cameras that have a disparity, the fraction of those that are off
+// by more than one pixel, and the mean absolute disparity error, at the
+// matching resolution.
+
+namespace
+{
+
+double
+monotonicTime(void)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+struct Statistics
+{
+    Statistics()
+     : time(0.0)
+     , nPixels(0)
+     , nValid(0)
+     , nBad(0)
+     , errorSum(0.0)
+    {
+
+    }
+
+    double time;
+    size_t nPixels;
+    size_t nValid;
+    size_t nBad;
+    double errorSum;
+};
+
+void
+evaluate(const cv::Mat& disparity, const cv::Mat& trueDisparity,
+         const cv::Mat& visible, const cv::Rect& roi, int pyramidLevel,
+         int disparityCount, Statistics& stats)
+{
+    int scale = 1 << pyramidLevel;
+
+    for (int r = 0; r < disparity.rows; ++r)
+    {
+        for (int c = 0; c < disparity.cols; ++c)
+        {
+            cv::Point p(c * scale, r * scale);
+
+            if (!visible.at<uchar>(p.y, p.x) ||
+                (roi.area() > 0 && !roi.contains(p)))
+            {
+                continue;
+            }
+
+            double d = trueDisparity.at<float>(p.y, p.x) / scale;
+            if (d > disparityCount - 1 || c - d < 0.0)
+            {
+                continue;
+            }
+
+            ++stats.nPixels;
+
+            float estimate = disparity.at<float>(r, c);
+            if (estimate < 0.0f)
+            {
+                continue;
+            }
+
+            double error = std::fabs(estimate - d);
+
+            ++stats.nValid;
+            stats.errorSum += error;
+            if (error > 1.0)
+            {
+                ++stats.nBad;
+            }
+        }
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    int imageWidth;
+    int imageHeight;
+    double focalLength;
+    double baseline;
+    double minDepth;
+    int disparityCount;
+    int maxPyramidLevel;
+    int pairCount;
+    int seed;
+
+    boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("width", boost::program_options::value<int>(&imageWidth)->default_value(640), "Image width.")
+        ("height", boost::program_options::value<int>(&imageHeight)->default_value(480), "Image height.")
+        ("focal-length", boost::program_options::value<double>(&focalLength)->default_value(400.0), "Focal length in pixels.")
+        ("baseline", boost::program_options::value<double>(&baseline)->default_value(0.12), "Baseline in meters.")
+        ("min-depth", boost::program_options::value<double>(&minDepth)->default_value(1.0), "Minimum depth of the obstacles.")
+        ("disparities", boost::program_options::value<int>(&disparityCount)->default_value(64), "Number of disparities at full resolution.")
+        ("max-level", boost::program_options::value<int>(&maxPyramidLevel)->default_value(2), "Highest pyramid level to match at.")
+        ("pairs", boost::program_options::value<int>(&pairCount)->default_value(5), "Number of stereo pairs.")
+        ("seed", boost::program_options::value<int>(&seed)->default_value(0), "Random seed.")
+        ;
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    px::SyntheticStereoPair stereoPair(imageWidth, imageHeight,
+                                       focalLength, baseline, seed);
+    stereoPair.minDepth() = minDepth;
+
+    std::vector<cv::Mat> imagesL, imagesR, trueDisparities, visibility;
+    for (int i = 0; i < pairCount; ++i)
+    {
+        cv::Mat imageL, imageR, depth, visible, trueDisparity;
+        stereoPair.generate(imageL, imageR, depth, visible);
+        stereoPair.depthToDisparity(depth, trueDisparity);
+
+        imagesL.push_back(imageL);
+        imagesR.push_back(imageR);
+        trueDisparities.push_back(trueDisparity);
+        visibility.push_back(visible);
+    }
+
+    cv::Rect centralRoi(imageWidth / 4, imageHeight / 4,
+                        imageWidth / 2, imageHeight / 2);
+
+    printf("%d %dx%d pairs, f %.1f px, baseline %.3f m, %d disparities at full resolution\n",
+           pairCount, imageWidth, imageHeight, focalLength, baseline, disparityCount);
+    printf("  %-5s %-5s %-7s %10s %8s %9s %8s %10s\n",
+           "level", "paths", "roi", "time (ms)", "rate", "density", "bad", "mean err");
+
+    for (int level = 0; level <= maxPyramidLevel; ++level)
+    {
+        for (int pathCount = 8; pathCount >= 4; pathCount -= 4)
+        {
+            for (int useRoi = 0; useRoi < 2; ++useRoi)
+            {
+                px::SemiGlobalMatcher sgm;
+                sgm.disparityCount() = std::max(1, disparityCount >> level);
+                sgm.pathCount() = pathCount;
+                sgm.pyramidLevel() = level;
+
+                cv::Rect roi = useRoi ? centralRoi : cv::Rect();
+
+                Statistics stats;
+                for (int i = 0; i < pairCount; ++i)
+                {
+                    cv::Mat disparity, confidence;
+
+                    double t = monotonicTime();
+                    sgm.match(imagesL.at(i), imagesR.at(i), disparity, confidence, roi);
+                    stats.time += monotonicTime() - t;
+
+                    evaluate(disparity, trueDisparities.at(i), visibility.at(i),
+                             roi, level, sgm.disparityCount(), stats);
+                }
+
+                double time = stats.time / pairCount;
+
+                printf("  %-5d %-5d %-7s %10.2f %6.1f Hz %8.1f%% %7.2f%% %8.3f px\n",
+                       level, pathCount, useRoi ? "central" : "full",
+                       time * 1e3, 1.0 / time,
+                       100.0 * stats.nValid / std::max(stats.nPixels, static_cast<size_t>(1)),
+                       100.0 * stats.nBad / std::max(stats.nValid, static_cast<size_t>(1)),
+                       stats.errorSum / std::max(stats.nValid, static_cast<size_t>(1)));
+            }
+        }
+    }
+
+    return 0;
+}
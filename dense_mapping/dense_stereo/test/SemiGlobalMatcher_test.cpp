@@ -0,0 +1,288 @@
+#include <boost/make_shared.hpp>
+#include <gtest/gtest.h>
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "camera_models/PinholeCamera.h"
+#include "dense_stereo/SemiGlobalMatcher.h"
+#include "dense_stereo/StereoRectifier.h"
+#include "dense_stereo/SyntheticStereoPair.h"
+
+namespace px
+{
+
+// Fraction of the pixels seen by both cameras that have a disparity, and
+// fraction of those whose disparity is off by more than one pixel.
+void
+evaluateDisparities(const cv::Mat& disparity, const cv::Mat& trueDisparity,
+                    const cv::Mat& visible, int pyramidLevel,
+                    int disparityCount, double& density, double& badRatio)
+{
+    int scale = 1 << pyramidLevel;
+
+    size_t nPixels = 0, nValid = 0, nBad = 0;
+    for (int r = 0; r < disparity.rows; ++r)
+    {
+        for (int c = 0; c < disparity.cols; ++c)
+        {
+            if (!visible.at<uchar>(r * scale, c * scale))
+            {
+                continue;
+            }
+
+            double d = trueDisparity.at<float>(r * scale, c * scale) / scale;
+            if (d > disparityCount - 1 || c - d < 0.0)
+            {
+                continue;
+            }
+
+            ++nPixels;
+
+            float estimate = disparity.at<float>(r, c);
+            if (estimate < 0.0f)
+            {
+                continue;
+            }
+
+            ++nValid;
+            if (std::fabs(estimate - d) > 1.0)
+            {
+                ++nBad;
+            }
+        }
+    }
+
+    density = static_cast<double>(nValid) / nPixels;
+    badRatio = static_cast<double>(nBad) / nValid;
+}
+
+TEST(SemiGlobalMatcher, SyntheticPair)
+{
+    SyntheticStereoPair stereoPair(320, 240, 300.0, 0.1);
+    stereoPair.minDepth() = 1.5;
+
+    cv::Mat imageL, imageR, depth, visible;
+    stereoPair.generate(imageL, imageR, depth, visible);
+
+    cv::Mat trueDisparity;
+    stereoPair.depthToDisparity(depth, trueDisparity);
+
+    for (int pathCount = 4; pathCount <= 8; pathCount += 4)
+    {
+        SemiGlobalMatcher sgm;
+        sgm.disparityCount() = 32;
+        sgm.pathCount() = pathCount;
+
+        cv::Mat disparity, confidence;
+        ASSERT_TRUE(sgm.match(imageL, imageR, disparity, confidence));
+        ASSERT_EQ(imageL.size(), disparity.size());
+
+        double density, badRatio;
+        evaluateDisparities(disparity, trueDisparity, visible, 0,
+                            sgm.disparityCount(), density, badRatio);
+
+        EXPECT_GT(density, 0.9);
+        EXPECT_LT(badRatio, 0.02);
+
+        for (int r = 0; r < disparity.rows; ++r)
+        {
+            for (int c = 0; c < disparity.cols; ++c)
+            {
+                float conf = confidence.at<float>(r, c);
+
+                EXPECT_EQ(disparity.at<float>(r, c) < 0.0f, conf == 0.0f);
+                EXPECT_LE(conf, 1.0f);
+            }
+        }
+    }
+}
+
+TEST(SemiGlobalMatcher, RegionOfInterest)
+{
+    SyntheticStereoPair stereoPair(320, 240, 300.0, 0.1, 1);
+
+    cv::Mat imageL, imageR, depth, visible;
+    stereoPair.generate(imageL, imageR, depth, visible);
+
+    SemiGlobalMatcher sgm;
+    sgm.disparityCount() = 32;
+
+    cv::Mat disparity, confidence;
+    ASSERT_TRUE(sgm.match(imageL, imageR, disparity, confidence));
+
+    cv::Rect roi(100, 60, 120, 80);
+
+    cv::Mat roiDisparity, roiConfidence;
+    ASSERT_TRUE(sgm.match(imageL, imageR, roiDisparity, roiConfidence, roi));
+    ASSERT_EQ(imageL.size(), roiDisparity.size());
+
+    // paths start at the border of the region of interest, so a few
+    // disparities differ
+    size_t nPixels = 0, nSame = 0;
+    for (int r = 0; r < disparity.rows; ++r)
+    {
+        for (int c = 0; c < disparity.cols; ++c)
+        {
+            if (!roi.contains(cv::Point(c, r)))
+            {
+                EXPECT_EQ(-1.0f, roiDisparity.at<float>(r, c));
+                continue;
+            }
+
+            ++nPixels;
+            if (std::fabs(roiDisparity.at<float>(r, c) - disparity.at<float>(r, c)) < 0.5f)
+            {
+                ++nSame;
+            }
+        }
+    }
+
+    EXPECT_GT(nSame, nPixels * 95 / 100);
+}
+
+TEST(SemiGlobalMatcher, PyramidDepth)
+{
+    SyntheticStereoPair stereoPair(640, 480, 500.0, 0.12, 2);
+    stereoPair.minDepth() = 2.0;
+
+    cv::Mat imageL, imageR, depth, visible;
+    stereoPair.generate(imageL, imageR, depth, visible);
+
+    cv::Mat trueDisparity;
+    stereoPair.depthToDisparity(depth, trueDisparity);
+
+    SemiGlobalMatcher sgm;
+    sgm.disparityCount() = 16;
+    sgm.pyramidLevel() = 1;
+
+    cv::Mat disparity, confidence;
+    ASSERT_TRUE(sgm.match(imageL, imageR, disparity, confidence));
+    ASSERT_EQ(320, disparity.cols);
+    ASSERT_EQ(240, disparity.rows);
+
+    double density, badRatio;
+    evaluateDisparities(disparity, trueDisparity, visible, 1,
+                        sgm.disparityCount(), density, badRatio);
+
+    EXPECT_GT(density, 0.9);
+    EXPECT_LT(badRatio, 0.02);
+
+    cv::Mat depthEstimate;
+    sgm.computeDepth(disparity, confidence, stereoPair.cameraMatrix(),
+                     stereoPair.baseline(), depthEstimate, 0.0, 8.0);
+
+    // pixel (c, r) of the half resolution image is centered at
+    // (2c + 0.5, 2r + 0.5) of the full resolution image
+    Eigen::Matrix3d K = sgm.scaledCameraMatrix(stereoPair.cameraMatrix());
+    EXPECT_NEAR(stereoPair.cameraMatrix()(0,2), 2.0 * K(0,2) + 0.5, 1e-9);
+
+    size_t nDepths = 0, nAccurate = 0;
+    for (int r = 0; r < depthEstimate.rows; ++r)
+    {
+        for (int c = 0; c < depthEstimate.cols; ++c)
+        {
+            float z = depthEstimate.at<float>(r, c);
+            if (z == 0.0f)
+            {
+                continue;
+            }
+
+            EXPECT_LE(z, 8.0f);
+
+            ++nDepths;
+            if (std::fabs(z - depth.at<float>(2 * r, 2 * c)) < 0.1 * z)
+            {
+                ++nAccurate;
+            }
+        }
+    }
+
+    EXPECT_GT(nDepths, 0u);
+    EXPECT_GT(nAccurate, nDepths * 9 / 10);
+}
+
+TEST(StereoRectifier, RectifiedProjections)
+{
+    CameraSystemPtr cameraSystem = boost::make_shared<CameraSystem>(2);
+
+    CameraPtr camera1(new PinholeCamera("cam0", "stereo", 640, 480,
+                                        -0.2, 0.05, 0.001, -0.001,
+                                        400.0, 402.0, 318.0, 243.0));
+    CameraPtr camera2(new PinholeCamera("cam1", "stereo", 640, 480,
+                                        -0.18, 0.04, 0.0, 0.0,
+                                        405.0, 404.0, 322.0, 238.0));
+    cameraSystem->setCamera(0, camera1);
+    cameraSystem->setCamera(1, camera2);
+
+    // the second camera is to the right of the first, slightly rotated
+    Eigen::Matrix4d H_sys_cam2 = Eigen::Matrix4d::Identity();
+    H_sys_cam2.block<3,3>(0,0) = Eigen::AngleAxisd(0.03, Eigen::Vector3d(0.2, 1.0, 0.1).normalized()).toRotationMatrix();
+    H_sys_cam2.block<3,1>(0,3) << 0.12, 0.005, -0.01;
+    cameraSystem->setGlobalCameraPose(1, H_sys_cam2);
+
+    int cameraIdx1, cameraIdx2;
+    ASSERT_TRUE(StereoRectifier::findStereoPair(cameraSystem, cameraIdx1, cameraIdx2));
+
+    // the cameras are swapped as needed
+    StereoRectifier rectifier;
+    ASSERT_TRUE(rectifier.init(cameraSystem, cameraIdx2, cameraIdx1));
+    EXPECT_EQ(0, rectifier.cameraIdxL());
+    EXPECT_EQ(1, rectifier.cameraIdxR());
+    EXPECT_NEAR(H_sys_cam2.block<3,1>(0,3).norm(), rectifier.baseline(), 1e-9);
+
+    const Eigen::Matrix3d& K = rectifier.cameraMatrix();
+    double f = K(0,0);
+
+    // a scene point projects to the same row of both rectified images,
+    // with the disparity of its rectified depth
+    Eigen::Matrix4d H_cam2_sys = H_sys_cam2.inverse();
+    for (int i = 0; i < 10; ++i)
+    {
+        Eigen::Vector3d P(-1.0 + 0.2 * i, 0.5 - 0.1 * i, 2.0 + 0.5 * i);
+        Eigen::Vector3d P2 = H_cam2_sys.block<3,3>(0,0) * P + H_cam2_sys.block<3,1>(0,3);
+
+        Eigen::Vector3d pL = K * rectifier.R_rect_camL() * P;
+        Eigen::Vector3d pR = K * rectifier.R_rect_camR() * P2;
+        double z = pL(2);
+        pL /= pL(2);
+        pR /= pR(2);
+
+        EXPECT_NEAR(pL(1), pR(1), 1e-6);
+        EXPECT_NEAR(f * rectifier.baseline() / z, pL(0) - pR(0), 1e-6);
+    }
+
+    // each rectified pixel samples the original image where its ray
+    // projects
+    cv::Mat rampU(480, 640, CV_32F);
+    for (int r = 0; r < 480; ++r)
+    {
+        for (int c = 0; c < 640; ++c)
+        {
+            rampU.at<float>(r, c) = c;
+        }
+    }
+
+    cv::Mat rectUL, rectUR;
+    rectifier.rectify(rampU, rampU, rectUL, rectUR);
+
+    for (int r = 40; r < 480; r += 100)
+    {
+        for (int c = 40; c < 640; c += 100)
+        {
+            Eigen::Vector3d ray = rectifier.R_rect_camL().transpose() *
+                                  K.inverse() * Eigen::Vector3d(c, r, 1.0);
+
+            Eigen::Vector2d p;
+            camera1->spaceToPlane(ray, p);
+
+            EXPECT_NEAR(p(0), rectUL.at<float>(r, c), 1e-2);
+        }
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
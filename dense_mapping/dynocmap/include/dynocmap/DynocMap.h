@@ -8,8 +8,10 @@
 #include <pcl_ros/point_cloud.h>
 #include <sensor_models/SensorModel.h>
 #include <sensor_msgs/PointCloud2.h>
+#include <stdint.h>
 #include <string>
 
+#include "dynocmap/DynocMapSnapshot.h"
 #include "dynocmap/OccupancyTile.h"
 #include "dynocmap/OcTree.h"
 #include "dynocmap_msgs/DynocMap.h"
@@ -19,6 +21,7 @@ namespace px
 
 // forward declarations
 class OcTreeCache;
+class WorkerPool;
 
 class DynocMap
 {
@@ -48,8 +51,10 @@ public:
 
     void castRay(const geometry_msgs::Pose& sensorPose,
                  const Eigen::Vector3d& endpoint, Frame frame);
+    // see OcTree::castRays()
     void castRays(const Eigen::Matrix4d& sensorPose, const cv::Mat& depthImage,
-                  const Eigen::Matrix3d& cameraMatrix, bool usePyramid = true);
+                  const Eigen::Matrix3d& cameraMatrix, bool usePyramid = true,
+                  bool carveFreeSpace = false);
 
     void updateCell(const Eigen::Vector3d& pos, double prob);
     void updateCell(const Eigen::Vector3i& pos, double prob);
@@ -61,12 +66,25 @@ public:
 
     std::vector<OccupancyTile, Eigen::aligned_allocator<OccupancyTile> > tiles(void) const;
 
+    // number of threads that read and write the tiles of a map message
+    int& threadCount(void);
+    int threadCount(void) const;
+
     bool read(const boost::multi_array<char, 1>& data);
     bool write(boost::multi_array<char, 1>& data) const;
 
     bool read(const dynocmap_msgs::DynocMap& msg);
     bool write(dynocmap_msgs::DynocMap& msg, const std::string& frameId = "") const;
 
+    // Publishes a snapshot of the map for threads that read the map while
+    // it is updated, and returns it. Only the tiles that were updated since
+    // the previous snapshot are copied. Must be called from the thread
+    // that updates the map, e.g. after each frame.
+    DynocMapSnapshotPtr publishSnapshot(void);
+    // latest published snapshot, or a null pointer before the first one;
+    // may be called from any thread
+    DynocMapSnapshotPtr snapshot(void) const;
+
 private:
     int mapGridWidth(void) const;
     int tileGridWidth(void) const;
@@ -78,6 +96,12 @@ private:
     void addSliceUp(void);
     void addSliceDown(void);
 
+    // farthest distance from the sensor that a ray updates
+    double sensorReach(void) const;
+    // flags the tiles that intersect the box for the next snapshot
+    void markTilesModified(const Eigen::Vector3d& pMin,
+                           const Eigen::Vector3d& pMax);
+
     void fillEmptyTiles(void);
     void buildMapTree(void);
     void prefetch(void);
@@ -88,6 +112,10 @@ private:
     Eigen::Vector3i gridCoordsToTileCenter(const Eigen::Vector3i& p,
                                            bool addOffset) const;
 
+    void readTiles(const dynocmap_msgs::DynocMap& msg,
+                   int threadIdx, int threadCount,
+                   std::vector<int>& success);
+
     void loadTile(OcTreePtr& tile,
                   const Eigen::Vector3i& tileCenterGridCoords) const;
     void unloadTile(OcTreePtr& tile,
@@ -110,6 +138,18 @@ private:
     OcTreePtr m_mapTree;
 
     boost::shared_ptr<OcTreeCache> m_memoryCache;
+
+    int m_threadCount;
+    // reads and writes the tiles of map messages; shared by copies
+    boost::shared_ptr<WorkerPool> m_workerPool;
+
+    // whether each tile of the map grid was modified since the last
+    // snapshot, and its copy in the last snapshot
+    std::vector<char> m_tileModified;
+    std::vector<OcTreeConstPtr> m_snapshotTiles;
+    // only accessed atomically
+    DynocMapSnapshotPtr m_snapshot;
+    uint64_t m_snapshotEpoch;
 };
 
 typedef boost::shared_ptr<DynocMap> DynocMapPtr;
@@ -0,0 +1,76 @@
+#ifndef DYNOCMAPSNAPSHOT_H_
+#define DYNOCMAPSNAPSHOT_H_
+
+#include <boost/shared_ptr.hpp>
+#include <Eigen/Dense>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "dynocmap/OccupancyTile.h"
+#include "dynocmap/OcTree.h"
+#include "dynocmap_msgs/DynocMap.h"
+
+namespace px
+{
+
+class WorkerPool;
+
+// Immutable view of a DynocMap at the time DynocMap::publishSnapshot() was
+// called. A snapshot is never modified once it is published, so any number
+// of threads may read it without locking while the map is being updated.
+// Consecutive snapshots share the tiles that were not updated in between.
+class DynocMapSnapshot
+{
+public:
+    // incremented by each snapshot published by a map
+    uint64_t epoch(void) const;
+
+    double resolution(void) const;
+    Eigen::Vector3d center(void) const;
+    double mapWidth(void) const;
+    double tileWidth(void) const;
+
+    // leaf at pos, which is coarser than the map resolution in carved
+    // free space and where nothing was observed, or a null pointer if pos
+    // is outside the map
+    OcNodeConstPtr findNode(const Eigen::Vector3d& pos) const;
+
+    // tile trees ordered by slice, row and column from the lower corner of
+    // the map
+    const std::vector<OcTreeConstPtr>& tileTrees(void) const;
+
+    std::vector<OccupancyTile, Eigen::aligned_allocator<OccupancyTile> > tiles(void) const;
+
+    // tiles are written on the worker threads of the map as in
+    // DynocMap::write(), after any write of the map or of another snapshot
+    // that is already using them
+    bool write(dynocmap_msgs::DynocMap& msg, const std::string& frameId = "") const;
+
+private:
+    friend class DynocMap;
+
+    DynocMapSnapshot();
+
+    int mapGridWidth(void) const;
+    int tileGridWidth(void) const;
+
+    uint64_t m_epoch;
+
+    Eigen::Vector3i m_center;
+
+    double m_resolution;
+    int m_tileTreeHeight;
+    int m_mapTreeHeight;
+
+    std::vector<OcTreeConstPtr> m_tiles;
+
+    int m_threadCount;
+    boost::shared_ptr<WorkerPool> m_workerPool;
+};
+
+typedef boost::shared_ptr<const DynocMapSnapshot> DynocMapSnapshotPtr;
+
+}
+
+#endif
@@ -10,6 +10,7 @@ namespace px
 
 class OcNode;
 typedef boost::shared_ptr<OcNode> OcNodePtr;
+typedef boost::shared_ptr<const OcNode> OcNodeConstPtr;
 typedef boost::weak_ptr<OcNode> OcNodeWPtr;
 
 class OcNode: public boost::enable_shared_from_this<OcNode>
@@ -28,7 +29,11 @@ public:
 
     double getProbability(void) const;
 
+    // children start with the log-odds of the node
     void split(void);
+    // drops the children, which must not have been updated since the
+    // node was split
+    void collapse(void);
     bool isLeaf(void) const;
 
     std::vector<OcNodePtr>& children(void);
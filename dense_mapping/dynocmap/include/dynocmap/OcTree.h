@@ -18,6 +18,7 @@ namespace px
 
 class OcTree;
 typedef boost::shared_ptr<OcTree> OcTreePtr;
+typedef boost::shared_ptr<const OcTree> OcTreeConstPtr;
 
 class OcTree
 {
@@ -42,6 +43,14 @@ public:
     OcNodePtr findNode(double x, double y, double z, int maxDepth = -1);
     OcNodePtr findNode(const Eigen::Vector3d& pos, int maxDepth = -1);
     OcNodePtr findNode(const Eigen::Vector3i& pos, int maxDepth = -1);
+    OcNodeConstPtr findNode(const Eigen::Vector3d& pos, int maxDepth = -1) const;
+    OcNodeConstPtr findNode(const Eigen::Vector3i& pos, int maxDepth = -1) const;
+    // leaf at pos at any depth; above the bottom of the tree where free
+    // space was carved or nothing was observed
+    OcNodeConstPtr findLeaf(const Eigen::Vector3d& pos) const;
+
+    // deep copy of the nodes and parameters of the tree
+    OcTreePtr clone(void) const;
 
     size_t maximumLeafCount(void) const;
 
@@ -64,6 +73,10 @@ public:
     double& logOddsOccThresh(void);
     double logOddsOccThresh(void) const;
 
+    // leaf log-odds are quantized to 8 or 16 bits when the tree is written
+    int& logOddsBits(void);
+    int logOddsBits(void) const;
+
     void updateProb(OcNodePtr& node, double prob);
     void updateLogOdds(OcNodePtr& node, double logodds);
     void updateLogOdds(OcNode* node, double logodds);
@@ -72,9 +85,13 @@ public:
                  Frame frame, SensorModelPtr& sensorModel);
     void castRay(const Eigen::Matrix4d& sensorPose, const Eigen::Vector3d& endpoint,
                  Frame frame, SensorModelPtr& sensorModel);
+    // With carveFreeSpace, nodes that lie in front of the least depth seen
+    // through them are updated as free space as a whole, at the coarsest
+    // depth where they do, and rays are only traced through the rest of
+    // the frustum, which is mostly a shell around the measured surface.
     void castRays(const Eigen::Matrix4d& sensorPose, const cv::Mat& depthImage,
                   const Eigen::Matrix3d& cameraMatrix, SensorModelPtr& sensorModel,
-                  bool usePyramid = true);
+                  bool usePyramid = true, bool carveFreeSpace = false);
 
     bool read(const boost::multi_array<char, 1>& data);
     bool write(boost::multi_array<char, 1>& data) const;
@@ -94,10 +111,30 @@ private:
     int getFirstIntersectedNode(const Eigen::Vector3d& t0, const Eigen::Vector3d& tm) const;
     int getNextIntersectedNode(const Eigen::Vector3d& tm, int x, int y, int z);
 
+    // each level holds for each block of pixels the greatest depth, the
+    // least and greatest valid depths, and the least depth, which is 0 if
+    // a pixel has no depth
     std::vector<cv::Mat> buildDepthImagePyramid(const cv::Mat& depthImage) const;
 
+    class CarvingFrustum;
+
+    void carveFrustum(const Eigen::Matrix4d& sensorPose,
+                      const std::vector<cv::Mat>& pyramid,
+                      const Eigen::Matrix3d& cameraMatrix,
+                      SensorModelPtr& sensorModel);
+    bool carveNode(const OcNodePtr& node, const Eigen::Vector3i& nodeGridCoords,
+                   int depth, const CarvingFrustum& frustum,
+                   SensorModelPtr& sensorModel);
+
+    bool readLegacy(const boost::multi_array<char, 1>& data);
+    uint32_t writeNodes(std::vector<int8_t>& buffer, int logOddsBits,
+                        uint32_t& coarseLeafCount) const;
+    bool readNodes(const char* data, size_t size, int logOddsBits,
+                   size_t leafCount, size_t coarseLeafCount);
+
     void initBatchUpdate(void);
     void finalizeBatchUpdate(void);
+    void updateSubtreeLogOdds(OcNode* node, double logodds);
 
     class LabeledNode
     {
@@ -135,6 +172,31 @@ private:
         Eigen::Vector3i gridCoords;
     };
 
+    class CarvingFrustum
+    {
+    public:
+        CarvingFrustum(const Eigen::Matrix4d& sensorPose,
+                       const Eigen::Matrix3d& _cameraMatrix,
+                       const std::vector<cv::Mat>& _pyramid,
+                       double _maxRange, double _freeSpaceLogOdds)
+         : R_sensor_world(sensorPose.block<3,3>(0,0).transpose())
+         , origin(sensorPose.block<3,1>(0,3))
+         , cameraMatrix(_cameraMatrix)
+         , pyramid(_pyramid)
+         , maxRange(_maxRange)
+         , freeSpaceLogOdds(_freeSpaceLogOdds)
+        {
+
+        }
+
+        Eigen::Matrix3d R_sensor_world;
+        Eigen::Vector3d origin;
+        Eigen::Matrix3d cameraMatrix;
+        const std::vector<cv::Mat>& pyramid;
+        double maxRange;
+        double freeSpaceLogOdds;
+    };
+
     double m_resolution;
     int m_treeHeight;
 
@@ -145,6 +207,7 @@ private:
     double m_logOddsMax;
     double m_logOddsMin;
     double m_logOddsOccThresh;
+    int m_logOddsBits;
 
     bool m_batchUpdate;
 };
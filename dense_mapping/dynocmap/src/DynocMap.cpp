@@ -1,11 +1,16 @@
 #include "dynocmap/DynocMap.h"
 
+#include <boost/bind.hpp>
 #include <boost/filesystem.hpp>
+#include <algorithm>
 #include <cmath>
+#include <eigen_conversions/eigen_msg.h>
 #include <vector>
 
 #include "OcTreeCache.h"
 #include "OcUtils.h"
+#include "TileIO.h"
+#include "WorkerPool.h"
 
 namespace px
 {
@@ -16,6 +21,9 @@ DynocMap::DynocMap()
  , m_tileTreeHeight(0)
  , m_mapTreeHeight(0)
  , m_mapGridOffset(Eigen::Vector3i::Zero())
+ , m_threadCount(std::max(boost::thread::hardware_concurrency(), 1u))
+ , m_workerPool(boost::make_shared<WorkerPool>())
+ , m_snapshotEpoch(0)
 {
 
 }
@@ -28,6 +36,9 @@ DynocMap::DynocMap(double resolution, const SensorModelPtr& sensorModel,
  , m_sensorModel(sensorModel)
  , m_diskCacheDir(diskCacheDir)
  , m_mapGridOffset(Eigen::Vector3i::Zero())
+ , m_threadCount(std::max(boost::thread::hardware_concurrency(), 1u))
+ , m_workerPool(boost::make_shared<WorkerPool>())
+ , m_snapshotEpoch(0)
 {
     if (boost::filesystem::exists(diskCacheDir.c_str()) &&
         boost::filesystem::is_directory(diskCacheDir.c_str()))
@@ -181,6 +192,20 @@ void
 DynocMap::castRay(const geometry_msgs::Pose& sensorPose, const Eigen::Vector3d& endpoint,
                   Frame frame)
 {
+    Eigen::Quaterniond q;
+    tf::quaternionMsgToEigen(sensorPose.orientation, q);
+
+    Eigen::Vector3d o;
+    tf::pointMsgToEigen(sensorPose.position, o);
+
+    Eigen::Vector3d d = (frame == GLOBAL_FRAME) ? endpoint - o : q * endpoint;
+    if (d.norm() > 0.0)
+    {
+        Eigen::Vector3d p = o + d.normalized() * sensorReach();
+
+        markTilesModified(o.cwiseMin(p), o.cwiseMax(p));
+    }
+
     m_mapTree->castRay(sensorPose, endpoint, (OcTree::Frame)frame,
                        m_sensorModel);
 
@@ -293,15 +318,38 @@ DynocMap::castRay(const geometry_msgs::Pose& sensorPose, const Eigen::Vector3d&
 
 void
 DynocMap::castRays(const Eigen::Matrix4d& sensorPose, const cv::Mat& depthImage,
-                   const Eigen::Matrix3d& cameraMatrix, bool usePyramid)
+                   const Eigen::Matrix3d& cameraMatrix, bool usePyramid,
+                   bool carveFreeSpace)
 {
+    // a point within reach of the sensor is at most that deep, so the
+    // frustum of the image cut off at that depth holds all updated cells
+    Eigen::Matrix3d K_inv = cameraMatrix.inverse();
+    double reach = sensorReach();
+
+    Eigen::Vector3d o = sensorPose.block<3,1>(0,3);
+    Eigen::Vector3d pMin = o;
+    Eigen::Vector3d pMax = o;
+    for (int i = 0; i < 4; ++i)
+    {
+        Eigen::Vector3d ray = K_inv * Eigen::Vector3d((i & 1) * (depthImage.cols - 1),
+                                                      (i >> 1) * (depthImage.rows - 1),
+                                                      1.0);
+        Eigen::Vector3d p = sensorPose.block<3,3>(0,0) * ray * reach + o;
+
+        pMin = pMin.cwiseMin(p);
+        pMax = pMax.cwiseMax(p);
+    }
+    markTilesModified(pMin, pMax);
+
     m_mapTree->castRays(sensorPose, depthImage, cameraMatrix,
-                        m_sensorModel, usePyramid);
+                        m_sensorModel, usePyramid, carveFreeSpace);
 }
 
 void
 DynocMap::updateCell(const Eigen::Vector3d& pos, double prob)
 {
+    markTilesModified(pos, pos);
+
     OcNodePtr node = m_mapTree->findNode(pos);
 
     if (!node)
@@ -315,6 +363,9 @@ DynocMap::updateCell(const Eigen::Vector3d& pos, double prob)
 void
 DynocMap::updateCell(const Eigen::Vector3i& pos, double prob)
 {
+    Eigen::Vector3d p = gridCoordsToPoint(pos, m_resolution);
+    markTilesModified(p, p);
+
     OcNodePtr node = m_mapTree->findNode(pos);
 
     if (!node)
@@ -370,9 +421,23 @@ DynocMap::tiles(void) const
     return otiles;
 }
 
+int&
+DynocMap::threadCount(void)
+{
+    return m_threadCount;
+}
+
+int
+DynocMap::threadCount(void) const
+{
+    return m_threadCount;
+}
+
 bool
 DynocMap::read(const boost::multi_array<char, 1>& data)
 {
+    m_tileModified.assign(m_mapGrid.size(), 1);
+
     return m_mapTree->read(data);
 }
 
@@ -395,32 +460,33 @@ DynocMap::read(const dynocmap_msgs::DynocMap& msg)
     int width = mapGridWidth();
     int nTiles = width * width * width;
 
+    if (msg.tiles.size() != static_cast<size_t>(nTiles))
+    {
+        return false;
+    }
+
     m_mapGrid.clear();
     m_mapGrid.resize(nTiles);
 
-    for (int s = 0; s < width; ++s)
-    {
-        for (int r = 0; r < width; ++r)
-        {
-            for (int c = 0; c < width; ++c)
-            {
-                int index = s * width * width +
-                            r * width +
-                            c;
+    // tiles are independent of each other, and are built concurrently
+    int nThreads = std::max(std::min(m_threadCount, nTiles), 1);
+    std::vector<int> success(nThreads, 0);
 
-                m_mapGrid.at(index) = boost::make_shared<OcTree>();
-                m_mapGrid.at(index)->read(msg.tiles.at(index));
-            }
-        }
-    }
+    m_workerPool->run(boost::bind(&DynocMap::readTiles, this,
+                                  boost::cref(msg), _1, nThreads,
+                                  boost::ref(success)),
+                      nThreads);
 
     m_mapGridOffset.setZero();
 
     m_mapTree = boost::make_shared<OcTree>(m_center, m_mapGrid);
 
+    m_tileModified.assign(nTiles, 1);
+    m_snapshotTiles.clear();
+
     m_memoryCache.reset();
 
-    return true;
+    return std::find(success.begin(), success.end(), 0) == success.end();
 }
 
 bool
@@ -439,42 +505,80 @@ DynocMap::write(dynocmap_msgs::DynocMap& msg, const std::string& frameId) const
     int width = mapGridWidth();
     int nTiles = width * width * width;
 
+    // tiles keep the capacity of their data from the previous write when
+    // msg is reused, so that tiles are written in place
     msg.tiles.resize(nTiles);
 
+    // tile i of the message is a tile of the map grid, which is shifted
+    // by the map grid offset as in gridCoordsToTileCenter()
+    std::vector<OcTreeConstPtr> tiles(nTiles);
     for (int s = 0; s < width; ++s)
     {
-        int s_c = s - m_mapGridOffset(2);
-        while (s_c < 0)
-        {
-            s_c += width;
-        }
+        int s_g = (s + m_mapGridOffset(2)) % width;
 
         for (int r = 0; r < width; ++r)
         {
-            int r_c = r - m_mapGridOffset(1);
-            while (r_c < 0)
-            {
-                r_c += width;
-            }
+            int r_g = (r + m_mapGridOffset(1)) % width;
 
             for (int c = 0; c < width; ++c)
             {
-                int c_c = c - m_mapGridOffset(0);
-                while (c_c < 0)
-                {
-                    c_c += width;
-                }
+                int c_g = (c + m_mapGridOffset(0)) % width;
 
-                m_mapGrid.at(s_c * width * width +
-                             r_c * width +
-                             c_c)->write(msg.tiles.at(s * width * width +
-                                                      r * width +
-                                                      c));
+                tiles.at(s * width * width + r * width + c) =
+                    m_mapGrid.at(s_g * width * width + r_g * width + c_g);
             }
         }
     }
 
-    return true;
+    return writeTiles(*m_workerPool, m_threadCount, tiles, msg);
+}
+
+DynocMapSnapshotPtr
+DynocMap::publishSnapshot(void)
+{
+    int width = mapGridWidth();
+    int nTiles = width * width * width;
+
+    m_tileModified.resize(nTiles, 1);
+    m_snapshotTiles.resize(nTiles);
+
+    DynocMapSnapshot* snapshot = new DynocMapSnapshot;
+    snapshot->m_epoch = ++m_snapshotEpoch;
+    snapshot->m_center = m_center;
+    snapshot->m_resolution = m_resolution;
+    snapshot->m_tileTreeHeight = m_tileTreeHeight;
+    snapshot->m_mapTreeHeight = m_mapTreeHeight;
+    snapshot->m_tiles.resize(nTiles);
+    snapshot->m_threadCount = m_threadCount;
+    snapshot->m_workerPool = m_workerPool;
+
+    for (int i = 0; i < nTiles; ++i)
+    {
+        // tiles that were not modified are shared with the last snapshot
+        if (m_tileModified.at(i) || !m_snapshotTiles.at(i))
+        {
+            m_snapshotTiles.at(i) = m_mapGrid.at(i)->clone();
+            m_tileModified.at(i) = 0;
+        }
+
+        // the snapshot is not shifted by the map grid offset
+        int c = (i % width - m_mapGridOffset(0) + width) % width;
+        int r = ((i / width) % width - m_mapGridOffset(1) + width) % width;
+        int s = (i / (width * width) - m_mapGridOffset(2) + width) % width;
+
+        snapshot->m_tiles.at(s * width * width + r * width + c) = m_snapshotTiles.at(i);
+    }
+
+    DynocMapSnapshotPtr snapshotPtr(snapshot);
+    boost::atomic_store(&m_snapshot, snapshotPtr);
+
+    return snapshotPtr;
+}
+
+DynocMapSnapshotPtr
+DynocMap::snapshot(void) const
+{
+    return boost::atomic_load(&m_snapshot);
 }
 
 int
@@ -687,12 +791,78 @@ DynocMap::addSliceDown(void)
     m_center(2) -= tileGridWidth();
 }
 
+double
+DynocMap::sensorReach(void) const
+{
+    // the range that a ray is traced to beyond an obstacle grows with the
+    // depth of the obstacle
+    double validRange = m_sensorModel->validRange(Eigen::Vector3d(0.0, 0.0, m_sensorModel->maxRange()));
+
+    return std::max(m_sensorModel->maxRange(), validRange);
+}
+
+void
+DynocMap::markTilesModified(const Eigen::Vector3d& pMin,
+                            const Eigen::Vector3d& pMax)
+{
+    int width = mapGridWidth();
+
+    if (m_tileModified.empty())
+    {
+        return;
+    }
+    if (width == 1)
+    {
+        m_tileModified.at(0) = 1;
+        return;
+    }
+
+    // tile c spans [(c - width / 2) * tileGridWidth(),
+    // (c - width / 2 + 1) * tileGridWidth()) about the map center
+    Eigen::Vector3i gMin = pointToGridCoords(pMin, m_resolution) - m_center;
+    Eigen::Vector3i gMax = pointToGridCoords(pMax, m_resolution) - m_center;
+
+    Eigen::Vector3i tMin, tMax;
+    for (int i = 0; i < 3; ++i)
+    {
+        tMin(i) = static_cast<int>(floor(static_cast<double>(gMin(i)) / tileGridWidth())) + width / 2;
+        tMax(i) = static_cast<int>(floor(static_cast<double>(gMax(i)) / tileGridWidth())) + width / 2;
+
+        tMin(i) = std::max(tMin(i), 0);
+        tMax(i) = std::min(tMax(i), width - 1);
+
+        if (tMin(i) > tMax(i))
+        {
+            return;
+        }
+    }
+
+    for (int s = tMin(2); s <= tMax(2); ++s)
+    {
+        int s_g = (s + m_mapGridOffset(2)) % width;
+
+        for (int r = tMin(1); r <= tMax(1); ++r)
+        {
+            int r_g = (r + m_mapGridOffset(1)) % width;
+
+            for (int c = tMin(0); c <= tMax(0); ++c)
+            {
+                int c_g = (c + m_mapGridOffset(0)) % width;
+
+                m_tileModified.at(s_g * width * width + r_g * width + c_g) = 1;
+            }
+        }
+    }
+}
+
 void
 DynocMap::fillEmptyTiles(void)
 {
     int width = mapGridWidth();
     int nTiles = width * width * width;
 
+    m_tileModified.resize(nTiles, 1);
+
     for (int i = 0; i < nTiles; ++i)
     {
         if (m_mapGrid.at(i))
@@ -708,6 +878,8 @@ DynocMap::fillEmptyTiles(void)
         tileCenter = gridCoordsToTileCenter(Eigen::Vector3i(c, r, s), true);
 
         loadTile(m_mapGrid.at(i), tileCenter);
+
+        m_tileModified.at(i) = 1;
     }
 }
 
@@ -829,6 +1001,25 @@ DynocMap::gridCoordsToTileCenter(const Eigen::Vector3i& p,
     return tileCenter;
 }
 
+void
+DynocMap::readTiles(const dynocmap_msgs::DynocMap& msg,
+                    int threadIdx, int threadCount,
+                    std::vector<int>& success)
+{
+    success.at(threadIdx) = 1;
+
+    // tiles are interleaved between threads, as the tiles around the
+    // sensor have more nodes than the others
+    for (size_t i = threadIdx; i < m_mapGrid.size(); i += threadCount)
+    {
+        m_mapGrid.at(i) = boost::make_shared<OcTree>();
+        if (!m_mapGrid.at(i)->read(msg.tiles.at(i)))
+        {
+            success.at(threadIdx) = 0;
+        }
+    }
+}
+
 void
 DynocMap::loadTile(OcTreePtr& tile,
                    const Eigen::Vector3i& tileCenterGridCoords) const
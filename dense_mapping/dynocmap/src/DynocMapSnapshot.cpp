@@ -0,0 +1,143 @@
+#include "dynocmap/DynocMapSnapshot.h"
+
+#include <cmath>
+
+#include "OcUtils.h"
+#include "TileIO.h"
+#include "WorkerPool.h"
+
+namespace px
+{
+
+DynocMapSnapshot::DynocMapSnapshot()
+ : m_epoch(0)
+ , m_center(Eigen::Vector3i::Zero())
+ , m_resolution(0.0)
+ , m_tileTreeHeight(0)
+ , m_mapTreeHeight(0)
+ , m_threadCount(1)
+{
+
+}
+
+uint64_t
+DynocMapSnapshot::epoch(void) const
+{
+    return m_epoch;
+}
+
+double
+DynocMapSnapshot::resolution(void) const
+{
+    return m_resolution;
+}
+
+Eigen::Vector3d
+DynocMapSnapshot::center(void) const
+{
+    return m_center.cast<double>() * m_resolution;
+}
+
+double
+DynocMapSnapshot::mapWidth(void) const
+{
+    return mapGridWidth() * tileWidth();
+}
+
+double
+DynocMapSnapshot::tileWidth(void) const
+{
+    return tileGridWidth() * m_resolution;
+}
+
+OcNodeConstPtr
+DynocMapSnapshot::findNode(const Eigen::Vector3d& pos) const
+{
+    if (m_tiles.empty())
+    {
+        return OcNodeConstPtr();
+    }
+
+    int width = mapGridWidth();
+    if (width == 1)
+    {
+        return m_tiles.front()->findLeaf(pos);
+    }
+
+    // tile c spans [(c - width / 2) * tileGridWidth(),
+    // (c - width / 2 + 1) * tileGridWidth()) about the map center
+    Eigen::Vector3i coords = pointToGridCoords(pos, m_resolution) - m_center;
+
+    int tileIdx = 0;
+    for (int i = 2; i >= 0; --i)
+    {
+        int c = static_cast<int>(floor(static_cast<double>(coords(i)) / tileGridWidth())) + width / 2;
+        if (c < 0 || c >= width)
+        {
+            return OcNodeConstPtr();
+        }
+
+        tileIdx = tileIdx * width + c;
+    }
+
+    return m_tiles.at(tileIdx)->findLeaf(pos);
+}
+
+const std::vector<OcTreeConstPtr>&
+DynocMapSnapshot::tileTrees(void) const
+{
+    return m_tiles;
+}
+
+std::vector<OccupancyTile, Eigen::aligned_allocator<OccupancyTile> >
+DynocMapSnapshot::tiles(void) const
+{
+    std::vector<OccupancyTile, Eigen::aligned_allocator<OccupancyTile> > otiles(m_tiles.size());
+
+    for (size_t i = 0; i < m_tiles.size(); ++i)
+    {
+        const OcTreeConstPtr& src = m_tiles.at(i);
+
+        OccupancyTile& dst = otiles.at(i);
+
+        dst.resolution() = m_resolution;
+        dst.tileGridWidth() = src->gridWidth();
+        dst.tileGridCenter() = src->gridCenter();
+        dst.cells() = src->leafs();
+        dst.obstacles() = src->obstacles();
+    }
+
+    return otiles;
+}
+
+bool
+DynocMapSnapshot::write(dynocmap_msgs::DynocMap& msg, const std::string& frameId) const
+{
+    msg.header.stamp = ros::Time::now();
+    msg.header.frame_id = frameId;
+
+    msg.resolution = m_resolution;
+    msg.tile_tree_height = m_tileTreeHeight;
+    msg.map_tree_height = m_mapTreeHeight;
+    msg.center_grid_x = m_center(0);
+    msg.center_grid_y = m_center(1);
+    msg.center_grid_z = m_center(2);
+
+    msg.tiles.resize(m_tiles.size());
+
+    return writeTiles(*m_workerPool, m_threadCount, m_tiles, msg);
+}
+
+int
+DynocMapSnapshot::mapGridWidth(void) const
+{
+    return 1 << (m_mapTreeHeight - 1);
+}
+
+int
+DynocMapSnapshot::tileGridWidth(void) const
+{
+    return 1 << (m_tileTreeHeight - 1);
+}
+
+}
@@ -75,11 +75,25 @@ OcNode::split(void)
         for (int i = 0; i < 8; ++i)
         {
             m_child.at(i) = boost::make_shared<OcNode>(sharedPtr(), i);
+            m_child.at(i)->m_logOdds = m_logOdds;
         }
         m_leaf = false;
     }
 }
 
+void
+OcNode::collapse(void)
+{
+    if (!m_leaf)
+    {
+        for (int i = 0; i < 8; ++i)
+        {
+            m_child.at(i).reset();
+        }
+        m_leaf = true;
+    }
+}
+
 bool
 OcNode::isLeaf(void) const
 {
@@ -4,15 +4,290 @@
 #include <boost/make_shared.hpp>
 #include <cmath>
 #include <cstdio>
+#include <cstring>
 #include <eigen_conversions/eigen_msg.h>
+#include <limits>
 
 #include "OcUtils.h"
 
-const size_t kHeaderSize = sizeof(double) * 4 + sizeof(int) * 4;
-
 const double LOGODDS_MAX = 3.5;
 const double LOGODDS_MIN = -2.0;
 const double LOGODDS_OCC_THRESH = 1.5;
+const int LOGODDS_BITS = 8;
+
+namespace
+{
+
+// A tile starts with the magic, the format version and a marker of two
+// 0xff bytes. Read as the resolution that legacy tiles start with, these
+// 8 bytes are a NaN, so a legacy tile is never mistaken for a newer one.
+// The header then holds the tree parameters, the number of bits of the
+// quantized log-odds, the leaf count and, from version 3 on, the count of
+// the leafs above the bottom of the tree.
+const char kTileMagic[4] = {'D', 'M', 'T', 'L'};
+const uint16_t kTileFormatVersion = 3;
+const uint16_t kTileMarker = 0xffff;
+
+const size_t kHeaderSize = sizeof(kTileMagic) + sizeof(uint16_t) * 2 +
+                           sizeof(double) * 4 + sizeof(int32_t) * 4 +
+                           sizeof(uint8_t) * 4 + sizeof(uint32_t) * 2;
+
+// The tree structure is written as one bit per node, and the leafs at the
+// bottom of the tree in the same breadth-first order as runs, followed by
+// the leafs above the bottom, which hold carved free space. A run starts
+// with a varint holding its length shifted left by 2 and its kind in the
+// lower 2 bits. Only a literal run is followed by the quantized log-odds
+// of its leafs.
+enum LeafRunKind
+{
+    UNKNOWN_RUN = 0,
+    FREE_RUN = 1,
+    OCCUPIED_RUN = 2,
+    LITERAL_RUN = 3
+};
+
+int
+leafRunKind(double logOdds, double logOddsMin, double logOddsMax)
+{
+    if (logOdds == 0.0)
+    {
+        return UNKNOWN_RUN;
+    }
+    if (logOdds <= logOddsMin)
+    {
+        return FREE_RUN;
+    }
+    if (logOdds >= logOddsMax)
+    {
+        return OCCUPIED_RUN;
+    }
+
+    return LITERAL_RUN;
+}
+
+template<typename T>
+void
+appendValue(std::vector<int8_t>& buffer, const T& value)
+{
+    const int8_t* data = reinterpret_cast<const int8_t*>(&value);
+    buffer.insert(buffer.end(), data, data + sizeof(T));
+}
+
+template<typename T>
+bool
+readValue(const char*& p, const char* end, T& value)
+{
+    if (static_cast<size_t>(end - p) < sizeof(T))
+    {
+        return false;
+    }
+
+    memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+
+    return true;
+}
+
+void
+appendVarint(std::vector<int8_t>& buffer, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        buffer.push_back(static_cast<int8_t>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    buffer.push_back(static_cast<int8_t>(value));
+}
+
+bool
+readVarint(const char*& p, const char* end, uint64_t& value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7)
+    {
+        if (p == end)
+        {
+            return false;
+        }
+
+        uint64_t byte = static_cast<unsigned char>(*p);
+        ++p;
+
+        value |= (byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+double
+levelLogOdds(int level, double logOddsMin, double step)
+{
+    return logOddsMin + level * step;
+}
+
+void
+appendLeafRuns(std::vector<int8_t>& buffer, const std::vector<px::OcNode*>& leafs,
+               int logOddsBits, double logOddsMin, double logOddsMax,
+               double logOddsOccThresh)
+{
+    int maxLevel = (1 << logOddsBits) - 1;
+    double range = logOddsMax - logOddsMin;
+    double scale = (range > 0.0) ? maxLevel / range : 0.0;
+    double step = range / maxLevel;
+
+    size_t begin = 0;
+    while (begin < leafs.size())
+    {
+        int kind = leafRunKind(leafs.at(begin)->getLogOdds(), logOddsMin, logOddsMax);
+
+        size_t end = begin + 1;
+        while (end < leafs.size() &&
+               leafRunKind(leafs.at(end)->getLogOdds(), logOddsMin, logOddsMax) == kind)
+        {
+            ++end;
+        }
+
+        appendVarint(buffer, (static_cast<uint64_t>(end - begin) << 2) | kind);
+
+        if (kind == LITERAL_RUN)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                double logOdds = leafs.at(i)->getLogOdds();
+
+                int level = static_cast<int>(floor((logOdds - logOddsMin) * scale + 0.5));
+                level = std::min(std::max(level, 0), maxLevel);
+
+                // the nearest level may lie across the occupancy threshold,
+                // which would turn a leaf into an obstacle or back when the
+                // tile is read
+                bool occupied = logOdds > logOddsOccThresh;
+                while (!occupied && level > 0 &&
+                       levelLogOdds(level, logOddsMin, step) > logOddsOccThresh)
+                {
+                    --level;
+                }
+                while (occupied && level < maxLevel &&
+                       levelLogOdds(level, logOddsMin, step) <= logOddsOccThresh)
+                {
+                    ++level;
+                }
+
+                if (logOddsBits == 8)
+                {
+                    buffer.push_back(static_cast<int8_t>(level));
+                }
+                else
+                {
+                    appendValue(buffer, static_cast<uint16_t>(level));
+                }
+            }
+        }
+
+        begin = end;
+    }
+}
+
+bool
+readLeafRuns(const char*& p, const char* end, const std::vector<px::OcNode*>& leafs,
+             int logOddsBits, double logOddsMin, double logOddsMax)
+{
+    int maxLevel = (1 << logOddsBits) - 1;
+    double step = (logOddsMax - logOddsMin) / maxLevel;
+
+    size_t begin = 0;
+    while (begin < leafs.size())
+    {
+        uint64_t header;
+        if (!readVarint(p, end, header))
+        {
+            return false;
+        }
+
+        uint64_t runLength = header >> 2;
+        if (runLength == 0 || runLength > leafs.size() - begin)
+        {
+            return false;
+        }
+
+        size_t runEnd = begin + runLength;
+        switch (header & 0x3)
+        {
+        case UNKNOWN_RUN:
+            for (size_t i = begin; i < runEnd; ++i)
+            {
+                leafs.at(i)->setLogOdds(0.0);
+            }
+            break;
+        case FREE_RUN:
+            for (size_t i = begin; i < runEnd; ++i)
+            {
+                leafs.at(i)->setLogOdds(logOddsMin);
+            }
+            break;
+        case OCCUPIED_RUN:
+            for (size_t i = begin; i < runEnd; ++i)
+            {
+                leafs.at(i)->setLogOdds(logOddsMax);
+            }
+            break;
+        default:
+            if (static_cast<size_t>(end - p) < runLength * logOddsBits / 8)
+            {
+                return false;
+            }
+
+            for (size_t i = begin; i < runEnd; ++i)
+            {
+                int level;
+                if (logOddsBits == 8)
+                {
+                    level = static_cast<unsigned char>(*p);
+                    ++p;
+                }
+                else
+                {
+                    uint16_t value = 0;
+                    readValue(p, end, value);
+                    level = value;
+                }
+
+                leafs.at(i)->setLogOdds(levelLogOdds(level, logOddsMin, step));
+            }
+        }
+
+        begin = runEnd;
+    }
+
+    return true;
+}
+
+void
+copyNode(const px::OcNode& src, px::OcNode& dst)
+{
+    dst.setLogOdds(src.getLogOdds());
+
+    if (src.isLeaf())
+    {
+        return;
+    }
+
+    dst.split();
+    for (int i = 0; i < 8; ++i)
+    {
+        const px::OcNodePtr& child = src.child(i);
+        if (child)
+        {
+            copyNode(*child, *dst.child(i));
+        }
+    }
+}
+
+}
 
 namespace px
 {
@@ -24,6 +299,7 @@ OcTree::OcTree()
  , m_logOddsMax(LOGODDS_MAX)
  , m_logOddsMin(LOGODDS_MIN)
  , m_logOddsOccThresh(LOGODDS_OCC_THRESH)
+ , m_logOddsBits(LOGODDS_BITS)
  , m_batchUpdate(false)
 {
     m_center.setZero();
@@ -37,6 +313,7 @@ OcTree::OcTree(double resolution, int treeHeight,
  , m_logOddsMax(LOGODDS_MAX)
  , m_logOddsMin(LOGODDS_MIN)
  , m_logOddsOccThresh(LOGODDS_OCC_THRESH)
+ , m_logOddsBits(LOGODDS_BITS)
  , m_batchUpdate(false)
 {
     m_center = pointToGridCoords(center, m_resolution);
@@ -50,6 +327,7 @@ OcTree::OcTree(double resolution, int treeHeight,
  , m_logOddsMax(LOGODDS_MAX)
  , m_logOddsMin(LOGODDS_MIN)
  , m_logOddsOccThresh(LOGODDS_OCC_THRESH)
+ , m_logOddsBits(LOGODDS_BITS)
  , m_batchUpdate(false)
 {
     m_center = center;
@@ -61,6 +339,7 @@ OcTree::OcTree(const Eigen::Vector3i& center,
  , m_logOddsMax(LOGODDS_MAX)
  , m_logOddsMin(LOGODDS_MIN)
  , m_logOddsOccThresh(LOGODDS_OCC_THRESH)
+ , m_logOddsBits(subTrees.at(0)->logOddsBits())
  , m_batchUpdate(false)
 {
     int parentTreeHeight = static_cast<int>(log2(subTrees.size())) / 3 + 1;
@@ -238,6 +517,74 @@ OcTree::findNode(const Eigen::Vector3i& pos, int maxDepth)
     return node;
 }
 
+OcNodeConstPtr
+OcTree::findNode(const Eigen::Vector3d& pos, int maxDepth) const
+{
+    return const_cast<OcTree*>(this)->findNode(pos, maxDepth);
+}
+
+OcNodeConstPtr
+OcTree::findNode(const Eigen::Vector3i& pos, int maxDepth) const
+{
+    return const_cast<OcTree*>(this)->findNode(pos, maxDepth);
+}
+
+OcNodeConstPtr
+OcTree::findLeaf(const Eigen::Vector3d& pos) const
+{
+    Eigen::Vector3i coords = pointToGridCoords(pos, m_resolution) - m_center;
+
+    // check if (x,y,z) is outside boundaries of the octree
+    int halfWidth = gridWidth() / 2;
+    if (coords(0) < -halfWidth || coords(0) >= halfWidth ||
+        coords(1) < -halfWidth || coords(1) >= halfWidth ||
+        coords(2) < -halfWidth || coords(2) >= halfWidth)
+    {
+        return OcNodeConstPtr();
+    }
+
+    int halfOctantWidth = gridWidth() / 2;
+    Eigen::Vector3i nodeCoords = Eigen::Vector3i::Constant(-halfOctantWidth);
+
+    OcNodePtr node = m_root;
+    while (!node->isLeaf())
+    {
+        node = node->child(childIndex(coords,
+                                      nodeCoords + Eigen::Vector3i::Constant(halfOctantWidth)));
+
+        if (coords(0) >= nodeCoords(0) + halfOctantWidth)
+        {
+            nodeCoords(0) += halfOctantWidth;
+        }
+        if (coords(1) >= nodeCoords(1) + halfOctantWidth)
+        {
+            nodeCoords(1) += halfOctantWidth;
+        }
+        if (coords(2) >= nodeCoords(2) + halfOctantWidth)
+        {
+            nodeCoords(2) += halfOctantWidth;
+        }
+
+        halfOctantWidth /= 2;
+    }
+
+    return node;
+}
+
+OcTreePtr
+OcTree::clone(void) const
+{
+    OcTreePtr tree = boost::make_shared<OcTree>(m_resolution, m_treeHeight, m_center);
+    tree->m_logOddsMax = m_logOddsMax;
+    tree->m_logOddsMin = m_logOddsMin;
+    tree->m_logOddsOccThresh = m_logOddsOccThresh;
+    tree->m_logOddsBits = m_logOddsBits;
+
+    copyNode(*m_root, *tree->m_root);
+
+    return tree;
+}
+
 size_t
 OcTree::maximumLeafCount(void) const
 {
@@ -259,6 +606,8 @@ OcTree::leafs(void) const
     LabeledNode rootNode(m_root, Eigen::Vector3i::Constant(-halfOctantWidth) + m_center);
     queue.push_back(rootNode);
 
+    std::vector<OccupancyCell, Eigen::aligned_allocator<OccupancyCell> > cells;
+
     while (depth < m_treeHeight - 1 && !queue.empty())
     {
         std::vector<LabeledNode> nodes = queue;
@@ -292,14 +641,24 @@ OcTree::leafs(void) const
                     queue.push_back(newNode);
                 }
             }
+            else if (node.node->getLogOdds() != 0.0)
+            {
+                // carved free space above the bottom of the tree
+                OccupancyCell cell;
+                cell.coords = node.coords;
+                cell.width = halfOctantWidth * 2;
+                cell.occupancyLogOdds = node.node->getLogOdds();
+                cell.occupancyProb = node.node->getProbability();
+
+                cells.push_back(cell);
+            }
         }
 
         halfOctantWidth /= 2;
         ++depth;
     }
 
-    std::vector<OccupancyCell, Eigen::aligned_allocator<OccupancyCell> > cells;
-    cells.reserve(queue.size());
+    cells.reserve(cells.size() + queue.size());
 
     for (std::vector<LabeledNode>::iterator it = queue.begin();
          it != queue.end(); ++it)
@@ -465,6 +824,18 @@ OcTree::logOddsOccThresh(void) const
     return m_logOddsOccThresh;
 }
 
+int&
+OcTree::logOddsBits(void)
+{
+    return m_logOddsBits;
+}
+
+int
+OcTree::logOddsBits(void) const
+{
+    return m_logOddsBits;
+}
+
 void
 OcTree::updateProb(OcNodePtr& node, double prob)
 {
@@ -607,6 +978,12 @@ OcTree::castRay(const Eigen::Matrix4d& sensorPose, const Eigen::Vector3d& endpoi
                 continue;
             }
 
+            // the node was carved as a whole in this batch
+            if (m_batchUpdate && node->isUpdated())
+            {
+                continue;
+            }
+
             if (node->isLeaf())
             {
                 node->split();
@@ -755,7 +1132,7 @@ OcTree::castRay(const Eigen::Matrix4d& sensorPose, const Eigen::Vector3d& endpoi
 void
 OcTree::castRays(const Eigen::Matrix4d& sensorPose, const cv::Mat& depthImage,
                  const Eigen::Matrix3d& cameraMatrix, SensorModelPtr& sensorModel,
-                 bool usePyramid)
+                 bool usePyramid, bool carveFreeSpace)
 {
     double fx = cameraMatrix(0,0);
     double fy = cameraMatrix(1,1);
@@ -764,15 +1141,26 @@ OcTree::castRays(const Eigen::Matrix4d& sensorPose, const cv::Mat& depthImage,
 
     initBatchUpdate();
 
+    std::vector<cv::Mat> pyramid;
+    if (usePyramid || carveFreeSpace)
+    {
+        pyramid = buildDepthImagePyramid(depthImage);
+    }
+
+    // carved nodes are marked as updated, and are skipped by castRay()
+    if (carveFreeSpace)
+    {
+        carveFrustum(sensorPose, pyramid, cameraMatrix, sensorModel);
+    }
+
     if (usePyramid)
     {
-        std::vector<cv::Mat> pyramid = buildDepthImagePyramid(depthImage);
 
         std::vector<cv::Point2i> queue;
         queue.reserve(depthImage.rows * depthImage.cols);
         for (int r = 0; r < pyramid.back().rows; ++r)
         {
-            const cv::Vec3f* data = pyramid.back().ptr<cv::Vec3f>(r);
+            const cv::Vec4f* data = pyramid.back().ptr<cv::Vec4f>(r);
             for (int c = 0; c < pyramid.back().cols; ++c)
             {
                 if (data[c][0] < 1e-10)
@@ -798,7 +1186,7 @@ OcTree::castRays(const Eigen::Matrix4d& sensorPose, const cv::Mat& depthImage,
             for (std::vector<cv::Point2i>::iterator it = pixels.begin();
                  it != pixels.end(); ++it)
             {
-                cv::Vec3f pixel = image.at<cv::Vec3f>(it->y, it->x);
+                cv::Vec4f pixel = image.at<cv::Vec4f>(it->y, it->x);
                 float z = pixel[0];
 
                 if (z < 1e-10)
@@ -868,159 +1256,101 @@ OcTree::castRays(const Eigen::Matrix4d& sensorPose, const cv::Mat& depthImage,
 bool
 OcTree::read(const boost::multi_array<char, 1>& byteArray)
 {
-    m_root = boost::make_shared<OcNode>();
-
-    if (byteArray.size() <= kHeaderSize)
+    const char* p = byteArray.data();
+    const char* end = byteArray.data() + byteArray.size();
+
+    char magic[sizeof(kTileMagic)];
+    uint16_t version = 0;
+    uint16_t marker = 0;
+
+    if (!readValue(p, end, magic) ||
+        !readValue(p, end, version) ||
+        !readValue(p, end, marker) ||
+        memcmp(magic, kTileMagic, sizeof(kTileMagic)) != 0 ||
+        marker != kTileMarker)
     {
-        return false;
+        return readLegacy(byteArray);
     }
 
-    // read in header data
-    m_resolution = *(reinterpret_cast<const double *>(byteArray.data()));
-    m_treeHeight = *(reinterpret_cast<const int *>(byteArray.data() + sizeof(double)));
-
-    m_center(0) = *(reinterpret_cast<const int *>(byteArray.data() + sizeof(double) + sizeof(int)));
-    m_center(1) = *(reinterpret_cast<const int *>(byteArray.data() + sizeof(double) + sizeof(int) * 2));
-    m_center(2) = *(reinterpret_cast<const int *>(byteArray.data() + sizeof(double) + sizeof(int) * 3));
-
-    m_logOddsMax = *(reinterpret_cast<const double *>(byteArray.data() + sizeof(double) + sizeof(int) * 4));
-    m_logOddsMin = *(reinterpret_cast<const double *>(byteArray.data() + sizeof(double) * 2 + sizeof(int) * 4));
-    m_logOddsOccThresh = *(reinterpret_cast<const double *>(byteArray.data() + sizeof(double) * 3 + sizeof(int) * 4));
-
-    std::vector<OcNode*> queue;
-    queue.reserve(maximumLeafCount());
-
-    queue.push_back(m_root.get());
-
-    int depth = 0;
-    size_t mark = kHeaderSize;
-    int count = 0;
-
-    while (depth < m_treeHeight - 1 && !queue.empty())
+    // version 2 tiles do not store the leafs above the bottom of the tree
+    if (version != kTileFormatVersion && version != 2)
     {
-        std::vector<OcNode*> nodes;
-        nodes.swap(queue);
-
-        BOOST_FOREACH(OcNode* node, nodes)
-        {
-            if (((byteArray[mark] >> count) & 0x1) == 0x1)
-            {
-                node->split();
-
-                std::vector<OcNodePtr>& children = node->children();
-                for (std::vector<OcNodePtr>::iterator it = children.begin(); it != children.end(); ++it)
-                {
-                    queue.push_back(it->get());
-                }
-            }
-
-            ++count;
-            if (count == 8)
-            {
-                ++mark;
-                count = 0;
-            }
-        }
-
-        ++depth;
+        return false;
     }
 
-    if (count > 0)
+    int32_t treeHeight;
+    int32_t center[3];
+    uint8_t logOddsBits;
+    uint8_t reserved[3];
+    uint32_t leafCount;
+    uint32_t coarseLeafCount = 0;
+
+    if (!readValue(p, end, m_resolution) ||
+        !readValue(p, end, treeHeight) ||
+        !readValue(p, end, center) ||
+        !readValue(p, end, m_logOddsMax) ||
+        !readValue(p, end, m_logOddsMin) ||
+        !readValue(p, end, m_logOddsOccThresh) ||
+        !readValue(p, end, logOddsBits) ||
+        !readValue(p, end, reserved) ||
+        !readValue(p, end, leafCount) ||
+        (version > 2 && !readValue(p, end, coarseLeafCount)))
     {
-        ++mark;
-        count = 0;
+        return false;
     }
 
-    BOOST_FOREACH(OcNode* node, queue)
+    if (logOddsBits != 8 && logOddsBits != 16)
     {
-        double logodds;
-        memcpy(&logodds, &byteArray[mark], sizeof(double));
-        node->setLogOdds(logodds);
-
-        mark += sizeof(double);
+        return false;
     }
 
-    return true;
+    m_treeHeight = treeHeight;
+    m_center << center[0], center[1], center[2];
+    m_logOddsBits = logOddsBits;
+
+    return readNodes(p, end - p, logOddsBits, leafCount, coarseLeafCount);
 }
 
 bool
 OcTree::write(boost::multi_array<char, 1>& byteArray) const
 {
-    std::vector<char> buffer;
-    int depth = 0;
+    if (m_logOddsBits != 8 && m_logOddsBits != 16)
+    {
+        return false;
+    }
 
-    std::vector<OcNode*> queue;
-    queue.reserve(maximumLeafCount());
+    std::vector<int8_t> buffer;
+    buffer.reserve(kHeaderSize);
 
-    queue.push_back(m_root.get());
-
-    char data = 0;
-    int count = 0;
-
-    while (depth < m_treeHeight - 1)
-    {
-        std::vector<OcNode*> nodes;
-        nodes.swap(queue);
-
-        BOOST_FOREACH(OcNode* node, nodes)
-        {
-            if (!node->isLeaf())
-            {
-                data |= 1 << count;
-
-                std::vector<OcNodePtr>& children = node->children();
-                for (std::vector<OcNodePtr>::iterator it = children.begin(); it != children.end(); ++it)
-                {
-                    queue.push_back(it->get());
-                }
-            }
-
-            ++count;
-            if (count == 8)
-            {
-                buffer.push_back(data);
-                data = 0;
-                count = 0;
-            }
-        }
-
-        ++depth;
-    }
-
-    if (count > 0)
-    {
-        buffer.push_back(data);
-    }
-
-    BOOST_FOREACH(OcNode* node, queue)
-    {
-        double logodds = node->getLogOdds();
-
-        char data[8];
-        memcpy(&data[0], &logodds, sizeof(double));
-        buffer.insert(buffer.end(), data, data + 8);
-    }
-
-    byteArray.resize(boost::extents[kHeaderSize + buffer.size()]);
+    buffer.insert(buffer.end(), kTileMagic, kTileMagic + sizeof(kTileMagic));
+    appendValue(buffer, kTileFormatVersion);
+    appendValue(buffer, kTileMarker);
 
     // copy tree parameters
-    memcpy(byteArray.data(), reinterpret_cast<const char*>(&m_resolution),
-           sizeof(double));
-    memcpy(byteArray.data() + sizeof(double), &m_treeHeight, sizeof(int));
-    memcpy(byteArray.data() + sizeof(double) + sizeof(int),
-           reinterpret_cast<const char*>(&m_center(0)), sizeof(int));
-    memcpy(byteArray.data() + sizeof(double) + sizeof(int) * 2,
-           reinterpret_cast<const char*>(&m_center(1)), sizeof(int));
-    memcpy(byteArray.data() + sizeof(double) + sizeof(int) * 3,
-           reinterpret_cast<const char*>(&m_center(2)), sizeof(int));
-    memcpy(byteArray.data() + sizeof(double) + sizeof(int) * 4,
-           reinterpret_cast<const char*>(&m_logOddsMax), sizeof(double));
-    memcpy(byteArray.data() + sizeof(double) * 2 + sizeof(int) * 4,
-           reinterpret_cast<const char*>(&m_logOddsMin), sizeof(double));
-    memcpy(byteArray.data() + sizeof(double) * 3 + sizeof(int) * 4,
-           reinterpret_cast<const char*>(&m_logOddsOccThresh), sizeof(double));
-
-    std::copy(buffer.begin(), buffer.end(), byteArray.data() + kHeaderSize);
+    int32_t center[3] = {m_center(0), m_center(1), m_center(2)};
+    uint8_t reserved[3] = {0, 0, 0};
+
+    appendValue(buffer, m_resolution);
+    appendValue(buffer, static_cast<int32_t>(m_treeHeight));
+    appendValue(buffer, center);
+    appendValue(buffer, m_logOddsMax);
+    appendValue(buffer, m_logOddsMin);
+    appendValue(buffer, m_logOddsOccThresh);
+    appendValue(buffer, static_cast<uint8_t>(m_logOddsBits));
+    appendValue(buffer, reserved);
+
+    // the leaf counts are filled in once the nodes are written
+    size_t leafCountOffset = buffer.size();
+    appendValue(buffer, static_cast<uint32_t>(0));
+    appendValue(buffer, static_cast<uint32_t>(0));
+
+    uint32_t coarseLeafCount = 0;
+    uint32_t leafCount = writeNodes(buffer, m_logOddsBits, coarseLeafCount);
+    memcpy(&buffer[leafCountOffset], &leafCount, sizeof(uint32_t));
+    memcpy(&buffer[leafCountOffset + sizeof(uint32_t)], &coarseLeafCount, sizeof(uint32_t));
+
+    byteArray.resize(boost::extents[buffer.size()]);
+    std::copy(buffer.begin(), buffer.end(), byteArray.data());
 
     return true;
 }
@@ -1075,8 +1405,6 @@ OcTree::write(const std::string& filename) const
 bool
 OcTree::read(const dynocmap_msgs::DynocMapTile& msg)
 {
-    m_root = boost::make_shared<OcNode>();
-
     m_resolution = msg.resolution;
     m_treeHeight = msg.tree_height;
 
@@ -1088,25 +1416,105 @@ OcTree::read(const dynocmap_msgs::DynocMapTile& msg)
     m_logOddsMin = msg.log_odds_min;
     m_logOddsOccThresh = msg.log_odds_occ_thresh;
 
-    std::vector<OcNode*> queue;
-    queue.reserve(maximumLeafCount());
+    // tiles published before log-odds were quantized leave
+    // log_odds_bits at 0
+    if (msg.log_odds_bits != 0 &&
+        msg.log_odds_bits != 8 && msg.log_odds_bits != 16)
+    {
+        return false;
+    }
 
+    if (msg.log_odds_bits != 0)
+    {
+        m_logOddsBits = msg.log_odds_bits;
+    }
+
+    return readNodes(reinterpret_cast<const char*>(msg.data.data()),
+                     msg.data.size(), msg.log_odds_bits, msg.leaf_count,
+                     msg.coarse_leaf_count);
+}
+
+bool
+OcTree::write(dynocmap_msgs::DynocMapTile& msg) const
+{
+    if (m_logOddsBits != 8 && m_logOddsBits != 16)
+    {
+        return false;
+    }
+
+    msg.resolution = m_resolution;
+    msg.tree_height = m_treeHeight;
+    msg.center_grid_x = m_center(0);
+    msg.center_grid_y = m_center(1);
+    msg.center_grid_z = m_center(2);
+    msg.log_odds_max = m_logOddsMax;
+    msg.log_odds_min = m_logOddsMin;
+    msg.log_odds_occ_thresh = m_logOddsOccThresh;
+    msg.log_odds_bits = m_logOddsBits;
+
+    // the nodes are written straight into the message, whose data keeps
+    // its capacity when the message is reused
+    msg.data.clear();
+    msg.leaf_count = writeNodes(msg.data, m_logOddsBits, msg.coarse_leaf_count);
+
+    return true;
+}
+
+bool
+OcTree::readLegacy(const boost::multi_array<char, 1>& byteArray)
+{
+    const char* p = byteArray.data();
+    const char* end = byteArray.data() + byteArray.size();
+
+    int32_t center[3];
+
+    if (!readValue(p, end, m_resolution) ||
+        !readValue(p, end, m_treeHeight) ||
+        !readValue(p, end, center) ||
+        !readValue(p, end, m_logOddsMax) ||
+        !readValue(p, end, m_logOddsMin) ||
+        !readValue(p, end, m_logOddsOccThresh))
+    {
+        return false;
+    }
+
+    m_center << center[0], center[1], center[2];
+
+    return readNodes(p, end - p, 0, 0, 0);
+}
+
+uint32_t
+OcTree::writeNodes(std::vector<int8_t>& buffer, int logOddsBits,
+                   uint32_t& coarseLeafCount) const
+{
+    std::vector<OcNode*> queue;
     queue.push_back(m_root.get());
 
-    int depth = 0;
-    size_t mark = 0;
+    std::vector<OcNode*> coarseLeafs;
+
+    char data = 0;
     int count = 0;
 
-    while (depth < m_treeHeight - 1 && !queue.empty())
+    for (int depth = 0; depth < m_treeHeight - 1 && !queue.empty(); ++depth)
     {
+        size_t nSplitNodes = 0;
+        BOOST_FOREACH(OcNode* node, queue)
+        {
+            if (!node->isLeaf())
+            {
+                ++nSplitNodes;
+            }
+        }
+
         std::vector<OcNode*> nodes;
         nodes.swap(queue);
+        queue.reserve(nSplitNodes * 8);
 
         BOOST_FOREACH(OcNode* node, nodes)
         {
-            if (((msg.data.at(mark) >> count) & 0x1) == 0x1)
+            if (!node->isLeaf())
             {
-                node->split();
+                data |= 1 << count;
 
                 std::vector<OcNodePtr>& children = node->children();
                 for (std::vector<OcNodePtr>::iterator it = children.begin(); it != children.end(); ++it)
@@ -1114,70 +1522,75 @@ OcTree::read(const dynocmap_msgs::DynocMapTile& msg)
                     queue.push_back(it->get());
                 }
             }
+            else
+            {
+                coarseLeafs.push_back(node);
+            }
 
             ++count;
             if (count == 8)
             {
-                ++mark;
+                buffer.push_back(data);
+                data = 0;
                 count = 0;
             }
         }
-
-        ++depth;
     }
 
     if (count > 0)
     {
-        ++mark;
-        count = 0;
+        buffer.push_back(data);
     }
 
-    BOOST_FOREACH(OcNode* node, queue)
-    {
-        double logodds;
-        memcpy(&logodds, &msg.data.at(mark), sizeof(double));
-        node->setLogOdds(logodds);
+    appendLeafRuns(buffer, queue, logOddsBits, m_logOddsMin, m_logOddsMax,
+                   m_logOddsOccThresh);
+    appendLeafRuns(buffer, coarseLeafs, logOddsBits, m_logOddsMin, m_logOddsMax,
+                   m_logOddsOccThresh);
 
-        mark += sizeof(double);
-    }
+    coarseLeafCount = coarseLeafs.size();
 
-    return true;
+    return queue.size();
 }
 
 bool
-OcTree::write(dynocmap_msgs::DynocMapTile& msg) const
+OcTree::readNodes(const char* data, size_t size, int logOddsBits,
+                  size_t leafCount, size_t coarseLeafCount)
 {
-    msg.data.clear();
-
-    msg.resolution = m_resolution;
-    msg.tree_height = m_treeHeight;
-    msg.center_grid_x = m_center(0);
-    msg.center_grid_y = m_center(1);
-    msg.center_grid_z = m_center(2);
-    msg.log_odds_max = m_logOddsMax;
-    msg.log_odds_min = m_logOddsMin;
-    msg.log_odds_occ_thresh = m_logOddsOccThresh;
+    m_root = boost::make_shared<OcNode>();
 
-    int depth = 0;
+    const char* p = data;
+    const char* end = data + size;
 
     std::vector<OcNode*> queue;
-    queue.reserve(maximumLeafCount());
-
     queue.push_back(m_root.get());
 
-    char data = 0;
+    std::vector<OcNode*> coarseLeafs;
+
     int count = 0;
 
-    while (depth < m_treeHeight - 1 && !queue.empty())
+    for (int depth = 0; depth < m_treeHeight - 1 && !queue.empty(); ++depth)
     {
+        if (static_cast<size_t>(end - p) * 8 < count + queue.size())
+        {
+            return false;
+        }
+
+        // size the next level from the number of nodes that are split
+        size_t nSplitNodes = 0;
+        for (size_t i = count; i < count + queue.size(); ++i)
+        {
+            nSplitNodes += (p[i / 8] >> (i % 8)) & 0x1;
+        }
+
         std::vector<OcNode*> nodes;
         nodes.swap(queue);
+        queue.reserve(nSplitNodes * 8);
 
         BOOST_FOREACH(OcNode* node, nodes)
         {
-            if (!node->isLeaf())
+            if (((*p >> count) & 0x1) == 0x1)
             {
-                data |= 1 << count;
+                node->split();
 
                 std::vector<OcNodePtr>& children = node->children();
                 for (std::vector<OcNodePtr>::iterator it = children.begin(); it != children.end(); ++it)
@@ -1185,34 +1598,66 @@ OcTree::write(dynocmap_msgs::DynocMapTile& msg) const
                     queue.push_back(it->get());
                 }
             }
+            else
+            {
+                coarseLeafs.push_back(node);
+            }
 
             ++count;
             if (count == 8)
             {
-                msg.data.push_back(data);
-                data = 0;
+                ++p;
                 count = 0;
             }
         }
-
-        ++depth;
     }
 
     if (count > 0)
     {
-        msg.data.push_back(data);
+        ++p;
+        count = 0;
     }
 
-    BOOST_FOREACH(OcNode* node, queue)
+    if (logOddsBits == 0)
     {
-        double logodds = node->getLogOdds();
+        if (static_cast<size_t>(end - p) < queue.size() * sizeof(double))
+        {
+            return false;
+        }
+
+        BOOST_FOREACH(OcNode* node, queue)
+        {
+            double logodds;
+            readValue(p, end, logodds);
+            node->setLogOdds(logodds);
+        }
 
-        char data[8];
-        memcpy(&data[0], &logodds, sizeof(double));
-        msg.data.insert(msg.data.end(), data, data + 8);
+        return true;
     }
 
-    return true;
+    if (queue.size() != leafCount)
+    {
+        return false;
+    }
+
+    if (!readLeafRuns(p, end, queue, logOddsBits, m_logOddsMin, m_logOddsMax))
+    {
+        return false;
+    }
+
+    // tiles written before free space was carved do not store the leafs
+    // above the bottom of the tree, which are then unknown
+    if (coarseLeafCount == 0)
+    {
+        return true;
+    }
+
+    if (coarseLeafs.size() != coarseLeafCount)
+    {
+        return false;
+    }
+
+    return readLeafRuns(p, end, coarseLeafs, logOddsBits, m_logOddsMin, m_logOddsMax);
 }
 
 int
@@ -1320,16 +1765,17 @@ OcTree::buildDepthImagePyramid(const cv::Mat& depthImage) const
 {
     std::vector<cv::Mat> pyramid;
 
-    cv::Mat image(depthImage.rows, depthImage.cols, CV_32FC3);
+    cv::Mat image(depthImage.rows, depthImage.cols, CV_32FC4);
     for (int r = 0; r < depthImage.rows; ++r)
     {
         const float* src = depthImage.ptr<float>(r);
-        cv::Vec3f* dst = image.ptr<cv::Vec3f>(r);
+        cv::Vec4f* dst = image.ptr<cv::Vec4f>(r);
         for (int c = 0; c < depthImage.cols; ++c)
         {
             dst[c][0] = src[c];
             dst[c][1] = src[c];
             dst[c][2] = src[c];
+            dst[c][3] = src[c];
         }
     }
 
@@ -1338,14 +1784,14 @@ OcTree::buildDepthImagePyramid(const cv::Mat& depthImage) const
     while (pyramid.back().rows % 2 == 0 && pyramid.back().cols % 2 == 0)
     {
         const cv::Mat& prevImage = pyramid.back();
-        cv::Mat imageHalf(prevImage.rows / 2, prevImage.cols / 2, CV_32FC3);
+        cv::Mat imageHalf(prevImage.rows / 2, prevImage.cols / 2, CV_32FC4);
         int v = 0;
         for (int r = 0; r < prevImage.rows; r += 2)
         {
             int u = 0;
-            const cv::Vec3f* src0 = prevImage.ptr<cv::Vec3f>(r);
-            const cv::Vec3f* src1 = prevImage.ptr<cv::Vec3f>(r + 1);
-            cv::Vec3f* dst = imageHalf.ptr<cv::Vec3f>(v);
+            const cv::Vec4f* src0 = prevImage.ptr<cv::Vec4f>(r);
+            const cv::Vec4f* src1 = prevImage.ptr<cv::Vec4f>(r + 1);
+            cv::Vec4f* dst = imageHalf.ptr<cv::Vec4f>(v);
             for (int c = 0; c < prevImage.cols; c += 2)
             {
                 Eigen::Vector4f depth;
@@ -1380,8 +1826,11 @@ OcTree::buildDepthImagePyramid(const cv::Mat& depthImage) const
                 }
 
                 dst[u][0] = depth.maxCoeff();
-                dst[u][1] = *std::min_element(depthMinVec.begin(), depthMinVec.end());
-                dst[u][2] = *std::max_element(depthMaxVec.begin(), depthMaxVec.end());
+                dst[u][1] = depthMinVec.empty() ? 0.0f : *std::min_element(depthMinVec.begin(), depthMinVec.end());
+                dst[u][2] = depthMaxVec.empty() ? 0.0f : *std::max_element(depthMaxVec.begin(), depthMaxVec.end());
+                // 0 if any pixel of the block has no depth
+                dst[u][3] = std::min(std::min(src0[c][3], src0[c+1][3]),
+                                     std::min(src1[c][3], src1[c+1][3]));
 
                 ++u;
             }
@@ -1394,6 +1843,165 @@ OcTree::buildDepthImagePyramid(const cv::Mat& depthImage) const
     return pyramid;
 }
 
+void
+OcTree::carveFrustum(const Eigen::Matrix4d& sensorPose,
+                     const std::vector<cv::Mat>& pyramid,
+                     const Eigen::Matrix3d& cameraMatrix,
+                     SensorModelPtr& sensorModel)
+{
+    CarvingFrustum frustum(sensorPose, cameraMatrix, pyramid,
+                           sensorModel->maxRange(),
+                           sensorModel->freeSpaceLogOdds());
+
+    carveNode(m_root, Eigen::Vector3i::Constant(-gridWidth() / 2) + m_center,
+              0, frustum, sensorModel);
+}
+
+bool
+OcTree::carveNode(const OcNodePtr& node, const Eigen::Vector3i& nodeGridCoords,
+                  int depth, const CarvingFrustum& frustum,
+                  SensorModelPtr& sensorModel)
+{
+    int nodeGridWidth = gridWidth() >> depth;
+    double nodeWidth = nodeGridWidth * m_resolution;
+
+    Eigen::Vector3d cornerMin = gridCoordsToPoint(nodeGridCoords, m_resolution);
+    Eigen::Vector3d cornerMax = cornerMin + Eigen::Vector3d::Constant(nodeWidth);
+
+    // no ray reaches the node
+    Eigen::Vector3d closestPoint = frustum.origin.cwiseMax(cornerMin).cwiseMin(cornerMax);
+    if ((closestPoint - frustum.origin).norm() >= frustum.maxRange)
+    {
+        return false;
+    }
+
+    double zMin = std::numeric_limits<double>::max();
+    double zMax = -std::numeric_limits<double>::max();
+    double maxDistance = 0.0;
+    Eigen::Vector2d uvMin = Eigen::Vector2d::Constant(std::numeric_limits<double>::max());
+    Eigen::Vector2d uvMax = Eigen::Vector2d::Constant(-std::numeric_limits<double>::max());
+
+    for (int i = 0; i < 8; ++i)
+    {
+        Eigen::Vector3d corner((i & 0x4) ? cornerMax(0) : cornerMin(0),
+                               (i & 0x2) ? cornerMax(1) : cornerMin(1),
+                               (i & 0x1) ? cornerMax(2) : cornerMin(2));
+
+        Eigen::Vector3d p = frustum.R_sensor_world * (corner - frustum.origin);
+
+        zMin = std::min(zMin, p(2));
+        zMax = std::max(zMax, p(2));
+        maxDistance = std::max(maxDistance, p.norm());
+
+        if (p(2) > 0.0)
+        {
+            Eigen::Vector2d uv = (frustum.cameraMatrix * p).hnormalized();
+
+            uvMin = uvMin.cwiseMin(uv);
+            uvMax = uvMax.cwiseMax(uv);
+        }
+    }
+
+    if (zMax <= 0.0)
+    {
+        return false;
+    }
+
+    // a node that straddles the image plane is never carved as a whole
+    bool carve = false;
+    if (zMin > 0.0)
+    {
+        const cv::Mat& image = frustum.pyramid.front();
+
+        // pixels whose rays pass through the node
+        int c0 = std::max(static_cast<int>(ceil(uvMin(0))), 0);
+        int c1 = std::min(static_cast<int>(floor(uvMax(0))), image.cols - 1);
+        int r0 = std::max(static_cast<int>(ceil(uvMin(1))), 0);
+        int r1 = std::min(static_cast<int>(floor(uvMax(1))), image.rows - 1);
+
+        if (c0 > c1 || r0 > r1)
+        {
+            return false;
+        }
+
+        // the depths of the fewest blocks that cover the pixels
+        int level = 0;
+        while (level + 1 < static_cast<int>(frustum.pyramid.size()) &&
+               ((c1 >> level) - (c0 >> level) > 1 || (r1 >> level) - (r0 >> level) > 1))
+        {
+            ++level;
+        }
+
+        float depthMin = std::numeric_limits<float>::max();
+        float depthMax = 0.0f;
+        for (int r = r0 >> level; r <= (r1 >> level); ++r)
+        {
+            const cv::Vec4f* data = frustum.pyramid.at(level).ptr<cv::Vec4f>(r);
+            for (int c = c0 >> level; c <= (c1 >> level); ++c)
+            {
+                depthMin = std::min(depthMin, data[c][3]);
+                depthMax = std::max(depthMax, data[c][0]);
+            }
+        }
+
+        // the node and its children lie behind all measured surfaces
+        if (zMin >= depthMax)
+        {
+            return false;
+        }
+
+        // the whole node must be seen, and lie within range and in front
+        // of twice the distance from the surface at which the sensor model
+        // stops being free space
+        if (uvMin(0) >= 0.0 && uvMax(0) <= image.cols - 1 &&
+            uvMin(1) >= 0.0 && uvMax(1) <= image.rows - 1 &&
+            maxDistance < frustum.maxRange && depthMin > 0.0f)
+        {
+            double validRange = sensorModel->validRange(Eigen::Vector3d(0.0, 0.0, depthMin));
+            double margin = 2.0 * (validRange - depthMin);
+
+            carve = zMax < depthMin - margin;
+        }
+    }
+
+    if (carve)
+    {
+        node->setInterimLogOdds(frustum.freeSpaceLogOdds);
+        node->setUpdated(true);
+
+        return true;
+    }
+
+    if (depth == m_treeHeight - 1)
+    {
+        return false;
+    }
+
+    bool isLeaf = node->isLeaf();
+    if (isLeaf)
+    {
+        node->split();
+    }
+
+    bool carved = false;
+    for (int i = 0; i < 8; ++i)
+    {
+        if (carveNode(node->child(i), childCoords(nodeGridCoords, i, nodeGridWidth),
+                      depth + 1, frustum, sensorModel))
+        {
+            carved = true;
+        }
+    }
+
+    // leave the tree as it was where nothing was carved
+    if (isLeaf && !carved)
+    {
+        node->collapse();
+    }
+
+    return carved;
+}
+
 void
 OcTree::initBatchUpdate(void)
 {
@@ -1404,41 +2012,51 @@ void
 OcTree::finalizeBatchUpdate(void)
 {
     std::vector<OcNode*> queue;
-    queue.reserve(maximumLeafCount());
-
     queue.push_back(m_root.get());
 
-    for (int depth = 0; depth < m_treeHeight - 1; ++depth)
+    while (!queue.empty())
     {
         std::vector<OcNode*> nodes;
         nodes.swap(queue);
 
         BOOST_FOREACH(OcNode* node, nodes)
         {
-            if (node->isLeaf())
+            if (node->isUpdated())
             {
-                continue;
-            }
+                // a node above the bottom of the tree was carved, and
+                // rays did not enter it
+                updateSubtreeLogOdds(node, node->getInterimLogOdds());
 
-            std::vector<OcNodePtr>& children = node->children();
-            for (std::vector<OcNodePtr>::iterator it = children.begin(); it != children.end(); ++it)
+                node->setUpdated(false);
+            }
+            else if (!node->isLeaf())
             {
-                queue.push_back(it->get());
+                std::vector<OcNodePtr>& children = node->children();
+                for (std::vector<OcNodePtr>::iterator it = children.begin(); it != children.end(); ++it)
+                {
+                    queue.push_back(it->get());
+                }
             }
         }
     }
 
-    BOOST_FOREACH(OcNode* node, queue)
-    {
-        if (node->isUpdated())
-        {
-            updateLogOdds(node, node->getInterimLogOdds());
+    m_batchUpdate = false;
+}
 
-            node->setUpdated(false);
-        }
+void
+OcTree::updateSubtreeLogOdds(OcNode* node, double logodds)
+{
+    if (node->isLeaf())
+    {
+        updateLogOdds(node, logodds);
+        return;
     }
 
-    m_batchUpdate = false;
+    std::vector<OcNodePtr>& children = node->children();
+    for (std::vector<OcNodePtr>::iterator it = children.begin(); it != children.end(); ++it)
+    {
+        updateSubtreeLogOdds(it->get(), logodds);
+    }
 }
 
 }
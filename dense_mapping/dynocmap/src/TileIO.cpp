@@ -0,0 +1,50 @@
+#include "TileIO.h"
+
+#include <algorithm>
+#include <boost/bind.hpp>
+
+#include "WorkerPool.h"
+
+namespace px
+{
+
+namespace
+{
+
+void
+writeTileJob(const std::vector<OcTreeConstPtr>& tiles,
+             dynocmap_msgs::DynocMap& msg,
+             int threadIdx, int threadCount,
+             std::vector<int>& success)
+{
+    success.at(threadIdx) = 1;
+
+    for (size_t i = threadIdx; i < tiles.size(); i += threadCount)
+    {
+        if (!tiles.at(i)->write(msg.tiles.at(i)))
+        {
+            success.at(threadIdx) = 0;
+        }
+    }
+}
+
+}
+
+bool
+writeTiles(WorkerPool& workerPool, int threadCount,
+           const std::vector<OcTreeConstPtr>& tiles,
+           dynocmap_msgs::DynocMap& msg)
+{
+    int nTiles = tiles.size();
+    int nThreads = std::max(std::min(threadCount, nTiles), 1);
+    std::vector<int> success(nThreads, 0);
+
+    workerPool.run(boost::bind(&writeTileJob, boost::cref(tiles),
+                               boost::ref(msg), _1, nThreads,
+                               boost::ref(success)),
+                   nThreads);
+
+    return std::find(success.begin(), success.end(), 0) == success.end();
+}
+
+}
@@ -0,0 +1,24 @@
+#ifndef TILEIO_H
+#define TILEIO_H
+
+#include <vector>
+
+#include "dynocmap/OcTree.h"
+#include "dynocmap_msgs/DynocMap.h"
+
+namespace px
+{
+
+class WorkerPool;
+
+// Writes tiles.at(i) to msg.tiles.at(i) on up to threadCount threads of
+// the pool, and returns false if any tile could not be written. Tiles are
+// interleaved between threads, as the tiles around the sensor have more
+// nodes than the others. msg.tiles must already hold a tile per tree.
+bool writeTiles(WorkerPool& workerPool, int threadCount,
+                const std::vector<OcTreeConstPtr>& tiles,
+                dynocmap_msgs::DynocMap& msg);
+
+}
+
+#endif
@@ -0,0 +1,106 @@
+#include "WorkerPool.h"
+
+#include <boost/bind.hpp>
+
+namespace px
+{
+
+WorkerPool::WorkerPool()
+ : m_running(true)
+ , m_nJobs(0)
+ , m_nextJob(0)
+ , m_pendingJobs(0)
+{
+
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        boost::mutex::scoped_lock lock(m_jobMutex);
+        m_running = false;
+        m_jobCond.notify_all();
+    }
+
+    m_workers.join_all();
+}
+
+void
+WorkerPool::run(const boost::function<void (int)>& job, int nJobs)
+{
+    boost::mutex::scoped_lock runLock(m_runMutex);
+
+    boost::mutex::scoped_lock lock(m_jobMutex);
+
+    while (static_cast<int>(m_workers.size()) < nJobs - 1)
+    {
+        m_workers.create_thread(boost::bind(&WorkerPool::workerThread, this));
+    }
+
+    m_job = job;
+    m_nJobs = nJobs;
+    m_nextJob = 0;
+    m_pendingJobs = nJobs;
+    m_jobCond.notify_all();
+
+    // the calling thread takes jobs as well
+    runJobs(lock);
+
+    while (m_pendingJobs > 0)
+    {
+        m_doneCond.wait(lock);
+    }
+
+    m_job.clear();
+    m_nJobs = 0;
+    m_nextJob = 0;
+}
+
+int
+WorkerPool::workerCount(void) const
+{
+    boost::mutex::scoped_lock lock(m_jobMutex);
+
+    return m_workers.size();
+}
+
+void
+WorkerPool::workerThread(void)
+{
+    boost::mutex::scoped_lock lock(m_jobMutex);
+
+    while (true)
+    {
+        while (m_running && m_nextJob >= m_nJobs)
+        {
+            m_jobCond.wait(lock);
+        }
+
+        if (!m_running)
+        {
+            return;
+        }
+
+        runJobs(lock);
+    }
+}
+
+void
+WorkerPool::runJobs(boost::mutex::scoped_lock& lock)
+{
+    while (m_nextJob < m_nJobs)
+    {
+        int jobIdx = m_nextJob++;
+
+        lock.unlock();
+        m_job(jobIdx);
+        lock.lock();
+
+        if (--m_pendingJobs == 0)
+        {
+            m_doneCond.notify_all();
+        }
+    }
+}
+
+}
@@ -0,0 +1,48 @@
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <boost/function.hpp>
+#include <boost/thread.hpp>
+
+namespace px
+{
+
+// Worker threads that are kept across calls, so that splitting a map
+// message between threads does not spawn and join threads per message.
+class WorkerPool
+{
+public:
+    WorkerPool();
+    ~WorkerPool();
+
+    // Calls job(i) for each i in [0, nJobs) on the calling thread and up
+    // to nJobs - 1 workers, and returns once all calls have returned.
+    // Workers are started on demand and kept for later calls. Calls from
+    // several threads are run one after another.
+    void run(const boost::function<void (int)>& job, int nJobs);
+
+    int workerCount(void) const;
+
+private:
+    void workerThread(void);
+    // takes jobs until there are none left; expects lock to be held
+    void runJobs(boost::mutex::scoped_lock& lock);
+
+    boost::mutex m_runMutex;
+
+    mutable boost::mutex m_jobMutex;
+    boost::condition_variable m_jobCond;
+    boost::condition_variable m_doneCond;
+    bool m_running;
+
+    boost::function<void (int)> m_job;
+    int m_nJobs;
+    int m_nextJob;
+    int m_pendingJobs;
+
+    boost::thread_group m_workers;
+};
+
+}
+
+#endif
@@ -0,0 +1,174 @@
+#include <boost/make_shared.hpp>
+#include <boost/program_options.hpp>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <limits>
+#include <ros/time.h>
+#include <time.h>
+
+#include "dynocmap/DynocMap.h"
+#include "sensor_models/LaserSensorModel.h"
+
+// Fills a DynocMap with depth images of a box-shaped room seen from a
+// sensor that turns about the vertical axis, and reports the time taken
+// to write the map to a message and to read it back with an increasing
+// number of threads. The message is reused between writes, as a
+// publisher would.
+
+namespace
+{
+
+double
+monotonicTime(void)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// depth of the walls of a room that spans [-halfWidth, halfWidth] in x
+// and y and [-height / 2, height / 2] in z, as seen from its center
+cv::Mat
+roomDepthImage(const Eigen::Matrix3d& R_world_sensor,
+               const Eigen::Matrix3d& cameraMatrix,
+               int imageWidth, int imageHeight,
+               double halfWidth, double height)
+{
+    cv::Mat depthImage(imageHeight, imageWidth, CV_32F);
+
+    Eigen::Matrix3d K_inv = cameraMatrix.inverse();
+    Eigen::Vector3d halfExtent(halfWidth, halfWidth, height / 2.0);
+
+    for (int r = 0; r < imageHeight; ++r)
+    {
+        for (int c = 0; c < imageWidth; ++c)
+        {
+            Eigen::Vector3d ray = K_inv * Eigen::Vector3d(c, r, 1.0);
+            Eigen::Vector3d rayWorld = R_world_sensor * ray;
+
+            double s = std::numeric_limits<double>::max();
+            for (int i = 0; i < 3; ++i)
+            {
+                if (std::fabs(rayWorld(i)) > 1e-9)
+                {
+                    s = std::min(s, halfExtent(i) / std::fabs(rayWorld(i)));
+                }
+            }
+
+            depthImage.at<float>(r, c) = s * ray(2);
+        }
+    }
+
+    return depthImage;
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    double resolution;
+    double maxRange;
+    double roomWidth;
+    int frameCount;
+    int maxThreadCount;
+    int iterationCount;
+
+    boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("resolution", boost::program_options::value<double>(&resolution)->default_value(0.1), "Map resolution in meters.")
+        ("max-range", boost::program_options::value<double>(&maxRange)->default_value(5.0), "Maximum sensor range.")
+        ("room-width", boost::program_options::value<double>(&roomWidth)->default_value(8.0), "Width of the room.")
+        ("frames", boost::program_options::value<int>(&frameCount)->default_value(16), "Number of depth images integrated.")
+        ("max-threads", boost::program_options::value<int>(&maxThreadCount)->default_value(8), "Highest number of threads.")
+        ("iterations", boost::program_options::value<int>(&iterationCount)->default_value(10), "Number of writes and reads per thread count.")
+        ("carve", "Carve free space in the frustum of each depth image.")
+        ;
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    // DynocMap::write() stamps the message
+    ros::Time::init();
+
+    px::SensorModelPtr sensorModel = boost::make_shared<px::LaserSensorModel>(0.1, 0.9, maxRange, 0.02);
+    px::DynocMap map(resolution, sensorModel, "dynocmap_benchmark_cache");
+
+    int imageWidth = 160;
+    int imageHeight = 120;
+
+    Eigen::Matrix3d cameraMatrix;
+    cameraMatrix << 100.0, 0.0, 79.5,
+                    0.0, 100.0, 59.5,
+                    0.0, 0.0, 1.0;
+
+    // the optical axis of the sensor is horizontal
+    Eigen::Matrix3d R_body_sensor;
+    R_body_sensor << 0.0, 0.0, 1.0,
+                     -1.0, 0.0, 0.0,
+                     0.0, -1.0, 0.0;
+
+    double t = monotonicTime();
+    for (int i = 0; i < frameCount; ++i)
+    {
+        double yaw = 2.0 * M_PI * i / frameCount;
+
+        Eigen::Matrix4d sensorPose = Eigen::Matrix4d::Identity();
+        sensorPose.block<3,3>(0,0) = Eigen::AngleAxisd(yaw, Eigen::Vector3d::UnitZ()).toRotationMatrix() * R_body_sensor;
+
+        cv::Mat depthImage = roomDepthImage(sensorPose.block<3,3>(0,0), cameraMatrix,
+                                            imageWidth, imageHeight,
+                                            roomWidth / 2.0, 3.0);
+
+        map.castRays(sensorPose, depthImage, cameraMatrix, true, vm.count("carve"));
+    }
+    printf("integrated %d %dx%d depth images in %.1f ms\n",
+           frameCount, imageWidth, imageHeight, (monotonicTime() - t) * 1e3);
+
+    printf("  %-7s %10s %10s %12s\n", "threads", "write (ms)", "read (ms)", "size (kB)");
+
+    for (int threadCount = 1; threadCount <= maxThreadCount; threadCount *= 2)
+    {
+        map.threadCount() = threadCount;
+
+        px::DynocMap mapCopy;
+        mapCopy.threadCount() = threadCount;
+
+        dynocmap_msgs::DynocMap msg;
+
+        double writeTime = 0.0;
+        double readTime = 0.0;
+        for (int i = 0; i < iterationCount; ++i)
+        {
+            t = monotonicTime();
+            map.write(msg, "world");
+            writeTime += monotonicTime() - t;
+
+            t = monotonicTime();
+            mapCopy.read(msg);
+            readTime += monotonicTime() - t;
+        }
+
+        size_t size = 0;
+        for (size_t i = 0; i < msg.tiles.size(); ++i)
+        {
+            size += msg.tiles.at(i).data.size();
+        }
+
+        printf("  %-7d %10.2f %10.2f %12.1f\n", threadCount,
+               writeTime / iterationCount * 1e3,
+               readTime / iterationCount * 1e3,
+               size / 1024.0);
+    }
+
+    return 0;
+}
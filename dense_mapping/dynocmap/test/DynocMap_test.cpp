@@ -251,6 +251,183 @@ TEST(DynocMap, Recenter2)
     }
 }
 
+// Publish a snapshot of a map with one obstacle, and insert a second
+// obstacle. Check that the snapshot still holds one obstacle, and that the
+// next snapshot holds both and shares the tiles that were not updated.
+TEST(DynocMap, Snapshot)
+{
+    px::SensorModelPtr sensorModel(new px::LaserSensorModel(freeSpaceProbability,
+                                                            occSpaceProbability,
+                                                            maxSensorRange,
+                                                            sensorSigma));
+
+    px::DynocMap map(resolution, sensorModel, "mapcache");
+
+    ASSERT_FALSE(map.snapshot());
+
+    geometry_msgs::Pose cameraPose;
+    tf::quaternionEigenToMsg(Eigen::Quaterniond::Identity(), cameraPose.orientation);
+    tf::pointEigenToMsg(Eigen::Vector3d::Zero(), cameraPose.position);
+
+    Eigen::Vector3d pObstacle[2];
+    pObstacle[0] = Eigen::Vector3d(obstacleRange, 0.0, 0.0);
+    pObstacle[1] = Eigen::Vector3d(0.0, obstacleRange, 0.0);
+
+    map.castRay(cameraPose, pObstacle[0], px::DynocMap::SENSOR_FRAME);
+
+    px::DynocMapSnapshotPtr snapshot1 = map.publishSnapshot();
+    ASSERT_TRUE(snapshot1);
+    EXPECT_EQ(snapshot1, map.snapshot());
+
+    // nothing was updated since the first snapshot
+    px::DynocMapSnapshotPtr snapshot2 = map.publishSnapshot();
+    EXPECT_GT(snapshot2->epoch(), snapshot1->epoch());
+    for (size_t i = 0; i < snapshot1->tileTrees().size(); ++i)
+    {
+        EXPECT_EQ(snapshot1->tileTrees().at(i), snapshot2->tileTrees().at(i));
+    }
+
+    map.castRay(cameraPose, pObstacle[1], px::DynocMap::SENSOR_FRAME);
+
+    px::DynocMapSnapshotPtr snapshot3 = map.publishSnapshot();
+
+    int nObstacles[2] = {0, 0};
+    int nSharedTiles = 0;
+    for (size_t i = 0; i < snapshot1->tileTrees().size(); ++i)
+    {
+        nObstacles[0] += snapshot1->tileTrees().at(i)->obstacles().size();
+        nObstacles[1] += snapshot3->tileTrees().at(i)->obstacles().size();
+
+        if (snapshot1->tileTrees().at(i) == snapshot3->tileTrees().at(i))
+        {
+            ++nSharedTiles;
+        }
+    }
+
+    EXPECT_EQ(1, nObstacles[0]);
+    EXPECT_EQ(2, nObstacles[1]);
+    EXPECT_GT(nSharedTiles, 0);
+
+    EXPECT_FALSE(snapshot1->findNode(pObstacle[1]) &&
+                 snapshot1->findNode(pObstacle[1])->getLogOdds() > 0.0);
+    ASSERT_TRUE(snapshot3->findNode(pObstacle[1]));
+    EXPECT_GT(snapshot3->findNode(pObstacle[1])->getLogOdds(), 0.0);
+}
+
+// Recenter a map so that its tiles are shifted in the map grid, and check
+// that the map and a snapshot of it write the same tiles in the same order.
+TEST(DynocMap, SnapshotWriteOrder)
+{
+    px::SensorModelPtr sensorModel(new px::LaserSensorModel(freeSpaceProbability,
+                                                            occSpaceProbability,
+                                                            maxSensorRange,
+                                                            sensorSigma));
+
+    px::DynocMap map(resolution, sensorModel, "mapcache");
+
+    geometry_msgs::Pose cameraPose;
+    tf::quaternionEigenToMsg(Eigen::Quaterniond::Identity(), cameraPose.orientation);
+    tf::pointEigenToMsg(Eigen::Vector3d::Zero(), cameraPose.position);
+
+    map.castRay(cameraPose, Eigen::Vector3d(obstacleRange, 0.0, 0.0),
+                px::DynocMap::SENSOR_FRAME);
+
+    Eigen::Vector3d t(map.tileWidth(), -map.tileWidth(), map.tileWidth());
+    map.recenter(t);
+
+    tf::pointEigenToMsg(t, cameraPose.position);
+    map.castRay(cameraPose, Eigen::Vector3d(0.0, obstacleRange, 0.0),
+                px::DynocMap::SENSOR_FRAME);
+
+    px::DynocMapSnapshotPtr snapshot = map.publishSnapshot();
+
+    dynocmap_msgs::DynocMap msg[2];
+    ASSERT_TRUE(map.write(msg[0], "world"));
+    ASSERT_TRUE(snapshot->write(msg[1], "world"));
+
+    ASSERT_GE(snapshot->mapWidth(), 4.0 * map.tileWidth());
+    ASSERT_EQ(msg[0].tiles.size(), msg[1].tiles.size());
+    for (size_t i = 0; i < msg[0].tiles.size(); ++i)
+    {
+        const dynocmap_msgs::DynocMapTile& tile0 = msg[0].tiles.at(i);
+        const dynocmap_msgs::DynocMapTile& tile1 = msg[1].tiles.at(i);
+
+        EXPECT_EQ(tile0.center_grid_x, tile1.center_grid_x);
+        EXPECT_EQ(tile0.center_grid_y, tile1.center_grid_y);
+        EXPECT_EQ(tile0.center_grid_z, tile1.center_grid_z);
+        EXPECT_TRUE(tile0.data == tile1.data);
+    }
+
+    // tiles are ordered by slice, row and column from the lower corner
+    const dynocmap_msgs::DynocMapTile& first = msg[0].tiles.front();
+    const dynocmap_msgs::DynocMapTile& last = msg[0].tiles.back();
+    EXPECT_LT(first.center_grid_x, last.center_grid_x);
+    EXPECT_LT(first.center_grid_y, last.center_grid_y);
+    EXPECT_LT(first.center_grid_z, last.center_grid_z);
+}
+
+TEST(DynocMap, ThreadedIO)
+{
+    px::SensorModelPtr sensorModel(new px::LaserSensorModel(freeSpaceProbability,
+                                                            occSpaceProbability,
+                                                            maxSensorRange,
+                                                            sensorSigma));
+
+    px::DynocMap map(resolution, sensorModel, "mapcache");
+
+    geometry_msgs::Pose cameraPose;
+    tf::quaternionEigenToMsg(Eigen::Quaterniond::Identity(), cameraPose.orientation);
+    tf::pointEigenToMsg(Eigen::Vector3d::Zero(), cameraPose.position);
+
+    // obstacles in several tiles
+    for (int i = 0; i < 3; ++i)
+    {
+        Eigen::Vector3d p = Eigen::Vector3d::Zero();
+        p(i) = obstacleRange;
+
+        map.castRay(cameraPose, p, px::DynocMap::SENSOR_FRAME);
+        map.castRay(cameraPose, -p, px::DynocMap::SENSOR_FRAME);
+    }
+
+    // the tiles of a message do not depend on the number of threads
+    dynocmap_msgs::DynocMap msg[2];
+
+    map.threadCount() = 1;
+    ASSERT_TRUE(map.write(msg[0], "world"));
+
+    map.threadCount() = 4;
+    ASSERT_TRUE(map.write(msg[1], "world"));
+
+    ASSERT_EQ(msg[0].tiles.size(), msg[1].tiles.size());
+    for (size_t i = 0; i < msg[0].tiles.size(); ++i)
+    {
+        EXPECT_TRUE(msg[0].tiles.at(i).data == msg[1].tiles.at(i).data);
+    }
+
+    // and neither does a map read with several threads
+    px::DynocMap mapRead(resolution, sensorModel, "mapcache");
+    mapRead.threadCount() = 4;
+    ASSERT_TRUE(mapRead.read(msg[1]));
+
+    dynocmap_msgs::DynocMap msgRead;
+    ASSERT_TRUE(mapRead.write(msgRead, "world"));
+
+    ASSERT_EQ(msg[0].tiles.size(), msgRead.tiles.size());
+    for (size_t i = 0; i < msg[0].tiles.size(); ++i)
+    {
+        EXPECT_TRUE(msg[0].tiles.at(i).data == msgRead.tiles.at(i).data);
+    }
+
+    // a message with a missing tile is rejected
+    dynocmap_msgs::DynocMap msgMissing = msg[1];
+    msgMissing.tiles.pop_back();
+    EXPECT_FALSE(mapRead.read(msgMissing));
+
+    msgMissing = msg[1];
+    msgMissing.tiles.at(msgMissing.tiles.size() / 2).data.clear();
+    EXPECT_FALSE(mapRead.read(msgMissing));
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
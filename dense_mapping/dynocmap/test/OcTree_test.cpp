@@ -127,6 +127,245 @@ TEST(OcTree, IO)
     EXPECT_LE(fabsf(p(2) - nodePos[2]), octree.resolution() / 2.0);
 }
 
+// Test #7: write tree with quantized log-odds and read it back, ensuring
+// that log-odds are within half a quantization step, that unknown, free
+// and occupied leafs are exact, and that the tile is much smaller than
+// with a double per leaf
+TEST(OcTree, QuantizedIO)
+{
+    Eigen::Vector3d center = Eigen::Vector3d::Zero();
+
+    for (int logOddsBits = 8; logOddsBits <= 16; logOddsBits += 8)
+    {
+        px::OcTree octree(0.25, 6, center);
+        octree.logOddsBits() = logOddsBits;
+
+        for (int i = 0; i < 200; ++i)
+        {
+            px::OcNodePtr node = octree.insertNode(-3.9 + 0.035 * i, 0.015 * i - 1.5, 0.5 * sin(0.1 * i));
+            ASSERT_TRUE(node);
+
+            switch (i % 4)
+            {
+            case 0:
+                node->setLogOdds(octree.logOddsMin());
+                break;
+            case 1:
+                node->setLogOdds(octree.logOddsMax());
+                break;
+            case 2:
+                node->setLogOdds(octree.logOddsMin() + 0.0271 * i);
+                break;
+            default:
+                break;
+            }
+        }
+
+        // leafs just on either side of the occupancy threshold, whose
+        // nearest levels may lie on the other side
+        for (int i = 0; i < 40; ++i)
+        {
+            px::OcNodePtr node = octree.insertNode(3.9 - 0.035 * i, 1.5 - 0.015 * i, 0.5 * cos(0.1 * i));
+            ASSERT_TRUE(node);
+
+            double offset = 0.0005 * (i / 2 + 1);
+            node->setLogOdds(octree.logOddsOccThresh() + ((i % 2 == 0) ? offset : -offset));
+        }
+
+        std::vector<px::OccupancyCell, Eigen::aligned_allocator<px::OccupancyCell> > leafs = octree.leafs();
+        std::vector<px::OccupancyCell, Eigen::aligned_allocator<px::OccupancyCell> > obstacles = octree.obstacles();
+
+        boost::multi_array<char, 1> treeData;
+        ASSERT_TRUE(octree.write(treeData));
+
+        dynocmap_msgs::DynocMapTile msg;
+        ASSERT_TRUE(octree.write(msg));
+        EXPECT_EQ(leafs.size(), msg.leaf_count);
+
+        // a legacy tile takes at least a double per leaf
+        size_t legacySize = sizeof(double) * 4 + sizeof(int) * 4 +
+                            leafs.size() * sizeof(double);
+        EXPECT_LT(treeData.size() * 4, legacySize);
+
+        double step = (octree.logOddsMax() - octree.logOddsMin()) / ((1 << logOddsBits) - 1);
+
+        for (int j = 0; j < 2; ++j)
+        {
+            px::OcTree tree;
+            if (j == 0)
+            {
+                ASSERT_TRUE(tree.read(treeData));
+            }
+            else
+            {
+                ASSERT_TRUE(tree.read(msg));
+            }
+
+            EXPECT_EQ(logOddsBits, tree.logOddsBits());
+            EXPECT_EQ(octree.gridCenter(), tree.gridCenter());
+
+            std::vector<px::OccupancyCell, Eigen::aligned_allocator<px::OccupancyCell> > cells = tree.leafs();
+            ASSERT_EQ(leafs.size(), cells.size());
+
+            for (size_t i = 0; i < cells.size(); ++i)
+            {
+                EXPECT_EQ(leafs.at(i).coords, cells.at(i).coords);
+
+                double logOdds = leafs.at(i).occupancyLogOdds;
+                if (logOdds == 0.0 || logOdds == octree.logOddsMin() ||
+                    logOdds == octree.logOddsMax())
+                {
+                    EXPECT_EQ(logOdds, cells.at(i).occupancyLogOdds);
+                }
+                else if (fabs(logOdds - octree.logOddsOccThresh()) < step)
+                {
+                    // moved to the level on the same side of the threshold
+                    EXPECT_NEAR(logOdds, cells.at(i).occupancyLogOdds, step + 1e-6);
+                }
+                else
+                {
+                    EXPECT_NEAR(logOdds, cells.at(i).occupancyLogOdds, step / 2.0 + 1e-6);
+                }
+            }
+
+            std::vector<px::OccupancyCell, Eigen::aligned_allocator<px::OccupancyCell> > tileObstacles = tree.obstacles();
+            ASSERT_EQ(obstacles.size(), tileObstacles.size());
+
+            for (size_t i = 0; i < tileObstacles.size(); ++i)
+            {
+                EXPECT_EQ(obstacles.at(i).coords, tileObstacles.at(i).coords);
+            }
+        }
+
+        // a truncated tile is rejected
+        boost::multi_array<char, 1> truncatedData(boost::extents[treeData.size() - 1]);
+        std::copy(treeData.data(), treeData.data() + truncatedData.size(), truncatedData.data());
+
+        px::OcTree tree;
+        EXPECT_FALSE(tree.read(truncatedData));
+    }
+}
+
+// Test #8: read a tile in the legacy format, with a double per leaf
+TEST(OcTree, LegacyIO)
+{
+    double resolution = 0.25;
+    int treeHeight = 2;
+    int center[3] = {4, -8, 12};
+    double logOddsParams[3] = {3.5, -2.0, 1.5};
+
+    std::vector<char> buffer;
+    buffer.insert(buffer.end(), reinterpret_cast<char*>(&resolution),
+                  reinterpret_cast<char*>(&resolution) + sizeof(double));
+    buffer.insert(buffer.end(), reinterpret_cast<char*>(&treeHeight),
+                  reinterpret_cast<char*>(&treeHeight) + sizeof(int));
+    buffer.insert(buffer.end(), reinterpret_cast<char*>(center),
+                  reinterpret_cast<char*>(center) + sizeof(int) * 3);
+    buffer.insert(buffer.end(), reinterpret_cast<char*>(logOddsParams),
+                  reinterpret_cast<char*>(logOddsParams) + sizeof(double) * 3);
+
+    // the root is split into 8 leafs
+    buffer.push_back(0x1);
+    for (int i = 0; i < 8; ++i)
+    {
+        double logOdds = 0.3 * i - 1.0;
+        buffer.insert(buffer.end(), reinterpret_cast<char*>(&logOdds),
+                      reinterpret_cast<char*>(&logOdds) + sizeof(double));
+    }
+
+    boost::multi_array<char, 1> treeData(boost::extents[buffer.size()]);
+    std::copy(buffer.begin(), buffer.end(), treeData.data());
+
+    px::OcTree octree;
+    ASSERT_TRUE(octree.read(treeData));
+
+    EXPECT_EQ(resolution, octree.resolution());
+    EXPECT_EQ(treeHeight, octree.treeHeight());
+    EXPECT_EQ(Eigen::Vector3i(4, -8, 12), octree.gridCenter());
+
+    std::vector<px::OccupancyCell, Eigen::aligned_allocator<px::OccupancyCell> > cells = octree.leafs();
+    ASSERT_EQ(8, cells.size());
+    for (int i = 0; i < 8; ++i)
+    {
+        EXPECT_FLOAT_EQ(0.3 * i - 1.0, cells.at(i).occupancyLogOdds);
+    }
+}
+
+// Test #9: carve free space in front of a wall seen in a depth image,
+// ensuring that the wall and the free space in front of it match those
+// of a tree in which every pixel is traced, with fewer leafs, and that
+// the carved leafs above the bottom of the tree are written and read
+TEST(OcTree, CarveFreeSpace)
+{
+    Eigen::Vector3d center = Eigen::Vector3d::Zero();
+
+    px::SensorModelPtr sensorModel(new px::LaserSensorModel(0.1,
+                                                            0.9,
+                                                            10.0,
+                                                            0.02));
+
+    Eigen::Matrix3d cameraMatrix;
+    cameraMatrix << 50.0, 0.0, 31.5,
+                    0.0, 50.0, 23.5,
+                    0.0, 0.0, 1.0;
+
+    // the sensor looks along the x axis at a wall 4 m away
+    Eigen::Matrix4d sensorPose = Eigen::Matrix4d::Identity();
+    sensorPose.block<3,3>(0,0) << 0.0, 0.0, 1.0,
+                                  -1.0, 0.0, 0.0,
+                                  0.0, -1.0, 0.0;
+    sensorPose.block<3,1>(0,3) << 0.05, 0.05, 0.05;
+
+    cv::Mat depthImage(48, 64, CV_32F, cv::Scalar(4.0));
+
+    px::OcTree octree(0.1, 8, center);
+    octree.castRays(sensorPose, depthImage, cameraMatrix, sensorModel, true, false);
+
+    px::OcTree carvedOctree(0.1, 8, center);
+    carvedOctree.castRays(sensorPose, depthImage, cameraMatrix, sensorModel, true, true);
+
+    std::vector<px::OccupancyCell> obstacles = octree.obstacles();
+    std::vector<px::OccupancyCell> carvedObstacles = carvedOctree.obstacles();
+    ASSERT_FALSE(obstacles.empty());
+    ASSERT_EQ(obstacles.size(), carvedObstacles.size());
+    for (size_t i = 0; i < obstacles.size(); ++i)
+    {
+        EXPECT_EQ(obstacles.at(i).coords, carvedObstacles.at(i).coords);
+    }
+
+    for (int i = 0; i < 30; ++i)
+    {
+        Eigen::Vector3d p(0.5 + 0.1 * i, 0.04 * (i % 7) - 0.12, 0.03 * (i % 5) - 0.06);
+
+        px::OcNodeConstPtr node = octree.findLeaf(p);
+        ASSERT_TRUE(node);
+        EXPECT_LT(node->getLogOdds(), 0.0);
+
+        px::OcNodeConstPtr carvedNode = carvedOctree.findLeaf(p);
+        ASSERT_TRUE(carvedNode);
+        EXPECT_FLOAT_EQ(std::max(sensorModel->freeSpaceLogOdds(), carvedOctree.logOddsMin()),
+                        carvedNode->getLogOdds());
+    }
+
+    std::vector<px::OccupancyCell, Eigen::aligned_allocator<px::OccupancyCell> > leafs = carvedOctree.leafs();
+    EXPECT_LT(leafs.size(), octree.leafs().size());
+
+    dynocmap_msgs::DynocMapTile msg;
+    ASSERT_TRUE(carvedOctree.write(msg));
+    EXPECT_GT(msg.coarse_leaf_count, 0);
+
+    px::OcTree tree;
+    ASSERT_TRUE(tree.read(msg));
+
+    std::vector<px::OccupancyCell, Eigen::aligned_allocator<px::OccupancyCell> > cells = tree.leafs();
+    ASSERT_EQ(leafs.size(), cells.size());
+    for (size_t i = 0; i < cells.size(); ++i)
+    {
+        EXPECT_EQ(leafs.at(i).coords, cells.at(i).coords);
+        EXPECT_EQ(leafs.at(i).width, cells.at(i).width);
+    }
+}
+
 int main(int argc, char **argv)
 {
     ::testing::InitGoogleTest(&argc, argv);
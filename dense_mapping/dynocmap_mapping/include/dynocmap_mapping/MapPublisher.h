@@ -0,0 +1,95 @@
+#ifndef MAPPUBLISHER_H_
+#define MAPPUBLISHER_H_
+
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <ros/ros.h>
+
+#include "dynocmap/DynocMap.h"
+#include "dynocmap_msgs/DynocMap.h"
+
+namespace px
+{
+
+// Writes and publishes the latest snapshot of the map on its own thread, so
+// that serializing the map does not delay the integration of the next
+// frame. Snapshots published while a message is being written are
+// coalesced into the next message.
+class MapPublisher
+{
+public:
+    MapPublisher(const DynocMapPtr& map, const ros::Publisher& mapPub)
+     : m_map(map)
+     , m_mapPub(mapPub)
+     , m_pending(false)
+     , m_stop(false)
+    {
+        m_thread = boost::thread(boost::bind(&MapPublisher::run, this));
+    }
+
+    ~MapPublisher()
+    {
+        {
+            boost::lock_guard<boost::mutex> lock(m_mutex);
+            m_stop = true;
+            m_cond.notify_one();
+        }
+
+        m_thread.join();
+    }
+
+    // called by the mapping thread after DynocMap::publishSnapshot()
+    void notify(void)
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+        m_pending = true;
+        m_cond.notify_one();
+    }
+
+private:
+    void run(void)
+    {
+        dynocmap_msgs::DynocMap msg;
+        while (true)
+        {
+            {
+                boost::unique_lock<boost::mutex> lock(m_mutex);
+                while (!m_pending && !m_stop)
+                {
+                    m_cond.wait(lock);
+                }
+
+                if (m_stop)
+                {
+                    return;
+                }
+
+                m_pending = false;
+            }
+
+            DynocMapSnapshotPtr snapshot = m_map->snapshot();
+            if (!snapshot)
+            {
+                continue;
+            }
+
+            snapshot->write(msg, "world");
+
+            m_mapPub.publish(msg);
+        }
+    }
+
+    DynocMapPtr m_map;
+    ros::Publisher m_mapPub;
+
+    boost::mutex m_mutex;
+    boost::condition_variable m_cond;
+    bool m_pending;
+    bool m_stop;
+
+    boost::thread m_thread;
+};
+
+}
+
+#endif
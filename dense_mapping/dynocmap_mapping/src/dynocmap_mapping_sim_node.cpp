@@ -9,6 +9,7 @@
 #include <tf/transform_listener.h>
 
 #include "dynocmap/DynocMap.h"
+#include "dynocmap_mapping/MapPublisher.h"
 #include "dynocmap_msgs/DynocMap.h"
 #include "sensor_models/LaserSensorModel.h"
 
@@ -30,7 +31,7 @@ void callback(const geometry_msgs::PoseStamped::ConstPtr& poseMsg,
               px::DynocMapPtr& map,
               const Eigen::Matrix3d& cameraMatrix,
               const Eigen::Matrix4d& H_sensor_body,
-              ros::Publisher& mapPub)
+              px::MapPublisher& mapPublisher)
 {
     float rangeThresh = k_maxRange - 1e-2;
 
@@ -65,10 +66,8 @@ void callback(const geometry_msgs::PoseStamped::ConstPtr& poseMsg,
 
     map->castRays(H_sensor_world, depthImage, cameraMatrix, true);
 
-    dynocmap_msgs::DynocMap msg;
-    map->write(msg, "world");
-
-    mapPub.publish(msg);
+    map->publishSnapshot();
+    mapPublisher.notify();
 }
 
 int main(int argc, char** argv)
@@ -142,12 +141,13 @@ int main(int argc, char** argv)
     Eigen::Matrix4d H_sensor_body = e.matrix().inverse();
 
     ros::Publisher mapPub = nh.advertise<dynocmap_msgs::DynocMap>("map", 1);
+    px::MapPublisher mapPublisher(map, mapPub);
 
     message_filters::Subscriber<sensor_msgs::PointCloud2> cloudSub(nh, "/vrep/rgbd/cloud", 1);
     message_filters::Subscriber<geometry_msgs::PoseStamped> poseSub(nh, "/vrep/pose", 1);
 
     message_filters::TimeSynchronizer<geometry_msgs::PoseStamped, sensor_msgs::PointCloud2> sync(poseSub, cloudSub, 10);
-    sync.registerCallback(boost::bind(&callback, _1, _2, boost::ref(map), boost::cref(cameraMatrix), boost::cref(H_sensor_body), boost::ref(mapPub)));
+    sync.registerCallback(boost::bind(&callback, _1, _2, boost::ref(map), boost::cref(cameraMatrix), boost::cref(H_sensor_body), boost::ref(mapPublisher)));
 
     ROS_INFO("Initialized!");
 
@@ -0,0 +1,176 @@
+#include <boost/program_options.hpp>
+#include <cv_bridge/cv_bridge.h>
+#include <eigen_conversions/eigen_msg.h>
+#include <geometry_msgs/PoseStamped.h>
+#include <message_filters/subscriber.h>
+#include <message_filters/time_synchronizer.h>
+#include <ros/ros.h>
+#include <sensor_msgs/Image.h>
+
+#include "camera_systems/CameraSystem.h"
+#include "dense_stereo/SemiGlobalMatcher.h"
+#include "dense_stereo/StereoRectifier.h"
+#include "dynocmap/DynocMap.h"
+#include "dynocmap_mapping/MapPublisher.h"
+#include "dynocmap_msgs/DynocMap.h"
+#include "sensor_models/StereoSensorModel.h"
+
+// Integrates the depth of a calibrated stereo pair into a DynocMap: the
+// images of both cameras are rectified, matched by semi-global matching
+// and cast into the map at the pose of the camera system.
+
+void callback(const geometry_msgs::PoseStamped::ConstPtr& poseMsg,
+              const sensor_msgs::ImageConstPtr& imageMsgL,
+              const sensor_msgs::ImageConstPtr& imageMsgR,
+              px::DynocMapPtr& map,
+              const px::StereoRectifier& rectifier,
+              px::SemiGlobalMatcher& sgm,
+              double minConfidence, double maxRange,
+              px::MapPublisher& mapPublisher)
+{
+    cv::Mat imageL, imageR;
+    try
+    {
+        imageL = cv_bridge::toCvShare(imageMsgL, "mono8")->image;
+        imageR = cv_bridge::toCvShare(imageMsgR, "mono8")->image;
+    }
+    catch (cv_bridge::Exception& e)
+    {
+        ROS_ERROR("cv_bridge exception: %s", e.what());
+        return;
+    }
+
+    cv::Mat rectImageL, rectImageR;
+    rectifier.rectify(imageL, imageR, rectImageL, rectImageR);
+
+    cv::Mat disparity, confidence;
+    if (!sgm.match(rectImageL, rectImageR, disparity, confidence))
+    {
+        ROS_WARN("Failed to match stereo images with timestamp %f.",
+                 imageMsgL->header.stamp.toSec());
+        return;
+    }
+
+    cv::Mat depthImage;
+    sgm.computeDepth(disparity, confidence,
+                     rectifier.cameraMatrix(), rectifier.baseline(),
+                     depthImage, minConfidence, maxRange);
+
+    Eigen::Affine3d H_world_sys;
+    tf::poseMsgToEigen(poseMsg->pose, H_world_sys);
+
+    map->recenter(H_world_sys.translation());
+
+    Eigen::Matrix4d H_world_rect = H_world_sys.matrix() * rectifier.H_sys_rect();
+
+    map->castRays(H_world_rect, depthImage,
+                  sgm.scaledCameraMatrix(rectifier.cameraMatrix()), true);
+
+    map->publishSnapshot();
+    mapPublisher.notify();
+}
+
+int main(int argc, char** argv)
+{
+    std::string calibDir;
+    std::string cameraNs1, cameraNs2;
+    std::string poseTopic;
+    double resolution;
+    double maxRange;
+    int disparityCount;
+    int pyramidLevel;
+    double minConfidence;
+
+    boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("calib,c", boost::program_options::value<std::string>(&calibDir)->default_value("calib"), "Directory containing camera system calibration.")
+        ("camera_ns_1", boost::program_options::value<std::string>(&cameraNs1), "Namespace of the first camera of the stereo pair; defaults to its name.")
+        ("camera_ns_2", boost::program_options::value<std::string>(&cameraNs2), "Namespace of the second camera of the stereo pair; defaults to its name.")
+        ("pose", boost::program_options::value<std::string>(&poseTopic)->default_value("pose"), "Topic of the camera system pose in the world frame.")
+        ("resolution", boost::program_options::value<double>(&resolution)->default_value(0.1), "Map resolution in meters.")
+        ("max-range", boost::program_options::value<double>(&maxRange)->default_value(10.0), "Maximum depth integrated into the map.")
+        ("disparities", boost::program_options::value<int>(&disparityCount)->default_value(64), "Number of disparities at full resolution.")
+        ("level", boost::program_options::value<int>(&pyramidLevel)->default_value(1), "Pyramid level to match at.")
+        ("min-confidence", boost::program_options::value<double>(&minConfidence)->default_value(0.1), "Minimum confidence of an integrated disparity.")
+        ;
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    ros::init(argc, argv, "dynocmap_mapping_stereo");
+
+    px::CameraSystemPtr cameraSystem = boost::make_shared<px::CameraSystem>();
+    if (!cameraSystem->readFromDirectory(calibDir))
+    {
+        ROS_ERROR("Unable to read calibration data from %s", calibDir.c_str());
+        return 1;
+    }
+
+    int cameraIdx1, cameraIdx2;
+    if (!px::StereoRectifier::findStereoPair(cameraSystem, cameraIdx1, cameraIdx2))
+    {
+        ROS_ERROR("Camera system has no stereo pair.");
+        return 1;
+    }
+
+    px::StereoRectifier rectifier;
+    if (!rectifier.init(cameraSystem, cameraIdx1, cameraIdx2))
+    {
+        ROS_ERROR("Unable to rectify cameras %d and %d.", cameraIdx1, cameraIdx2);
+        return 1;
+    }
+
+    if (cameraNs1.empty())
+    {
+        cameraNs1 = cameraSystem->getCamera(cameraIdx1)->cameraName();
+    }
+    if (cameraNs2.empty())
+    {
+        cameraNs2 = cameraSystem->getCamera(cameraIdx2)->cameraName();
+    }
+
+    // the rectifier orders the cameras from left to right
+    std::string cameraNsL = (rectifier.cameraIdxL() == cameraIdx1) ? cameraNs1 : cameraNs2;
+    std::string cameraNsR = (rectifier.cameraIdxL() == cameraIdx1) ? cameraNs2 : cameraNs1;
+
+    px::SemiGlobalMatcher sgm;
+    sgm.pyramidLevel() = pyramidLevel;
+    sgm.disparityCount() = std::max(1, disparityCount >> pyramidLevel);
+
+    double focalLength = sgm.scaledCameraMatrix(rectifier.cameraMatrix())(0,0);
+
+    ROS_INFO("Matching %s and %s with a baseline of %.3f m and a focal length of %.1f px.",
+             cameraNsL.c_str(), cameraNsR.c_str(), rectifier.baseline(), focalLength);
+
+    px::SensorModelPtr sensorModel = boost::make_shared<px::StereoSensorModel>(0.5, rectifier.baseline(), focalLength,
+                                                                               0.5, 0.3, maxRange);
+    px::DynocMapPtr map = boost::make_shared<px::DynocMap>(resolution, sensorModel, "mapcache");
+
+    ros::NodeHandle nh;
+
+    ros::Publisher mapPub = nh.advertise<dynocmap_msgs::DynocMap>("map", 1);
+    px::MapPublisher mapPublisher(map, mapPub);
+
+    message_filters::Subscriber<geometry_msgs::PoseStamped> poseSub(nh, poseTopic, 1);
+    message_filters::Subscriber<sensor_msgs::Image> imageSubL(nh, cameraNsL + "/image_raw", 1);
+    message_filters::Subscriber<sensor_msgs::Image> imageSubR(nh, cameraNsR + "/image_raw", 1);
+
+    message_filters::TimeSynchronizer<geometry_msgs::PoseStamped, sensor_msgs::Image, sensor_msgs::Image> sync(poseSub, imageSubL, imageSubR, 10);
+    sync.registerCallback(boost::bind(&callback, _1, _2, _3, boost::ref(map),
+                                      boost::cref(rectifier), boost::ref(sgm),
+                                      minConfidence, maxRange, boost::ref(mapPublisher)));
+
+    ROS_INFO("Initialized!");
+
+    ros::spin();
+
+    return 0;
+}
@@ -64,6 +64,10 @@ public:
         m_pObstacle = pObstacle;
     }
 
+    // validRange() as it would be after setObstacle(pObstacle), without
+    // changing the model
+    virtual double validRange(const Eigen::Vector3d& pObstacle) const = 0;
+
     virtual double freeSpaceLogOdds(void) const = 0;
     virtual double getLikelihood(double r) const = 0;
     virtual double getLikelihood(double r1, double r2) const = 0;
@@ -20,6 +20,8 @@ public:
     double focalLength(void) const;
 
     void setObstacle(const Eigen::Vector3d& pObstacle);
+    double validRange(const Eigen::Vector3d& pObstacle) const;
+    using SensorModel::validRange;
 
     double freeSpaceLogOdds(void) const;
     double getLikelihood(double r) const;
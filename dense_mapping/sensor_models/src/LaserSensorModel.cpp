@@ -26,7 +26,13 @@ LaserSensorModel::setObstacle(const Eigen::Vector3d& pObstacle)
     m_r_p = pObstacle.norm();
 
     m_pObstacle = pObstacle;
-    m_validRange = m_pObstacle.norm() + 2.0 * m_sigma;
+    m_validRange = validRange(pObstacle);
+}
+
+double
+LaserSensorModel::validRange(const Eigen::Vector3d& pObstacle) const
+{
+    return pObstacle.norm() + 2.0 * m_sigma;
 }
 
 double
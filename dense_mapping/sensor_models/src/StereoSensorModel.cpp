@@ -53,11 +53,17 @@ StereoSensorModel::setObstacle(const Eigen::Vector3d& pObstacle)
 
     m_pObstacle = pObstacle;
 
-    double delta_r_p = square(m_pObstacle(2)) * m_disparityError / (m_baseline * m_focalLength);
+    m_validRange = validRange(pObstacle);
+}
+
+double
+StereoSensorModel::validRange(const Eigen::Vector3d& pObstacle) const
+{
+    double delta_r_p = square(pObstacle(2)) * m_disparityError / (m_baseline * m_focalLength);
     double a = m_k * (1.0 - m_unknownSpaceProbability) * exp(-delta_r_p);
     double c = sqrt(log(1.0 + a / (a + 2.0 * (m_unknownSpaceProbability - m_freeSpaceProbability))) / log(2.0)) * delta_r_p;
 
-    m_validRange = m_pObstacle.norm() + sqrt(-2.0 * square(c) * log(0.01 / a));
+    return pObstacle.norm() + sqrt(-2.0 * square(c) * log(0.01 / a));
 }
 
 double
@@ -0,0 +1,305 @@
+#include "ReplayFrameSource.h"
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/thread.hpp>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace px
+{
+
+namespace
+{
+
+double
+wallTime(void)
+{
+    static const boost::posix_time::ptime k_epoch(boost::gregorian::date(1970, 1, 1));
+
+    return (boost::posix_time::microsec_clock::universal_time() - k_epoch).total_microseconds() * 1e-6;
+}
+
+}
+
+ReplayFrameSource::ReplayFrameSource(bool realtime)
+ : k_realtime(realtime)
+ , m_loop(false)
+ , m_nextFrame(0)
+ , m_frame(0)
+ , m_startTime(0.0)
+ , m_frameTimeOffset(0.0)
+{
+
+}
+
+bool
+ReplayFrameSource::load(const std::string& filename)
+{
+    std::ifstream ifs(filename.c_str());
+    if (!ifs.is_open())
+    {
+        std::cerr << "# ERROR: Cannot open Vicon recording " << filename << "." << std::endl;
+        return false;
+    }
+
+    return read(ifs);
+}
+
+bool
+ReplayFrameSource::read(std::istream& is)
+{
+    std::string line;
+    int lineNo = 0;
+    while (std::getline(is, line))
+    {
+        ++lineNo;
+
+        if (line.empty() || line.at(0) == '#')
+        {
+            continue;
+        }
+
+        std::istringstream iss(line);
+
+        std::string tag;
+        Frame frame;
+        int nSubjects;
+        iss >> tag >> frame.frameNumber >> frame.receiveTime
+            >> frame.latency >> nSubjects;
+        if (!iss || tag != "frame" || nSubjects < 0)
+        {
+            std::cerr << "# ERROR: Malformed frame header at line "
+                      << lineNo << "." << std::endl;
+            return false;
+        }
+
+        frame.subjects.resize(nSubjects);
+        for (int i = 0; i < nSubjects; ++i)
+        {
+            ++lineNo;
+
+            if (!std::getline(is, line))
+            {
+                std::cerr << "# ERROR: Recording ends within frame "
+                          << frame.frameNumber << "." << std::endl;
+                return false;
+            }
+
+            std::istringstream subjectIss(line);
+
+            SubjectPose& subject = frame.subjects.at(i);
+            subjectIss >> subject.subjectName >> subject.segmentName >> subject.occluded
+                       >> subject.translation[0] >> subject.translation[1] >> subject.translation[2]
+                       >> subject.rotation[0] >> subject.rotation[1]
+                       >> subject.rotation[2] >> subject.rotation[3];
+            if (!subjectIss)
+            {
+                std::cerr << "# ERROR: Malformed subject pose at line "
+                          << lineNo << "." << std::endl;
+                return false;
+            }
+        }
+
+        addFrame(frame);
+    }
+
+    return true;
+}
+
+void
+ReplayFrameSource::addFrame(const Frame& frame)
+{
+    // m_frame points into m_frames
+    size_t currentFrame = m_frame ? m_frame - &m_frames[0] : 0;
+
+    m_frames.push_back(frame);
+
+    if (m_frame)
+    {
+        m_frame = &m_frames.at(currentFrame);
+    }
+}
+
+size_t
+ReplayFrameSource::frameCount(void) const
+{
+    return m_frames.size();
+}
+
+bool
+ReplayFrameSource::isFinished(void) const
+{
+    return !m_loop && m_nextFrame >= m_frames.size();
+}
+
+bool&
+ReplayFrameSource::loop(void)
+{
+    return m_loop;
+}
+
+bool
+ReplayFrameSource::waitForFrame(double timeout)
+{
+    if (m_frames.empty())
+    {
+        boost::this_thread::sleep(boost::posix_time::microseconds(static_cast<long>(timeout * 1e6)));
+        return false;
+    }
+
+    if (m_nextFrame >= m_frames.size())
+    {
+        if (!m_loop)
+        {
+            boost::this_thread::sleep(boost::posix_time::microseconds(static_cast<long>(timeout * 1e6)));
+            return false;
+        }
+
+        // continue the recording one mean frame period after its last frame
+        double duration = m_frames.back().receiveTime - m_frames.front().receiveTime;
+        double period = m_frames.size() > 1 ? duration / (m_frames.size() - 1) : 0.0;
+
+        m_frameTimeOffset += duration + period;
+        m_nextFrame = 0;
+    }
+
+    const Frame& frame = m_frames.at(m_nextFrame);
+
+    if (k_realtime)
+    {
+        if (m_nextFrame == 0 && m_frameTimeOffset == 0.0)
+        {
+            m_startTime = wallTime();
+        }
+
+        double releaseTime = m_startTime + m_frameTimeOffset
+                             + frame.receiveTime - m_frames.front().receiveTime;
+        double waitTime = releaseTime - wallTime();
+        if (waitTime > timeout)
+        {
+            boost::this_thread::sleep(boost::posix_time::microseconds(static_cast<long>(timeout * 1e6)));
+            return false;
+        }
+        if (waitTime > 0.0)
+        {
+            boost::this_thread::sleep(boost::posix_time::microseconds(static_cast<long>(waitTime * 1e6)));
+        }
+    }
+
+    m_frame = &frame;
+    ++m_nextFrame;
+
+    return true;
+}
+
+unsigned int
+ReplayFrameSource::frameNumber(void)
+{
+    return m_frame ? m_frame->frameNumber : 0;
+}
+
+double
+ReplayFrameSource::frameReceiveTime(void)
+{
+    if (!m_frame)
+    {
+        return 0.0;
+    }
+
+    if (k_realtime)
+    {
+        return m_startTime + m_frameTimeOffset
+               + m_frame->receiveTime - m_frames.front().receiveTime;
+    }
+
+    return m_frame->receiveTime + m_frameTimeOffset;
+}
+
+double
+ReplayFrameSource::frameLatency(void)
+{
+    return m_frame ? m_frame->latency : 0.0;
+}
+
+int
+ReplayFrameSource::subjectCount(void)
+{
+    return m_frame ? m_frame->subjects.size() : 0;
+}
+
+std::string
+ReplayFrameSource::subjectName(int subjectIdx)
+{
+    if (!m_frame || subjectIdx < 0 ||
+        subjectIdx >= static_cast<int>(m_frame->subjects.size()))
+    {
+        return std::string();
+    }
+
+    return m_frame->subjects.at(subjectIdx).subjectName;
+}
+
+std::string
+ReplayFrameSource::segmentName(const std::string& subjectName,
+                               int segmentIdx)
+{
+    // recordings hold the root segment of each subject only
+    const SubjectPose* subject = findSubject(subjectName);
+    if (!subject || segmentIdx != 0)
+    {
+        return std::string();
+    }
+
+    return subject->segmentName;
+}
+
+ViconFrameSource::PoseStatus
+ReplayFrameSource::segmentPose(const std::string& subjectName,
+                               const std::string& segmentName,
+                               double translation[3],
+                               double rotation[4])
+{
+    const SubjectPose* subject = findSubject(subjectName);
+    if (!subject || subject->segmentName != segmentName)
+    {
+        return POSE_INVALID;
+    }
+
+    if (subject->occluded)
+    {
+        return POSE_OCCLUDED;
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        translation[i] = subject->translation[i];
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        rotation[i] = subject->rotation[i];
+    }
+
+    return POSE_VALID;
+}
+
+const ReplayFrameSource::SubjectPose*
+ReplayFrameSource::findSubject(const std::string& subjectName) const
+{
+    if (!m_frame)
+    {
+        return 0;
+    }
+
+    for (size_t i = 0; i < m_frame->subjects.size(); ++i)
+    {
+        if (m_frame->subjects.at(i).subjectName == subjectName)
+        {
+            return &m_frame->subjects.at(i);
+        }
+    }
+
+    return 0;
+}
+
+}
@@ -0,0 +1,91 @@
+#ifndef REPLAYFRAMESOURCE_H
+#define REPLAYFRAMESOURCE_H
+
+#include <istream>
+#include <vector>
+
+#include "ViconFrameSource.h"
+
+namespace px
+{
+
+// Stand-in for the Vicon DataStream SDK that plays back recorded frames.
+// A recording is a text file of frames, each a header line followed by
+// one line per subject:
+//
+//   frame <frame number> <receive time [s]> <latency [s]> <subject count>
+//   <subject> <segment> <occluded 0|1> <tx> <ty> <tz> <qx> <qy> <qz> <qw>
+//
+// Translations are in millimetres as reported by the SDK. Lines starting
+// with '#' are ignored.
+class ReplayFrameSource: public ViconFrameSource
+{
+public:
+    struct SubjectPose
+    {
+        std::string subjectName;
+        std::string segmentName;
+        bool occluded;
+        double translation[3];
+        double rotation[4];
+    };
+
+    struct Frame
+    {
+        unsigned int frameNumber;
+        double receiveTime;
+        double latency;
+        std::vector<SubjectPose> subjects;
+    };
+
+    // If realtime is set, frames are released at the recorded rate and
+    // stamped relative to the wall time of the first frame. Otherwise,
+    // frames are released as fast as they are requested and keep their
+    // recorded receive times.
+    explicit ReplayFrameSource(bool realtime = false);
+
+    bool load(const std::string& filename);
+    bool read(std::istream& is);
+
+    void addFrame(const Frame& frame);
+
+    size_t frameCount(void) const;
+    bool isFinished(void) const;
+
+    bool& loop(void);
+
+    virtual bool waitForFrame(double timeout);
+
+    virtual unsigned int frameNumber(void);
+    virtual double frameReceiveTime(void);
+    virtual double frameLatency(void);
+
+    virtual int subjectCount(void);
+    virtual std::string subjectName(int subjectIdx);
+    virtual std::string segmentName(const std::string& subjectName,
+                                    int segmentIdx);
+
+    virtual PoseStatus segmentPose(const std::string& subjectName,
+                                   const std::string& segmentName,
+                                   double translation[3],
+                                   double rotation[4]);
+
+private:
+    const SubjectPose* findSubject(const std::string& subjectName) const;
+
+    const bool k_realtime;
+    bool m_loop;
+
+    std::vector<Frame> m_frames;
+
+    // index of the next frame to be released
+    size_t m_nextFrame;
+    const Frame* m_frame;
+
+    double m_startTime;
+    double m_frameTimeOffset;
+};
+
+}
+
+#endif
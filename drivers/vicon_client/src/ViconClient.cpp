@@ -10,13 +10,29 @@ namespace px
 
 ViconClient::ViconClient()
  : m_client(boost::make_shared<Client>())
+ , m_frameLatency(0.0)
+ , m_fetchThreadRunning(false)
+ , m_fetchRequested(false)
+ , m_frameFetched(false)
 {
 
 }
 
+ViconClient::~ViconClient()
+{
+    if (m_fetchThread)
+    {
+        disconnect();
+    }
+}
+
 bool
 ViconClient::connect(const std::string& viconHostName)
 {
+    // a fetch thread left from a dropped connection must not call
+    // GetFrame() while connecting
+    stopFetchThread();
+
     // Connect to a server
     ROS_INFO("Connecting to VICON at %s...", viconHostName.c_str());
 
@@ -34,7 +50,7 @@ ViconClient::connect(const std::string& viconHostName)
     }
     while (!connected);
 
-    boost::lock_guard<boost::mutex> lock(m_clientMutex);
+    boost::unique_lock<boost::mutex> lock(m_clientMutex);
 
     // Enable some different data types
     m_client->EnableSegmentData();
@@ -72,16 +88,28 @@ ViconClient::connect(const std::string& viconHostName)
     ROS_INFO("Version: %u.%u.%u",
              version.Major, version.Minor, version.Point);
 
+    lock.unlock();
+
+    boost::lock_guard<boost::mutex> fetchLock(m_fetchMutex);
+    m_fetchThreadRunning = true;
+    m_fetchRequested = false;
+    m_frameFetched = false;
+    m_fetchThread = boost::make_shared<boost::thread>(boost::bind(&ViconClient::fetchThread, this));
+
     return true;
 }
 
 bool
 ViconClient::disconnect(void)
 {
-    boost::lock_guard<boost::mutex> lock(m_clientMutex);
+    {
+        boost::lock_guard<boost::mutex> lock(m_clientMutex);
 
-    // Disconnect and dispose
-    m_client->Disconnect();
+        // Disconnect and dispose; this also returns a pending GetFrame()
+        m_client->Disconnect();
+    }
+
+    stopFetchThread();
 
     return true;
 }
@@ -131,7 +159,143 @@ ViconClient::waitForFrame(void)
 
     boost::lock_guard<boost::mutex> lock(m_clientMutex);
 
-    m_frameStamp = ros::Time::now() - ros::Duration(m_client->GetLatencyTotal().Total);
+    m_frameReceiveTime = ros::Time::now();
+    m_frameLatency = m_client->GetLatencyTotal().Total;
+    m_frameStamp = m_frameReceiveTime - ros::Duration(m_frameLatency);
+}
+
+bool
+ViconClient::waitForFrame(double timeout)
+{
+    boost::system_time deadline = boost::get_system_time()
+                                  + boost::posix_time::microseconds(static_cast<long>(timeout * 1e6));
+
+    boost::unique_lock<boost::mutex> lock(m_fetchMutex);
+
+    if (m_fetchThread && !m_fetchRequested && !m_frameFetched)
+    {
+        m_fetchRequested = true;
+        m_fetchCond.notify_all();
+    }
+
+    while (m_fetchRequested)
+    {
+        if (!m_fetchCond.timed_wait(lock, deadline))
+        {
+            return false;
+        }
+    }
+
+    if (m_frameFetched)
+    {
+        m_frameFetched = false;
+        return true;
+    }
+
+    // not connected
+    lock.unlock();
+    boost::this_thread::sleep(deadline);
+
+    return false;
+}
+
+unsigned int
+ViconClient::frameNumber(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_clientMutex);
+
+    return m_client->GetFrameNumber().FrameNumber;
+}
+
+double
+ViconClient::frameReceiveTime(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_clientMutex);
+
+    return m_frameReceiveTime.toSec();
+}
+
+double
+ViconClient::frameLatency(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_clientMutex);
+
+    return m_frameLatency;
+}
+
+int
+ViconClient::subjectCount(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_clientMutex);
+
+    return m_client->GetSubjectCount().SubjectCount;
+}
+
+std::string
+ViconClient::subjectName(int subjectIdx)
+{
+    boost::lock_guard<boost::mutex> lock(m_clientMutex);
+
+    Output_GetSubjectName output = m_client->GetSubjectName(subjectIdx);
+    if (output.Result != Result::Success)
+    {
+        return std::string();
+    }
+
+    return output.SubjectName;
+}
+
+std::string
+ViconClient::segmentName(const std::string& subjectName, int segmentIdx)
+{
+    boost::lock_guard<boost::mutex> lock(m_clientMutex);
+
+    Output_GetSegmentName output = m_client->GetSegmentName(subjectName, segmentIdx);
+    if (output.Result != Result::Success)
+    {
+        return std::string();
+    }
+
+    return output.SegmentName;
+}
+
+ViconFrameSource::PoseStatus
+ViconClient::segmentPose(const std::string& subjectName,
+                         const std::string& segmentName,
+                         double translation[3],
+                         double rotation[4])
+{
+    boost::lock_guard<boost::mutex> lock(m_clientMutex);
+
+    Output_GetSegmentGlobalRotationQuaternion rotationOutput =
+        m_client->GetSegmentGlobalRotationQuaternion(subjectName, segmentName);
+    if (rotationOutput.Result != Result::Success)
+    {
+        return POSE_INVALID;
+    }
+
+    Output_GetSegmentGlobalTranslation translationOutput =
+        m_client->GetSegmentGlobalTranslation(subjectName, segmentName);
+    if (translationOutput.Result != Result::Success)
+    {
+        return POSE_INVALID;
+    }
+
+    if (rotationOutput.Occluded || translationOutput.Occluded)
+    {
+        return POSE_OCCLUDED;
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        translation[i] = translationOutput.Translation[i];
+    }
+    for (int i = 0; i < 4; ++i)
+    {
+        rotation[i] = rotationOutput.Rotation[i];
+    }
+
+    return POSE_VALID;
 }
 
 bool
@@ -541,4 +705,68 @@ ViconClient::toString(const Unit::Enum unit) const
     }
 }
 
+void
+ViconClient::fetchThread(void)
+{
+    boost::unique_lock<boost::mutex> lock(m_fetchMutex);
+
+    while (true)
+    {
+        while (m_fetchThreadRunning && !m_fetchRequested)
+        {
+            m_fetchCond.wait(lock);
+        }
+
+        if (!m_fetchThreadRunning)
+        {
+            return;
+        }
+
+        lock.unlock();
+
+        // In server push mode, GetFrame() blocks until the next frame
+        // arrives. It is called without the client mutex, so that the
+        // other accessors do not block on a stalled server.
+        bool fetched = (m_client->GetFrame().Result == Result::Success);
+        if (fetched)
+        {
+            boost::lock_guard<boost::mutex> clientLock(m_clientMutex);
+
+            // take the receive time before any other SDK call
+            m_frameReceiveTime = ros::Time::now();
+            m_frameLatency = m_client->GetLatencyTotal().Total;
+            m_frameStamp = m_frameReceiveTime - ros::Duration(m_frameLatency);
+        }
+
+        lock.lock();
+
+        m_fetchRequested = false;
+        m_frameFetched = fetched;
+        m_fetchCond.notify_all();
+    }
+}
+
+void
+ViconClient::stopFetchThread(void)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_fetchMutex);
+
+        if (!m_fetchThread)
+        {
+            return;
+        }
+
+        m_fetchThreadRunning = false;
+        m_fetchCond.notify_all();
+    }
+
+    m_fetchThread->join();
+
+    boost::lock_guard<boost::mutex> lock(m_fetchMutex);
+    m_fetchThread.reset();
+    m_fetchRequested = false;
+    m_frameFetched = false;
+}
+
 }
@@ -6,14 +6,16 @@
 #include <geometry_msgs/PoseStamped.h>
 
 #include "Client.h"
+#include "ViconFrameSource.h"
 
 namespace px
 {
 
-class ViconClient
+class ViconClient: public ViconFrameSource
 {
 public:
     ViconClient();
+    ~ViconClient();
 
     bool connect(const std::string& viconHostName);
     bool disconnect(void);
@@ -27,7 +29,31 @@ public:
 
     void printFrame(void);
 
+    // GetFrame() runs on a fetch thread, so that the timeout holds even
+    // though it blocks until the server pushes a frame. A frame is only
+    // fetched on request, so the accessors below read the frame of the
+    // last successful call; they must not be used after a call that
+    // timed out until a later call returns true.
+    virtual bool waitForFrame(double timeout);
+
+    virtual unsigned int frameNumber(void);
+    virtual double frameReceiveTime(void);
+    virtual double frameLatency(void);
+
+    virtual int subjectCount(void);
+    virtual std::string subjectName(int subjectIdx);
+    virtual std::string segmentName(const std::string& subjectName,
+                                    int segmentIdx);
+
+    virtual PoseStatus segmentPose(const std::string& subjectName,
+                                   const std::string& segmentName,
+                                   double translation[3],
+                                   double rotation[4]);
+
 private:
+    void fetchThread(void);
+    void stopFetchThread(void);
+
     std::string toString(const bool value) const;
     std::string toString(const ViconDataStreamSDK::CPP::Direction::Enum direction) const;
     std::string toString(const ViconDataStreamSDK::CPP::DeviceType::Enum deviceType) const;
@@ -37,7 +63,16 @@ private:
     boost::mutex m_clientMutex;
 
     ros::Time m_frameStamp;
+    ros::Time m_frameReceiveTime;
+    double m_frameLatency;
     std::string m_subjectName;
+
+    boost::mutex m_fetchMutex;
+    boost::condition_variable m_fetchCond;
+    bool m_fetchThreadRunning;
+    bool m_fetchRequested;
+    bool m_frameFetched;
+    boost::shared_ptr<boost::thread> m_fetchThread;
 };
 
 }
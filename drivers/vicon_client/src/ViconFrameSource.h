@@ -0,0 +1,57 @@
+#ifndef VICONFRAMESOURCE_H
+#define VICONFRAMESOURCE_H
+
+#include <boost/shared_ptr.hpp>
+#include <string>
+
+namespace px
+{
+
+// The part of the Vicon DataStream SDK that pose streaming needs. It is
+// implemented by ViconClient for a live server and by ReplayFrameSource
+// for recorded frames, so that streaming can be tested offline.
+class ViconFrameSource
+{
+public:
+    enum PoseStatus
+    {
+        POSE_VALID,
+        POSE_OCCLUDED,
+        POSE_INVALID
+    };
+
+    virtual ~ViconFrameSource() {}
+
+    // Blocks until a new frame is available or the timeout (in seconds)
+    // elapses. Returns false if there is no new frame.
+    virtual bool waitForFrame(double timeout) = 0;
+
+    // The following refer to the frame of the last successful waitForFrame.
+    virtual unsigned int frameNumber(void) = 0;
+
+    // Host time in seconds at which the frame was received.
+    virtual double frameReceiveTime(void) = 0;
+
+    // Total latency in seconds from capture to receipt reported by the
+    // server.
+    virtual double frameLatency(void) = 0;
+
+    virtual int subjectCount(void) = 0;
+    virtual std::string subjectName(int subjectIdx) = 0;
+    virtual std::string segmentName(const std::string& subjectName,
+                                    int segmentIdx) = 0;
+
+    // Global translation in millimetres and rotation as a quaternion
+    // (x, y, z, w). Returns POSE_INVALID if the subject or segment is
+    // not in the frame.
+    virtual PoseStatus segmentPose(const std::string& subjectName,
+                                   const std::string& segmentName,
+                                   double translation[3],
+                                   double rotation[4]) = 0;
+};
+
+typedef boost::shared_ptr<ViconFrameSource> ViconFrameSourcePtr;
+
+}
+
+#endif
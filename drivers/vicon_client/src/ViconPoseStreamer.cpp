@@ -0,0 +1,274 @@
+#include "ViconPoseStreamer.h"
+
+#include <boost/make_shared.hpp>
+#include <set>
+
+namespace px
+{
+
+ViconPoseStreamer::ViconPoseStreamer(const ViconFrameSourcePtr& source,
+                                     const std::vector<std::string>& subjectNames,
+                                     size_t queueSize)
+ : k_source(source)
+ , m_poseQueue(queueSize)
+ , m_subjectCount(-1)
+ , m_readerThreadRunning(false)
+ , m_hasFrame(false)
+ , m_lastFrameNumber(0)
+ , m_frameCount(0)
+ , m_skippedFrameCount(0)
+ , m_droppedCount(0)
+ , m_resolveCount(0)
+{
+    setSubjects(subjectNames);
+}
+
+ViconPoseStreamer::~ViconPoseStreamer()
+{
+    stop();
+}
+
+void
+ViconPoseStreamer::start(void)
+{
+    if (m_readerThread)
+    {
+        return;
+    }
+
+    m_readerThreadRunning = true;
+    m_readerThread = boost::make_shared<boost::thread>(boost::bind(&ViconPoseStreamer::readerThread, this));
+}
+
+void
+ViconPoseStreamer::stop(void)
+{
+    if (!m_readerThread)
+    {
+        return;
+    }
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_poseQueueMutex);
+        m_readerThreadRunning = false;
+    }
+
+    m_readerThread->join();
+    m_readerThread.reset();
+}
+
+void
+ViconPoseStreamer::setSubjects(const std::vector<std::string>& subjectNames)
+{
+    boost::lock_guard<boost::mutex> lock(m_subjectMutex);
+
+    m_subjects.resize(subjectNames.size());
+    for (size_t i = 0; i < subjectNames.size(); ++i)
+    {
+        m_subjects.at(i).subjectName = subjectNames.at(i);
+        m_subjects.at(i).segmentName.clear();
+        m_subjects.at(i).resolved = false;
+    }
+
+    // resolve on the next frame
+    m_subjectCount = -1;
+}
+
+bool
+ViconPoseStreamer::pop(ViconPose& pose, double timeout)
+{
+    if (m_poseQueue.pop(pose))
+    {
+        return true;
+    }
+
+    if (timeout <= 0.0)
+    {
+        return false;
+    }
+
+    boost::unique_lock<boost::mutex> lock(m_poseQueueMutex);
+
+    boost::system_time deadline = boost::get_system_time()
+                                  + boost::posix_time::microseconds(static_cast<long>(timeout * 1e6));
+    while (!m_poseQueue.pop(pose))
+    {
+        if (!m_poseQueueCond.timed_wait(lock, deadline))
+        {
+            return m_poseQueue.pop(pose);
+        }
+    }
+
+    return true;
+}
+
+size_t
+ViconPoseStreamer::frameCount(void) const
+{
+    boost::lock_guard<boost::mutex> lock(m_subjectMutex);
+
+    return m_frameCount;
+}
+
+size_t
+ViconPoseStreamer::skippedFrameCount(void) const
+{
+    boost::lock_guard<boost::mutex> lock(m_subjectMutex);
+
+    return m_skippedFrameCount;
+}
+
+size_t
+ViconPoseStreamer::droppedCount(void) const
+{
+    boost::lock_guard<boost::mutex> lock(m_subjectMutex);
+
+    return m_droppedCount;
+}
+
+size_t
+ViconPoseStreamer::resolveCount(void) const
+{
+    boost::lock_guard<boost::mutex> lock(m_subjectMutex);
+
+    return m_resolveCount;
+}
+
+void
+ViconPoseStreamer::readerThread(void)
+{
+    while (true)
+    {
+        {
+            boost::lock_guard<boost::mutex> lock(m_poseQueueMutex);
+            if (!m_readerThreadRunning)
+            {
+                break;
+            }
+        }
+
+        readFrame();
+    }
+}
+
+void
+ViconPoseStreamer::readFrame(void)
+{
+    // the timeout bounds the time that stop() waits for the thread
+    if (!k_source->waitForFrame(0.01))
+    {
+        return;
+    }
+
+    unsigned int frameNumber = k_source->frameNumber();
+    double stamp = k_source->frameReceiveTime() - k_source->frameLatency();
+
+    boost::lock_guard<boost::mutex> lock(m_subjectMutex);
+
+    if (m_hasFrame && frameNumber > m_lastFrameNumber + 1)
+    {
+        m_skippedFrameCount += frameNumber - m_lastFrameNumber - 1;
+    }
+    m_hasFrame = true;
+    m_lastFrameNumber = frameNumber;
+    ++m_frameCount;
+
+    if (k_source->subjectCount() != m_subjectCount)
+    {
+        resolveSubjects();
+    }
+
+    bool resolvedThisFrame = false;
+    bool pushed = false;
+    for (size_t i = 0; i < m_subjects.size(); ++i)
+    {
+        SubjectCache& subject = m_subjects.at(i);
+
+        // subjects that were not found wait for the subject count to change
+        if (!subject.resolved)
+        {
+            continue;
+        }
+
+        ViconPose pose;
+        ViconFrameSource::PoseStatus status =
+            k_source->segmentPose(subject.subjectName, subject.segmentName,
+                                  pose.translation, pose.rotation);
+
+        if (status == ViconFrameSource::POSE_INVALID && !resolvedThisFrame)
+        {
+            // the subjects changed without changing their count
+            resolveSubjects();
+            resolvedThisFrame = true;
+
+            if (!subject.resolved)
+            {
+                continue;
+            }
+
+            status = k_source->segmentPose(subject.subjectName, subject.segmentName,
+                                           pose.translation, pose.rotation);
+        }
+
+        if (status != ViconFrameSource::POSE_VALID)
+        {
+            continue;
+        }
+
+        pose.subjectIdx = i;
+        pose.frameNumber = frameNumber;
+        pose.stamp = stamp;
+        for (int j = 0; j < 3; ++j)
+        {
+            pose.translation[j] /= 1000.0;
+        }
+
+        if (m_poseQueue.push(pose))
+        {
+            pushed = true;
+        }
+        else
+        {
+            ++m_droppedCount;
+        }
+    }
+
+    if (pushed)
+    {
+        // notify under the mutex so that pop() cannot miss the poses
+        // between checking the queue and waiting
+        boost::lock_guard<boost::mutex> lock(m_poseQueueMutex);
+        m_poseQueueCond.notify_one();
+    }
+}
+
+void
+ViconPoseStreamer::resolveSubjects(void)
+{
+    m_subjectCount = k_source->subjectCount();
+
+    std::set<std::string> frameSubjects;
+    for (int i = 0; i < m_subjectCount; ++i)
+    {
+        frameSubjects.insert(k_source->subjectName(i));
+    }
+
+    for (size_t i = 0; i < m_subjects.size(); ++i)
+    {
+        SubjectCache& subject = m_subjects.at(i);
+
+        subject.resolved = false;
+        if (frameSubjects.count(subject.subjectName) == 0)
+        {
+            continue;
+        }
+
+        // the pose of a subject is the pose of its first segment
+        subject.segmentName = k_source->segmentName(subject.subjectName, 0);
+        subject.resolved = !subject.segmentName.empty();
+    }
+
+    ++m_resolveCount;
+}
+
+}
@@ -0,0 +1,93 @@
+#ifndef VICONPOSESTREAMER_H
+#define VICONPOSESTREAMER_H
+
+#include <boost/lockfree/spsc_queue.hpp>
+#include <boost/thread.hpp>
+#include <vector>
+
+#include "ViconFrameSource.h"
+
+namespace px
+{
+
+struct ViconPose
+{
+    // index into the subject names of the streamer
+    int subjectIdx;
+    unsigned int frameNumber;
+    // receive time minus the latency reported by the server [s]
+    double stamp;
+    // [m]
+    double translation[3];
+    // x, y, z, w
+    double rotation[4];
+};
+
+// Reads frames from a Vicon frame source in a dedicated thread and pushes
+// the poses of a set of subjects into a lock-free ring. Subject and
+// segment names are resolved once and only looked up again when the
+// subject count of a frame changes or a cached subject is no longer found,
+// so the per-frame cost no longer grows with the number of subjects that
+// the server streams.
+class ViconPoseStreamer
+{
+public:
+    ViconPoseStreamer(const ViconFrameSourcePtr& source,
+                      const std::vector<std::string>& subjectNames,
+                      size_t queueSize = 256);
+    ~ViconPoseStreamer();
+
+    void start(void);
+    void stop(void);
+
+    // Replaces the streamed subjects. Poses in the ring keep the subject
+    // index they were pushed with.
+    void setSubjects(const std::vector<std::string>& subjectNames);
+
+    // Pops the oldest pose, waiting up to timeout seconds for one. Only
+    // one thread may pop poses.
+    bool pop(ViconPose& pose, double timeout = 0.0);
+
+    size_t frameCount(void) const;
+    size_t skippedFrameCount(void) const;
+    size_t droppedCount(void) const;
+    size_t resolveCount(void) const;
+
+private:
+    struct SubjectCache
+    {
+        std::string subjectName;
+        std::string segmentName;
+        bool resolved;
+    };
+
+    void readerThread(void);
+    void readFrame(void);
+    void resolveSubjects(void);
+
+    const ViconFrameSourcePtr k_source;
+
+    boost::lockfree::spsc_queue<ViconPose> m_poseQueue;
+    boost::mutex m_poseQueueMutex;
+    boost::condition_variable m_poseQueueCond;
+
+    // guards the subject cache and the counters; only contended while
+    // the subjects are replaced
+    mutable boost::mutex m_subjectMutex;
+    std::vector<SubjectCache> m_subjects;
+    int m_subjectCount;
+
+    bool m_readerThreadRunning;
+    boost::shared_ptr<boost::thread> m_readerThread;
+
+    bool m_hasFrame;
+    unsigned int m_lastFrameNumber;
+    size_t m_frameCount;
+    size_t m_skippedFrameCount;
+    size_t m_droppedCount;
+    size_t m_resolveCount;
+};
+
+}
+
+#endif
@@ -1,37 +1,50 @@
+#include <boost/make_shared.hpp>
 #include <driver_base/SensorLevels.h>
 #include <dynamic_reconfigure/server.h>
 #include <ros/ros.h>
 
 #include "vicon_client/ViconClientConfig.h"
+#include "ReplayFrameSource.h"
 #include "ViconClient.h"
+#include "ViconPoseStreamer.h"
 
 void reconfigure(vicon_client::ViconClientConfig& config,
                  uint32_t level,
-                 px::ViconClient* viconClient)
+                 px::ViconClient* viconClient,
+                 px::ViconPoseStreamer* streamer)
 {
-    if (level & driver_base::SensorLevels::RECONFIGURE_CLOSE)
+    if (viconClient)
     {
-        if (viconClient->isConnected())
+        if (level & driver_base::SensorLevels::RECONFIGURE_CLOSE)
         {
-            viconClient->disconnect();
+            if (viconClient->isConnected())
+            {
+                viconClient->disconnect();
+            }
         }
-    }
 
-    if (!viconClient->isConnected())
-    {
-        if (!viconClient->connect(config.hostname))
+        if (!viconClient->isConnected())
         {
-            ROS_WARN("Failed to connect to Vicon DataStream server at %s.", config.hostname.c_str());
+            if (!viconClient->connect(config.hostname))
+            {
+                ROS_WARN("Failed to connect to Vicon DataStream server at %s.", config.hostname.c_str());
+            }
+            else
+            {
+                viconClient->setSubject(config.subject_name);
+            }
         }
-        else
+
+        if (level == driver_base::SensorLevels::RECONFIGURE_RUNNING)
         {
             viconClient->setSubject(config.subject_name);
         }
     }
 
-    if (level == driver_base::SensorLevels::RECONFIGURE_RUNNING)
+    // the subject name only applies if no subject list is given
+    if (streamer)
     {
-        viconClient->setSubject(config.subject_name);
+        streamer->setSubjects(std::vector<std::string>(1, config.subject_name));
     }
 }
 
@@ -40,37 +53,117 @@ int main(int argc, char** argv)
     ros::init(argc, argv, "vicon_client_node");
 
     ros::NodeHandle nh("vicon");
-    ros::Publisher pub = nh.advertise<geometry_msgs::PoseStamped>("pose", 10);
-
-    dynamic_reconfigure::Server<vicon_client::ViconClientConfig> server(nh);
-
-    px::ViconClient viconClient;
-    server.setCallback(boost::bind(&reconfigure, _1, _2, &viconClient));
 
     ros::NodeHandle pnh("~vicon");
     std::string frame_id;
     pnh.param("frame_id", frame_id, std::string("vicon"));
 
+    // poses of all subjects are published on <subject>/pose; without a
+    // subject list, the pose of the reconfigurable subject is published
+    // on pose
+    std::vector<std::string> subjects;
+    pnh.getParam("subjects", subjects);
+
+    // frames recorded in the format of ReplayFrameSource are played back
+    // instead of connecting to a server
+    std::string replayFile;
+    pnh.getParam("replay_file", replayFile);
+
+    bool replayLoop;
+    pnh.param("replay_loop", replayLoop, false);
+
+    int queueSize;
+    pnh.param("queue_size", queueSize, 256);
+
+    std::vector<ros::Publisher> pubs;
+    if (subjects.empty())
+    {
+        pubs.push_back(nh.advertise<geometry_msgs::PoseStamped>("pose", 10));
+    }
+    else
+    {
+        for (size_t i = 0; i < subjects.size(); ++i)
+        {
+            pubs.push_back(nh.advertise<geometry_msgs::PoseStamped>(subjects.at(i) + "/pose", 10));
+        }
+    }
+
+    boost::shared_ptr<px::ViconClient> viconClient;
+    px::ViconFrameSourcePtr source;
+    if (replayFile.empty())
+    {
+        viconClient = boost::make_shared<px::ViconClient>();
+        source = viconClient;
+    }
+    else
+    {
+        boost::shared_ptr<px::ReplayFrameSource> replaySource =
+            boost::make_shared<px::ReplayFrameSource>(true);
+        if (!replaySource->load(replayFile))
+        {
+            ROS_ERROR("Failed to load Vicon recording %s.", replayFile.c_str());
+            return 1;
+        }
+        replaySource->loop() = replayLoop;
+
+        ROS_INFO("Replaying %lu frames from %s.",
+                 replaySource->frameCount(), replayFile.c_str());
+
+        source = replaySource;
+    }
+
+    px::ViconPoseStreamer streamer(source, subjects, queueSize);
+
+    dynamic_reconfigure::Server<vicon_client::ViconClientConfig> server(nh);
+    server.setCallback(boost::bind(&reconfigure, _1, _2, viconClient.get(),
+                                   subjects.empty() ? &streamer : 0));
+
+    // services the reconfigure requests
+    ros::AsyncSpinner spinner(1);
+    spinner.start();
+
+    streamer.start();
+
+    size_t droppedCount = 0;
+    size_t skippedFrameCount = 0;
     while (nh.ok())
     {
-        if (!viconClient.isConnected())
+        px::ViconPose viconPose;
+        if (!streamer.pop(viconPose, 0.1))
         {
             continue;
         }
 
-        viconClient.waitForFrame();
-
         geometry_msgs::PoseStamped pose;
-        if (viconClient.getPose(pose))
+        pose.header.stamp = ros::Time(viconPose.stamp);
+        pose.header.frame_id = frame_id;
+        pose.pose.position.x = viconPose.translation[0];
+        pose.pose.position.y = viconPose.translation[1];
+        pose.pose.position.z = viconPose.translation[2];
+        pose.pose.orientation.x = viconPose.rotation[0];
+        pose.pose.orientation.y = viconPose.rotation[1];
+        pose.pose.orientation.z = viconPose.rotation[2];
+        pose.pose.orientation.w = viconPose.rotation[3];
+
+        pubs.at(subjects.empty() ? 0 : viconPose.subjectIdx).publish(pose);
+
+        if (streamer.droppedCount() > droppedCount)
+        {
+            droppedCount = streamer.droppedCount();
+            ROS_WARN_THROTTLE(1.0, "Pose queue overflow; dropped %lu poses in total.", droppedCount);
+        }
+        if (streamer.skippedFrameCount() > skippedFrameCount)
         {
-            pose.header.frame_id = frame_id;
-            pub.publish(pose);
+            skippedFrameCount = streamer.skippedFrameCount();
+            ROS_WARN_THROTTLE(1.0, "Missed %lu Vicon frames in total.", skippedFrameCount);
         }
     }
 
-    if (viconClient.isConnected())
+    streamer.stop();
+
+    if (viconClient && viconClient->isConnected())
     {
-        viconClient.disconnect();
+        viconClient->disconnect();
     }
 
     return 0;
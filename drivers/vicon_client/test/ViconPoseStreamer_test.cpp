@@ -0,0 +1,211 @@
+#include <boost/make_shared.hpp>
+#include <gtest/gtest.h>
+#include <sstream>
+
+#include "ReplayFrameSource.h"
+#include "ViconPoseStreamer.h"
+
+namespace px
+{
+
+void
+popPoses(ViconPoseStreamer& streamer, size_t nPoses,
+         std::vector<ViconPose>& poses)
+{
+    poses.clear();
+
+    ViconPose pose;
+    while (poses.size() < nPoses && streamer.pop(pose, 1.0))
+    {
+        poses.push_back(pose);
+    }
+}
+
+TEST(ReplayFrameSource, ReadRecording)
+{
+    std::istringstream iss("# recorded at 100 Hz\n"
+                           "frame 10 5.00 0.004 2\n"
+                           "robot robot 0 1000 2000 -500 0 0 0 1\n"
+                           "wand wand 1 0 0 0 0 0 0 1\n"
+                           "frame 11 5.01 0.004 1\n"
+                           "robot robot 0 1010 2000 -500 0 0 0 1\n");
+
+    ReplayFrameSource source;
+    ASSERT_TRUE(source.read(iss));
+    EXPECT_EQ(2u, source.frameCount());
+
+    ASSERT_TRUE(source.waitForFrame(0.1));
+    EXPECT_EQ(10u, source.frameNumber());
+    EXPECT_DOUBLE_EQ(5.0, source.frameReceiveTime());
+    EXPECT_DOUBLE_EQ(0.004, source.frameLatency());
+    ASSERT_EQ(2, source.subjectCount());
+    EXPECT_EQ("wand", source.subjectName(1));
+    EXPECT_EQ("robot", source.segmentName("robot", 0));
+
+    double translation[3], rotation[4];
+    EXPECT_EQ(ViconFrameSource::POSE_VALID,
+              source.segmentPose("robot", "robot", translation, rotation));
+    EXPECT_DOUBLE_EQ(2000.0, translation[1]);
+    EXPECT_EQ(ViconFrameSource::POSE_OCCLUDED,
+              source.segmentPose("wand", "wand", translation, rotation));
+    EXPECT_EQ(ViconFrameSource::POSE_INVALID,
+              source.segmentPose("robot", "base", translation, rotation));
+
+    ASSERT_TRUE(source.waitForFrame(0.1));
+    EXPECT_EQ(ViconFrameSource::POSE_INVALID,
+              source.segmentPose("wand", "wand", translation, rotation));
+
+    EXPECT_TRUE(source.isFinished());
+    EXPECT_FALSE(source.waitForFrame(0.001));
+
+    std::istringstream malformed("frame 12 5.02 0.004 2\n"
+                                 "robot robot 0 1000 2000 -500 0 0 0 1\n");
+    EXPECT_FALSE(source.read(malformed));
+}
+
+TEST(ViconPoseStreamer, StampsAndUnits)
+{
+    boost::shared_ptr<ReplayFrameSource> source = boost::make_shared<ReplayFrameSource>();
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ReplayFrameSource::Frame frame;
+        frame.frameNumber = 1000 + i;
+        frame.receiveTime = 10.0 + i * 0.005;
+        frame.latency = 0.003;
+
+        ReplayFrameSource::SubjectPose subject;
+        subject.subjectName = "robot";
+        subject.segmentName = "base";
+        subject.occluded = false;
+        subject.translation[0] = i * 10.0;
+        subject.translation[1] = -250.0;
+        subject.translation[2] = 1500.0;
+        subject.rotation[0] = 0.0;
+        subject.rotation[1] = 0.0;
+        subject.rotation[2] = 0.0;
+        subject.rotation[3] = 1.0;
+        frame.subjects.push_back(subject);
+
+        source->addFrame(frame);
+    }
+
+    ViconPoseStreamer streamer(source, std::vector<std::string>(1, "robot"));
+    streamer.start();
+
+    std::vector<ViconPose> poses;
+    popPoses(streamer, 100, poses);
+
+    streamer.stop();
+
+    ASSERT_EQ(100u, poses.size());
+    for (int i = 0; i < 100; ++i)
+    {
+        const ViconPose& pose = poses.at(i);
+
+        EXPECT_EQ(0, pose.subjectIdx);
+        EXPECT_EQ(1000u + i, pose.frameNumber);
+        EXPECT_NEAR(10.0 + i * 0.005 - 0.003, pose.stamp, 1e-9);
+        EXPECT_NEAR(i * 0.01, pose.translation[0], 1e-9);
+        EXPECT_NEAR(-0.25, pose.translation[1], 1e-9);
+        EXPECT_NEAR(1.5, pose.translation[2], 1e-9);
+        EXPECT_DOUBLE_EQ(1.0, pose.rotation[3]);
+    }
+
+    // the subject is resolved once
+    EXPECT_EQ(1u, streamer.resolveCount());
+    EXPECT_EQ(0u, streamer.skippedFrameCount());
+    EXPECT_EQ(0u, streamer.droppedCount());
+}
+
+TEST(ViconPoseStreamer, SubjectsChange)
+{
+    std::istringstream iss("frame 1 1.00 0.0 1\n"
+                           "robot robot 0 1000 0 0 0 0 0 1\n"
+                           // wand appears
+                           "frame 2 1.01 0.0 2\n"
+                           "wand wand 0 2000 0 0 0 0 0 1\n"
+                           "robot robot 0 1000 0 0 0 0 0 1\n"
+                           // wand is occluded
+                           "frame 3 1.02 0.0 2\n"
+                           "wand wand 1 2000 0 0 0 0 0 1\n"
+                           "robot robot 0 1000 0 0 0 0 0 1\n"
+                           // robot is replaced without changing the count;
+                           // frame 4 is missed
+                           "frame 5 1.04 0.0 2\n"
+                           "wand wand 0 2000 0 0 0 0 0 1\n"
+                           "box box 0 3000 0 0 0 0 0 1\n");
+
+    boost::shared_ptr<ReplayFrameSource> source = boost::make_shared<ReplayFrameSource>();
+    ASSERT_TRUE(source->read(iss));
+
+    std::vector<std::string> subjects;
+    subjects.push_back("robot");
+    subjects.push_back("wand");
+
+    ViconPoseStreamer streamer(source, subjects);
+    streamer.start();
+
+    std::vector<ViconPose> poses;
+    popPoses(streamer, 5, poses);
+
+    streamer.stop();
+
+    // frame 1: robot; frame 2: robot, wand; frame 3: robot; frame 5: wand
+    ASSERT_EQ(5u, poses.size());
+
+    const int subjectIdx[] = {0, 0, 1, 0, 1};
+    const unsigned int frameNumber[] = {1, 2, 2, 3, 5};
+    const double x[] = {1.0, 1.0, 2.0, 1.0, 2.0};
+    for (int i = 0; i < 5; ++i)
+    {
+        EXPECT_EQ(subjectIdx[i], poses.at(i).subjectIdx);
+        EXPECT_EQ(frameNumber[i], poses.at(i).frameNumber);
+        EXPECT_DOUBLE_EQ(x[i], poses.at(i).translation[0]);
+    }
+
+    // on frames 1 and 2 for the count, and on frame 5 for the stale robot
+    EXPECT_EQ(3u, streamer.resolveCount());
+    EXPECT_EQ(1u, streamer.skippedFrameCount());
+}
+
+TEST(ViconPoseStreamer, QueueOverflow)
+{
+    std::ostringstream oss;
+    for (int i = 0; i < 20; ++i)
+    {
+        oss << "frame " << i << " " << i * 0.01 << " 0.0 1\n"
+            << "robot robot 0 0 0 0 0 0 0 1\n";
+    }
+
+    std::istringstream iss(oss.str());
+
+    boost::shared_ptr<ReplayFrameSource> source = boost::make_shared<ReplayFrameSource>();
+    ASSERT_TRUE(source->read(iss));
+
+    ViconPoseStreamer streamer(source, std::vector<std::string>(1, "robot"), 8);
+    streamer.start();
+
+    while (streamer.frameCount() < 20)
+    {
+        boost::this_thread::sleep(boost::posix_time::milliseconds(1));
+    }
+
+    streamer.stop();
+
+    // the ring keeps the oldest poses
+    std::vector<ViconPose> poses;
+    popPoses(streamer, 20, poses);
+
+    ASSERT_EQ(8u, poses.size());
+    EXPECT_EQ(0u, poses.front().frameNumber);
+    EXPECT_EQ(12u, streamer.droppedCount());
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
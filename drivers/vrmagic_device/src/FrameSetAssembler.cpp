@@ -0,0 +1,94 @@
+#include "FrameSetAssembler.h"
+
+#include <boost/make_shared.hpp>
+
+namespace px
+{
+
+FrameSetAssembler::FrameSetAssembler(const std::vector<std::string>& cameraNs,
+                                     size_t maxPending)
+ : k_cameraNs(cameraNs)
+ , k_maxPending(maxPending)
+ , m_droppedCount(0)
+{
+
+}
+
+multicam_msgs::FrameSetPtr
+FrameSetAssembler::add(int cameraId, uint32_t frameCounter,
+                       const sensor_msgs::Image& image)
+{
+    if (cameraId < 0 || cameraId >= static_cast<int>(k_cameraNs.size()))
+    {
+        return multicam_msgs::FrameSetPtr();
+    }
+
+    std::deque<PendingSet>::iterator it = m_pendingSets.begin();
+    while (it != m_pendingSets.end() && it->frameCounter != frameCounter)
+    {
+        ++it;
+    }
+
+    if (it == m_pendingSets.end())
+    {
+        if (m_pendingSets.size() >= k_maxPending)
+        {
+            m_pendingSets.pop_front();
+            ++m_droppedCount;
+        }
+
+        PendingSet pendingSet;
+        pendingSet.frameCounter = frameCounter;
+        pendingSet.frameSet = boost::make_shared<multicam_msgs::FrameSet>();
+        pendingSet.frameSet->header = image.header;
+        pendingSet.frameSet->camera_ns = k_cameraNs;
+        pendingSet.frameSet->images.resize(k_cameraNs.size());
+        pendingSet.received.assign(k_cameraNs.size(), false);
+        pendingSet.nReceived = 0;
+
+        m_pendingSets.push_back(pendingSet);
+
+        it = m_pendingSets.end() - 1;
+    }
+
+    if (it->received.at(cameraId))
+    {
+        // duplicate frame counter, e.g. after a device restart
+        return multicam_msgs::FrameSetPtr();
+    }
+
+    sensor_msgs::Image& setImage = it->frameSet->images.at(cameraId);
+    setImage = image;
+    setImage.header.stamp = it->frameSet->header.stamp;
+
+    it->received.at(cameraId) = true;
+    ++it->nReceived;
+
+    if (it->nReceived < k_cameraNs.size())
+    {
+        return multicam_msgs::FrameSetPtr();
+    }
+
+    multicam_msgs::FrameSetPtr frameSet = it->frameSet;
+
+    // older sets can no longer complete
+    size_t nOlder = it - m_pendingSets.begin();
+    m_droppedCount += nOlder;
+    m_pendingSets.erase(m_pendingSets.begin(), it + 1);
+
+    return frameSet;
+}
+
+void
+FrameSetAssembler::reset(void)
+{
+    m_pendingSets.clear();
+}
+
+size_t
+FrameSetAssembler::droppedCount(void) const
+{
+    return m_droppedCount;
+}
+
+}
@@ -0,0 +1,48 @@
+#ifndef FRAMESETASSEMBLER_H
+#define FRAMESETASSEMBLER_H
+
+#include <deque>
+#include <multicam_msgs/FrameSet.h>
+
+namespace px
+{
+
+// Groups the frames that the cameras of a device captured on the same
+// trigger into one FrameSet message. Frames are keyed by the device
+// frame counter, which all sensors of a device share. A set that is still
+// incomplete when a newer set completes, or when more than maxPending
+// sets are open, can no longer complete and is dropped.
+class FrameSetAssembler
+{
+public:
+    explicit FrameSetAssembler(const std::vector<std::string>& cameraNs,
+                               size_t maxPending = 4);
+
+    // Copies the image into the frame set of its frame counter. Returns
+    // the frame set once it holds an image from every camera.
+    multicam_msgs::FrameSetPtr add(int cameraId, uint32_t frameCounter,
+                                   const sensor_msgs::Image& image);
+
+    void reset(void);
+
+    size_t droppedCount(void) const;
+
+private:
+    struct PendingSet
+    {
+        uint32_t frameCounter;
+        multicam_msgs::FrameSetPtr frameSet;
+        std::vector<bool> received;
+        size_t nReceived;
+    };
+
+    const std::vector<std::string> k_cameraNs;
+    const size_t k_maxPending;
+
+    std::deque<PendingSet> m_pendingSets;
+    size_t m_droppedCount;
+};
+
+}
+
+#endif
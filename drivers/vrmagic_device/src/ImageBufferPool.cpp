@@ -0,0 +1,100 @@
+#include "ImageBufferPool.h"
+
+#include <boost/bind.hpp>
+
+namespace px
+{
+
+ImageBufferPool::ImageBufferPool(size_t capacity)
+ : k_capacity(capacity)
+{
+    m_freeList.reserve(k_capacity);
+}
+
+ImageBufferPool::~ImageBufferPool()
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    for (size_t i = 0; i < m_freeList.size(); ++i)
+    {
+        delete m_freeList.at(i);
+    }
+    m_freeList.clear();
+}
+
+sensor_msgs::ImagePtr
+ImageBufferPool::acquire(size_t dataSize)
+{
+    sensor_msgs::Image* image = 0;
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        if (!m_freeList.empty())
+        {
+            image = m_freeList.back();
+            m_freeList.pop_back();
+        }
+    }
+
+    if (image == 0)
+    {
+        // All pooled buffers are still held by subscribers.
+        // Allocate a new one; it joins the pool once released.
+        image = new sensor_msgs::Image;
+    }
+
+    // resize() keeps the existing allocation when the size is unchanged,
+    // which is the steady state for a camera with a fixed image format.
+    image->data.resize(dataSize);
+
+    boost::weak_ptr<ImageBufferPool> pool = shared_from_this();
+    return sensor_msgs::ImagePtr(image, boost::bind(&ImageBufferPool::release, pool, _1));
+}
+
+size_t
+ImageBufferPool::capacity(void) const
+{
+    return k_capacity;
+}
+
+size_t
+ImageBufferPool::available(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    return m_freeList.size();
+}
+
+void
+ImageBufferPool::release(boost::weak_ptr<ImageBufferPool> pool,
+                         sensor_msgs::Image* image)
+{
+    ImageBufferPoolPtr p = pool.lock();
+    if (p)
+    {
+        p->recycle(image);
+    }
+    else
+    {
+        // the pool has been destroyed while the image was in flight
+        delete image;
+    }
+}
+
+void
+ImageBufferPool::recycle(sensor_msgs::Image* image)
+{
+    boost::lock_guard<boost::mutex> lock(m_mutex);
+
+    if (m_freeList.size() < k_capacity)
+    {
+        m_freeList.push_back(image);
+    }
+    else
+    {
+        delete image;
+    }
+}
+
+}
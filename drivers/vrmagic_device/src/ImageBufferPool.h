@@ -0,0 +1,44 @@
+#ifndef IMAGEBUFFERPOOL_H
+#define IMAGEBUFFERPOOL_H
+
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/weak_ptr.hpp>
+#include <sensor_msgs/Image.h>
+
+namespace px
+{
+
+// Pool of recycled image messages. Each acquired message is owned by
+// whoever holds the last shared pointer to it (typically intra-process
+// subscribers), and its storage is returned to the pool when that
+// pointer is released instead of being freed.
+class ImageBufferPool: public boost::enable_shared_from_this<ImageBufferPool>
+{
+public:
+    explicit ImageBufferPool(size_t capacity = 4);
+    ~ImageBufferPool();
+
+    // returns an image whose data buffer holds at least dataSize bytes
+    sensor_msgs::ImagePtr acquire(size_t dataSize);
+
+    size_t capacity(void) const;
+    size_t available(void);
+
+private:
+    static void release(boost::weak_ptr<ImageBufferPool> pool,
+                        sensor_msgs::Image* image);
+
+    void recycle(sensor_msgs::Image* image);
+
+    const size_t k_capacity;
+
+    boost::mutex m_mutex;
+    std::vector<sensor_msgs::Image*> m_freeList;
+};
+
+typedef boost::shared_ptr<ImageBufferPool> ImageBufferPoolPtr;
+
+}
+
+#endif
@@ -12,7 +12,8 @@ namespace px
 VRmagicCamera::VRmagicCamera(const std::string& ns,
                              ImageTransportType imageTransportType,
                              float fpsExpected,
-                             const std::string& cameraName)
+                             const std::string& cameraName,
+                             size_t imagePoolSize)
  : m_imageTransportType(imageTransportType)
  , m_cameraName(cameraName)
  , m_nodeHandle(ns)
@@ -20,7 +21,11 @@ VRmagicCamera::VRmagicCamera(const std::string& ns,
  , m_cameraInfoPublisher(m_nodeHandle.advertise<px_comm::CameraInfo>("camera_info", 1))
  , m_cameraInfo(boost::make_shared<px_comm::CameraInfo>())
  , m_rosImage(boost::make_shared<sensor_msgs::Image>())
- , m_isFramePublished(true)
+ , m_imagePool(boost::make_shared<ImageBufferPool>(imagePoolSize))
+ , m_latencyCount(0)
+ , m_latencySum(0.0)
+ , m_latencyMax(0.0)
+ , m_queueOverflows(0)
  , m_sensorPort(-1)
 {
     if (imageTransportType == ROS)
@@ -41,6 +46,7 @@ VRmagicCamera::VRmagicCamera(const std::string& ns,
                                                                                  &m_maxFreq,
                                                                                  0.1, 100),
                                                             TimeStampStatusParam());
+    m_diagnostics.add("Publish latency", this, &VRmagicCamera::latencyDiagnostics);
 }
 
 bool
@@ -195,6 +201,14 @@ VRmagicCamera::cameraInfo(void)
     return m_cameraInfo;
 }
 
+void
+VRmagicCamera::setCameraInfo(const px_comm::CameraInfo& cameraInfo)
+{
+    boost::lock_guard<boost::mutex> lock(m_cameraInfoMutex);
+
+    *m_cameraInfo = cameraInfo;
+}
+
 std::string&
 VRmagicCamera::cameraName(void)
 {
@@ -207,37 +221,29 @@ VRmagicCamera::image(void)
     return m_rosImage;
 }
 
-void
-VRmagicCamera::grabFrame(const ros::Time& stamp, const char* const imageData)
+size_t
+VRmagicCamera::imageDataSize(void) const
 {
-    m_cameraInfo->header.stamp = stamp;
-    m_rosImage->header.stamp = stamp;
-
-    if (m_imageTransportType == DDS)
-    {
-        m_ddsImage->seq = m_rosImage->header.seq;
-        m_ddsImage->stamp_sec = m_rosImage->header.stamp.sec;
-        m_ddsImage->stamp_nsec = m_rosImage->header.stamp.nsec;
-        strncpy(m_ddsImage->frame_id, m_rosImage->header.frame_id.c_str(), 255);
-        m_ddsImage->height = m_rosImage->height;
-        m_ddsImage->width = m_rosImage->width;
-        strncpy(m_ddsImage->encoding, m_rosImage->encoding.c_str(), 255);
-        m_ddsImage->is_bigendian = m_rosImage->is_bigendian;
-        m_ddsImage->step = m_rosImage->step;
-
-        int imageSize = m_rosImage->step * m_rosImage->height;
-        if (m_ddsImage->data.length() != imageSize)
-        {
-            m_ddsImage->data.ensure_length(imageSize, imageSize);
-        }
-        memcpy(m_ddsImage->data.get_contiguous_buffer(), imageData, imageSize);
-    }
-    else
-    {
-        memcpy(&m_rosImage->data.at(0), imageData, m_rosImage->data.size());
-    }
+    return m_rosImage->step * m_rosImage->height;
+}
 
-    m_isFramePublished = false;
+sensor_msgs::ImagePtr
+VRmagicCamera::grabFrame(const ros::Time& stamp, const char* const imageData)
+{
+    // Each frame gets its own message so that intra-process subscribers
+    // can hold on to it without racing against the next grab.
+    sensor_msgs::ImagePtr frame = m_imagePool->acquire(imageDataSize());
+    frame->header.stamp = stamp;
+    frame->header.frame_id = m_rosImage->header.frame_id;
+    frame->height = m_rosImage->height;
+    frame->width = m_rosImage->width;
+    frame->encoding = m_rosImage->encoding;
+    frame->is_bigendian = m_rosImage->is_bigendian;
+    frame->step = m_rosImage->step;
+
+    memcpy(&frame->data.at(0), imageData, frame->data.size());
+
+    return frame;
 }
 
 ros::NodeHandle&
@@ -259,15 +265,28 @@ VRmagicCamera::serviceServer(void)
 }
 
 void
-VRmagicCamera::publishFrame(void)
+VRmagicCamera::publishFrame(const sensor_msgs::ImagePtr& frame,
+                            const ros::WallTime& captureTime)
 {
-    if (m_isFramePublished)
-    {
-        return;
-    }
-
     if (m_imageTransportType == DDS)
     {
+        m_ddsImage->seq = frame->header.seq;
+        m_ddsImage->stamp_sec = frame->header.stamp.sec;
+        m_ddsImage->stamp_nsec = frame->header.stamp.nsec;
+        strncpy(m_ddsImage->frame_id, frame->header.frame_id.c_str(), 255);
+        m_ddsImage->height = frame->height;
+        m_ddsImage->width = frame->width;
+        strncpy(m_ddsImage->encoding, frame->encoding.c_str(), 255);
+        m_ddsImage->is_bigendian = frame->is_bigendian;
+        m_ddsImage->step = frame->step;
+
+        int imageSize = frame->data.size();
+        if (m_ddsImage->data.length() != imageSize)
+        {
+            m_ddsImage->data.ensure_length(imageSize, imageSize);
+        }
+        memcpy(m_ddsImage->data.get_contiguous_buffer(), &frame->data[0], imageSize);
+
         DDS_ReturnCode_t retcode;
 
         retcode = m_ddsImageWriter->write(*m_ddsImage, DDS_HANDLE_NIL);
@@ -278,15 +297,73 @@ VRmagicCamera::publishFrame(void)
     }
     else
     {
-        m_imagePublisher.publish(m_rosImage);
+        // Ownership of the frame passes to the subscribers; its buffer
+        // returns to the pool once the last of them releases it.
+        m_imagePublisher.publish(sensor_msgs::ImageConstPtr(frame));
     }
 
-    m_cameraInfoPublisher.publish(m_cameraInfo);
+    px_comm::CameraInfoPtr cameraInfo;
+    {
+        boost::lock_guard<boost::mutex> lock(m_cameraInfoMutex);
+
+        cameraInfo = boost::make_shared<px_comm::CameraInfo>(*m_cameraInfo);
+    }
+    cameraInfo->header.stamp = frame->header.stamp;
+
+    m_cameraInfoPublisher.publish(cameraInfo);
+
+    double latency = (ros::WallTime::now() - captureTime).toSec();
+    {
+        boost::lock_guard<boost::mutex> lock(m_latencyMutex);
+
+        ++m_latencyCount;
+        m_latencySum += latency;
+        m_latencyMax = std::max(m_latencyMax, latency);
+    }
 
-    m_diagnosticTopic->tick(m_rosImage->header.stamp);
+    m_diagnosticTopic->tick(frame->header.stamp);
     m_diagnostics.update();
+}
+
+void
+VRmagicCamera::countQueueOverflow(void)
+{
+    boost::lock_guard<boost::mutex> lock(m_latencyMutex);
+
+    ++m_queueOverflows;
+}
+
+void
+VRmagicCamera::latencyDiagnostics(diagnostic_updater::DiagnosticStatusWrapper& status)
+{
+    boost::lock_guard<boost::mutex> lock(m_latencyMutex);
+
+    if (m_queueOverflows > 0)
+    {
+        status.summary(diagnostic_msgs::DiagnosticStatus::WARN,
+                       "Frames dropped by full publish queue.");
+    }
+    else
+    {
+        status.summary(diagnostic_msgs::DiagnosticStatus::OK,
+                       "Publish latency within bounds.");
+    }
+
+    double latencyMean = 0.0;
+    if (m_latencyCount > 0)
+    {
+        latencyMean = m_latencySum / m_latencyCount;
+    }
+
+    status.add("Frames published", m_latencyCount);
+    status.add("Mean capture-to-publish latency (ms)", latencyMean * 1000.0);
+    status.add("Max capture-to-publish latency (ms)", m_latencyMax * 1000.0);
+    status.add("Queue overflows", m_queueOverflows);
 
-    m_isFramePublished = true;
+    m_latencyCount = 0;
+    m_latencySum = 0.0;
+    m_latencyMax = 0.0;
+    m_queueOverflows = 0;
 }
 
 }
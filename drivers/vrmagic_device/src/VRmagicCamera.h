@@ -8,6 +8,8 @@
 #include <sensor_msgs/fill_image.h>
 #include <sensor_msgs/Image.h>
 
+#include "ImageBufferPool.h"
+
 // forward declarations
 class DDSDomainParticipant;
 
@@ -32,23 +34,36 @@ public:
     VRmagicCamera(const std::string& ns,
                   ImageTransportType imageTransportType,
                   float fpsExpected,
-                  const std::string& cameraName = std::string());
+                  const std::string& cameraName = std::string(),
+                  size_t imagePoolSize = 4);
 
     bool setup(void);
 
     px_comm::CameraInfoPtr& cameraInfo(void);
+    void setCameraInfo(const px_comm::CameraInfo& cameraInfo);
     std::string& cameraName(void);
+
+    // image metadata (header, dimensions, encoding) applied to every frame
     sensor_msgs::ImagePtr& image(void);
+    size_t imageDataSize(void) const;
 
-    void grabFrame(const ros::Time& stamp, const char* const imageData);
+    // copies the sensor buffer into a pooled image owned by the caller
+    sensor_msgs::ImagePtr grabFrame(const ros::Time& stamp, const char* const imageData);
 
     ros::NodeHandle& nodeHandle(void);
     int& sensorPort(void);
     ros::ServiceServer& serviceServer(void);
 
-    void publishFrame(void);
+    // captureTime is the wall time at which the frame was taken off
+    // the device, and is used for capture-to-publish latency statistics
+    void publishFrame(const sensor_msgs::ImagePtr& frame,
+                      const ros::WallTime& captureTime);
+
+    void countQueueOverflow(void);
 
 private:
+    void latencyDiagnostics(diagnostic_updater::DiagnosticStatusWrapper& status);
+
     ImageTransportType m_imageTransportType;
     std::string m_cameraName;
 
@@ -59,20 +74,27 @@ private:
     image_transport::Publisher m_imagePublisher;
     ros::Publisher m_cameraInfoPublisher;
     px_comm::CameraInfoPtr m_cameraInfo;
+    boost::mutex m_cameraInfoMutex;
     sensor_msgs::ImagePtr m_rosImage;
+    ImageBufferPoolPtr m_imagePool;
 
     // DDS
     DDSDomainParticipant* m_ddsParticipant;
     px_comm::DDSImageDataWriter* m_ddsImageWriter;
     px_comm::DDSImage* m_ddsImage;
 
-    bool m_isFramePublished;
-
     diagnostic_updater::Updater m_diagnostics;
     double m_minFreq;
     double m_maxFreq;
     boost::shared_ptr<diagnostic_updater::TopicDiagnostic> m_diagnosticTopic;
 
+    // latency statistics since the last diagnostics update
+    boost::mutex m_latencyMutex;
+    int m_latencyCount;
+    double m_latencySum;
+    double m_latencyMax;
+    int m_queueOverflows;
+
     int m_sensorPort;
 };
 
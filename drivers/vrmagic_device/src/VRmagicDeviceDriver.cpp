@@ -11,7 +11,10 @@ namespace px
 
 VRmagicDeviceDriver::VRmagicDeviceDriver(ros::NodeHandle nh)
  : m_nh(nh, "vrmagic")
- , k_triggerBufferSize(20)
+ , k_frameQueueSize(32)
+ , m_frameQueue(k_frameQueueSize)
+ , m_publishThreadRunning(false)
+ , m_publishFrameSet(true)
  , m_state(driver_base::Driver::CLOSED)
  , m_reconfiguring(false)
  , m_server(m_nh)
@@ -20,6 +23,12 @@ VRmagicDeviceDriver::VRmagicDeviceDriver(ros::NodeHandle nh)
     m_triggerSub = nh.subscribe<asctec_hl_comm::CamTrigger>("fcu/cam_trigger", 5, boost::bind(&VRmagicDeviceDriver::cbTrigger, this, _1));
 
     m_config = vrmagic_device::VRmagicDeviceConfig::__getDefault__();
+
+    // maximum time to wait for a late trigger message
+    m_nh.param("trigger_max_wait", m_triggerSync.maxWait(), 0.005);
+
+    // publish the frames of all cameras together on the frame_set topic
+    m_nh.param("publish_frame_set", m_publishFrameSet, true);
 }
 
 VRmagicDeviceDriver::~VRmagicDeviceDriver()
@@ -61,7 +70,6 @@ VRmagicDeviceDriver::poll(void)
         {
             if (grabFrames())
             {
-                publishFrames();
                 doSleep = false;
             }
             else
@@ -83,14 +91,32 @@ VRmagicDeviceDriver::poll(void)
 void
 VRmagicDeviceDriver::cbTrigger(const asctec_hl_comm::CamTriggerConstPtr& trigger)
 {
-    boost::unique_lock<boost::mutex> lock(m_triggerBufferMutex);
+    m_triggerSync.addTrigger(trigger->frame_counter, trigger->header.stamp.toNSec());
+}
 
-    m_triggerBuffer.push_back(std::make_pair(trigger->frame_counter, trigger->header.stamp));
+bool
+VRmagicDeviceDriver::findTriggerStamp(uint32_t frameCounter, uint64_t deviceStamp,
+                                      uint64_t arrivalStamp, ros::Time& stamp)
+{
+    uint64_t stampNSec;
+    TriggerSynchronizer::MatchResult result =
+        m_triggerSync.synchronize(frameCounter, deviceStamp, arrivalStamp, stampNSec);
 
-    while (m_triggerBuffer.size() > k_triggerBufferSize)
+    switch (result)
     {
-        m_triggerBuffer.pop_front();
+    case TriggerSynchronizer::MATCHED:
+        break;
+    case TriggerSynchronizer::PREDICTED:
+        ROS_DEBUG("Predicted trigger stamp for frame %u (clock drift: %.1f ppm)",
+                  frameCounter, m_triggerSync.clockDrift() * 1e6);
+        break;
+    default:
+        return false;
     }
+
+    stamp.fromNSec(stampNSec);
+
+    return true;
 }
 
 void
@@ -220,6 +246,25 @@ VRmagicDeviceDriver::startDevice(int deviceId,
 //                                     VRM_PROPID_GRAB_SOURCE_FORMAT_8BIT_RLE);
 //     }
 
+     // Image transport: "dds" publishes over the DDS bridge; "ros" publishes
+     // pooled per-frame messages which are passed without copying to
+     // subscribers in the same process (e.g. a nodelet manager).
+     std::string transport;
+     m_nh.param("transport", transport, std::string("dds"));
+
+     VRmagicCamera::ImageTransportType transportType = VRmagicCamera::DDS;
+     if (transport == "ros")
+     {
+         transportType = VRmagicCamera::ROS;
+     }
+     else if (transport != "dds")
+     {
+         ROS_WARN("Unknown transport %s; defaulting to dds.", transport.c_str());
+     }
+
+     int imagePoolSize;
+     m_nh.param("image_pool_size", imagePoolSize, 4);
+
      // set ringbuffer size
      m_device->set_PropertyValue(VRM_PROPID_GRAB_HOST_RINGBUFFER_SIZE_I,
                                  static_cast<int>(m_cameras.size()) * 2);
@@ -244,9 +289,10 @@ VRmagicDeviceDriver::startDevice(int deviceId,
          }
          oss << "cam" << cameraId;
          camera = boost::make_shared<VRmagicCamera>(oss.str(),
-                                                    VRmagicCamera::DDS,
+                                                    transportType,
                                                     config.frame_rate,
-                                                    cameraName);
+                                                    cameraName,
+                                                    imagePoolSize);
 
          camera->cameraInfo()->header.frame_id = m_config.frame_id;
          camera->cameraInfo()->camera_name = cameraName;
@@ -257,7 +303,6 @@ VRmagicDeviceDriver::startDevice(int deviceId,
          camera->image()->height = imageSize.m_height;
          camera->image()->step = imageSize.m_width;
          camera->image()->encoding = sensor_msgs::image_encodings::MONO8;
-         camera->image()->data.resize(camera->image()->step * camera->image()->height);
          camera->image()->header.frame_id = m_config.frame_id;
 
          camera->sensorPort() = sensorPort;
@@ -292,6 +337,20 @@ VRmagicDeviceDriver::startDevice(int deviceId,
              m_cameras.at(i)->nodeHandle().advertiseService<px_comm::SetCameraInfo::Request, px_comm::SetCameraInfo::Response>("set_camera_info", boost::bind(&VRmagicDeviceDriver::updateCameraInfo, this, _1, _2, m_cameras.at(i)));
      }
 
+     if (m_publishFrameSet)
+     {
+         std::vector<std::string> cameraNs;
+         for (size_t i = 0; i < m_cameras.size(); ++i)
+         {
+             cameraNs.push_back(m_cameras.at(i)->nodeHandle().getNamespace());
+         }
+
+         m_frameSetAssembler = boost::make_shared<FrameSetAssembler>(cameraNs);
+         m_frameSetPub = m_nh.advertise<multicam_msgs::FrameSet>("frame_set", 2);
+     }
+
+     startPublishThread();
+
      m_state = driver_base::Driver::RUNNING;
 
      return true;
@@ -519,8 +578,7 @@ VRmagicDeviceDriver::reconfigureDevice(const vrmagic_device::VRmagicDeviceConfig
             m_device->set_PropertyValue(VRM_PROPID_GRAB_MODE_E, VRM_PROPID_GRAB_MODE_TRIGGERED_EXT);
             m_device->set_PropertyValue(VRM_PROPID_CAM_TRIGGER_POLARITY_E, VRM_PROPID_CAM_TRIGGER_POLARITY_NEG_EDGE);
 
-            boost::unique_lock<boost::mutex> lock(m_triggerBufferMutex);
-            m_triggerBuffer.clear();
+            m_triggerSync.reset();
 
             asctec_hl_comm::CamTriggerSrv::Request req;
             asctec_hl_comm::CamTriggerSrv::Response res;
@@ -561,6 +619,11 @@ VRmagicDeviceDriver::stopDevice(void)
 {
     if (m_state != driver_base::Driver::CLOSED)
     {
+        stopPublishThread();
+
+        m_frameSetPub.shutdown();
+        m_frameSetAssembler.reset();
+
         m_device->Stop();
 
         ROS_INFO("Stopped VRmagic device.");
@@ -590,62 +653,54 @@ VRmagicDeviceDriver::grabFrames(void)
             ImagePtr imageRaw = m_device->LockNextImage(0, &framesDropped);
 
             VRmagicCameraPtr& camera = m_cameraMap.at(imageRaw->get_SensorPort());
-            ros::Time hw_stamp;
-
-            bool foundStamp = false;
-            unsigned int frameCounter = imageRaw->get_FrameCounter();
-
-            if (m_config.external_trigger)
-            {
-                boost::unique_lock<boost::mutex> lock(m_triggerBufferMutex);
-                for (std::list<std::pair<unsigned int, ros::Time> >::reverse_iterator rit = m_triggerBuffer.rbegin();
-                     rit != m_triggerBuffer.rend(); ++rit)
-                {
-                    if (frameCounter > rit->first)
-                    {
-                        break;
-                    }
-                    else if (frameCounter == rit->first)
-                    {
-                        hw_stamp = rit->second;
-                        foundStamp = true;
-
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                hw_stamp = ros::Time(imageRaw->get_TimeStamp() / 1000.0);
-                foundStamp = true;
-            }
 
             if (framesDropped > 0)
             {
                 ROS_WARN("[%s] Dropped %d frames.", camera->cameraName().c_str(), framesDropped);
             }
 
-            if (foundStamp)
+            if (camera->imageDataSize() != imageRaw->get_BufferSize())
             {
-                char* buffer = reinterpret_cast<char*>(imageRaw->get_Buffer());
+                ROS_WARN("Sizes of source and destination images do not match.");
 
-                if (camera->image()->data.size() != imageRaw->get_BufferSize())
-                {
-                    ROS_WARN("Sizes of source and destination images do not match.");
+                m_device->UnlockNextImage(imageRaw);
+                continue;
+            }
 
-                    m_device->UnlockNextImage(imageRaw);
-                    continue;
-                }
+            char* buffer = reinterpret_cast<char*>(imageRaw->get_Buffer());
 
-                camera->grabFrame(hw_stamp, buffer);
-            }
-            else
+            CapturedFrame frame;
+            frame.camera = camera.get();
+            frame.cameraId = camera->sensorPort() - 1;
+            frame.frameCounter = imageRaw->get_FrameCounter();
+            frame.captureTime = ros::WallTime::now();
+            frame.externalTrigger = m_config.external_trigger;
+            // device time stamp is in ms
+            frame.deviceStamp = static_cast<uint64_t>(imageRaw->get_TimeStamp() * 1e6);
+            frame.arrivalStamp = ros::Time::now().toNSec();
+
+            // externally triggered frames are stamped by the publish thread
+            ros::Time hw_stamp;
+            if (!frame.externalTrigger)
             {
-                ROS_WARN("[%s] Did not find trigger info for frame %u", camera->cameraName().c_str(), frameCounter);
+                hw_stamp.fromNSec(frame.deviceStamp);
             }
+            frame.image = camera->grabFrame(hw_stamp, buffer);
 
             m_device->UnlockNextImage(imageRaw);
 
+            if (m_frameQueue.push(frame))
+            {
+                // notify under the mutex so that the publish thread cannot
+                // miss the frame between checking the queue and waiting
+                boost::lock_guard<boost::mutex> lock(m_frameQueueMutex);
+                m_frameQueueCond.notify_one();
+            }
+            else
+            {
+                camera->countQueueOverflow();
+            }
+
             ++nGrabs;
         }
     }
@@ -671,13 +726,93 @@ VRmagicDeviceDriver::grabFrames(void)
 }
 
 void
-VRmagicDeviceDriver::publishFrames(void)
+VRmagicDeviceDriver::startPublishThread(void)
 {
-    boost::unique_lock<boost::mutex> lock(m_deviceMutex);
+    m_publishThreadRunning = true;
+    m_publishThread = boost::make_shared<boost::thread>(boost::bind(&VRmagicDeviceDriver::publishThread, this));
+}
 
-    for (size_t i = 0; i < m_cameras.size(); ++i)
+void
+VRmagicDeviceDriver::stopPublishThread(void)
+{
+    if (!m_publishThread)
+    {
+        return;
+    }
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_frameQueueMutex);
+        m_publishThreadRunning = false;
+        m_frameQueueCond.notify_one();
+    }
+
+    m_publishThread->join();
+    m_publishThread.reset();
+
+    // discard frames that were captured but not published
+    CapturedFrame frame;
+    while (m_frameQueue.pop(frame))
     {
-        m_cameras.at(i)->publishFrame();
+    }
+}
+
+void
+VRmagicDeviceDriver::publishThread(void)
+{
+    CapturedFrame frame;
+
+    while (true)
+    {
+        while (m_frameQueue.pop(frame))
+        {
+            if (frame.externalTrigger &&
+                !findTriggerStamp(frame.frameCounter, frame.deviceStamp,
+                                  frame.arrivalStamp, frame.image->header.stamp))
+            {
+                ROS_WARN("[%s] Did not find trigger info for frame %u",
+                         frame.camera->cameraName().c_str(), frame.frameCounter);
+
+                frame.image.reset();
+                continue;
+            }
+
+            frame.camera->publishFrame(frame.image, frame.captureTime);
+
+            // frame sets cost one more copy per image, so they are only
+            // assembled while someone listens
+            if (m_frameSetAssembler && m_frameSetPub.getNumSubscribers() > 0)
+            {
+                size_t droppedCount = m_frameSetAssembler->droppedCount();
+
+                multicam_msgs::FrameSetPtr frameSet =
+                    m_frameSetAssembler->add(frame.cameraId, frame.frameCounter, *frame.image);
+                if (frameSet)
+                {
+                    m_frameSetPub.publish(frameSet);
+                }
+
+                if (m_frameSetAssembler->droppedCount() > droppedCount)
+                {
+                    ROS_WARN_THROTTLE(1.0, "Dropped incomplete frame set(s); %lu in total.",
+                                      m_frameSetAssembler->droppedCount());
+                }
+            }
+
+            // release the image so that its buffer returns to the pool
+            // as soon as the subscribers are done with it
+            frame.image.reset();
+        }
+
+        boost::unique_lock<boost::mutex> lock(m_frameQueueMutex);
+        while (m_publishThreadRunning && m_frameQueue.read_available() == 0)
+        {
+            m_frameQueueCond.wait(lock);
+        }
+
+        if (!m_publishThreadRunning)
+        {
+            break;
+        }
     }
 }
 
@@ -688,7 +823,7 @@ VRmagicDeviceDriver::updateCameraInfo(px_comm::SetCameraInfo::Request& req,
 {
     boost::unique_lock<boost::mutex> lock(m_deviceMutex);
 
-    *(camera->cameraInfo()) = req.camera_info;
+    camera->setCameraInfo(req.camera_info);
 
     writeCameraInfo();
 
@@ -717,14 +852,17 @@ VRmagicDeviceDriver::readCameraInfo(void)
 
         for (size_t i = 0; i < m_cameras.size(); ++i)
         {
-            ros::serialization::deserialize(stream, *(m_cameras.at(i)->cameraInfo()));
+            px_comm::CameraInfo cameraInfo;
+            ros::serialization::deserialize(stream, cameraInfo);
+
+            m_cameras.at(i)->setCameraInfo(cameraInfo);
         }
     }
     catch (std::exception& e)
     {
         for (size_t i = 0; i < m_cameras.size(); ++i)
         {
-            *(m_cameras.at(i)->cameraInfo()) = px_comm::CameraInfo();
+            m_cameras.at(i)->setCameraInfo(px_comm::CameraInfo());
         }
 
         m_device->SaveUserData(std::vector<unsigned char>());
@@ -1,13 +1,16 @@
 #ifndef VRMAGICDEVICEDRIVER_H
 #define VRMAGICDEVICEDRIVER_H
 
+#include <boost/lockfree/spsc_queue.hpp>
 #include <ros/ros.h>
 #include <driver_base/driver.h>
 #include <dynamic_reconfigure/server.h>
 #include <asctec_hl_comm/CamTrigger.h>
+#include <cauldron/TriggerSynchronizer.h>
 #include <px_comm/SetCameraInfo.h>
 
 #include "vrmagic_device/VRmagicDeviceConfig.h"
+#include "FrameSetAssembler.h"
 #include "vrmusbcamcpp.h"
 #include "VRmagicCamera.h"
 
@@ -39,7 +42,13 @@ private:
     bool stopDevice(void);
 
     bool grabFrames(void);
-    void publishFrames(void);
+    // may wait for the trigger event; only called by the publish thread
+    bool findTriggerStamp(uint32_t frameCounter, uint64_t deviceStamp,
+                          uint64_t arrivalStamp, ros::Time& stamp);
+
+    void startPublishThread(void);
+    void stopPublishThread(void);
+    void publishThread(void);
 
     bool updateCameraInfo(px_comm::SetCameraInfo::Request& req,
                           px_comm::SetCameraInfo::Response& res,
@@ -54,9 +63,37 @@ private:
     ros::NodeHandle m_nh;
     ros::Subscriber m_triggerSub;
 
-    boost::mutex m_triggerBufferMutex;
-    const size_t k_triggerBufferSize;
-    std::list<std::pair<unsigned int, ros::Time> > m_triggerBuffer;
+    // matches trigger stamps to frames by frame counter
+    TriggerSynchronizer m_triggerSync;
+
+    // frames handed from the capture thread (poll) to the publish thread,
+    // which stamps externally triggered frames so that capture does not
+    // wait for trigger events
+    struct CapturedFrame
+    {
+        VRmagicCamera* camera;
+        int cameraId;
+        uint32_t frameCounter;
+        sensor_msgs::ImagePtr image;
+        ros::WallTime captureTime;
+        bool externalTrigger;
+        // device and arrival stamps in ns
+        uint64_t deviceStamp;
+        uint64_t arrivalStamp;
+    };
+
+    const size_t k_frameQueueSize;
+    boost::lockfree::spsc_queue<CapturedFrame> m_frameQueue;
+    boost::mutex m_frameQueueMutex;
+    boost::condition_variable m_frameQueueCond;
+    bool m_publishThreadRunning;
+    boost::shared_ptr<boost::thread> m_publishThread;
+
+    // frames of all cameras captured on the same trigger, published as
+    // one message; only used by the publish thread
+    bool m_publishFrameSet;
+    ros::Publisher m_frameSetPub;
+    boost::shared_ptr<FrameSetAssembler> m_frameSetAssembler;
 
     VRmUsbCamCPP::DevicePtr m_device;
     boost::mutex m_deviceMutex;
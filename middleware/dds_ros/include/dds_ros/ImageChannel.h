@@ -0,0 +1,81 @@
+#ifndef IMAGECHANNEL_H
+#define IMAGECHANNEL_H
+
+#include <boost/cstdint.hpp>
+#include <boost/shared_ptr.hpp>
+#include <string>
+
+namespace px
+{
+
+// Image metadata carried alongside the pixel data. The fields mirror
+// sensor_msgs/Image and px_comm/DDSImage.
+struct ImageMetadata
+{
+    uint32_t seq;
+    uint32_t stampSec;
+    uint32_t stampNSec;
+    char frameId[256];
+    uint32_t height;
+    uint32_t width;
+    char encoding[256];
+    uint8_t isBigendian;
+    uint32_t step;
+    uint32_t dataSize;
+};
+
+// Publishing end of an image channel. The writer loans out a buffer
+// owned by the transport, the caller fills in the metadata and data in
+// place, and publish() makes the image visible to readers.
+class ImageChannelWriter
+{
+public:
+    virtual ~ImageChannelWriter() {}
+
+    virtual bool loan(size_t dataSize,
+                      ImageMetadata*& metadata,
+                      unsigned char*& data) = 0;
+    virtual bool publish(void) = 0;
+};
+
+// Receiving end of an image channel. take() loans out the next image;
+// the metadata and data may point directly into transport memory and
+// stay valid until returnLoan() is called.
+class ImageChannelReader
+{
+public:
+    virtual ~ImageChannelReader() {}
+
+    // waits at most timeout seconds for an image
+    virtual bool take(double timeout,
+                      const ImageMetadata*& metadata,
+                      const unsigned char*& data) = 0;
+    virtual void returnLoan(void) = 0;
+};
+
+typedef boost::shared_ptr<ImageChannelWriter> ImageChannelWriterPtr;
+typedef boost::shared_ptr<ImageChannelReader> ImageChannelReaderPtr;
+
+struct ImageChannelOptions
+{
+    ImageChannelOptions();
+
+    // shared memory backend
+    size_t shmSlotCount;    // number of images in the ring
+    size_t shmSlotSize;     // maximum image data size in bytes
+};
+
+// Creates a channel for the given topic. Supported backends are
+// "shm" (POSIX shared memory ring, same host only) and "dds"
+// (RTI Connext, only if built with RTI). Returns a null pointer if
+// the backend is unknown or cannot be set up.
+ImageChannelWriterPtr createImageChannelWriter(const std::string& backend,
+                                               const std::string& topic,
+                                               const ImageChannelOptions& options = ImageChannelOptions());
+ImageChannelReaderPtr createImageChannelReader(const std::string& backend,
+                                               const std::string& topic,
+                                               const ImageChannelOptions& options = ImageChannelOptions());
+
+}
+
+#endif
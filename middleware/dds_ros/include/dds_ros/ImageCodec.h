@@ -0,0 +1,74 @@
+#ifndef IMAGECODEC_H
+#define IMAGECODEC_H
+
+#include <string>
+#include <vector>
+
+#include "dds_ros/ImageChannel.h"
+
+namespace px
+{
+
+// Optional encoding stage for images sent over an image channel.
+//
+// An encoded image carries its payload format in the encoding field as
+// "<image encoding>;<format>", e.g. "mono8;png". Width, height and step
+// describe the decoded image, and dataSize is the size of the payload.
+// Raw images keep their plain image encoding, so readers that predate
+// the codec still understand them.
+//
+// Pyramid downscaling halves the image resolution per level. Bayer
+// images are demosaiced to bgr8 before they are downscaled or JPEG
+// compressed, since neither preserves the Bayer pattern.
+class ImageCodec
+{
+public:
+    enum Format
+    {
+        RAW,
+        PNG,
+        JPEG
+    };
+
+    ImageCodec();
+
+    Format& format(void);
+    Format format(void) const;
+
+    int& jpegQuality(void);
+    int jpegQuality(void) const;
+
+    int& pngCompression(void);
+    int pngCompression(void) const;
+
+    int& pyramidLevels(void);
+    int pyramidLevels(void) const;
+
+    // returns true if encode() leaves the image as it is
+    bool isPassThrough(void) const;
+
+    bool encode(const ImageMetadata& metadata,
+                const unsigned char* data,
+                ImageMetadata& encodedMetadata,
+                std::vector<unsigned char>& buffer) const;
+
+    static bool decode(const ImageMetadata& metadata,
+                       const unsigned char* data,
+                       ImageMetadata& decodedMetadata,
+                       std::vector<unsigned char>& buffer);
+
+    static bool isEncoded(const ImageMetadata& metadata);
+
+    static bool parseFormat(const std::string& name, Format& format);
+    static std::string formatName(Format format);
+
+private:
+    Format m_format;
+    int m_jpegQuality;
+    int m_pngCompression;
+    int m_pyramidLevels;
+};
+
+}
+
+#endif
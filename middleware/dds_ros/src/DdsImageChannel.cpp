@@ -0,0 +1,436 @@
+#include "DdsImageChannel.h"
+
+#include <boost/thread/mutex.hpp>
+#include <ros/ros.h>
+
+#include "dds_ros/utils.h"
+
+namespace px
+{
+
+namespace
+{
+
+// All channels of one role in a process share a domain participant.
+class SharedParticipant
+{
+public:
+    explicit SharedParticipant(DDS_TransportBuiltinKindMask transport)
+     : m_transport(transport)
+     , m_participant(0)
+     , m_refCount(0)
+    {
+
+    }
+
+    DDSDomainParticipant* acquire(void)
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        if (m_participant == 0)
+        {
+            m_participant = createDDSParticipant(0, m_transport);
+            if (m_participant == 0)
+            {
+                return 0;
+            }
+
+            // register type before creating topics
+            const char* type_name = px_comm::DDSImageTypeSupport::get_type_name();
+            DDS_ReturnCode_t retcode = px_comm::DDSImageTypeSupport::register_type(m_participant, type_name);
+            if (retcode != DDS_RETCODE_OK)
+            {
+                ROS_ERROR("register_type error %d", retcode);
+                ddsShutdown(m_participant);
+                m_participant = 0;
+                return 0;
+            }
+        }
+
+        ++m_refCount;
+
+        return m_participant;
+    }
+
+    void release(void)
+    {
+        boost::lock_guard<boost::mutex> lock(m_mutex);
+
+        if (m_refCount > 0 && --m_refCount == 0)
+        {
+            ddsShutdown(m_participant);
+            m_participant = 0;
+        }
+    }
+
+private:
+    DDS_TransportBuiltinKindMask m_transport;
+    DDSDomainParticipant* m_participant;
+    int m_refCount;
+    boost::mutex m_mutex;
+};
+
+SharedParticipant&
+writerParticipant(void)
+{
+    static SharedParticipant participant(DDS_TRANSPORTBUILTIN_UDPv4 | DDS_TRANSPORTBUILTIN_SHMEM);
+    return participant;
+}
+
+SharedParticipant&
+readerParticipant(void)
+{
+    static SharedParticipant participant(DDS_TRANSPORTBUILTIN_UDPv4);
+    return participant;
+}
+
+}
+
+DdsImageChannelWriter::DdsImageChannelWriter()
+ : m_ddsParticipant(0)
+ , m_ddsImageWriter(0)
+ , m_ddsImage(0)
+ , m_loaned(false)
+{
+
+}
+
+DdsImageChannelWriter::~DdsImageChannelWriter()
+{
+    if (m_ddsImage != 0)
+    {
+        px_comm::DDSImageTypeSupport::delete_data(m_ddsImage);
+    }
+
+    if (m_ddsParticipant != 0)
+    {
+        writerParticipant().release();
+    }
+}
+
+bool
+DdsImageChannelWriter::init(const std::string& topicName)
+{
+    m_ddsParticipant = writerParticipant().acquire();
+    if (m_ddsParticipant == 0)
+    {
+        return false;
+    }
+
+    DDSPublisher* ddsPublisher =
+        m_ddsParticipant->create_publisher(DDS_PUBLISHER_QOS_DEFAULT, 0, DDS_STATUS_MASK_NONE);
+    if (ddsPublisher == 0)
+    {
+        ROS_ERROR("create_publisher error");
+        return false;
+    }
+
+    DDS_DataWriterQos writer_qos;
+    DDS_ReturnCode_t retcode = ddsPublisher->get_default_datawriter_qos(writer_qos);
+
+    if (retcode != DDS_RETCODE_OK)
+    {
+        ROS_ERROR("get_default_datawriter_qos error %d", retcode);
+        return false;
+    }
+
+    // use non-strict reliability model
+    writer_qos.publish_mode.kind = DDS_ASYNCHRONOUS_PUBLISH_MODE_QOS;
+    writer_qos.liveliness.lease_duration.sec = 1;
+    writer_qos.liveliness.lease_duration.nanosec = 0;
+
+    writer_qos.reliability.kind = DDS_RELIABLE_RELIABILITY_QOS;
+    writer_qos.history.kind = DDS_KEEP_LAST_HISTORY_QOS;
+    writer_qos.history.depth = 2;
+
+    writer_qos.resource_limits.max_samples =
+            writer_qos.resource_limits.initial_samples = 2;
+    writer_qos.resource_limits.max_samples_per_instance =
+            writer_qos.resource_limits.max_samples;
+
+    writer_qos.protocol.rtps_reliable_writer.heartbeats_per_max_samples = 1;
+
+    writer_qos.protocol.rtps_reliable_writer.high_watermark = 1;
+    writer_qos.protocol.rtps_reliable_writer.low_watermark = 0;
+
+    DDSTopic* topic =
+        m_ddsParticipant->create_topic(topicName.c_str(),
+                                       px_comm::DDSImageTypeSupport::get_type_name(),
+                                       DDS_TOPIC_QOS_DEFAULT, 0, DDS_STATUS_MASK_NONE);
+    if (topic == 0)
+    {
+        ROS_ERROR("create_topic error");
+        return false;
+    }
+
+    DDSDataWriter* writer =
+        ddsPublisher->create_datawriter(topic, writer_qos, 0, DDS_STATUS_MASK_NONE);
+    if (writer == 0)
+    {
+        ROS_ERROR("create_datawriter error");
+        return false;
+    }
+
+    m_ddsImageWriter = px_comm::DDSImageDataWriter::narrow(writer);
+    if (m_ddsImageWriter == 0)
+    {
+        ROS_ERROR("DataWriter narrow error");
+        return false;
+    }
+
+    m_ddsImage = px_comm::DDSImageTypeSupport::create_data();
+    if (m_ddsImage == 0)
+    {
+        ROS_ERROR("create_data error");
+        return false;
+    }
+
+    return true;
+}
+
+bool
+DdsImageChannelWriter::loan(size_t dataSize,
+                            ImageMetadata*& metadata,
+                            unsigned char*& data)
+{
+    if (m_loaned)
+    {
+        return false;
+    }
+
+    if (m_ddsImage->data.length() != static_cast<int>(dataSize))
+    {
+        m_ddsImage->data.ensure_length(dataSize, dataSize);
+    }
+
+    metadata = &m_metadata;
+    data = reinterpret_cast<unsigned char*>(m_ddsImage->data.get_contiguous_buffer());
+
+    m_loaned = true;
+
+    return true;
+}
+
+bool
+DdsImageChannelWriter::publish(void)
+{
+    if (!m_loaned)
+    {
+        return false;
+    }
+    m_loaned = false;
+
+    m_ddsImage->seq = m_metadata.seq;
+    m_ddsImage->stamp_sec = m_metadata.stampSec;
+    m_ddsImage->stamp_nsec = m_metadata.stampNSec;
+    strncpy(m_ddsImage->frame_id, m_metadata.frameId, 255);
+    m_ddsImage->height = m_metadata.height;
+    m_ddsImage->width = m_metadata.width;
+    strncpy(m_ddsImage->encoding, m_metadata.encoding, 255);
+    m_ddsImage->is_bigendian = m_metadata.isBigendian;
+    m_ddsImage->step = m_metadata.step;
+
+    DDS_ReturnCode_t retcode = m_ddsImageWriter->write(*m_ddsImage, DDS_HANDLE_NIL);
+    if (retcode != DDS_RETCODE_OK)
+    {
+        ROS_ERROR("write error %d", retcode);
+        return false;
+    }
+
+    return true;
+}
+
+DdsImageChannelReader::DdsImageChannelReader()
+ : m_ddsParticipant(0)
+ , m_ddsImageReader(0)
+ , m_waitset(0)
+ , m_loaned(false)
+{
+
+}
+
+DdsImageChannelReader::~DdsImageChannelReader()
+{
+    returnLoan();
+
+    delete m_waitset;
+
+    if (m_ddsParticipant != 0)
+    {
+        readerParticipant().release();
+    }
+}
+
+bool
+DdsImageChannelReader::init(const std::string& topicName)
+{
+    m_ddsParticipant = readerParticipant().acquire();
+    if (m_ddsParticipant == 0)
+    {
+        return false;
+    }
+
+    DDSSubscriber* ddsSubscriber =
+        m_ddsParticipant->create_subscriber(DDS_SUBSCRIBER_QOS_DEFAULT, 0, DDS_STATUS_MASK_NONE);
+    if (ddsSubscriber == 0)
+    {
+        ROS_ERROR("create_subscriber error");
+        return false;
+    }
+
+    DDS_DataReaderQos reader_qos;
+    DDS_ReturnCode_t retcode = ddsSubscriber->get_default_datareader_qos(reader_qos);
+
+    if (retcode != DDS_RETCODE_OK)
+    {
+        ROS_ERROR("get_default_datareader_qos error %d", retcode);
+        return false;
+    }
+
+    // use non-strict reliability model
+    reader_qos.reliability.kind = DDS_RELIABLE_RELIABILITY_QOS;
+    reader_qos.history.kind = DDS_KEEP_ALL_HISTORY_QOS;
+
+    DDSTopic* topic =
+        m_ddsParticipant->create_topic(topicName.c_str(),
+                                       px_comm::DDSImageTypeSupport::get_type_name(),
+                                       DDS_TOPIC_QOS_DEFAULT, 0, DDS_STATUS_MASK_NONE);
+    if (topic == 0)
+    {
+        ROS_ERROR("create_topic error");
+        return false;
+    }
+
+    DDSDataReader* ddsReader =
+        ddsSubscriber->create_datareader(topic, reader_qos, 0, DDS_STATUS_MASK_NONE);
+    if (ddsReader == 0)
+    {
+        ROS_ERROR("create_datareader error");
+        return false;
+    }
+
+    DDSStatusCondition* statusCondition = ddsReader->get_statuscondition();
+    if (statusCondition == 0)
+    {
+        ROS_ERROR("get_statuscondition error");
+        return false;
+    }
+
+    retcode = statusCondition->set_enabled_statuses(DDS_DATA_AVAILABLE_STATUS);
+    if (retcode != DDS_RETCODE_OK)
+    {
+        ROS_ERROR("set_enabled_statuses error %d", retcode);
+        return false;
+    }
+
+    m_waitset = new DDSWaitSet();
+    retcode = m_waitset->attach_condition(statusCondition);
+    if (retcode != DDS_RETCODE_OK)
+    {
+        ROS_ERROR("attach_condition error %d", retcode);
+        return false;
+    }
+
+    m_ddsImageReader = px_comm::DDSImageDataReader::narrow(ddsReader);
+    if (m_ddsImageReader == 0)
+    {
+        ROS_ERROR("DataReader narrow error");
+        return false;
+    }
+
+    return true;
+}
+
+bool
+DdsImageChannelReader::take(double timeout,
+                            const ImageMetadata*& metadata,
+                            const unsigned char*& data)
+{
+    returnLoan();
+
+    // take one sample at a time so that each image is loaned separately
+    DDS_ReturnCode_t retcode = m_ddsImageReader->take(m_dataSeq, m_infoSeq, 1,
+                                                      DDS_ANY_SAMPLE_STATE,
+                                                      DDS_ANY_VIEW_STATE,
+                                                      DDS_ANY_INSTANCE_STATE);
+    if (retcode == DDS_RETCODE_NO_DATA)
+    {
+        DDS_Duration_t wait_timeout;
+        wait_timeout.sec = static_cast<DDS_Long>(timeout);
+        wait_timeout.nanosec = static_cast<DDS_UnsignedLong>((timeout - wait_timeout.sec) * 1e9);
+
+        DDSConditionSeq activeConditionsSeq;
+        retcode = m_waitset->wait(activeConditionsSeq, wait_timeout);
+        if (retcode == DDS_RETCODE_TIMEOUT)
+        {
+            return false;
+        }
+        else if (retcode != DDS_RETCODE_OK)
+        {
+            ROS_ERROR("wait error: %d", retcode);
+            return false;
+        }
+
+        retcode = m_ddsImageReader->take(m_dataSeq, m_infoSeq, 1,
+                                         DDS_ANY_SAMPLE_STATE,
+                                         DDS_ANY_VIEW_STATE,
+                                         DDS_ANY_INSTANCE_STATE);
+    }
+
+    if (retcode == DDS_RETCODE_NO_DATA)
+    {
+        return false;
+    }
+    else if (retcode != DDS_RETCODE_OK)
+    {
+        ROS_WARN("take error %d", retcode);
+        return false;
+    }
+
+    m_loaned = true;
+
+    if (m_dataSeq.length() == 0 || !m_infoSeq[0].valid_data)
+    {
+        returnLoan();
+        return false;
+    }
+
+    const px_comm::DDSImage& ddsImage = m_dataSeq[0];
+
+    m_metadata.seq = ddsImage.seq;
+    m_metadata.stampSec = ddsImage.stamp_sec;
+    m_metadata.stampNSec = ddsImage.stamp_nsec;
+    strncpy(m_metadata.frameId, ddsImage.frame_id, 255);
+    m_metadata.frameId[255] = '\0';
+    m_metadata.height = ddsImage.height;
+    m_metadata.width = ddsImage.width;
+    strncpy(m_metadata.encoding, ddsImage.encoding, 255);
+    m_metadata.encoding[255] = '\0';
+    m_metadata.isBigendian = ddsImage.is_bigendian;
+    m_metadata.step = ddsImage.step;
+    m_metadata.dataSize = ddsImage.data.length();
+
+    metadata = &m_metadata;
+    data = reinterpret_cast<const unsigned char*>(ddsImage.data.get_contiguous_buffer());
+
+    return true;
+}
+
+void
+DdsImageChannelReader::returnLoan(void)
+{
+    if (!m_loaned)
+    {
+        return;
+    }
+
+    DDS_ReturnCode_t retcode = m_ddsImageReader->return_loan(m_dataSeq, m_infoSeq);
+    if (retcode != DDS_RETCODE_OK)
+    {
+        ROS_WARN("return_loan error %d", retcode);
+    }
+
+    m_loaned = false;
+}
+
+}
@@ -0,0 +1,64 @@
+#ifndef DDSIMAGECHANNEL_H
+#define DDSIMAGECHANNEL_H
+
+#include <ndds/ndds_cpp.h>
+#include <px_comm/DDSImage.h>
+#include <px_comm/DDSImageSupport.h>
+
+#include "dds_ros/ImageChannel.h"
+
+namespace px
+{
+
+// RTI Connext backend. The writer loans out the data buffer of its own
+// DDS sample; the reader loans samples from the DDS data reader.
+class DdsImageChannelWriter: public ImageChannelWriter
+{
+public:
+    DdsImageChannelWriter();
+    ~DdsImageChannelWriter();
+
+    bool init(const std::string& topic);
+
+    virtual bool loan(size_t dataSize,
+                      ImageMetadata*& metadata,
+                      unsigned char*& data);
+    virtual bool publish(void);
+
+private:
+    DDSDomainParticipant* m_ddsParticipant;
+    px_comm::DDSImageDataWriter* m_ddsImageWriter;
+    px_comm::DDSImage* m_ddsImage;
+
+    ImageMetadata m_metadata;
+    bool m_loaned;
+};
+
+class DdsImageChannelReader: public ImageChannelReader
+{
+public:
+    DdsImageChannelReader();
+    ~DdsImageChannelReader();
+
+    bool init(const std::string& topic);
+
+    virtual bool take(double timeout,
+                      const ImageMetadata*& metadata,
+                      const unsigned char*& data);
+    virtual void returnLoan(void);
+
+private:
+    DDSDomainParticipant* m_ddsParticipant;
+    px_comm::DDSImageDataReader* m_ddsImageReader;
+    DDSWaitSet* m_waitset;
+
+    px_comm::DDSImageSeq m_dataSeq;
+    DDS_SampleInfoSeq m_infoSeq;
+    bool m_loaned;
+
+    ImageMetadata m_metadata;
+};
+
+}
+
+#endif
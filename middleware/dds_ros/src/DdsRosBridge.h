@@ -1,20 +1,13 @@
 #ifndef DDSROSBRIDGE_H
 #define DDSROSBRIDGE_H
 
-#include <boost/unordered_map.hpp>
+#include <boost/atomic.hpp>
+#include <boost/thread.hpp>
 #include <ros/ros.h>
 #include <image_transport/image_transport.h>
 
-// forward declarations
-class DDSCondition;
-class DDSDomainParticipant;
-class DDSWaitSet;
-
-namespace px_comm
-{
-class DDSImageDataReader;
-class DDSImage;
-}
+#include "dds_ros/ImageChannel.h"
+#include "dds_ros/ImageCodec.h"
 
 namespace px
 {
@@ -30,20 +23,24 @@ public:
     void poll(void);
 
 private:
-    void ddsImageCallback(px_comm::DDSImage* ddsImage,
-                          image_transport::Publisher* rosPublisher,
-                          sensor_msgs::ImagePtr& rosImage) const;
+    void readerThread(int cameraId);
+
+    void imageCallback(const ImageMetadata& metadata,
+                       const unsigned char* data,
+                       image_transport::Publisher& rosPublisher) const;
+    void fillHeader(const ImageMetadata& metadata,
+                    sensor_msgs::Image& rosImage) const;
 
     const int k_nCameras;
     ros::NodeHandle m_nh;
     image_transport::ImageTransport m_imageTransport;
     std::vector<image_transport::Publisher> m_rosImagePublisher;
-    std::vector<sensor_msgs::ImagePtr> m_rosImage;
 
-    DDSDomainParticipant* m_ddsParticipant;
-    std::vector<px_comm::DDSImageDataReader*> m_ddsImageReader;
-    boost::unordered_map<DDSCondition*, int> m_ddsConditionMap;
-    DDSWaitSet* m_waitset;
+    std::vector<ImageChannelReaderPtr> m_imageReader;
+
+    // one thread per camera takes images from the channel and publishes them
+    boost::atomic<bool> m_running;
+    boost::thread_group m_readerThreads;
 };
 
 }
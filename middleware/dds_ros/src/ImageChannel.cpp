@@ -0,0 +1,82 @@
+#include "dds_ros/ImageChannel.h"
+
+#include <boost/make_shared.hpp>
+#include <iostream>
+
+#include "ShmImageChannel.h"
+#ifdef HAVE_RTI
+#include "DdsImageChannel.h"
+#endif
+
+namespace px
+{
+
+ImageChannelOptions::ImageChannelOptions()
+ : shmSlotCount(4)
+ , shmSlotSize(4 * 1024 * 1024)
+{
+
+}
+
+ImageChannelWriterPtr
+createImageChannelWriter(const std::string& backend,
+                         const std::string& topic,
+                         const ImageChannelOptions& options)
+{
+    if (backend == "shm")
+    {
+        boost::shared_ptr<ShmImageChannelWriter> writer =
+            boost::make_shared<ShmImageChannelWriter>();
+        if (writer->init(topic, options.shmSlotCount, options.shmSlotSize))
+        {
+            return writer;
+        }
+        return ImageChannelWriterPtr();
+    }
+#ifdef HAVE_RTI
+    else if (backend == "dds")
+    {
+        boost::shared_ptr<DdsImageChannelWriter> writer =
+            boost::make_shared<DdsImageChannelWriter>();
+        if (writer->init(topic))
+        {
+            return writer;
+        }
+        return ImageChannelWriterPtr();
+    }
+#endif
+
+    std::cerr << "# ERROR: Unknown image channel backend: " << backend << std::endl;
+
+    return ImageChannelWriterPtr();
+}
+
+ImageChannelReaderPtr
+createImageChannelReader(const std::string& backend,
+                         const std::string& topic,
+                         const ImageChannelOptions& options)
+{
+    if (backend == "shm")
+    {
+        // the reader attaches lazily once the writer has created the ring
+        return boost::make_shared<ShmImageChannelReader>(topic);
+    }
+#ifdef HAVE_RTI
+    else if (backend == "dds")
+    {
+        boost::shared_ptr<DdsImageChannelReader> reader =
+            boost::make_shared<DdsImageChannelReader>();
+        if (reader->init(topic))
+        {
+            return reader;
+        }
+        return ImageChannelReaderPtr();
+    }
+#endif
+
+    std::cerr << "# ERROR: Unknown image channel backend: " << backend << std::endl;
+
+    return ImageChannelReaderPtr();
+}
+
+}
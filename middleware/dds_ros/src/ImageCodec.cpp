@@ -0,0 +1,351 @@
+#include "dds_ros/ImageCodec.h"
+
+#include <cstring>
+#include <iostream>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include <sensor_msgs/image_encodings.h>
+
+namespace px
+{
+
+namespace
+{
+
+bool
+wrapImage(const ImageMetadata& metadata, const unsigned char* data,
+          cv::Mat& image)
+{
+    namespace enc = sensor_msgs::image_encodings;
+
+    std::string encoding(metadata.encoding);
+
+    int depth;
+    switch (enc::bitDepth(encoding))
+    {
+    case 8:
+        depth = CV_8U;
+        break;
+    case 16:
+        depth = CV_16U;
+        break;
+    default:
+        std::cerr << "# ERROR: Unsupported image encoding: " << encoding << std::endl;
+        return false;
+    }
+
+    if (static_cast<size_t>(metadata.step) * metadata.height > metadata.dataSize)
+    {
+        std::cerr << "# ERROR: Image data is smaller than step x height." << std::endl;
+        return false;
+    }
+
+    image = cv::Mat(metadata.height, metadata.width,
+                    CV_MAKETYPE(depth, enc::numChannels(encoding)),
+                    const_cast<unsigned char*>(data), metadata.step);
+
+    return true;
+}
+
+int
+bayerToBgrCode(const std::string& encoding)
+{
+    namespace enc = sensor_msgs::image_encodings;
+
+    // OpenCV names Bayer patterns after the second row
+    if (encoding == enc::BAYER_RGGB8 || encoding == enc::BAYER_RGGB16)
+    {
+        return CV_BayerBG2BGR;
+    }
+    else if (encoding == enc::BAYER_BGGR8 || encoding == enc::BAYER_BGGR16)
+    {
+        return CV_BayerRG2BGR;
+    }
+    else if (encoding == enc::BAYER_GBRG8 || encoding == enc::BAYER_GBRG16)
+    {
+        return CV_BayerGR2BGR;
+    }
+    else
+    {
+        return CV_BayerGB2BGR;
+    }
+}
+
+void
+setEncoding(ImageMetadata& metadata, const std::string& encoding)
+{
+    strncpy(metadata.encoding, encoding.c_str(), sizeof(metadata.encoding) - 1);
+    metadata.encoding[sizeof(metadata.encoding) - 1] = '\0';
+}
+
+}
+
+ImageCodec::ImageCodec()
+ : m_format(RAW)
+ , m_jpegQuality(90)
+ , m_pngCompression(1)
+ , m_pyramidLevels(0)
+{
+
+}
+
+ImageCodec::Format&
+ImageCodec::format(void)
+{
+    return m_format;
+}
+
+ImageCodec::Format
+ImageCodec::format(void) const
+{
+    return m_format;
+}
+
+int&
+ImageCodec::jpegQuality(void)
+{
+    return m_jpegQuality;
+}
+
+int
+ImageCodec::jpegQuality(void) const
+{
+    return m_jpegQuality;
+}
+
+int&
+ImageCodec::pngCompression(void)
+{
+    return m_pngCompression;
+}
+
+int
+ImageCodec::pngCompression(void) const
+{
+    return m_pngCompression;
+}
+
+int&
+ImageCodec::pyramidLevels(void)
+{
+    return m_pyramidLevels;
+}
+
+int
+ImageCodec::pyramidLevels(void) const
+{
+    return m_pyramidLevels;
+}
+
+bool
+ImageCodec::isPassThrough(void) const
+{
+    return m_format == RAW && m_pyramidLevels <= 0;
+}
+
+bool
+ImageCodec::encode(const ImageMetadata& metadata,
+                   const unsigned char* data,
+                   ImageMetadata& encodedMetadata,
+                   std::vector<unsigned char>& buffer) const
+{
+    namespace enc = sensor_msgs::image_encodings;
+
+    encodedMetadata = metadata;
+
+    if (isPassThrough())
+    {
+        buffer.assign(data, data + metadata.dataSize);
+        return true;
+    }
+
+    cv::Mat image;
+    if (!wrapImage(metadata, data, image))
+    {
+        return false;
+    }
+
+    std::string encoding(metadata.encoding);
+
+    if (enc::isBayer(encoding) && (m_format == JPEG || m_pyramidLevels > 0))
+    {
+        cv::Mat color;
+        cv::cvtColor(image, color, bayerToBgrCode(encoding));
+
+        image = color;
+        encoding = (image.depth() == CV_8U) ? enc::BGR8 : enc::BGR16;
+    }
+
+    for (int i = 0; i < m_pyramidLevels; ++i)
+    {
+        cv::Mat halfImage;
+        cv::pyrDown(image, halfImage);
+
+        image = halfImage;
+    }
+
+    encodedMetadata.height = image.rows;
+    encodedMetadata.width = image.cols;
+    encodedMetadata.step = image.cols * image.elemSize();
+
+    switch (m_format)
+    {
+    case RAW:
+    {
+        buffer.resize(encodedMetadata.step * encodedMetadata.height);
+
+        cv::Mat dst(image.rows, image.cols, image.type(), &buffer[0]);
+        image.copyTo(dst);
+        break;
+    }
+    case PNG:
+    {
+        std::vector<int> params;
+        params.push_back(CV_IMWRITE_PNG_COMPRESSION);
+        params.push_back(m_pngCompression);
+
+        if (!cv::imencode(".png", image, buffer, params))
+        {
+            std::cerr << "# ERROR: PNG encoding failed." << std::endl;
+            return false;
+        }
+        break;
+    }
+    case JPEG:
+    {
+        if (image.depth() != CV_8U ||
+            (image.channels() != 1 && image.channels() != 3))
+        {
+            std::cerr << "# ERROR: JPEG does not support image encoding: "
+                      << encoding << std::endl;
+            return false;
+        }
+
+        std::vector<int> params;
+        params.push_back(CV_IMWRITE_JPEG_QUALITY);
+        params.push_back(m_jpegQuality);
+
+        if (!cv::imencode(".jpg", image, buffer, params))
+        {
+            std::cerr << "# ERROR: JPEG encoding failed." << std::endl;
+            return false;
+        }
+        break;
+    }
+    }
+
+    if (m_format != RAW)
+    {
+        encoding += ";" + formatName(m_format);
+    }
+    setEncoding(encodedMetadata, encoding);
+    encodedMetadata.dataSize = buffer.size();
+
+    return true;
+}
+
+bool
+ImageCodec::decode(const ImageMetadata& metadata,
+                   const unsigned char* data,
+                   ImageMetadata& decodedMetadata,
+                   std::vector<unsigned char>& buffer)
+{
+    decodedMetadata = metadata;
+
+    std::string encoding(metadata.encoding);
+    size_t pos = encoding.find(';');
+    if (pos == std::string::npos)
+    {
+        buffer.assign(data, data + metadata.dataSize);
+        return true;
+    }
+
+    Format format;
+    if (!parseFormat(encoding.substr(pos + 1), format))
+    {
+        std::cerr << "# ERROR: Unknown image payload format: "
+                  << encoding.substr(pos + 1) << std::endl;
+        return false;
+    }
+    encoding.erase(pos);
+
+    cv::Mat image;
+    if (format == RAW)
+    {
+        buffer.assign(data, data + metadata.dataSize);
+    }
+    else
+    {
+        cv::Mat payload(1, metadata.dataSize, CV_8UC1,
+                        const_cast<unsigned char*>(data));
+
+        image = cv::imdecode(payload, CV_LOAD_IMAGE_UNCHANGED);
+        if (image.empty())
+        {
+            std::cerr << "# ERROR: Failed to decode " << formatName(format)
+                      << " image." << std::endl;
+            return false;
+        }
+
+        if (image.rows != static_cast<int>(metadata.height) ||
+            image.cols != static_cast<int>(metadata.width) ||
+            image.cols * image.elemSize() != metadata.step)
+        {
+            std::cerr << "# ERROR: Decoded image does not match its metadata." << std::endl;
+            return false;
+        }
+
+        // imdecode returns a continuous image
+        buffer.assign(image.data, image.data + image.rows * metadata.step);
+    }
+
+    setEncoding(decodedMetadata, encoding);
+    decodedMetadata.dataSize = buffer.size();
+
+    return true;
+}
+
+bool
+ImageCodec::isEncoded(const ImageMetadata& metadata)
+{
+    return strchr(metadata.encoding, ';') != 0;
+}
+
+bool
+ImageCodec::parseFormat(const std::string& name, Format& format)
+{
+    if (name == "raw")
+    {
+        format = RAW;
+    }
+    else if (name == "png")
+    {
+        format = PNG;
+    }
+    else if (name == "jpeg")
+    {
+        format = JPEG;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+std::string
+ImageCodec::formatName(Format format)
+{
+    switch (format)
+    {
+    case PNG:
+        return "png";
+    case JPEG:
+        return "jpeg";
+    default:
+        return "raw";
+    }
+}
+
+}
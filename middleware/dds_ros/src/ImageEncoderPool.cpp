@@ -0,0 +1,180 @@
+#include "ImageEncoderPool.h"
+
+#include <boost/make_shared.hpp>
+#include <cstring>
+#include <iostream>
+
+namespace px
+{
+
+ImageEncoderPool::ImageEncoderPool(const ImageCodec& codec, int nWorkers,
+                                   size_t queueSize)
+ : k_codec(codec)
+ , k_queueSize(queueSize)
+ , m_running(true)
+ , m_droppedCount(0)
+ , m_publishedCount(0)
+{
+    for (int i = 0; i < nWorkers; ++i)
+    {
+        m_workers.create_thread(boost::bind(&ImageEncoderPool::workerThread, this));
+    }
+}
+
+ImageEncoderPool::~ImageEncoderPool()
+{
+    {
+        boost::mutex::scoped_lock lock(m_jobMutex);
+        m_running = false;
+    }
+    m_jobCond.notify_all();
+
+    m_workers.join_all();
+}
+
+int
+ImageEncoderPool::addWriter(const ImageChannelWriterPtr& writer)
+{
+    boost::shared_ptr<Writer> w = boost::make_shared<Writer>();
+    w->writer = writer;
+    w->published = false;
+    w->lastStampSec = 0;
+    w->lastStampNSec = 0;
+
+    boost::mutex::scoped_lock lock(m_jobMutex);
+    m_writers.push_back(w);
+
+    return m_writers.size() - 1;
+}
+
+void
+ImageEncoderPool::push(int writerIdx,
+                       const ImageMetadata& metadata,
+                       const unsigned char* data,
+                       const boost::shared_ptr<const void>& owner)
+{
+    {
+        boost::mutex::scoped_lock lock(m_jobMutex);
+
+        if (m_jobs.size() >= k_queueSize)
+        {
+            // the workers cannot keep up; keep the most recent images
+            m_jobs.pop_front();
+            ++m_droppedCount;
+        }
+
+        m_jobs.push_back(Job());
+
+        Job& job = m_jobs.back();
+        job.writerIdx = writerIdx;
+        job.metadata = metadata;
+        job.data = data;
+        job.owner = owner;
+    }
+
+    m_jobCond.notify_one();
+}
+
+size_t
+ImageEncoderPool::droppedCount(void) const
+{
+    boost::mutex::scoped_lock lock(m_jobMutex);
+
+    return m_droppedCount;
+}
+
+size_t
+ImageEncoderPool::publishedCount(void) const
+{
+    boost::mutex::scoped_lock lock(m_jobMutex);
+
+    return m_publishedCount;
+}
+
+void
+ImageEncoderPool::workerThread(void)
+{
+    // the encode buffer is reused across images
+    std::vector<unsigned char> buffer;
+
+    while (true)
+    {
+        Job job;
+        boost::shared_ptr<Writer> writer;
+        {
+            boost::mutex::scoped_lock lock(m_jobMutex);
+            while (m_running && m_jobs.empty())
+            {
+                m_jobCond.wait(lock);
+            }
+
+            if (!m_running)
+            {
+                return;
+            }
+
+            job = m_jobs.front();
+            m_jobs.pop_front();
+
+            writer = m_writers.at(job.writerIdx);
+        }
+
+        ImageMetadata encodedMetadata;
+        bool encoded = k_codec.encode(job.metadata, job.data,
+                                      encodedMetadata, buffer);
+
+        // release the source image as early as possible
+        job.owner.reset();
+
+        if (encoded)
+        {
+            publish(*writer, encodedMetadata, buffer);
+        }
+    }
+}
+
+void
+ImageEncoderPool::publish(Writer& writer,
+                          const ImageMetadata& metadata,
+                          const std::vector<unsigned char>& buffer)
+{
+    boost::mutex::scoped_lock lock(writer.mutex);
+
+    if (writer.published &&
+        (metadata.stampSec < writer.lastStampSec ||
+         (metadata.stampSec == writer.lastStampSec &&
+          metadata.stampNSec < writer.lastStampNSec)))
+    {
+        // a newer image from this writer has already been published
+        boost::mutex::scoped_lock jobLock(m_jobMutex);
+        ++m_droppedCount;
+        return;
+    }
+
+    ImageMetadata* loanedMetadata;
+    unsigned char* data;
+    if (!writer.writer->loan(buffer.size(), loanedMetadata, data))
+    {
+        std::cerr << "# WARNING: Failed to loan image buffer of size "
+                  << buffer.size() << "." << std::endl;
+        return;
+    }
+
+    *loanedMetadata = metadata;
+    memcpy(data, &buffer[0], buffer.size());
+
+    if (!writer.writer->publish())
+    {
+        std::cerr << "# ERROR: Failed to publish image." << std::endl;
+        return;
+    }
+
+    writer.published = true;
+    writer.lastStampSec = metadata.stampSec;
+    writer.lastStampNSec = metadata.stampNSec;
+
+    boost::mutex::scoped_lock jobLock(m_jobMutex);
+    ++m_publishedCount;
+}
+
+}
@@ -0,0 +1,75 @@
+#ifndef IMAGEENCODERPOOL_H
+#define IMAGEENCODERPOOL_H
+
+#include <boost/thread.hpp>
+#include <deque>
+
+#include "dds_ros/ImageChannel.h"
+#include "dds_ros/ImageCodec.h"
+
+namespace px
+{
+
+// Encodes images on a pool of worker threads and publishes them to
+// image channel writers. Each writer is published to by one worker at a
+// time, and images that are finished out of order are dropped. When the
+// queue is full, the oldest queued image is dropped.
+class ImageEncoderPool
+{
+public:
+    ImageEncoderPool(const ImageCodec& codec, int nWorkers, size_t queueSize = 8);
+    ~ImageEncoderPool();
+
+    // returns the index to pass to push()
+    int addWriter(const ImageChannelWriterPtr& writer);
+
+    // The image data must stay valid as long as owner is alive.
+    void push(int writerIdx,
+              const ImageMetadata& metadata,
+              const unsigned char* data,
+              const boost::shared_ptr<const void>& owner);
+
+    size_t droppedCount(void) const;
+    size_t publishedCount(void) const;
+
+private:
+    struct Job
+    {
+        int writerIdx;
+        ImageMetadata metadata;
+        const unsigned char* data;
+        boost::shared_ptr<const void> owner;
+    };
+
+    struct Writer
+    {
+        ImageChannelWriterPtr writer;
+        boost::mutex mutex;
+        bool published;
+        uint32_t lastStampSec;
+        uint32_t lastStampNSec;
+    };
+
+    void workerThread(void);
+    void publish(Writer& writer,
+                 const ImageMetadata& metadata,
+                 const std::vector<unsigned char>& buffer);
+
+    const ImageCodec k_codec;
+    const size_t k_queueSize;
+
+    std::vector<boost::shared_ptr<Writer> > m_writers;
+
+    std::deque<Job> m_jobs;
+    mutable boost::mutex m_jobMutex;
+    boost::condition_variable m_jobCond;
+    bool m_running;
+    size_t m_droppedCount;
+    size_t m_publishedCount;
+
+    boost::thread_group m_workers;
+};
+
+}
+
+#endif
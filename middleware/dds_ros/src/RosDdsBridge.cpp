@@ -1,15 +1,31 @@
 #include "RosDdsBridge.h"
 
-// NDDS
-#include <ndds/ndds_cpp.h>
+#include <boost/make_shared.hpp>
 
-#include <px_comm/DDSImage.h>
-#include <px_comm/DDSImageSupport.h>
+namespace px
+{
 
-#include "dds_ros/utils.h"
+namespace
+{
 
-namespace px
+void
+fillMetadata(const sensor_msgs::Image& rosImage, ImageMetadata& metadata)
 {
+    metadata.seq = rosImage.header.seq;
+    metadata.stampSec = rosImage.header.stamp.sec;
+    metadata.stampNSec = rosImage.header.stamp.nsec;
+    strncpy(metadata.frameId, rosImage.header.frame_id.c_str(), 255);
+    metadata.frameId[255] = '\0';
+    metadata.height = rosImage.height;
+    metadata.width = rosImage.width;
+    strncpy(metadata.encoding, rosImage.encoding.c_str(), 255);
+    metadata.encoding[255] = '\0';
+    metadata.isBigendian = rosImage.is_bigendian;
+    metadata.step = rosImage.step;
+    metadata.dataSize = rosImage.step * rosImage.height;
+}
+
+}
 
 RosDdsBridge::RosDdsBridge()
  : k_nCameras(4)
@@ -22,116 +38,61 @@ RosDdsBridge::RosDdsBridge()
 bool
 RosDdsBridge::start(void)
 {
-    // set up DDS
-    m_ddsParticipant = createDDSParticipant(0);
-    if (m_ddsParticipant == 0)
-    {
-        return false;
-    }
-
-    DDSPublisher* ddsPublisher =
-        m_ddsParticipant->create_publisher(DDS_PUBLISHER_QOS_DEFAULT, 0, DDS_STATUS_MASK_NONE);
-    if (ddsPublisher == 0)
-    {
-        ROS_ERROR("create_publisher error");
-        ddsShutdown(m_ddsParticipant);
-        return false;
-    }
-
-    DDS_DataWriterQos writer_qos;
-    DDS_ReturnCode_t retcode = ddsPublisher->get_default_datawriter_qos(writer_qos);
-
-    if (retcode != DDS_RETCODE_OK)
-    {
-        ROS_ERROR("get_default_datawriter_qos error %d", retcode);
-        ddsShutdown(m_ddsParticipant);
-        return false;
-    }
-
-    // use non-strict reliability model
-    writer_qos.publish_mode.kind = DDS_ASYNCHRONOUS_PUBLISH_MODE_QOS;
-    writer_qos.liveliness.lease_duration.sec = 1;
-    writer_qos.liveliness.lease_duration.nanosec = 0;
-
-    writer_qos.reliability.kind = DDS_RELIABLE_RELIABILITY_QOS;
-    writer_qos.history.kind = DDS_KEEP_LAST_HISTORY_QOS;
-    writer_qos.history.depth = 2;
-
-    writer_qos.resource_limits.max_samples =
-            writer_qos.resource_limits.initial_samples = 2;
-    writer_qos.resource_limits.max_samples_per_instance =
-            writer_qos.resource_limits.max_samples;
-
-    writer_qos.protocol.rtps_reliable_writer.heartbeats_per_max_samples = 1;
-
-    writer_qos.protocol.rtps_reliable_writer.high_watermark = 1;
-    writer_qos.protocol.rtps_reliable_writer.low_watermark = 0;
-
-    retcode = ddsPublisher->set_default_datawriter_qos(writer_qos);
-
-    if (retcode != DDS_RETCODE_OK)
+    // image channel backend: "dds" or "shm"
+    ros::NodeHandle pnh("~");
+
+    std::string backend;
+    pnh.param("backend", backend, std::string("dds"));
+
+    ImageChannelOptions options;
+    int shmSlotCount, shmSlotSize;
+    pnh.param("shm_slot_count", shmSlotCount, static_cast<int>(options.shmSlotCount));
+    pnh.param("shm_slot_size", shmSlotSize, static_cast<int>(options.shmSlotSize));
+    options.shmSlotCount = shmSlotCount;
+    options.shmSlotSize = shmSlotSize;
+
+    // payload format: "raw", "png" or "jpeg"
+    std::string format;
+    pnh.param("format", format, std::string("raw"));
+    if (!ImageCodec::parseFormat(format, m_codec.format()))
     {
-        ROS_ERROR("set_default_datawriter_qos error %d", retcode);
-        ddsShutdown(m_ddsParticipant);
+        ROS_ERROR("Unknown image format: %s", format.c_str());
         return false;
     }
 
-    // register type before creating topic
-    const char* type_name = px_comm::DDSImageTypeSupport::get_type_name();
-    retcode = px_comm::DDSImageTypeSupport::register_type(m_ddsParticipant, type_name);
-
-    if (retcode != DDS_RETCODE_OK)
-    {
-        ROS_ERROR("register_type error %d", retcode);
-        ddsShutdown(m_ddsParticipant);
-        return false;
-    }
+    int nEncoderThreads;
+    pnh.param("jpeg_quality", m_codec.jpegQuality(), 90);
+    pnh.param("png_compression", m_codec.pngCompression(), 1);
+    pnh.param("pyramid_levels", m_codec.pyramidLevels(), 0);
+    pnh.param("encoder_threads", nEncoderThreads, k_nCameras);
 
-    m_ddsImageWriter.resize(k_nCameras);
-    m_ddsImage.resize(k_nCameras);
+    m_imageWriter.resize(k_nCameras);
     for (int i = 0; i < k_nCameras; ++i)
     {
         std::ostringstream oss;
         oss << "cam" << i;
 
-        DDSTopic* topic =
-            m_ddsParticipant->create_topic(oss.str().c_str(), type_name,
-                                           DDS_TOPIC_QOS_DEFAULT, 0, DDS_STATUS_MASK_NONE);
-
-        if (topic == 0)
-        {
-            ROS_ERROR("create_topic error");
-            ddsShutdown(m_ddsParticipant);
-            return false;
-        }
-
-        DDSDataWriter* writer =
-            ddsPublisher->create_datawriter(topic, DDS_DATAWRITER_QOS_DEFAULT, 0,
-                                            DDS_STATUS_MASK_NONE);
-        if (writer == 0)
+        m_imageWriter.at(i) = createImageChannelWriter(backend, oss.str(), options);
+        if (!m_imageWriter.at(i))
         {
-            ROS_ERROR("create_datawriter error");
-            ddsShutdown(m_ddsParticipant);
+            ROS_ERROR("Failed to create %s image channel: %s",
+                      backend.c_str(), oss.str().c_str());
             return false;
         }
 
-        m_ddsImageWriter.at(i) = px_comm::DDSImageDataWriter::narrow(writer);
-        if (m_ddsImageWriter.at(i) == 0)
-        {
-            ROS_ERROR("DataWriter narrow error");
-            ddsShutdown(m_ddsParticipant);
-            return false;
-        }
+        ROS_INFO("Publishing to %s topic: %s", backend.c_str(), oss.str().c_str());
+    }
 
-        m_ddsImage.at(i) = px_comm::DDSImageTypeSupport::create_data();
-        if (m_ddsImage.at(i) == 0)
+    if (!m_codec.isPassThrough())
+    {
+        m_encoderPool = boost::make_shared<ImageEncoderPool>(m_codec, nEncoderThreads);
+        for (int i = 0; i < k_nCameras; ++i)
         {
-            ROS_ERROR("create_data error");
-            ddsShutdown(m_ddsParticipant);
-            return false;
+            m_encoderPool->addWriter(m_imageWriter.at(i));
         }
 
-        ROS_INFO("Publishing to DDS topic: %s", oss.str().c_str());
+        ROS_INFO("Encoding images as %s with %d pyramid level(s) on %d thread(s).",
+                 format.c_str(), m_codec.pyramidLevels(), nEncoderThreads);
     }
 
     // set up ROS
@@ -141,7 +102,7 @@ RosDdsBridge::start(void)
         std::ostringstream oss;
         oss << "cam" << i << "/image_raw";
 
-        m_rosImageSubscriber.at(i) = m_imageTransport.subscribe(oss.str(), 1, boost::bind(&RosDdsBridge::rosImageCallback, this, _1, m_ddsImageWriter.at(i), m_ddsImage.at(i)));
+        m_rosImageSubscriber.at(i) = m_imageTransport.subscribe(oss.str(), 1, boost::bind(&RosDdsBridge::rosImageCallback, this, _1, i));
 
         ROS_INFO("Subscribed to ROS topic: %s", m_rosImageSubscriber.at(i).getTopic().c_str());
     }
@@ -152,7 +113,9 @@ RosDdsBridge::start(void)
 void
 RosDdsBridge::stop(void)
 {
-    ddsShutdown(m_ddsParticipant);
+    m_rosImageSubscriber.clear();
+    m_encoderPool.reset();
+    m_imageWriter.clear();
 }
 
 void
@@ -163,33 +126,38 @@ RosDdsBridge::poll(void)
 
 void
 RosDdsBridge::rosImageCallback(const sensor_msgs::ImageConstPtr& rosImage,
-                               px_comm::DDSImageDataWriter* ddsImageWriter,
-                               px_comm::DDSImage* ddsImage) const
+                               int cameraId) const
 {
-    ddsImage->seq = rosImage->header.seq;
-    ddsImage->stamp_sec = rosImage->header.stamp.sec;
-    ddsImage->stamp_nsec = rosImage->header.stamp.nsec;
-    strncpy(ddsImage->frame_id, rosImage->header.frame_id.c_str(), 255);
-    ddsImage->height = rosImage->height;
-    ddsImage->width = rosImage->width;
-    strncpy(ddsImage->encoding, rosImage->encoding.c_str(), 255);
-    ddsImage->is_bigendian = rosImage->is_bigendian;
-    ddsImage->step = rosImage->step;
-
-    int imageSize = rosImage->step * rosImage->height;
-    if (imageSize != ddsImage->data.length())
+    size_t imageSize = rosImage->step * rosImage->height;
+
+    if (m_encoderPool)
+    {
+        ImageMetadata metadata;
+        fillMetadata(*rosImage, metadata);
+
+        // the queued job keeps the ROS image alive until it is encoded
+        m_encoderPool->push(cameraId, metadata, &rosImage->data[0], rosImage);
+        return;
+    }
+
+    const ImageChannelWriterPtr& imageWriter = m_imageWriter.at(cameraId);
+
+    // write straight into the buffer loaned by the transport
+    ImageMetadata* metadata;
+    unsigned char* data;
+    if (!imageWriter->loan(imageSize, metadata, data))
     {
-        ddsImage->data.ensure_length(imageSize, imageSize);
+        ROS_WARN("Failed to loan image buffer of size %lu.", imageSize);
+        return;
     }
 
-    memcpy(ddsImage->data.get_contiguous_buffer(), &rosImage->data[0], imageSize);
+    fillMetadata(*rosImage, *metadata);
 
-    DDS_ReturnCode_t retcode;
+    memcpy(data, &rosImage->data[0], imageSize);
 
-    retcode = ddsImageWriter->write(*ddsImage, DDS_HANDLE_NIL);
-    if (retcode != DDS_RETCODE_OK)
+    if (!imageWriter->publish())
     {
-        ROS_ERROR("write error %d", retcode);
+        ROS_ERROR("Failed to publish image.");
     }
 }
 
@@ -4,14 +4,8 @@
 #include <ros/ros.h>
 #include <image_transport/image_transport.h>
 
-// forward declarations
-class DDSDomainParticipant;
-
-namespace px_comm
-{
-class DDSImageDataWriter;
-class DDSImage;
-}
+#include "dds_ros/ImageChannel.h"
+#include "ImageEncoderPool.h"
 
 namespace px
 {
@@ -28,17 +22,18 @@ public:
 
 private:
     void rosImageCallback(const sensor_msgs::ImageConstPtr& rosImage,
-                          px_comm::DDSImageDataWriter* ddsImageWriter,
-                          px_comm::DDSImage* ddsImage) const;
+                          int cameraId) const;
 
     const int k_nCameras;
     ros::NodeHandle m_nh;
     image_transport::ImageTransport m_imageTransport;
     std::vector<image_transport::Subscriber> m_rosImageSubscriber;
 
-    DDSDomainParticipant* m_ddsParticipant;
-    std::vector<px_comm::DDSImageDataWriter*> m_ddsImageWriter;
-    std::vector<px_comm::DDSImage*> m_ddsImage;
+    std::vector<ImageChannelWriterPtr> m_imageWriter;
+
+    // optional compression and downscaling before images are published
+    ImageCodec m_codec;
+    boost::shared_ptr<ImageEncoderPool> m_encoderPool;
 };
 
 }
@@ -0,0 +1,564 @@
+#include "ShmImageChannel.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace px
+{
+
+namespace
+{
+
+const uint32_t k_shmMagic = 0x50584943; // "PXIC"
+const uint32_t k_shmVersion = 2;
+
+size_t
+align64(size_t n)
+{
+    return (n + 63) & ~static_cast<size_t>(63);
+}
+
+size_t
+headerSize(void)
+{
+    return align64(sizeof(ShmRingHeader));
+}
+
+size_t
+slotStride(size_t slotSize)
+{
+    return align64(sizeof(ShmSlotHeader)) + align64(slotSize);
+}
+
+int
+lockRobust(pthread_mutex_t* mutex)
+{
+    int ret = pthread_mutex_lock(mutex);
+    if (ret == EOWNERDEAD)
+    {
+        // the previous owner died while holding the lock
+        pthread_mutex_consistent(mutex);
+        ret = 0;
+    }
+
+    return ret;
+}
+
+// Returns true if no reader holds a loan on the slot. Loans of readers
+// whose process no longer exists are released on the way.
+bool
+releaseStaleLoans(ShmSlotHeader* slot)
+{
+    bool free = true;
+    for (int i = 0; i < ShmSlotHeader::k_maxReaders; ++i)
+    {
+        int32_t pid = slot->readerPids[i];
+        if (pid == 0)
+        {
+            continue;
+        }
+
+        if (kill(pid, 0) == -1 && errno == ESRCH)
+        {
+            // the reader died without returning its loan
+            __sync_bool_compare_and_swap(&slot->readerPids[i], pid, 0);
+            continue;
+        }
+
+        free = false;
+    }
+
+    return free;
+}
+
+timespec
+deadlineAfter(double timeout)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    long sec = static_cast<long>(timeout);
+    long nsec = static_cast<long>((timeout - sec) * 1e9);
+
+    ts.tv_sec += sec;
+    ts.tv_nsec += nsec;
+    if (ts.tv_nsec >= 1000000000L)
+    {
+        ts.tv_nsec -= 1000000000L;
+        ++ts.tv_sec;
+    }
+
+    return ts;
+}
+
+bool
+deadlinePassed(const timespec& deadline)
+{
+    timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return now.tv_sec > deadline.tv_sec ||
+           (now.tv_sec == deadline.tv_sec && now.tv_nsec >= deadline.tv_nsec);
+}
+
+}
+
+ShmImageChannel::ShmImageChannel()
+ : m_fd(-1)
+ , m_addr(0)
+ , m_size(0)
+{
+
+}
+
+ShmImageChannel::~ShmImageChannel()
+{
+    close();
+}
+
+bool
+ShmImageChannel::create(const std::string& topic, size_t slotCount, size_t slotSize)
+{
+    close();
+
+    m_name = shmName(topic);
+
+    // remove a stale ring left behind by a previous writer
+    shm_unlink(m_name.c_str());
+
+    m_fd = shm_open(m_name.c_str(), O_CREAT | O_RDWR, 0666);
+    if (m_fd == -1)
+    {
+        std::cerr << "# ERROR: shm_open failed for " << m_name << std::endl;
+        return false;
+    }
+
+    size_t size = headerSize() + slotCount * slotStride(slotSize);
+    if (ftruncate(m_fd, size) == -1)
+    {
+        std::cerr << "# ERROR: ftruncate failed for " << m_name << std::endl;
+        close();
+        return false;
+    }
+
+    if (!map(size))
+    {
+        return false;
+    }
+
+    ShmRingHeader* ring = header();
+    ring->magic = 0;
+    ring->version = k_shmVersion;
+    ring->slotCount = slotCount;
+    ring->slotSize = slotSize;
+    ring->slotStride = slotStride(slotSize);
+    ring->writeCount = 0;
+
+    pthread_mutexattr_t mutexAttr;
+    pthread_mutexattr_init(&mutexAttr);
+    pthread_mutexattr_setpshared(&mutexAttr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&mutexAttr, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&ring->mutex, &mutexAttr);
+    pthread_mutexattr_destroy(&mutexAttr);
+
+    pthread_condattr_t condAttr;
+    pthread_condattr_init(&condAttr);
+    pthread_condattr_setpshared(&condAttr, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+    pthread_cond_init(&ring->cond, &condAttr);
+    pthread_condattr_destroy(&condAttr);
+
+    for (size_t i = 0; i < slotCount; ++i)
+    {
+        slot(i)->seq = 0;
+        for (int j = 0; j < ShmSlotHeader::k_maxReaders; ++j)
+        {
+            slot(i)->readerPids[j] = 0;
+        }
+    }
+
+    // readers only attach once the ring is fully initialized
+    __sync_synchronize();
+    ring->magic = k_shmMagic;
+
+    return true;
+}
+
+bool
+ShmImageChannel::open(const std::string& topic)
+{
+    close();
+
+    // m_name stays empty: the writer owns the name, and a reader must
+    // not unlink it, not even when it fails to attach
+    m_fd = shm_open(shmName(topic).c_str(), O_RDWR, 0666);
+    if (m_fd == -1)
+    {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(m_fd, &st) == -1 ||
+        static_cast<size_t>(st.st_size) < headerSize())
+    {
+        close();
+        return false;
+    }
+
+    if (!map(st.st_size))
+    {
+        return false;
+    }
+
+    ShmRingHeader* ring = header();
+    if (ring->magic != k_shmMagic || ring->version != k_shmVersion ||
+        headerSize() + ring->slotCount * ring->slotStride > m_size)
+    {
+        close();
+        return false;
+    }
+
+    return true;
+}
+
+void
+ShmImageChannel::close(void)
+{
+    if (m_addr != 0)
+    {
+        if (!m_name.empty())
+        {
+            // tell attached readers that this ring is gone
+            header()->magic = 0;
+            __sync_synchronize();
+
+            lockRobust(&header()->mutex);
+            pthread_cond_broadcast(&header()->cond);
+            pthread_mutex_unlock(&header()->mutex);
+        }
+
+        munmap(m_addr, m_size);
+        m_addr = 0;
+        m_size = 0;
+    }
+
+    if (m_fd != -1)
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+
+    if (!m_name.empty())
+    {
+        shm_unlink(m_name.c_str());
+        m_name.clear();
+    }
+}
+
+bool
+ShmImageChannel::isOpen(void) const
+{
+    return m_addr != 0;
+}
+
+ShmRingHeader*
+ShmImageChannel::header(void)
+{
+    return reinterpret_cast<ShmRingHeader*>(m_addr);
+}
+
+ShmSlotHeader*
+ShmImageChannel::slot(uint64_t index)
+{
+    char* base = reinterpret_cast<char*>(m_addr) + headerSize();
+
+    return reinterpret_cast<ShmSlotHeader*>(base + index * header()->slotStride);
+}
+
+unsigned char*
+ShmImageChannel::slotData(uint64_t index)
+{
+    return reinterpret_cast<unsigned char*>(slot(index)) + align64(sizeof(ShmSlotHeader));
+}
+
+std::string
+ShmImageChannel::shmName(const std::string& topic)
+{
+    std::string name = "/px_image";
+    for (size_t i = 0; i < topic.size(); ++i)
+    {
+        char c = topic.at(i);
+        name += (c == '/') ? '_' : c;
+    }
+
+    return name;
+}
+
+bool
+ShmImageChannel::map(size_t size)
+{
+    void* addr = mmap(0, size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+    if (addr == MAP_FAILED)
+    {
+        std::cerr << "# ERROR: mmap failed for " << m_name << std::endl;
+        close();
+        return false;
+    }
+
+    m_addr = addr;
+    m_size = size;
+
+    return true;
+}
+
+ShmImageChannelWriter::ShmImageChannelWriter()
+ : m_nextSlot(0)
+ , m_loaned(false)
+ , m_loanedSlot(0)
+{
+
+}
+
+bool
+ShmImageChannelWriter::init(const std::string& topic, size_t slotCount, size_t slotSize)
+{
+    m_nextSlot = 0;
+    m_loaned = false;
+
+    return m_channel.create(topic, slotCount, slotSize);
+}
+
+bool
+ShmImageChannelWriter::loan(size_t dataSize,
+                            ImageMetadata*& metadata,
+                            unsigned char*& data)
+{
+    ShmRingHeader* ring = m_channel.header();
+
+    if (m_loaned || dataSize > ring->slotSize)
+    {
+        return false;
+    }
+
+    uint64_t writingSeq = 2 * ring->writeCount + 1;
+
+    for (uint64_t i = 0; i < ring->slotCount; ++i)
+    {
+        uint64_t index = (m_nextSlot + i) % ring->slotCount;
+        ShmSlotHeader* slot = m_channel.slot(index);
+
+        // Mark the slot as being written before checking for readers.
+        // A reader records its loan before re-checking the sequence
+        // number, so either the reader or the writer backs off.
+        uint64_t seq = slot->seq;
+        slot->seq = writingSeq;
+        __sync_synchronize();
+
+        if (releaseStaleLoans(slot))
+        {
+            metadata = &slot->metadata;
+            data = m_channel.slotData(index);
+
+            m_loaned = true;
+            m_loanedSlot = index;
+
+            return true;
+        }
+
+        // slot is loaned out to a reader
+        slot->seq = seq;
+        __sync_synchronize();
+    }
+
+    return false;
+}
+
+bool
+ShmImageChannelWriter::publish(void)
+{
+    if (!m_loaned)
+    {
+        return false;
+    }
+
+    ShmRingHeader* ring = m_channel.header();
+    ShmSlotHeader* slot = m_channel.slot(m_loanedSlot);
+
+    __sync_synchronize();
+    slot->seq = 2 * ring->writeCount + 2;
+    __sync_synchronize();
+
+    lockRobust(&ring->mutex);
+    ++ring->writeCount;
+    pthread_cond_broadcast(&ring->cond);
+    pthread_mutex_unlock(&ring->mutex);
+
+    m_nextSlot = (m_loanedSlot + 1) % ring->slotCount;
+    m_loaned = false;
+
+    return true;
+}
+
+ShmImageChannelReader::ShmImageChannelReader(const std::string& topic)
+ : m_topic(topic)
+ , m_readCount(0)
+ , m_pid(getpid())
+ , m_loaned(false)
+ , m_loanedSlot(0)
+ , m_loanedEntry(0)
+{
+
+}
+
+bool
+ShmImageChannelReader::take(double timeout,
+                            const ImageMetadata*& metadata,
+                            const unsigned char*& data)
+{
+    if (m_loaned)
+    {
+        returnLoan();
+    }
+
+    timespec deadline = deadlineAfter(timeout);
+
+    while (true)
+    {
+        if (tryTake(metadata, data))
+        {
+            return true;
+        }
+
+        if (deadlinePassed(deadline))
+        {
+            return false;
+        }
+
+        if (!m_channel.isOpen())
+        {
+            // wait for the writer to come up
+            usleep(10000);
+            continue;
+        }
+
+        ShmRingHeader* ring = m_channel.header();
+
+        int ret = 0;
+        lockRobust(&ring->mutex);
+        while (ring->magic == k_shmMagic &&
+               ring->writeCount <= m_readCount &&
+               ret != ETIMEDOUT)
+        {
+            ret = pthread_cond_timedwait(&ring->cond, &ring->mutex, &deadline);
+            if (ret == EOWNERDEAD)
+            {
+                pthread_mutex_consistent(&ring->mutex);
+                ret = 0;
+            }
+        }
+        pthread_mutex_unlock(&ring->mutex);
+    }
+}
+
+void
+ShmImageChannelReader::returnLoan(void)
+{
+    if (!m_loaned)
+    {
+        return;
+    }
+
+    __sync_bool_compare_and_swap(&m_channel.slot(m_loanedSlot)->readerPids[m_loanedEntry], m_pid, 0);
+    m_loaned = false;
+}
+
+bool
+ShmImageChannelReader::tryTake(const ImageMetadata*& metadata,
+                               const unsigned char*& data)
+{
+    if (m_channel.isOpen() && m_channel.header()->magic != k_shmMagic)
+    {
+        // the writer has gone away or restarted
+        m_channel.close();
+    }
+
+    if (!m_channel.isOpen())
+    {
+        if (!m_channel.open(m_topic))
+        {
+            return false;
+        }
+
+        // start with the latest image
+        uint64_t writeCount = m_channel.header()->writeCount;
+        m_readCount = (writeCount > 0) ? writeCount - 1 : 0;
+    }
+
+    ShmRingHeader* ring = m_channel.header();
+
+    uint64_t writeCount = ring->writeCount;
+    if (writeCount > m_readCount + ring->slotCount)
+    {
+        // lapped by the writer; skip to the latest image
+        m_readCount = writeCount - 1;
+    }
+
+    while (m_readCount < writeCount)
+    {
+        uint64_t publishedSeq = 2 * m_readCount + 2;
+
+        for (uint64_t i = 0; i < ring->slotCount; ++i)
+        {
+            ShmSlotHeader* slot = m_channel.slot(i);
+            if (slot->seq != publishedSeq)
+            {
+                continue;
+            }
+
+            int entry = 0;
+            while (entry < ShmSlotHeader::k_maxReaders &&
+                   !__sync_bool_compare_and_swap(&slot->readerPids[entry], 0, m_pid))
+            {
+                ++entry;
+            }
+
+            if (entry == ShmSlotHeader::k_maxReaders)
+            {
+                // too many readers hold this image
+                break;
+            }
+
+            __sync_synchronize();
+
+            if (slot->seq != publishedSeq)
+            {
+                // the writer claimed the slot in the meantime
+                __sync_bool_compare_and_swap(&slot->readerPids[entry], m_pid, 0);
+                break;
+            }
+
+            metadata = &slot->metadata;
+            data = m_channel.slotData(i);
+
+            m_loaned = true;
+            m_loanedSlot = i;
+            m_loanedEntry = entry;
+            ++m_readCount;
+
+            return true;
+        }
+
+        // image was overwritten before it could be read
+        ++m_readCount;
+    }
+
+    return false;
+}
+
+}
@@ -0,0 +1,123 @@
+#ifndef SHMIMAGECHANNEL_H
+#define SHMIMAGECHANNEL_H
+
+#include <pthread.h>
+
+#include "dds_ros/ImageChannel.h"
+
+namespace px
+{
+
+// Single-writer, multi-reader ring of images in POSIX shared memory.
+//
+// Layout: a ShmRingHeader followed by slotCount slots, each holding a
+// ShmSlotHeader and up to slotSize bytes of image data. The writer fills
+// slots in ring order and skips slots that are loaned out to readers.
+// Each reader follows the ring at its own pace and skips ahead to the
+// latest image if the writer laps it.
+//
+// A loan is recorded by the pid of the reader's process, so that the
+// writer can reclaim the loans of readers that died without returning
+// them. If a pid is reused before the writer notices, the slot stays
+// loaned until the new process exits.
+struct ShmRingHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t slotCount;
+    uint64_t slotSize;
+    uint64_t slotStride;
+
+    // number of images published so far
+    volatile uint64_t writeCount;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+};
+
+struct ShmSlotHeader
+{
+    // 2n + 1 while image n is being written, 2n + 2 once published
+    volatile uint64_t seq;
+    static const int k_maxReaders = 8;
+
+    // pids of the readers holding a loan on this slot; 0 if unused
+    volatile int32_t readerPids[k_maxReaders];
+
+    ImageMetadata metadata;
+};
+
+class ShmImageChannel
+{
+public:
+    ShmImageChannel();
+    ~ShmImageChannel();
+
+    bool create(const std::string& topic, size_t slotCount, size_t slotSize);
+    bool open(const std::string& topic);
+    void close(void);
+
+    bool isOpen(void) const;
+
+    ShmRingHeader* header(void);
+    ShmSlotHeader* slot(uint64_t index);
+    unsigned char* slotData(uint64_t index);
+
+    static std::string shmName(const std::string& topic);
+
+private:
+    bool map(size_t size);
+
+    std::string m_name;
+    int m_fd;
+    void* m_addr;
+    size_t m_size;
+};
+
+class ShmImageChannelWriter: public ImageChannelWriter
+{
+public:
+    ShmImageChannelWriter();
+
+    bool init(const std::string& topic, size_t slotCount, size_t slotSize);
+
+    virtual bool loan(size_t dataSize,
+                      ImageMetadata*& metadata,
+                      unsigned char*& data);
+    virtual bool publish(void);
+
+private:
+    ShmImageChannel m_channel;
+    uint64_t m_nextSlot;
+
+    bool m_loaned;
+    uint64_t m_loanedSlot;
+};
+
+class ShmImageChannelReader: public ImageChannelReader
+{
+public:
+    explicit ShmImageChannelReader(const std::string& topic);
+
+    virtual bool take(double timeout,
+                      const ImageMetadata*& metadata,
+                      const unsigned char*& data);
+    virtual void returnLoan(void);
+
+private:
+    bool tryTake(const ImageMetadata*& metadata,
+                 const unsigned char*& data);
+
+    std::string m_topic;
+    ShmImageChannel m_channel;
+    uint64_t m_readCount;
+    int32_t m_pid;
+
+    bool m_loaned;
+    uint64_t m_loanedSlot;
+    int m_loanedEntry;
+};
+
+}
+
+#endif
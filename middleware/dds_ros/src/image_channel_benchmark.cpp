@@ -0,0 +1,391 @@
+#include <algorithm>
+#include <boost/make_shared.hpp>
+#include <boost/program_options.hpp>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#include "dds_ros/ImageChannel.h"
+#include "dds_ros/ImageCodec.h"
+#include "ImageEncoderPool.h"
+
+// Loopback throughput and latency benchmark for image channels.
+// A forked writer process publishes synthetic images for one camera, and
+// the parent process reads them in place and measures the publish-to-take
+// latency. With the shm backend, no network or ROS master is involved.
+// Optionally, images are encoded on a worker pool before they are
+// published and decoded by the reader, as done by the bridges.
+
+namespace
+{
+
+uint64_t
+monotonicNSec(void)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+}
+
+double
+cpuTime(int who)
+{
+    rusage usage;
+    getrusage(who, &usage);
+
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+           (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) * 1e-6;
+}
+
+const int k_nFrames = 8;
+
+// Smooth gradient plus noise; compresses roughly like a camera image.
+std::vector<boost::shared_ptr<std::vector<unsigned char> > >
+generateFrames(int width, int height)
+{
+    std::vector<boost::shared_ptr<std::vector<unsigned char> > > frames;
+
+    unsigned int state = 1;
+    for (int i = 0; i < k_nFrames; ++i)
+    {
+        boost::shared_ptr<std::vector<unsigned char> > frame =
+            boost::make_shared<std::vector<unsigned char> >(width * height);
+
+        for (int r = 0; r < height; ++r)
+        {
+            for (int c = 0; c < width; ++c)
+            {
+                state = state * 1103515245 + 12345;
+                int noise = static_cast<int>((state >> 16) & 0x7) - 4;
+                int value = 128 + 100 * sin((c + 4 * i) * 0.02) * cos(r * 0.015) + noise;
+
+                frame->at(r * width + c) = std::max(0, std::min(255, value));
+            }
+        }
+
+        frames.push_back(frame);
+    }
+
+    return frames;
+}
+
+void
+fillMetadata(px::ImageMetadata& metadata, int seq, int width, int height)
+{
+    metadata.seq = seq;
+    strcpy(metadata.frameId, "benchmark");
+    metadata.height = height;
+    metadata.width = width;
+    strcpy(metadata.encoding, "mono8");
+    metadata.isBigendian = 0;
+    metadata.step = width;
+    metadata.dataSize = width * height;
+
+    uint64_t stamp = monotonicNSec();
+    metadata.stampSec = stamp / 1000000000ULL;
+    metadata.stampNSec = stamp % 1000000000ULL;
+}
+
+int
+runWriter(const std::string& backend, const std::string& topic,
+          const px::ImageChannelOptions& options,
+          const px::ImageCodec& codec, int nEncoderThreads,
+          int width, int height, int nImages, double rate,
+          int resultFd)
+{
+    px::ImageChannelWriterPtr writer =
+        px::createImageChannelWriter(backend, topic, options);
+    if (!writer)
+    {
+        return 1;
+    }
+
+    std::vector<boost::shared_ptr<std::vector<unsigned char> > > frames =
+        generateFrames(width, height);
+
+    boost::shared_ptr<px::ImageEncoderPool> encoderPool;
+    if (!codec.isPassThrough())
+    {
+        encoderPool = boost::make_shared<px::ImageEncoderPool>(codec, nEncoderThreads);
+        encoderPool->addWriter(writer);
+    }
+
+    // give the reader time to attach
+    usleep(200000);
+
+    double cpuStart = cpuTime(RUSAGE_SELF);
+
+    size_t imageSize = width * height;
+    uint64_t period = (rate > 0.0) ? static_cast<uint64_t>(1e9 / rate) : 0;
+    uint64_t next = monotonicNSec();
+
+    for (int i = 0; i < nImages; ++i)
+    {
+        if (period > 0)
+        {
+            while (monotonicNSec() < next)
+            {
+                usleep(100);
+            }
+            next += period;
+        }
+
+        const boost::shared_ptr<std::vector<unsigned char> >& frame =
+            frames.at(i % k_nFrames);
+
+        if (encoderPool)
+        {
+            px::ImageMetadata metadata;
+            fillMetadata(metadata, i, width, height);
+
+            encoderPool->push(0, metadata, &frame->at(0), frame);
+            continue;
+        }
+
+        px::ImageMetadata* metadata;
+        unsigned char* data;
+        if (!writer->loan(imageSize, metadata, data))
+        {
+            continue;
+        }
+
+        memcpy(data, &frame->at(0), imageSize);
+        fillMetadata(*metadata, i, width, height);
+
+        writer->publish();
+    }
+
+    // keep the channel alive until the reader has drained it
+    usleep(500000);
+
+    // report the CPU time spent publishing, including the encoder threads
+    double writerCpu = cpuTime(RUSAGE_SELF) - cpuStart;
+    if (write(resultFd, &writerCpu, sizeof(writerCpu)) != sizeof(writerCpu))
+    {
+        return 1;
+    }
+
+    if (encoderPool)
+    {
+        std::cout << "# INFO: Encoder dropped " << encoderPool->droppedCount()
+                  << " images." << std::endl;
+    }
+
+    return 0;
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    std::string backend, format;
+    int width, height, nImages, slotCount;
+    int jpegQuality, pngCompression, pyramidLevels, nEncoderThreads;
+    double rate;
+
+    namespace po = boost::program_options;
+    po::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("backend", po::value<std::string>(&backend)->default_value("shm"), "Image channel backend (shm or dds)")
+        ("width", po::value<int>(&width)->default_value(752), "Image width")
+        ("height", po::value<int>(&height)->default_value(480), "Image height")
+        ("images", po::value<int>(&nImages)->default_value(2000), "Number of images")
+        ("rate", po::value<double>(&rate)->default_value(0.0), "Publish rate (Hz); 0 for as fast as possible")
+        ("slots", po::value<int>(&slotCount)->default_value(4), "Number of slots in the shared memory ring")
+        ("format", po::value<std::string>(&format)->default_value("raw"), "Payload format (raw, png or jpeg)")
+        ("jpeg-quality", po::value<int>(&jpegQuality)->default_value(90), "JPEG quality")
+        ("png-compression", po::value<int>(&pngCompression)->default_value(1), "PNG compression level")
+        ("pyramid-levels", po::value<int>(&pyramidLevels)->default_value(0), "Number of pyramid levels to downscale by")
+        ("encoder-threads", po::value<int>(&nEncoderThreads)->default_value(2), "Number of encoder threads")
+        ;
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    px::ImageCodec codec;
+    if (!px::ImageCodec::parseFormat(format, codec.format()))
+    {
+        std::cerr << "# ERROR: Unknown format: " << format << std::endl;
+        return 1;
+    }
+    codec.jpegQuality() = jpegQuality;
+    codec.pngCompression() = pngCompression;
+    codec.pyramidLevels() = pyramidLevels;
+
+    std::ostringstream oss;
+    oss << "benchmark_" << getpid();
+    std::string topic = oss.str();
+
+    px::ImageChannelOptions options;
+    options.shmSlotCount = slotCount;
+    // leave room for encoded images that come out larger than raw
+    options.shmSlotSize = width * height + 65536;
+
+    int resultPipe[2];
+    if (pipe(resultPipe) == -1)
+    {
+        std::cerr << "# ERROR: Failed to create pipe." << std::endl;
+        return 1;
+    }
+
+    pid_t pid = fork();
+    if (pid == 0)
+    {
+        return runWriter(backend, topic, options, codec, nEncoderThreads,
+                         width, height, nImages, rate, resultPipe[1]);
+    }
+
+    px::ImageChannelReaderPtr reader =
+        px::createImageChannelReader(backend, topic, options);
+    if (!reader)
+    {
+        waitpid(pid, 0, 0);
+        return 1;
+    }
+
+    std::vector<boost::shared_ptr<std::vector<unsigned char> > > frames =
+        generateFrames(width, height);
+
+    std::vector<double> latencies;
+    latencies.reserve(nImages);
+
+    // reconstruction error is only measured at full resolution
+    bool checkImage = (pyramidLevels <= 0);
+    double maxError = 0.0;
+    double sumSqError = 0.0;
+    size_t nPayloadBytes = 0;
+
+    std::vector<unsigned char> buffer;
+    uint64_t tStart = 0;
+    uint64_t tEnd = 0;
+    int lastSeq = -1;
+
+    double cpuStart = cpuTime(RUSAGE_SELF);
+
+    while (lastSeq < nImages - 1)
+    {
+        const px::ImageMetadata* metadata;
+        const unsigned char* data;
+        if (!reader->take(2.0, metadata, data))
+        {
+            break;
+        }
+
+        px::ImageMetadata decodedMetadata;
+        const unsigned char* image = data;
+        if (px::ImageCodec::isEncoded(*metadata))
+        {
+            if (!px::ImageCodec::decode(*metadata, data, decodedMetadata, buffer))
+            {
+                reader->returnLoan();
+                continue;
+            }
+            image = &buffer[0];
+        }
+        else
+        {
+            decodedMetadata = *metadata;
+        }
+
+        uint64_t now = monotonicNSec();
+        uint64_t stamp = static_cast<uint64_t>(metadata->stampSec) * 1000000000ULL + metadata->stampNSec;
+
+        if (tStart == 0)
+        {
+            tStart = now;
+        }
+        tEnd = now;
+
+        latencies.push_back((now - stamp) * 1e-3);
+        nPayloadBytes += metadata->dataSize;
+
+        if (checkImage)
+        {
+            const std::vector<unsigned char>& frame = *frames.at(metadata->seq % k_nFrames);
+            for (size_t i = 0; i < frame.size(); i += 7)
+            {
+                double error = std::abs(static_cast<int>(image[i]) - static_cast<int>(frame.at(i)));
+
+                maxError = std::max(maxError, error);
+                sumSqError += error * error;
+            }
+        }
+        lastSeq = metadata->seq;
+
+        reader->returnLoan();
+    }
+
+    double readerCpu = cpuTime(RUSAGE_SELF) - cpuStart;
+
+    waitpid(pid, 0, 0);
+
+    double writerCpu = 0.0;
+    if (read(resultPipe[0], &writerCpu, sizeof(writerCpu)) != sizeof(writerCpu))
+    {
+        writerCpu = 0.0;
+    }
+
+    if (latencies.empty())
+    {
+        std::cerr << "# ERROR: No images received." << std::endl;
+        return 1;
+    }
+
+    double duration = (tEnd - tStart) * 1e-9;
+    double mbytes = latencies.size() * static_cast<double>(width * height) / (1024.0 * 1024.0);
+    double payloadMBytes = nPayloadBytes / (1024.0 * 1024.0);
+
+    std::sort(latencies.begin(), latencies.end());
+
+    double latencyMean = 0.0;
+    for (size_t i = 0; i < latencies.size(); ++i)
+    {
+        latencyMean += latencies.at(i);
+    }
+    latencyMean /= latencies.size();
+
+    std::cout << "# INFO: Backend: " << backend << ", format: " << format
+              << ", image size: " << width << "x" << height << std::endl;
+    std::cout << "# INFO: Received " << latencies.size() << " / " << nImages
+              << " images" << std::endl;
+    if (checkImage)
+    {
+        double rmse = sqrt(sumSqError / (latencies.size() * ((width * height + 6) / 7)));
+        std::cout << "# INFO: Reconstruction error: max " << maxError
+                  << ", RMS " << rmse << std::endl;
+    }
+    std::cout << "# INFO: Compression ratio: " << mbytes / payloadMBytes << std::endl;
+    if (duration > 0.0)
+    {
+        std::cout << "# INFO: Throughput: " << latencies.size() / duration << " images/s, "
+                  << mbytes / duration << " MB/s raw, "
+                  << payloadMBytes / duration << " MB/s on the wire" << std::endl;
+        std::cout << "# INFO: CPU per camera: writer " << 100.0 * writerCpu / duration
+                  << "% (" << 1000.0 * writerCpu / latencies.size() << " ms/image), reader "
+                  << 100.0 * readerCpu / duration << "% ("
+                  << 1000.0 * readerCpu / latencies.size() << " ms/image)" << std::endl;
+    }
+    std::cout << "# INFO: Latency (us): mean " << latencyMean
+              << ", median " << latencies.at(latencies.size() / 2)
+              << ", 99th percentile " << latencies.at(latencies.size() * 99 / 100)
+              << ", max " << latencies.back() << std::endl;
+
+    return 0;
+}
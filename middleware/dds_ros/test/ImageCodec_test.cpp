@@ -0,0 +1,199 @@
+#include <cmath>
+#include <cstring>
+#include <gtest/gtest.h>
+
+#include "dds_ros/ImageCodec.h"
+
+namespace px
+{
+
+void
+makeImage(int width, int height, const std::string& encoding, int bytesPerPixel,
+          ImageMetadata& metadata, std::vector<unsigned char>& data)
+{
+    memset(&metadata, 0, sizeof(metadata));
+    metadata.seq = 7;
+    metadata.stampSec = 100;
+    metadata.stampNSec = 200;
+    strcpy(metadata.frameId, "cam0");
+    metadata.height = height;
+    metadata.width = width;
+    strcpy(metadata.encoding, encoding.c_str());
+    metadata.step = width * bytesPerPixel;
+    metadata.dataSize = metadata.step * height;
+
+    // smooth pattern so that lossy compression stays close
+    data.resize(metadata.dataSize);
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        int c = (i / bytesPerPixel) % width;
+        int r = (i / bytesPerPixel) / width;
+
+        data.at(i) = 128 + 100 * sin(c * 0.05) * cos(r * 0.04);
+    }
+}
+
+void
+roundTrip(const ImageCodec& codec,
+          const ImageMetadata& metadata,
+          const std::vector<unsigned char>& data,
+          ImageMetadata& encodedMetadata,
+          ImageMetadata& decodedMetadata,
+          std::vector<unsigned char>& decoded)
+{
+    std::vector<unsigned char> encoded;
+    ASSERT_TRUE(codec.encode(metadata, &data[0], encodedMetadata, encoded));
+    ASSERT_EQ(encodedMetadata.dataSize, encoded.size());
+
+    ASSERT_TRUE(ImageCodec::decode(encodedMetadata, &encoded[0],
+                                   decodedMetadata, decoded));
+}
+
+TEST(ImageCodec, RawIsPassThrough)
+{
+    ImageMetadata metadata;
+    std::vector<unsigned char> data;
+    makeImage(64, 48, "mono8", 1, metadata, data);
+
+    ImageCodec codec;
+    EXPECT_TRUE(codec.isPassThrough());
+
+    ImageMetadata encodedMetadata, decodedMetadata;
+    std::vector<unsigned char> decoded;
+    roundTrip(codec, metadata, data, encodedMetadata, decodedMetadata, decoded);
+
+    EXPECT_STREQ("mono8", encodedMetadata.encoding);
+    EXPECT_FALSE(ImageCodec::isEncoded(encodedMetadata));
+    EXPECT_TRUE(decoded == data);
+}
+
+TEST(ImageCodec, PngIsLossless)
+{
+    ImageCodec codec;
+    codec.format() = ImageCodec::PNG;
+
+    const char* encodings[] = {"mono8", "bayer_rggb8", "mono16"};
+    const int bytesPerPixel[] = {1, 1, 2};
+
+    for (int i = 0; i < 3; ++i)
+    {
+        ImageMetadata metadata;
+        std::vector<unsigned char> data;
+        makeImage(64, 48, encodings[i], bytesPerPixel[i], metadata, data);
+
+        ImageMetadata encodedMetadata, decodedMetadata;
+        std::vector<unsigned char> decoded;
+        roundTrip(codec, metadata, data, encodedMetadata, decodedMetadata, decoded);
+
+        EXPECT_EQ(std::string(encodings[i]) + ";png", encodedMetadata.encoding);
+        EXPECT_TRUE(ImageCodec::isEncoded(encodedMetadata));
+        EXPECT_LT(encodedMetadata.dataSize, metadata.dataSize);
+
+        EXPECT_STREQ(encodings[i], decodedMetadata.encoding);
+        EXPECT_EQ(metadata.seq, decodedMetadata.seq);
+        EXPECT_EQ(metadata.stampSec, decodedMetadata.stampSec);
+        EXPECT_EQ(metadata.stampNSec, decodedMetadata.stampNSec);
+        EXPECT_STREQ(metadata.frameId, decodedMetadata.frameId);
+        EXPECT_EQ(metadata.step, decodedMetadata.step);
+        EXPECT_TRUE(decoded == data);
+    }
+}
+
+TEST(ImageCodec, JpegErrorIsBounded)
+{
+    ImageMetadata metadata;
+    std::vector<unsigned char> data;
+    makeImage(640, 480, "mono8", 1, metadata, data);
+
+    ImageCodec codec;
+    codec.format() = ImageCodec::JPEG;
+    codec.jpegQuality() = 90;
+
+    ImageMetadata encodedMetadata, decodedMetadata;
+    std::vector<unsigned char> decoded;
+    roundTrip(codec, metadata, data, encodedMetadata, decodedMetadata, decoded);
+
+    EXPECT_STREQ("mono8;jpeg", encodedMetadata.encoding);
+    EXPECT_LT(encodedMetadata.dataSize * 5, metadata.dataSize);
+
+    ASSERT_EQ(data.size(), decoded.size());
+
+    double sumError = 0.0;
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        sumError += std::abs(static_cast<int>(decoded.at(i)) - static_cast<int>(data.at(i)));
+    }
+    EXPECT_LT(sumError / data.size(), 2.0);
+}
+
+TEST(ImageCodec, PyramidDownscaling)
+{
+    ImageMetadata metadata;
+    std::vector<unsigned char> data;
+    makeImage(752, 480, "mono8", 1, metadata, data);
+
+    ImageCodec codec;
+    codec.pyramidLevels() = 2;
+    EXPECT_FALSE(codec.isPassThrough());
+
+    ImageMetadata encodedMetadata, decodedMetadata;
+    std::vector<unsigned char> decoded;
+    roundTrip(codec, metadata, data, encodedMetadata, decodedMetadata, decoded);
+
+    // downscaled raw images are not tagged
+    EXPECT_STREQ("mono8", encodedMetadata.encoding);
+    EXPECT_EQ(188u, decodedMetadata.width);
+    EXPECT_EQ(120u, decodedMetadata.height);
+    EXPECT_EQ(188u, decodedMetadata.step);
+    EXPECT_EQ(188u * 120u, decoded.size());
+
+    // a smooth image stays smooth
+    EXPECT_NEAR(data.at(4 * 752 * 60 + 4 * 94), decoded.at(188 * 60 + 94), 3);
+}
+
+TEST(ImageCodec, BayerIsDemosaicedBeforeJpeg)
+{
+    ImageMetadata metadata;
+    std::vector<unsigned char> data;
+    makeImage(64, 48, "bayer_rggb8", 1, metadata, data);
+
+    ImageCodec codec;
+    codec.format() = ImageCodec::JPEG;
+    codec.pyramidLevels() = 1;
+
+    ImageMetadata encodedMetadata, decodedMetadata;
+    std::vector<unsigned char> decoded;
+    roundTrip(codec, metadata, data, encodedMetadata, decodedMetadata, decoded);
+
+    EXPECT_STREQ("bgr8;jpeg", encodedMetadata.encoding);
+    EXPECT_STREQ("bgr8", decodedMetadata.encoding);
+    EXPECT_EQ(32u, decodedMetadata.width);
+    EXPECT_EQ(24u, decodedMetadata.height);
+    EXPECT_EQ(32u * 3, decodedMetadata.step);
+    EXPECT_EQ(32u * 24u * 3, decoded.size());
+}
+
+TEST(ImageCodec, UnknownPayloadFormat)
+{
+    ImageMetadata metadata;
+    std::vector<unsigned char> data;
+    makeImage(64, 48, "mono8", 1, metadata, data);
+    strcpy(metadata.encoding, "mono8;webp");
+
+    ImageMetadata decodedMetadata;
+    std::vector<unsigned char> decoded;
+    EXPECT_FALSE(ImageCodec::decode(metadata, &data[0], decodedMetadata, decoded));
+
+    ImageCodec::Format format;
+    EXPECT_FALSE(ImageCodec::parseFormat("webp", format));
+    ASSERT_TRUE(ImageCodec::parseFormat("jpeg", format));
+    EXPECT_EQ(ImageCodec::JPEG, format);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
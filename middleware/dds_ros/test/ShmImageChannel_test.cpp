@@ -0,0 +1,83 @@
+#include <cstring>
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ShmImageChannel.h"
+
+namespace px
+{
+
+bool
+publishImage(ShmImageChannelWriter& writer, uint32_t seq)
+{
+    ImageMetadata* metadata;
+    unsigned char* data;
+    if (!writer.loan(16, metadata, data))
+    {
+        return false;
+    }
+
+    memset(metadata, 0, sizeof(ImageMetadata));
+    metadata->seq = seq;
+    metadata->dataSize = 16;
+    memset(data, seq, 16);
+
+    return writer.publish();
+}
+
+TEST(ShmImageChannel, LoanBlocksSlot)
+{
+    ShmImageChannelWriter writer;
+    ASSERT_TRUE(writer.init("/shm_image_channel_test/loan", 1, 16));
+    ASSERT_TRUE(publishImage(writer, 1));
+
+    ShmImageChannelReader reader("/shm_image_channel_test/loan");
+
+    const ImageMetadata* metadata;
+    const unsigned char* data;
+    ASSERT_TRUE(reader.take(1.0, metadata, data));
+    EXPECT_EQ(1u, metadata->seq);
+
+    // the only slot is loaned out
+    EXPECT_FALSE(publishImage(writer, 2));
+
+    reader.returnLoan();
+
+    EXPECT_TRUE(publishImage(writer, 2));
+}
+
+TEST(ShmImageChannel, ReclaimLoanOfDeadReader)
+{
+    ShmImageChannelWriter writer;
+    ASSERT_TRUE(writer.init("/shm_image_channel_test/reclaim", 1, 16));
+    ASSERT_TRUE(publishImage(writer, 1));
+
+    pid_t pid = fork();
+    ASSERT_NE(-1, pid);
+
+    if (pid == 0)
+    {
+        // exit while holding the loan on the only slot
+        ShmImageChannelReader reader("/shm_image_channel_test/reclaim");
+
+        const ImageMetadata* metadata;
+        const unsigned char* data;
+        _exit(reader.take(1.0, metadata, data) ? 0 : 1);
+    }
+
+    int status;
+    ASSERT_EQ(pid, waitpid(pid, &status, 0));
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(0, WEXITSTATUS(status));
+
+    EXPECT_TRUE(publishImage(writer, 2));
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -3,6 +3,7 @@
 #include "camera_models/CostFunctionFactory.h"
 #include "cauldron/EigenQuaternionParameterization.h"
 #include "cauldron/EigenUtils.h"
+#include "cauldron/Random.h"
 #include "ceres/ceres.h"
 
 namespace px
@@ -118,11 +119,8 @@ GCamIMU::estimateH(const std::vector<PLineCorrespondence, Eigen::aligned_allocat
     double u = 1.0 - v;
     int N = static_cast<int>(log(1.0 - p) / log(1.0 - u * u * u) + 0.5);
 
-    std::vector<size_t> indices;
-    for (size_t i = 0; i < lcVec.size(); ++i)
-    {
-        indices.push_back(i);
-    }
+    Xoshiro256& rng = threadRng();
+    std::vector<size_t> sampleIds;
 
     std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > H_sys_cam;
     for (int i = 0; i < m_cameraSystem->cameraCount(); ++i)
@@ -137,12 +135,15 @@ GCamIMU::estimateH(const std::vector<PLineCorrespondence, Eigen::aligned_allocat
     std::vector<size_t> inliers_best;
     for (int i = 0; i < N; ++i)
     {
-        std::random_shuffle(indices.begin(), indices.end());
+        if (!sampleKofN(rng, 3, lcVec.size(), sampleIds))
+        {
+            break;
+        }
 
         std::vector<PLineCorrespondence, Eigen::aligned_allocator<PLineCorrespondence> > samples;
-        samples.push_back(lcVec.at(indices.at(0)));
-        samples.push_back(lcVec.at(indices.at(1)));
-        samples.push_back(lcVec.at(indices.at(2)));
+        samples.push_back(lcVec.at(sampleIds.at(0)));
+        samples.push_back(lcVec.at(sampleIds.at(1)));
+        samples.push_back(lcVec.at(sampleIds.at(2)));
 
         Eigen::Vector3d t;
         if (!estimateT(samples, R, t))
@@ -0,0 +1,434 @@
+#ifndef FIVEPOINT_H
+#define FIVEPOINT_H
+
+#include <algorithm>
+#include <cmath>
+#include <Eigen/Dense>
+#include <vector>
+
+#include "cauldron/Random.h"
+#include "fivepoint/FivePointCoefficients.h"
+
+namespace px
+{
+
+// Five-point relative pose on bearing vectors (Stewenius, Engels and
+// Nister, 2006). The epipolar constraint is written on rays rather than on
+// normalized image points, so rays of any central camera work, including
+// fisheye and omnidirectional rays from liftSphere. Rays are expected to
+// have unit length.
+//
+// Convention: x2^T E x1 = 0 with E = [t]_x R, where X2 = R X1 + t.
+
+// Computes up to 10 essential matrices from 5 correspondences and returns
+// their number. All matrices are fixed-size, so nothing is allocated.
+template<typename T>
+int
+solveFivePoint(const Eigen::Matrix<T,3,1>* rays1,
+               const Eigen::Matrix<T,3,1>* rays2,
+               Eigen::Matrix<T,3,3>* E)
+{
+    // each correspondence is a linear constraint on vec(E)
+    Eigen::Matrix<T,9,5> Qt;
+    for (int i = 0; i < 5; ++i)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            for (int r = 0; r < 3; ++r)
+            {
+                Qt(c * 3 + r, i) = rays2[i](r) * rays1[i](c);
+            }
+        }
+    }
+
+    // the last 4 columns of the complete QR factor of the transposed
+    // constraint matrix span its null space
+    Eigen::HouseholderQR<Eigen::Matrix<T,9,5> > qr(Qt);
+    Eigen::Matrix<T,9,9> Q = qr.householderQ();
+    Eigen::Matrix<T,9,4> EE = Q.template rightCols<4>();
+
+    Eigen::Matrix<T,10,20> A;
+    fivePointCoefficients(EE.data(), A.data());
+
+    Eigen::Matrix<T,10,10> B =
+        A.template leftCols<10>().partialPivLu().solve(A.template rightCols<10>());
+
+    // action matrix on the monomial basis of the reduced system
+    Eigen::Matrix<T,10,10> M = Eigen::Matrix<T,10,10>::Zero();
+    M.row(0) = -B.row(0);
+    M.row(1) = -B.row(1);
+    M.row(2) = -B.row(2);
+    M.row(3) = -B.row(4);
+    M.row(4) = -B.row(5);
+    M.row(5) = -B.row(7);
+    M(6,0) = 1.0;
+    M(7,1) = 1.0;
+    M(8,3) = 1.0;
+    M(9,6) = 1.0;
+
+    Eigen::EigenSolver<Eigen::Matrix<T,10,10> > es(M);
+
+    int nSolutions = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        if (es.eigenvalues()(i).imag() != 0.0)
+        {
+            continue;
+        }
+
+        Eigen::Matrix<T,10,1> v = es.eigenvectors().col(i).real();
+        if (v(9) == 0.0)
+        {
+            continue;
+        }
+
+        Eigen::Matrix<T,4,1> xyz1(v(6) / v(9), v(7) / v(9), v(8) / v(9), 1.0);
+
+        Eigen::Matrix<T,9,1> e = EE * xyz1;
+        e.normalize();
+
+        E[nSolutions] = Eigen::Map<Eigen::Matrix<T,3,3> >(e.data());
+        ++nSolutions;
+    }
+
+    return nSolutions;
+}
+
+// Mean squared sine of the angles by which each ray misses the epipolar
+// plane of the other; for small errors, the squared angular error.
+template<typename T>
+T
+epipolarError(const Eigen::Matrix<T,3,3>& E,
+              const Eigen::Matrix<T,3,1>& x1,
+              const Eigen::Matrix<T,3,1>& x2)
+{
+    Eigen::Matrix<T,3,1> Ex1 = E * x1;
+    Eigen::Matrix<T,3,1> Etx2 = E.transpose() * x2;
+
+    T n1 = Ex1.squaredNorm();
+    T n2 = Etx2.squaredNorm();
+    if (n1 == 0.0 || n2 == 0.0)
+    {
+        // a ray through the epipole lies on every epipolar plane
+        return 0.0;
+    }
+
+    T r = x2.dot(Ex1);
+
+    return 0.5 * r * r * (1.0 / n1 + 1.0 / n2);
+}
+
+// The two rotations and the translation direction that E encodes.
+template<typename T>
+void
+decomposeEssential(const Eigen::Matrix<T,3,3>& E,
+                   Eigen::Matrix<T,3,3>& R1, Eigen::Matrix<T,3,3>& R2,
+                   Eigen::Matrix<T,3,1>& t)
+{
+    Eigen::JacobiSVD<Eigen::Matrix<T,3,3> > svd(E, Eigen::ComputeFullU | Eigen::ComputeFullV);
+
+    Eigen::Matrix<T,3,3> U = svd.matrixU();
+    Eigen::Matrix<T,3,3> V = svd.matrixV();
+    if (U.determinant() < 0.0)
+    {
+        U = -U;
+    }
+    if (V.determinant() < 0.0)
+    {
+        V = -V;
+    }
+
+    Eigen::Matrix<T,3,3> W;
+    W << 0.0, 1.0, 0.0,
+         -1.0, 0.0, 0.0,
+         0.0, 0.0, 1.0;
+
+    R1 = U * W * V.transpose();
+    R2 = U * W.transpose() * V.transpose();
+    t = U.col(2);
+}
+
+namespace detail
+{
+
+// Whether the point seen along x1 and x2 lies in front of both cameras,
+// and closer than maxDepth, when X2 = R X1 + t.
+template<typename T>
+bool
+inFront(const Eigen::Matrix<T,3,3>& R, const Eigen::Matrix<T,3,1>& t,
+        const Eigen::Matrix<T,3,1>& x1, const Eigen::Matrix<T,3,1>& x2,
+        T maxDepth)
+{
+    // depths along both rays in the least-squares sense: l2 x2 = l1 R x1 + t
+    Eigen::Matrix<T,3,1> a = R * x1;
+
+    T aa = a.squaredNorm();
+    T ab = a.dot(x2);
+    T bb = x2.squaredNorm();
+    T det = aa * bb - ab * ab;
+    if (det <= 0.0)
+    {
+        return false;
+    }
+
+    T at = a.dot(t);
+    T bt = x2.dot(t);
+
+    T l1 = (ab * bt - bb * at) / det;
+    T l2 = (aa * bt - ab * at) / det;
+
+    return l1 > 0.0 && l2 > 0.0 && l1 < maxDepth && l2 < maxDepth;
+}
+
+}
+
+// Chooses the motion encoded by E that puts most inlier correspondences in
+// front of both cameras, and returns their number. Correspondences that
+// are behind either camera, or more than 1000 baselines away, where the
+// sign of the depth is unreliable, are removed from the inliers.
+template<typename T>
+int
+recoverPose(const Eigen::Matrix<T,3,3>& E,
+            const std::vector<Eigen::Matrix<T,3,1>, Eigen::aligned_allocator<Eigen::Matrix<T,3,1> > >& rays1,
+            const std::vector<Eigen::Matrix<T,3,1>, Eigen::aligned_allocator<Eigen::Matrix<T,3,1> > >& rays2,
+            std::vector<bool>& inliers,
+            Eigen::Matrix<T,3,3>& R, Eigen::Matrix<T,3,1>& t)
+{
+    const T k_maxDepth = 1000.0;
+
+    Eigen::Matrix<T,3,3> R1, R2;
+    Eigen::Matrix<T,3,1> t1;
+    decomposeEssential(E, R1, R2, t1);
+
+    const Eigen::Matrix<T,3,3>* candidateR[4] = {&R1, &R2, &R1, &R2};
+    const T candidateSign[4] = {1.0, 1.0, -1.0, -1.0};
+
+    int nInFront[4] = {0, 0, 0, 0};
+    for (int c = 0; c < 4; ++c)
+    {
+        Eigen::Matrix<T,3,1> tc = candidateSign[c] * t1;
+
+        for (size_t i = 0; i < rays1.size(); ++i)
+        {
+            if (inliers.at(i) &&
+                detail::inFront(*candidateR[c], tc, rays1.at(i), rays2.at(i), k_maxDepth))
+            {
+                ++nInFront[c];
+            }
+        }
+    }
+
+    int best = std::max_element(nInFront, nInFront + 4) - nInFront;
+
+    R = *candidateR[best];
+    t = candidateSign[best] * t1;
+
+    for (size_t i = 0; i < rays1.size(); ++i)
+    {
+        if (inliers.at(i))
+        {
+            inliers.at(i) = detail::inFront(R, t, rays1.at(i), rays2.at(i), k_maxDepth);
+        }
+    }
+
+    return nInFront[best];
+}
+
+// RANSAC driver for solveFivePoint. The number of iterations adapts to the
+// inlier ratio of the best hypothesis so far, scoring a hypothesis stops
+// as soon as it can no longer beat the best one, and the best hypothesis
+// is refined on its inliers. Samples, minimal solutions and scores live in
+// fixed-size or reused storage, so no hypothesis allocates.
+template<typename T>
+class FivePointRansac
+{
+public:
+    typedef Eigen::Matrix<T,3,1> Vector3;
+    typedef Eigen::Matrix<T,3,3> Matrix3;
+    typedef std::vector<Vector3, Eigen::aligned_allocator<Vector3> > Vector3Vec;
+
+    FivePointRansac()
+     : m_threshold(1e-3)
+     , m_confidence(0.99)
+     , m_maxIterations(1000)
+     , m_iterationCount(0)
+     , m_hypothesisCount(0)
+    {
+        m_sampleIds.reserve(5);
+    }
+
+    // angle (rad) by which a ray may miss its epipolar plane
+    T& threshold(void) { return m_threshold; }
+    // probability of drawing at least one outlier-free sample
+    T& confidence(void) { return m_confidence; }
+    int& maxIterations(void) { return m_maxIterations; }
+
+    // statistics of the last call to estimate
+    int iterationCount(void) const { return m_iterationCount; }
+    int hypothesisCount(void) const { return m_hypothesisCount; }
+
+    bool estimate(const Vector3Vec& rays1, const Vector3Vec& rays2,
+                  Matrix3& E, std::vector<bool>& inliers)
+    {
+        inliers.assign(rays1.size(), false);
+        m_iterationCount = 0;
+        m_hypothesisCount = 0;
+
+        const size_t n = rays1.size();
+        if (n < 5 || rays2.size() != n)
+        {
+            return false;
+        }
+
+        const T thresholdSq = m_threshold * m_threshold;
+
+        Xoshiro256& rng = threadRng();
+
+        Vector3 sample1[5], sample2[5];
+        Matrix3 hypotheses[10];
+
+        size_t nInliersBest = 0;
+        int nIterations = m_maxIterations;
+        for (; m_iterationCount < nIterations; ++m_iterationCount)
+        {
+            sampleKofN(rng, 5, n, m_sampleIds);
+            for (int i = 0; i < 5; ++i)
+            {
+                sample1[i] = rays1[m_sampleIds[i]];
+                sample2[i] = rays2[m_sampleIds[i]];
+            }
+
+            int nHypotheses = solveFivePoint(sample1, sample2, hypotheses);
+            m_hypothesisCount += nHypotheses;
+
+            for (int h = 0; h < nHypotheses; ++h)
+            {
+                size_t nInliers = 0;
+                for (size_t i = 0; i < n && nInliers + (n - i) > nInliersBest; ++i)
+                {
+                    if (epipolarError(hypotheses[h], rays1[i], rays2[i]) < thresholdSq)
+                    {
+                        ++nInliers;
+                    }
+                }
+
+                if (nInliers > nInliersBest)
+                {
+                    nInliersBest = nInliers;
+                    E = hypotheses[h];
+
+                    nIterations = std::min(m_maxIterations,
+                                           requiredIterations(static_cast<T>(nInliers) / n));
+                }
+            }
+        }
+
+        if (nInliersBest == 0)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            inliers[i] = epipolarError(E, rays1[i], rays2[i]) < thresholdSq;
+        }
+
+        // a minimal sample fits the noise of its five rays; a linear fit
+        // to all inliers is more accurate
+        if (nInliersBest >= 8)
+        {
+            Matrix3 E_refined = refine(rays1, rays2, inliers);
+
+            size_t nInliers = 0;
+            for (size_t i = 0; i < n; ++i)
+            {
+                if (epipolarError(E_refined, rays1[i], rays2[i]) < thresholdSq)
+                {
+                    ++nInliers;
+                }
+            }
+
+            if (nInliers >= nInliersBest)
+            {
+                E = E_refined;
+
+                for (size_t i = 0; i < n; ++i)
+                {
+                    inliers[i] = epipolarError(E, rays1[i], rays2[i]) < thresholdSq;
+                }
+            }
+        }
+
+        return true;
+    }
+
+private:
+    // least-squares essential matrix from the inliers: the null vector of
+    // the 9x9 normal matrix, projected onto the essential manifold
+    Matrix3 refine(const Vector3Vec& rays1, const Vector3Vec& rays2,
+                   const std::vector<bool>& inliers) const
+    {
+        Eigen::Matrix<T,9,9> AtA = Eigen::Matrix<T,9,9>::Zero();
+        for (size_t i = 0; i < rays1.size(); ++i)
+        {
+            if (!inliers[i])
+            {
+                continue;
+            }
+
+            Eigen::Matrix<T,9,1> a;
+            for (int c = 0; c < 3; ++c)
+            {
+                for (int r = 0; r < 3; ++r)
+                {
+                    a(c * 3 + r) = rays2[i](r) * rays1[i](c);
+                }
+            }
+
+            AtA.template selfadjointView<Eigen::Lower>().rankUpdate(a);
+        }
+
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix<T,9,9> > es;
+        es.compute(AtA.template selfadjointView<Eigen::Lower>());
+
+        Eigen::Matrix<T,9,1> e = es.eigenvectors().col(0);
+        Matrix3 E = Eigen::Map<Matrix3>(e.data());
+
+        Eigen::JacobiSVD<Matrix3> svd(E, Eigen::ComputeFullU | Eigen::ComputeFullV);
+
+        return svd.matrixU() * Eigen::Matrix<T,3,1>(1.0, 1.0, 0.0).asDiagonal()
+               * svd.matrixV().transpose();
+    }
+
+    // iterations after which a sample of inliers has been drawn with the
+    // desired confidence, given the inlier ratio
+    int requiredIterations(T inlierRatio) const
+    {
+        T pGood = std::pow(inlierRatio, 5);
+        if (pGood >= 1.0)
+        {
+            return 1;
+        }
+
+        T nIterations = std::log(1.0 - m_confidence) / std::log(1.0 - pGood);
+        if (!(nIterations < m_maxIterations))
+        {
+            return m_maxIterations;
+        }
+
+        return static_cast<int>(std::ceil(nIterations));
+    }
+
+    T m_threshold;
+    T m_confidence;
+    int m_maxIterations;
+
+    int m_iterationCount;
+    int m_hypothesisCount;
+
+    std::vector<size_t> m_sampleIds;
+};
+
+}
+
+#endif
@@ -0,0 +1,211 @@
+#include <boost/program_options.hpp>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <time.h>
+
+#include "cauldron/Random.h"
+#include "fivepoint/fivepoint.hpp"
+#include "fivepoint/FivePoint.h"
+
+// Compares findEssentialMat/recoverPose on image points with
+// FivePointRansac/recoverPose on bearing vectors. Correspondences are read
+// from a file with one "x1 y1 x2 y2" line per match, in pixels, as in
+// test/large.txt, or generated when no file is given.
+
+namespace
+{
+
+typedef std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > Vector3dVec;
+
+double
+monotonicTime(void)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+bool
+readMatches(const std::string& filename,
+            std::vector<cv::Point2f>& points1,
+            std::vector<cv::Point2f>& points2)
+{
+    std::ifstream ifs(filename.c_str());
+    if (!ifs.is_open())
+    {
+        std::cerr << "# ERROR: Cannot open " << filename << "." << std::endl;
+        return false;
+    }
+
+    cv::Point2f p1, p2;
+    while (ifs >> p1.x >> p1.y >> p2.x >> p2.y)
+    {
+        points1.push_back(p1);
+        points2.push_back(p2);
+    }
+
+    return !points1.empty();
+}
+
+// a random motion of a 640x480 camera observing points 4-10 m away,
+// with 0.5 px noise and the given fraction of outliers
+void
+generateMatches(int nPoints, double outlierRatio, double focal,
+                const cv::Point2d& pp,
+                std::vector<cv::Point2f>& points1,
+                std::vector<cv::Point2f>& points2)
+{
+    px::Xoshiro256 rng(1);
+
+    Eigen::Matrix3d R = Eigen::AngleAxisd(0.1, Eigen::Vector3d(0.2, 1.0, 0.1).normalized()).toRotationMatrix();
+    Eigen::Vector3d t(0.5, 0.05, 0.1);
+
+    while (static_cast<int>(points1.size()) < nPoints)
+    {
+        Eigen::Vector3d P(rng.uniform(-3.0, 3.0), rng.uniform(-2.0, 2.0), rng.uniform(4.0, 10.0));
+        Eigen::Vector3d P2 = R * P + t;
+
+        cv::Point2f p1(focal * P(0) / P(2) + pp.x + rng.normal(0.0, 0.5),
+                       focal * P(1) / P(2) + pp.y + rng.normal(0.0, 0.5));
+        cv::Point2f p2(focal * P2(0) / P2(2) + pp.x + rng.normal(0.0, 0.5),
+                       focal * P2(1) / P2(2) + pp.y + rng.normal(0.0, 0.5));
+
+        if (rng.uniform() < outlierRatio)
+        {
+            p2 = cv::Point2f(rng.uniform(0.0, 640.0), rng.uniform(0.0, 480.0));
+        }
+
+        points1.push_back(p1);
+        points2.push_back(p2);
+    }
+}
+
+void
+liftPoints(const std::vector<cv::Point2f>& points, double focal,
+           const cv::Point2d& pp, Vector3dVec& rays)
+{
+    rays.resize(points.size());
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        rays.at(i) = Eigen::Vector3d((points.at(i).x - pp.x) / focal,
+                                     (points.at(i).y - pp.y) / focal,
+                                     1.0).normalized();
+    }
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    std::string filename;
+    int nRuns, nPoints, maxIterations;
+    double focal, ppx, ppy, threshold, outlierRatio;
+
+    namespace po = boost::program_options;
+    po::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("input,i", po::value<std::string>(&filename), "Matches file, one \"x1 y1 x2 y2\" line per match")
+        ("focal", po::value<double>(&focal)->default_value(300.0), "Focal length (px)")
+        ("pp-x", po::value<double>(&ppx)->default_value(320.0), "Principal point x (px)")
+        ("pp-y", po::value<double>(&ppy)->default_value(400.0), "Principal point y (px)")
+        ("threshold", po::value<double>(&threshold)->default_value(1.0), "Inlier threshold (px)")
+        ("max-iterations", po::value<int>(&maxIterations)->default_value(1000), "Maximum RANSAC iterations")
+        ("runs", po::value<int>(&nRuns)->default_value(20), "Number of runs per method")
+        ("points", po::value<int>(&nPoints)->default_value(1000), "Number of generated matches")
+        ("outliers", po::value<double>(&outlierRatio)->default_value(0.3), "Fraction of generated outliers")
+        ;
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    cv::Point2d pp(ppx, ppy);
+
+    std::vector<cv::Point2f> points1, points2;
+    if (vm.count("input"))
+    {
+        if (!readMatches(filename, points1, points2))
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        generateMatches(nPoints, outlierRatio, focal, pp, points1, points2);
+    }
+
+    printf("%lu matches\n", points1.size());
+
+    // OpenCV C API port on image points
+    {
+        int nInliers = 0;
+        double t = monotonicTime();
+        for (int i = 0; i < nRuns; ++i)
+        {
+            cv::Mat mask;
+            cv::Mat E = findEssentialMat(points1, points2, focal, pp, CV_FM_RANSAC,
+                                         0.99, threshold, maxIterations, mask);
+
+            cv::Mat R, tr;
+            nInliers = recoverPose(E, points1, points2, R, tr, focal, pp, mask);
+        }
+        printf("%-28s %10.3f ms/run   (%d inliers)\n", "findEssentialMat",
+               (monotonicTime() - t) / nRuns * 1e3, nInliers);
+    }
+
+    // Eigen on bearing vectors
+    {
+        px::setRandomSeed(0);
+
+        Vector3dVec rays1, rays2;
+        liftPoints(points1, focal, pp, rays1);
+        liftPoints(points2, focal, pp, rays2);
+
+        px::FivePointRansac<double> ransac;
+        ransac.threshold() = threshold / focal;
+        ransac.confidence() = 0.99;
+        ransac.maxIterations() = maxIterations;
+
+        int nInliers = 0;
+        int nIterations = 0;
+        std::vector<bool> inliers;
+        double t = monotonicTime();
+        for (int i = 0; i < nRuns; ++i)
+        {
+            Eigen::Matrix3d E, R;
+            Eigen::Vector3d tr;
+            ransac.estimate(rays1, rays2, E, inliers);
+            nInliers = px::recoverPose(E, rays1, rays2, inliers, R, tr);
+            nIterations += ransac.iterationCount();
+        }
+        printf("%-28s %10.3f ms/run   (%d inliers, %.1f iterations)\n", "FivePointRansac",
+               (monotonicTime() - t) / nRuns * 1e3, nInliers,
+               static_cast<double>(nIterations) / nRuns);
+
+        // minimal solver alone
+        const int nSamples = 10000;
+        int nSolutions = 0;
+        Eigen::Matrix3d E[10];
+        t = monotonicTime();
+        for (int i = 0; i < nSamples; ++i)
+        {
+            size_t offset = (i * 5) % (rays1.size() - 5);
+            nSolutions += px::solveFivePoint(&rays1[offset], &rays2[offset], E);
+        }
+        printf("%-28s %10.3f us/call   (%.2f solutions)\n", "solveFivePoint",
+               (monotonicTime() - t) / nSamples * 1e6,
+               static_cast<double>(nSolutions) / nSamples);
+    }
+
+    return 0;
+}
@@ -41,6 +41,7 @@
 
 #include "precomp.hpp"
 #include "_modelest.h"
+#include "cauldron/Random.h"
 #include <algorithm>
 #include <iterator>
 #include <limits>
@@ -55,7 +56,9 @@ CvModelEstimator2::CvModelEstimator2(int _modelPoints, CvSize _modelSize, int _m
     modelSize = _modelSize;
     maxBasicSolutions = _maxBasicSolutions;
     checkPartialSubsets = true;
-    rng = cvRNG(-1);
+    // seeded from the generator of the calling thread, so that the
+    // samples follow px::setRandomSeed
+    rng = cvRNG(static_cast<int64>(px::threadRng()()));
 }
 
 CvModelEstimator2::~CvModelEstimator2()
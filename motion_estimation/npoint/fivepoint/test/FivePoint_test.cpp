@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include "cauldron/EigenUtils.h"
+#include "fivepoint/FivePoint.h"
+
+namespace px
+{
+
+typedef std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > Vector3dVec;
+
+void
+generateScene(Xoshiro256& rng, bool omnidirectional, size_t nPoints,
+              Eigen::Matrix3d& R, Eigen::Vector3d& t,
+              Vector3dVec& rays1, Vector3dVec& rays2)
+{
+    Eigen::Vector3d axis(rng.normal(), rng.normal(), rng.normal());
+    R = Eigen::AngleAxisd(rng.uniform(-0.5, 0.5), axis.normalized()).toRotationMatrix();
+    t = Eigen::Vector3d(rng.normal(), rng.normal(), rng.normal()).normalized();
+
+    rays1.clear();
+    rays2.clear();
+    while (rays1.size() < nPoints)
+    {
+        Eigen::Vector3d P;
+        if (omnidirectional)
+        {
+            // points all around the camera, including behind it
+            P = Eigen::Vector3d(rng.normal(), rng.normal(), rng.normal()).normalized()
+                * rng.uniform(2.0, 10.0);
+        }
+        else
+        {
+            P << rng.uniform(-2.0, 2.0), rng.uniform(-2.0, 2.0), rng.uniform(4.0, 10.0);
+        }
+
+        Eigen::Vector3d P2 = R * P + t;
+        if (!omnidirectional && P2(2) < 1.0)
+        {
+            continue;
+        }
+
+        rays1.push_back(P.normalized());
+        rays2.push_back(P2.normalized());
+    }
+}
+
+double
+essentialDistance(const Eigen::Matrix3d& E1, const Eigen::Matrix3d& E2)
+{
+    Eigen::Matrix3d n1 = E1 / E1.norm();
+    Eigen::Matrix3d n2 = E2 / E2.norm();
+
+    return std::min((n1 - n2).norm(), (n1 + n2).norm());
+}
+
+TEST(FivePoint, MinimalSolver)
+{
+    Xoshiro256 rng(1);
+
+    for (int omni = 0; omni < 2; ++omni)
+    {
+        int nFound = 0;
+        for (int trial = 0; trial < 100; ++trial)
+        {
+            Eigen::Matrix3d R;
+            Eigen::Vector3d t;
+            Vector3dVec rays1, rays2;
+            generateScene(rng, omni, 5, R, t, rays1, rays2);
+
+            Eigen::Matrix3d E_expected = skew(t) * R;
+
+            Eigen::Matrix3d E[10];
+            int nSolutions = solveFivePoint(&rays1[0], &rays2[0], E);
+            ASSERT_LE(nSolutions, 10);
+
+            double minDistance = 1.0;
+            for (int i = 0; i < nSolutions; ++i)
+            {
+                // every solution satisfies the constraints
+                for (int j = 0; j < 5; ++j)
+                {
+                    EXPECT_NEAR(0.0, rays2.at(j).dot(E[i] * rays1.at(j)), 1e-8);
+                }
+                EXPECT_NEAR(0.0, E[i].determinant(), 1e-8);
+
+                minDistance = std::min(minDistance, essentialDistance(E[i], E_expected));
+            }
+
+            if (minDistance < 1e-6)
+            {
+                ++nFound;
+            }
+        }
+
+        // allow for the rare near-degenerate sample
+        EXPECT_GE(nFound, 98);
+    }
+}
+
+TEST(FivePoint, Ransac)
+{
+    Xoshiro256 rng(2);
+
+    for (int omni = 0; omni < 2; ++omni)
+    {
+        Eigen::Matrix3d R;
+        Eigen::Vector3d t;
+        Vector3dVec rays1, rays2;
+        generateScene(rng, omni, 500, R, t, rays1, rays2);
+
+        // noise of about 1 mrad and 30% outliers
+        std::vector<bool> isOutlier(rays1.size(), false);
+        for (size_t i = 0; i < rays1.size(); ++i)
+        {
+            Eigen::Vector3d noise(rng.normal(), rng.normal(), rng.normal());
+            rays2.at(i) = (rays2.at(i) + noise * 5e-4).normalized();
+
+            if (i % 10 < 3)
+            {
+                rays2.at(i) = Eigen::Vector3d(rng.normal(), rng.normal(), rng.normal()).normalized();
+                isOutlier.at(i) = true;
+            }
+        }
+
+        setRandomSeed(3);
+
+        FivePointRansac<double> ransac;
+        ransac.threshold() = 3e-3;
+
+        Eigen::Matrix3d E;
+        std::vector<bool> inliers;
+        ASSERT_TRUE(ransac.estimate(rays1, rays2, E, inliers));
+
+        // an outlier-free sample is found long before the iteration limit
+        EXPECT_LT(ransac.iterationCount(), 100);
+
+        size_t nFalseInliers = 0, nInliers = 0;
+        for (size_t i = 0; i < rays1.size(); ++i)
+        {
+            nInliers += inliers.at(i);
+            nFalseInliers += inliers.at(i) && isOutlier.at(i);
+        }
+        EXPECT_GT(nInliers, 330u);
+        EXPECT_LT(nFalseInliers, 5u);
+
+        Eigen::Matrix3d R_est;
+        Eigen::Vector3d t_est;
+        int nInFront = recoverPose(E, rays1, rays2, inliers, R_est, t_est);
+        EXPECT_GT(nInFront, 320);
+
+        EXPECT_LT(Eigen::AngleAxisd(R_est.transpose() * R).angle(), 0.01);
+        EXPECT_GT(t_est.dot(t), 0.99);
+
+        // the same seed gives the same estimate
+        setRandomSeed(3);
+
+        Eigen::Matrix3d E2;
+        std::vector<bool> inliers2;
+        ransac.estimate(rays1, rays2, E2, inliers2);
+
+        EXPECT_TRUE(E == E2);
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
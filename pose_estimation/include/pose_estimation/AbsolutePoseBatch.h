@@ -0,0 +1,98 @@
+#ifndef ABSOLUTEPOSEBATCH_H
+#define ABSOLUTEPOSEBATCH_H
+
+#include <Eigen/Dense>
+#include <vector>
+
+#include "pose_estimation/gP3P.h"
+
+namespace px
+{
+
+// 2D-3D correspondences of one RANSAC problem, stored once in SoA layout
+// so that many pose hypotheses can be generated and scored against them
+// without allocating. Each correspondence pairs a world point with the
+// unit ray of its observation, expressed in the system frame together
+// with the center of the observing camera. If all rays pass through the
+// system origin, hypotheses come from P3P; otherwise from gP3P.
+//
+// Poses follow the convention of the minimal solvers: a hypothesis H
+// transforms points from the system frame to the world frame.
+class AbsolutePoseBatch
+{
+public:
+    enum
+    {
+        k_maxSolutions = k_maxgP3PSolutions
+    };
+
+    AbsolutePoseBatch();
+
+    void clear(void);
+    void reserve(size_t n);
+
+    // ray is observed by a camera at the system origin
+    void add(const Eigen::Vector3d& worldPoint, const Eigen::Vector3d& ray);
+    // ray is observed by a camera whose pose in the system frame is H_sys_cam
+    void add(const Eigen::Vector3d& worldPoint, const Eigen::Vector3d& ray,
+             const Eigen::Matrix4d& H_sys_cam);
+
+    size_t size(void) const;
+    bool isCentral(void) const;
+
+    Eigen::Vector3d worldPoint(size_t idx) const;
+    Eigen::Vector3d ray(size_t idx) const;
+    Eigen::Vector3d cameraCenter(size_t idx) const;
+
+    // Solves the minimal problem of the three given correspondences and
+    // returns the number of solutions written to solutions.
+    int solve(const size_t sampleIds[3],
+              Eigen::Matrix4d solutions[k_maxSolutions]) const;
+
+    // Solves for the translation of the two given correspondences if the
+    // rotation R of the pose is known, e.g. from integrated gyro rates.
+    // The rays are parallel to the predicted points in the least-squares
+    // sense. Returns false if the rays are parallel or a point lies
+    // behind its ray.
+    bool solveWithRotation(const size_t sampleIds[2], const Eigen::Matrix3d& R,
+                           Eigen::Matrix4d& H) const;
+
+    // Counts the correspondences for which |cos| of the angle between the
+    // ray and the predicted point exceeds cosThresh, as the VO front ends
+    // test against k_sphericalErrorThresh. Scoring stops as soon as the
+    // count cannot exceed nInliersToBeat, in which case the partial count
+    // is returned.
+    size_t countInliers(const Eigen::Matrix4d& H, double cosThresh,
+                        size_t nInliersToBeat = 0) const;
+
+    void inliers(const Eigen::Matrix4d& H, double cosThresh,
+                 std::vector<bool>& inliers) const;
+
+    // Solves nSamples minimal samples, given as consecutive triplets of
+    // correspondence indices, and scores all their solutions. H_best and
+    // nInliers_best are replaced by any hypothesis with more inliers than
+    // nInliers_best. Returns the number of hypotheses generated.
+    int solveAndScore(const size_t* sampleIds, int nSamples, double cosThresh,
+                      Eigen::Matrix4d& H_best, size_t& nInliers_best) const;
+
+private:
+    enum
+    {
+        k_blockSize = 64
+    };
+
+    bool isInlier(size_t idx, const Eigen::Matrix3d& R,
+                  const Eigen::Vector3d& t, double cosThresh2) const;
+    size_t countInlierBlock(size_t start, const Eigen::Matrix3d& R,
+                            const Eigen::Vector3d& t, double cosThresh2) const;
+
+    std::vector<double> m_px, m_py, m_pz;
+    std::vector<double> m_rx, m_ry, m_rz;
+    std::vector<double> m_cx, m_cy, m_cz;
+
+    bool m_central;
+};
+
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef ABSOLUTEPOSERANSAC_H
+#define ABSOLUTEPOSERANSAC_H
+
+#include <Eigen/Dense>
+#include <vector>
+
+#include "pose_estimation/AbsolutePoseBatch.h"
+
+namespace px
+{
+
+// Gauss-Newton refinement of the pose H of the correspondences ids of
+// batch, minimizing the chordal distances between the rays and the unit
+// directions to the predicted points. The Jacobians are analytic, with
+// left-multiplied SE(3) increments. If huberWidth is positive, residuals
+// longer than it are downweighted by IRLS. Correspondences whose point
+// lies behind the ray are ignored. Returns the number of steps taken.
+// H follows the convention of AbsolutePoseBatch.
+int refineAbsolutePose(const AbsolutePoseBatch& batch,
+                       const std::vector<size_t>& ids,
+                       Eigen::Matrix4d& H, int maxIterations,
+                       double huberWidth = 0.0);
+
+// RANSAC on P3P or gP3P with local optimization (LO-RANSAC, Chum et al.):
+// whenever a sample yields a new best model, the model is refined by a few
+// Gauss-Newton steps on its inliers and the inliers are recollected, for as
+// long as their number grows. The number of iterations adapts to the inlier
+// ratio, and the final model gets a robust refinement on all its inliers.
+class AbsolutePoseRansac
+{
+public:
+    AbsolutePoseRansac();
+
+    // minimum |cos| of the angle between a ray and its predicted point, as
+    // k_sphericalErrorThresh of the VO front ends
+    double& threshold(void);
+    // probability of drawing at least one outlier-free sample
+    double& confidence(void);
+    int& maxIterations(void);
+    // Gauss-Newton steps per local optimization; 0 disables it
+    int& localIterations(void);
+
+    // statistics of the last call to estimate
+    int iterationCount(void) const;
+    int hypothesisCount(void) const;
+    int localOptimizationCount(void) const;
+
+    bool estimate(const AbsolutePoseBatch& batch,
+                  Eigen::Matrix4d& H, std::vector<bool>& inliers);
+
+    // As above with a prior R on the rotation of H, from which hypotheses
+    // are generated from samples of two correspondences. Local
+    // optimization and the final refinement still adjust the rotation.
+    bool estimate(const AbsolutePoseBatch& batch, const Eigen::Matrix3d& R,
+                  Eigen::Matrix4d& H, std::vector<bool>& inliers);
+
+private:
+    bool run(const AbsolutePoseBatch& batch, const Eigen::Matrix3d* R,
+             Eigen::Matrix4d& H, std::vector<bool>& inliers);
+    size_t collectInliers(const AbsolutePoseBatch& batch,
+                          const Eigen::Matrix4d& H);
+    size_t localOptimize(const AbsolutePoseBatch& batch,
+                         Eigen::Matrix4d& H, size_t nInliers);
+    int requiredIterations(double inlierRatio, int sampleSize) const;
+
+    double m_threshold;
+    double m_confidence;
+    int m_maxIterations;
+    int m_localIterations;
+
+    int m_iterationCount;
+    int m_hypothesisCount;
+    int m_localOptimizationCount;
+
+    // reused between calls
+    std::vector<size_t> m_sampleIds;
+    std::vector<size_t> m_inlierIds;
+    std::vector<bool> m_inliers;
+};
+
+}
+
+#endif
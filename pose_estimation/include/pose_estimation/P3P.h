@@ -55,6 +55,12 @@ bool solveP3P(const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen:
               const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& worldPoints,
               std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> >& solutions);
 
+// Writes the up to four solutions to a fixed-size array and their number
+// to nSolutions, so that RANSAC loops do not allocate.
+bool solveP3P(const Eigen::Vector3d featureVectors[3],
+              const Eigen::Vector3d worldPoints[3],
+              Eigen::Matrix4d solutions[4], int& nSolutions);
+
 }
 
 #endif /* P3P_H_ */
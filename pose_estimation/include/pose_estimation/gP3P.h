@@ -9,10 +9,21 @@
 namespace px
 {
 
+// Upper bound on the number of solutions returned for one minimal sample.
+// The octic has at most eight real roots; pairings beyond the bound, which
+// only occur for near-degenerate samples, are dropped.
+const int k_maxgP3PSolutions = 16;
+
 bool solvegP3P(const std::vector<PLine, Eigen::aligned_allocator<PLine> >& plineVectors,
                const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& worldPoints,
                std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> >& solutions);
 
+// Writes the solutions to a fixed-size array and their number to
+// nSolutions, so that RANSAC loops do not allocate.
+bool solvegP3P(const PLine plineVectors[3],
+               const Eigen::Vector3d worldPoints[3],
+               Eigen::Matrix4d solutions[k_maxgP3PSolutions], int& nSolutions);
+
 }
 
 #endif
@@ -0,0 +1,309 @@
+#include "pose_estimation/AbsolutePoseBatch.h"
+
+#include "cauldron/PLine.h"
+#include "pose_estimation/P3P.h"
+
+namespace px
+{
+
+AbsolutePoseBatch::AbsolutePoseBatch()
+ : m_central(true)
+{
+
+}
+
+void
+AbsolutePoseBatch::clear(void)
+{
+    m_px.clear(); m_py.clear(); m_pz.clear();
+    m_rx.clear(); m_ry.clear(); m_rz.clear();
+    m_cx.clear(); m_cy.clear(); m_cz.clear();
+
+    m_central = true;
+}
+
+void
+AbsolutePoseBatch::reserve(size_t n)
+{
+    m_px.reserve(n); m_py.reserve(n); m_pz.reserve(n);
+    m_rx.reserve(n); m_ry.reserve(n); m_rz.reserve(n);
+    m_cx.reserve(n); m_cy.reserve(n); m_cz.reserve(n);
+}
+
+void
+AbsolutePoseBatch::add(const Eigen::Vector3d& worldPoint,
+                       const Eigen::Vector3d& ray)
+{
+    Eigen::Vector3d r = ray.normalized();
+
+    m_px.push_back(worldPoint(0));
+    m_py.push_back(worldPoint(1));
+    m_pz.push_back(worldPoint(2));
+
+    m_rx.push_back(r(0));
+    m_ry.push_back(r(1));
+    m_rz.push_back(r(2));
+
+    m_cx.push_back(0.0);
+    m_cy.push_back(0.0);
+    m_cz.push_back(0.0);
+}
+
+void
+AbsolutePoseBatch::add(const Eigen::Vector3d& worldPoint,
+                       const Eigen::Vector3d& ray,
+                       const Eigen::Matrix4d& H_sys_cam)
+{
+    Eigen::Vector3d r = H_sys_cam.block<3,3>(0,0) * ray.normalized();
+    Eigen::Vector3d c = H_sys_cam.block<3,1>(0,3);
+
+    m_px.push_back(worldPoint(0));
+    m_py.push_back(worldPoint(1));
+    m_pz.push_back(worldPoint(2));
+
+    m_rx.push_back(r(0));
+    m_ry.push_back(r(1));
+    m_rz.push_back(r(2));
+
+    m_cx.push_back(c(0));
+    m_cy.push_back(c(1));
+    m_cz.push_back(c(2));
+
+    if (!c.isZero(0.0))
+    {
+        m_central = false;
+    }
+}
+
+size_t
+AbsolutePoseBatch::size(void) const
+{
+    return m_px.size();
+}
+
+bool
+AbsolutePoseBatch::isCentral(void) const
+{
+    return m_central;
+}
+
+Eigen::Vector3d
+AbsolutePoseBatch::worldPoint(size_t idx) const
+{
+    return Eigen::Vector3d(m_px.at(idx), m_py.at(idx), m_pz.at(idx));
+}
+
+Eigen::Vector3d
+AbsolutePoseBatch::ray(size_t idx) const
+{
+    return Eigen::Vector3d(m_rx.at(idx), m_ry.at(idx), m_rz.at(idx));
+}
+
+Eigen::Vector3d
+AbsolutePoseBatch::cameraCenter(size_t idx) const
+{
+    return Eigen::Vector3d(m_cx.at(idx), m_cy.at(idx), m_cz.at(idx));
+}
+
+int
+AbsolutePoseBatch::solve(const size_t sampleIds[3],
+                         Eigen::Matrix4d solutions[k_maxSolutions]) const
+{
+    Eigen::Vector3d worldPoints[3];
+    for (int i = 0; i < 3; ++i)
+    {
+        worldPoints[i] = worldPoint(sampleIds[i]);
+    }
+
+    int nSolutions = 0;
+    if (m_central)
+    {
+        Eigen::Vector3d rays[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            rays[i] = ray(sampleIds[i]);
+        }
+
+        if (!solveP3P(rays, worldPoints, solutions, nSolutions))
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        PLine plines[3];
+        for (int i = 0; i < 3; ++i)
+        {
+            Eigen::Vector3d r = ray(sampleIds[i]);
+
+            plines[i] = PLine(r, cameraCenter(sampleIds[i]).cross(r));
+        }
+
+        if (!solvegP3P(plines, worldPoints, solutions, nSolutions))
+        {
+            return 0;
+        }
+    }
+
+    return nSolutions;
+}
+
+bool
+AbsolutePoseBatch::solveWithRotation(const size_t sampleIds[2],
+                                     const Eigen::Matrix3d& R,
+                                     Eigen::Matrix4d& H) const
+{
+    // with u = R^T P - c and s = R^T t, each ray f satisfies f x (u - s) = 0
+    Eigen::Vector3d u[2], f[2];
+    Eigen::Matrix3d A = Eigen::Matrix3d::Zero();
+    Eigen::Vector3d b = Eigen::Vector3d::Zero();
+    for (int i = 0; i < 2; ++i)
+    {
+        u[i] = R.transpose() * worldPoint(sampleIds[i]) - cameraCenter(sampleIds[i]);
+        f[i] = ray(sampleIds[i]);
+
+        Eigen::Matrix3d F = Eigen::Matrix3d::Identity() - f[i] * f[i].transpose();
+
+        A += F;
+        b += F * u[i];
+    }
+
+    if (A.determinant() < 1e-10)
+    {
+        return false;
+    }
+
+    Eigen::Vector3d s = A.inverse() * b;
+
+    for (int i = 0; i < 2; ++i)
+    {
+        if (f[i].dot(u[i] - s) <= 0.0)
+        {
+            return false;
+        }
+    }
+
+    H.setIdentity();
+    H.block<3,3>(0,0) = R;
+    H.block<3,1>(0,3) = R * s;
+
+    return true;
+}
+
+size_t
+AbsolutePoseBatch::countInliers(const Eigen::Matrix4d& H, double cosThresh,
+                                size_t nInliersToBeat) const
+{
+    // transform from the world frame to the system frame
+    Eigen::Matrix3d R = H.block<3,3>(0,0).transpose();
+    Eigen::Vector3d t = -R * H.block<3,1>(0,3);
+
+    double cosThresh2 = cosThresh * cosThresh;
+
+    const size_t n = size();
+
+    size_t nInliers = 0;
+    size_t i = 0;
+    for (; i + k_blockSize <= n; i += k_blockSize)
+    {
+        nInliers += countInlierBlock(i, R, t, cosThresh2);
+
+        if (nInliers + (n - i - k_blockSize) <= nInliersToBeat)
+        {
+            return nInliers;
+        }
+    }
+
+    for (; i < n; ++i)
+    {
+        if (isInlier(i, R, t, cosThresh2))
+        {
+            ++nInliers;
+        }
+    }
+
+    return nInliers;
+}
+
+void
+AbsolutePoseBatch::inliers(const Eigen::Matrix4d& H, double cosThresh,
+                           std::vector<bool>& inliers) const
+{
+    Eigen::Matrix3d R = H.block<3,3>(0,0).transpose();
+    Eigen::Vector3d t = -R * H.block<3,1>(0,3);
+
+    double cosThresh2 = cosThresh * cosThresh;
+
+    inliers.assign(size(), false);
+    for (size_t i = 0; i < size(); ++i)
+    {
+        inliers.at(i) = isInlier(i, R, t, cosThresh2);
+    }
+}
+
+int
+AbsolutePoseBatch::solveAndScore(const size_t* sampleIds, int nSamples,
+                                 double cosThresh, Eigen::Matrix4d& H_best,
+                                 size_t& nInliers_best) const
+{
+    Eigen::Matrix4d solutions[k_maxSolutions];
+
+    int nHypotheses = 0;
+    for (int i = 0; i < nSamples; ++i)
+    {
+        int nSolutions = solve(sampleIds + i * 3, solutions);
+
+        for (int j = 0; j < nSolutions; ++j)
+        {
+            size_t nInliers = countInliers(solutions[j], cosThresh, nInliers_best);
+            if (nInliers > nInliers_best)
+            {
+                H_best = solutions[j];
+                nInliers_best = nInliers;
+            }
+        }
+
+        nHypotheses += nSolutions;
+    }
+
+    return nHypotheses;
+}
+
+bool
+AbsolutePoseBatch::isInlier(size_t idx, const Eigen::Matrix3d& R,
+                            const Eigen::Vector3d& t, double cosThresh2) const
+{
+    double qx = R(0,0) * m_px[idx] + R(0,1) * m_py[idx] + R(0,2) * m_pz[idx] + t(0) - m_cx[idx];
+    double qy = R(1,0) * m_px[idx] + R(1,1) * m_py[idx] + R(1,2) * m_pz[idx] + t(1) - m_cy[idx];
+    double qz = R(2,0) * m_px[idx] + R(2,1) * m_py[idx] + R(2,2) * m_pz[idx] + t(2) - m_cz[idx];
+
+    // |cos| >= cosThresh without the square roots of normalization
+    double d = qx * m_rx[idx] + qy * m_ry[idx] + qz * m_rz[idx];
+
+    return d * d >= cosThresh2 * (qx * qx + qy * qy + qz * qz);
+}
+
+size_t
+AbsolutePoseBatch::countInlierBlock(size_t start, const Eigen::Matrix3d& R,
+                                    const Eigen::Vector3d& t,
+                                    double cosThresh2) const
+{
+    typedef Eigen::Array<double,k_blockSize,1> Block;
+    typedef Eigen::Map<const Block> BlockMap;
+
+    BlockMap px(&m_px[start]), py(&m_py[start]), pz(&m_pz[start]);
+    BlockMap rx(&m_rx[start]), ry(&m_ry[start]), rz(&m_rz[start]);
+    BlockMap cx(&m_cx[start]), cy(&m_cy[start]), cz(&m_cz[start]);
+
+    // evaluated by Eigen with packet instructions, one block at a time
+    Block qx = R(0,0) * px + R(0,1) * py + R(0,2) * pz + t(0) - cx;
+    Block qy = R(1,0) * px + R(1,1) * py + R(1,2) * pz + t(1) - cy;
+    Block qz = R(2,0) * px + R(2,1) * py + R(2,2) * pz + t(2) - cz;
+
+    Block d = qx * rx + qy * ry + qz * rz;
+    Block q2 = qx.square() + qy.square() + qz.square();
+
+    return (d.square() >= cosThresh2 * q2).count();
+}
+
+}
@@ -0,0 +1,360 @@
+#include "pose_estimation/AbsolutePoseRansac.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "cauldron/EigenUtils.h"
+#include "cauldron/Random.h"
+
+namespace px
+{
+
+int
+refineAbsolutePose(const AbsolutePoseBatch& batch,
+                   const std::vector<size_t>& ids,
+                   Eigen::Matrix4d& H, int maxIterations,
+                   double huberWidth)
+{
+    if (ids.size() < 3)
+    {
+        return 0;
+    }
+
+    // optimize the transform from the world frame to the system frame
+    Eigen::Matrix3d R = H.block<3,3>(0,0).transpose();
+    Eigen::Vector3d t = -R * H.block<3,1>(0,3);
+
+    int nIterations = 0;
+    while (nIterations < maxIterations)
+    {
+        Eigen::Matrix<double,6,6> JtJ = Eigen::Matrix<double,6,6>::Zero();
+        Eigen::Matrix<double,6,1> Jtr = Eigen::Matrix<double,6,1>::Zero();
+
+        size_t nResiduals = 0;
+        for (size_t i = 0; i < ids.size(); ++i)
+        {
+            size_t idx = ids.at(i);
+
+            Eigen::Vector3d P = R * batch.worldPoint(idx) + t;
+            Eigen::Vector3d q = P - batch.cameraCenter(idx);
+            Eigen::Vector3d f = batch.ray(idx);
+
+            double qNorm = q.norm();
+            if (qNorm == 0.0)
+            {
+                continue;
+            }
+
+            Eigen::Vector3d n = q / qNorm;
+            if (n.dot(f) <= 0.0)
+            {
+                continue;
+            }
+
+            Eigen::Vector3d r = n - f;
+
+            // q(w, v) = exp(w) P + v - c, so dq/dw = -[P]x and dq/dv = I
+            Eigen::Matrix3d dn_dq = (Eigen::Matrix3d::Identity() - n * n.transpose()) / qNorm;
+
+            Eigen::Matrix<double,3,6> J;
+            J.leftCols<3>() = -dn_dq * skew(P);
+            J.rightCols<3>() = dn_dq;
+
+            double w = 1.0;
+            if (huberWidth > 0.0)
+            {
+                double rNorm = r.norm();
+                if (rNorm > huberWidth)
+                {
+                    w = huberWidth / rNorm;
+                }
+            }
+
+            JtJ.noalias() += w * J.transpose() * J;
+            Jtr.noalias() += w * J.transpose() * r;
+
+            ++nResiduals;
+        }
+
+        if (nResiduals < 3)
+        {
+            break;
+        }
+
+        Eigen::Matrix<double,6,1> delta = JtJ.ldlt().solve(-Jtr);
+
+        Eigen::Vector3d w = delta.head<3>();
+        double angle = w.norm();
+        if (angle > 0.0)
+        {
+            Eigen::Matrix3d dR = Eigen::AngleAxisd(angle, w / angle).toRotationMatrix();
+
+            R = dR * R;
+            t = dR * t;
+        }
+        t += delta.tail<3>();
+
+        ++nIterations;
+
+        if (delta.squaredNorm() < 1e-20)
+        {
+            break;
+        }
+    }
+
+    H.setIdentity();
+    H.block<3,3>(0,0) = R.transpose();
+    H.block<3,1>(0,3) = -R.transpose() * t;
+
+    return nIterations;
+}
+
+namespace
+{
+
+// rounds of inlier collection and refinement per local optimization
+const int k_localRounds = 4;
+// inliers refined on in a local optimization, drawn evenly from all
+// inliers; more add run time but little accuracy to an interim model
+const size_t k_maxLocalInliers = 128;
+// Gauss-Newton steps of the final robust refinement
+const int k_finalIterations = 10;
+
+}
+
+AbsolutePoseRansac::AbsolutePoseRansac()
+ : m_threshold(0.999976)
+ , m_confidence(0.99)
+ , m_maxIterations(1000)
+ , m_localIterations(3)
+ , m_iterationCount(0)
+ , m_hypothesisCount(0)
+ , m_localOptimizationCount(0)
+{
+    m_sampleIds.reserve(3);
+}
+
+double&
+AbsolutePoseRansac::threshold(void)
+{
+    return m_threshold;
+}
+
+double&
+AbsolutePoseRansac::confidence(void)
+{
+    return m_confidence;
+}
+
+int&
+AbsolutePoseRansac::maxIterations(void)
+{
+    return m_maxIterations;
+}
+
+int&
+AbsolutePoseRansac::localIterations(void)
+{
+    return m_localIterations;
+}
+
+int
+AbsolutePoseRansac::iterationCount(void) const
+{
+    return m_iterationCount;
+}
+
+int
+AbsolutePoseRansac::hypothesisCount(void) const
+{
+    return m_hypothesisCount;
+}
+
+int
+AbsolutePoseRansac::localOptimizationCount(void) const
+{
+    return m_localOptimizationCount;
+}
+
+bool
+AbsolutePoseRansac::estimate(const AbsolutePoseBatch& batch,
+                             Eigen::Matrix4d& H, std::vector<bool>& inliers)
+{
+    return run(batch, 0, H, inliers);
+}
+
+bool
+AbsolutePoseRansac::estimate(const AbsolutePoseBatch& batch,
+                             const Eigen::Matrix3d& R,
+                             Eigen::Matrix4d& H, std::vector<bool>& inliers)
+{
+    return run(batch, &R, H, inliers);
+}
+
+bool
+AbsolutePoseRansac::run(const AbsolutePoseBatch& batch, const Eigen::Matrix3d* R,
+                        Eigen::Matrix4d& H, std::vector<bool>& inliers)
+{
+    inliers.assign(batch.size(), false);
+    m_iterationCount = 0;
+    m_hypothesisCount = 0;
+    m_localOptimizationCount = 0;
+
+    const int sampleSize = R ? 2 : 3;
+
+    const size_t n = batch.size();
+    if (n < static_cast<size_t>(sampleSize))
+    {
+        return false;
+    }
+
+    Xoshiro256& rng = threadRng();
+
+    Eigen::Matrix4d solutions[AbsolutePoseBatch::k_maxSolutions];
+
+    size_t nInliersBest = 0;
+    int nIterations = m_maxIterations;
+    for (; m_iterationCount < nIterations; ++m_iterationCount)
+    {
+        sampleKofN(rng, sampleSize, n, m_sampleIds);
+
+        int nSolutions;
+        if (R)
+        {
+            nSolutions = batch.solveWithRotation(&m_sampleIds[0], *R, solutions[0]) ? 1 : 0;
+        }
+        else
+        {
+            nSolutions = batch.solve(&m_sampleIds[0], solutions);
+        }
+        m_hypothesisCount += nSolutions;
+
+        for (int i = 0; i < nSolutions; ++i)
+        {
+            size_t nInliers = batch.countInliers(solutions[i], m_threshold, nInliersBest);
+            if (nInliers <= nInliersBest)
+            {
+                continue;
+            }
+
+            H = solutions[i];
+            nInliersBest = nInliers;
+
+            if (m_localIterations > 0)
+            {
+                nInliersBest = localOptimize(batch, H, nInliersBest);
+            }
+
+            nIterations = std::min(m_maxIterations,
+                                   requiredIterations(static_cast<double>(nInliersBest) / n,
+                                                      sampleSize));
+        }
+    }
+
+    if (nInliersBest == 0)
+    {
+        return false;
+    }
+
+    // Huber width at half the chord of the threshold angle, about the
+    // noise level if the threshold is set at two to three sigma
+    if (m_localIterations > 0 && collectInliers(batch, H) >= 3)
+    {
+        double huberWidth = 0.5 * sqrt(2.0 * (1.0 - m_threshold));
+
+        Eigen::Matrix4d H_refined = H;
+        refineAbsolutePose(batch, m_inlierIds, H_refined, k_finalIterations, huberWidth);
+
+        if (batch.countInliers(H_refined, m_threshold) >= nInliersBest)
+        {
+            H = H_refined;
+        }
+    }
+
+    batch.inliers(H, m_threshold, inliers);
+
+    return true;
+}
+
+size_t
+AbsolutePoseRansac::collectInliers(const AbsolutePoseBatch& batch,
+                                   const Eigen::Matrix4d& H)
+{
+    batch.inliers(H, m_threshold, m_inliers);
+
+    m_inlierIds.clear();
+    for (size_t i = 0; i < m_inliers.size(); ++i)
+    {
+        if (m_inliers[i])
+        {
+            m_inlierIds.push_back(i);
+        }
+    }
+
+    return m_inlierIds.size();
+}
+
+size_t
+AbsolutePoseRansac::localOptimize(const AbsolutePoseBatch& batch,
+                                  Eigen::Matrix4d& H, size_t nInliers)
+{
+    ++m_localOptimizationCount;
+
+    for (int i = 0; i < k_localRounds; ++i)
+    {
+        size_t nCollected = collectInliers(batch, H);
+        if (nCollected < 3)
+        {
+            break;
+        }
+
+        if (nCollected > k_maxLocalInliers)
+        {
+            for (size_t j = 0; j < k_maxLocalInliers; ++j)
+            {
+                m_inlierIds[j] = m_inlierIds[j * nCollected / k_maxLocalInliers];
+            }
+            m_inlierIds.resize(k_maxLocalInliers);
+        }
+
+        Eigen::Matrix4d H_refined = H;
+        refineAbsolutePose(batch, m_inlierIds, H_refined, m_localIterations);
+
+        // a refined model with as many inliers fits them better
+        size_t nRefined = batch.countInliers(H_refined, m_threshold, nInliers - 1);
+        if (nRefined < nInliers)
+        {
+            break;
+        }
+
+        H = H_refined;
+
+        if (nRefined == nInliers)
+        {
+            break;
+        }
+        nInliers = nRefined;
+    }
+
+    return nInliers;
+}
+
+int
+AbsolutePoseRansac::requiredIterations(double inlierRatio, int sampleSize) const
+{
+    double pGood = pow(inlierRatio, sampleSize);
+    if (pGood >= 1.0)
+    {
+        return 1;
+    }
+
+    double nIterations = log(1.0 - m_confidence) / log(1.0 - pGood);
+    if (!(nIterations < m_maxIterations))
+    {
+        return m_maxIterations;
+    }
+
+    return static_cast<int>(ceil(nIterations));
+}
+
+}
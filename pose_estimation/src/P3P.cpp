@@ -112,17 +112,17 @@ solveQuartic(const Eigen::Vector5d& factors, Eigen::Vector4d& realRoots)
 }
 
 bool
-solveP3P(const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& featureVectors,
-         const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& worldPoints,
-         std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> >& solutions)
+solveP3P(const Eigen::Vector3d featureVectors[3],
+         const Eigen::Vector3d worldPoints[3],
+         Eigen::Matrix4d solutions[4], int& nSolutions)
 {
-    solutions.clear();
-    
+    nSolutions = 0;
+
     // Extraction of world points
 
-    Eigen::Vector3d P1 = worldPoints.at(0);
-    Eigen::Vector3d P2 = worldPoints.at(1);
-    Eigen::Vector3d P3 = worldPoints.at(2);
+    Eigen::Vector3d P1 = worldPoints[0];
+    Eigen::Vector3d P2 = worldPoints[1];
+    Eigen::Vector3d P3 = worldPoints[2];
 
     // Verification that world points are not colinear
 
@@ -136,9 +136,9 @@ solveP3P(const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vect
 
     // Extraction of feature vectors
 
-    Eigen::Vector3d f1 = featureVectors.at(0);
-    Eigen::Vector3d f2 = featureVectors.at(1);
-    Eigen::Vector3d f3 = featureVectors.at(2);
+    Eigen::Vector3d f1 = featureVectors[0];
+    Eigen::Vector3d f2 = featureVectors[1];
+    Eigen::Vector3d f3 = featureVectors[2];
 
     // Creation of intermediate camera frame
 
@@ -158,9 +158,9 @@ solveP3P(const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vect
 
     if (f3(2) > 0.0)
     {
-        f1 = featureVectors.at(1);
-        f2 = featureVectors.at(0);
-        f3 = featureVectors.at(2);
+        f1 = featureVectors[1];
+        f2 = featureVectors[0];
+        f3 = featureVectors[2];
 
         e1 = f1;
         e3 = f1.cross(f2);
@@ -173,9 +173,9 @@ solveP3P(const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vect
 
         f3 = T * f3;
 
-        P1 = worldPoints.at(1);
-        P2 = worldPoints.at(0);
-        P3 = worldPoints.at(2);
+        P1 = worldPoints[1];
+        P2 = worldPoints[0];
+        P3 = worldPoints[2];
     }
 
     // Creation of intermediate world frame
@@ -307,9 +307,33 @@ solveP3P(const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vect
         H.block<3,3>(0,0) = N.transpose() * R.transpose() * T;
         H.block<3,1>(0,3) = P1 + N.transpose() * C;
 
-        solutions.push_back(H);
+        solutions[nSolutions++] = H;
+    }
+
+    return true;
+}
+
+bool
+solveP3P(const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& featureVectors,
+         const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& worldPoints,
+         std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> >& solutions)
+{
+    solutions.clear();
+
+    if (featureVectors.size() < 3 || worldPoints.size() < 3)
+    {
+        return false;
+    }
+
+    Eigen::Matrix4d H[4];
+    int nSolutions;
+    if (!solveP3P(&featureVectors[0], &worldPoints[0], H, nSolutions))
+    {
+        return false;
     }
 
+    solutions.assign(H, H + nSolutions);
+
     return true;
 }
 
@@ -0,0 +1,302 @@
+#include <boost/program_options.hpp>
+#include <cstdio>
+#include <iostream>
+#include <time.h>
+
+#include "cauldron/EigenUtils.h"
+#include "cauldron/Random.h"
+#include "pose_estimation/AbsolutePoseBatch.h"
+#include "pose_estimation/AbsolutePoseRansac.h"
+#include "pose_estimation/gP3P.h"
+#include "pose_estimation/P3P.h"
+
+// Compares the RANSAC loop of the VO front ends, which solves through the
+// vector interfaces of P3P/gP3P and scores each match with its own
+// transform, with AbsolutePoseBatch on the same samples. Then measures the
+// accuracy and run time of AbsolutePoseRansac with and without local
+// optimization on rays with noise.
+
+namespace
+{
+
+double
+monotonicTime(void)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+typedef std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > Vector3dVec;
+typedef std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > Matrix4dVec;
+
+size_t
+legacyRansac(const Vector3dVec& worldPoints, const Vector3dVec& rays,
+             const std::vector<int>& cameraIds, const Matrix4dVec& H_sys_cam,
+             const std::vector<size_t>& sampleIds, bool central,
+             double cosThresh, Eigen::Matrix4d& H_best)
+{
+    size_t nInliers_best = 0;
+    for (size_t i = 0; i + 2 < sampleIds.size(); i += 3)
+    {
+        Vector3dVec samplePoints(3);
+        Matrix4dVec H;
+        if (central)
+        {
+            Vector3dVec sampleRays(3);
+            for (int j = 0; j < 3; ++j)
+            {
+                samplePoints.at(j) = worldPoints.at(sampleIds.at(i + j));
+                sampleRays.at(j) = rays.at(sampleIds.at(i + j));
+            }
+
+            if (!px::solveP3P(sampleRays, samplePoints, H))
+            {
+                continue;
+            }
+        }
+        else
+        {
+            std::vector<px::PLine, Eigen::aligned_allocator<px::PLine> > plines(3);
+            for (int j = 0; j < 3; ++j)
+            {
+                size_t idx = sampleIds.at(i + j);
+
+                samplePoints.at(j) = worldPoints.at(idx);
+                plines.at(j) = px::PLine(rays.at(idx), H_sys_cam.at(cameraIds.at(idx)));
+            }
+
+            if (!px::solvegP3P(plines, samplePoints, H))
+            {
+                continue;
+            }
+        }
+
+        for (size_t j = 0; j < H.size(); ++j)
+        {
+            Eigen::Matrix4d H_inv = px::invertHomogeneousTransform(H.at(j));
+
+            size_t nInliers = 0;
+            for (size_t k = 0; k < worldPoints.size(); ++k)
+            {
+                Eigen::Matrix4d H_cam = px::invertHomogeneousTransform(H_sys_cam.at(cameraIds.at(k))) * H_inv;
+
+                Eigen::Vector3d P_cam_pred = px::transformPoint(H_cam, worldPoints.at(k));
+
+                double err = fabs(P_cam_pred.normalized().dot(rays.at(k)));
+                if (err < cosThresh)
+                {
+                    continue;
+                }
+
+                ++nInliers;
+            }
+
+            if (nInliers > nInliers_best)
+            {
+                H_best = H.at(j);
+                nInliers_best = nInliers;
+            }
+        }
+    }
+
+    return nInliers_best;
+}
+
+}
+
+int
+main(int argc, char** argv)
+{
+    int nPoints, nSamples, nRuns;
+    double outlierRatio, noise;
+
+    namespace po = boost::program_options;
+    po::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("points", po::value<int>(&nPoints)->default_value(1000), "Number of correspondences")
+        ("samples", po::value<int>(&nSamples)->default_value(100), "Number of minimal samples per run")
+        ("runs", po::value<int>(&nRuns)->default_value(20), "Number of runs")
+        ("outliers", po::value<double>(&outlierRatio)->default_value(0.4), "Outlier ratio")
+        ("noise", po::value<double>(&noise)->default_value(1e-3), "Ray noise (rad) in the accuracy test")
+        ;
+
+    po::variables_map vm;
+    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    const double k_cosThresh = 0.999976;
+
+    px::Xoshiro256 rng(42);
+
+    // four cameras looking forward, left, back and right
+    Matrix4dVec H_sys_cam(4);
+    for (int i = 0; i < 4; ++i)
+    {
+        H_sys_cam.at(i).setIdentity();
+        H_sys_cam.at(i).block<3,3>(0,0) = Eigen::AngleAxisd(i * M_PI_2, Eigen::Vector3d::UnitY()).toRotationMatrix();
+        H_sys_cam.at(i).block<3,1>(0,3) = H_sys_cam.at(i).block<3,3>(0,0) * Eigen::Vector3d(0.0, 0.0, 0.5);
+    }
+
+    Eigen::Matrix4d H_world_sys = Eigen::Matrix4d::Identity();
+    H_world_sys.block<3,3>(0,0) = Eigen::AngleAxisd(0.3, Eigen::Vector3d(1.0, 2.0, 3.0).normalized()).toRotationMatrix();
+    H_world_sys.block<3,1>(0,3) << 1.0, -2.0, 0.5;
+
+    for (int central = 1; central >= 0; --central)
+    {
+        Matrix4dVec cameraPoses = H_sys_cam;
+        if (central)
+        {
+            cameraPoses.assign(1, Eigen::Matrix4d::Identity());
+        }
+
+        Vector3dVec worldPoints, rays;
+        std::vector<int> cameraIds;
+        px::AbsolutePoseBatch batch;
+        batch.reserve(nPoints);
+        for (int i = 0; i < nPoints; ++i)
+        {
+            int cameraId = i % cameraPoses.size();
+            const Eigen::Matrix4d& H_cam = cameraPoses.at(cameraId);
+
+            Eigen::Vector3d P_cam(rng.uniform(-3.0, 3.0), rng.uniform(-2.0, 2.0), rng.uniform(2.0, 20.0));
+            Eigen::Vector3d ray = P_cam.normalized();
+            if (rng.uniform() < outlierRatio)
+            {
+                ray = Eigen::Vector3d(rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0), 1.0).normalized();
+            }
+
+            worldPoints.push_back(px::transformPoint(H_world_sys, px::transformPoint(H_cam, P_cam)));
+            rays.push_back(ray);
+            cameraIds.push_back(cameraId);
+
+            if (central)
+            {
+                batch.add(worldPoints.back(), ray);
+            }
+            else
+            {
+                batch.add(worldPoints.back(), ray, H_cam);
+            }
+        }
+
+        std::vector<size_t> sampleIds, sample;
+        for (int i = 0; i < nSamples; ++i)
+        {
+            px::sampleKofN(rng, 3, nPoints, sample);
+            sampleIds.insert(sampleIds.end(), sample.begin(), sample.end());
+        }
+
+        Eigen::Matrix4d H_legacy, H_batch;
+        size_t nInliersLegacy = 0;
+        double t = monotonicTime();
+        for (int i = 0; i < nRuns; ++i)
+        {
+            nInliersLegacy = legacyRansac(worldPoints, rays, cameraIds, cameraPoses,
+                                          sampleIds, central, k_cosThresh, H_legacy);
+        }
+        double legacyTime = (monotonicTime() - t) / nRuns;
+
+        size_t nInliersBatch = 0;
+        int nHypotheses = 0;
+        t = monotonicTime();
+        for (int i = 0; i < nRuns; ++i)
+        {
+            nInliersBatch = 0;
+            nHypotheses = batch.solveAndScore(&sampleIds[0], nSamples, k_cosThresh,
+                                              H_batch, nInliersBatch);
+        }
+        double batchTime = (monotonicTime() - t) / nRuns;
+
+        printf("%s, %d points, %d samples, %d hypotheses\n",
+               central ? "P3P" : "gP3P", nPoints, nSamples, nHypotheses);
+        printf("  %-24s %10.1f us/run   %zu inliers\n", "legacy loop", legacyTime * 1e6, nInliersLegacy);
+        printf("  %-24s %10.1f us/run   %zu inliers\n", "AbsolutePoseBatch", batchTime * 1e6, nInliersBatch);
+
+        // scoring alone, without preemption
+        t = monotonicTime();
+        size_t sum = 0;
+        for (int i = 0; i < nRuns * 10; ++i)
+        {
+            sum += batch.countInliers(H_world_sys, k_cosThresh);
+        }
+        printf("  %-24s %10.2f ns/point  (%zu)\n", "countInliers",
+               (monotonicTime() - t) / (nRuns * 10.0 * nPoints) * 1e9, sum);
+    }
+
+    // accuracy of the pose RANSAC on noisy rays
+    for (int central = 1; central >= 0; --central)
+    {
+        Matrix4dVec cameraPoses = H_sys_cam;
+        if (central)
+        {
+            cameraPoses.assign(1, Eigen::Matrix4d::Identity());
+        }
+
+        double rotationError[2] = {0.0, 0.0};
+        double translationError[2] = {0.0, 0.0};
+        double elapsed[2] = {0.0, 0.0};
+        int nIterations[2] = {0, 0};
+        for (int i = 0; i < nRuns; ++i)
+        {
+            px::AbsolutePoseBatch batch;
+            for (int j = 0; j < nPoints; ++j)
+            {
+                const Eigen::Matrix4d& H_cam = cameraPoses.at(j % cameraPoses.size());
+
+                Eigen::Vector3d P_cam(rng.uniform(-3.0, 3.0), rng.uniform(-2.0, 2.0), rng.uniform(2.0, 20.0));
+                Eigen::Vector3d ray = P_cam.normalized()
+                                      + Eigen::Vector3d(rng.normal(), rng.normal(), rng.normal()) * noise / sqrt(2.0);
+                if (rng.uniform() < outlierRatio)
+                {
+                    ray = Eigen::Vector3d(rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0), 1.0);
+                }
+
+                batch.add(px::transformPoint(H_world_sys, px::transformPoint(H_cam, P_cam)), ray, H_cam);
+            }
+
+            for (int k = 0; k < 2; ++k)
+            {
+                px::AbsolutePoseRansac ransac;
+                ransac.threshold() = cos(3.0 * noise);
+                if (k == 0)
+                {
+                    ransac.localIterations() = 0;
+                }
+
+                px::setRandomSeed(i);
+
+                Eigen::Matrix4d H;
+                std::vector<bool> inliers;
+                double t = monotonicTime();
+                ransac.estimate(batch, H, inliers);
+                elapsed[k] += monotonicTime() - t;
+
+                Eigen::Matrix3d dR = H.block<3,3>(0,0).transpose() * H_world_sys.block<3,3>(0,0);
+                rotationError[k] += Eigen::AngleAxisd(dR).angle();
+                translationError[k] += (H.block<3,1>(0,3) - H_world_sys.block<3,1>(0,3)).norm();
+                nIterations[k] += ransac.iterationCount();
+            }
+        }
+
+        printf("%s pose RANSAC, %d points, noise %.1f mrad\n",
+               central ? "P3P" : "gP3P", nPoints, noise * 1e3);
+        for (int k = 0; k < 2; ++k)
+        {
+            printf("  %-24s %10.1f us/run   %5.1f iterations   rot. error %.3f mrad   trans. error %.2f mm\n",
+                   k == 0 ? "plain" : "local optimization",
+                   elapsed[k] / nRuns * 1e6, static_cast<double>(nIterations[k]) / nRuns,
+                   rotationError[k] / nRuns * 1e3, translationError[k] / nRuns * 1e3);
+        }
+    }
+
+    return 0;
+}
@@ -8,13 +8,13 @@ namespace px
 
 // solve for roots using companion matrix
 template<int deg>
-void solveRoots(const std::vector<double>& coeffs, std::vector<double>& roots)
+void solveRoots(const double* coeffs, double* roots, int& nRoots)
 {
-    Eigen::MatrixXd companion = Eigen::MatrixXd::Zero(deg,deg);
+    Eigen::Matrix<double,deg,deg> companion = Eigen::Matrix<double,deg,deg>::Zero();
 
     for (int i = 0; i < deg; ++i)
     {
-        companion(i , deg - 1) = - coeffs.at(i) / coeffs.back();
+        companion(i , deg - 1) = - coeffs[i] / coeffs[deg];
     }
 
     for (int i = 1; i < deg; ++i)
@@ -23,8 +23,8 @@ void solveRoots(const std::vector<double>& coeffs, std::vector<double>& roots)
     }
 
     // find eigenvalues --> roots
-    roots.clear();
-    Eigen::EigenSolver<Eigen::MatrixXd> eigensolver(companion);
+    nRoots = 0;
+    Eigen::EigenSolver<Eigen::Matrix<double,deg,deg> > eigensolver(companion);
 
     // get real roots
     Eigen::Matrix<std::complex<double>,deg,1> r = eigensolver.eigenvalues();
@@ -33,14 +33,16 @@ void solveRoots(const std::vector<double>& coeffs, std::vector<double>& roots)
     {
         if (std::imag((std::complex<double>)r(i)) == 0.0)
         {
-            roots.push_back(std::real(r(i)));
+            roots[nRoots++] = std::real(r(i));
         }
     }
 }
 
 // solve for other roots
-void solveOtherRoots(double* k, double lambda, std::vector<double>& roots)
+void solveOtherRoots(const double* k, double lambda, double roots[2], int& nRoots)
 {
+    nRoots = 0;
+
     // form coefficients
     double a = k[0];
     double b = lambda * k[1] + k[2];
@@ -59,27 +61,27 @@ void solveOtherRoots(double* k, double lambda, std::vector<double>& roots)
 
         if (sol1 > 0.0)
         {
-            roots.push_back(sol1);
+            roots[nRoots++] = sol1;
         }
         if (sol2 > 0.0)
         {
-            roots.push_back(sol2);
+            roots[nRoots++] = sol2;
         }
     }
 }
 
-bool solvegP3P(const std::vector<PLine, Eigen::aligned_allocator<PLine> >& plineVectors,
-               const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& worldPoints,
-               std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> >& solutions)
+bool solvegP3P(const PLine plineVectors[3],
+               const Eigen::Vector3d worldPoints[3],
+               Eigen::Matrix4d solutions[k_maxgP3PSolutions], int& nSolutions)
 {
-    solutions.clear();
+    nSolutions = 0;
 
     // Extraction of world points
 
     Eigen::Vector3d P[3];
-    P[0] = worldPoints.at(0);
-    P[1] = worldPoints.at(1);
-    P[2] = worldPoints.at(2);
+    P[0] = worldPoints[0];
+    P[1] = worldPoints[1];
+    P[2] = worldPoints[2];
 
     // Verification that world points are not colinear
 
@@ -94,9 +96,9 @@ bool solvegP3P(const std::vector<PLine, Eigen::aligned_allocator<PLine> >& pline
     // Extraction of Plucker lines
 
     PLine l[3];
-    l[0] = plineVectors.at(0);
-    l[1] = plineVectors.at(1);
-    l[2] = plineVectors.at(2);
+    l[0] = plineVectors[0];
+    l[1] = plineVectors[1];
+    l[2] = plineVectors[2];
 
     // Form coefficients
 
@@ -198,9 +200,9 @@ bool solvegP3P(const std::vector<PLine, Eigen::aligned_allocator<PLine> >& pline
     double k36_pw3 = k36_pw2 * k36;
     double k36_pw4 = k36_pw2 * k36_pw2;
 
-    std::vector<double> coeffs(9);
+    double coeffs[9];
     // x^8
-    coeffs.at(8) =
+    coeffs[8] =
         (k11_pw4*k31_pw4*k24_pw4+
             k11_pw3*k12*k22*k31_pw3*k32*k24_pw3 +
             4*k11_pw3*k21*k31_pw3*k14*k24_pw3*k34 -
@@ -213,84 +215,86 @@ bool solvegP3P(const std::vector<PLine, Eigen::aligned_allocator<PLine> >& pline
             5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24_pw2*k34 + k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k24_pw2 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k24*k34 + 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k34_pw2 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24_pw2*k34 + k11_pw2*k21_pw2*k14_pw2*k32_pw4*k24_pw2 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k34_pw2 + k11_pw2*k22_pw4*k31_pw2*k14_pw2*k34_pw2 + k11*k12_pw3*k21*k22*k31_pw2*k32*k24_pw2*k34 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k34_pw2 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k24*k34 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k34_pw2 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k24*k34 + k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k34_pw2 + 4*k11*k21_pw3*k31*k14_pw3*k24*k34_pw3- 2*k11*k21_pw3*k14_pw3*k32_pw2*k24*k34_pw2 - 2*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34_pw3+ k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k34_pw2 + k12_pw4*k21_pw2*k31_pw2*k24_pw2*k34_pw2 + k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k34_pw2 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34_pw3+ k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k34_pw2 + k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34_pw3+ k12*k21_pw3*k22*k14_pw3*k32*k34_pw3+ k21_pw4*k14_pw4*k34_pw4);
 
     // x^7
-    coeffs.at(7) = (4*k25*k11_pw4*k31_pw4*k24_pw3 + 3*k25*k11_pw3*k12*k22*k31_pw3*k32*k24_pw2 + k33*k11_pw3*k12*k22*k31_pw3*k24_pw3 + k23*k11_pw3*k12*k31_pw3*k32*k24_pw3 + 4*k35*k11_pw3*k21*k31_pw3*k14*k24_pw3 + 12*k25*k11_pw3*k21*k31_pw3*k14*k24_pw2*k34 + 2*k15*k11_pw3*k21*k31_pw3*k32*k24_pw3 - 6*k25*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24_pw2 - 4*k33*k11_pw3*k21*k31_pw2*k14*k32*k24_pw3 - 2*k35*k11_pw3*k22_pw2*k31_pw3*k14*k24_pw2 - 4*k25*k11_pw3*k22_pw2*k31_pw3*k14*k24*k34 - k15*k11_pw3*k22_pw2*k31_pw3*k32*k24_pw2 + 2*k25*k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k24 + 2*k33*k11_pw3*k22_pw2*k31_pw2*k14*k32*k24_pw2 - 2*k13*k11_pw3*k22*k31_pw4*k24_pw3 - 4*k23*k11_pw3*k22*k31_pw3*k14*k24_pw2*k34 + 2*k23*k11_pw3*k22*k31_pw2*k14*k32_pw2*k24_pw2 - 2*k35*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw3 - 6*k25*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k34 + 3*k25*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24_pw2 + 2*k33*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24_pw3 + k35*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24_pw2 + 2*k25*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k34 + 2*k23*k11_pw2*k12_pw2*k22*k31_pw3*k24_pw2*k34 + 6*k15*k11_pw2*k12*k21*k22*k31_pw3*k24_pw2*k34 - 5*k35*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24_pw2 - 10*k25*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k34 - 5*k33*k11_pw2*k12*k21*k22*k31_pw2*k14*k24_pw2*k34 - k15*k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k24_pw2 + 2*k25*k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k24 + 3*k33*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k24_pw2 - 2*k13*k11_pw2*k12*k21*k31_pw3*k32*k24_pw3 - 5*k23*k11_pw2*k12*k21*k31_pw2*k14*k32*k24_pw2*k34 + k23*k11_pw2*k12*k21*k31*k14*k32_pw3*k24_pw2 - 2*k15*k11_pw2*k12*k22_pw3*k31_pw3*k24*k34 + k35*k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k24 + k25*k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k34 + k33*k11_pw2*k12*k22_pw3*k31_pw2*k14*k24*k34 - k13*k11_pw2*k12*k22_pw2*k31_pw3*k32*k24_pw2 + 3*k23*k11_pw2*k12*k22_pw2*k31_pw2*k14*k32*k24*k34 + 12*k35*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k34 + 12*k25*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k34_pw2 + 2*k15*k11_pw2*k21_pw2*k31_pw2*k14*k32*k24_pw2*k34 - 4*k35*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24_pw2 - 8*k25*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k34 - 8*k33*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24_pw2*k34 - 2*k15*k11_pw2*k21_pw2*k31*k14*k32_pw3*k24_pw2 + 2*k25*k11_pw2*k21_pw2*k14_pw2*k32_pw4*k24 + 4*k33*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k24_pw2 - 8*k35*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k34 - 4*k25*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k34_pw2 + 4*k15*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k24*k34 - 2*k13*k11_pw2*k21*k22*k31_pw3*k14*k24_pw2*k34 - 8*k23*k11_pw2*k21*k22*k31_pw2*k14_pw2*k24*k34_pw2 + k13*k11_pw2*k21*k22*k31_pw2*k14*k32_pw2*k24_pw2 + 2*k35*k11_pw2*k22_pw4*k31_pw2*k14_pw2*k34 - k15*k11_pw2*k22_pw4*k31_pw2*k14*k32*k34 + 2*k13*k11_pw2*k22_pw3*k31_pw3*k14*k24*k34 + 4*k23*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k34_pw2 - k13*k11_pw2*k22_pw3*k31_pw2*k14*k32_pw2*k24 + k35*k11*k12_pw3*k21*k22*k31_pw2*k32*k24_pw2 + 2*k25*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k34 + k33*k11*k12_pw3*k21*k22*k31_pw2*k24_pw2*k34 + k23*k11*k12_pw3*k21*k31_pw2*k32*k24_pw2*k34 - 8*k35*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k34 - 8*k25*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k34_pw2 + 2*k15*k11*k12_pw2*k21_pw2*k31_pw2*k32*k24_pw2*k34 - 2*k15*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k24*k34 + k35*k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k24 + k25*k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k34 + 2*k33*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k24*k34 - 2*k13*k11*k12_pw2*k21*k22*k31_pw3*k24_pw2*k34 - k13*k11*k12_pw2*k21*k22*k31_pw2*k32_pw2*k24_pw2 + 2*k23*k11*k12_pw2*k21*k22*k31*k14*k32_pw2*k24*k34 + 4*k15*k11*k12*k21_pw2*k22*k31_pw2*k14*k24*k34_pw2 - 10*k35*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k34 - 5*k25*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k34_pw2 - 5*k33*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k34_pw2 + k35*k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k24 + k25*k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k34 + 3*k33*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k24*k34 + 4*k13*k11*k12*k21_pw2*k31_pw2*k14*k32*k24_pw2*k34 - 5*k23*k11*k12*k21_pw2*k31*k14_pw2*k32*k24*k34_pw2 + k23*k11*k12*k21_pw2*k14_pw2*k32_pw3*k24*k34 + 2*k35*k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k34 + k33*k11*k12*k21*k22_pw3*k31*k14_pw2*k34_pw2 - k15*k11*k12*k21*k22_pw3*k31*k14*k32_pw2*k34 + 3*k23*k11*k12*k21*k22_pw2*k31*k14_pw2*k32*k34_pw2 - k13*k11*k12*k21*k22_pw2*k31*k14*k32_pw3*k24 + 12*k35*k11*k21_pw3*k31*k14_pw3*k24*k34_pw2 + 4*k25*k11*k21_pw3*k31*k14_pw3*k34_pw3- 2*k15*k11*k21_pw3*k31*k14_pw2*k32*k24*k34_pw2 - 4*k35*k11*k21_pw3*k14_pw3*k32_pw2*k24*k34 - 2*k25*k11*k21_pw3*k14_pw3*k32_pw2*k34_pw2 - 4*k33*k11*k21_pw3*k14_pw3*k32*k24*k34_pw2 + 2*k15*k11*k21_pw3*k14_pw2*k32_pw3*k24*k34 - 6*k35*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34_pw2 + k15*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k34_pw2 + 2*k35*k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k34 + 2*k33*k11*k21_pw2*k22_pw2*k14_pw3*k32*k34_pw2 - k15*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw3*k34 + 2*k13*k11*k21_pw2*k22*k31_pw2*k14_pw2*k24*k34_pw2 - 4*k23*k11*k21_pw2*k22*k31*k14_pw3*k34_pw3+ 4*k13*k11*k21_pw2*k22*k31*k14_pw2*k32_pw2*k24*k34 + 2*k23*k11*k21_pw2*k22*k14_pw3*k32_pw2*k34_pw2 - k13*k11*k21_pw2*k22*k14_pw2*k32_pw4*k24 - 2*k13*k11*k21*k22_pw3*k31_pw2*k14_pw2*k34_pw2 + 2*k35*k12_pw4*k21_pw2*k31_pw2*k24_pw2*k34 + 2*k25*k12_pw4*k21_pw2*k31_pw2*k24*k34_pw2 - 2*k15*k12_pw3*k21_pw2*k22*k31_pw2*k24*k34_pw2 + 2*k35*k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k34 + k25*k12_pw3*k21_pw2*k22*k31*k14*k32*k34_pw2 + k33*k12_pw3*k21_pw2*k22*k31*k14*k24*k34_pw2 - 2*k13*k12_pw3*k21_pw2*k31_pw2*k32*k24_pw2*k34 + k23*k12_pw3*k21_pw2*k31*k14*k32*k24*k34_pw2 - 6*k35*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34_pw2 - 2*k25*k12_pw2*k21_pw3*k31*k14_pw2*k34_pw3- 2*k15*k12_pw2*k21_pw3*k31*k14*k32*k24*k34_pw2 + 2*k35*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k34 + k25*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k34_pw2 + 2*k33*k12_pw2*k21_pw3*k14_pw2*k32*k24*k34_pw2 + 3*k35*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34_pw2 - k15*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k34_pw2 + 2*k13*k12_pw2*k21_pw2*k22*k31_pw2*k14*k24*k34_pw2 + 2*k23*k12_pw2*k21_pw2*k22*k31*k14_pw2*k34_pw3- 2*k13*k12_pw2*k21_pw2*k22*k31*k14*k32_pw2*k24*k34 - 2*k15*k12*k21_pw3*k22*k31*k14_pw2*k34_pw3+ 3*k35*k12*k21_pw3*k22*k14_pw3*k32*k34_pw2 + k33*k12*k21_pw3*k22*k14_pw3*k34_pw3- k15*k12*k21_pw3*k22*k14_pw2*k32_pw2*k34_pw2 + 6*k13*k12*k21_pw3*k31*k14_pw2*k32*k24*k34_pw2 + k23*k12*k21_pw3*k14_pw3*k32*k34_pw3- 2*k13*k12*k21_pw3*k14_pw2*k32_pw3*k24*k34 - k13*k12*k21_pw2*k22_pw2*k31*k14_pw2*k32*k34_pw2 + 4*k35*k21_pw4*k14_pw4*k34_pw3- 2*k15*k21_pw4*k14_pw3*k32*k34_pw3+ 2*k13*k21_pw3*k22*k31*k14_pw3*k34_pw3- k13*k21_pw3*k22*k14_pw3*k32_pw2*k34_pw2);
+    coeffs[7] = (4*k25*k11_pw4*k31_pw4*k24_pw3 + 3*k25*k11_pw3*k12*k22*k31_pw3*k32*k24_pw2 + k33*k11_pw3*k12*k22*k31_pw3*k24_pw3 + k23*k11_pw3*k12*k31_pw3*k32*k24_pw3 + 4*k35*k11_pw3*k21*k31_pw3*k14*k24_pw3 + 12*k25*k11_pw3*k21*k31_pw3*k14*k24_pw2*k34 + 2*k15*k11_pw3*k21*k31_pw3*k32*k24_pw3 - 6*k25*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24_pw2 - 4*k33*k11_pw3*k21*k31_pw2*k14*k32*k24_pw3 - 2*k35*k11_pw3*k22_pw2*k31_pw3*k14*k24_pw2 - 4*k25*k11_pw3*k22_pw2*k31_pw3*k14*k24*k34 - k15*k11_pw3*k22_pw2*k31_pw3*k32*k24_pw2 + 2*k25*k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k24 + 2*k33*k11_pw3*k22_pw2*k31_pw2*k14*k32*k24_pw2 - 2*k13*k11_pw3*k22*k31_pw4*k24_pw3 - 4*k23*k11_pw3*k22*k31_pw3*k14*k24_pw2*k34 + 2*k23*k11_pw3*k22*k31_pw2*k14*k32_pw2*k24_pw2 - 2*k35*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw3 - 6*k25*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k34 + 3*k25*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24_pw2 + 2*k33*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24_pw3 + k35*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24_pw2 + 2*k25*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k34 + 2*k23*k11_pw2*k12_pw2*k22*k31_pw3*k24_pw2*k34 + 6*k15*k11_pw2*k12*k21*k22*k31_pw3*k24_pw2*k34 - 5*k35*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24_pw2 - 10*k25*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k34 - 5*k33*k11_pw2*k12*k21*k22*k31_pw2*k14*k24_pw2*k34 - k15*k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k24_pw2 + 2*k25*k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k24 + 3*k33*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k24_pw2 - 2*k13*k11_pw2*k12*k21*k31_pw3*k32*k24_pw3 - 5*k23*k11_pw2*k12*k21*k31_pw2*k14*k32*k24_pw2*k34 + k23*k11_pw2*k12*k21*k31*k14*k32_pw3*k24_pw2 - 2*k15*k11_pw2*k12*k22_pw3*k31_pw3*k24*k34 + k35*k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k24 + k25*k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k34 + k33*k11_pw2*k12*k22_pw3*k31_pw2*k14*k24*k34 - k13*k11_pw2*k12*k22_pw2*k31_pw3*k32*k24_pw2 + 3*k23*k11_pw2*k12*k22_pw2*k31_pw2*k14*k32*k24*k34 + 12*k35*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k34 + 12*k25*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k34_pw2 + 2*k15*k11_pw2*k21_pw2*k31_pw2*k14*k32*k24_pw2*k34 - 4*k35*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24_pw2 - 8*k25*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k34 - 8*k33*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24_pw2*k34 - 2*k15*k11_pw2*k21_pw2*k31*k14*k32_pw3*k24_pw2 + 2*k25*k11_pw2*k21_pw2*k14_pw2*k32_pw4*k24 + 4*k33*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k24_pw2 - 8*k35*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k34 - 4*k25*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k34_pw2 + 4*k15*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k24*k34 - 2*k13*k11_pw2*k21*k22*k31_pw3*k14*k24_pw2*k34 - 8*k23*k11_pw2*k21*k22*k31_pw2*k14_pw2*k24*k34_pw2 + k13*k11_pw2*k21*k22*k31_pw2*k14*k32_pw2*k24_pw2 + 2*k35*k11_pw2*k22_pw4*k31_pw2*k14_pw2*k34 - k15*k11_pw2*k22_pw4*k31_pw2*k14*k32*k34 + 2*k13*k11_pw2*k22_pw3*k31_pw3*k14*k24*k34 + 4*k23*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k34_pw2 - k13*k11_pw2*k22_pw3*k31_pw2*k14*k32_pw2*k24 + k35*k11*k12_pw3*k21*k22*k31_pw2*k32*k24_pw2 + 2*k25*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k34 + k33*k11*k12_pw3*k21*k22*k31_pw2*k24_pw2*k34 + k23*k11*k12_pw3*k21*k31_pw2*k32*k24_pw2*k34 - 8*k35*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k34 - 8*k25*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k34_pw2 + 2*k15*k11*k12_pw2*k21_pw2*k31_pw2*k32*k24_pw2*k34 - 2*k15*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k24*k34 + k35*k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k24 + k25*k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k34 + 2*k33*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k24*k34 - 2*k13*k11*k12_pw2*k21*k22*k31_pw3*k24_pw2*k34 - k13*k11*k12_pw2*k21*k22*k31_pw2*k32_pw2*k24_pw2 + 2*k23*k11*k12_pw2*k21*k22*k31*k14*k32_pw2*k24*k34 + 4*k15*k11*k12*k21_pw2*k22*k31_pw2*k14*k24*k34_pw2 - 10*k35*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k34 - 5*k25*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k34_pw2 - 5*k33*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k34_pw2 + k35*k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k24 + k25*k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k34 + 3*k33*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k24*k34 + 4*k13*k11*k12*k21_pw2*k31_pw2*k14*k32*k24_pw2*k34 - 5*k23*k11*k12*k21_pw2*k31*k14_pw2*k32*k24*k34_pw2 + k23*k11*k12*k21_pw2*k14_pw2*k32_pw3*k24*k34 + 2*k35*k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k34 + k33*k11*k12*k21*k22_pw3*k31*k14_pw2*k34_pw2 - k15*k11*k12*k21*k22_pw3*k31*k14*k32_pw2*k34 + 3*k23*k11*k12*k21*k22_pw2*k31*k14_pw2*k32*k34_pw2 - k13*k11*k12*k21*k22_pw2*k31*k14*k32_pw3*k24 + 12*k35*k11*k21_pw3*k31*k14_pw3*k24*k34_pw2 + 4*k25*k11*k21_pw3*k31*k14_pw3*k34_pw3- 2*k15*k11*k21_pw3*k31*k14_pw2*k32*k24*k34_pw2 - 4*k35*k11*k21_pw3*k14_pw3*k32_pw2*k24*k34 - 2*k25*k11*k21_pw3*k14_pw3*k32_pw2*k34_pw2 - 4*k33*k11*k21_pw3*k14_pw3*k32*k24*k34_pw2 + 2*k15*k11*k21_pw3*k14_pw2*k32_pw3*k24*k34 - 6*k35*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34_pw2 + k15*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k34_pw2 + 2*k35*k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k34 + 2*k33*k11*k21_pw2*k22_pw2*k14_pw3*k32*k34_pw2 - k15*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw3*k34 + 2*k13*k11*k21_pw2*k22*k31_pw2*k14_pw2*k24*k34_pw2 - 4*k23*k11*k21_pw2*k22*k31*k14_pw3*k34_pw3+ 4*k13*k11*k21_pw2*k22*k31*k14_pw2*k32_pw2*k24*k34 + 2*k23*k11*k21_pw2*k22*k14_pw3*k32_pw2*k34_pw2 - k13*k11*k21_pw2*k22*k14_pw2*k32_pw4*k24 - 2*k13*k11*k21*k22_pw3*k31_pw2*k14_pw2*k34_pw2 + 2*k35*k12_pw4*k21_pw2*k31_pw2*k24_pw2*k34 + 2*k25*k12_pw4*k21_pw2*k31_pw2*k24*k34_pw2 - 2*k15*k12_pw3*k21_pw2*k22*k31_pw2*k24*k34_pw2 + 2*k35*k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k34 + k25*k12_pw3*k21_pw2*k22*k31*k14*k32*k34_pw2 + k33*k12_pw3*k21_pw2*k22*k31*k14*k24*k34_pw2 - 2*k13*k12_pw3*k21_pw2*k31_pw2*k32*k24_pw2*k34 + k23*k12_pw3*k21_pw2*k31*k14*k32*k24*k34_pw2 - 6*k35*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34_pw2 - 2*k25*k12_pw2*k21_pw3*k31*k14_pw2*k34_pw3- 2*k15*k12_pw2*k21_pw3*k31*k14*k32*k24*k34_pw2 + 2*k35*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k34 + k25*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k34_pw2 + 2*k33*k12_pw2*k21_pw3*k14_pw2*k32*k24*k34_pw2 + 3*k35*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34_pw2 - k15*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k34_pw2 + 2*k13*k12_pw2*k21_pw2*k22*k31_pw2*k14*k24*k34_pw2 + 2*k23*k12_pw2*k21_pw2*k22*k31*k14_pw2*k34_pw3- 2*k13*k12_pw2*k21_pw2*k22*k31*k14*k32_pw2*k24*k34 - 2*k15*k12*k21_pw3*k22*k31*k14_pw2*k34_pw3+ 3*k35*k12*k21_pw3*k22*k14_pw3*k32*k34_pw2 + k33*k12*k21_pw3*k22*k14_pw3*k34_pw3- k15*k12*k21_pw3*k22*k14_pw2*k32_pw2*k34_pw2 + 6*k13*k12*k21_pw3*k31*k14_pw2*k32*k24*k34_pw2 + k23*k12*k21_pw3*k14_pw3*k32*k34_pw3- 2*k13*k12*k21_pw3*k14_pw2*k32_pw3*k24*k34 - k13*k12*k21_pw2*k22_pw2*k31*k14_pw2*k32*k34_pw2 + 4*k35*k21_pw4*k14_pw4*k34_pw3- 2*k15*k21_pw4*k14_pw3*k32*k34_pw3+ 2*k13*k21_pw3*k22*k31*k14_pw3*k34_pw3- k13*k21_pw3*k22*k14_pw3*k32_pw2*k34_pw2);
 
     // x^6
-    coeffs.at(6) = (6*k11_pw4*k31_pw4*k24_pw2*k25_pw2 + 6*k21_pw4*k14_pw4*k34_pw2*k35_pw2+ 4*k11_pw4*k31_pw4*k24_pw3*k26 + 4*k21_pw4*k14_pw4*k34_pw3*k36 + k11_pw2*k13_pw2*k22_pw2*k31_pw4*k24_pw2 + k11_pw2*k21_pw2*k14_pw2*k32_pw4*k25_pw2 + k11_pw2*k22_pw4*k31_pw2*k14_pw2*k35_pw2+ k12_pw4*k21_pw2*k31_pw2*k24_pw2*k35_pw2+ k12_pw4*k21_pw2*k31_pw2*k25_pw2*k34_pw2 + k21_pw4*k14_pw2*k32_pw2*k15_pw2*k34_pw2 - 2*k11_pw3*k13*k31_pw4*k23*k24_pw3 - 4*k11_pw3*k21*k31_pw4*k24_pw3*k16 - 4*k21_pw4*k31*k14_pw3*k16*k34_pw3- 2*k21_pw4*k14_pw3*k15*k33*k34_pw3+ 2*k11_pw2*k21*k13_pw2*k31_pw4*k24_pw3 + k11_pw2*k22_pw4*k31_pw3*k15_pw2*k34 + 2*k11_pw3*k22_pw2*k31_pw4*k24_pw2*k16 + k21_pw3*k13_pw2*k14_pw2*k32_pw4*k24 + 2*k21_pw4*k31*k14_pw2*k15_pw2*k34_pw3+ 2*k21_pw4*k14_pw3*k32_pw2*k16*k34_pw2 + k11_pw3*k12*k31_pw3*k23*k24_pw3*k33 + 2*k11_pw3*k21*k31_pw3*k15*k24_pw3*k33 - 6*k11_pw3*k13*k22*k31_pw4*k24_pw2*k25 + 2*k21_pw3*k13*k31*k14_pw3*k23*k34_pw3- 2*k11*k21_pw3*k14_pw2*k32_pw4*k24*k16 - 2*k11_pw2*k22_pw4*k31_pw3*k14*k16*k34 + 4*k11_pw3*k21*k31_pw3*k14*k24_pw3*k36 + 4*k11*k21_pw3*k31*k14_pw3*k34_pw3*k26 + k12*k21_pw3*k14_pw3*k23*k33*k34_pw3- 6*k21_pw4*k14_pw3*k32*k15*k34_pw2*k35 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k24_pw2 + k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k24_pw2 + 6*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k24_pw2*k33_pw2 + 6*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k34_pw2 + k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k34_pw2 + k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k34_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k35_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k34_pw2 - 2*k11_pw3*k21*k31_pw2*k14*k24_pw3*k33_pw2 + k11*k21_pw2*k22_pw2*k14_pw2*k32_pw4*k16 - 2*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34_pw3- 2*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw3*k36 + k11_pw2*k22_pw4*k31_pw2*k14*k32_pw2*k16 - k11_pw3*k22_pw2*k31_pw3*k15*k24_pw2*k33 + 2*k11_pw2*k21_pw2*k14_pw2*k32_pw4*k24*k26 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k25_pw2*k34 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k24_pw2*k34 - k21_pw3*k13*k14_pw3*k23*k32_pw2*k34_pw2 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k24*k35_pw2- 2*k11*k21_pw3*k14_pw3*k24*k33_pw2*k34_pw2 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k24_pw2*k36 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k34_pw3*k26 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k34_pw2*k26 + 2*k11_pw2*k22_pw4*k31_pw2*k14_pw2*k34*k36 + 2*k12_pw4*k21_pw2*k31_pw2*k24*k34_pw2*k26 + 2*k12_pw4*k21_pw2*k31_pw2*k24_pw2*k34*k36 + k11_pw2*k12_pw2*k21*k31_pw2*k24_pw3*k33_pw2 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25_pw2*k34 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24_pw2*k34 + k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k25_pw2 + k11_pw3*k22_pw2*k31_pw2*k14*k24_pw2*k33_pw2 + k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k24_pw2 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24_pw2*k34 + k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34_pw3+ k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k35_pw2+ k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k34_pw2 + k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k34_pw2 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24_pw2*k34 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k34_pw2 + 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k34_pw2 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k34_pw2 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k34_pw2*k26 - 2*k11_pw2*k12*k21*k13*k31_pw3*k24_pw3*k33 - k11*k21_pw2*k13*k14_pw2*k23*k32_pw4*k24 - k11*k21_pw2*k13*k22*k14_pw2*k32_pw4*k25 + k11_pw2*k12*k22_pw3*k31_pw3*k32*k24*k16 + k11_pw2*k13*k22_pw3*k31_pw3*k32*k15*k24 + 3*k11_pw3*k12*k22*k31_pw3*k32*k24*k25_pw2 + 3*k11_pw3*k12*k31_pw3*k23*k32*k24_pw2*k25 + 3*k11_pw3*k12*k22*k31_pw3*k24_pw2*k33*k25 + 3*k11_pw3*k12*k22*k31_pw3*k32*k24_pw2*k26 - 2*k11_pw3*k22*k31_pw3*k23*k32*k15*k24_pw2 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k24*k35 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k25*k34 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k24*k35 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k25*k34 + 6*k11_pw3*k21*k31_pw3*k32*k15*k24_pw2*k25 - 2*k12*k21_pw3*k31*k14_pw2*k23*k15*k34_pw3- k11_pw2*k22_pw4*k31_pw2*k14*k32*k15*k35 - k11_pw2*k22_pw4*k31_pw2*k14*k15*k33*k34 - 2*k11_pw3*k22_pw2*k31_pw3*k32*k15*k24*k25 + 12*k11_pw3*k21*k31_pw3*k14*k24*k25_pw2*k34 - 4*k11_pw3*k22*k31_pw3*k14*k23*k24_pw2*k35 + k21_pw3*k13*k22*k14_pw2*k32_pw3*k15*k34 - 2*k21_pw3*k13*k22*k14_pw3*k32*k33*k34_pw2 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k24*k35 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k25*k34 + k12*k21_pw3*k22*k14_pw2*k32_pw3*k16*k34 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k25*k35 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k34*k26 + 6*k21_pw3*k13*k22*k31*k14_pw3*k34_pw2*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k24*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k25*k34 - 4*k11*k21_pw3*k14_pw3*k32*k33*k25*k34_pw2 + 12*k11*k21_pw3*k31*k14_pw3*k24*k34*k35_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k32*k34*k35_pw2- 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k25*k35 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k34*k26 - 2*k21_pw3*k13*k22*k14_pw3*k32_pw2*k34*k35 + 12*k11*k21_pw3*k31*k14_pw3*k24*k34_pw2*k36 + 12*k11*k21_pw3*k31*k14_pw3*k25*k34_pw2*k35 + 3*k12*k21_pw3*k14_pw3*k23*k32*k34_pw2*k35 + 3*k12*k21_pw3*k22*k14_pw3*k32*k34_pw2*k36 + 3*k12*k21_pw3*k22*k14_pw3*k33*k34_pw2*k35 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k24*k34*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k25*k34*k35 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k25*k34*k35 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k24_pw2*k33 - k11_pw2*k13*k22_pw3*k31_pw2*k14*k32_pw2*k25 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24_pw2*k34 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25_pw2*k34 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24_pw2*k35 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k24*k34 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24*k25_pw2 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k24_pw2*k16*k34 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k25*k35 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k34*k26 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24_pw2*k26 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k24_pw2*k33*k34 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24_pw2*k35 - k11*k21_pw2*k22_pw2*k14_pw2*k32_pw3*k15*k35 - 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34*k35_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k34_pw2 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k25*k35 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k34*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k24_pw2*k16*k34 + 8*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k24*k33*k25 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k24*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k34_pw2 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k34_pw2 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k24*k34 - 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k34_pw2 - k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k34_pw2 + 8*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k34*k35 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k34_pw2 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k34*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k34_pw2 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34*k35_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34_pw2*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34_pw2*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k34*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k34*k35 - 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k24_pw2 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24*k25_pw2 - 2*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k24_pw2*k16 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24_pw2*k26 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k35_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k34_pw2 - 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k34_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k24_pw2*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k35_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k34_pw2 + 6*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k34_pw2 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25_pw2*k34 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k24_pw2*k33_pw2*k34 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k34_pw2*k26 - 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k34_pw2 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24_pw2*k36 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34*k35_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k34_pw2*k26 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34_pw2*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k34*k36 - k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k24_pw2 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k24 - k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k24_pw2 + k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k24_pw2 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k32_pw2*k24*k16 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k34_pw2 - 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32_pw2*k24 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24_pw2*k33*k25 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32_pw2*k24*k16 + 2*k11*k21_pw2*k22_pw2*k31*k14*k32_pw2*k15_pw2*k34 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k34_pw2 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k34_pw2 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k34_pw2 - 6*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k24_pw2*k33 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k34_pw2 + 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k34_pw2 + 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k34_pw2 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24_pw2*k35 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24_pw2*k33*k34 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32_pw2*k16*k34 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k34_pw2 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k32_pw2*k16*k34 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k34_pw2 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k34_pw2*k26 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw2*k15*k33*k34 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24_pw2*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24_pw2*k33*k34 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24_pw2*k33*k35 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34_pw2*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k34*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k25*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k34*k26 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k34*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k34*k35 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k34*k35 + k11*k12*k21*k22_pw3*k31*k14*k32_pw3*k16 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k25*k34 - 8*k11*k21_pw3*k14_pw3*k32*k24*k33*k34*k35 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k24_pw2 + k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k25_pw2 - 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k24_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k24_pw2*k25 - k11_pw2*k12*k21*k22*k31_pw3*k32*k24_pw2*k16 - k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k24_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k24_pw2*k34 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k24_pw2*k35 + k11*k12*k21*k22_pw3*k31_pw2*k32*k15_pw2*k34 + k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k35_pw2+ k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw3*k24 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k24*k25 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32_pw3*k24*k33 + k11*k12_pw3*k21*k22*k31_pw2*k32*k25_pw2*k34 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k24_pw2*k34 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k24*k34 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k24_pw2*k34 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k24_pw2*k35 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k24_pw2*k34 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k24_pw2*k35 - 2*k11_pw2*k13*k22_pw3*k31_pw2*k14*k32*k24*k33 + k11*k12_pw3*k21*k31_pw2*k23*k24_pw2*k33*k34 + k11*k12_pw3*k21*k31_pw2*k23*k32*k24_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k24_pw2*k33*k35 + k11*k12_pw3*k21*k22*k31_pw2*k32*k24_pw2*k36 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k24*k34 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k24*k34 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32*k24_pw2*k33 - 2*k11*k21_pw2*k22*k14_pw2*k23*k32_pw3*k15*k34 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k34_pw2 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k24*k35 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k25*k34 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k24*k36 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k25*k35 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k34*k26 - 4*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k34*k35 + 3*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k34_pw2 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k25*k34 - 4*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k24*k25 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32*k15*k34 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k24*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k25*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k34*k26 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k24*k33*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k25*k34 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k24*k16*k34 - 12*k11_pw3*k21*k31_pw2*k14*k32*k24_pw2*k33*k25 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k24*k25 + k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k35_pw2- k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k34_pw2 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k34_pw2*k35 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k24*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k34_pw2 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k34_pw2 + 6*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k34_pw2 - k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k34_pw2 + 4*k11_pw3*k22_pw2*k31_pw2*k14*k32*k24*k33*k25 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k25*k34 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k24*k16*k34 + k12_pw3*k21_pw2*k22*k31*k14*k32*k34_pw2*k26 + k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k34_pw2 + k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k34_pw2 + k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k34_pw2 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k34*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k24*k16*k34 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k34_pw2 - 2*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k34_pw2 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k24*k33*k34 - 2*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k34_pw2 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k34_pw2 - 2*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k34_pw2 + 4*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k34*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k24*k33*k34 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k34_pw2*k35 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k34*k35 - 2*k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k34*k35 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k34*k35 - k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw3*k25 + 2*k11*k21_pw2*k13*k22*k31*k14*k32_pw3*k15*k24 - 2*k11*k12*k21_pw2*k22*k31*k14*k32_pw3*k24*k16 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k24*k34 + 2*k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k24*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k24*k25 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k25*k34 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k32*k16*k34 - k11*k12*k21*k22_pw3*k31*k14*k32_pw2*k15*k35 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k32*k15*k34 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k25*k34 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k25*k34 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k25*k34 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k25*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k34*k26 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k25*k34 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k34*k36 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k34*k35 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k24*k34 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k34*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k34*k35 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k34*k35 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k34*k35 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k24_pw2*k33 + k11*k12*k21*k13*k22_pw2*k31_pw2*k32_pw2*k15*k24 + 3*k11_pw2*k12*k21*k22*k31*k14*k32*k24_pw2*k33_pw2 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k24*k25 + 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k34_pw2 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k24_pw2*k33 + 3*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k24_pw2*k33 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k24_pw2*k33 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k34_pw2 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k24*k25 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25_pw2*k34 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k24*k25 + k11*k12_pw2*k21*k22_pw2*k31*k14*k24*k33_pw2*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k24*k34 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k24_pw2*k33*k34 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24_pw2*k35 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k24*k34 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k35_pw2- 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k34_pw2 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k24_pw2*k33*k34 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24_pw2*k35 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k24_pw2*k33*k35 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24_pw2*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k24*k34 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k24*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k25*k34 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k24*k33*k34 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k24*k36 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k25*k35 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k34*k26 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k24*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k25*k34 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k24*k34 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k34_pw2 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k34_pw2 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k34_pw2 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k24*k33_pw2*k34 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k34_pw2*k26 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k34_pw2 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k34_pw2 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k34_pw2 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k24*k34 + k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw2*k15*k34 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k24*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k25*k34 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k24*k33*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k24*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k24*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k25*k34 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k24*k34 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k34_pw2 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k24*k33*k34 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k24*k33*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k25*k34 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k24*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k25*k34 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k24*k33*k34 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k25*k34 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k34*k35 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k34*k35 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k34*k35 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k34*k35 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k34*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k25*k34 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k25*k34 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k34*k35 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k34*k35 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw2*k24*k33 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw2*k15*k34 + 6*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k24*k33*k25 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k24*k34 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k24*k35 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k25*k34 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k24*k33*k35 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k25*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k24*k34 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k24*k33*k34 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k25*k34 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k24*k16*k34 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k34*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k25*k34 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k25*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k34*k26 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k25*k34 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k24*k34 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k24*k33*k34 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k34*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k34*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k34*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k34*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k34*k35 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw3*k24 - 2*k11*k12*k21*k22_pw3*k31*k14*k32*k15*k33*k34 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k24*k33*k34);
+    coeffs[6] = (6*k11_pw4*k31_pw4*k24_pw2*k25_pw2 + 6*k21_pw4*k14_pw4*k34_pw2*k35_pw2+ 4*k11_pw4*k31_pw4*k24_pw3*k26 + 4*k21_pw4*k14_pw4*k34_pw3*k36 + k11_pw2*k13_pw2*k22_pw2*k31_pw4*k24_pw2 + k11_pw2*k21_pw2*k14_pw2*k32_pw4*k25_pw2 + k11_pw2*k22_pw4*k31_pw2*k14_pw2*k35_pw2+ k12_pw4*k21_pw2*k31_pw2*k24_pw2*k35_pw2+ k12_pw4*k21_pw2*k31_pw2*k25_pw2*k34_pw2 + k21_pw4*k14_pw2*k32_pw2*k15_pw2*k34_pw2 - 2*k11_pw3*k13*k31_pw4*k23*k24_pw3 - 4*k11_pw3*k21*k31_pw4*k24_pw3*k16 - 4*k21_pw4*k31*k14_pw3*k16*k34_pw3- 2*k21_pw4*k14_pw3*k15*k33*k34_pw3+ 2*k11_pw2*k21*k13_pw2*k31_pw4*k24_pw3 + k11_pw2*k22_pw4*k31_pw3*k15_pw2*k34 + 2*k11_pw3*k22_pw2*k31_pw4*k24_pw2*k16 + k21_pw3*k13_pw2*k14_pw2*k32_pw4*k24 + 2*k21_pw4*k31*k14_pw2*k15_pw2*k34_pw3+ 2*k21_pw4*k14_pw3*k32_pw2*k16*k34_pw2 + k11_pw3*k12*k31_pw3*k23*k24_pw3*k33 + 2*k11_pw3*k21*k31_pw3*k15*k24_pw3*k33 - 6*k11_pw3*k13*k22*k31_pw4*k24_pw2*k25 + 2*k21_pw3*k13*k31*k14_pw3*k23*k34_pw3- 2*k11*k21_pw3*k14_pw2*k32_pw4*k24*k16 - 2*k11_pw2*k22_pw4*k31_pw3*k14*k16*k34 + 4*k11_pw3*k21*k31_pw3*k14*k24_pw3*k36 + 4*k11*k21_pw3*k31*k14_pw3*k34_pw3*k26 + k12*k21_pw3*k14_pw3*k23*k33*k34_pw3- 6*k21_pw4*k14_pw3*k32*k15*k34_pw2*k35 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k24_pw2 + k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k24_pw2 + 6*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k24_pw2*k33_pw2 + 6*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k34_pw2 + k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k34_pw2 + k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k34_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k35_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k34_pw2 - 2*k11_pw3*k21*k31_pw2*k14*k24_pw3*k33_pw2 + k11*k21_pw2*k22_pw2*k14_pw2*k32_pw4*k16 - 2*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34_pw3- 2*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw3*k36 + k11_pw2*k22_pw4*k31_pw2*k14*k32_pw2*k16 - k11_pw3*k22_pw2*k31_pw3*k15*k24_pw2*k33 + 2*k11_pw2*k21_pw2*k14_pw2*k32_pw4*k24*k26 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k25_pw2*k34 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k24_pw2*k34 - k21_pw3*k13*k14_pw3*k23*k32_pw2*k34_pw2 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k24*k35_pw2- 2*k11*k21_pw3*k14_pw3*k24*k33_pw2*k34_pw2 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k24_pw2*k36 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k34_pw3*k26 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k34_pw2*k26 + 2*k11_pw2*k22_pw4*k31_pw2*k14_pw2*k34*k36 + 2*k12_pw4*k21_pw2*k31_pw2*k24*k34_pw2*k26 + 2*k12_pw4*k21_pw2*k31_pw2*k24_pw2*k34*k36 + k11_pw2*k12_pw2*k21*k31_pw2*k24_pw3*k33_pw2 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25_pw2*k34 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24_pw2*k34 + k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k25_pw2 + k11_pw3*k22_pw2*k31_pw2*k14*k24_pw2*k33_pw2 + k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k24_pw2 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24_pw2*k34 + k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34_pw3+ k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k35_pw2+ k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k34_pw2 + k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k34_pw2 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24_pw2*k34 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k34_pw2 + 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k34_pw2 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k34_pw2 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k34_pw2*k26 - 2*k11_pw2*k12*k21*k13*k31_pw3*k24_pw3*k33 - k11*k21_pw2*k13*k14_pw2*k23*k32_pw4*k24 - k11*k21_pw2*k13*k22*k14_pw2*k32_pw4*k25 + k11_pw2*k12*k22_pw3*k31_pw3*k32*k24*k16 + k11_pw2*k13*k22_pw3*k31_pw3*k32*k15*k24 + 3*k11_pw3*k12*k22*k31_pw3*k32*k24*k25_pw2 + 3*k11_pw3*k12*k31_pw3*k23*k32*k24_pw2*k25 + 3*k11_pw3*k12*k22*k31_pw3*k24_pw2*k33*k25 + 3*k11_pw3*k12*k22*k31_pw3*k32*k24_pw2*k26 - 2*k11_pw3*k22*k31_pw3*k23*k32*k15*k24_pw2 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k24*k35 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k25*k34 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k24*k35 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k25*k34 + 6*k11_pw3*k21*k31_pw3*k32*k15*k24_pw2*k25 - 2*k12*k21_pw3*k31*k14_pw2*k23*k15*k34_pw3- k11_pw2*k22_pw4*k31_pw2*k14*k32*k15*k35 - k11_pw2*k22_pw4*k31_pw2*k14*k15*k33*k34 - 2*k11_pw3*k22_pw2*k31_pw3*k32*k15*k24*k25 + 12*k11_pw3*k21*k31_pw3*k14*k24*k25_pw2*k34 - 4*k11_pw3*k22*k31_pw3*k14*k23*k24_pw2*k35 + k21_pw3*k13*k22*k14_pw2*k32_pw3*k15*k34 - 2*k21_pw3*k13*k22*k14_pw3*k32*k33*k34_pw2 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k24*k35 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k25*k34 + k12*k21_pw3*k22*k14_pw2*k32_pw3*k16*k34 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k25*k35 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k34*k26 + 6*k21_pw3*k13*k22*k31*k14_pw3*k34_pw2*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k24*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k25*k34 - 4*k11*k21_pw3*k14_pw3*k32*k33*k25*k34_pw2 + 12*k11*k21_pw3*k31*k14_pw3*k24*k34*k35_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k32*k34*k35_pw2- 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k25*k35 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k34*k26 - 2*k21_pw3*k13*k22*k14_pw3*k32_pw2*k34*k35 + 12*k11*k21_pw3*k31*k14_pw3*k24*k34_pw2*k36 + 12*k11*k21_pw3*k31*k14_pw3*k25*k34_pw2*k35 + 3*k12*k21_pw3*k14_pw3*k23*k32*k34_pw2*k35 + 3*k12*k21_pw3*k22*k14_pw3*k32*k34_pw2*k36 + 3*k12*k21_pw3*k22*k14_pw3*k33*k34_pw2*k35 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k24*k34*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k25*k34*k35 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k25*k34*k35 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k24_pw2*k33 - k11_pw2*k13*k22_pw3*k31_pw2*k14*k32_pw2*k25 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24_pw2*k34 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25_pw2*k34 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24_pw2*k35 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k24*k34 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24*k25_pw2 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k24_pw2*k16*k34 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k25*k35 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k34*k26 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24_pw2*k26 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k24_pw2*k33*k34 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24_pw2*k35 - k11*k21_pw2*k22_pw2*k14_pw2*k32_pw3*k15*k35 - 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34*k35_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k34_pw2 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k25*k35 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k34*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k24_pw2*k16*k34 + 8*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k24*k33*k25 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k24*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k34_pw2 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k34_pw2 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k24*k34 - 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k34_pw2 - k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k34_pw2 + 8*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k34*k35 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k34_pw2 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k34*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k34_pw2 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34*k35_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34_pw2*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34_pw2*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k34*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k34*k35 - 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k24_pw2 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24*k25_pw2 - 2*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k24_pw2*k16 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24_pw2*k26 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k35_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k34_pw2 - 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k34_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k24_pw2*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k35_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k34_pw2 + 6*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k34_pw2 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25_pw2*k34 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k24_pw2*k33_pw2*k34 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k34_pw2*k26 - 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k34_pw2 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24_pw2*k36 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34*k35_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k34_pw2*k26 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34_pw2*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k34*k36 - k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k24_pw2 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k24 - k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k24_pw2 + k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k24_pw2 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k32_pw2*k24*k16 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k34_pw2 - 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32_pw2*k24 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24_pw2*k33*k25 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32_pw2*k24*k16 + 2*k11*k21_pw2*k22_pw2*k31*k14*k32_pw2*k15_pw2*k34 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k34_pw2 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k34_pw2 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k34_pw2 - 6*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k24_pw2*k33 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k34_pw2 + 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k34_pw2 + 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k34_pw2 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24_pw2*k35 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24_pw2*k33*k34 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32_pw2*k16*k34 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k34_pw2 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k32_pw2*k16*k34 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k34_pw2 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k34_pw2*k26 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw2*k15*k33*k34 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24_pw2*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24_pw2*k33*k34 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24_pw2*k33*k35 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34_pw2*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k34*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k25*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k34*k26 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k34*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k34*k35 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k34*k35 + k11*k12*k21*k22_pw3*k31*k14*k32_pw3*k16 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k25*k34 - 8*k11*k21_pw3*k14_pw3*k32*k24*k33*k34*k35 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k24_pw2 + k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k25_pw2 - 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k24_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k24_pw2*k25 - k11_pw2*k12*k21*k22*k31_pw3*k32*k24_pw2*k16 - k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k24_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k24_pw2*k34 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k24_pw2*k35 + k11*k12*k21*k22_pw3*k31_pw2*k32*k15_pw2*k34 + k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k35_pw2+ k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw3*k24 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k24*k25 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32_pw3*k24*k33 + k11*k12_pw3*k21*k22*k31_pw2*k32*k25_pw2*k34 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k24_pw2*k34 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k24*k34 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k24_pw2*k34 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k24_pw2*k35 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k24_pw2*k34 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k24_pw2*k35 - 2*k11_pw2*k13*k22_pw3*k31_pw2*k14*k32*k24*k33 + k11*k12_pw3*k21*k31_pw2*k23*k24_pw2*k33*k34 + k11*k12_pw3*k21*k31_pw2*k23*k32*k24_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k24_pw2*k33*k35 + k11*k12_pw3*k21*k22*k31_pw2*k32*k24_pw2*k36 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k24*k34 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k24*k34 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32*k24_pw2*k33 - 2*k11*k21_pw2*k22*k14_pw2*k23*k32_pw3*k15*k34 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k34_pw2 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k24*k35 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k25*k34 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k24*k36 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k25*k35 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k34*k26 - 4*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k34*k35 + 3*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k34_pw2 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k25*k34 - 4*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k24*k25 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32*k15*k34 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k24*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k25*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k34*k26 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k24*k33*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k25*k34 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k24*k16*k34 - 12*k11_pw3*k21*k31_pw2*k14*k32*k24_pw2*k33*k25 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k24*k25 + k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k35_pw2- k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k34_pw2 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k34_pw2*k35 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k24*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k34_pw2 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k34_pw2 + 6*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k34_pw2 - k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k34_pw2 + 4*k11_pw3*k22_pw2*k31_pw2*k14*k32*k24*k33*k25 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k25*k34 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k24*k16*k34 + k12_pw3*k21_pw2*k22*k31*k14*k32*k34_pw2*k26 + k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k34_pw2 + k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k34_pw2 + k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k34_pw2 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k34*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k24*k16*k34 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k34_pw2 - 2*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k34_pw2 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k24*k33*k34 - 2*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k34_pw2 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k34_pw2 - 2*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k34_pw2 + 4*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k34*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k24*k33*k34 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k34_pw2*k35 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k34*k35 - 2*k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k34*k35 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k34*k35 - k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw3*k25 + 2*k11*k21_pw2*k13*k22*k31*k14*k32_pw3*k15*k24 - 2*k11*k12*k21_pw2*k22*k31*k14*k32_pw3*k24*k16 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k24*k34 + 2*k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k24*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k24*k25 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k25*k34 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k32*k16*k34 - k11*k12*k21*k22_pw3*k31*k14*k32_pw2*k15*k35 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k32*k15*k34 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k25*k34 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k25*k34 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k25*k34 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k25*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k34*k26 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k25*k34 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k34*k36 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k34*k35 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k24*k34 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k34*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k34*k35 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k34*k35 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k34*k35 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k24_pw2*k33 + k11*k12*k21*k13*k22_pw2*k31_pw2*k32_pw2*k15*k24 + 3*k11_pw2*k12*k21*k22*k31*k14*k32*k24_pw2*k33_pw2 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k24*k25 + 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k34_pw2 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k24_pw2*k33 + 3*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k24_pw2*k33 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k24_pw2*k33 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k34_pw2 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k24*k25 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25_pw2*k34 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k24*k25 + k11*k12_pw2*k21*k22_pw2*k31*k14*k24*k33_pw2*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k24*k34 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k24_pw2*k33*k34 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24_pw2*k35 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k24*k34 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k35_pw2- 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k34_pw2 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k24_pw2*k33*k34 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24_pw2*k35 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k24_pw2*k33*k35 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24_pw2*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k24*k34 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k24*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k25*k34 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k24*k33*k34 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k24*k36 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k25*k35 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k34*k26 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k24*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k25*k34 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k24*k34 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k34_pw2 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k34_pw2 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k34_pw2 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k24*k33_pw2*k34 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k34_pw2*k26 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k34_pw2 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k34_pw2 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k34_pw2 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k24*k34 + k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw2*k15*k34 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k24*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k25*k34 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k24*k33*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k24*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k24*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k25*k34 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k24*k34 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k34_pw2 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k24*k33*k34 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k24*k33*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k25*k34 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k24*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k25*k34 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k24*k33*k34 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k25*k34 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k34*k35 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k34*k35 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k34*k35 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k34*k35 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k34*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k25*k34 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k25*k34 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k34*k35 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k34*k35 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw2*k24*k33 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw2*k15*k34 + 6*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k24*k33*k25 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k24*k34 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k24*k35 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k25*k34 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k24*k33*k35 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k25*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k24*k34 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k24*k33*k34 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k25*k34 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k24*k16*k34 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k34*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k25*k34 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k25*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k34*k26 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k25*k34 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k24*k34 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k24*k33*k34 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k34*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k34*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k34*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k34*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k34*k35 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw3*k24 - 2*k11*k12*k21*k22_pw3*k31*k14*k32*k15*k33*k34 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k24*k33*k34);
 
     // x^5
-    coeffs.at(5) = (4*k11_pw4*k31_pw4*k24*k25_pw3 + 4*k21_pw4*k14_pw4*k34*k35_pw3 + 12*k11_pw4*k31_pw4*k24_pw2*k25*k26 + 12*k21_pw4*k14_pw4*k34_pw2*k35*k36 + k11_pw2*k22_pw4*k31_pw3*k15_pw2*k35 + k21_pw3*k13_pw2*k14_pw2*k32_pw4*k25 - 2*k11*k21*k13_pw3*k22*k31_pw4*k24_pw2 + k11_pw3*k12*k22*k31_pw3*k32*k25_pw3 - 2*k11_pw2*k13*k22_pw3*k31_pw4*k24*k16 - 6*k11_pw3*k13*k22*k31_pw4*k24*k25_pw2 - k11_pw2*k22_pw4*k31_pw3*k32*k15*k16 + 4*k11_pw3*k21*k31_pw3*k14*k25_pw3*k34 - 6*k11_pw3*k13*k31_pw4*k23*k24_pw2*k25 - 6*k11_pw3*k13*k22*k31_pw4*k24_pw2*k26 + 4*k11_pw3*k22*k31_pw4*k23*k24_pw2*k16 - k21_pw3*k13*k22*k14_pw2*k32_pw4*k16 + 4*k11*k21_pw3*k31*k14_pw3*k24*k35_pw3 + k12*k21_pw3*k22*k14_pw3*k32*k35_pw3 - 12*k11_pw3*k21*k31_pw4*k24_pw2*k16*k25 - 2*k11*k21_pw3*k14_pw2*k32_pw4*k16*k25 - 2*k11_pw2*k22_pw4*k31_pw3*k14*k16*k35 + 4*k11_pw3*k22_pw2*k31_pw4*k24*k16*k25 - 2*k21_pw4*k31*k14*k32*k15_pw3*k34_pw2 - 2*k21_pw4*k14_pw2*k32_pw3*k15*k16*k34 + 4*k21_pw4*k14_pw3*k32*k33*k16*k34_pw2 - 6*k21_pw4*k14_pw3*k32*k15*k34*k35_pw2- 12*k21_pw4*k31*k14_pw3*k16*k34_pw2*k35 + 4*k21_pw4*k14_pw3*k32_pw2*k16*k34*k35 - 6*k21_pw4*k14_pw3*k32*k15*k34_pw2*k36 - 6*k21_pw4*k14_pw3*k15*k33*k34_pw2*k35 + 2*k11_pw2*k13_pw2*k22*k31_pw4*k23*k24_pw2 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k32*k24_pw2 - 2*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw3*k34 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k24_pw2*k25 - 2*k11_pw3*k21*k31_pw2*k14*k32_pw2*k25_pw3 - 2*k11*k21_pw2*k22_pw2*k31*k14_pw3*k35_pw3 + 2*k11_pw2*k13_pw2*k22_pw2*k31_pw4*k24*k25 - 2*k12*k21_pw3*k22*k31_pw2*k15_pw3*k34_pw2 + 4*k11_pw2*k22_pw3*k31_pw3*k23*k15_pw2*k34 - k11_pw3*k22_pw2*k31_pw3*k32*k15*k25_pw2 - k11_pw3*k31_pw3*k23_pw2*k32*k15*k24_pw2 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k24*k35_pw3 + 4*k21_pw3*k13_pw2*k14_pw2*k32_pw3*k24*k33 - k21_pw3*k13*k22*k14_pw3*k32_pw2*k35_pw2- k21_pw3*k13*k22*k14_pw3*k33_pw2*k34_pw2 + 2*k11_pw2*k21_pw2*k14_pw2*k32_pw4*k25*k26 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k25_pw2*k35 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k24_pw2*k35 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k25*k35_pw2- 2*k11*k21_pw3*k14_pw3*k33_pw2*k25*k34_pw2 + 2*k12_pw4*k21_pw2*k31_pw2*k24*k25*k35_pw2+ 2*k11_pw2*k22_pw4*k31_pw2*k14_pw2*k35*k36 + 2*k12_pw4*k21_pw2*k31_pw2*k25_pw2*k34*k35 + 2*k12_pw4*k21_pw2*k31_pw2*k25*k34_pw2*k26 + 2*k21_pw4*k14_pw2*k32*k15_pw2*k33*k34_pw2 + 2*k12_pw4*k21_pw2*k31_pw2*k24_pw2*k35*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k34_pw2*k35 + 2*k21_pw4*k14_pw2*k32_pw2*k15_pw2*k34*k35 + k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k25_pw3 + 4*k11_pw2*k21_pw2*k14_pw2*k32*k24_pw2*k33_pw3 + 4*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k34_pw2 + k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k35_pw3 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25_pw2*k35 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24_pw2*k35 + 4*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k33*k25_pw2 + 4*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k35_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24_pw2*k35 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24_pw2*k35 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k34_pw2 + 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k34_pw2 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k34_pw2 + 2*k11_pw2*k21*k13*k22*k31_pw4*k24_pw2*k16 - 2*k11*k21*k13*k22_pw3*k31_pw3*k15_pw2*k34 - k11*k21_pw2*k13*k14_pw2*k23*k32_pw4*k25 - k11*k21_pw2*k13*k22*k14_pw2*k32_pw4*k26 + 2*k11*k21_pw2*k22*k14_pw2*k23*k32_pw4*k16 + k11_pw2*k12*k22_pw3*k31_pw3*k32*k16*k25 + k11_pw2*k12*k22_pw3*k31_pw3*k24*k33*k16 + k11_pw2*k13*k22_pw3*k31_pw3*k32*k15*k25 + k11_pw2*k13*k22_pw3*k31_pw3*k15*k24*k33 + 3*k11_pw3*k12*k31_pw3*k23*k32*k24*k25_pw2 + 3*k11_pw3*k12*k22*k31_pw3*k24*k33*k25_pw2 + 2*k11_pw2*k22_pw4*k31_pw2*k14*k32*k33*k16 + 3*k11_pw3*k12*k31_pw3*k23*k24_pw2*k33*k25 + 3*k11_pw3*k12*k31_pw3*k23*k32*k24_pw2*k26 + 3*k11_pw3*k12*k22*k31_pw3*k24_pw2*k33*k26 + 6*k11_pw3*k21*k31_pw3*k32*k15*k24*k25_pw2 - 2*k11_pw3*k22*k31_pw3*k23*k15*k24_pw2*k33 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k24*k34 - 2*k21_pw3*k13_pw2*k31*k14*k32_pw3*k15*k24 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k24*k34 - 8*k11_pw2*k22_pw3*k31_pw3*k14*k23*k16*k34 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k24*k36 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k25*k35 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k34*k26 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k24*k36 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k25*k35 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k34*k26 + 6*k11_pw3*k21*k31_pw3*k32*k15*k24_pw2*k26 + 6*k11_pw3*k21*k31_pw3*k15*k24_pw2*k33*k25 - 4*k11_pw3*k22*k31_pw3*k14*k23*k25_pw2*k34 - 8*k11*k21_pw3*k14_pw2*k32_pw3*k24*k33*k16 - k11_pw2*k22_pw4*k31_pw2*k14*k32*k15*k36 - k11_pw2*k22_pw4*k31_pw2*k14*k15*k33*k35 - 2*k11_pw3*k22_pw2*k31_pw3*k32*k15*k24*k26 - 2*k11_pw3*k22_pw2*k31_pw3*k15*k24*k33*k25 + 12*k11_pw3*k21*k31_pw3*k14*k24*k25_pw2*k35 - 4*k11_pw3*k22*k31_pw3*k14*k23*k24_pw2*k36 + k21_pw3*k13*k14_pw2*k23*k32_pw3*k15*k34 - 2*k21_pw3*k13*k14_pw3*k23*k32*k33*k34_pw2 + k21_pw3*k13*k22*k14_pw2*k32_pw3*k15*k35 + 6*k21_pw3*k13*k22*k31*k14_pw3*k34*k35_pw2- 4*k11*k21_pw3*k14_pw3*k32*k24*k33*k35_pw2+ k12*k21_pw3*k14_pw2*k23*k32_pw3*k16*k34 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k24*k36 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k25*k35 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k34*k26 + k12*k21_pw3*k22*k14_pw2*k32_pw3*k16*k35 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k25*k34 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k25*k36 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k26*k35 + 6*k21_pw3*k13*k22*k31*k14_pw3*k34_pw2*k36 + 6*k21_pw3*k13*k31*k14_pw3*k23*k34_pw2*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k24*k36 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k25*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k34*k26 - 4*k11*k21_pw3*k14_pw3*k32*k33*k34_pw2*k26 + 12*k11*k21_pw3*k31*k14_pw3*k25*k34*k35_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k32*k34*k35_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k33*k34*k35_pw2- 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k25*k36 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k26*k35 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k25*k34*k26 - 2*k21_pw3*k13*k14_pw3*k23*k32_pw2*k34*k35 - 2*k21_pw3*k13*k22*k14_pw3*k32_pw2*k34*k36 + 2*k21_pw4*k31*k14_pw2*k32*k15*k16*k34_pw2 - 4*k11*k21_pw3*k14_pw3*k24*k33_pw2*k34*k35 + 12*k11*k21_pw3*k31*k14_pw3*k34_pw2*k26*k35 + 12*k11*k21_pw3*k31*k14_pw3*k25*k34_pw2*k36 + 3*k12*k21_pw3*k14_pw3*k23*k32*k34_pw2*k36 + 3*k12*k21_pw3*k14_pw3*k23*k33*k34_pw2*k35 + 3*k12*k21_pw3*k22*k14_pw3*k33*k34_pw2*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k24*k35*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k25*k34*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k34*k26*k35 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k25*k34*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k34*k26*k35 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k25_pw2 - k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k24_pw2 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k24_pw2 - 2*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k35_pw2- k11_pw2*k13*k22_pw3*k31_pw2*k14*k24*k33_pw2 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k32_pw2*k24 - k11*k21_pw2*k22_pw2*k31_pw2*k32*k15_pw3*k34 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25_pw2*k34 - 2*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k25_pw2 + 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32_pw2*k16 - k11_pw2*k13*k22_pw3*k31_pw2*k14*k32_pw2*k26 + 2*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k25_pw2 + 2*k11_pw3*k22*k31_pw2*k14*k23*k24_pw2*k33_pw2 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24_pw2*k35 + 4*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw3*k33*k16 + 2*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k35_pw2+ 2*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k34_pw2 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25_pw2*k35 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k32*k15*k24_pw2*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k24*k35 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k25*k34 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k32*k33*k25_pw2 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k32*k24_pw2*k33 - 6*k11_pw3*k21*k31_pw2*k14*k24_pw2*k33_pw2*k25 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25_pw2*k34 + 2*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k34_pw2 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k24_pw2*k16*k35 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k35_pw2- k11*k21_pw2*k14_pw2*k23_pw2*k32_pw3*k15*k34 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k34_pw2 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k25*k34 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k25*k36 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k26*k35 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k24*k33_pw2*k25 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k24*k25 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k25*k34 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k24_pw2*k33*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24_pw2*k36 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k35_pw2- 6*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k34_pw2 - k11*k21_pw2*k22_pw2*k14_pw2*k32_pw3*k15*k36 - 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34_pw2*k35 + 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k34_pw2 - k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k35_pw2- k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k34_pw2 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k25*k36 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k26*k35 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25*k34*k26 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k25*k34 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k24_pw2*k16*k35 + 8*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k24*k33*k26 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k25*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k34_pw2 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k34_pw2*k26 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k24*k35 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k25*k34 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k34*k35 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k34*k35 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k34_pw2 + 8*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k34*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k34_pw2 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k35_pw2+ 2*k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k35*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k34*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k34_pw2*k26 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34*k35_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k34*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k34*k35 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k34_pw2*k26*k35 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34_pw2*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k34*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k34*k26*k35 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k24_pw2*k33_pw2*k25 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k24_pw2*k33 + 2*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k24_pw2*k33 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k24*k25 + 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k34_pw2 + 2*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k34_pw2 + 2*k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k24*k25 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k35_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k34_pw2 + 12*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k24*k33_pw2*k25 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25_pw2*k35 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k24_pw2*k33_pw2*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k35_pw2+ 12*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k34*k35 + 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k34*k35 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34_pw2*k35 + 2*k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k34*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k34*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k34_pw2*k26 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k35*k36 - k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k25_pw2 - k11*k12_pw2*k21*k13*k22*k31_pw2*k24_pw2*k33_pw2 - k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k25_pw2 - k11_pw2*k12*k21*k22*k31_pw2*k15*k24_pw2*k33_pw2 + k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k25_pw2 + k11_pw2*k21*k13*k22*k31_pw2*k14*k24_pw2*k33_pw2 - k11*k21_pw2*k13*k22*k31_pw2*k32_pw2*k15_pw2*k24 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k25 - 6*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k34_pw2 - 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32_pw2*k24 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k32_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k24_pw2*k33 - 6*k11*k21_pw2*k13*k22*k14_pw2*k32_pw2*k24*k33_pw2 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k32_pw2*k15*k24 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24*k33*k25_pw2 - 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32_pw2*k25 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k32_pw2*k24*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k24_pw2*k33*k16 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k24*k25 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k35_pw2- 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k34_pw2 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k32*k15_pw2*k34 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k35_pw2- k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k34_pw2 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24_pw2*k33*k26 - 6*k11_pw2*k21_pw2*k31*k14*k32*k15*k24_pw2*k33_pw2 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32_pw2*k16*k25 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k35_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k24*k16*k25 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25_pw2*k34 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k35_pw2+ 2*k11*k21_pw2*k22_pw2*k31*k14*k32_pw2*k15_pw2*k35 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k34_pw2 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k34_pw2*k26 + 12*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k34_pw2 + k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k34_pw2 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24*k25*k26 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32*k24_pw2*k33*k16 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32*k15*k34 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k34_pw2*k26 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k34_pw2 + 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k34_pw2*k26 - 4*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k34_pw2 - k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k34_pw2 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32*k15*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k35_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24_pw2*k36 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24_pw2*k33*k35 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32*k15*k33_pw2*k34 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32_pw2*k16*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k24*k16*k25 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25_pw2*k34 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25_pw2*k34 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k32*k15*k16*k34 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k32_pw2*k16*k35 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34*k35_pw2- 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k34*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k34_pw2*k26 - 4*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k34*k35 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw2*k15*k33*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24_pw2*k33*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24_pw2*k33*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k25*k34 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k34*k35 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34_pw2*k36 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k35*k36 + 12*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k34*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k25*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k26*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25*k34*k26 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k35*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k34*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k34*k26*k35 - 4*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k34*k35 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k34*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k34*k26*k35 + 6*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34*k35*k36 + 4*k11*k21*k13*k22_pw3*k31_pw3*k14*k16*k34 + 4*k11*k21_pw3*k31*k14*k32_pw3*k15*k24*k16 + 6*k11_pw3*k12*k22*k31_pw3*k32*k24*k25*k26 - 4*k11_pw3*k22*k31_pw3*k23*k32*k15*k24*k25 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k25*k35 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k34*k26 + 24*k11_pw3*k21*k31_pw3*k14*k24*k25*k34*k26 - 4*k21_pw3*k13*k22*k14_pw3*k32*k33*k34*k35 - 8*k11*k21_pw3*k14_pw3*k32*k24*k33*k34*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k25*k34*k35 + 24*k11*k21_pw3*k31*k14_pw3*k24*k34*k35*k36 + 6*k12*k21_pw3*k22*k14_pw3*k32*k34*k35*k36 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k24_pw2 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k24_pw2*k33 + k11_pw2*k12*k21*k22*k31*k14*k24_pw2*k33_pw3 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k24*k25_pw2 + k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k25_pw2 - 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k24_pw2*k33 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k25_pw2*k34 + 4*k11*k12*k21_pw2*k13*k31_pw3*k32*k24_pw2*k16 - k11*k12*k21*k22_pw3*k31_pw2*k32_pw2*k15*k16 + k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k34_pw2 - 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k32*k15*k24 - 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k32_pw2*k16 - k11_pw2*k12*k21*k31_pw3*k23*k32*k24_pw2*k16 - 6*k11_pw2*k12*k21*k13*k31_pw3*k24_pw2*k33*k25 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k24_pw2*k26 - k11_pw2*k12*k21*k22*k31_pw3*k24_pw2*k33*k16 - k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k24_pw2 - k11_pw2*k21*k13*k22*k31_pw3*k15*k24_pw2*k33 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k24_pw2*k35 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k24_pw2*k36 + k11*k12*k21*k22_pw3*k31_pw2*k15_pw2*k33*k34 + k11*k12*k21*k22_pw3*k31_pw2*k32*k15_pw2*k35 + k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k35_pw2+ k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw3*k25 + k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw3*k24 - k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw3*k16 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k32*k24*k16 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k25_pw2*k34 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k24*k26 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k24*k33*k25 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k25_pw2*k34 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k32*k15*k24 - 2*k11*k21_pw2*k22_pw2*k31*k14*k32_pw3*k15*k16 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32_pw3*k24*k33 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k24*k34 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32_pw3*k33*k25 + k11*k12_pw3*k21*k31_pw2*k23*k32*k25_pw2*k34 + k11*k12_pw3*k21*k22*k31_pw2*k32*k25_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k33*k25_pw2*k34 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k24_pw2*k35 + k11*k12*k21_pw2*k22*k14_pw2*k24*k33_pw3*k34 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k24*k35 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k25*k34 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k24*k34 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k24_pw2*k35 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k24_pw2*k36 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k24*k34 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k32*k15*k24*k16 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k24_pw2*k35 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k24_pw2*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k24*k34 - 2*k11_pw2*k13*k22_pw3*k31_pw2*k14*k32*k33*k25 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k24*k34 + k11*k12_pw3*k21*k31_pw2*k23*k24_pw2*k33*k35 + k11*k12_pw3*k21*k31_pw2*k23*k32*k24_pw2*k36 + k11*k12_pw3*k21*k22*k31_pw2*k24_pw2*k33*k36 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k24*k34 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k24*k35 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k25*k34 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k24*k35 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k25*k34 - 12*k11_pw3*k21*k31_pw2*k14*k32*k24*k33*k25_pw2 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k24*k16*k34 - 2*k21_pw3*k13*k22*k31*k14*k32_pw2*k15_pw2*k34 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k25*k34 - 2*k11*k21_pw2*k22*k14_pw2*k23*k32_pw3*k15*k35 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k34*k35_pw2+ k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k24*k36 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k25*k35 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k34*k26 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k25*k36 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k26*k35 - 4*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k34*k36 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k24*k34 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k35_pw2+ 3*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k34_pw2 + 3*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k34_pw2 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k25*k35 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k34*k26 - 4*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k24*k26 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32*k15*k35 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k15*k33*k34 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k25*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k26*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k24*k33*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k25*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k34*k26 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k24*k16*k35 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k25*k34 - 12*k11_pw3*k21*k31_pw2*k14*k32*k24_pw2*k33*k26 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k24*k26 + k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k35_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k35_pw2+ 4*k21_pw3*k13*k22*k31*k14_pw2*k32_pw2*k16*k34 - k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k34_pw2 - k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k34_pw2 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k25*k34 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k34_pw2*k36 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k35_pw2- 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k24*k35 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k25*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k34_pw2 - 6*k12*k21_pw3*k13*k14_pw2*k32*k24*k33_pw2*k34 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k34_pw2*k26 + 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k34_pw2 + 4*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k34_pw2 - k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k34_pw2 - k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k34_pw2 - 12*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25*k34*k26 + 4*k11_pw3*k22_pw2*k31_pw2*k14*k32*k24*k33*k26 - 12*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k35_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k24*k16*k34 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k25*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k34*k26 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k25*k34 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k24*k16*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k25*k34 + k12_pw3*k21_pw2*k22*k31_pw2*k24*k33*k16*k34 + k12_pw3*k21_pw2*k22*k31*k14*k33*k34_pw2*k26 + k12_pw3*k21_pw2*k31*k14*k23*k32*k34_pw2*k26 + k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k34_pw2 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k24*k34 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k24*k33*k34 + 3*k21_pw3*k13*k22*k14_pw2*k32_pw2*k15*k33*k34 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k34*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k24*k33_pw2*k34 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k24*k16*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k25*k34 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k34_pw2*k26 - 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k34_pw2 - 2*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k34_pw2 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k24*k33*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k25*k34 + 3*k12*k21_pw3*k22*k14_pw2*k32_pw2*k33*k16*k34 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k34*k35_pw2- 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k25*k34 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k24*k16*k34 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k34_pw2*k26 - 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k34_pw2 + 4*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k34*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k34*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k24*k33*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k25*k34 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k34_pw2*k36 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k34_pw2*k35 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k34*k35 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k34*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k34*k35 - 12*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k34*k35 - 2*k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k34*k35 - 2*k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k34*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k34*k35 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k34*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k34*k35 - 12*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34*k35*k36 - k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw3*k24 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k24*k25 + 3*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw3*k16 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k32*k24*k16 - k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw3*k26 + 3*k11*k12*k21*k22_pw3*k31*k14*k32_pw2*k33*k16 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k24*k25 + 2*k11*k21_pw2*k13*k22*k31*k14*k32_pw3*k15*k25 + 2*k11*k21_pw2*k13*k31*k14*k23*k32_pw3*k15*k24 - 2*k11*k12*k21_pw2*k22*k31*k14*k32_pw3*k16*k25 - 2*k11*k12*k21_pw2*k31*k14*k23*k32_pw3*k24*k16 - k11*k12*k21*k22_pw3*k31*k14*k15*k33_pw2*k34 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k24*k35 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k25*k34 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k24*k34 - 2*k11_pw2*k12*k21*k22*k31_pw3*k32*k24*k16*k25 + 2*k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k25*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k24*k26 - 2*k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k24*k25 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k25*k34 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k25*k35 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k34*k26 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k32*k16*k35 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k33*k16*k34 - k11*k12*k21*k22_pw3*k31*k14*k32_pw2*k15*k36 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k32*k15*k35 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k15*k33*k34 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k24*k16*k34 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k25*k34 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k24*k16*k34 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k25*k34 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k25*k35 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k34*k26 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k25*k34 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k25*k35 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k34*k26 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k24*k16*k34 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k25*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k34*k26 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k25*k34 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k25*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k26*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k25*k34*k26 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k25*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k34*k26 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k35*k36 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k34*k36 + 8*k11_pw3*k22*k31_pw2*k14*k23*k32*k24*k33*k25 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k24*k33*k34 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k24*k16*k34 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k24*k35 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k25*k34 - 4*k12*k21_pw3*k22*k31*k14*k32_pw2*k15*k16*k34 + 8*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k34*k35 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k24*k16*k34 + 16*k11*k21_pw3*k31*k14_pw2*k32*k24*k33*k16*k34 + 6*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k34*k35 - 2*k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k34*k35 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k34*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k34*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k34*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k34*k35 - 2*k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k34*k26*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k34*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k34*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k34*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k34*k35 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k34*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k34*k35 - 4*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k34*k35 - 4*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k34*k35 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k34*k35 - 4*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k34*k35 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k24_pw2*k33 + k11*k12*k21*k13*k22_pw2*k31_pw2*k32_pw2*k15*k25 + 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32_pw2*k24 + 3*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k33*k25_pw2 + 3*k11_pw2*k12*k21*k31*k14*k23*k32*k24_pw2*k33_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k24*k25 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k24*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k32_pw2*k24*k16 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k32*k15_pw2*k34 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k35_pw2+ 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k34_pw2 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32*k24*k33 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k24_pw2*k33 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k24_pw2*k33 + 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k24*k33*k16 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k32_pw2*k24*k16 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25_pw2*k34 + 2*k11*k12*k21_pw2*k22*k31_pw2*k32_pw2*k15*k24*k16 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw2*k24*k33 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25_pw2*k34 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k24*k25 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k24*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25_pw2*k35 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25_pw2*k34 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k24*k25 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k24*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32_pw2*k24*k16 - 6*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32*k24*k33 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k25*k34 + k11*k12_pw2*k21*k22_pw2*k31*k14*k24*k33_pw2*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k24*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k24*k35 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k25*k34 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k24*k33_pw2*k34 + 4*k11*k21_pw2*k22*k31*k14*k23*k32_pw2*k15_pw2*k34 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k24*k34 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k24_pw2*k33*k35 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24_pw2*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k24*k33*k34 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k35_pw2- k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k24*k35 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k25*k34 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k35_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k35_pw2- 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k34_pw2 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k24_pw2*k33*k35 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24_pw2*k36 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k24_pw2*k33*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k24*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k25*k34 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k24*k33*k34 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k24*k33*k16 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k24*k33_pw2*k34 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k24*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k25*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k34*k26 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k24*k33*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k25*k34 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k25*k36 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k26*k35 + 4*k11*k21_pw2*k22_pw2*k31*k14*k32*k15_pw2*k33*k34 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k24*k36 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k25*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k34*k26 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k24*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k25*k34 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k32_pw2*k16*k34 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k34_pw2 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k34_pw2 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k24*k33_pw2*k34 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k34_pw2*k26 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k25*k34 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k24*k33_pw2*k35 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k34_pw2*k26 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k34_pw2*k26 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k34_pw2 - 12*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k34*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k24*k34 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k24*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k25*k34 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k24*k33*k34 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k32*k16*k34 + k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw2*k15*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k24*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k25*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k34*k26 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k24*k33*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k25*k34 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k24*k34 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k24*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k24*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k25*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k24*k33*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k24*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k25*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k34*k26 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k24*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k25*k34 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32_pw2*k16*k34 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k34_pw2 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32*k15*k16*k34 - 8*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k33*k16*k34 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32_pw2*k15*k33*k34 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k24*k33*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k25*k34 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k24*k33*k36 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k25*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k34*k26 - 12*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k24*k33*k25 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k24*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k25*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k34*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k24*k33*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k25*k34 + 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k33*k16*k34 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k25*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k34*k26 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k25*k34 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k34*k35 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k34*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k34*k35 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k34*k36 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k34*k35 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k34*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k34*k35 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k34*k35 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k34*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k34*k35 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k34*k36 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k34*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k25*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k34*k26 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k25*k34 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k25*k35 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k34*k26 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k34*k36 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k34*k35 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k34*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k34*k26*k35 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32*k24*k33_pw2 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k32_pw2*k15*k24 + 2*k11*k12*k21*k13*k22_pw2*k31_pw2*k32*k15*k24*k33 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw2*k33*k25 - 4*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k24*k33*k25 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw2*k15*k34 + 6*k11_pw2*k12*k21*k22*k31*k14*k32*k24*k33_pw2*k25 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k24*k33_pw2*k34 + 6*k11*k21_pw2*k13*k22*k31*k14*k32_pw2*k15*k24*k33 - 6*k11*k12*k21_pw2*k22*k31*k14*k32_pw2*k24*k33*k16 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k32*k16*k34 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw2*k15*k35 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32*k15*k34 - 4*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k24*k33*k25 + 6*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k24*k33*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k24*k33*k25 + 4*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k24*k33*k25 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k24*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k25*k34 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k24*k33*k34 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k24*k36 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k25*k35 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k34*k26 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k24*k33*k34 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k34*k35 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw2*k15*k34 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k24*k33*k36 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k25*k35 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k34*k26 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k24*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k24*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k25*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k24*k33*k34 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k24*k33*k35 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k25*k34 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k24*k33*k34 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k24*k16*k34 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k25*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k34*k26 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k25*k34 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k24*k16*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k25*k34 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k24*k33*k16*k34 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k34*k36 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k34*k35 + 2*k12*k21_pw2*k13*k22_pw2*k31*k14*k32*k15*k33*k34 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k25*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k34*k26 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k25*k34 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k25*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k26*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25*k34*k26 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k25*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k34*k26 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k24*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k25*k34 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k24*k33*k34 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k24*k33*k35 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k25*k34 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k24*k33*k34 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k34*k35 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k34*k35 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k34*k35 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k34*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k34*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k34*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k34*k26*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k34*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k34*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k34*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k34*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k34*k35 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k34*k35 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw3*k25 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k24*k34 - 2*k11*k12*k21*k22_pw3*k31*k14*k32*k15*k33*k35 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k24*k33*k34 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw2*k24*k33 - 6*k11*k12*k21*k22_pw2*k31*k14*k23*k32*k15*k33*k34 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k24*k33*k35 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k25*k34);
+    coeffs[5] = (4*k11_pw4*k31_pw4*k24*k25_pw3 + 4*k21_pw4*k14_pw4*k34*k35_pw3 + 12*k11_pw4*k31_pw4*k24_pw2*k25*k26 + 12*k21_pw4*k14_pw4*k34_pw2*k35*k36 + k11_pw2*k22_pw4*k31_pw3*k15_pw2*k35 + k21_pw3*k13_pw2*k14_pw2*k32_pw4*k25 - 2*k11*k21*k13_pw3*k22*k31_pw4*k24_pw2 + k11_pw3*k12*k22*k31_pw3*k32*k25_pw3 - 2*k11_pw2*k13*k22_pw3*k31_pw4*k24*k16 - 6*k11_pw3*k13*k22*k31_pw4*k24*k25_pw2 - k11_pw2*k22_pw4*k31_pw3*k32*k15*k16 + 4*k11_pw3*k21*k31_pw3*k14*k25_pw3*k34 - 6*k11_pw3*k13*k31_pw4*k23*k24_pw2*k25 - 6*k11_pw3*k13*k22*k31_pw4*k24_pw2*k26 + 4*k11_pw3*k22*k31_pw4*k23*k24_pw2*k16 - k21_pw3*k13*k22*k14_pw2*k32_pw4*k16 + 4*k11*k21_pw3*k31*k14_pw3*k24*k35_pw3 + k12*k21_pw3*k22*k14_pw3*k32*k35_pw3 - 12*k11_pw3*k21*k31_pw4*k24_pw2*k16*k25 - 2*k11*k21_pw3*k14_pw2*k32_pw4*k16*k25 - 2*k11_pw2*k22_pw4*k31_pw3*k14*k16*k35 + 4*k11_pw3*k22_pw2*k31_pw4*k24*k16*k25 - 2*k21_pw4*k31*k14*k32*k15_pw3*k34_pw2 - 2*k21_pw4*k14_pw2*k32_pw3*k15*k16*k34 + 4*k21_pw4*k14_pw3*k32*k33*k16*k34_pw2 - 6*k21_pw4*k14_pw3*k32*k15*k34*k35_pw2- 12*k21_pw4*k31*k14_pw3*k16*k34_pw2*k35 + 4*k21_pw4*k14_pw3*k32_pw2*k16*k34*k35 - 6*k21_pw4*k14_pw3*k32*k15*k34_pw2*k36 - 6*k21_pw4*k14_pw3*k15*k33*k34_pw2*k35 + 2*k11_pw2*k13_pw2*k22*k31_pw4*k23*k24_pw2 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k32*k24_pw2 - 2*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw3*k34 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k24_pw2*k25 - 2*k11_pw3*k21*k31_pw2*k14*k32_pw2*k25_pw3 - 2*k11*k21_pw2*k22_pw2*k31*k14_pw3*k35_pw3 + 2*k11_pw2*k13_pw2*k22_pw2*k31_pw4*k24*k25 - 2*k12*k21_pw3*k22*k31_pw2*k15_pw3*k34_pw2 + 4*k11_pw2*k22_pw3*k31_pw3*k23*k15_pw2*k34 - k11_pw3*k22_pw2*k31_pw3*k32*k15*k25_pw2 - k11_pw3*k31_pw3*k23_pw2*k32*k15*k24_pw2 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k24*k35_pw3 + 4*k21_pw3*k13_pw2*k14_pw2*k32_pw3*k24*k33 - k21_pw3*k13*k22*k14_pw3*k32_pw2*k35_pw2- k21_pw3*k13*k22*k14_pw3*k33_pw2*k34_pw2 + 2*k11_pw2*k21_pw2*k14_pw2*k32_pw4*k25*k26 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k25_pw2*k35 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k24_pw2*k35 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k25*k35_pw2- 2*k11*k21_pw3*k14_pw3*k33_pw2*k25*k34_pw2 + 2*k12_pw4*k21_pw2*k31_pw2*k24*k25*k35_pw2+ 2*k11_pw2*k22_pw4*k31_pw2*k14_pw2*k35*k36 + 2*k12_pw4*k21_pw2*k31_pw2*k25_pw2*k34*k35 + 2*k12_pw4*k21_pw2*k31_pw2*k25*k34_pw2*k26 + 2*k21_pw4*k14_pw2*k32*k15_pw2*k33*k34_pw2 + 2*k12_pw4*k21_pw2*k31_pw2*k24_pw2*k35*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k34_pw2*k35 + 2*k21_pw4*k14_pw2*k32_pw2*k15_pw2*k34*k35 + k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k25_pw3 + 4*k11_pw2*k21_pw2*k14_pw2*k32*k24_pw2*k33_pw3 + 4*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k34_pw2 + k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k35_pw3 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25_pw2*k35 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24_pw2*k35 + 4*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k33*k25_pw2 + 4*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k35_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24_pw2*k35 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24_pw2*k35 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k34_pw2 + 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k34_pw2 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k34_pw2 + 2*k11_pw2*k21*k13*k22*k31_pw4*k24_pw2*k16 - 2*k11*k21*k13*k22_pw3*k31_pw3*k15_pw2*k34 - k11*k21_pw2*k13*k14_pw2*k23*k32_pw4*k25 - k11*k21_pw2*k13*k22*k14_pw2*k32_pw4*k26 + 2*k11*k21_pw2*k22*k14_pw2*k23*k32_pw4*k16 + k11_pw2*k12*k22_pw3*k31_pw3*k32*k16*k25 + k11_pw2*k12*k22_pw3*k31_pw3*k24*k33*k16 + k11_pw2*k13*k22_pw3*k31_pw3*k32*k15*k25 + k11_pw2*k13*k22_pw3*k31_pw3*k15*k24*k33 + 3*k11_pw3*k12*k31_pw3*k23*k32*k24*k25_pw2 + 3*k11_pw3*k12*k22*k31_pw3*k24*k33*k25_pw2 + 2*k11_pw2*k22_pw4*k31_pw2*k14*k32*k33*k16 + 3*k11_pw3*k12*k31_pw3*k23*k24_pw2*k33*k25 + 3*k11_pw3*k12*k31_pw3*k23*k32*k24_pw2*k26 + 3*k11_pw3*k12*k22*k31_pw3*k24_pw2*k33*k26 + 6*k11_pw3*k21*k31_pw3*k32*k15*k24*k25_pw2 - 2*k11_pw3*k22*k31_pw3*k23*k15*k24_pw2*k33 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k24*k34 - 2*k21_pw3*k13_pw2*k31*k14*k32_pw3*k15*k24 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k24*k34 - 8*k11_pw2*k22_pw3*k31_pw3*k14*k23*k16*k34 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k24*k36 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k25*k35 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k34*k26 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k24*k36 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k25*k35 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k34*k26 + 6*k11_pw3*k21*k31_pw3*k32*k15*k24_pw2*k26 + 6*k11_pw3*k21*k31_pw3*k15*k24_pw2*k33*k25 - 4*k11_pw3*k22*k31_pw3*k14*k23*k25_pw2*k34 - 8*k11*k21_pw3*k14_pw2*k32_pw3*k24*k33*k16 - k11_pw2*k22_pw4*k31_pw2*k14*k32*k15*k36 - k11_pw2*k22_pw4*k31_pw2*k14*k15*k33*k35 - 2*k11_pw3*k22_pw2*k31_pw3*k32*k15*k24*k26 - 2*k11_pw3*k22_pw2*k31_pw3*k15*k24*k33*k25 + 12*k11_pw3*k21*k31_pw3*k14*k24*k25_pw2*k35 - 4*k11_pw3*k22*k31_pw3*k14*k23*k24_pw2*k36 + k21_pw3*k13*k14_pw2*k23*k32_pw3*k15*k34 - 2*k21_pw3*k13*k14_pw3*k23*k32*k33*k34_pw2 + k21_pw3*k13*k22*k14_pw2*k32_pw3*k15*k35 + 6*k21_pw3*k13*k22*k31*k14_pw3*k34*k35_pw2- 4*k11*k21_pw3*k14_pw3*k32*k24*k33*k35_pw2+ k12*k21_pw3*k14_pw2*k23*k32_pw3*k16*k34 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k24*k36 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k25*k35 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k34*k26 + k12*k21_pw3*k22*k14_pw2*k32_pw3*k16*k35 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k25*k34 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k25*k36 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k26*k35 + 6*k21_pw3*k13*k22*k31*k14_pw3*k34_pw2*k36 + 6*k21_pw3*k13*k31*k14_pw3*k23*k34_pw2*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k24*k36 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k25*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k34*k26 - 4*k11*k21_pw3*k14_pw3*k32*k33*k34_pw2*k26 + 12*k11*k21_pw3*k31*k14_pw3*k25*k34*k35_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k32*k34*k35_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k33*k34*k35_pw2- 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k25*k36 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k26*k35 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k25*k34*k26 - 2*k21_pw3*k13*k14_pw3*k23*k32_pw2*k34*k35 - 2*k21_pw3*k13*k22*k14_pw3*k32_pw2*k34*k36 + 2*k21_pw4*k31*k14_pw2*k32*k15*k16*k34_pw2 - 4*k11*k21_pw3*k14_pw3*k24*k33_pw2*k34*k35 + 12*k11*k21_pw3*k31*k14_pw3*k34_pw2*k26*k35 + 12*k11*k21_pw3*k31*k14_pw3*k25*k34_pw2*k36 + 3*k12*k21_pw3*k14_pw3*k23*k32*k34_pw2*k36 + 3*k12*k21_pw3*k14_pw3*k23*k33*k34_pw2*k35 + 3*k12*k21_pw3*k22*k14_pw3*k33*k34_pw2*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k24*k35*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k25*k34*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k34*k26*k35 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k25*k34*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k34*k26*k35 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k25_pw2 - k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k24_pw2 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k24_pw2 - 2*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k35_pw2- k11_pw2*k13*k22_pw3*k31_pw2*k14*k24*k33_pw2 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k32_pw2*k24 - k11*k21_pw2*k22_pw2*k31_pw2*k32*k15_pw3*k34 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25_pw2*k34 - 2*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k25_pw2 + 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32_pw2*k16 - k11_pw2*k13*k22_pw3*k31_pw2*k14*k32_pw2*k26 + 2*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k25_pw2 + 2*k11_pw3*k22*k31_pw2*k14*k23*k24_pw2*k33_pw2 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24_pw2*k35 + 4*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw3*k33*k16 + 2*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k35_pw2+ 2*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k34_pw2 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25_pw2*k35 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k32*k15*k24_pw2*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k24*k35 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k25*k34 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k32*k33*k25_pw2 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k32*k24_pw2*k33 - 6*k11_pw3*k21*k31_pw2*k14*k24_pw2*k33_pw2*k25 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25_pw2*k34 + 2*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k34_pw2 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k24_pw2*k16*k35 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k35_pw2- k11*k21_pw2*k14_pw2*k23_pw2*k32_pw3*k15*k34 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k34_pw2 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k25*k34 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k25*k36 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k26*k35 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k24*k33_pw2*k25 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k24*k25 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k25*k34 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k24_pw2*k33*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24_pw2*k36 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k35_pw2- 6*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k34_pw2 - k11*k21_pw2*k22_pw2*k14_pw2*k32_pw3*k15*k36 - 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34_pw2*k35 + 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k34_pw2 - k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k35_pw2- k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k34_pw2 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k25*k36 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k26*k35 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25*k34*k26 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k25*k34 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k24_pw2*k16*k35 + 8*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k24*k33*k26 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k25*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k34_pw2 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k34_pw2*k26 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k24*k35 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k25*k34 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k34*k35 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k34*k35 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k34_pw2 + 8*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k34*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k34_pw2 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k35_pw2+ 2*k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k35*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k34*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k34_pw2*k26 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34*k35_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k34*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k34*k35 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k34_pw2*k26*k35 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34_pw2*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k34*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k34*k26*k35 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k24_pw2*k33_pw2*k25 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k24_pw2*k33 + 2*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k24_pw2*k33 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k24*k25 + 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k34_pw2 + 2*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k34_pw2 + 2*k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k24*k25 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k35_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k34_pw2 + 12*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k24*k33_pw2*k25 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25_pw2*k35 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k24_pw2*k33_pw2*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k35_pw2+ 12*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k34*k35 + 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k34*k35 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34_pw2*k35 + 2*k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k34*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k34*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k34_pw2*k26 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k35*k36 - k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k25_pw2 - k11*k12_pw2*k21*k13*k22*k31_pw2*k24_pw2*k33_pw2 - k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k25_pw2 - k11_pw2*k12*k21*k22*k31_pw2*k15*k24_pw2*k33_pw2 + k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k25_pw2 + k11_pw2*k21*k13*k22*k31_pw2*k14*k24_pw2*k33_pw2 - k11*k21_pw2*k13*k22*k31_pw2*k32_pw2*k15_pw2*k24 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k25 - 6*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k34_pw2 - 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32_pw2*k24 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k32_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k24_pw2*k33 - 6*k11*k21_pw2*k13*k22*k14_pw2*k32_pw2*k24*k33_pw2 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k32_pw2*k15*k24 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24*k33*k25_pw2 - 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32_pw2*k25 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k32_pw2*k24*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k24_pw2*k33*k16 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k24*k25 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k35_pw2- 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k34_pw2 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k32*k15_pw2*k34 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k35_pw2- k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k34_pw2 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24_pw2*k33*k26 - 6*k11_pw2*k21_pw2*k31*k14*k32*k15*k24_pw2*k33_pw2 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32_pw2*k16*k25 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k35_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k24*k16*k25 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25_pw2*k34 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k35_pw2+ 2*k11*k21_pw2*k22_pw2*k31*k14*k32_pw2*k15_pw2*k35 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k34_pw2 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k34_pw2*k26 + 12*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k34_pw2 + k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k34_pw2 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24*k25*k26 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32*k24_pw2*k33*k16 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32*k15*k34 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k34_pw2*k26 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k34_pw2 + 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k34_pw2*k26 - 4*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k34_pw2 - k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k34_pw2 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32*k15*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k35_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24_pw2*k36 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24_pw2*k33*k35 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32*k15*k33_pw2*k34 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32_pw2*k16*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k24*k16*k25 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25_pw2*k34 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25_pw2*k34 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k32*k15*k16*k34 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k32_pw2*k16*k35 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34*k35_pw2- 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k34*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k34_pw2*k26 - 4*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k34*k35 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw2*k15*k33*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24_pw2*k33*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24_pw2*k33*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k25*k34 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k34*k35 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34_pw2*k36 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k35*k36 + 12*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k34*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k25*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k26*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25*k34*k26 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k35*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k34*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k34*k26*k35 - 4*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k34*k35 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k34*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k34*k26*k35 + 6*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34*k35*k36 + 4*k11*k21*k13*k22_pw3*k31_pw3*k14*k16*k34 + 4*k11*k21_pw3*k31*k14*k32_pw3*k15*k24*k16 + 6*k11_pw3*k12*k22*k31_pw3*k32*k24*k25*k26 - 4*k11_pw3*k22*k31_pw3*k23*k32*k15*k24*k25 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k25*k35 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k34*k26 + 24*k11_pw3*k21*k31_pw3*k14*k24*k25*k34*k26 - 4*k21_pw3*k13*k22*k14_pw3*k32*k33*k34*k35 - 8*k11*k21_pw3*k14_pw3*k32*k24*k33*k34*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k25*k34*k35 + 24*k11*k21_pw3*k31*k14_pw3*k24*k34*k35*k36 + 6*k12*k21_pw3*k22*k14_pw3*k32*k34*k35*k36 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k24_pw2 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k24_pw2*k33 + k11_pw2*k12*k21*k22*k31*k14*k24_pw2*k33_pw3 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k24*k25_pw2 + k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k25_pw2 - 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k24_pw2*k33 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k25_pw2*k34 + 4*k11*k12*k21_pw2*k13*k31_pw3*k32*k24_pw2*k16 - k11*k12*k21*k22_pw3*k31_pw2*k32_pw2*k15*k16 + k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k34_pw2 - 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k32*k15*k24 - 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k32_pw2*k16 - k11_pw2*k12*k21*k31_pw3*k23*k32*k24_pw2*k16 - 6*k11_pw2*k12*k21*k13*k31_pw3*k24_pw2*k33*k25 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k24_pw2*k26 - k11_pw2*k12*k21*k22*k31_pw3*k24_pw2*k33*k16 - k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k24_pw2 - k11_pw2*k21*k13*k22*k31_pw3*k15*k24_pw2*k33 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k24_pw2*k35 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k24_pw2*k36 + k11*k12*k21*k22_pw3*k31_pw2*k15_pw2*k33*k34 + k11*k12*k21*k22_pw3*k31_pw2*k32*k15_pw2*k35 + k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k35_pw2+ k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw3*k25 + k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw3*k24 - k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw3*k16 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k32*k24*k16 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k25_pw2*k34 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k24*k26 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k24*k33*k25 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k25_pw2*k34 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k32*k15*k24 - 2*k11*k21_pw2*k22_pw2*k31*k14*k32_pw3*k15*k16 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32_pw3*k24*k33 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k24*k34 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32_pw3*k33*k25 + k11*k12_pw3*k21*k31_pw2*k23*k32*k25_pw2*k34 + k11*k12_pw3*k21*k22*k31_pw2*k32*k25_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k33*k25_pw2*k34 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k24_pw2*k35 + k11*k12*k21_pw2*k22*k14_pw2*k24*k33_pw3*k34 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k24*k35 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k25*k34 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k24*k34 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k24_pw2*k35 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k24_pw2*k36 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k24*k34 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k32*k15*k24*k16 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k24_pw2*k35 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k24_pw2*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k24*k34 - 2*k11_pw2*k13*k22_pw3*k31_pw2*k14*k32*k33*k25 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k24*k34 + k11*k12_pw3*k21*k31_pw2*k23*k24_pw2*k33*k35 + k11*k12_pw3*k21*k31_pw2*k23*k32*k24_pw2*k36 + k11*k12_pw3*k21*k22*k31_pw2*k24_pw2*k33*k36 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k24*k34 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k24*k35 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k25*k34 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k24*k35 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k25*k34 - 12*k11_pw3*k21*k31_pw2*k14*k32*k24*k33*k25_pw2 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k24*k16*k34 - 2*k21_pw3*k13*k22*k31*k14*k32_pw2*k15_pw2*k34 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k25*k34 - 2*k11*k21_pw2*k22*k14_pw2*k23*k32_pw3*k15*k35 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k34*k35_pw2+ k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k24*k36 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k25*k35 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k34*k26 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k25*k36 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k26*k35 - 4*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k34*k36 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k24*k34 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k35_pw2+ 3*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k34_pw2 + 3*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k34_pw2 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k25*k35 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k34*k26 - 4*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k24*k26 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32*k15*k35 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k15*k33*k34 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k25*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k26*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k24*k33*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k25*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k34*k26 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k24*k16*k35 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k25*k34 - 12*k11_pw3*k21*k31_pw2*k14*k32*k24_pw2*k33*k26 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k24*k26 + k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k35_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k35_pw2+ 4*k21_pw3*k13*k22*k31*k14_pw2*k32_pw2*k16*k34 - k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k34_pw2 - k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k34_pw2 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k25*k34 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k34_pw2*k36 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k35_pw2- 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k24*k35 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k25*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k34_pw2 - 6*k12*k21_pw3*k13*k14_pw2*k32*k24*k33_pw2*k34 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k34_pw2*k26 + 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k34_pw2 + 4*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k34_pw2 - k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k34_pw2 - k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k34_pw2 - 12*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25*k34*k26 + 4*k11_pw3*k22_pw2*k31_pw2*k14*k32*k24*k33*k26 - 12*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k35_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k24*k16*k34 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k25*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k34*k26 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k25*k34 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k24*k16*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k25*k34 + k12_pw3*k21_pw2*k22*k31_pw2*k24*k33*k16*k34 + k12_pw3*k21_pw2*k22*k31*k14*k33*k34_pw2*k26 + k12_pw3*k21_pw2*k31*k14*k23*k32*k34_pw2*k26 + k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k34_pw2 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k24*k34 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k24*k33*k34 + 3*k21_pw3*k13*k22*k14_pw2*k32_pw2*k15*k33*k34 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k34*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k24*k33_pw2*k34 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k24*k16*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k25*k34 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k34_pw2*k26 - 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k34_pw2 - 2*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k34_pw2 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k24*k33*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k25*k34 + 3*k12*k21_pw3*k22*k14_pw2*k32_pw2*k33*k16*k34 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k34*k35_pw2- 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k25*k34 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k24*k16*k34 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k34_pw2*k26 - 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k34_pw2 + 4*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k34*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k34*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k24*k33*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k25*k34 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k34_pw2*k36 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k34_pw2*k35 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k34*k35 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k34*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k34*k35 - 12*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k34*k35 - 2*k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k34*k35 - 2*k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k34*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k34*k35 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k34*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k34*k35 - 12*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34*k35*k36 - k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw3*k24 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k24*k25 + 3*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw3*k16 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k32*k24*k16 - k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw3*k26 + 3*k11*k12*k21*k22_pw3*k31*k14*k32_pw2*k33*k16 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k24*k25 + 2*k11*k21_pw2*k13*k22*k31*k14*k32_pw3*k15*k25 + 2*k11*k21_pw2*k13*k31*k14*k23*k32_pw3*k15*k24 - 2*k11*k12*k21_pw2*k22*k31*k14*k32_pw3*k16*k25 - 2*k11*k12*k21_pw2*k31*k14*k23*k32_pw3*k24*k16 - k11*k12*k21*k22_pw3*k31*k14*k15*k33_pw2*k34 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k24*k35 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k25*k34 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k24*k34 - 2*k11_pw2*k12*k21*k22*k31_pw3*k32*k24*k16*k25 + 2*k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k25*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k24*k26 - 2*k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k24*k25 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k25*k34 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k25*k35 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k34*k26 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k32*k16*k35 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k33*k16*k34 - k11*k12*k21*k22_pw3*k31*k14*k32_pw2*k15*k36 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k32*k15*k35 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k15*k33*k34 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k24*k16*k34 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k25*k34 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k24*k16*k34 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k25*k34 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k25*k35 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k34*k26 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k25*k34 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k25*k35 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k34*k26 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k24*k16*k34 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k25*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k34*k26 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k25*k34 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k25*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k26*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k25*k34*k26 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k25*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k34*k26 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k35*k36 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k34*k36 + 8*k11_pw3*k22*k31_pw2*k14*k23*k32*k24*k33*k25 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k24*k33*k34 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k24*k16*k34 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k24*k35 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k25*k34 - 4*k12*k21_pw3*k22*k31*k14*k32_pw2*k15*k16*k34 + 8*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k34*k35 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k24*k16*k34 + 16*k11*k21_pw3*k31*k14_pw2*k32*k24*k33*k16*k34 + 6*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k34*k35 - 2*k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k34*k35 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k34*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k34*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k34*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k34*k35 - 2*k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k34*k26*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k34*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k34*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k34*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k34*k35 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k34*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k34*k35 - 4*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k34*k35 - 4*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k34*k35 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k34*k35 - 4*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k34*k35 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k24_pw2*k33 + k11*k12*k21*k13*k22_pw2*k31_pw2*k32_pw2*k15*k25 + 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32_pw2*k24 + 3*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k33*k25_pw2 + 3*k11_pw2*k12*k21*k31*k14*k23*k32*k24_pw2*k33_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k24*k25 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k24*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k32_pw2*k24*k16 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k32*k15_pw2*k34 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k35_pw2+ 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k34_pw2 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32*k24*k33 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k24_pw2*k33 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k24_pw2*k33 + 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k24*k33*k16 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k32_pw2*k24*k16 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25_pw2*k34 + 2*k11*k12*k21_pw2*k22*k31_pw2*k32_pw2*k15*k24*k16 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw2*k24*k33 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25_pw2*k34 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k24*k25 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k24*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25_pw2*k35 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25_pw2*k34 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k24*k25 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k24*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32_pw2*k24*k16 - 6*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32*k24*k33 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k25*k34 + k11*k12_pw2*k21*k22_pw2*k31*k14*k24*k33_pw2*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k24*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k24*k35 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k25*k34 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k24*k33_pw2*k34 + 4*k11*k21_pw2*k22*k31*k14*k23*k32_pw2*k15_pw2*k34 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k24*k34 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k24_pw2*k33*k35 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24_pw2*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k24*k33*k34 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k35_pw2- k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k24*k35 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k25*k34 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k35_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k35_pw2- 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k34_pw2 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k24_pw2*k33*k35 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24_pw2*k36 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k24_pw2*k33*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k24*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k25*k34 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k24*k33*k34 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k24*k33*k16 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k24*k33_pw2*k34 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k24*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k25*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k34*k26 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k24*k33*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k25*k34 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k25*k36 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k26*k35 + 4*k11*k21_pw2*k22_pw2*k31*k14*k32*k15_pw2*k33*k34 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k24*k36 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k25*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k34*k26 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k24*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k25*k34 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k32_pw2*k16*k34 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k34_pw2 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k34_pw2 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k24*k33_pw2*k34 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k34_pw2*k26 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k25*k34 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k24*k33_pw2*k35 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k34_pw2*k26 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k34_pw2*k26 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k34_pw2 - 12*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k34*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k24*k34 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k24*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k25*k34 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k24*k33*k34 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k32*k16*k34 + k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw2*k15*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k24*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k25*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k34*k26 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k24*k33*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k25*k34 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k24*k34 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k24*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k24*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k25*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k24*k33*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k24*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k25*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k34*k26 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k24*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k25*k34 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32_pw2*k16*k34 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k34_pw2 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32*k15*k16*k34 - 8*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k33*k16*k34 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32_pw2*k15*k33*k34 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k24*k33*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k25*k34 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k24*k33*k36 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k25*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k34*k26 - 12*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k24*k33*k25 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k24*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k25*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k34*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k24*k33*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k25*k34 + 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k33*k16*k34 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k25*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k34*k26 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k25*k34 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k34*k35 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k34*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k34*k35 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k34*k36 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k34*k35 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k34*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k34*k35 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k34*k35 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k34*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k34*k35 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k34*k36 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k34*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k25*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k34*k26 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k25*k34 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k25*k35 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k34*k26 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k34*k36 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k34*k35 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k34*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k34*k26*k35 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32*k24*k33_pw2 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k32_pw2*k15*k24 + 2*k11*k12*k21*k13*k22_pw2*k31_pw2*k32*k15*k24*k33 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw2*k33*k25 - 4*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k24*k33*k25 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw2*k15*k34 + 6*k11_pw2*k12*k21*k22*k31*k14*k32*k24*k33_pw2*k25 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k24*k33_pw2*k34 + 6*k11*k21_pw2*k13*k22*k31*k14*k32_pw2*k15*k24*k33 - 6*k11*k12*k21_pw2*k22*k31*k14*k32_pw2*k24*k33*k16 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k32*k16*k34 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw2*k15*k35 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32*k15*k34 - 4*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k24*k33*k25 + 6*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k24*k33*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k24*k33*k25 + 4*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k24*k33*k25 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k24*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k25*k34 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k24*k33*k34 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k24*k36 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k25*k35 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k34*k26 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k24*k33*k34 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k34*k35 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw2*k15*k34 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k24*k33*k36 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k25*k35 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k34*k26 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k24*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k24*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k25*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k24*k33*k34 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k24*k33*k35 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k25*k34 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k24*k33*k34 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k24*k16*k34 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k25*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k34*k26 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k25*k34 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k24*k16*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k25*k34 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k24*k33*k16*k34 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k34*k36 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k34*k35 + 2*k12*k21_pw2*k13*k22_pw2*k31*k14*k32*k15*k33*k34 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k25*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k34*k26 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k25*k34 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k25*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k26*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25*k34*k26 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k25*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k34*k26 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k24*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k25*k34 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k24*k33*k34 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k24*k33*k35 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k25*k34 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k24*k33*k34 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k34*k35 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k34*k35 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k34*k35 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k34*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k34*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k34*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k34*k26*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k34*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k34*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k34*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k34*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k34*k35 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k34*k35 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw3*k25 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k24*k34 - 2*k11*k12*k21*k22_pw3*k31*k14*k32*k15*k33*k35 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k24*k33*k34 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw2*k24*k33 - 6*k11*k12*k21*k22_pw2*k31*k14*k23*k32*k15*k33*k34 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k24*k33*k35 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k25*k34);
 
     // x^4
-    coeffs.at(4) = (k11_pw4*k31_pw4*k25_pw4 + k21_pw4*k14_pw4*k35_pw4 + k11_pw2*k22_pw4*k31_pw4*k16_pw2 + k21_pw2*k13_pw4*k31_pw4*k24_pw2 + 6*k11_pw4*k31_pw4*k24_pw2*k26_pw2+ k21_pw4*k31_pw2*k15_pw4*k34_pw2 + k21_pw4*k14_pw2*k32_pw4*k16_pw2 + 6*k21_pw4*k14_pw4*k34_pw2*k36_pw2+ k11_pw2*k13_pw2*k22_pw2*k31_pw4*k25_pw2 + k11_pw2*k13_pw2*k31_pw4*k23_pw2*k24_pw2 + k11_pw2*k21_pw2*k14_pw2*k24_pw2*k33_pw4 + 6*k11_pw2*k21_pw2*k31_pw4*k24_pw2*k16_pw2 + k11_pw2*k21_pw2*k14_pw2*k32_pw4*k26_pw2+ k11_pw2*k31_pw2*k14_pw2*k23_pw4*k34_pw2 + k11_pw2*k22_pw4*k31_pw2*k14_pw2*k36_pw2+ k12_pw4*k21_pw2*k31_pw2*k24_pw2*k36_pw2+ k12_pw4*k21_pw2*k31_pw2*k25_pw2*k35_pw2+ k12_pw4*k21_pw2*k31_pw2*k34_pw2*k26_pw2+ 6*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k34_pw2 + k21_pw4*k14_pw2*k32_pw2*k15_pw2*k35_pw2+ k21_pw4*k14_pw2*k15_pw2*k33_pw2*k34_pw2 - 2*k11_pw3*k13*k22*k31_pw4*k25_pw3 + 12*k11_pw4*k31_pw4*k24*k25_pw2*k26 - 2*k21_pw4*k14_pw3*k32*k15*k35_pw3 + 12*k21_pw4*k14_pw4*k34*k35_pw2*k36 + 2*k11_pw3*k22_pw2*k31_pw4*k16*k25_pw2 + 2*k11_pw3*k31_pw4*k23_pw2*k24_pw2*k16 + k11_pw2*k22_pw4*k31_pw3*k15_pw2*k36 + k21_pw3*k13_pw2*k14_pw2*k32_pw4*k26 + 2*k21_pw4*k14_pw3*k32_pw2*k16*k35_pw2+ 2*k21_pw4*k14_pw3*k33_pw2*k16*k34_pw2 - 2*k11*k21*k13_pw3*k31_pw4*k23*k24_pw2 + k11_pw3*k12*k31_pw3*k23*k32*k25_pw3 + k11_pw3*k12*k22*k31_pw3*k33*k25_pw3 + 2*k11_pw3*k21*k31_pw3*k32*k15*k25_pw3 - 2*k11_pw2*k13*k22_pw3*k31_pw4*k16*k25 - 6*k11_pw3*k13*k31_pw4*k23*k24*k25_pw2 + 2*k21_pw3*k13*k22*k31*k14_pw3*k35_pw3 - k11_pw2*k22_pw4*k31_pw3*k15*k33*k16 + 4*k11_pw3*k21*k31_pw3*k14*k25_pw3*k35 - 12*k11_pw3*k21*k31_pw4*k24*k16*k25_pw2 - 6*k11_pw3*k13*k31_pw4*k23*k24_pw2*k26 - k21_pw3*k13*k14_pw2*k23*k32_pw4*k16 + 4*k11*k21_pw3*k31*k14_pw3*k25*k35_pw3 + k12*k21_pw3*k14_pw3*k23*k32*k35_pw3 + k12*k21_pw3*k22*k14_pw3*k33*k35_pw3 - 12*k11_pw3*k21*k31_pw4*k24_pw2*k16*k26 - 2*k11*k21_pw3*k14_pw2*k32_pw4*k16*k26 - 2*k11_pw2*k22_pw4*k31_pw3*k14*k16*k36 + 4*k11_pw3*k22_pw2*k31_pw4*k24*k16*k26 - 2*k21_pw4*k31*k14*k15_pw3*k33*k34_pw2 - 2*k21_pw4*k14_pw2*k32_pw3*k15*k16*k35 - 12*k21_pw4*k31*k14_pw3*k16*k34*k35_pw2- 6*k21_pw4*k14_pw3*k15*k33*k34*k35_pw2- 12*k21_pw4*k31*k14_pw3*k16*k34_pw2*k36 + 4*k21_pw4*k14_pw3*k32_pw2*k16*k34*k36 - 6*k21_pw4*k14_pw3*k15*k33*k34_pw2*k36 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k25_pw2 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k24_pw2*k33_pw2 + k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k25_pw2 + k11_pw2*k21_pw2*k31_pw2*k15_pw2*k24_pw2*k33_pw2 + 6*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k33_pw2*k25_pw2 + 6*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k35_pw2+ k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k35_pw2+ k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k34_pw2 + k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k35_pw2+ k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k34_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k36_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k35_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k34_pw2*k26_pw2+ 6*k11_pw2*k21*k13_pw2*k31_pw4*k24*k25_pw2 - 4*k11_pw2*k21*k22_pw2*k31_pw4*k24*k16_pw2 - 4*k11*k21_pw2*k13_pw2*k31_pw4*k24_pw2*k16 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k24_pw2*k33 - 2*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw3*k35 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k24_pw2*k26 + k11*k21_pw2*k14_pw2*k23_pw2*k32_pw4*k16 + 2*k11_pw2*k13_pw2*k22_pw2*k31_pw4*k24*k26 + k11_pw2*k22_pw4*k31_pw2*k14*k33_pw2*k16 - 2*k12*k21_pw3*k31_pw2*k23*k15_pw3*k34_pw2 + 4*k11_pw2*k22_pw3*k31_pw3*k23*k15_pw2*k35 - k11_pw3*k22_pw2*k31_pw3*k15*k33*k25_pw2 - k11_pw3*k31_pw3*k23_pw2*k15*k24_pw2*k33 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k34*k26_pw2- 2*k11_pw3*k31_pw3*k14*k23_pw2*k25_pw2*k34 - 2*k12_pw2*k21_pw3*k31_pw3*k24*k16_pw2*k34 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k25*k35_pw3 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k24*k34 + 4*k21_pw3*k13_pw2*k14_pw2*k32_pw3*k33*k25 - k21_pw3*k13*k14_pw3*k23*k32_pw2*k35_pw2- k21_pw3*k13*k14_pw3*k23*k33_pw2*k34_pw2 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k24*k36_pw2- 2*k11*k21_pw3*k14_pw3*k24*k33_pw2*k35_pw2- 2*k11_pw3*k22_pw2*k31_pw3*k14*k25_pw2*k36 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k24_pw2*k36 - 4*k21_pw4*k31*k14_pw2*k32_pw2*k16_pw2*k34 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k26*k35_pw2- 2*k11*k21_pw3*k14_pw3*k33_pw2*k34_pw2*k26 + 2*k12_pw4*k21_pw2*k31_pw2*k24*k26*k35_pw2- 4*k21_pw4*k31_pw2*k14*k15_pw2*k16*k34_pw2 + 2*k12_pw4*k21_pw2*k31_pw2*k25_pw2*k34*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k34*k35_pw2+ 6*k21_pw4*k31*k14_pw2*k15_pw2*k34_pw2*k36 + 2*k21_pw4*k14_pw2*k32_pw2*k15_pw2*k34*k36 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k34*k26_pw2+ k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25_pw2*k34 + 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k15_pw2*k34 + k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k26_pw2+ k11_pw3*k22_pw2*k31_pw2*k14*k33_pw2*k25_pw2 + k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k25_pw2 + k11_pw3*k31_pw2*k14*k23_pw2*k24_pw2*k33_pw2 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25_pw2*k34 + k12_pw2*k21_pw2*k22_pw2*k31_pw3*k16_pw2*k34 + k12_pw2*k21_pw3*k31_pw2*k32_pw2*k24*k16_pw2 + k21_pw2*k13_pw2*k22_pw2*k31_pw3*k15_pw2*k34 + k21_pw3*k13_pw2*k31_pw2*k32_pw2*k15_pw2*k24 + k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k36_pw2+ k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k35_pw2+ k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k35_pw2+ k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k34_pw2 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25_pw2*k36 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25_pw2*k34 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24_pw2*k36 + 6*k21_pw3*k13_pw2*k14_pw2*k32_pw2*k24*k33_pw2 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24_pw2*k36 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k35_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k35_pw2+ 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k34_pw2*k26 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k35_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k34_pw2*k26 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k26*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k34_pw2*k26 - 2*k11_pw2*k12*k21*k13*k31_pw3*k32*k25_pw3 + k11*k12*k21*k22_pw3*k31_pw3*k32*k16_pw2 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw4*k24*k16 + 2*k11_pw2*k21*k13*k31_pw4*k23*k24_pw2*k16 - 4*k11*k21_pw2*k22*k31*k14_pw3*k23*k35_pw3 - 2*k11*k21*k13*k22_pw3*k31_pw3*k15_pw2*k35 + k12*k21_pw3*k22*k31*k14*k32_pw3*k16_pw2 + 4*k11_pw2*k13_pw2*k22*k31_pw4*k23*k24*k25 - 6*k11_pw2*k13*k22_pw2*k31_pw4*k23*k24*k16 + 3*k11_pw3*k12*k22*k31_pw3*k32*k24*k26_pw2- 4*k11_pw3*k21*k31_pw2*k14*k32*k33*k25_pw3 + k21_pw2*k13_pw3*k22*k31_pw3*k32*k15*k24 - k11*k21_pw2*k13*k14_pw2*k23*k32_pw4*k26 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k32*k24*k25 - 4*k11_pw2*k22_pw3*k31_pw3*k23*k32*k15*k16 + k11_pw2*k12*k22_pw3*k31_pw3*k32*k16*k26 + k11_pw2*k12*k22_pw3*k31_pw3*k33*k16*k25 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k24*k34 + k11_pw2*k13*k22_pw3*k31_pw3*k32*k15*k26 + k11_pw2*k13*k22_pw3*k31_pw3*k15*k33*k25 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k24*k34 + 3*k11_pw3*k12*k31_pw3*k23*k24*k33*k25_pw2 + 3*k11_pw3*k12*k22*k31_pw3*k32*k25_pw2*k26 - 2*k11_pw3*k22*k31_pw3*k23*k32*k15*k25_pw2 + k21_pw3*k13*k22*k31_pw2*k32*k15_pw3*k34 - 2*k12*k21_pw3*k22*k31*k14_pw2*k15*k35_pw3 + 3*k11_pw3*k12*k31_pw3*k23*k24_pw2*k33*k26 + 6*k11_pw3*k21*k31_pw3*k15*k24*k33*k25_pw2 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k24*k34 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k24*k35 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k25*k34 - 2*k21_pw3*k13_pw2*k31*k14*k32_pw3*k15*k25 - 4*k21_pw3*k13*k22*k14_pw2*k32_pw3*k33*k16 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k24*k33*k34 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k24*k35 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k25*k34 + 12*k11*k21_pw3*k31_pw3*k14*k24*k16_pw2*k34 - 2*k12*k21_pw3*k13*k14_pw2*k24*k33_pw3*k34 - 8*k11_pw2*k22_pw3*k31_pw3*k14*k23*k16*k35 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k25*k36 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k26*k35 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k25*k36 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k26*k35 - 2*k11_pw3*k31_pw3*k23_pw2*k32*k15*k24*k25 + 12*k11_pw3*k21*k31_pw3*k14*k24*k34*k26_pw2+ 6*k11_pw3*k21*k31_pw3*k15*k24_pw2*k33*k26 - 4*k11_pw3*k22*k31_pw3*k14*k23*k25_pw2*k35 - 2*k21_pw3*k13*k22*k14_pw3*k32*k33*k35_pw2- 4*k11*k21_pw3*k31_pw3*k15_pw2*k24*k16*k34 - 8*k11*k21_pw3*k14_pw2*k32_pw3*k33*k16*k25 + 2*k11*k21_pw3*k14_pw2*k15*k24*k33_pw3*k34 - 4*k12*k21_pw3*k22*k31_pw2*k15_pw3*k34*k35 - k11_pw2*k22_pw4*k31_pw2*k14*k15*k33*k36 - 2*k11_pw3*k22_pw2*k31_pw3*k32*k15*k25*k26 - 2*k11_pw3*k22_pw2*k31_pw3*k15*k24*k33*k26 + 12*k11_pw3*k21*k31_pw3*k14*k25_pw2*k34*k26 + 12*k11_pw3*k21*k31_pw3*k14*k24*k25_pw2*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k24*k16*k34 + k21_pw3*k13*k14_pw2*k23*k32_pw3*k15*k35 + k21_pw3*k13*k22*k14_pw2*k32_pw3*k15*k36 + 6*k21_pw3*k13*k31*k14_pw3*k23*k34*k35_pw2- 4*k11*k21_pw3*k14_pw3*k32*k33*k25*k35_pw2+ 12*k11*k21_pw3*k31*k14_pw3*k24*k34*k36_pw2+ k12*k21_pw3*k14_pw2*k23*k32_pw3*k16*k35 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k25*k36 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k26*k35 + k12*k21_pw3*k22*k14_pw2*k32_pw3*k16*k36 + 3*k12*k21_pw3*k22*k14_pw3*k32*k34*k36_pw2- 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k25*k35 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k34*k26 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k26*k36 - 2*k21_pw3*k13*k22*k14_pw3*k33_pw2*k34*k35 + 6*k21_pw3*k13*k31*k14_pw3*k23*k34_pw2*k36 + 4*k21_pw4*k31*k14*k32_pw2*k15_pw2*k16*k34 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k25*k36 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k26*k35 + 12*k11*k21_pw3*k31*k14_pw3*k24*k35_pw2*k36 + 12*k11*k21_pw3*k31*k14_pw3*k34*k26*k35_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k33*k34*k35_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k32*k35_pw2*k36 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k26*k36 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k25*k26*k35 - 2*k21_pw3*k13*k14_pw3*k23*k32_pw2*k34*k36 - 2*k21_pw3*k13*k22*k14_pw3*k32_pw2*k35*k36 + 2*k21_pw4*k31*k14_pw2*k15*k33*k16*k34_pw2 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k25*k34*k35 - 4*k11*k21_pw3*k14_pw3*k24*k33_pw2*k34*k36 + 12*k11*k21_pw3*k31*k14_pw3*k34_pw2*k26*k36 + 3*k12*k21_pw3*k14_pw3*k23*k33*k34_pw2*k36 - 6*k21_pw4*k14_pw2*k32_pw2*k15*k33*k16*k34 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k25*k35*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k34*k26*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k25*k35*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k34*k26*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k25*k34*k26*k35 + 4*k21_pw4*k14_pw2*k32*k15_pw2*k33*k34*k35 + 2*k11_pw2*k12_pw2*k21*k31_pw2*k32*k33*k25_pw3 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k33*k25_pw2 - k11_pw2*k12*k13*k31_pw3*k23_pw2*k24_pw2*k33 - 2*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k34_pw2 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k32_pw2*k24 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k15*k24_pw2*k33 - 2*k11_pw2*k21_pw2*k31*k14*k15*k24_pw2*k33_pw3 - k11_pw2*k13*k22_pw3*k31_pw2*k14*k33_pw2*k25 + 2*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k35_pw3 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k32_pw2*k24 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k32_pw2*k25 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25_pw2*k34 - k11*k21_pw2*k22_pw2*k31_pw2*k15_pw3*k33*k34 - k11*k21_pw2*k22_pw2*k31_pw2*k32*k15_pw3*k35 - 6*k11*k21_pw2*k22_pw2*k31_pw3*k14*k16_pw2*k34 - 6*k11*k21_pw3*k31_pw2*k14*k32_pw2*k24*k16_pw2 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k34*k26_pw2+ 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25_pw2*k35 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k24*k34 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24*k26_pw2- 6*k11_pw3*k21*k31_pw2*k14*k24*k33_pw2*k25_pw2 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25_pw2*k34 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24_pw2*k36 + 2*k11*k21_pw2*k22_pw2*k31_pw3*k15_pw2*k16*k34 - k11*k21_pw2*k22_pw2*k14_pw2*k15*k33_pw3*k34 - 2*k11*k21_pw3*k31_pw2*k32_pw2*k15_pw2*k24*k16 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw2*k34*k26 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k15*k24_pw2*k33*k16 + 8*k11_pw2*k21_pw2*k14_pw2*k32*k24*k33_pw3*k25 - 12*k11_pw2*k22_pw2*k31_pw3*k14*k23_pw2*k16*k34 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k24*k36 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k25*k35 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k34*k26 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k25_pw2*k26 - 6*k11_pw3*k21*k31_pw2*k14*k24_pw2*k33_pw2*k26 - 2*k21_pw2*k13_pw2*k22_pw2*k31_pw3*k14*k16*k34 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25_pw2*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25_pw2*k34 + 2*k21_pw3*k13_pw2*k31_pw2*k14*k32_pw2*k24*k16 + 2*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k34_pw2 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k24_pw2*k16*k36 - 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34*k36_pw2- k11*k21_pw2*k14_pw2*k23_pw2*k32_pw3*k15*k35 - 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34*k35_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k35_pw2- 12*k11*k21_pw3*k14_pw2*k32_pw2*k24*k33_pw2*k16 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k25*k35 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k34*k26 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k26*k36 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25_pw2*k34 + 8*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k34*k35 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k24*k33_pw2*k26 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k24*k26 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k25*k35 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k34*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k35_pw2- 2*k12_pw3*k21_pw2*k13*k31_pw2*k24_pw2*k33*k36 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k35_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k24*k33_pw2*k34 - 6*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k34_pw2 - 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k35_pw2*k36 - 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k35_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k34_pw2*k26 - k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k35_pw2- k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k34_pw2 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k26*k36 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k25*k35 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k34*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k24_pw2*k16*k36 + 8*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k33*k25*k26 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k35_pw2- 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k34_pw2*k26 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k24*k36 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k25*k35 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k34*k26 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k34*k36 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k34*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k34_pw2*k26 + 8*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k35*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k34_pw2*k26 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k35_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34*k36_pw2+ 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k34*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k34*k35 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k35_pw2*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k34*k26*k35_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k34*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k34*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k34*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k34*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k34_pw2*k26*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k34*k26*k36 - 4*k11*k21*k13_pw3*k22*k31_pw4*k24*k25 - 12*k11_pw3*k13*k22*k31_pw4*k24*k25*k26 + 8*k11_pw3*k22*k31_pw4*k23*k24*k16*k25 - 4*k21_pw4*k31*k14*k32*k15_pw3*k34*k35 + 8*k21_pw4*k14_pw3*k32*k33*k16*k34*k35 - 12*k21_pw4*k14_pw3*k32*k15*k34*k35*k36 - 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k25_pw2 - 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k24_pw2*k33_pw2 + 3*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k16_pw2 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24*k26_pw2+ 3*k11_pw2*k12_pw2*k21*k31_pw2*k24*k33_pw2*k25_pw2 - 2*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k16*k25_pw2 - 2*k11*k12_pw2*k21_pw2*k31_pw2*k24_pw2*k33_pw2*k16 + k11*k21_pw2*k22_pw2*k31_pw2*k32_pw2*k15_pw2*k16 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k25_pw2*k26 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k24_pw2*k33_pw2*k26 + 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k16 + k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k36_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k35_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k34_pw2*k26_pw2- 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k35_pw2+ 6*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw2*k33_pw2*k16 - 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k34_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k16*k25_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k33_pw2*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k36_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k35_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k24*k26 + 6*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k35_pw2+ 6*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k34_pw2 + 2*k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k24*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k34*k26_pw2- 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25_pw2*k34 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k26*k35_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k34_pw2*k26 - 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k35_pw2- 2*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k34_pw2 + 12*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k24*k33_pw2*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25_pw2*k36 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k24_pw2*k33_pw2*k36 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34*k36_pw2+ 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34*k35_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k26*k35_pw2+ 12*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k34*k36 + 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k34*k36 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k35_pw2*k36 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34_pw2*k36 + 2*k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k34*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k34*k36 - k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k25_pw2 - k11*k12_pw2*k21*k13*k31_pw2*k23*k24_pw2*k33_pw2 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k24*k33_pw2 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k24 - k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k25_pw2 - k11_pw2*k12*k21*k31_pw2*k23*k15*k24_pw2*k33_pw2 + k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k25_pw2 + k11_pw2*k21*k13*k31_pw2*k14*k23*k24_pw2*k33_pw2 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k24*k33_pw2*k16 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k32_pw2*k24*k16 - k11*k21_pw2*k13*k31_pw2*k23*k32_pw2*k15_pw2*k24 - k11*k21_pw2*k13*k22*k31_pw2*k32_pw2*k15_pw2*k25 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k26 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k35_pw2- 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k24*k33_pw2 - 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32_pw2*k25 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k32_pw2*k16*k26 - 6*k11*k21_pw2*k13*k14_pw2*k23*k32_pw2*k24*k33_pw2 - 6*k11*k21_pw2*k13*k22*k14_pw2*k32_pw2*k33_pw2*k25 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k32_pw2*k15*k24 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k32_pw2*k15*k25 + k12*k21_pw2*k13*k22_pw2*k31_pw2*k32_pw2*k15*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k24*k33_pw2*k16 - 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32_pw2*k24*k16 - 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32_pw2*k26 - k12_pw2*k21_pw2*k13*k31_pw2*k23*k32_pw2*k24*k16 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k32_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k24*k26 + 2*k11*k21_pw2*k22_pw2*k31*k14*k15_pw2*k33_pw2*k34 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k35_pw2+ 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k35_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k32_pw2*k15_pw2*k34 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k15_pw2*k33*k34 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k32*k15_pw2*k35 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k35_pw2- k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k34_pw2 - 6*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k33*k25_pw2 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32_pw2*k16*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k35_pw2+ 4*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k24*k33*k25 + 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k35_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k24*k16*k26 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25_pw2*k35 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25_pw2*k34 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k33_pw2*k16*k34 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k35_pw2+ 2*k11*k21_pw2*k22_pw2*k31*k14*k32_pw2*k15_pw2*k36 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k34_pw2*k26 - 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32_pw2*k16*k34 + k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k34_pw2 + 4*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k24*k33*k25 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32*k15*k35 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k15*k33*k34 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k33_pw2*k16*k34 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k34_pw2*k26 + k12_pw2*k21_pw2*k31*k14*k23_pw2*k32_pw2*k16*k34 - k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k34_pw2 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32*k15*k35 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k15*k33*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k26*k35_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24_pw2*k33*k36 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32*k15*k33_pw2*k35 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32_pw2*k16*k36 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw2*k15*k33*k34 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k24*k16*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25_pw2*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25_pw2*k34 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25_pw2*k35 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k32*k15*k16*k35 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15*k33*k16*k34 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k32_pw2*k16*k36 + 4*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k34*k35 + 4*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k34*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k34*k36 - 4*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k34*k36 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw2*k15*k33*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24_pw2*k33*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k25*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k34*k26 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k34*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k34*k35 + 12*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k34*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k26*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25*k26*k35 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k35*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k34*k26*k36 - 4*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k34*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k35*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k34*k26*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k34*k26*k35 + 2*k11*k21*k13*k22_pw3*k31_pw3*k32*k15*k16 + 4*k11_pw2*k21*k13*k22*k31_pw4*k24*k16*k25 + 4*k11*k21*k13*k22_pw3*k31_pw3*k14*k16*k35 + 2*k21_pw3*k13*k22*k31*k14*k32_pw3*k15*k16 + 4*k11*k21_pw3*k31*k14*k32_pw3*k15*k16*k25 + 6*k11_pw3*k12*k31_pw3*k23*k32*k24*k25*k26 + 6*k11_pw3*k12*k22*k31_pw3*k24*k33*k25*k26 - 4*k11_pw3*k22*k31_pw3*k23*k32*k15*k24*k26 - 4*k11_pw3*k22*k31_pw3*k23*k15*k24*k33*k25 + 8*k12*k21_pw3*k13*k31_pw3*k15*k24*k16*k34 + 12*k11_pw3*k21*k31_pw3*k32*k15*k24*k25*k26 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k25*k36 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k26*k35 - 8*k11_pw3*k22*k31_pw3*k14*k23*k25*k34*k26 + 24*k11_pw3*k21*k31_pw3*k14*k24*k25*k26*k35 - 4*k21_pw3*k13*k14_pw3*k23*k32*k33*k34*k35 - 4*k21_pw3*k13*k22*k14_pw3*k32*k33*k34*k36 + 12*k21_pw3*k13*k22*k31*k14_pw3*k34*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k24*k33*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k25*k34*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k34*k26*k35 + 4*k21_pw4*k31*k14_pw2*k32*k15*k16*k34*k35 + 24*k11*k21_pw3*k31*k14_pw3*k25*k34*k35*k36 + 6*k12*k21_pw3*k14_pw3*k23*k32*k34*k35*k36 + 6*k12*k21_pw3*k22*k14_pw3*k33*k34*k35*k36 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k25_pw2 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k24_pw2*k33 + k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k26_pw2+ k11_pw2*k12*k21*k31*k14*k23*k24_pw2*k33_pw3 - 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k25_pw2 - k11*k12*k21_pw2*k22*k31_pw3*k32*k24*k16_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k24*k33*k25_pw2 - k11_pw2*k12*k21*k22*k31_pw3*k32*k16*k25_pw2 - k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k25_pw2*k34 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k25_pw2*k35 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32*k24*k33_pw3 + 4*k11*k12*k21_pw2*k13*k31_pw3*k24_pw2*k33*k16 + k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k36_pw2+ k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k34_pw2 - 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k32*k15*k25 - 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k15*k24*k33 - 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k15_pw2*k34 - k11_pw2*k12*k21*k31_pw3*k23*k24_pw2*k33*k16 - 6*k11_pw2*k12*k21*k13*k31_pw3*k24_pw2*k33*k26 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k24*k25 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k32*k24*k16 - k11_pw2*k21*k13*k31_pw3*k23*k15*k24_pw2*k33 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k32*k15*k24 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k24_pw2*k36 - 2*k11*k21_pw2*k22*k31_pw2*k23*k32*k15_pw3*k34 + k11*k12_pw3*k21*k22*k31_pw2*k32*k34*k26_pw2- 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k25_pw2*k34 + k11*k12*k21*k22_pw3*k31_pw2*k15_pw2*k33*k35 + k11*k12*k21*k22_pw3*k31_pw2*k32*k15_pw2*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k24*k34 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k32*k24*k16 + k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw3*k26 + k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw3*k25 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k32*k16*k25 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k24*k33*k16 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k25_pw2*k34 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k25_pw2*k35 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k25*k26 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k24*k33*k26 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k25_pw2*k34 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k25_pw2*k35 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k32*k15*k25 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k15*k24*k33 - 2*k21_pw2*k13_pw3*k22*k31_pw2*k14*k32*k24*k33 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k24*k25 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k24*k34 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32_pw3*k33*k25 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k24*k35 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k25*k34 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32_pw3*k33*k26 + 8*k11*k21_pw2*k22*k14_pw2*k23*k32_pw3*k33*k16 + k11*k12_pw3*k21*k31_pw2*k23*k32*k25_pw2*k35 + k11*k12_pw3*k21*k31_pw2*k23*k33*k25_pw2*k34 + k11*k12_pw3*k21*k22*k31_pw2*k32*k25_pw2*k36 + k11*k12_pw3*k21*k22*k31_pw2*k33*k25_pw2*k35 + k11*k12*k21_pw2*k14_pw2*k23*k24*k33_pw3*k34 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k24_pw2*k36 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k25*k34 + k11*k12*k21_pw2*k22*k14_pw2*k24*k33_pw3*k35 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k24*k36 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k25*k35 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k34*k26 + 8*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32*k33*k16 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k24*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k25*k34 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k24*k33*k34 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k24_pw2*k36 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k24*k35 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k25*k34 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k32*k15*k16*k25 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k15*k24*k33*k16 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k24_pw2*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k24*k35 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k25*k34 - 2*k11_pw2*k13*k22_pw3*k31_pw2*k14*k32*k33*k26 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k24*k35 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k25*k34 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32*k15*k34 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32*k33*k25_pw2 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k35_pw2+ k11*k12_pw3*k21*k31_pw2*k23*k24_pw2*k33*k36 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k24*k34 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k24*k35 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k25*k34 - k12*k21_pw3*k22*k31_pw2*k14*k32*k16_pw2*k34 + 3*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k35_pw2- 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k24*k36 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k25*k35 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k34*k26 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k24*k16*k34 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k24*k36 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k25*k35 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k34*k26 + 4*k11_pw3*k22*k31_pw2*k14*k23*k24*k33_pw2*k25 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k24*k16*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k24*k16*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k25*k34 + k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k36_pw2- 6*k21_pw3*k13_pw2*k31*k14*k32_pw2*k15*k24*k33 - k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k35_pw2- 2*k21_pw3*k13*k22*k31*k14*k32_pw2*k15_pw2*k35 - 2*k21_pw3*k13*k31*k14*k23*k32_pw2*k15_pw2*k34 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k25*k35 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k34*k26 - 2*k11*k21_pw2*k22*k14_pw2*k23*k32_pw3*k15*k36 - 4*k11*k21_pw3*k31*k14*k15_pw2*k24*k33_pw2*k34 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k25*k36 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k26*k35 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k26*k36 - 4*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k35*k36 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k24*k33*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k35_pw2- 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k24*k35 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k25*k34 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k35_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k35_pw2+ 3*k12*k21_pw3*k22*k31_pw2*k32*k15_pw2*k16*k34 - k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k35_pw2+ 3*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k34_pw2 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k25*k36 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k26*k35 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25*k34*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k32*k15*k24*k16*k25 - 4*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k25*k26 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32*k15*k36 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k15*k33*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k26*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k25*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k26*k35 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k24*k16*k36 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k25*k35 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k34*k26 + 4*k11_pw3*k31_pw2*k14*k23_pw2*k32*k24*k33*k25 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k25*k26 + k12_pw3*k21_pw2*k22*k31*k14*k32*k26*k35_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k35_pw2+ 3*k21_pw3*k13*k22*k14_pw2*k32*k15*k33_pw2*k34 + 4*k21_pw3*k13*k22*k31*k14_pw2*k32_pw2*k16*k35 + 4*k21_pw3*k13*k31*k14_pw2*k23*k32_pw2*k16*k34 - k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k34_pw2 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k25*k35 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k34*k26 + 4*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k34*k35 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k35_pw2- 2*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k35_pw2+ 8*k11*k21_pw3*k31*k14_pw2*k24*k33_pw2*k16*k34 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k24*k36 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k25*k35 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k34*k26 + 4*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k34_pw2 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k34_pw2*k26 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k25*k34 - 6*k12*k21_pw3*k13*k14_pw2*k32*k24*k33_pw2*k35 + 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k34_pw2*k26 + 3*k12*k21_pw3*k22*k14_pw2*k32*k33_pw2*k16*k34 - 2*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k35_pw2- k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k34_pw2 - 12*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25*k26*k35 + 4*k11_pw3*k22_pw2*k31_pw2*k14*k32*k33*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k35_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k35_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k24*k16*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k25*k34 + k12_pw3*k21_pw2*k31_pw2*k23*k24*k33*k16*k34 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k25*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k26*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25*k34*k26 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k25*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k34*k26 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k24*k16*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k25*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k34*k26 + k12_pw3*k21_pw2*k22*k31_pw2*k24*k33*k16*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k25*k34 + k12_pw3*k21_pw2*k31*k14*k23*k33*k34_pw2*k26 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k24*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k25*k34 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k24*k33*k34 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k24*k33*k35 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k25*k34 + 3*k21_pw3*k13*k14_pw2*k23*k32_pw2*k15*k33*k34 + 4*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k34*k35 + 3*k21_pw3*k13*k22*k14_pw2*k32_pw2*k15*k33*k35 + 4*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k34*k35 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k35*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k25*k34 + 6*k11*k21_pw3*k14_pw2*k32*k15*k24*k33_pw2*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k24*k16*k36 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k25*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k34*k26 - 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k34_pw2*k26 + 3*k12*k21_pw3*k14_pw2*k23*k32_pw2*k33*k16*k34 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k24*k33*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k25*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k34*k26 + 3*k12*k21_pw3*k22*k14_pw2*k32_pw2*k33*k16*k35 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k34*k35_pw2- 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k25*k35 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k34*k26 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k24*k16*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k25*k34 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k24*k33*k16*k34 - 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k34_pw2*k26 - 12*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k34*k35 + 4*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k34*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k34*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k24*k33*k36 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k25*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k34*k26 - 2*k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k34*k35 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k34_pw2*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k34*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k34*k35 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k35*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k34*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k34*k26*k35 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k34*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k34*k35 - 2*k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k34*k36 - 2*k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k34*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k34*k35 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k35*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k34*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k34*k26*k35 - 12*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34*k35*k36 - k11*k12*k21*k13*k22_pw2*k31*k14*k24*k33_pw3 - k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw3*k25 + 3*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw3*k16 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k24*k25 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k24*k26 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k24*k33*k25 + 3*k11*k12*k21*k22_pw3*k31*k14*k32*k33_pw2*k16 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k32*k16*k25 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k24*k33*k16 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k32*k15*k24 + 2*k11_pw2*k12*k21*k22*k31*k14*k24*k33_pw3*k25 - 2*k11*k12*k21*k22_pw3*k31_pw2*k32*k15*k33*k16 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k24*k34 - k11*k12*k21*k31*k14*k23_pw3*k32_pw2*k15*k34 - 4*k11*k21*k13*k22_pw3*k31_pw2*k14*k32*k33*k16 - 2*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw3*k16 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k24*k26 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k24*k33*k25 - 2*k11*k21_pw2*k13*k22*k31_pw3*k32*k15*k24*k16 + 2*k11*k21_pw2*k13*k22*k31*k14*k32_pw3*k15*k26 + 2*k11*k21_pw2*k13*k31*k14*k23*k32_pw3*k15*k25 - 4*k11*k21_pw2*k22*k31*k14*k23*k32_pw3*k15*k16 + 8*k11*k12*k21_pw2*k13*k31_pw3*k32*k24*k16*k25 - 2*k11*k12*k21_pw2*k22*k31*k14*k32_pw3*k16*k26 - 2*k11*k12*k21_pw2*k31*k14*k23*k32_pw3*k16*k25 - k11*k12*k21*k22_pw3*k31*k14*k15*k33_pw2*k35 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k24*k36 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k25*k35 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k34*k26 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k24*k35 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k25*k34 + 12*k11*k21*k13*k22_pw2*k31_pw3*k14*k23*k16*k34 - 2*k11_pw2*k12*k21*k31_pw3*k23*k32*k24*k16*k25 - 12*k11_pw2*k12*k21*k13*k31_pw3*k32*k24*k25*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k32*k24*k16*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k24*k33*k16*k25 + 2*k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k25*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k24*k25 - 2*k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k24*k26 - 2*k11_pw2*k21*k13*k22*k31_pw3*k15*k24*k33*k25 + 8*k11_pw2*k21*k22*k31_pw3*k23*k32*k15*k24*k16 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k25*k35 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k34*k26 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k25*k36 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k26*k35 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k25*k34*k26 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k32*k16*k36 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k33*k16*k35 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k34*k35 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k32*k15*k36 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k15*k33*k35 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k24*k16*k34 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k24*k16*k35 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k25*k34 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k24*k16*k34 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k25*k35 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k34*k26 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k24*k16*k35 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k25*k34 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k25*k35 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k34*k26 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k25*k36 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k26*k35 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k25*k34*k26 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k25*k35 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k34*k26 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k25*k36 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k26*k35 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k25*k34*k26 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k24*k16*k35 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k25*k34 - 4*k21_pw3*k13*k22*k31*k14*k32*k15_pw2*k33*k34 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k25*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k26*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k25*k34*k26 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k25*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k34*k26 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k26*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k25*k26*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k25*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k26*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k33*k25*k34*k26 + 12*k11*k21_pw3*k31*k14*k32_pw2*k15*k24*k33*k16 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k35*k36 + 4*k12*k21_pw3*k13*k31*k14*k15*k24*k33_pw2*k34 + 8*k11_pw3*k22*k31_pw2*k14*k23*k32*k24*k33*k26 - 2*k21_pw3*k13*k22*k31_pw2*k14*k32*k15*k16*k34 + 8*k21_pw3*k13*k22*k31*k14_pw2*k32*k33*k16*k34 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k24*k33*k35 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k25*k34 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k24*k16*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k25*k34 - 4*k12*k21_pw3*k13*k31_pw2*k14*k24*k33*k16*k34 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k24*k36 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k25*k35 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k34*k26 - 4*k12*k21_pw3*k22*k31*k14*k32_pw2*k15*k16*k35 - 4*k12*k21_pw3*k31*k14*k23*k32_pw2*k15*k16*k34 - 24*k11_pw3*k21*k31_pw2*k14*k32*k24*k33*k25*k26 + 8*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k34*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k24*k16*k35 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k25*k34 - 4*k11*k21_pw3*k31_pw2*k14*k15*k24*k33*k16*k34 + 16*k11*k21_pw3*k31*k14_pw2*k32*k24*k33*k16*k35 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k25*k34 + 6*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k34*k35 + 6*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k34*k36 + 6*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k34*k35 - 2*k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k34*k36 - 2*k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k34*k35 - 2*k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k34*k35 - 24*k11*k21_pw2*k22*k31*k14_pw3*k23*k34*k35*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k34*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k34*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k34*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k34*k26*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k34*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k34*k35 + 8*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k34*k35 - 2*k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k34*k36 - 2*k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k34*k35 - 2*k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k34*k26*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k34*k26*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k34*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k34*k26*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k34*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k34*k35 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k34*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k34*k26*k35 - 4*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k34*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k34*k35 - 4*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k34*k35 - 4*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k34*k26*k35 - 4*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k34*k35 - 12*k12*k21_pw3*k22*k31*k14_pw2*k15*k34*k35*k36 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k33*k25_pw2 + k11*k12*k21*k13*k22_pw2*k31_pw2*k15*k24*k33_pw2 + k11*k12*k21*k13*k31_pw2*k23_pw2*k32_pw2*k15*k24 + 3*k11_pw2*k12*k21*k22*k31*k14*k32*k33_pw2*k25_pw2 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k24*k33_pw2*k25 - 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k32_pw2*k15*k16 + k11*k12*k21*k13*k22_pw2*k31_pw2*k32_pw2*k15*k26 + 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k32*k15_pw2*k34 + 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k35_pw2+ 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32_pw2*k25 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32_pw2*k16 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k33*k25_pw2 + 3*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k33*k25_pw2 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k33*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k24*k26 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k32_pw2*k16*k25 - 2*k11*k21_pw2*k13*k22*k31_pw2*k32*k15_pw2*k24*k33 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k15_pw2*k33*k34 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k32*k15_pw2*k35 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k35_pw2+ 4*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32*k33*k25 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32*k24*k33_pw2 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k34*k26_pw2- 2*k11_pw2*k12*k21*k22*k31_pw2*k15*k24*k33_pw2*k25 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k24*k33_pw2*k25 - 6*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32*k24*k33 + 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k33*k16*k25 + k11*k12_pw2*k21*k31*k14*k23_pw2*k24*k33_pw2*k34 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k32_pw2*k24*k16 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k32_pw2*k16*k25 + 2*k11*k12*k21_pw2*k31_pw2*k23*k32_pw2*k15*k24*k16 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25_pw2*k35 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25_pw2*k34 + 2*k11*k12*k21_pw2*k22*k31_pw2*k32_pw2*k15*k16*k25 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k36_pw2- 2*k12*k21_pw2*k13_pw2*k22*k31_pw2*k32*k15*k24*k33 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw2*k33*k25 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw2*k24*k33 - 3*k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw2*k33*k16 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k32*k15_pw2*k34 - 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k35_pw2- 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25_pw2*k35 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25_pw2*k34 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k24*k26 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k25*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25_pw2*k36 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25_pw2*k35 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k24*k26 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k25*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32_pw2*k16*k25 - 6*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32*k33*k25 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k24*k33*k16 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k25*k35 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k34*k26 + k11*k12_pw2*k21*k22_pw2*k31*k14*k24*k33_pw2*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k24*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k25*k34 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k24*k33*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k24*k36 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k25*k35 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k34*k26 - 8*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k24*k33*k25 - 6*k11*k21_pw2*k22_pw2*k31*k14*k32_pw2*k15*k33*k16 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k25*k34 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k24*k33_pw2*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k24*k33_pw2*k34 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k35_pw2+ 4*k11*k21_pw2*k22*k31*k14*k23*k32_pw2*k15_pw2*k35 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k35_pw2- k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k24*k33*k34 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k24*k35 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k25*k34 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k24_pw2*k33*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k24*k33*k35 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k25*k34 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k35_pw2- k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k24*k36 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k25*k35 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k34*k26 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k26*k35_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k35_pw2- 12*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k34*k35 + k12*k21_pw2*k13*k22_pw2*k31*k14*k15*k33_pw2*k34 + k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw2*k15*k34 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k24_pw2*k33*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k24*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k25*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k34*k26 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k24*k33*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k25*k34 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k33*k16*k25 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k25*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k24*k33_pw2*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k24*k33_pw2*k34 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k35_pw2- 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32*k15*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k32*k24*k33*k16*k25 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k25*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k26*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k24*k33*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k25*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k34*k26 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k26*k36 + 4*k11*k21_pw2*k22_pw2*k31*k14*k32*k15_pw2*k33*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k25*k36 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k26*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k24*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k25*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k34*k26 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32*k15*k33_pw2*k34 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k32_pw2*k16*k35 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k34_pw2*k26 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k25*k34 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k24*k33_pw2*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k25*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k34*k26 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k24*k33_pw2*k36 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k34_pw2*k26 - 12*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k34*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k24*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k25*k34 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k24*k33*k34 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k24*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k25*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k34*k26 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k24*k33*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k25*k34 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k32*k16*k35 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k33*k16*k34 + k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw2*k15*k36 + 12*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24*k33*k25*k26 - 12*k11_pw2*k21_pw2*k31*k14*k32*k15*k24*k33_pw2*k25 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k25*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k26*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k24*k33*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k25*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k34*k26 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k24*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k25*k34 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k24*k33*k34 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k24*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k25*k34 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k24*k33*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k24*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k25*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k34*k26 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k24*k33*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k25*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k25*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k26*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k24*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k25*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k34*k26 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k32*k15*k16*k34 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32_pw2*k16*k35 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32*k15*k16*k35 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15*k33*k16*k34 - 8*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k33*k16*k35 - 8*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k34*k35 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32_pw2*k15*k33*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k24*k33*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k25*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k34*k26 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k25*k36 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k26*k35 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k34*k35 + 24*k11_pw2*k21_pw2*k31_pw2*k14*k32*k24*k33*k16*k25 - 12*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k24*k33*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k25*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k26*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k24*k33*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k25*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k34*k26 + 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k33*k16*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k25*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k26*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25*k34*k26 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k25*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k34*k26 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k34*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k34*k35 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k35*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k34*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k34*k26*k35 + 24*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k34*k35 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k34*k35 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k35*k36 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k34*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k35*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k34*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k34*k26*k35 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k34*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k34*k35 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k35*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k34*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k34*k26*k35 - 8*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k34*k35 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k34*k35 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k35*k36 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k34*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k25*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25*k34*k26 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k25*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k34*k26 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k25*k36 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k26*k35 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25*k34*k26 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k35*k36 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k34*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k35*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k34*k26*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k34*k26*k35 + 12*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34*k35*k36 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32*k33_pw2*k25 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k32_pw2*k15*k25 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw2*k24*k33 + 9*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw2*k33*k16 + 2*k11*k12*k21*k13*k22_pw2*k31_pw2*k32*k15*k33*k25 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw2*k33*k26 + 8*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32*k24*k33 - 4*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k24*k33*k25 - 4*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k24*k33*k26 + 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k24*k33*k16 + 6*k11*k21_pw2*k13*k22*k31*k14*k32*k15*k24*k33_pw2 - 6*k11*k12*k21_pw2*k22*k31*k14*k32*k24*k33_pw2*k16 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k15*k33_pw2*k34 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k32*k16*k34 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw2*k15*k35 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32*k15*k34 + 6*k11_pw2*k12*k21*k22*k31*k14*k32*k24*k33_pw2*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32*k24*k33_pw2*k25 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k25*k34 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k24*k33_pw2*k35 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k24*k33*k16 + 6*k11*k21_pw2*k13*k22*k31*k14*k32_pw2*k15*k33*k25 + 6*k11*k21_pw2*k13*k31*k14*k23*k32_pw2*k15*k24*k33 + 4*k11*k12*k21_pw2*k22*k31_pw2*k32*k15*k24*k33*k16 - 6*k11*k12*k21_pw2*k22*k31*k14*k32_pw2*k33*k16*k25 - 6*k11*k12*k21_pw2*k31*k14*k23*k32_pw2*k24*k33*k16 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k32*k16*k35 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k33*k16*k34 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw2*k15*k36 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32*k15*k35 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k15*k33*k34 - 4*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k24*k33*k25 - 4*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k24*k33*k26 + 6*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k33*k25*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k24*k33*k26 + 4*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k24*k33*k25 + 4*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k24*k33*k26 - 16*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k24*k33*k16 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k24*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k25*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k34*k26 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k24*k33*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k25*k34 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k25*k36 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k26*k35 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k24*k33*k35 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k25*k34 + 8*k11*k21_pw2*k22*k31*k14*k23*k32*k15_pw2*k33*k34 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k34*k36 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k34*k35 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k32*k16*k34 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw2*k15*k35 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k25*k36 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k26*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k24*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k25*k34 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k24*k33*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k24*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k25*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k34*k26 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k24*k33*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k25*k34 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k24*k33*k36 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k25*k35 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k34*k26 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k24*k33*k35 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k25*k34 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k32*k15*k16*k34 - 16*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k33*k16*k34 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k24*k16*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k25*k34 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k24*k33*k16*k34 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k25*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k26*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25*k34*k26 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k25*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k34*k26 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k24*k16*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k25*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k34*k26 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k24*k33*k16*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k25*k34 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k35*k36 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k34*k36 + 2*k12*k21_pw2*k13*k22_pw2*k31*k14*k32*k15*k33*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k25*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k26*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25*k34*k26 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k25*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k34*k26 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k26*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25*k26*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k25*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k26*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25*k34*k26 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k24*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k25*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k34*k26 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k24*k33*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k25*k34 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k24*k33*k36 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k25*k35 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k34*k26 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k24*k33*k35 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k25*k34 + 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k33*k16*k34 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k34*k36 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k34*k35 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k34*k36 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k34*k35 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k34*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k34*k35 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k35*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k34*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k34*k26*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k34*k26*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k34*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k34*k26*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k34*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k34*k26*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k34*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k34*k35 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k34*k36 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k34*k35 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k32*k24*k16 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw3*k26 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k24*k35 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k25*k34 - 2*k11*k12*k21*k22_pw3*k31*k14*k32*k15*k33*k36 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k24*k33*k35 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k25*k34 - 8*k12*k21_pw3*k22*k31*k14*k32*k15*k33*k16*k34 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32*k24*k33_pw2 + 4*k11*k12*k21*k13*k22*k31_pw2*k23*k32*k15*k24*k33 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw2*k33*k25 - 6*k11*k12*k21*k22*k31*k14*k23_pw2*k32*k15*k33*k34 - 6*k11*k12*k21*k22_pw2*k31*k14*k23*k32*k15*k33*k35 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k24*k33*k36 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k25*k35 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k34*k26 + 4*k12*k21_pw2*k13*k22*k31*k14*k23*k32*k15*k33*k34);
+    coeffs[4] = (k11_pw4*k31_pw4*k25_pw4 + k21_pw4*k14_pw4*k35_pw4 + k11_pw2*k22_pw4*k31_pw4*k16_pw2 + k21_pw2*k13_pw4*k31_pw4*k24_pw2 + 6*k11_pw4*k31_pw4*k24_pw2*k26_pw2+ k21_pw4*k31_pw2*k15_pw4*k34_pw2 + k21_pw4*k14_pw2*k32_pw4*k16_pw2 + 6*k21_pw4*k14_pw4*k34_pw2*k36_pw2+ k11_pw2*k13_pw2*k22_pw2*k31_pw4*k25_pw2 + k11_pw2*k13_pw2*k31_pw4*k23_pw2*k24_pw2 + k11_pw2*k21_pw2*k14_pw2*k24_pw2*k33_pw4 + 6*k11_pw2*k21_pw2*k31_pw4*k24_pw2*k16_pw2 + k11_pw2*k21_pw2*k14_pw2*k32_pw4*k26_pw2+ k11_pw2*k31_pw2*k14_pw2*k23_pw4*k34_pw2 + k11_pw2*k22_pw4*k31_pw2*k14_pw2*k36_pw2+ k12_pw4*k21_pw2*k31_pw2*k24_pw2*k36_pw2+ k12_pw4*k21_pw2*k31_pw2*k25_pw2*k35_pw2+ k12_pw4*k21_pw2*k31_pw2*k34_pw2*k26_pw2+ 6*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k34_pw2 + k21_pw4*k14_pw2*k32_pw2*k15_pw2*k35_pw2+ k21_pw4*k14_pw2*k15_pw2*k33_pw2*k34_pw2 - 2*k11_pw3*k13*k22*k31_pw4*k25_pw3 + 12*k11_pw4*k31_pw4*k24*k25_pw2*k26 - 2*k21_pw4*k14_pw3*k32*k15*k35_pw3 + 12*k21_pw4*k14_pw4*k34*k35_pw2*k36 + 2*k11_pw3*k22_pw2*k31_pw4*k16*k25_pw2 + 2*k11_pw3*k31_pw4*k23_pw2*k24_pw2*k16 + k11_pw2*k22_pw4*k31_pw3*k15_pw2*k36 + k21_pw3*k13_pw2*k14_pw2*k32_pw4*k26 + 2*k21_pw4*k14_pw3*k32_pw2*k16*k35_pw2+ 2*k21_pw4*k14_pw3*k33_pw2*k16*k34_pw2 - 2*k11*k21*k13_pw3*k31_pw4*k23*k24_pw2 + k11_pw3*k12*k31_pw3*k23*k32*k25_pw3 + k11_pw3*k12*k22*k31_pw3*k33*k25_pw3 + 2*k11_pw3*k21*k31_pw3*k32*k15*k25_pw3 - 2*k11_pw2*k13*k22_pw3*k31_pw4*k16*k25 - 6*k11_pw3*k13*k31_pw4*k23*k24*k25_pw2 + 2*k21_pw3*k13*k22*k31*k14_pw3*k35_pw3 - k11_pw2*k22_pw4*k31_pw3*k15*k33*k16 + 4*k11_pw3*k21*k31_pw3*k14*k25_pw3*k35 - 12*k11_pw3*k21*k31_pw4*k24*k16*k25_pw2 - 6*k11_pw3*k13*k31_pw4*k23*k24_pw2*k26 - k21_pw3*k13*k14_pw2*k23*k32_pw4*k16 + 4*k11*k21_pw3*k31*k14_pw3*k25*k35_pw3 + k12*k21_pw3*k14_pw3*k23*k32*k35_pw3 + k12*k21_pw3*k22*k14_pw3*k33*k35_pw3 - 12*k11_pw3*k21*k31_pw4*k24_pw2*k16*k26 - 2*k11*k21_pw3*k14_pw2*k32_pw4*k16*k26 - 2*k11_pw2*k22_pw4*k31_pw3*k14*k16*k36 + 4*k11_pw3*k22_pw2*k31_pw4*k24*k16*k26 - 2*k21_pw4*k31*k14*k15_pw3*k33*k34_pw2 - 2*k21_pw4*k14_pw2*k32_pw3*k15*k16*k35 - 12*k21_pw4*k31*k14_pw3*k16*k34*k35_pw2- 6*k21_pw4*k14_pw3*k15*k33*k34*k35_pw2- 12*k21_pw4*k31*k14_pw3*k16*k34_pw2*k36 + 4*k21_pw4*k14_pw3*k32_pw2*k16*k34*k36 - 6*k21_pw4*k14_pw3*k15*k33*k34_pw2*k36 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k25_pw2 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k24_pw2*k33_pw2 + k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k25_pw2 + k11_pw2*k21_pw2*k31_pw2*k15_pw2*k24_pw2*k33_pw2 + 6*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k33_pw2*k25_pw2 + 6*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k35_pw2+ k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k35_pw2+ k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k34_pw2 + k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k35_pw2+ k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k34_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24_pw2*k36_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k35_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k34_pw2*k26_pw2+ 6*k11_pw2*k21*k13_pw2*k31_pw4*k24*k25_pw2 - 4*k11_pw2*k21*k22_pw2*k31_pw4*k24*k16_pw2 - 4*k11*k21_pw2*k13_pw2*k31_pw4*k24_pw2*k16 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k24_pw2*k33 - 2*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw3*k35 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k24_pw2*k26 + k11*k21_pw2*k14_pw2*k23_pw2*k32_pw4*k16 + 2*k11_pw2*k13_pw2*k22_pw2*k31_pw4*k24*k26 + k11_pw2*k22_pw4*k31_pw2*k14*k33_pw2*k16 - 2*k12*k21_pw3*k31_pw2*k23*k15_pw3*k34_pw2 + 4*k11_pw2*k22_pw3*k31_pw3*k23*k15_pw2*k35 - k11_pw3*k22_pw2*k31_pw3*k15*k33*k25_pw2 - k11_pw3*k31_pw3*k23_pw2*k15*k24_pw2*k33 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k34*k26_pw2- 2*k11_pw3*k31_pw3*k14*k23_pw2*k25_pw2*k34 - 2*k12_pw2*k21_pw3*k31_pw3*k24*k16_pw2*k34 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k25*k35_pw3 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k24*k34 + 4*k21_pw3*k13_pw2*k14_pw2*k32_pw3*k33*k25 - k21_pw3*k13*k14_pw3*k23*k32_pw2*k35_pw2- k21_pw3*k13*k14_pw3*k23*k33_pw2*k34_pw2 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k24*k36_pw2- 2*k11*k21_pw3*k14_pw3*k24*k33_pw2*k35_pw2- 2*k11_pw3*k22_pw2*k31_pw3*k14*k25_pw2*k36 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k24_pw2*k36 - 4*k21_pw4*k31*k14_pw2*k32_pw2*k16_pw2*k34 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k26*k35_pw2- 2*k11*k21_pw3*k14_pw3*k33_pw2*k34_pw2*k26 + 2*k12_pw4*k21_pw2*k31_pw2*k24*k26*k35_pw2- 4*k21_pw4*k31_pw2*k14*k15_pw2*k16*k34_pw2 + 2*k12_pw4*k21_pw2*k31_pw2*k25_pw2*k34*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k34*k35_pw2+ 6*k21_pw4*k31*k14_pw2*k15_pw2*k34_pw2*k36 + 2*k21_pw4*k14_pw2*k32_pw2*k15_pw2*k34*k36 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k34*k26_pw2+ k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25_pw2*k34 + 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k15_pw2*k34 + k11_pw3*k22_pw2*k31_pw2*k14*k32_pw2*k26_pw2+ k11_pw3*k22_pw2*k31_pw2*k14*k33_pw2*k25_pw2 + k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k25_pw2 + k11_pw3*k31_pw2*k14*k23_pw2*k24_pw2*k33_pw2 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25_pw2*k34 + k12_pw2*k21_pw2*k22_pw2*k31_pw3*k16_pw2*k34 + k12_pw2*k21_pw3*k31_pw2*k32_pw2*k24*k16_pw2 + k21_pw2*k13_pw2*k22_pw2*k31_pw3*k15_pw2*k34 + k21_pw3*k13_pw2*k31_pw2*k32_pw2*k15_pw2*k24 + k11*k21_pw2*k22_pw2*k14_pw3*k32_pw2*k36_pw2+ k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k35_pw2+ k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k35_pw2+ k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k34_pw2 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25_pw2*k36 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25_pw2*k34 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24_pw2*k36 + 6*k21_pw3*k13_pw2*k14_pw2*k32_pw2*k24*k33_pw2 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24_pw2*k36 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k35_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k35_pw2+ 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k34_pw2*k26 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k24*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k35_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k34_pw2*k26 + k12_pw2*k21_pw3*k14_pw2*k32_pw2*k26*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k34_pw2*k26 - 2*k11_pw2*k12*k21*k13*k31_pw3*k32*k25_pw3 + k11*k12*k21*k22_pw3*k31_pw3*k32*k16_pw2 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw4*k24*k16 + 2*k11_pw2*k21*k13*k31_pw4*k23*k24_pw2*k16 - 4*k11*k21_pw2*k22*k31*k14_pw3*k23*k35_pw3 - 2*k11*k21*k13*k22_pw3*k31_pw3*k15_pw2*k35 + k12*k21_pw3*k22*k31*k14*k32_pw3*k16_pw2 + 4*k11_pw2*k13_pw2*k22*k31_pw4*k23*k24*k25 - 6*k11_pw2*k13*k22_pw2*k31_pw4*k23*k24*k16 + 3*k11_pw3*k12*k22*k31_pw3*k32*k24*k26_pw2- 4*k11_pw3*k21*k31_pw2*k14*k32*k33*k25_pw3 + k21_pw2*k13_pw3*k22*k31_pw3*k32*k15*k24 - k11*k21_pw2*k13*k14_pw2*k23*k32_pw4*k26 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k32*k24*k25 - 4*k11_pw2*k22_pw3*k31_pw3*k23*k32*k15*k16 + k11_pw2*k12*k22_pw3*k31_pw3*k32*k16*k26 + k11_pw2*k12*k22_pw3*k31_pw3*k33*k16*k25 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k24*k34 + k11_pw2*k13*k22_pw3*k31_pw3*k32*k15*k26 + k11_pw2*k13*k22_pw3*k31_pw3*k15*k33*k25 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k24*k34 + 3*k11_pw3*k12*k31_pw3*k23*k24*k33*k25_pw2 + 3*k11_pw3*k12*k22*k31_pw3*k32*k25_pw2*k26 - 2*k11_pw3*k22*k31_pw3*k23*k32*k15*k25_pw2 + k21_pw3*k13*k22*k31_pw2*k32*k15_pw3*k34 - 2*k12*k21_pw3*k22*k31*k14_pw2*k15*k35_pw3 + 3*k11_pw3*k12*k31_pw3*k23*k24_pw2*k33*k26 + 6*k11_pw3*k21*k31_pw3*k15*k24*k33*k25_pw2 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k24*k34 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k24*k35 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k25*k34 - 2*k21_pw3*k13_pw2*k31*k14*k32_pw3*k15*k25 - 4*k21_pw3*k13*k22*k14_pw2*k32_pw3*k33*k16 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k24*k33*k34 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k24*k35 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k25*k34 + 12*k11*k21_pw3*k31_pw3*k14*k24*k16_pw2*k34 - 2*k12*k21_pw3*k13*k14_pw2*k24*k33_pw3*k34 - 8*k11_pw2*k22_pw3*k31_pw3*k14*k23*k16*k35 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k25*k36 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k26*k35 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k25*k36 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k26*k35 - 2*k11_pw3*k31_pw3*k23_pw2*k32*k15*k24*k25 + 12*k11_pw3*k21*k31_pw3*k14*k24*k34*k26_pw2+ 6*k11_pw3*k21*k31_pw3*k15*k24_pw2*k33*k26 - 4*k11_pw3*k22*k31_pw3*k14*k23*k25_pw2*k35 - 2*k21_pw3*k13*k22*k14_pw3*k32*k33*k35_pw2- 4*k11*k21_pw3*k31_pw3*k15_pw2*k24*k16*k34 - 8*k11*k21_pw3*k14_pw2*k32_pw3*k33*k16*k25 + 2*k11*k21_pw3*k14_pw2*k15*k24*k33_pw3*k34 - 4*k12*k21_pw3*k22*k31_pw2*k15_pw3*k34*k35 - k11_pw2*k22_pw4*k31_pw2*k14*k15*k33*k36 - 2*k11_pw3*k22_pw2*k31_pw3*k32*k15*k25*k26 - 2*k11_pw3*k22_pw2*k31_pw3*k15*k24*k33*k26 + 12*k11_pw3*k21*k31_pw3*k14*k25_pw2*k34*k26 + 12*k11_pw3*k21*k31_pw3*k14*k24*k25_pw2*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k24*k16*k34 + k21_pw3*k13*k14_pw2*k23*k32_pw3*k15*k35 + k21_pw3*k13*k22*k14_pw2*k32_pw3*k15*k36 + 6*k21_pw3*k13*k31*k14_pw3*k23*k34*k35_pw2- 4*k11*k21_pw3*k14_pw3*k32*k33*k25*k35_pw2+ 12*k11*k21_pw3*k31*k14_pw3*k24*k34*k36_pw2+ k12*k21_pw3*k14_pw2*k23*k32_pw3*k16*k35 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k25*k36 - 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k26*k35 + k12*k21_pw3*k22*k14_pw2*k32_pw3*k16*k36 + 3*k12*k21_pw3*k22*k14_pw3*k32*k34*k36_pw2- 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k25*k35 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k34*k26 + 12*k11_pw3*k21*k31_pw3*k14*k24_pw2*k26*k36 - 2*k21_pw3*k13*k22*k14_pw3*k33_pw2*k34*k35 + 6*k21_pw3*k13*k31*k14_pw3*k23*k34_pw2*k36 + 4*k21_pw4*k31*k14*k32_pw2*k15_pw2*k16*k34 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k25*k36 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k26*k35 + 12*k11*k21_pw3*k31*k14_pw3*k24*k35_pw2*k36 + 12*k11*k21_pw3*k31*k14_pw3*k34*k26*k35_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k33*k34*k35_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k32*k35_pw2*k36 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k24*k26*k36 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k25*k26*k35 - 2*k21_pw3*k13*k14_pw3*k23*k32_pw2*k34*k36 - 2*k21_pw3*k13*k22*k14_pw3*k32_pw2*k35*k36 + 2*k21_pw4*k31*k14_pw2*k15*k33*k16*k34_pw2 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k25*k34*k35 - 4*k11*k21_pw3*k14_pw3*k24*k33_pw2*k34*k36 + 12*k11*k21_pw3*k31*k14_pw3*k34_pw2*k26*k36 + 3*k12*k21_pw3*k14_pw3*k23*k33*k34_pw2*k36 - 6*k21_pw4*k14_pw2*k32_pw2*k15*k33*k16*k34 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k25*k35*k36 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k34*k26*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k25*k35*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k34*k26*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k25*k34*k26*k35 + 4*k21_pw4*k14_pw2*k32*k15_pw2*k33*k34*k35 + 2*k11_pw2*k12_pw2*k21*k31_pw2*k32*k33*k25_pw3 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k33*k25_pw2 - k11_pw2*k12*k13*k31_pw3*k23_pw2*k24_pw2*k33 - 2*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k34_pw2 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k32_pw2*k24 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k15*k24_pw2*k33 - 2*k11_pw2*k21_pw2*k31*k14*k15*k24_pw2*k33_pw3 - k11_pw2*k13*k22_pw3*k31_pw2*k14*k33_pw2*k25 + 2*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k35_pw3 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k32_pw2*k24 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k32_pw2*k25 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25_pw2*k34 - k11*k21_pw2*k22_pw2*k31_pw2*k15_pw3*k33*k34 - k11*k21_pw2*k22_pw2*k31_pw2*k32*k15_pw3*k35 - 6*k11*k21_pw2*k22_pw2*k31_pw3*k14*k16_pw2*k34 - 6*k11*k21_pw3*k31_pw2*k14*k32_pw2*k24*k16_pw2 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k34*k26_pw2+ 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25_pw2*k35 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k24*k34 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k24*k26_pw2- 6*k11_pw3*k21*k31_pw2*k14*k24*k33_pw2*k25_pw2 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25_pw2*k34 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24_pw2*k36 + 2*k11*k21_pw2*k22_pw2*k31_pw3*k15_pw2*k16*k34 - k11*k21_pw2*k22_pw2*k14_pw2*k15*k33_pw3*k34 - 2*k11*k21_pw3*k31_pw2*k32_pw2*k15_pw2*k24*k16 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw2*k34*k26 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k15*k24_pw2*k33*k16 + 8*k11_pw2*k21_pw2*k14_pw2*k32*k24*k33_pw3*k25 - 12*k11_pw2*k22_pw2*k31_pw3*k14*k23_pw2*k16*k34 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k24*k36 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k25*k35 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k34*k26 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k25_pw2*k26 - 6*k11_pw3*k21*k31_pw2*k14*k24_pw2*k33_pw2*k26 - 2*k21_pw2*k13_pw2*k22_pw2*k31_pw3*k14*k16*k34 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25_pw2*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25_pw2*k34 + 2*k21_pw3*k13_pw2*k31_pw2*k14*k32_pw2*k24*k16 + 2*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k34_pw2 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k24_pw2*k16*k36 - 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k34*k36_pw2- k11*k21_pw2*k14_pw2*k23_pw2*k32_pw3*k15*k35 - 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34*k35_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k35_pw2- 12*k11*k21_pw3*k14_pw2*k32_pw2*k24*k33_pw2*k16 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k25*k35 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k34*k26 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24_pw2*k26*k36 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25_pw2*k34 + 8*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k34*k35 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k24*k33_pw2*k26 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k24*k26 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k25*k35 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k34*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k35_pw2- 2*k12_pw3*k21_pw2*k13*k31_pw2*k24_pw2*k33*k36 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k35_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k24*k33_pw2*k34 - 6*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k34_pw2 - 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k35_pw2*k36 - 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k35_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k34_pw2*k26 - k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k35_pw2- k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k34_pw2 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k24*k26*k36 + 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k25*k35 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k34*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k24_pw2*k16*k36 + 8*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k33*k25*k26 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k35_pw2- 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k34_pw2*k26 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k24*k36 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k25*k35 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k34*k26 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k34*k36 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k34*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k34_pw2*k26 + 8*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k35*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k34_pw2*k26 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k35_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k34*k36_pw2+ 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k34*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k34*k35 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k35_pw2*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k34*k26*k35_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k34*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k34*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k34*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k34*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k34_pw2*k26*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k34*k26*k36 - 4*k11*k21*k13_pw3*k22*k31_pw4*k24*k25 - 12*k11_pw3*k13*k22*k31_pw4*k24*k25*k26 + 8*k11_pw3*k22*k31_pw4*k23*k24*k16*k25 - 4*k21_pw4*k31*k14*k32*k15_pw3*k34*k35 + 8*k21_pw4*k14_pw3*k32*k33*k16*k34*k35 - 12*k21_pw4*k14_pw3*k32*k15*k34*k35*k36 - 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k25_pw2 - 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k24_pw2*k33_pw2 + 3*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k16_pw2 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k24*k26_pw2+ 3*k11_pw2*k12_pw2*k21*k31_pw2*k24*k33_pw2*k25_pw2 - 2*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k16*k25_pw2 - 2*k11*k12_pw2*k21_pw2*k31_pw2*k24_pw2*k33_pw2*k16 + k11*k21_pw2*k22_pw2*k31_pw2*k32_pw2*k15_pw2*k16 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k25_pw2*k26 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k24_pw2*k33_pw2*k26 + 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k16 + k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k36_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k35_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k34_pw2*k26_pw2- 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k35_pw2+ 6*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw2*k33_pw2*k16 - 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k34_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k16*k25_pw2 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k24_pw2*k33_pw2*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k24*k36_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k35_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k24*k26 + 6*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k35_pw2+ 6*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k34_pw2 + 2*k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k24*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k34*k26_pw2- 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25_pw2*k34 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k26*k35_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k34_pw2*k26 - 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k35_pw2- 2*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k34_pw2 + 12*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k24*k33_pw2*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25_pw2*k36 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k24_pw2*k33_pw2*k36 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k34*k36_pw2+ 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34*k35_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k26*k35_pw2+ 12*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k34*k36 + 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k34*k36 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k35_pw2*k36 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34_pw2*k36 + 2*k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k34*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k34*k36 - k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k25_pw2 - k11*k12_pw2*k21*k13*k31_pw2*k23*k24_pw2*k33_pw2 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k24*k33_pw2 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k24 - k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k25_pw2 - k11_pw2*k12*k21*k31_pw2*k23*k15*k24_pw2*k33_pw2 + k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k25_pw2 + k11_pw2*k21*k13*k31_pw2*k14*k23*k24_pw2*k33_pw2 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k24*k33_pw2*k16 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k32_pw2*k24*k16 - k11*k21_pw2*k13*k31_pw2*k23*k32_pw2*k15_pw2*k24 - k11*k21_pw2*k13*k22*k31_pw2*k32_pw2*k15_pw2*k25 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32_pw2*k26 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k35_pw2- 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k24*k33_pw2 - 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32_pw2*k25 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k32_pw2*k16*k26 - 6*k11*k21_pw2*k13*k14_pw2*k23*k32_pw2*k24*k33_pw2 - 6*k11*k21_pw2*k13*k22*k14_pw2*k32_pw2*k33_pw2*k25 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k32_pw2*k15*k24 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k32_pw2*k15*k25 + k12*k21_pw2*k13*k22_pw2*k31_pw2*k32_pw2*k15*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k24*k33_pw2*k16 - 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32_pw2*k24*k16 - 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32_pw2*k26 - k12_pw2*k21_pw2*k13*k31_pw2*k23*k32_pw2*k24*k16 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k32_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k24*k26 + 2*k11*k21_pw2*k22_pw2*k31*k14*k15_pw2*k33_pw2*k34 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k35_pw2+ 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k35_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k32_pw2*k15_pw2*k34 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k15_pw2*k33*k34 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k32*k15_pw2*k35 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k35_pw2- k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k34_pw2 - 6*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k33*k25_pw2 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32_pw2*k16*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k35_pw2+ 4*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k24*k33*k25 + 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k35_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k24*k16*k26 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25_pw2*k35 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25_pw2*k34 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k33_pw2*k16*k34 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k35_pw2+ 2*k11*k21_pw2*k22_pw2*k31*k14*k32_pw2*k15_pw2*k36 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k34_pw2*k26 - 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32_pw2*k16*k34 + k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k34_pw2 + 4*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k24*k33*k25 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32*k15*k35 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k15*k33*k34 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k33_pw2*k16*k34 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k34_pw2*k26 + k12_pw2*k21_pw2*k31*k14*k23_pw2*k32_pw2*k16*k34 - k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k34_pw2 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32*k15*k35 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k15*k33*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k26*k35_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24_pw2*k33*k36 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32*k15*k33_pw2*k35 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32_pw2*k16*k36 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw2*k15*k33*k34 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k24*k16*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25_pw2*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25_pw2*k34 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25_pw2*k35 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k32*k15*k16*k35 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15*k33*k16*k34 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k32_pw2*k16*k36 + 4*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k34*k35 + 4*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k34*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k34*k36 - 4*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k34*k36 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32_pw2*k15*k33*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24_pw2*k33*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k25*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k34*k26 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k34*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k34*k35 + 12*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k34*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k24*k26*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25*k26*k35 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k35*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k34*k26*k36 - 4*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k34*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k35*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k34*k26*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k34*k26*k35 + 2*k11*k21*k13*k22_pw3*k31_pw3*k32*k15*k16 + 4*k11_pw2*k21*k13*k22*k31_pw4*k24*k16*k25 + 4*k11*k21*k13*k22_pw3*k31_pw3*k14*k16*k35 + 2*k21_pw3*k13*k22*k31*k14*k32_pw3*k15*k16 + 4*k11*k21_pw3*k31*k14*k32_pw3*k15*k16*k25 + 6*k11_pw3*k12*k31_pw3*k23*k32*k24*k25*k26 + 6*k11_pw3*k12*k22*k31_pw3*k24*k33*k25*k26 - 4*k11_pw3*k22*k31_pw3*k23*k32*k15*k24*k26 - 4*k11_pw3*k22*k31_pw3*k23*k15*k24*k33*k25 + 8*k12*k21_pw3*k13*k31_pw3*k15*k24*k16*k34 + 12*k11_pw3*k21*k31_pw3*k32*k15*k24*k25*k26 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k25*k36 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k26*k35 - 8*k11_pw3*k22*k31_pw3*k14*k23*k25*k34*k26 + 24*k11_pw3*k21*k31_pw3*k14*k24*k25*k26*k35 - 4*k21_pw3*k13*k14_pw3*k23*k32*k33*k34*k35 - 4*k21_pw3*k13*k22*k14_pw3*k32*k33*k34*k36 + 12*k21_pw3*k13*k22*k31*k14_pw3*k34*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k24*k33*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k25*k34*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k34*k26*k35 + 4*k21_pw4*k31*k14_pw2*k32*k15*k16*k34*k35 + 24*k11*k21_pw3*k31*k14_pw3*k25*k34*k35*k36 + 6*k12*k21_pw3*k14_pw3*k23*k32*k34*k35*k36 + 6*k12*k21_pw3*k22*k14_pw3*k33*k34*k35*k36 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k25_pw2 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k24_pw2*k33 + k11_pw2*k12*k21*k22*k31*k14*k32_pw3*k26_pw2+ k11_pw2*k12*k21*k31*k14*k23*k24_pw2*k33_pw3 - 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k25_pw2 - k11*k12*k21_pw2*k22*k31_pw3*k32*k24*k16_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k24*k33*k25_pw2 - k11_pw2*k12*k21*k22*k31_pw3*k32*k16*k25_pw2 - k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k25_pw2*k34 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k25_pw2*k35 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32*k24*k33_pw3 + 4*k11*k12*k21_pw2*k13*k31_pw3*k24_pw2*k33*k16 + k11*k12*k21*k22_pw3*k31*k14_pw2*k32*k36_pw2+ k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k34_pw2 - 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k32*k15*k25 - 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k15*k24*k33 - 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k15_pw2*k34 - k11_pw2*k12*k21*k31_pw3*k23*k24_pw2*k33*k16 - 6*k11_pw2*k12*k21*k13*k31_pw3*k24_pw2*k33*k26 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k24*k25 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k32*k24*k16 - k11_pw2*k21*k13*k31_pw3*k23*k15*k24_pw2*k33 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k32*k15*k24 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k24_pw2*k36 - 2*k11*k21_pw2*k22*k31_pw2*k23*k32*k15_pw3*k34 + k11*k12_pw3*k21*k22*k31_pw2*k32*k34*k26_pw2- 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k25_pw2*k34 + k11*k12*k21*k22_pw3*k31_pw2*k15_pw2*k33*k35 + k11*k12*k21*k22_pw3*k31_pw2*k32*k15_pw2*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k24*k34 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k32*k24*k16 + k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw3*k26 + k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw3*k25 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k32*k16*k25 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k24*k33*k16 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k25_pw2*k34 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k25_pw2*k35 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k25*k26 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k24*k33*k26 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k25_pw2*k34 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k25_pw2*k35 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k32*k15*k25 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k15*k24*k33 - 2*k21_pw2*k13_pw3*k22*k31_pw2*k14*k32*k24*k33 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k24*k25 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k24*k34 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32_pw3*k33*k25 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k24*k35 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k25*k34 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32_pw3*k33*k26 + 8*k11*k21_pw2*k22*k14_pw2*k23*k32_pw3*k33*k16 + k11*k12_pw3*k21*k31_pw2*k23*k32*k25_pw2*k35 + k11*k12_pw3*k21*k31_pw2*k23*k33*k25_pw2*k34 + k11*k12_pw3*k21*k22*k31_pw2*k32*k25_pw2*k36 + k11*k12_pw3*k21*k22*k31_pw2*k33*k25_pw2*k35 + k11*k12*k21_pw2*k14_pw2*k23*k24*k33_pw3*k34 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k24_pw2*k36 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k25*k34 + k11*k12*k21_pw2*k22*k14_pw2*k24*k33_pw3*k35 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k24*k36 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k25*k35 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k34*k26 + 8*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32*k33*k16 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k24*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k25*k34 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k24*k33*k34 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k24_pw2*k36 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k24*k35 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k25*k34 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k32*k15*k16*k25 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k15*k24*k33*k16 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k24_pw2*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k24*k35 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k25*k34 - 2*k11_pw2*k13*k22_pw3*k31_pw2*k14*k32*k33*k26 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k24*k35 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k25*k34 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32*k15*k34 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32*k33*k25_pw2 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k35_pw2+ k11*k12_pw3*k21*k31_pw2*k23*k24_pw2*k33*k36 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k24*k34 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k24*k35 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k25*k34 - k12*k21_pw3*k22*k31_pw2*k14*k32*k16_pw2*k34 + 3*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k35_pw2- 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k24*k36 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k25*k35 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k34*k26 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k24*k16*k34 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k24*k36 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k25*k35 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k34*k26 + 4*k11_pw3*k22*k31_pw2*k14*k23*k24*k33_pw2*k25 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k24*k16*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k24*k16*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k25*k34 + k12_pw3*k21_pw2*k22*k31*k14*k32*k24*k36_pw2- 6*k21_pw3*k13_pw2*k31*k14*k32_pw2*k15*k24*k33 - k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k35_pw2- 2*k21_pw3*k13*k22*k31*k14*k32_pw2*k15_pw2*k35 - 2*k21_pw3*k13*k31*k14*k23*k32_pw2*k15_pw2*k34 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k25*k35 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k34*k26 - 2*k11*k21_pw2*k22*k14_pw2*k23*k32_pw3*k15*k36 - 4*k11*k21_pw3*k31*k14*k15_pw2*k24*k33_pw2*k34 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k25*k36 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k26*k35 + k11*k12*k21_pw2*k22*k14_pw2*k32_pw3*k26*k36 - 4*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k35*k36 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k24*k33*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k35_pw2- 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k24*k35 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k25*k34 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k35_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k35_pw2+ 3*k12*k21_pw3*k22*k31_pw2*k32*k15_pw2*k16*k34 - k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k35_pw2+ 3*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k34_pw2 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k25*k36 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k26*k35 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25*k34*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k32*k15*k24*k16*k25 - 4*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k25*k26 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k32*k15*k36 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k15*k33*k35 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k32*k26*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k25*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k26*k35 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k24*k16*k36 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k25*k35 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k34*k26 + 4*k11_pw3*k31_pw2*k14*k23_pw2*k32*k24*k33*k25 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k25*k26 + k12_pw3*k21_pw2*k22*k31*k14*k32*k26*k35_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k35_pw2+ 3*k21_pw3*k13*k22*k14_pw2*k32*k15*k33_pw2*k34 + 4*k21_pw3*k13*k22*k31*k14_pw2*k32_pw2*k16*k35 + 4*k21_pw3*k13*k31*k14_pw2*k23*k32_pw2*k16*k34 - k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k34_pw2 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k25*k35 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k34*k26 + 4*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k34*k35 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k35_pw2- 2*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k35_pw2+ 8*k11*k21_pw3*k31*k14_pw2*k24*k33_pw2*k16*k34 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k24*k36 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k25*k35 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k34*k26 + 4*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k34_pw2 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k34_pw2*k26 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k25*k34 - 6*k12*k21_pw3*k13*k14_pw2*k32*k24*k33_pw2*k35 + 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k34_pw2*k26 + 3*k12*k21_pw3*k22*k14_pw2*k32*k33_pw2*k16*k34 - 2*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k35_pw2- k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k34_pw2 - 12*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25*k26*k35 + 4*k11_pw3*k22_pw2*k31_pw2*k14*k32*k33*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k35_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k35_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k24*k16*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k25*k34 + k12_pw3*k21_pw2*k31_pw2*k23*k24*k33*k16*k34 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k25*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k26*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25*k34*k26 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k25*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k34*k26 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k24*k16*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k25*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k34*k26 + k12_pw3*k21_pw2*k22*k31_pw2*k24*k33*k16*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k25*k34 + k12_pw3*k21_pw2*k31*k14*k23*k33*k34_pw2*k26 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k24*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k25*k34 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k24*k33*k34 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k24*k33*k35 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k25*k34 + 3*k21_pw3*k13*k14_pw2*k23*k32_pw2*k15*k33*k34 + 4*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k34*k35 + 3*k21_pw3*k13*k22*k14_pw2*k32_pw2*k15*k33*k35 + 4*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k34*k35 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k35*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k25*k34 + 6*k11*k21_pw3*k14_pw2*k32*k15*k24*k33_pw2*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k24*k16*k36 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k25*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k34*k26 - 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k34_pw2*k26 + 3*k12*k21_pw3*k14_pw2*k23*k32_pw2*k33*k16*k34 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k24*k33*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k25*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k34*k26 + 3*k12*k21_pw3*k22*k14_pw2*k32_pw2*k33*k16*k35 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k34*k35_pw2- 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k25*k35 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k34*k26 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k24*k16*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k25*k34 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k24*k33*k16*k34 - 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k34_pw2*k26 - 12*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k34*k35 + 4*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k34*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k34*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k24*k33*k36 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k25*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k34*k26 - 2*k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k34*k35 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k34_pw2*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k34*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k34*k35 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k35*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k34*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k34*k26*k35 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k34*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k34*k35 - 2*k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k34*k36 - 2*k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k34*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k34*k35 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k35*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k34*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k34*k26*k35 - 12*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34*k35*k36 - k11*k12*k21*k13*k22_pw2*k31*k14*k24*k33_pw3 - k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw3*k25 + 3*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw3*k16 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k24*k25 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k24*k26 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k24*k33*k25 + 3*k11*k12*k21*k22_pw3*k31*k14*k32*k33_pw2*k16 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k32*k16*k25 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k24*k33*k16 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k32*k15*k24 + 2*k11_pw2*k12*k21*k22*k31*k14*k24*k33_pw3*k25 - 2*k11*k12*k21*k22_pw3*k31_pw2*k32*k15*k33*k16 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k24*k34 - k11*k12*k21*k31*k14*k23_pw3*k32_pw2*k15*k34 - 4*k11*k21*k13*k22_pw3*k31_pw2*k14*k32*k33*k16 - 2*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw3*k16 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k24*k26 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k24*k33*k25 - 2*k11*k21_pw2*k13*k22*k31_pw3*k32*k15*k24*k16 + 2*k11*k21_pw2*k13*k22*k31*k14*k32_pw3*k15*k26 + 2*k11*k21_pw2*k13*k31*k14*k23*k32_pw3*k15*k25 - 4*k11*k21_pw2*k22*k31*k14*k23*k32_pw3*k15*k16 + 8*k11*k12*k21_pw2*k13*k31_pw3*k32*k24*k16*k25 - 2*k11*k12*k21_pw2*k22*k31*k14*k32_pw3*k16*k26 - 2*k11*k12*k21_pw2*k31*k14*k23*k32_pw3*k16*k25 - k11*k12*k21*k22_pw3*k31*k14*k15*k33_pw2*k35 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k24*k36 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k25*k35 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k34*k26 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k24*k35 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k25*k34 + 12*k11*k21*k13*k22_pw2*k31_pw3*k14*k23*k16*k34 - 2*k11_pw2*k12*k21*k31_pw3*k23*k32*k24*k16*k25 - 12*k11_pw2*k12*k21*k13*k31_pw3*k32*k24*k25*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k32*k24*k16*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k24*k33*k16*k25 + 2*k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k25*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k24*k25 - 2*k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k24*k26 - 2*k11_pw2*k21*k13*k22*k31_pw3*k15*k24*k33*k25 + 8*k11_pw2*k21*k22*k31_pw3*k23*k32*k15*k24*k16 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k25*k35 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k34*k26 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k25*k36 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k26*k35 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k25*k34*k26 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k32*k16*k36 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k33*k16*k35 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k34*k35 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k32*k15*k36 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k15*k33*k35 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k24*k16*k34 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k24*k16*k35 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k25*k34 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k24*k16*k34 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k25*k35 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k34*k26 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k24*k16*k35 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k25*k34 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k25*k35 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k34*k26 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k25*k36 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k26*k35 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k25*k34*k26 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k25*k35 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k34*k26 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k25*k36 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k26*k35 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k25*k34*k26 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k24*k16*k35 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k25*k34 - 4*k21_pw3*k13*k22*k31*k14*k32*k15_pw2*k33*k34 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k25*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k26*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k25*k34*k26 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k25*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k34*k26 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k24*k26*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k25*k26*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k25*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k26*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k33*k25*k34*k26 + 12*k11*k21_pw3*k31*k14*k32_pw2*k15*k24*k33*k16 + 2*k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k35*k36 + 4*k12*k21_pw3*k13*k31*k14*k15*k24*k33_pw2*k34 + 8*k11_pw3*k22*k31_pw2*k14*k23*k32*k24*k33*k26 - 2*k21_pw3*k13*k22*k31_pw2*k14*k32*k15*k16*k34 + 8*k21_pw3*k13*k22*k31*k14_pw2*k32*k33*k16*k34 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k24*k33*k35 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k25*k34 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k24*k16*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k25*k34 - 4*k12*k21_pw3*k13*k31_pw2*k14*k24*k33*k16*k34 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k24*k36 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k25*k35 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k34*k26 - 4*k12*k21_pw3*k22*k31*k14*k32_pw2*k15*k16*k35 - 4*k12*k21_pw3*k31*k14*k23*k32_pw2*k15*k16*k34 - 24*k11_pw3*k21*k31_pw2*k14*k32*k24*k33*k25*k26 + 8*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k34*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k24*k16*k35 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k25*k34 - 4*k11*k21_pw3*k31_pw2*k14*k15*k24*k33*k16*k34 + 16*k11*k21_pw3*k31*k14_pw2*k32*k24*k33*k16*k35 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k25*k34 + 6*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k34*k35 + 6*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k34*k36 + 6*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k34*k35 - 2*k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k34*k36 - 2*k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k34*k35 - 2*k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k34*k35 - 24*k11*k21_pw2*k22*k31*k14_pw3*k23*k34*k35*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k34*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k34*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k34*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k34*k26*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k34*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k34*k35 + 8*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k34*k35 - 2*k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k34*k36 - 2*k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k34*k35 - 2*k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k34*k26*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k34*k26*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k34*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k34*k26*k35 + 2*k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k34*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k34*k35 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k34*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k34*k26*k35 - 4*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k34*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k34*k35 - 4*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k34*k35 - 4*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k34*k26*k35 - 4*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k34*k35 - 12*k12*k21_pw3*k22*k31*k14_pw2*k15*k34*k35*k36 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k33*k25_pw2 + k11*k12*k21*k13*k22_pw2*k31_pw2*k15*k24*k33_pw2 + k11*k12*k21*k13*k31_pw2*k23_pw2*k32_pw2*k15*k24 + 3*k11_pw2*k12*k21*k22*k31*k14*k32*k33_pw2*k25_pw2 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k24*k33_pw2*k25 - 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k32_pw2*k15*k16 + k11*k12*k21*k13*k22_pw2*k31_pw2*k32_pw2*k15*k26 + 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k32*k15_pw2*k34 + 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k35_pw2+ 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32_pw2*k25 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32_pw2*k16 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k33*k25_pw2 + 3*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k33*k25_pw2 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k33*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k24*k26 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k32_pw2*k16*k25 - 2*k11*k21_pw2*k13*k22*k31_pw2*k32*k15_pw2*k24*k33 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k15_pw2*k33*k34 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k32*k15_pw2*k35 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k35_pw2+ 4*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32*k33*k25 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32*k24*k33_pw2 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k34*k26_pw2- 2*k11_pw2*k12*k21*k22*k31_pw2*k15*k24*k33_pw2*k25 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k24*k33_pw2*k25 - 6*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32*k24*k33 + 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k33*k16*k25 + k11*k12_pw2*k21*k31*k14*k23_pw2*k24*k33_pw2*k34 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k32_pw2*k24*k16 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k32_pw2*k16*k25 + 2*k11*k12*k21_pw2*k31_pw2*k23*k32_pw2*k15*k24*k16 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25_pw2*k35 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25_pw2*k34 + 2*k11*k12*k21_pw2*k22*k31_pw2*k32_pw2*k15*k16*k25 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k24*k36_pw2- 2*k12*k21_pw2*k13_pw2*k22*k31_pw2*k32*k15*k24*k33 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw2*k33*k25 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw2*k24*k33 - 3*k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw2*k33*k16 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k32*k15_pw2*k34 - 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k35_pw2- 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25_pw2*k35 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25_pw2*k34 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k24*k26 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k25*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25_pw2*k36 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25_pw2*k35 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k24*k26 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k25*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32_pw2*k16*k25 - 6*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32*k33*k25 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k24*k33*k16 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k25*k35 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k34*k26 + k11*k12_pw2*k21*k22_pw2*k31*k14*k24*k33_pw2*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k24*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k25*k34 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k24*k33*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k24*k36 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k25*k35 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k34*k26 - 8*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k24*k33*k25 - 6*k11*k21_pw2*k22_pw2*k31*k14*k32_pw2*k15*k33*k16 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k25*k34 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k24*k33_pw2*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k24*k33_pw2*k34 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k35_pw2+ 4*k11*k21_pw2*k22*k31*k14*k23*k32_pw2*k15_pw2*k35 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k35_pw2- k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k24*k33*k34 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k24*k35 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k25*k34 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k24_pw2*k33*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k24*k33*k35 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k25*k34 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k35_pw2- k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k24*k36 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k25*k35 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k34*k26 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k26*k35_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k35_pw2- 12*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k34*k35 + k12*k21_pw2*k13*k22_pw2*k31*k14*k15*k33_pw2*k34 + k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw2*k15*k34 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k24_pw2*k33*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k24*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k25*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k34*k26 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k24*k33*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k25*k34 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k33*k16*k25 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k25*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k24*k33_pw2*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k24*k33_pw2*k34 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k35_pw2- 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32*k15*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k32*k24*k33*k16*k25 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k25*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k26*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k24*k33*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k25*k35 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k34*k26 + k11*k12_pw2*k21*k22_pw2*k31*k14*k32_pw2*k26*k36 + 4*k11*k21_pw2*k22_pw2*k31*k14*k32*k15_pw2*k33*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k25*k36 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k26*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k24*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k25*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k34*k26 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32*k15*k33_pw2*k34 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k32_pw2*k16*k35 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k34_pw2*k26 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k25*k34 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k24*k33_pw2*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k25*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k34*k26 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k24*k33_pw2*k36 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k34_pw2*k26 - 12*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k34*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k24*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k25*k34 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k24*k33*k34 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k24*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k25*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k34*k26 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k24*k33*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k25*k34 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k32*k16*k35 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k33*k16*k34 + k12*k21_pw2*k13*k22_pw2*k31*k14*k32_pw2*k15*k36 + 12*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24*k33*k25*k26 - 12*k11_pw2*k21_pw2*k31*k14*k32*k15*k24*k33_pw2*k25 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k25*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k26*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k24*k33*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k25*k35 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k34*k26 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k24*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k25*k34 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k24*k33*k34 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k24*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k25*k34 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k24*k33*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k24*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k25*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k34*k26 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k24*k33*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k25*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k25*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k26*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k24*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k25*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k34*k26 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k32*k15*k16*k34 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32_pw2*k16*k35 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32*k15*k16*k35 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15*k33*k16*k34 - 8*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k33*k16*k35 - 8*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k34*k35 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32_pw2*k15*k33*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k24*k33*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k25*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k34*k26 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k25*k36 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k26*k35 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k34*k35 + 24*k11_pw2*k21_pw2*k31_pw2*k14*k32*k24*k33*k16*k25 - 12*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k24*k33*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k25*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k26*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k24*k33*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k25*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k34*k26 + 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k33*k16*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k25*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k26*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25*k34*k26 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k25*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k34*k26 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k34*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k34*k35 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k35*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k34*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k34*k26*k35 + 24*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k34*k35 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k34*k35 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k35*k36 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k34*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k35*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k34*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k34*k26*k35 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k34*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k34*k35 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k35*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k34*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k34*k26*k35 - 8*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k34*k35 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k34*k35 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k35*k36 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k34*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k25*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25*k34*k26 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k25*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k34*k26 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k25*k36 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k26*k35 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25*k34*k26 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k35*k36 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k34*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k35*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k34*k26*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k34*k26*k35 + 12*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34*k35*k36 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32*k33_pw2*k25 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k32_pw2*k15*k25 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw2*k24*k33 + 9*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw2*k33*k16 + 2*k11*k12*k21*k13*k22_pw2*k31_pw2*k32*k15*k33*k25 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32_pw2*k33*k26 + 8*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32*k24*k33 - 4*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k24*k33*k25 - 4*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k24*k33*k26 + 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k24*k33*k16 + 6*k11*k21_pw2*k13*k22*k31*k14*k32*k15*k24*k33_pw2 - 6*k11*k12*k21_pw2*k22*k31*k14*k32*k24*k33_pw2*k16 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k15*k33_pw2*k34 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k32*k16*k34 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw2*k15*k35 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32*k15*k34 + 6*k11_pw2*k12*k21*k22*k31*k14*k32*k24*k33_pw2*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32*k24*k33_pw2*k25 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k25*k34 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k24*k33_pw2*k35 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k24*k33*k16 + 6*k11*k21_pw2*k13*k22*k31*k14*k32_pw2*k15*k33*k25 + 6*k11*k21_pw2*k13*k31*k14*k23*k32_pw2*k15*k24*k33 + 4*k11*k12*k21_pw2*k22*k31_pw2*k32*k15*k24*k33*k16 - 6*k11*k12*k21_pw2*k22*k31*k14*k32_pw2*k33*k16*k25 - 6*k11*k12*k21_pw2*k31*k14*k23*k32_pw2*k24*k33*k16 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k32*k16*k35 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k33*k16*k34 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k32_pw2*k15*k36 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32*k15*k35 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k15*k33*k34 - 4*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k24*k33*k25 - 4*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k24*k33*k26 + 6*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k33*k25*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k24*k33*k26 + 4*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k24*k33*k25 + 4*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k24*k33*k26 - 16*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k24*k33*k16 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k24*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k25*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k34*k26 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k24*k33*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k25*k34 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k25*k36 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k26*k35 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k24*k33*k35 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k25*k34 + 8*k11*k21_pw2*k22*k31*k14*k23*k32*k15_pw2*k33*k34 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k34*k36 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k34*k35 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k32*k16*k34 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw2*k15*k35 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k25*k36 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k26*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k24*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k25*k34 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k24*k33*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k24*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k25*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k34*k26 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k24*k33*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k25*k34 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k24*k33*k36 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k25*k35 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k34*k26 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k24*k33*k35 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k25*k34 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k32*k15*k16*k34 - 16*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k33*k16*k34 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k24*k16*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k25*k34 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k24*k33*k16*k34 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k25*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k26*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25*k34*k26 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k25*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k34*k26 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k24*k16*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k25*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k34*k26 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k24*k33*k16*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k25*k34 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k35*k36 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k34*k36 + 2*k12*k21_pw2*k13*k22_pw2*k31*k14*k32*k15*k33*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k25*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k26*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25*k34*k26 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k25*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k34*k26 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k24*k26*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25*k26*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k25*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k26*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25*k34*k26 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k24*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k25*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k34*k26 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k24*k33*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k25*k34 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k24*k33*k36 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k25*k35 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k34*k26 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k24*k33*k35 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k25*k34 + 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k33*k16*k34 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k34*k36 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k34*k35 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k34*k36 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k34*k35 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k34*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k34*k35 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k35*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k34*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k34*k26*k35 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k34*k26*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k34*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k34*k26*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k34*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k34*k26*k35 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k34*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k34*k35 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k34*k36 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k34*k35 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k32*k24*k16 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw3*k26 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k24*k35 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k25*k34 - 2*k11*k12*k21*k22_pw3*k31*k14*k32*k15*k33*k36 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k24*k33*k35 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k25*k34 - 8*k12*k21_pw3*k22*k31*k14*k32*k15*k33*k16*k34 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32*k24*k33_pw2 + 4*k11*k12*k21*k13*k22*k31_pw2*k23*k32*k15*k24*k33 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw2*k33*k25 - 6*k11*k12*k21*k22*k31*k14*k23_pw2*k32*k15*k33*k34 - 6*k11*k12*k21*k22_pw2*k31*k14*k23*k32*k15*k33*k35 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k24*k33*k36 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k25*k35 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k34*k26 + 4*k12*k21_pw2*k13*k22*k31*k14*k23*k32*k15*k33*k34);
 
     // x^3
-    coeffs.at(3) = (4*k11_pw4*k31_pw4*k25_pw3*k26 + 4*k21_pw4*k14_pw4*k35_pw3*k36 - 2*k11_pw3*k13*k31_pw4*k23*k25_pw3 - 4*k11_pw3*k21*k31_pw4*k16*k25_pw3 + 2*k21_pw2*k13_pw4*k31_pw4*k24*k25 + 12*k11_pw4*k31_pw4*k24*k25*k26_pw2- 4*k21_pw4*k31*k14_pw3*k16*k35_pw3 + 2*k21_pw4*k31_pw2*k15_pw4*k34*k35 - 2*k21_pw4*k14_pw3*k15*k33*k35_pw3 + 12*k21_pw4*k14_pw4*k34*k35*k36_pw2+ 2*k11_pw2*k21*k13_pw2*k31_pw4*k25_pw3 + 4*k11_pw2*k22_pw3*k31_pw4*k23*k16_pw2 + 4*k21_pw4*k14_pw2*k32_pw3*k33*k16_pw2 + 2*k21_pw4*k31*k14_pw2*k15_pw2*k35_pw3 - 2*k11*k21*k13_pw3*k22*k31_pw4*k25_pw2 - 2*k11*k21*k13*k22_pw3*k31_pw4*k16_pw2 + k11_pw3*k12*k31_pw3*k23*k33*k25_pw3 + 2*k11_pw3*k21*k31_pw3*k15*k33*k25_pw3 - 6*k11_pw3*k13*k22*k31_pw4*k24*k26_pw2- 2*k21_pw2*k13_pw3*k22*k31_pw4*k24*k16 - 2*k11_pw2*k13*k22_pw3*k31_pw4*k16*k26 - 6*k11_pw3*k13*k22*k31_pw4*k25_pw2*k26 + 4*k11_pw3*k22*k31_pw4*k23*k16*k25_pw2 + 2*k21_pw3*k13*k31*k14_pw3*k23*k35_pw3 + 4*k11_pw3*k21*k31_pw3*k14*k25_pw3*k36 - 2*k21_pw4*k31*k14*k32_pw3*k15*k16_pw2 + 4*k11*k21_pw3*k31*k14_pw3*k26*k35_pw3 + k12*k21_pw3*k14_pw3*k23*k33*k35_pw3 + 4*k11_pw3*k31_pw4*k23_pw2*k24*k16*k25 - 2*k21_pw4*k31*k14*k32*k15_pw3*k35_pw2+ 4*k11_pw3*k22_pw2*k31_pw4*k16*k25*k26 - 2*k21_pw4*k31_pw2*k32*k15_pw3*k16*k34 + 4*k21_pw4*k14_pw3*k32*k33*k16*k35_pw2- 2*k21_pw4*k14_pw2*k32_pw3*k15*k16*k36 - 6*k21_pw4*k14_pw3*k32*k15*k34*k36_pw2+ 4*k21_pw4*k14_pw3*k33_pw2*k16*k34*k35 - 6*k21_pw4*k14_pw3*k32*k15*k35_pw2*k36 + 4*k21_pw4*k14_pw3*k32_pw2*k16*k35*k36 + 2*k11_pw2*k13_pw2*k22*k31_pw4*k23*k25_pw2 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k32*k25_pw2 - 4*k11_pw2*k21*k22_pw2*k31_pw4*k16_pw2*k25 - 2*k11_pw3*k21*k31_pw2*k14*k33_pw2*k25_pw3 - 2*k11*k21_pw2*k31*k14_pw3*k23_pw2*k35_pw3 - 2*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw3*k36 + 2*k11_pw2*k13_pw2*k31_pw4*k23_pw2*k24*k25 + 4*k11_pw2*k22*k31_pw3*k23_pw3*k15_pw2*k34 - 2*k12*k21_pw3*k22*k31_pw2*k15_pw3*k35_pw2+ 2*k11_pw2*k21_pw2*k14_pw2*k24*k33_pw4*k25 + 12*k11_pw2*k21_pw2*k31_pw4*k24*k16_pw2*k25 + 2*k11_pw2*k13_pw2*k22_pw2*k31_pw4*k25*k26 - k11_pw3*k22_pw2*k31_pw3*k32*k15*k26_pw2- k11_pw3*k31_pw3*k23_pw2*k32*k15*k25_pw2 + 4*k21_pw3*k13_pw2*k14_pw2*k32*k24*k33_pw3 + 4*k11_pw2*k22_pw3*k31_pw3*k23*k15_pw2*k36 - k21_pw3*k13*k22*k14_pw3*k32_pw2*k36_pw2- k21_pw3*k13*k22*k14_pw3*k33_pw2*k35_pw2+ 2*k11_pw2*k31_pw2*k14_pw2*k23_pw4*k34*k35 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k26_pw2*k35 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k25_pw2*k35 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k25*k34 - 2*k12_pw2*k21_pw3*k31_pw3*k24*k16_pw2*k35 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k26*k35_pw3 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k24*k35 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k25*k34 + 4*k21_pw3*k13_pw2*k14_pw2*k32_pw3*k33*k26 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k25*k36_pw2- 2*k11*k21_pw3*k14_pw3*k33_pw2*k25*k35_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k24*k25*k36_pw2- 4*k21_pw4*k31*k14_pw2*k32_pw2*k16_pw2*k35 + 2*k12_pw4*k21_pw2*k31_pw2*k25*k26*k35_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k34*k26_pw2*k35 + 2*k21_pw4*k14_pw2*k32*k15_pw2*k33*k35_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k25_pw2*k35*k36 + 12*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k34*k35 + 2*k21_pw4*k14_pw2*k15_pw2*k33_pw2*k34*k35 + 2*k21_pw4*k14_pw2*k32_pw2*k15_pw2*k35*k36 + k11_pw2*k12_pw2*k21*k31_pw2*k33_pw2*k25_pw3 + 4*k11_pw2*k21_pw2*k14_pw2*k32*k33_pw3*k25_pw2 + 4*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k35_pw2+ k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k35_pw3 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k26_pw2*k35 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25_pw2*k35 + 4*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k33*k26_pw2+ 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k15_pw2*k35 + 4*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k36_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25_pw2*k35 + k12_pw2*k21_pw2*k22_pw2*k31_pw3*k16_pw2*k35 + k12_pw2*k21_pw3*k31_pw2*k32_pw2*k16_pw2*k25 + k21_pw2*k13_pw2*k22_pw2*k31_pw3*k15_pw2*k35 + k21_pw3*k13_pw2*k31_pw2*k32_pw2*k15_pw2*k25 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25_pw2*k35 + 6*k21_pw3*k13_pw2*k14_pw2*k32_pw2*k33_pw2*k25 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k35_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k35_pw2- 2*k11_pw2*k12*k21*k13*k31_pw3*k33*k25_pw3 + k11*k12*k21*k22_pw3*k31_pw3*k33*k16_pw2 - k11*k21_pw2*k13*k22*k14_pw2*k24*k33_pw4 + 2*k11*k21_pw2*k13*k22*k31_pw4*k24*k16_pw2 + 2*k11_pw2*k21*k13*k22*k31_pw4*k16*k25_pw2 - 8*k11_pw2*k21*k22*k31_pw4*k23*k24*k16_pw2 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw4*k16*k25 + k11_pw2*k12*k31_pw3*k23_pw3*k32*k24*k16 + k11_pw2*k13*k31_pw3*k23_pw3*k32*k15*k24 - 6*k11_pw2*k13*k22*k31_pw4*k23_pw2*k24*k16 - 2*k11*k21*k13*k22_pw3*k31_pw3*k15_pw2*k36 - 2*k12*k21_pw3*k13*k31_pw3*k32*k24*k16_pw2 + k12*k21_pw3*k31*k14*k23*k32_pw3*k16_pw2 + 4*k11_pw2*k13_pw2*k22*k31_pw4*k23*k24*k26 - 6*k11_pw2*k13*k22_pw2*k31_pw4*k23*k16*k25 + 3*k11_pw3*k12*k31_pw3*k23*k32*k24*k26_pw2+ 3*k11_pw3*k12*k22*k31_pw3*k32*k25*k26_pw2+ 3*k11_pw3*k12*k22*k31_pw3*k24*k33*k26_pw2+ k21_pw2*k13_pw3*k31_pw3*k23*k32*k15*k24 + k21_pw2*k13_pw3*k22*k31_pw3*k32*k15*k25 + k21_pw2*k13_pw3*k22*k31_pw3*k15*k24*k33 - 8*k11*k21_pw2*k13_pw2*k31_pw4*k24*k16*k25 + 6*k11*k21_pw3*k31_pw3*k32*k15*k24*k16_pw2 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k32*k24*k26 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k24*k33*k25 - k11_pw2*k31_pw2*k14*k23_pw4*k32*k15*k34 - 4*k11_pw2*k22_pw3*k31_pw3*k23*k15*k33*k16 + k11_pw2*k12*k22_pw3*k31_pw3*k33*k16*k26 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k24*k35 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k25*k34 + 12*k11_pw2*k21*k13_pw2*k31_pw4*k24*k25*k26 + k11_pw2*k13*k22_pw3*k31_pw3*k15*k33*k26 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k24*k35 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k25*k34 - 8*k11_pw2*k22*k31_pw3*k14*k23_pw3*k16*k34 + 3*k11_pw3*k12*k31_pw3*k23*k32*k25_pw2*k26 + 3*k11_pw3*k12*k22*k31_pw3*k33*k25_pw2*k26 + 6*k11_pw3*k21*k31_pw3*k32*k15*k24*k26_pw2- 2*k11_pw3*k22*k31_pw3*k23*k15*k33*k25_pw2 + k21_pw3*k13*k31_pw2*k23*k32*k15_pw3*k34 + k21_pw3*k13*k22*k31_pw2*k15_pw3*k33*k34 + k21_pw3*k13*k22*k31_pw2*k32*k15_pw3*k35 + 6*k21_pw3*k13*k22*k31_pw3*k14*k16_pw2*k34 - 8*k11*k21_pw3*k14_pw2*k32*k24*k33_pw3*k16 - 2*k12*k21_pw3*k22*k31_pw3*k15*k16_pw2*k34 - 2*k12*k21_pw3*k31*k14_pw2*k23*k15*k35_pw3 + 6*k11_pw3*k21*k31_pw3*k32*k15*k25_pw2*k26 - 4*k11_pw3*k22*k31_pw3*k14*k23*k34*k26_pw2+ 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k24*k35 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k25*k34 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k24*k36 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k25*k35 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k34*k26 - 2*k21_pw3*k13_pw2*k31_pw3*k32*k15*k24*k16 - 2*k21_pw3*k13_pw2*k31*k14*k32_pw3*k15*k26 - 4*k21_pw3*k13*k14_pw2*k23*k32_pw3*k33*k16 - 2*k21_pw3*k13*k22*k31_pw3*k15_pw2*k16*k34 + k21_pw3*k13*k22*k14_pw2*k15*k33_pw3*k34 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k24*k33*k35 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k25*k34 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k24*k36 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k25*k35 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k34*k26 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k25*k34 + 12*k11*k21_pw3*k31_pw3*k14*k24*k16_pw2*k35 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k25*k34 - 2*k12*k21_pw3*k13*k14_pw2*k24*k33_pw3*k35 + k12*k21_pw3*k22*k14_pw2*k33_pw3*k16*k34 - 8*k11_pw2*k22_pw3*k31_pw3*k14*k23*k16*k36 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k26*k36 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k26*k36 - 2*k11_pw3*k31_pw3*k23_pw2*k32*k15*k24*k26 - 2*k11_pw3*k31_pw3*k23_pw2*k15*k24*k33*k25 + 12*k11_pw3*k21*k31_pw3*k14*k24*k26_pw2*k35 + 12*k11_pw3*k21*k31_pw3*k14*k25*k34*k26_pw2- 4*k11_pw3*k22*k31_pw3*k14*k23*k25_pw2*k36 - 2*k21_pw3*k13*k14_pw3*k23*k32*k33*k35_pw2+ 6*k21_pw3*k13*k22*k31*k14_pw3*k34*k36_pw2- 4*k11*k21_pw3*k31_pw3*k15_pw2*k24*k16*k35 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k25*k34 - 8*k11*k21_pw3*k14_pw2*k32_pw3*k33*k16*k26 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k25*k34 + 2*k11*k21_pw3*k14_pw2*k15*k24*k33_pw3*k35 - 4*k11*k21_pw3*k14_pw3*k32*k24*k33*k36_pw2- 4*k12*k21_pw3*k31_pw2*k23*k15_pw3*k34*k35 - 4*k12*k21_pw3*k22*k31_pw2*k15_pw3*k34*k36 - 2*k11_pw3*k22_pw2*k31_pw3*k15*k33*k25*k26 + 12*k11_pw3*k21*k31_pw3*k14*k25_pw2*k26*k35 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k24*k16*k35 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k25*k34 + k21_pw3*k13*k14_pw2*k23*k32_pw3*k15*k36 + 6*k21_pw3*k13*k22*k31*k14_pw3*k35_pw2*k36 + 2*k21_pw4*k31_pw2*k14*k32*k15*k16_pw2*k34 - 8*k21_pw4*k31*k14_pw2*k32*k33*k16_pw2*k34 - 4*k11*k21_pw3*k14_pw3*k32*k33*k26*k35_pw2+ 12*k11*k21_pw3*k31*k14_pw3*k24*k35*k36_pw2+ 12*k11*k21_pw3*k31*k14_pw3*k25*k34*k36_pw2+ k12*k21_pw3*k14_pw2*k23*k32_pw3*k16*k36 + 3*k12*k21_pw3*k14_pw3*k23*k32*k34*k36_pw2- 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k26*k36 + 3*k12*k21_pw3*k22*k14_pw3*k32*k35*k36_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k33*k34*k36_pw2- 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k25*k36 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k26*k35 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k25*k34*k26 - 2*k21_pw3*k13*k14_pw3*k23*k33_pw2*k34*k35 - 2*k21_pw3*k13*k22*k14_pw3*k33_pw2*k34*k36 + 2*k21_pw4*k31*k14_pw2*k32*k15*k16*k35_pw2+ 4*k21_pw4*k31*k14*k32_pw2*k15_pw2*k16*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k26*k36 + 12*k11*k21_pw3*k31*k14_pw3*k25*k35_pw2*k36 + 3*k12*k21_pw3*k14_pw3*k23*k32*k35_pw2*k36 + 3*k12*k21_pw3*k22*k14_pw3*k33*k35_pw2*k36 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k25*k26*k36 - 2*k21_pw3*k13*k14_pw3*k23*k32_pw2*k35*k36 - 6*k21_pw4*k14_pw2*k32*k15*k33_pw2*k16*k34 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k25*k34*k36 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k34*k26*k35 - 4*k11*k21_pw3*k14_pw3*k24*k33_pw2*k35*k36 - 8*k21_pw4*k31_pw2*k14*k15_pw2*k16*k34*k35 - 6*k21_pw4*k14_pw2*k32_pw2*k15*k33*k16*k35 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k26*k35*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k26*k35*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k25*k34*k26*k36 + 4*k21_pw4*k14_pw2*k32*k15_pw2*k33*k34*k36 + 12*k21_pw4*k31*k14_pw2*k15_pw2*k34*k35*k36 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k26_pw2- k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k25_pw2 - k12*k21_pw2*k13*k22_pw2*k31_pw3*k32*k16_pw2 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k25_pw2 - 3*k11*k21_pw2*k22_pw2*k31_pw3*k32*k15*k16_pw2 - 2*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k36_pw2- k11_pw2*k13*k31_pw2*k14*k23_pw3*k32_pw2*k25 + 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32_pw2*k16 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k24*k33_pw2 - 3*k21_pw3*k13*k22*k31_pw2*k14*k32_pw2*k16_pw2 + 4*k11*k21_pw2*k22_pw2*k14_pw2*k32*k33_pw3*k16 - k11*k21_pw2*k31_pw2*k23_pw2*k32*k15_pw3*k34 - k12*k21_pw3*k22*k31_pw2*k32_pw2*k15*k16_pw2 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k34*k26_pw2- 2*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k26_pw2- 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k32*k15*k16 + 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k33_pw2*k16 - k11_pw2*k13*k22_pw3*k31_pw2*k14*k33_pw2*k26 + 2*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k26_pw2+ 2*k11_pw3*k22*k31_pw2*k14*k23*k33_pw2*k25_pw2 + 2*k12_pw2*k21_pw2*k22*k31_pw3*k23*k16_pw2*k34 - k21_pw2*k13_pw2*k22_pw2*k31_pw3*k32*k15*k16 + 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k15_pw2*k34 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k32_pw2*k25 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k32_pw2*k26 - k21_pw3*k13*k22*k31_pw2*k32_pw2*k15_pw2*k16 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25_pw2*k35 - k11*k21_pw2*k22_pw2*k31_pw2*k15_pw3*k33*k35 - k11*k21_pw2*k22_pw2*k31_pw2*k32*k15_pw3*k36 - 6*k11*k21_pw2*k22_pw2*k31_pw3*k14*k16_pw2*k35 + 4*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw3*k33*k16 + 2*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k36_pw2+ 2*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k35_pw2- 6*k11*k21_pw3*k31_pw2*k14*k32_pw2*k16_pw2*k25 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k26_pw2*k35 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25*k34*k26_pw2+ 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k32*k15*k16*k25_pw2 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k24*k35 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k25*k34 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k32*k33*k26_pw2+ 2*k11_pw3*k31_pw2*k14*k23_pw2*k32*k33*k25_pw2 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k25*k26_pw2+ 2*k12_pw2*k21_pw3*k31_pw2*k32*k24*k33*k16_pw2 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k34*k26_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k32*k15_pw2*k24*k33 + 2*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k35_pw2- 6*k21_pw3*k13*k22*k14_pw2*k32_pw2*k33_pw2*k16 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25_pw2*k35 + 2*k11*k21_pw2*k22_pw2*k31_pw3*k15_pw2*k16*k35 - k11*k21_pw2*k22_pw2*k14_pw2*k15*k33_pw3*k35 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k36_pw2+ 2*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k35_pw2- 2*k11*k21_pw3*k31_pw2*k32_pw2*k15_pw2*k16*k25 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw2*k26*k35 + 8*k11_pw2*k21_pw2*k14_pw2*k32*k24*k33_pw3*k26 - 12*k11_pw2*k22_pw2*k31_pw3*k14*k23_pw2*k16*k35 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k25*k36 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k26*k35 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k24*k33_pw2*k25 - 2*k21_pw2*k13_pw2*k22_pw2*k31_pw3*k14*k16*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25_pw2*k36 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25_pw2*k35 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14*k32_pw2*k16*k25 - 6*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k35_pw2- 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k35*k36_pw2- k11*k21_pw2*k14_pw2*k23_pw2*k32_pw3*k15*k36 + 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k35_pw2- 12*k11*k21_pw3*k14_pw2*k32_pw2*k33_pw2*k16*k25 - k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k36_pw2- k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k35_pw2+ 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k25*k36 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k26*k35 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25*k34*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25_pw2*k35 + 8*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k34*k36 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k33_pw2*k25*k26 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k25*k26 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k25*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k26*k35 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25*k34*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k35_pw2- 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k26*k35_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k25*k34 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k24*k33_pw2*k35 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k34*k35 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k35_pw2+ 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k25*k36 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25*k34*k26 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k35_pw2+ 2*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k36_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k25*k36 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k26*k35 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k35*k36 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k26*k35_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k35*k36_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34*k36_pw2+ 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k35*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k34*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k34*k26*k35 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k35_pw2*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k35*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k34*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k34*k26*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k34*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k34*k26*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k26*k35*k36 - 4*k11*k21*k13_pw3*k31_pw4*k23*k24*k25 - 4*k11*k21*k13_pw3*k22*k31_pw4*k24*k26 - 12*k11_pw3*k13*k31_pw4*k23*k24*k25*k26 + 8*k11_pw3*k22*k31_pw4*k23*k24*k16*k26 - 24*k11_pw3*k21*k31_pw4*k24*k16*k25*k26 - 4*k21_pw4*k31*k14*k15_pw3*k33*k34*k35 - 4*k21_pw4*k31*k14*k32*k15_pw3*k34*k36 + 8*k21_pw4*k14_pw3*k32*k33*k16*k34*k36 - 24*k21_pw4*k31*k14_pw3*k16*k34*k35*k36 - 12*k21_pw4*k14_pw3*k15*k33*k34*k35*k36 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k25*k26_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k33*k25_pw2 + 2*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k33*k25_pw2 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k24*k33_pw2*k25 + 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k35_pw2+ 2*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k35_pw2+ 2*k11_pw2*k21_pw2*k31_pw2*k15_pw2*k24*k33_pw2*k25 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k36_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k35_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k25*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k25*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k26_pw2*k35 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25_pw2*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k36_pw2+ 12*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k33_pw2*k25*k26 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k35*k36_pw2+ 2*k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k34*k35 + 2*k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k34*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k26*k35_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k34*k26_pw2*k35 + 12*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k35*k36 + 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k35*k36 + 2*k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k35*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k35*k36 - k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k26_pw2- k11*k12_pw2*k21*k13*k22*k31_pw2*k33_pw2*k25_pw2 - k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k26_pw2- k11_pw2*k12*k21*k22*k31_pw2*k15*k33_pw2*k25_pw2 + k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k26_pw2+ k11_pw2*k21*k13*k22*k31_pw2*k14*k33_pw2*k25_pw2 - k11*k21_pw2*k13*k22*k31_pw2*k15_pw2*k24*k33_pw2 + 6*k11*k21_pw2*k22*k31_pw2*k14*k23*k32_pw2*k16_pw2 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k33_pw2*k25 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k25 - 6*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k35_pw2- 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k24*k33_pw2 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k33_pw2*k16*k25 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k32_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k33*k25_pw2 + 6*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32*k33*k16_pw2 - k11*k21_pw2*k13*k31_pw2*k23*k32_pw2*k15_pw2*k25 - k11*k21_pw2*k13*k22*k31_pw2*k32_pw2*k15_pw2*k26 + 2*k11*k21_pw2*k22*k31_pw2*k23*k32_pw2*k15_pw2*k16 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k15*k24*k33_pw2 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24*k33*k26_pw2- 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k33_pw2*k25 - 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32_pw2*k26 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k24*k33_pw2*k16 + 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32_pw2*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k33*k16*k25_pw2 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k24*k33_pw2*k25 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k32*k15_pw2*k33*k16 - 6*k11*k21_pw2*k13*k14_pw2*k23*k32_pw2*k33_pw2*k25 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k36_pw2- 6*k11*k21_pw2*k13*k22*k14_pw2*k32_pw2*k33_pw2*k26 - 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k35_pw2+ 12*k11*k21_pw2*k22*k14_pw2*k23*k32_pw2*k33_pw2*k16 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k32_pw2*k15*k25 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k32_pw2*k15*k26 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k36_pw2- k12*k21_pw2*k13*k31_pw2*k23_pw2*k32*k15_pw2*k34 - k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k35_pw2+ 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k33*k25_pw2*k26 - 6*k11_pw2*k21_pw2*k31*k14*k32*k15*k33_pw2*k25_pw2 + 12*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32*k33*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k33_pw2*k16*k25 - 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32_pw2*k16*k25 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k36_pw2- k12_pw2*k21_pw2*k13*k31_pw2*k23*k32_pw2*k16*k25 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k32_pw2*k16*k26 + 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k36_pw2+ 2*k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32*k33*k16 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k34*k26_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k24*k33_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k25*k26 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k36_pw2+ 2*k11*k21_pw2*k22_pw2*k31*k14*k15_pw2*k33_pw2*k35 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k35_pw2+ 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k26*k35_pw2+ 12*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k35_pw2+ k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k35_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k32_pw2*k15_pw2*k35 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k15_pw2*k33*k35 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k32*k15_pw2*k36 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k24*k33_pw2*k25*k26 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32*k33*k16*k25_pw2 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k26*k35_pw2+ 4*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k24*k33*k26 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k26*k35_pw2- 4*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k35_pw2- k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k35_pw2- k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32*k15*k34 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k16*k25*k26 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k36_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25_pw2*k36 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25_pw2*k35 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k33_pw2*k16*k35 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32*k15*k33_pw2*k34 - 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32_pw2*k16*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k34*k26_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14*k24*k33_pw2*k16*k25 + 4*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k24*k33*k26 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k34*k26_pw2- 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32*k15*k36 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k15*k33*k35 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k33_pw2*k16*k35 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k32*k15*k16*k34 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34*k36_pw2+ k12_pw2*k21_pw2*k31*k14*k23_pw2*k32_pw2*k16*k35 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32*k15*k36 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k15*k33*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k26*k35_pw2- 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k34*k26_pw2*k35 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32*k15*k33_pw2*k36 - 4*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k34*k35 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw2*k15*k33*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k16*k25*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25_pw2*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25_pw2*k36 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k32*k15*k16*k36 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15*k33*k16*k35 + 4*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k34*k36 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k35_pw2*k36 + 4*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k34*k36 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k35*k36 - 4*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k35*k36 + 12*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k34*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25*k34*k26 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k25*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k26*k35 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k35*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k34*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k34*k26*k35 - 4*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k34*k35 + 12*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k35*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25*k26*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k26*k35*k36 - 4*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k35*k36 + 6*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34*k35*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k26*k35*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k34*k26*k36 + k11*k12*k21*k22_pw3*k31*k14*k33_pw3*k16 + k11*k12*k21*k31*k14*k23_pw3*k32_pw3*k16 + 8*k11*k21*k13_pw2*k22*k31_pw4*k23*k24*k16 + 2*k11*k21*k13*k22_pw3*k31_pw3*k15*k33*k16 + 4*k11_pw2*k21*k13*k31_pw4*k23*k24*k16*k25 + 4*k11_pw2*k21*k13*k22*k31_pw4*k24*k16*k26 + 4*k11*k21*k13*k22_pw3*k31_pw3*k14*k16*k36 + 2*k21_pw3*k13*k31*k14*k23*k32_pw3*k15*k16 + 4*k11*k21_pw3*k31*k14*k32_pw3*k15*k16*k26 + 6*k11_pw3*k12*k31_pw3*k23*k24*k33*k25*k26 - 4*k11_pw3*k22*k31_pw3*k23*k32*k15*k25*k26 - 4*k11_pw3*k22*k31_pw3*k23*k15*k24*k33*k26 + 8*k12*k21_pw3*k13*k31_pw3*k15*k24*k16*k35 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k25*k34 + 12*k11_pw3*k21*k31_pw3*k15*k24*k33*k25*k26 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k26*k36 - 8*k11_pw3*k22*k31_pw3*k14*k23*k25*k26*k35 + 8*k21_pw4*k31*k14*k32*k15_pw2*k33*k16*k34 + 24*k11_pw3*k21*k31_pw3*k14*k24*k25*k26*k36 - 4*k21_pw3*k13*k14_pw3*k23*k32*k33*k34*k36 - 4*k21_pw3*k13*k22*k14_pw3*k32*k33*k35*k36 + 12*k21_pw3*k13*k31*k14_pw3*k23*k34*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k25*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k34*k26*k36 + 4*k21_pw4*k31*k14_pw2*k32*k15*k16*k34*k36 + 4*k21_pw4*k31*k14_pw2*k15*k33*k16*k34*k35 + 24*k11*k21_pw3*k31*k14_pw3*k34*k26*k35*k36 + 6*k12*k21_pw3*k14_pw3*k23*k33*k34*k35*k36 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k25_pw2 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k33*k25_pw2 + 3*k11*k12*k21*k22_pw2*k31_pw3*k23*k32*k16_pw2 + k11_pw2*k12*k21*k22*k31*k14*k33_pw3*k25_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k24*k26_pw2+ k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k26_pw2- 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k33*k25_pw2 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k34*k26_pw2- k11*k12*k21_pw2*k31_pw3*k23*k32*k24*k16_pw2 + 4*k11*k12*k21_pw2*k13*k31_pw3*k32*k16*k25_pw2 - k11*k12*k21_pw2*k22*k31_pw3*k32*k16_pw2*k25 - k11*k12*k21_pw2*k22*k31_pw3*k24*k33*k16_pw2 + k11*k12*k21*k31_pw2*k23_pw3*k32*k15_pw2*k34 - k11*k12*k21*k22_pw3*k31_pw2*k15*k33_pw2*k16 + k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k35_pw2- 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k32*k15*k24 - 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k33_pw2*k16 - 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k15_pw2*k34 + k12*k21_pw2*k13_pw2*k22*k31*k14*k24*k33_pw3 - k11_pw2*k12*k21*k31_pw3*k23*k32*k16*k25_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k25_pw2*k26 - k11_pw2*k12*k21*k22*k31_pw3*k33*k16*k25_pw2 - k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k25_pw2 - k11_pw2*k21*k13*k22*k31_pw3*k15*k33*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k25_pw2*k35 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k25_pw2*k36 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32*k24*k33_pw3 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32*k33_pw3*k25 + k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k36_pw2- 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k32*k15*k26 - 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k15*k33*k25 - 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k15_pw2*k35 - k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw3*k16 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k34*k26_pw2- 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k24*k26 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k24*k33*k25 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k32*k16*k25 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k24*k33*k16 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k34*k26_pw2- 2*k11_pw2*k13*k31_pw2*k14*k23_pw3*k32*k24*k33 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k32*k15*k25 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k15*k24*k33 - 2*k11*k21_pw2*k22*k31_pw2*k23*k15_pw3*k33*k34 - 2*k11*k21_pw2*k22*k31_pw2*k23*k32*k15_pw3*k35 - 12*k11*k21_pw2*k22*k31_pw3*k14*k23*k16_pw2*k34 - 2*k11*k21_pw2*k31*k14*k23_pw2*k32_pw3*k15*k16 + k11*k12_pw3*k21*k31_pw2*k23*k32*k34*k26_pw2+ k11*k12_pw3*k21*k22*k31_pw2*k32*k26_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k33*k34*k26_pw2- 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k25_pw2*k35 + k11*k12*k21*k22_pw3*k31_pw2*k15_pw2*k33*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k24*k35 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k25*k34 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k32*k24*k16 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k32*k16*k25 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k24*k33*k16 + k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw3*k26 + 3*k12*k21_pw3*k22*k31*k14*k32_pw2*k33*k16_pw2 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k32*k16*k26 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k33*k16*k25 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k25_pw2*k35 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k25_pw2*k36 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k33*k25*k26 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k32*k15*k24*k16 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k25_pw2*k35 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k25_pw2*k36 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k32*k15*k26 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k15*k33*k25 - 2*k21_pw2*k13_pw3*k31_pw2*k14*k23*k32*k24*k33 - 2*k21_pw2*k13_pw3*k22*k31_pw2*k14*k32*k33*k25 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k24*k26 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k15*k24*k33*k25 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k24*k35 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k25*k34 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32_pw3*k33*k26 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k24*k36 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k25*k35 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k34*k26 + 4*k11*k21_pw2*k22*k31_pw3*k23*k15_pw2*k16*k34 - 2*k11*k21_pw2*k22*k14_pw2*k23*k15*k33_pw3*k34 + k11*k12_pw3*k21*k31_pw2*k23*k32*k25_pw2*k36 + k11*k12_pw3*k21*k31_pw2*k23*k33*k25_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k33*k25_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14*k32*k24*k33*k16_pw2 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k25*k34 + k11*k12*k21_pw2*k14_pw2*k23*k24*k33_pw3*k35 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k25*k35 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k34*k26 + k11*k12*k21_pw2*k22*k14_pw2*k24*k33_pw3*k36 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k25*k36 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k26*k35 - 4*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k34*k35 - 4*k11_pw2*k21_pw2*k31*k14*k15*k24*k33_pw3*k25 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k24*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k25*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k34*k26 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k24*k33*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k25*k34 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k24*k36 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k25*k35 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k34*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k32*k15*k16*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k15*k33*k16*k25 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k24*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k25*k35 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k34*k26 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k24*k36 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k25*k35 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k34*k26 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32*k15*k35 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k15*k33*k34 - 12*k11_pw3*k21*k31_pw2*k14*k32*k24*k33*k26_pw2- 4*k21_pw2*k13_pw2*k22*k31_pw3*k14*k23*k16*k34 - 6*k21_pw3*k13_pw2*k31*k14*k32*k15*k24*k33_pw2 - 2*k21_pw3*k13*k22*k31*k14*k15_pw2*k33_pw2*k34 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k34*k36_pw2- 4*k11*k21_pw3*k31_pw2*k32*k15_pw2*k24*k33*k16 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k24*k35 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k25*k34 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k24*k36 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k25*k35 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k34*k26 - k12*k21_pw3*k31_pw2*k14*k23*k32*k16_pw2*k34 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k36_pw2- k12*k21_pw3*k22*k31_pw2*k14*k32*k16_pw2*k35 - k12*k21_pw3*k22*k31_pw2*k14*k33*k16_pw2*k34 + 3*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k35_pw2+ 3*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k35_pw2- 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k25*k36 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k26*k35 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k24*k16*k35 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k25*k34 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k25*k36 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k26*k35 - 12*k11_pw3*k21*k31_pw2*k14*k32*k33*k25_pw2*k26 + 4*k11_pw3*k22*k31_pw2*k14*k23*k24*k33_pw2*k26 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k24*k16*k35 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k25*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k24*k16*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k25*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k34*k26 + k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k36_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k36_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14*k32*k24*k33*k16 - 6*k21_pw3*k13_pw2*k31*k14*k32_pw2*k15*k33*k25 + 4*k21_pw3*k13*k22*k31*k14_pw2*k33_pw2*k16*k34 - k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k35_pw2- 2*k21_pw3*k13*k22*k31*k14*k32_pw2*k15_pw2*k36 - k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k35_pw2- 2*k21_pw3*k13*k31*k14*k23*k32_pw2*k15_pw2*k35 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k25*k36 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k26*k35 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25*k34*k26 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k35_pw2*k36 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k36_pw2- 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k25*k34 - 4*k11*k21_pw3*k31*k14*k15_pw2*k24*k33_pw2*k35 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k26*k36 + 3*k12*k21_pw3*k31_pw2*k23*k32*k15_pw2*k16*k34 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k24*k33*k35 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k25*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k35_pw2- 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k24*k36 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k25*k35 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k34*k26 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k26*k35_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k35_pw2+ 3*k12*k21_pw3*k22*k31_pw2*k15_pw2*k33*k16*k34 + 4*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k35_pw2+ 3*k12*k21_pw3*k22*k31_pw2*k32*k15_pw2*k16*k35 - k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k35_pw2- k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k35_pw2+ 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k26*k36 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25*k26*k35 - 12*k11_pw2*k21_pw2*k31_pw3*k32*k15*k24*k16*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k15*k24*k33*k16*k25 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k15*k33*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k26*k36 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k25*k36 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k26*k35 + 4*k11_pw3*k31_pw2*k14*k23_pw2*k32*k24*k33*k26 - 12*k11_pw3*k21*k31_pw2*k14*k24*k33_pw2*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k36_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k33*k26*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k26*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k35_pw2+ 3*k21_pw3*k13*k14_pw2*k23*k32*k15*k33_pw2*k34 + 3*k21_pw3*k13*k22*k14_pw2*k32*k15*k33_pw2*k35 + 4*k21_pw3*k13*k22*k31*k14_pw2*k32_pw2*k16*k36 + 4*k21_pw3*k13*k31*k14_pw2*k23*k32_pw2*k16*k35 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k25*k36 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k26*k35 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25*k34*k26 + 4*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k34*k36 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k25*k34 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k26*k35_pw2- 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k35_pw2+ 8*k11*k21_pw3*k31*k14_pw2*k24*k33_pw2*k16*k35 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k25*k36 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k26*k35 + 3*k12*k21_pw3*k14_pw2*k23*k32*k33_pw2*k16*k34 - 2*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k35_pw2- 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k25*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k34*k26 - 6*k12*k21_pw3*k13*k14_pw2*k32*k24*k33_pw2*k36 + 3*k12*k21_pw3*k22*k14_pw2*k32*k33_pw2*k16*k35 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k34*k36_pw2- 12*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25*k26*k36 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k26*k35_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k35_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k24*k16*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k25*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k34*k26 + k12_pw3*k21_pw2*k31_pw2*k23*k24*k33*k16*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k25*k34 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k26*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25*k26*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k25*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k26*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25*k34*k26 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k25*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k26*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k24*k33*k16*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k25*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k34*k26 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k24*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k25*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k34*k26 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k24*k33*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k25*k34 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k24*k33*k36 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k25*k35 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k34*k26 + 4*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k34*k35 + 3*k21_pw3*k13*k14_pw2*k23*k32_pw2*k15*k33*k35 + 4*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k34*k36 + 3*k21_pw3*k13*k22*k14_pw2*k32_pw2*k15*k33*k36 + 4*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k34*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k25*k35 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k34*k26 + 6*k11*k21_pw3*k14_pw2*k32*k15*k24*k33_pw2*k36 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k25*k36 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k26*k35 + 3*k12*k21_pw3*k14_pw2*k23*k32_pw2*k33*k16*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k25*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k26*k35 + 3*k12*k21_pw3*k22*k14_pw2*k32_pw2*k33*k16*k36 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k35_pw2*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k25*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k26*k35 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25*k34*k26 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k24*k16*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k25*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k34*k26 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k24*k33*k16*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k25*k34 - 12*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k34*k35 - 12*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k34*k36 - 12*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k34*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k34*k26*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k25*k36 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k26*k35 - 2*k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k34*k35 - 2*k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k34*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k35*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k34*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k34*k26*k35 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k35*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k34*k26*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k34*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k34*k26*k35 - 2*k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k34*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k34*k26*k35 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k35*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k34*k26*k36 - 12*k12_pw2*k21_pw3*k31*k14_pw2*k34*k26*k35*k36 - k11*k12*k21*k13*k22_pw2*k31*k14*k33_pw3*k25 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k32*k24*k16 - k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw3*k26 + 2*k11*k21_pw2*k13*k22*k31*k14*k15*k24*k33_pw3 - 2*k11*k12*k21_pw2*k22*k31*k14*k24*k33_pw3*k16 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k24*k26 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k24*k33*k25 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k25*k26 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k24*k33*k26 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k32*k16*k26 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k33*k16*k25 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k32*k15*k25 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k15*k24*k33 + 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k32*k15*k16 + 2*k11_pw2*k12*k21*k22*k31*k14*k24*k33_pw3*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k24*k33_pw3*k25 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k32*k16*k34 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k24*k35 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k25*k34 - k11*k12*k21*k31*k14*k23_pw3*k32_pw2*k15*k35 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k32*k15*k34 + 12*k11*k21*k13*k22*k31_pw3*k14*k23_pw2*k16*k34 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k25*k26 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k24*k33*k26 - 2*k11*k21_pw2*k13*k31_pw3*k23*k32*k15*k24*k16 - 2*k11*k21_pw2*k13*k22*k31_pw3*k32*k15*k16*k25 - 2*k11*k21_pw2*k13*k22*k31_pw3*k15*k24*k33*k16 + 2*k11*k21_pw2*k13*k31*k14*k23*k32_pw3*k15*k26 + 8*k11*k12*k21_pw2*k13*k31_pw3*k32*k24*k16*k26 + 8*k11*k12*k21_pw2*k13*k31_pw3*k24*k33*k16*k25 - 2*k11*k12*k21_pw2*k31*k14*k23*k32_pw3*k16*k26 - k11*k12*k21*k22_pw3*k31*k14*k15*k33_pw2*k36 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k25*k36 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k26*k35 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k24*k36 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k25*k35 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k34*k26 + 12*k11*k21*k13*k22_pw2*k31_pw3*k14*k23*k16*k35 - 2*k11_pw2*k12*k21*k31_pw3*k23*k32*k24*k16*k26 - 2*k11_pw2*k12*k21*k31_pw3*k23*k24*k33*k16*k25 - 12*k11_pw2*k12*k21*k13*k31_pw3*k24*k33*k25*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k32*k16*k25*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k24*k33*k16*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k24*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k15*k24*k33*k25 - 2*k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k25*k26 - 2*k11_pw2*k21*k13*k22*k31_pw3*k15*k24*k33*k26 + 8*k11_pw2*k21*k22*k31_pw3*k23*k32*k15*k16*k25 + 8*k11_pw2*k21*k22*k31_pw3*k23*k15*k24*k33*k16 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k25*k36 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k26*k35 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k25*k34*k26 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k26*k36 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k25*k26*k35 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k33*k16*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k34*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k34*k35 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k15*k33*k36 + 6*k21_pw3*k13*k22*k31*k14*k32_pw2*k15*k33*k16 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k24*k16*k35 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k25*k34 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k24*k16*k36 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k25*k35 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k34*k26 + 12*k11*k21_pw3*k31*k14*k32*k15*k24*k33_pw2*k16 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k24*k16*k35 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k25*k34 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k25*k36 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k26*k35 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k25*k34*k26 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k24*k16*k36 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k25*k35 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k34*k26 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k25*k36 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k26*k35 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k25*k34*k26 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k26*k36 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k25*k26*k35 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k25*k36 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k26*k35 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k25*k34*k26 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k26*k36 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k25*k26*k35 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k24*k16*k36 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k25*k35 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k34*k26 - 4*k21_pw3*k13*k22*k31*k14*k32*k15_pw2*k33*k35 - 4*k21_pw3*k13*k31*k14*k23*k32*k15_pw2*k33*k34 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k26*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k25*k26*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k25*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k26*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k33*k25*k34*k26 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k25*k26*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k26*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k33*k25*k26*k35 + 12*k11*k21_pw3*k31*k14*k32_pw2*k15*k33*k16*k25 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k25*k34 + 4*k12*k21_pw3*k13*k31*k14*k15*k24*k33_pw2*k35 - 4*k12*k21_pw3*k22*k31*k14*k15*k33_pw2*k16*k34 + 8*k11_pw3*k22*k31_pw2*k14*k23*k32*k33*k25*k26 - 2*k21_pw3*k13*k31_pw2*k14*k23*k32*k15*k16*k34 - 2*k21_pw3*k13*k22*k31_pw2*k14*k32*k15*k16*k35 - 2*k21_pw3*k13*k22*k31_pw2*k14*k15*k33*k16*k34 + 8*k21_pw3*k13*k22*k31*k14_pw2*k32*k33*k16*k35 + 8*k21_pw3*k13*k31*k14_pw2*k23*k32*k33*k16*k34 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k24*k33*k36 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k25*k35 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k34*k26 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k24*k16*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k25*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k34*k26 - 4*k12*k21_pw3*k13*k31_pw2*k14*k24*k33*k16*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k25*k34 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k25*k36 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k26*k35 - 4*k12*k21_pw3*k22*k31*k14*k32_pw2*k15*k16*k36 - 4*k12*k21_pw3*k31*k14*k23*k32_pw2*k15*k16*k35 + 8*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k35*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k24*k16*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k25*k35 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k34*k26 - 4*k11*k21_pw3*k31_pw2*k14*k15*k24*k33*k16*k35 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k25*k34 + 16*k11*k21_pw3*k31*k14_pw2*k32*k24*k33*k16*k36 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k25*k35 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k34*k26 + 6*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k34*k36 + 6*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k35*k36 + 6*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k34*k35 + 6*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k34*k36 - 2*k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k35*k36 - 2*k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k34*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k34*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k34*k35 + 8*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k34*k35 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k35*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k34*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k34*k26*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k34*k26*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k34*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k34*k26*k35 + 8*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k34*k36 - 2*k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k35*k36 - 2*k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k34*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k34*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k26*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k34*k26*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k34*k26*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k34*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k34*k26*k35 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k34*k26*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k34*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k34*k26*k35 - 4*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k34*k36 - 4*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k34*k26*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k34*k26*k35 - 12*k12*k21_pw3*k31*k14_pw2*k23*k15*k34*k35*k36 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k33*k25_pw2 + k11*k12*k21*k13*k22_pw2*k31_pw2*k15*k33_pw2*k25 + k11*k12*k21*k13*k31_pw2*k23_pw2*k32_pw2*k15*k25 - 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k32_pw2*k15*k16 + 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k24*k33_pw2 - 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32_pw2*k16 + 3*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k33*k26_pw2+ 3*k11_pw2*k12*k21*k31*k14*k23*k32*k33_pw2*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k24*k33_pw2*k25 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k24*k33_pw2*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k24*k33_pw2*k16 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k36_pw2+ 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k15_pw2*k33*k34 + 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k32*k15_pw2*k35 + 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k35_pw2+ 4*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32*k24*k33 + 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32_pw2*k26 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k33*k25_pw2 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k33*k25_pw2 + 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k24*k33*k16 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k32_pw2*k16*k26 - 2*k11*k21_pw2*k13*k31_pw2*k23*k32*k15_pw2*k24*k33 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k24*k33_pw2*k16 - 2*k11*k21_pw2*k13*k22*k31_pw2*k32*k15_pw2*k33*k25 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k34*k26_pw2+ 2*k11*k12*k21_pw2*k22*k31_pw2*k15*k24*k33_pw2*k16 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k15_pw2*k33*k35 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k32*k15_pw2*k36 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32*k33*k26 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32*k33_pw2*k25 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32*k24*k33_pw2 - 3*k12*k21_pw2*k13*k22_pw2*k31*k14*k32*k33_pw2*k16 + 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k32_pw2*k15*k16 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k34*k26_pw2- 2*k11_pw2*k12*k21*k31_pw2*k23*k15*k24*k33_pw2*k25 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k26_pw2*k35 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k34*k26_pw2- 2*k11_pw2*k12*k21*k22*k31_pw2*k15*k24*k33_pw2*k26 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k24*k33_pw2*k25 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k24*k33_pw2*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k24*k33_pw2*k16 - 6*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32*k33*k25 + 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k33*k16*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k25*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k24*k33_pw2*k35 - 6*k11*k21_pw2*k22_pw2*k31*k14*k32*k15*k33_pw2*k16 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k32_pw2*k16*k25 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k32_pw2*k16*k26 + 4*k11*k21_pw2*k22*k31*k14*k23*k15_pw2*k33_pw2*k34 + 2*k11*k12*k21_pw2*k31_pw2*k23*k32_pw2*k15*k16*k25 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25_pw2*k36 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25_pw2*k35 + 2*k11*k12*k21_pw2*k22*k31_pw2*k32_pw2*k15*k16*k26 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k36_pw2- 2*k12*k21_pw2*k13_pw2*k31_pw2*k23*k32*k15*k24*k33 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw2*k32*k15*k33*k25 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw2*k33*k26 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw2*k33*k25 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k32*k15*k33*k16 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k15_pw2*k33*k34 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k32*k15_pw2*k35 - 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k35_pw2- 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25_pw2*k36 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25_pw2*k35 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k25*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25_pw2*k36 - 8*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k24*k33*k16 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k25*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32_pw2*k16*k26 - 6*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32*k33*k26 - 2*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k24*k33*k16 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k33*k16*k25 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k25*k36 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k26*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k24*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k25*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k34*k26 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k24*k33*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k25*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k25*k36 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k26*k35 - 8*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k24*k33*k26 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k25*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k34*k26 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k24*k33_pw2*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k25*k34 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k24*k33_pw2*k35 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k33_pw2*k16*k34 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k35_pw2+ 4*k11*k21_pw2*k22*k31*k14*k23*k32_pw2*k15_pw2*k36 + 4*k11*k21_pw2*k31*k14*k23_pw2*k32*k15_pw2*k33*k34 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k35_pw2- k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k24*k33*k35 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k25*k34 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k24*k36 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k25*k35 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k34*k26 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k24*k33*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k25*k35 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k34*k26 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k26*k35_pw2- k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k25*k36 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k26*k35 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k26*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k26*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k35_pw2- 12*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k34*k36 + k12*k21_pw2*k13*k22_pw2*k31*k14*k15*k33_pw2*k35 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k32*k16*k34 + k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw2*k15*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k25*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k26*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k24*k33*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k25*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k34*k26 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k33*k16*k26 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k25*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k34*k26 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k24*k33_pw2*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k25*k34 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k24*k33_pw2*k35 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k33_pw2*k16*k34 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k35_pw2- 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32*k15*k35 - 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k15*k33*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k32*k24*k33*k16*k26 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k26*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k25*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k26*k35 + 4*k11*k21_pw2*k22_pw2*k31*k14*k32*k15_pw2*k33*k36 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32*k15*k16*k34 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k26*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k25*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k26*k35 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32*k15*k33_pw2*k35 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k32_pw2*k16*k36 - 8*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k33*k16*k34 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k25*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k34*k26 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k24*k33_pw2*k36 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k25*k36 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k26*k35 - 12*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k35*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k24*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k25*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k34*k26 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k24*k33*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k25*k34 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k25*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k26*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k24*k33*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k25*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k34*k26 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k32*k16*k36 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k33*k16*k35 - 12*k11_pw2*k21_pw2*k31*k14*k32*k15*k24*k33_pw2*k26 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k26*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k25*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k26*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k24*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k25*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k34*k26 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k24*k33*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k25*k34 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k24*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k25*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k34*k26 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k24*k33*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k25*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k25*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k26*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k24*k33*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k25*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k34*k26 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k26*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k25*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k26*k35 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k32*k15*k16*k35 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15*k33*k16*k34 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32_pw2*k16*k36 + 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k33*k16*k34 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32*k15*k16*k36 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15*k33*k16*k35 - 8*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k33*k16*k36 - 8*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k34*k36 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32_pw2*k15*k33*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k25*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k26*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k26*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k34*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k34*k35 + 24*k11_pw2*k21_pw2*k31_pw2*k14*k32*k24*k33*k16*k26 - 12*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k33*k25*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k26*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k25*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k26*k35 + 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k33*k16*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k26*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25*k26*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k25*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k26*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25*k34*k26 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k35*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k34*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k34*k26*k35 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k35*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k34*k26*k36 + 24*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k34*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k34*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k34*k35 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k35*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k35*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k34*k26*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k35*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k34*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k34*k26*k35 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k35*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k34*k26*k36 - 8*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k34*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k34*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k34*k35 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k35*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k25*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25*k34*k26 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k26*k36 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25*k26*k35 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k35*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k26*k35*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k34*k26*k36 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k15*k24*k33_pw2 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32*k24*k33_pw2 + 9*k11*k12*k21*k22_pw2*k31*k14*k23*k32*k33_pw2*k16 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32*k33_pw2*k26 + 2*k11*k12*k21*k13*k31_pw2*k23_pw2*k32*k15*k24*k33 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k32_pw2*k15*k26 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw2*k33*k25 + 9*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw2*k33*k16 - 6*k11*k12*k21*k22_pw2*k31_pw2*k23*k32*k15*k33*k16 + 2*k11*k12*k21*k13*k22_pw2*k31_pw2*k32*k15*k33*k26 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k15*k33_pw2*k34 + 8*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32*k33*k25 - 12*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32*k33*k16 - 4*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k24*k33*k26 - 4*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k33*k25*k26 + 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k33*k16*k25 + 6*k11*k21_pw2*k13*k22*k31*k14*k32*k15*k33_pw2*k25 + 6*k11*k21_pw2*k13*k31*k14*k23*k32*k15*k24*k33_pw2 - 6*k11*k12*k21_pw2*k22*k31*k14*k32*k33_pw2*k16*k25 - 6*k11*k12*k21_pw2*k31*k14*k23*k32*k24*k33_pw2*k16 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k15*k33_pw2*k35 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k32*k16*k35 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k33*k16*k34 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw2*k15*k36 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32*k15*k35 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k15*k33*k34 - 6*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw2*k33*k16 + 6*k11_pw2*k12*k21*k22*k31*k14*k32*k33_pw2*k25*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32*k24*k33_pw2*k26 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k25*k35 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k34*k26 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k24*k33_pw2*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k24*k33*k16 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k33*k16*k25 + 6*k11*k21_pw2*k13*k22*k31*k14*k32_pw2*k15*k33*k26 + 6*k11*k21_pw2*k13*k31*k14*k23*k32_pw2*k15*k33*k25 - 12*k11*k21_pw2*k22*k31*k14*k23*k32_pw2*k15*k33*k16 + 4*k11*k12*k21_pw2*k31_pw2*k23*k32*k15*k24*k33*k16 + 4*k11*k12*k21_pw2*k22*k31_pw2*k32*k15*k33*k16*k25 - 6*k11*k12*k21_pw2*k22*k31*k14*k32_pw2*k33*k16*k26 - 6*k11*k12*k21_pw2*k31*k14*k23*k32_pw2*k33*k16*k25 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k32*k16*k36 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k33*k16*k35 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32*k15*k36 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k15*k33*k35 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k15*k33_pw2*k34 - 4*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k24*k33*k26 - 4*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k33*k25*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k33*k25*k26 + 4*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k24*k33*k26 + 4*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k33*k25*k26 - 16*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k33*k16*k25 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k25*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k26*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k24*k33*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k25*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k34*k26 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k26*k36 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k24*k33*k36 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k25*k35 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k34*k26 + 8*k11*k21_pw2*k22*k31*k14*k23*k32*k15_pw2*k33*k35 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k35*k36 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k34*k36 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k32*k16*k35 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k33*k16*k34 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw2*k15*k36 + 2*k12*k21_pw2*k13*k31*k14*k23_pw2*k32*k15*k33*k34 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k26*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k24*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k25*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k34*k26 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k24*k33*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k25*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k25*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k26*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k24*k33*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k25*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k34*k26 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k25*k36 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k26*k35 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k24*k33*k36 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k25*k35 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k34*k26 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k32*k15*k16*k35 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15*k33*k16*k34 - 16*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k33*k16*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k24*k16*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k25*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k34*k26 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k24*k33*k16*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k25*k34 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k26*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25*k26*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k25*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k26*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25*k34*k26 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k25*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k26*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k24*k33*k16*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k25*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k34*k26 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k35*k36 + 2*k12*k21_pw2*k13*k22_pw2*k31*k14*k32*k15*k33*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k26*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25*k26*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k25*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k26*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25*k34*k26 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25*k26*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k26*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25*k26*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k25*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k26*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k24*k33*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k25*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k34*k26 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k25*k36 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k26*k35 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k24*k33*k36 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k25*k35 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k34*k26 + 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k33*k16*k35 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k35*k36 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k34*k36 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k35*k36 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k34*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k35*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k34*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k34*k26*k35 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k35*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k34*k26*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k26*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k34*k26*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k34*k26*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k34*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k34*k26*k35 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k35*k36 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k34*k36 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k24*k33_pw3 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k32*k16*k25 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k24*k33*k16 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k24*k36 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k25*k35 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k34*k26 - 2*k11*k12*k21*k31*k14*k23_pw3*k32*k15*k33*k34 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k24*k33*k36 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k25*k35 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k34*k26 - 8*k12*k21_pw3*k22*k31*k14*k32*k15*k33*k16*k35 - 8*k12*k21_pw3*k31*k14*k23*k32*k15*k33*k16*k34 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32*k33_pw2*k25 + 4*k11*k12*k21*k13*k22*k31_pw2*k23*k32*k15*k33*k25 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw2*k33*k26 - 6*k11*k12*k21*k22*k31*k14*k23_pw2*k32*k15*k33*k35 - 6*k11*k12*k21*k22_pw2*k31*k14*k23*k32*k15*k33*k36 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k25*k36 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k26*k35 + 4*k12*k21_pw2*k13*k22*k31*k14*k23*k32*k15*k33*k35);
+    coeffs[3] = (4*k11_pw4*k31_pw4*k25_pw3*k26 + 4*k21_pw4*k14_pw4*k35_pw3*k36 - 2*k11_pw3*k13*k31_pw4*k23*k25_pw3 - 4*k11_pw3*k21*k31_pw4*k16*k25_pw3 + 2*k21_pw2*k13_pw4*k31_pw4*k24*k25 + 12*k11_pw4*k31_pw4*k24*k25*k26_pw2- 4*k21_pw4*k31*k14_pw3*k16*k35_pw3 + 2*k21_pw4*k31_pw2*k15_pw4*k34*k35 - 2*k21_pw4*k14_pw3*k15*k33*k35_pw3 + 12*k21_pw4*k14_pw4*k34*k35*k36_pw2+ 2*k11_pw2*k21*k13_pw2*k31_pw4*k25_pw3 + 4*k11_pw2*k22_pw3*k31_pw4*k23*k16_pw2 + 4*k21_pw4*k14_pw2*k32_pw3*k33*k16_pw2 + 2*k21_pw4*k31*k14_pw2*k15_pw2*k35_pw3 - 2*k11*k21*k13_pw3*k22*k31_pw4*k25_pw2 - 2*k11*k21*k13*k22_pw3*k31_pw4*k16_pw2 + k11_pw3*k12*k31_pw3*k23*k33*k25_pw3 + 2*k11_pw3*k21*k31_pw3*k15*k33*k25_pw3 - 6*k11_pw3*k13*k22*k31_pw4*k24*k26_pw2- 2*k21_pw2*k13_pw3*k22*k31_pw4*k24*k16 - 2*k11_pw2*k13*k22_pw3*k31_pw4*k16*k26 - 6*k11_pw3*k13*k22*k31_pw4*k25_pw2*k26 + 4*k11_pw3*k22*k31_pw4*k23*k16*k25_pw2 + 2*k21_pw3*k13*k31*k14_pw3*k23*k35_pw3 + 4*k11_pw3*k21*k31_pw3*k14*k25_pw3*k36 - 2*k21_pw4*k31*k14*k32_pw3*k15*k16_pw2 + 4*k11*k21_pw3*k31*k14_pw3*k26*k35_pw3 + k12*k21_pw3*k14_pw3*k23*k33*k35_pw3 + 4*k11_pw3*k31_pw4*k23_pw2*k24*k16*k25 - 2*k21_pw4*k31*k14*k32*k15_pw3*k35_pw2+ 4*k11_pw3*k22_pw2*k31_pw4*k16*k25*k26 - 2*k21_pw4*k31_pw2*k32*k15_pw3*k16*k34 + 4*k21_pw4*k14_pw3*k32*k33*k16*k35_pw2- 2*k21_pw4*k14_pw2*k32_pw3*k15*k16*k36 - 6*k21_pw4*k14_pw3*k32*k15*k34*k36_pw2+ 4*k21_pw4*k14_pw3*k33_pw2*k16*k34*k35 - 6*k21_pw4*k14_pw3*k32*k15*k35_pw2*k36 + 4*k21_pw4*k14_pw3*k32_pw2*k16*k35*k36 + 2*k11_pw2*k13_pw2*k22*k31_pw4*k23*k25_pw2 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k32*k25_pw2 - 4*k11_pw2*k21*k22_pw2*k31_pw4*k16_pw2*k25 - 2*k11_pw3*k21*k31_pw2*k14*k33_pw2*k25_pw3 - 2*k11*k21_pw2*k31*k14_pw3*k23_pw2*k35_pw3 - 2*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw3*k36 + 2*k11_pw2*k13_pw2*k31_pw4*k23_pw2*k24*k25 + 4*k11_pw2*k22*k31_pw3*k23_pw3*k15_pw2*k34 - 2*k12*k21_pw3*k22*k31_pw2*k15_pw3*k35_pw2+ 2*k11_pw2*k21_pw2*k14_pw2*k24*k33_pw4*k25 + 12*k11_pw2*k21_pw2*k31_pw4*k24*k16_pw2*k25 + 2*k11_pw2*k13_pw2*k22_pw2*k31_pw4*k25*k26 - k11_pw3*k22_pw2*k31_pw3*k32*k15*k26_pw2- k11_pw3*k31_pw3*k23_pw2*k32*k15*k25_pw2 + 4*k21_pw3*k13_pw2*k14_pw2*k32*k24*k33_pw3 + 4*k11_pw2*k22_pw3*k31_pw3*k23*k15_pw2*k36 - k21_pw3*k13*k22*k14_pw3*k32_pw2*k36_pw2- k21_pw3*k13*k22*k14_pw3*k33_pw2*k35_pw2+ 2*k11_pw2*k31_pw2*k14_pw2*k23_pw4*k34*k35 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k26_pw2*k35 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k25_pw2*k35 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k25*k34 - 2*k12_pw2*k21_pw3*k31_pw3*k24*k16_pw2*k35 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k26*k35_pw3 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k24*k35 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k25*k34 + 4*k21_pw3*k13_pw2*k14_pw2*k32_pw3*k33*k26 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k25*k36_pw2- 2*k11*k21_pw3*k14_pw3*k33_pw2*k25*k35_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k24*k25*k36_pw2- 4*k21_pw4*k31*k14_pw2*k32_pw2*k16_pw2*k35 + 2*k12_pw4*k21_pw2*k31_pw2*k25*k26*k35_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k34*k26_pw2*k35 + 2*k21_pw4*k14_pw2*k32*k15_pw2*k33*k35_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k25_pw2*k35*k36 + 12*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k34*k35 + 2*k21_pw4*k14_pw2*k15_pw2*k33_pw2*k34*k35 + 2*k21_pw4*k14_pw2*k32_pw2*k15_pw2*k35*k36 + k11_pw2*k12_pw2*k21*k31_pw2*k33_pw2*k25_pw3 + 4*k11_pw2*k21_pw2*k14_pw2*k32*k33_pw3*k25_pw2 + 4*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k35_pw2+ k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k35_pw3 + k11_pw2*k12_pw2*k22_pw2*k31_pw3*k26_pw2*k35 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25_pw2*k35 + 4*k11_pw2*k21_pw2*k14_pw2*k32_pw3*k33*k26_pw2+ 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k15_pw2*k35 + 4*k11_pw2*k22_pw3*k31_pw2*k14_pw2*k23*k36_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25_pw2*k35 + k12_pw2*k21_pw2*k22_pw2*k31_pw3*k16_pw2*k35 + k12_pw2*k21_pw3*k31_pw2*k32_pw2*k16_pw2*k25 + k21_pw2*k13_pw2*k22_pw2*k31_pw3*k15_pw2*k35 + k21_pw3*k13_pw2*k31_pw2*k32_pw2*k15_pw2*k25 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25_pw2*k35 + 6*k21_pw3*k13_pw2*k14_pw2*k32_pw2*k33_pw2*k25 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k35_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k32_pw2*k25*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k35_pw2- 2*k11_pw2*k12*k21*k13*k31_pw3*k33*k25_pw3 + k11*k12*k21*k22_pw3*k31_pw3*k33*k16_pw2 - k11*k21_pw2*k13*k22*k14_pw2*k24*k33_pw4 + 2*k11*k21_pw2*k13*k22*k31_pw4*k24*k16_pw2 + 2*k11_pw2*k21*k13*k22*k31_pw4*k16*k25_pw2 - 8*k11_pw2*k21*k22*k31_pw4*k23*k24*k16_pw2 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw4*k16*k25 + k11_pw2*k12*k31_pw3*k23_pw3*k32*k24*k16 + k11_pw2*k13*k31_pw3*k23_pw3*k32*k15*k24 - 6*k11_pw2*k13*k22*k31_pw4*k23_pw2*k24*k16 - 2*k11*k21*k13*k22_pw3*k31_pw3*k15_pw2*k36 - 2*k12*k21_pw3*k13*k31_pw3*k32*k24*k16_pw2 + k12*k21_pw3*k31*k14*k23*k32_pw3*k16_pw2 + 4*k11_pw2*k13_pw2*k22*k31_pw4*k23*k24*k26 - 6*k11_pw2*k13*k22_pw2*k31_pw4*k23*k16*k25 + 3*k11_pw3*k12*k31_pw3*k23*k32*k24*k26_pw2+ 3*k11_pw3*k12*k22*k31_pw3*k32*k25*k26_pw2+ 3*k11_pw3*k12*k22*k31_pw3*k24*k33*k26_pw2+ k21_pw2*k13_pw3*k31_pw3*k23*k32*k15*k24 + k21_pw2*k13_pw3*k22*k31_pw3*k32*k15*k25 + k21_pw2*k13_pw3*k22*k31_pw3*k15*k24*k33 - 8*k11*k21_pw2*k13_pw2*k31_pw4*k24*k16*k25 + 6*k11*k21_pw3*k31_pw3*k32*k15*k24*k16_pw2 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k32*k24*k26 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k24*k33*k25 - k11_pw2*k31_pw2*k14*k23_pw4*k32*k15*k34 - 4*k11_pw2*k22_pw3*k31_pw3*k23*k15*k33*k16 + k11_pw2*k12*k22_pw3*k31_pw3*k33*k16*k26 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k24*k35 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k25*k34 + 12*k11_pw2*k21*k13_pw2*k31_pw4*k24*k25*k26 + k11_pw2*k13*k22_pw3*k31_pw3*k15*k33*k26 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k24*k35 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k25*k34 - 8*k11_pw2*k22*k31_pw3*k14*k23_pw3*k16*k34 + 3*k11_pw3*k12*k31_pw3*k23*k32*k25_pw2*k26 + 3*k11_pw3*k12*k22*k31_pw3*k33*k25_pw2*k26 + 6*k11_pw3*k21*k31_pw3*k32*k15*k24*k26_pw2- 2*k11_pw3*k22*k31_pw3*k23*k15*k33*k25_pw2 + k21_pw3*k13*k31_pw2*k23*k32*k15_pw3*k34 + k21_pw3*k13*k22*k31_pw2*k15_pw3*k33*k34 + k21_pw3*k13*k22*k31_pw2*k32*k15_pw3*k35 + 6*k21_pw3*k13*k22*k31_pw3*k14*k16_pw2*k34 - 8*k11*k21_pw3*k14_pw2*k32*k24*k33_pw3*k16 - 2*k12*k21_pw3*k22*k31_pw3*k15*k16_pw2*k34 - 2*k12*k21_pw3*k31*k14_pw2*k23*k15*k35_pw3 + 6*k11_pw3*k21*k31_pw3*k32*k15*k25_pw2*k26 - 4*k11_pw3*k22*k31_pw3*k14*k23*k34*k26_pw2+ 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k24*k35 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k25*k34 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k24*k36 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k25*k35 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k34*k26 - 2*k21_pw3*k13_pw2*k31_pw3*k32*k15*k24*k16 - 2*k21_pw3*k13_pw2*k31*k14*k32_pw3*k15*k26 - 4*k21_pw3*k13*k14_pw2*k23*k32_pw3*k33*k16 - 2*k21_pw3*k13*k22*k31_pw3*k15_pw2*k16*k34 + k21_pw3*k13*k22*k14_pw2*k15*k33_pw3*k34 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k24*k33*k35 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k25*k34 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k24*k36 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k25*k35 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k34*k26 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k25*k34 + 12*k11*k21_pw3*k31_pw3*k14*k24*k16_pw2*k35 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k25*k34 - 2*k12*k21_pw3*k13*k14_pw2*k24*k33_pw3*k35 + k12*k21_pw3*k22*k14_pw2*k33_pw3*k16*k34 - 8*k11_pw2*k22_pw3*k31_pw3*k14*k23*k16*k36 - 2*k11_pw2*k12*k22_pw3*k31_pw3*k15*k26*k36 + 2*k11_pw2*k13*k22_pw3*k31_pw3*k14*k26*k36 - 2*k11_pw3*k31_pw3*k23_pw2*k32*k15*k24*k26 - 2*k11_pw3*k31_pw3*k23_pw2*k15*k24*k33*k25 + 12*k11_pw3*k21*k31_pw3*k14*k24*k26_pw2*k35 + 12*k11_pw3*k21*k31_pw3*k14*k25*k34*k26_pw2- 4*k11_pw3*k22*k31_pw3*k14*k23*k25_pw2*k36 - 2*k21_pw3*k13*k14_pw3*k23*k32*k33*k35_pw2+ 6*k21_pw3*k13*k22*k31*k14_pw3*k34*k36_pw2- 4*k11*k21_pw3*k31_pw3*k15_pw2*k24*k16*k35 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k25*k34 - 8*k11*k21_pw3*k14_pw2*k32_pw3*k33*k16*k26 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k25*k34 + 2*k11*k21_pw3*k14_pw2*k15*k24*k33_pw3*k35 - 4*k11*k21_pw3*k14_pw3*k32*k24*k33*k36_pw2- 4*k12*k21_pw3*k31_pw2*k23*k15_pw3*k34*k35 - 4*k12*k21_pw3*k22*k31_pw2*k15_pw3*k34*k36 - 2*k11_pw3*k22_pw2*k31_pw3*k15*k33*k25*k26 + 12*k11_pw3*k21*k31_pw3*k14*k25_pw2*k26*k35 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k24*k16*k35 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k25*k34 + k21_pw3*k13*k14_pw2*k23*k32_pw3*k15*k36 + 6*k21_pw3*k13*k22*k31*k14_pw3*k35_pw2*k36 + 2*k21_pw4*k31_pw2*k14*k32*k15*k16_pw2*k34 - 8*k21_pw4*k31*k14_pw2*k32*k33*k16_pw2*k34 - 4*k11*k21_pw3*k14_pw3*k32*k33*k26*k35_pw2+ 12*k11*k21_pw3*k31*k14_pw3*k24*k35*k36_pw2+ 12*k11*k21_pw3*k31*k14_pw3*k25*k34*k36_pw2+ k12*k21_pw3*k14_pw2*k23*k32_pw3*k16*k36 + 3*k12*k21_pw3*k14_pw3*k23*k32*k34*k36_pw2- 2*k12*k21_pw3*k13*k14_pw2*k32_pw3*k26*k36 + 3*k12*k21_pw3*k22*k14_pw3*k32*k35*k36_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k33*k34*k36_pw2- 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k25*k36 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k26*k35 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k25*k34*k26 - 2*k21_pw3*k13*k14_pw3*k23*k33_pw2*k34*k35 - 2*k21_pw3*k13*k22*k14_pw3*k33_pw2*k34*k36 + 2*k21_pw4*k31*k14_pw2*k32*k15*k16*k35_pw2+ 4*k21_pw4*k31*k14*k32_pw2*k15_pw2*k16*k35 + 2*k11*k21_pw3*k14_pw2*k32_pw3*k15*k26*k36 + 12*k11*k21_pw3*k31*k14_pw3*k25*k35_pw2*k36 + 3*k12*k21_pw3*k14_pw3*k23*k32*k35_pw2*k36 + 3*k12*k21_pw3*k22*k14_pw3*k33*k35_pw2*k36 - 4*k11_pw3*k22_pw2*k31_pw3*k14*k25*k26*k36 - 2*k21_pw3*k13*k14_pw3*k23*k32_pw2*k35*k36 - 6*k21_pw4*k14_pw2*k32*k15*k33_pw2*k16*k34 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k25*k34*k36 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k34*k26*k35 - 4*k11*k21_pw3*k14_pw3*k24*k33_pw2*k35*k36 - 8*k21_pw4*k31_pw2*k14*k15_pw2*k16*k34*k35 - 6*k21_pw4*k14_pw2*k32_pw2*k15*k33*k16*k35 - 4*k11*k21_pw3*k14_pw3*k32_pw2*k26*k35*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k24*k26*k35*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k25*k34*k26*k36 + 4*k21_pw4*k14_pw2*k32*k15_pw2*k33*k34*k36 + 12*k21_pw4*k31*k14_pw2*k15_pw2*k34*k35*k36 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k32*k26_pw2- k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k25_pw2 - k12*k21_pw2*k13*k22_pw2*k31_pw3*k32*k16_pw2 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k25_pw2 - 3*k11*k21_pw2*k22_pw2*k31_pw3*k32*k15*k16_pw2 - 2*k11*k21*k13*k22_pw3*k31_pw2*k14_pw2*k36_pw2- k11_pw2*k13*k31_pw2*k14*k23_pw3*k32_pw2*k25 + 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32_pw2*k16 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k24*k33_pw2 - 3*k21_pw3*k13*k22*k31_pw2*k14*k32_pw2*k16_pw2 + 4*k11*k21_pw2*k22_pw2*k14_pw2*k32*k33_pw3*k16 - k11*k21_pw2*k31_pw2*k23_pw2*k32*k15_pw3*k34 - k12*k21_pw3*k22*k31_pw2*k32_pw2*k15*k16_pw2 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k34*k26_pw2- 2*k11_pw2*k21_pw2*k31*k14*k32_pw3*k15*k26_pw2- 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k32*k15*k16 + 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k33_pw2*k16 - k11_pw2*k13*k22_pw3*k31_pw2*k14*k33_pw2*k26 + 2*k11_pw3*k22*k31_pw2*k14*k23*k32_pw2*k26_pw2+ 2*k11_pw3*k22*k31_pw2*k14*k23*k33_pw2*k25_pw2 + 2*k12_pw2*k21_pw2*k22*k31_pw3*k23*k16_pw2*k34 - k21_pw2*k13_pw2*k22_pw2*k31_pw3*k32*k15*k16 + 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k15_pw2*k34 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k32_pw2*k25 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k32_pw2*k26 - k21_pw3*k13*k22*k31_pw2*k32_pw2*k15_pw2*k16 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25_pw2*k35 - k11*k21_pw2*k22_pw2*k31_pw2*k15_pw3*k33*k35 - k11*k21_pw2*k22_pw2*k31_pw2*k32*k15_pw3*k36 - 6*k11*k21_pw2*k22_pw2*k31_pw3*k14*k16_pw2*k35 + 4*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw3*k33*k16 + 2*k11*k21_pw2*k22*k14_pw3*k23*k32_pw2*k36_pw2+ 2*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k35_pw2- 6*k11*k21_pw3*k31_pw2*k14*k32_pw2*k16_pw2*k25 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k26_pw2*k35 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25*k34*k26_pw2+ 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k32*k15*k16*k25_pw2 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k24*k35 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k25*k34 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k32*k33*k26_pw2+ 2*k11_pw3*k31_pw2*k14*k23_pw2*k32*k33*k25_pw2 - 6*k11_pw3*k21*k31_pw2*k14*k32_pw2*k25*k26_pw2+ 2*k12_pw2*k21_pw3*k31_pw2*k32*k24*k33*k16_pw2 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k34*k26_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k32*k15_pw2*k24*k33 + 2*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k35_pw2- 6*k21_pw3*k13*k22*k14_pw2*k32_pw2*k33_pw2*k16 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25_pw2*k35 + 2*k11*k21_pw2*k22_pw2*k31_pw3*k15_pw2*k16*k35 - k11*k21_pw2*k22_pw2*k14_pw2*k15*k33_pw3*k35 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k32*k33*k36_pw2+ 2*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k35_pw2- 2*k11*k21_pw3*k31_pw2*k32_pw2*k15_pw2*k16*k25 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw2*k26*k35 + 8*k11_pw2*k21_pw2*k14_pw2*k32*k24*k33_pw3*k26 - 12*k11_pw2*k22_pw2*k31_pw3*k14*k23_pw2*k16*k35 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k25*k36 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k26*k35 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k24*k33_pw2*k25 - 2*k21_pw2*k13_pw2*k22_pw2*k31_pw3*k14*k16*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25_pw2*k36 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25_pw2*k35 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k24*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14*k32_pw2*k16*k25 - 6*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k35_pw2- 6*k11*k21_pw2*k22_pw2*k31*k14_pw3*k35*k36_pw2- k11*k21_pw2*k14_pw2*k23_pw2*k32_pw3*k15*k36 + 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k35_pw2- 12*k11*k21_pw3*k14_pw2*k32_pw2*k33_pw2*k16*k25 - k12*k21_pw3*k22*k14_pw2*k32_pw2*k15*k36_pw2- k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k35_pw2+ 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k25*k36 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k26*k35 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25*k34*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25_pw2*k35 + 8*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k34*k36 + 2*k11_pw3*k22_pw2*k31_pw2*k14*k33_pw2*k25*k26 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k25*k26 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k25*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k26*k35 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25*k34*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k35_pw2- 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k26*k35_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k25*k34 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k24*k33_pw2*k35 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k34*k35 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k35_pw2+ 2*k11_pw2*k12_pw2*k22_pw2*k31_pw3*k25*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k25*k36 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25*k34*k26 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k35_pw2+ 2*k12_pw2*k21_pw3*k14_pw2*k32*k24*k33*k36_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k25*k36 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k26*k35 + 2*k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k35*k36 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k26*k35_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k24*k35*k36_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k34*k36_pw2+ 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k35*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k34*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k34*k26*k35 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k35_pw2*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k35*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k34*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k34*k26*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k34*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k34*k26*k35 + 2*k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32_pw2*k26*k35*k36 - 4*k11*k21*k13_pw3*k31_pw4*k23*k24*k25 - 4*k11*k21*k13_pw3*k22*k31_pw4*k24*k26 - 12*k11_pw3*k13*k31_pw4*k23*k24*k25*k26 + 8*k11_pw3*k22*k31_pw4*k23*k24*k16*k26 - 24*k11_pw3*k21*k31_pw4*k24*k16*k25*k26 - 4*k21_pw4*k31*k14*k15_pw3*k33*k34*k35 - 4*k21_pw4*k31*k14*k32*k15_pw3*k34*k36 + 8*k21_pw4*k14_pw3*k32*k33*k16*k34*k36 - 24*k21_pw4*k31*k14_pw3*k16*k34*k35*k36 - 12*k21_pw4*k14_pw3*k15*k33*k34*k35*k36 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k25*k26_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k33*k25_pw2 + 2*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k33*k25_pw2 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k24*k33_pw2*k25 + 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k35_pw2+ 2*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k35_pw2+ 2*k11_pw2*k21_pw2*k31_pw2*k15_pw2*k24*k33_pw2*k25 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k25*k36_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k35_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k25*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k25*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k26_pw2*k35 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25_pw2*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k25*k36_pw2+ 12*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k33_pw2*k25*k26 + 3*k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k35*k36_pw2+ 2*k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k34*k35 + 2*k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k34*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k26*k35_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k34*k26_pw2*k35 + 12*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k35*k36 + 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k35*k36 + 2*k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k35*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k35*k36 - k11*k12_pw2*k21*k13*k22*k31_pw2*k32_pw2*k26_pw2- k11*k12_pw2*k21*k13*k22*k31_pw2*k33_pw2*k25_pw2 - k11_pw2*k12*k21*k22*k31_pw2*k32_pw2*k15*k26_pw2- k11_pw2*k12*k21*k22*k31_pw2*k15*k33_pw2*k25_pw2 + k11_pw2*k21*k13*k22*k31_pw2*k14*k32_pw2*k26_pw2+ k11_pw2*k21*k13*k22*k31_pw2*k14*k33_pw2*k25_pw2 - k11*k21_pw2*k13*k22*k31_pw2*k15_pw2*k24*k33_pw2 + 6*k11*k21_pw2*k22*k31_pw2*k14*k23*k32_pw2*k16_pw2 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k33_pw2*k25 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k25 - 6*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k35_pw2- 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k24*k33_pw2 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k33_pw2*k16*k25 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k32_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k33*k25_pw2 + 6*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32*k33*k16_pw2 - k11*k21_pw2*k13*k31_pw2*k23*k32_pw2*k15_pw2*k25 - k11*k21_pw2*k13*k22*k31_pw2*k32_pw2*k15_pw2*k26 + 2*k11*k21_pw2*k22*k31_pw2*k23*k32_pw2*k15_pw2*k16 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k15*k24*k33_pw2 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k24*k33*k26_pw2- 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k33_pw2*k25 - 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32_pw2*k26 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k24*k33_pw2*k16 + 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32_pw2*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k33*k16*k25_pw2 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k24*k33_pw2*k25 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k32*k15_pw2*k33*k16 - 6*k11*k21_pw2*k13*k14_pw2*k23*k32_pw2*k33_pw2*k25 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k24*k36_pw2- 6*k11*k21_pw2*k13*k22*k14_pw2*k32_pw2*k33_pw2*k26 - 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k35_pw2+ 12*k11*k21_pw2*k22*k14_pw2*k23*k32_pw2*k33_pw2*k16 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k32_pw2*k15*k25 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k32_pw2*k15*k26 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k32*k36_pw2- k12*k21_pw2*k13*k31_pw2*k23_pw2*k32*k15_pw2*k34 - k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k35_pw2+ 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k33*k25_pw2*k26 - 6*k11_pw2*k21_pw2*k31*k14*k32*k15*k33_pw2*k25_pw2 + 12*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32*k33*k16 - 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k33_pw2*k16*k25 - 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32_pw2*k16*k25 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k24*k36_pw2- k12_pw2*k21_pw2*k13*k31_pw2*k23*k32_pw2*k16*k25 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k32_pw2*k16*k26 + 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k24*k36_pw2+ 2*k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32*k33*k16 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k34*k26_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k24*k33_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k25*k26 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k15*k36_pw2+ 2*k11*k21_pw2*k22_pw2*k31*k14*k15_pw2*k33_pw2*k35 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k35_pw2+ 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k26*k35_pw2+ 12*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k35_pw2+ k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k35_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k32_pw2*k15_pw2*k35 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k15_pw2*k33*k35 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k32*k15_pw2*k36 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k24*k33_pw2*k25*k26 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32*k33*k16*k25_pw2 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k26*k35_pw2+ 4*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k24*k33*k26 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k15*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k35_pw2+ 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k26*k35_pw2- 4*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k35_pw2- k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k35_pw2- k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32*k15*k34 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k16*k25*k26 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k25*k36_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25_pw2*k36 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25_pw2*k35 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k33_pw2*k16*k35 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32*k15*k33_pw2*k34 - 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32_pw2*k16*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k34*k26_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14*k24*k33_pw2*k16*k25 + 4*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k24*k33*k26 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k34*k26_pw2- 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k32*k15*k36 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k15*k33*k35 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k33_pw2*k16*k35 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k32*k15*k16*k34 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k34*k36_pw2+ k12_pw2*k21_pw2*k31*k14*k23_pw2*k32_pw2*k16*k35 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k32*k15*k36 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k15*k33*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k26*k35_pw2- 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k34*k26_pw2*k35 - 3*k11*k21_pw2*k22_pw2*k14_pw2*k32*k15*k33_pw2*k36 - 4*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k34*k35 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw2*k15*k33*k35 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k16*k25*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25_pw2*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25_pw2*k36 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k32*k15*k16*k36 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15*k33*k16*k35 + 4*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k34*k36 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k35_pw2*k36 + 4*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k34*k36 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k35*k36 - 4*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k35*k36 + 12*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k34*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25*k34*k26 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k25*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k26*k35 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k35*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k34*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k34*k26*k35 - 4*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k34*k35 + 12*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k35*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k25*k26*k36 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k26*k35*k36 - 4*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k35*k36 + 6*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34*k35*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k26*k35*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k34*k26*k36 + k11*k12*k21*k22_pw3*k31*k14*k33_pw3*k16 + k11*k12*k21*k31*k14*k23_pw3*k32_pw3*k16 + 8*k11*k21*k13_pw2*k22*k31_pw4*k23*k24*k16 + 2*k11*k21*k13*k22_pw3*k31_pw3*k15*k33*k16 + 4*k11_pw2*k21*k13*k31_pw4*k23*k24*k16*k25 + 4*k11_pw2*k21*k13*k22*k31_pw4*k24*k16*k26 + 4*k11*k21*k13*k22_pw3*k31_pw3*k14*k16*k36 + 2*k21_pw3*k13*k31*k14*k23*k32_pw3*k15*k16 + 4*k11*k21_pw3*k31*k14*k32_pw3*k15*k16*k26 + 6*k11_pw3*k12*k31_pw3*k23*k24*k33*k25*k26 - 4*k11_pw3*k22*k31_pw3*k23*k32*k15*k25*k26 - 4*k11_pw3*k22*k31_pw3*k23*k15*k24*k33*k26 + 8*k12*k21_pw3*k13*k31_pw3*k15*k24*k16*k35 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k25*k34 + 12*k11_pw3*k21*k31_pw3*k15*k24*k33*k25*k26 - 8*k11_pw3*k22*k31_pw3*k14*k23*k24*k26*k36 - 8*k11_pw3*k22*k31_pw3*k14*k23*k25*k26*k35 + 8*k21_pw4*k31*k14*k32*k15_pw2*k33*k16*k34 + 24*k11_pw3*k21*k31_pw3*k14*k24*k25*k26*k36 - 4*k21_pw3*k13*k14_pw3*k23*k32*k33*k34*k36 - 4*k21_pw3*k13*k22*k14_pw3*k32*k33*k35*k36 + 12*k21_pw3*k13*k31*k14_pw3*k23*k34*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k25*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k34*k26*k36 + 4*k21_pw4*k31*k14_pw2*k32*k15*k16*k34*k36 + 4*k21_pw4*k31*k14_pw2*k15*k33*k16*k34*k35 + 24*k11*k21_pw3*k31*k14_pw3*k34*k26*k35*k36 + 6*k12*k21_pw3*k14_pw3*k23*k33*k34*k35*k36 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k25_pw2 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k33*k25_pw2 + 3*k11*k12*k21*k22_pw2*k31_pw3*k23*k32*k16_pw2 + k11_pw2*k12*k21*k22*k31*k14*k33_pw3*k25_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k24*k26_pw2+ k11_pw2*k12*k21*k31*k14*k23*k32_pw3*k26_pw2- 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k33*k25_pw2 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k34*k26_pw2- k11*k12*k21_pw2*k31_pw3*k23*k32*k24*k16_pw2 + 4*k11*k12*k21_pw2*k13*k31_pw3*k32*k16*k25_pw2 - k11*k12*k21_pw2*k22*k31_pw3*k32*k16_pw2*k25 - k11*k12*k21_pw2*k22*k31_pw3*k24*k33*k16_pw2 + k11*k12*k21*k31_pw2*k23_pw3*k32*k15_pw2*k34 - k11*k12*k21*k22_pw3*k31_pw2*k15*k33_pw2*k16 + k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k35_pw2- 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k32*k15*k24 - 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k33_pw2*k16 - 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k15_pw2*k34 + k12*k21_pw2*k13_pw2*k22*k31*k14*k24*k33_pw3 - k11_pw2*k12*k21*k31_pw3*k23*k32*k16*k25_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k25_pw2*k26 - k11_pw2*k12*k21*k22*k31_pw3*k33*k16*k25_pw2 - k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k25_pw2 - k11_pw2*k21*k13*k22*k31_pw3*k15*k33*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k25_pw2*k35 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k25_pw2*k36 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32*k24*k33_pw3 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32*k33_pw3*k25 + k11*k12*k21*k22_pw3*k31*k14_pw2*k33*k36_pw2- 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k32*k15*k26 - 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k15*k33*k25 - 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k15_pw2*k35 - k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw3*k16 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k34*k26_pw2- 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k24*k26 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k24*k33*k25 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k32*k16*k25 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k24*k33*k16 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k34*k26_pw2- 2*k11_pw2*k13*k31_pw2*k14*k23_pw3*k32*k24*k33 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k32*k15*k25 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k15*k24*k33 - 2*k11*k21_pw2*k22*k31_pw2*k23*k15_pw3*k33*k34 - 2*k11*k21_pw2*k22*k31_pw2*k23*k32*k15_pw3*k35 - 12*k11*k21_pw2*k22*k31_pw3*k14*k23*k16_pw2*k34 - 2*k11*k21_pw2*k31*k14*k23_pw2*k32_pw3*k15*k16 + k11*k12_pw3*k21*k31_pw2*k23*k32*k34*k26_pw2+ k11*k12_pw3*k21*k22*k31_pw2*k32*k26_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k33*k34*k26_pw2- 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k25_pw2*k35 + k11*k12*k21*k22_pw3*k31_pw2*k15_pw2*k33*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k24*k35 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k25*k34 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k32*k24*k16 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k32*k16*k25 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k24*k33*k16 + k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw3*k26 + 3*k12*k21_pw3*k22*k31*k14*k32_pw2*k33*k16_pw2 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k32*k16*k26 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k33*k16*k25 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k25_pw2*k35 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k25_pw2*k36 - 2*k11_pw2*k12*k13*k22_pw2*k31_pw3*k33*k25*k26 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k32*k15*k24*k16 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k25_pw2*k35 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k25_pw2*k36 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k32*k15*k26 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k15*k33*k25 - 2*k21_pw2*k13_pw3*k31_pw2*k14*k23*k32*k24*k33 - 2*k21_pw2*k13_pw3*k22*k31_pw2*k14*k32*k33*k25 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k24*k26 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k15*k24*k33*k25 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k24*k35 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k25*k34 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32_pw3*k33*k26 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k24*k36 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k25*k35 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k34*k26 + 4*k11*k21_pw2*k22*k31_pw3*k23*k15_pw2*k16*k34 - 2*k11*k21_pw2*k22*k14_pw2*k23*k15*k33_pw3*k34 + k11*k12_pw3*k21*k31_pw2*k23*k32*k25_pw2*k36 + k11*k12_pw3*k21*k31_pw2*k23*k33*k25_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k33*k25_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14*k32*k24*k33*k16_pw2 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k25*k34 + k11*k12*k21_pw2*k14_pw2*k23*k24*k33_pw3*k35 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k25*k35 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k34*k26 + k11*k12*k21_pw2*k22*k14_pw2*k24*k33_pw3*k36 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k25*k36 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k26*k35 - 4*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k34*k35 - 4*k11_pw2*k21_pw2*k31*k14*k15*k24*k33_pw3*k25 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k24*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k25*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k34*k26 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k24*k33*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k25*k34 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k24*k36 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k25*k35 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k34*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k32*k15*k16*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k15*k33*k16*k25 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k24*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k25*k35 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k34*k26 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k24*k36 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k25*k35 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k34*k26 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32*k15*k35 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k15*k33*k34 - 12*k11_pw3*k21*k31_pw2*k14*k32*k24*k33*k26_pw2- 4*k21_pw2*k13_pw2*k22*k31_pw3*k14*k23*k16*k34 - 6*k21_pw3*k13_pw2*k31*k14*k32*k15*k24*k33_pw2 - 2*k21_pw3*k13*k22*k31*k14*k15_pw2*k33_pw2*k34 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k34*k36_pw2- 4*k11*k21_pw3*k31_pw2*k32*k15_pw2*k24*k33*k16 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k24*k35 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k25*k34 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k24*k36 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k25*k35 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k34*k26 - k12*k21_pw3*k31_pw2*k14*k23*k32*k16_pw2*k34 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k24*k36_pw2- k12*k21_pw3*k22*k31_pw2*k14*k32*k16_pw2*k35 - k12*k21_pw3*k22*k31_pw2*k14*k33*k16_pw2*k34 + 3*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k35_pw2+ 3*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k35_pw2- 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k25*k36 - 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k26*k35 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k24*k16*k35 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k25*k34 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k25*k36 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k26*k35 - 12*k11_pw3*k21*k31_pw2*k14*k32*k33*k25_pw2*k26 + 4*k11_pw3*k22*k31_pw2*k14*k23*k24*k33_pw2*k26 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k24*k16*k35 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k25*k34 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k24*k16*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k25*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k34*k26 + k12_pw3*k21_pw2*k22*k31*k14*k32*k25*k36_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k24*k33*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k24*k36_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14*k32*k24*k33*k16 - 6*k21_pw3*k13_pw2*k31*k14*k32_pw2*k15*k33*k25 + 4*k21_pw3*k13*k22*k31*k14_pw2*k33_pw2*k16*k34 - k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k35_pw2- 2*k21_pw3*k13*k22*k31*k14*k32_pw2*k15_pw2*k36 - k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k35_pw2- 2*k21_pw3*k13*k31*k14*k23*k32_pw2*k15_pw2*k35 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k25*k36 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k26*k35 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25*k34*k26 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k35_pw2*k36 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k24*k36_pw2- 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k25*k34 - 4*k11*k21_pw3*k31*k14*k15_pw2*k24*k33_pw2*k35 + k11*k12*k21_pw2*k14_pw2*k23*k32_pw3*k26*k36 + 3*k12*k21_pw3*k31_pw2*k23*k32*k15_pw2*k16*k34 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k24*k33*k35 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k25*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k35_pw2- 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k24*k36 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k25*k35 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k34*k26 + 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k26*k35_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k35_pw2+ 3*k12*k21_pw3*k22*k31_pw2*k15_pw2*k33*k16*k34 + 4*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k35_pw2+ 3*k12*k21_pw3*k22*k31_pw2*k32*k15_pw2*k16*k35 - k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k35_pw2- k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k35_pw2+ 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k24*k26*k36 + 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25*k26*k35 - 12*k11_pw2*k21_pw2*k31_pw3*k32*k15*k24*k16*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k15*k24*k33*k16*k25 - 4*k11_pw2*k22_pw3*k31_pw2*k14*k23*k15*k33*k36 + k11_pw2*k12*k22_pw3*k31_pw2*k14*k33*k26*k36 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k25*k36 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k26*k35 + 4*k11_pw3*k31_pw2*k14*k23_pw2*k32*k24*k33*k26 - 12*k11_pw3*k21*k31_pw2*k14*k24*k33_pw2*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k24*k36_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k33*k26*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k26*k35_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k35_pw2+ 3*k21_pw3*k13*k14_pw2*k23*k32*k15*k33_pw2*k34 + 3*k21_pw3*k13*k22*k14_pw2*k32*k15*k33_pw2*k35 + 4*k21_pw3*k13*k22*k31*k14_pw2*k32_pw2*k16*k36 + 4*k21_pw3*k13*k31*k14_pw2*k23*k32_pw2*k16*k35 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k25*k36 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k26*k35 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25*k34*k26 + 4*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k34*k36 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k25*k34 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k26*k35_pw2- 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k35_pw2+ 8*k11*k21_pw3*k31*k14_pw2*k24*k33_pw2*k16*k35 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k25*k36 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k26*k35 + 3*k12*k21_pw3*k14_pw2*k23*k32*k33_pw2*k16*k34 - 2*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k35_pw2- 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k25*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k34*k26 - 6*k12*k21_pw3*k13*k14_pw2*k32*k24*k33_pw2*k36 + 3*k12*k21_pw3*k22*k14_pw2*k32*k33_pw2*k16*k35 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k34*k36_pw2- 12*k11_pw2*k12_pw2*k21*k31_pw3*k24*k25*k26*k36 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k26*k35_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k35_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k24*k16*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k25*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k34*k26 + k12_pw3*k21_pw2*k31_pw2*k23*k24*k33*k16*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k25*k34 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k24*k26*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25*k26*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k25*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k26*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25*k34*k26 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k25*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k26*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k24*k33*k16*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k25*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k34*k26 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k24*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k25*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k34*k26 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k24*k33*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k25*k34 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k24*k33*k36 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k25*k35 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k34*k26 + 4*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k34*k35 + 3*k21_pw3*k13*k14_pw2*k23*k32_pw2*k15*k33*k35 + 4*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k34*k36 + 3*k21_pw3*k13*k22*k14_pw2*k32_pw2*k15*k33*k36 + 4*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k34*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k25*k35 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k34*k26 + 6*k11*k21_pw3*k14_pw2*k32*k15*k24*k33_pw2*k36 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k25*k36 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k26*k35 + 3*k12*k21_pw3*k14_pw2*k23*k32_pw2*k33*k16*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k25*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k26*k35 + 3*k12*k21_pw3*k22*k14_pw2*k32_pw2*k33*k16*k36 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k35_pw2*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k25*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k26*k35 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25*k34*k26 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k24*k16*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k25*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k34*k26 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k24*k33*k16*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k25*k34 - 12*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k34*k35 - 12*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k34*k36 - 12*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k34*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k34*k26*k35 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k25*k36 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k26*k35 - 2*k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k34*k35 - 2*k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k34*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k35*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k34*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k34*k26*k35 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k35*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k34*k26*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k34*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k34*k26*k35 - 2*k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k34*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k34*k26*k35 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k35*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k34*k26*k36 - 12*k12_pw2*k21_pw3*k31*k14_pw2*k34*k26*k35*k36 - k11*k12*k21*k13*k22_pw2*k31*k14*k33_pw3*k25 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k32*k24*k16 - k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw3*k26 + 2*k11*k21_pw2*k13*k22*k31*k14*k15*k24*k33_pw3 - 2*k11*k12*k21_pw2*k22*k31*k14*k24*k33_pw3*k16 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k24*k26 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k24*k33*k25 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k25*k26 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k24*k33*k26 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k32*k16*k26 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k33*k16*k25 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k32*k15*k25 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k15*k24*k33 + 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k32*k15*k16 + 2*k11_pw2*k12*k21*k22*k31*k14*k24*k33_pw3*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k24*k33_pw3*k25 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k32*k16*k34 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k24*k35 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k25*k34 - k11*k12*k21*k31*k14*k23_pw3*k32_pw2*k15*k35 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k32*k15*k34 + 12*k11*k21*k13*k22*k31_pw3*k14*k23_pw2*k16*k34 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k25*k26 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k24*k33*k26 - 2*k11*k21_pw2*k13*k31_pw3*k23*k32*k15*k24*k16 - 2*k11*k21_pw2*k13*k22*k31_pw3*k32*k15*k16*k25 - 2*k11*k21_pw2*k13*k22*k31_pw3*k15*k24*k33*k16 + 2*k11*k21_pw2*k13*k31*k14*k23*k32_pw3*k15*k26 + 8*k11*k12*k21_pw2*k13*k31_pw3*k32*k24*k16*k26 + 8*k11*k12*k21_pw2*k13*k31_pw3*k24*k33*k16*k25 - 2*k11*k12*k21_pw2*k31*k14*k23*k32_pw3*k16*k26 - k11*k12*k21*k22_pw3*k31*k14*k15*k33_pw2*k36 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k25*k36 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k26*k35 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k24*k36 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k25*k35 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k34*k26 + 12*k11*k21*k13*k22_pw2*k31_pw3*k14*k23*k16*k35 - 2*k11_pw2*k12*k21*k31_pw3*k23*k32*k24*k16*k26 - 2*k11_pw2*k12*k21*k31_pw3*k23*k24*k33*k16*k25 - 12*k11_pw2*k12*k21*k13*k31_pw3*k24*k33*k25*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k32*k16*k25*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k24*k33*k16*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k24*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k15*k24*k33*k25 - 2*k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k25*k26 - 2*k11_pw2*k21*k13*k22*k31_pw3*k15*k24*k33*k26 + 8*k11_pw2*k21*k22*k31_pw3*k23*k32*k15*k16*k25 + 8*k11_pw2*k21*k22*k31_pw3*k23*k15*k24*k33*k16 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k25*k36 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k26*k35 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k25*k34*k26 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k24*k26*k36 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k25*k26*k35 - 2*k11*k12*k21*k22_pw3*k31_pw2*k14*k33*k16*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k34*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k34*k35 + 2*k11*k21*k13*k22_pw3*k31_pw2*k14*k15*k33*k36 + 6*k21_pw3*k13*k22*k31*k14*k32_pw2*k15*k33*k16 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k24*k16*k35 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k25*k34 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k24*k16*k36 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k25*k35 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k34*k26 + 12*k11*k21_pw3*k31*k14*k32*k15*k24*k33_pw2*k16 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k24*k16*k35 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k25*k34 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k25*k36 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k26*k35 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k25*k34*k26 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k24*k16*k36 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k25*k35 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k34*k26 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k25*k36 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k26*k35 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k25*k34*k26 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k24*k26*k36 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k25*k26*k35 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k25*k36 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k26*k35 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k25*k34*k26 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k24*k26*k36 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k25*k26*k35 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k24*k16*k36 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k25*k35 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k34*k26 - 4*k21_pw3*k13*k22*k31*k14*k32*k15_pw2*k33*k35 - 4*k21_pw3*k13*k31*k14*k23*k32*k15_pw2*k33*k34 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k24*k26*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k25*k26*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k25*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k26*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k33*k25*k34*k26 + 2*k11*k12_pw3*k21*k22*k31_pw2*k32*k25*k26*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k24*k33*k26*k36 + 2*k11*k12_pw3*k21*k22*k31_pw2*k33*k25*k26*k35 + 12*k11*k21_pw3*k31*k14*k32_pw2*k15*k33*k16*k25 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k25*k34 + 4*k12*k21_pw3*k13*k31*k14*k15*k24*k33_pw2*k35 - 4*k12*k21_pw3*k22*k31*k14*k15*k33_pw2*k16*k34 + 8*k11_pw3*k22*k31_pw2*k14*k23*k32*k33*k25*k26 - 2*k21_pw3*k13*k31_pw2*k14*k23*k32*k15*k16*k34 - 2*k21_pw3*k13*k22*k31_pw2*k14*k32*k15*k16*k35 - 2*k21_pw3*k13*k22*k31_pw2*k14*k15*k33*k16*k34 + 8*k21_pw3*k13*k22*k31*k14_pw2*k32*k33*k16*k35 + 8*k21_pw3*k13*k31*k14_pw2*k23*k32*k33*k16*k34 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k24*k33*k36 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k25*k35 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k34*k26 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k24*k16*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k25*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k34*k26 - 4*k12*k21_pw3*k13*k31_pw2*k14*k24*k33*k16*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k25*k34 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k25*k36 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k26*k35 - 4*k12*k21_pw3*k22*k31*k14*k32_pw2*k15*k16*k36 - 4*k12*k21_pw3*k31*k14*k23*k32_pw2*k15*k16*k35 + 8*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k35*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k24*k16*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k25*k35 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k34*k26 - 4*k11*k21_pw3*k31_pw2*k14*k15*k24*k33*k16*k35 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k25*k34 + 16*k11*k21_pw3*k31*k14_pw2*k32*k24*k33*k16*k36 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k25*k35 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k34*k26 + 6*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k34*k36 + 6*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k35*k36 + 6*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k34*k35 + 6*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k34*k36 - 2*k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k35*k36 - 2*k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k34*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k34*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k34*k35 + 8*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k34*k35 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k35*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k34*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k34*k26*k35 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k34*k26*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k34*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k34*k26*k35 + 8*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k34*k36 - 2*k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k35*k36 - 2*k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k34*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k34*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k34*k35 + 2*k12_pw3*k21_pw2*k22*k31*k14*k32*k26*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k35*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k34*k26*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k34*k26*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k34*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k34*k26*k35 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k34*k26*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k34*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k34*k26*k35 - 4*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k34*k36 - 4*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k34*k26*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k34*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k34*k26*k35 - 12*k12*k21_pw3*k31*k14_pw2*k23*k15*k34*k35*k36 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k33*k25_pw2 + k11*k12*k21*k13*k22_pw2*k31_pw2*k15*k33_pw2*k25 + k11*k12*k21*k13*k31_pw2*k23_pw2*k32_pw2*k15*k25 - 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k32_pw2*k15*k16 + 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k24*k33_pw2 - 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32_pw2*k16 + 3*k11_pw2*k12*k21*k22*k31*k14*k32_pw2*k33*k26_pw2+ 3*k11_pw2*k12*k21*k31*k14*k23*k32*k33_pw2*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k24*k33_pw2*k25 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k24*k33_pw2*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k24*k33_pw2*k16 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k32*k36_pw2+ 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k15_pw2*k33*k34 + 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k32*k15_pw2*k35 + 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k35_pw2+ 4*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32*k24*k33 + 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32_pw2*k26 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k33*k25_pw2 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k33*k25_pw2 + 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k24*k33*k16 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k32_pw2*k16*k26 - 2*k11*k21_pw2*k13*k31_pw2*k23*k32*k15_pw2*k24*k33 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k24*k33_pw2*k16 - 2*k11*k21_pw2*k13*k22*k31_pw2*k32*k15_pw2*k33*k25 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k34*k26_pw2+ 2*k11*k12*k21_pw2*k22*k31_pw2*k15*k24*k33_pw2*k16 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k15_pw2*k33*k35 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k32*k15_pw2*k36 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k32*k33*k26 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32*k33_pw2*k25 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32*k24*k33_pw2 - 3*k12*k21_pw2*k13*k22_pw2*k31*k14*k32*k33_pw2*k16 + 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k32_pw2*k15*k16 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k34*k26_pw2- 2*k11_pw2*k12*k21*k31_pw2*k23*k15*k24*k33_pw2*k25 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k26_pw2*k35 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k34*k26_pw2- 2*k11_pw2*k12*k21*k22*k31_pw2*k15*k24*k33_pw2*k26 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k24*k33_pw2*k25 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k24*k33_pw2*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k24*k33_pw2*k16 - 6*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32*k33*k25 + 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k33*k16*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k25*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k24*k33_pw2*k35 - 6*k11*k21_pw2*k22_pw2*k31*k14*k32*k15*k33_pw2*k16 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k32_pw2*k16*k25 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k32_pw2*k16*k26 + 4*k11*k21_pw2*k22*k31*k14*k23*k15_pw2*k33_pw2*k34 + 2*k11*k12*k21_pw2*k31_pw2*k23*k32_pw2*k15*k16*k25 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25_pw2*k36 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25_pw2*k35 + 2*k11*k12*k21_pw2*k22*k31_pw2*k32_pw2*k15*k16*k26 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k24*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k25*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k24*k33*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k24*k36_pw2- 2*k12*k21_pw2*k13_pw2*k31_pw2*k23*k32*k15*k24*k33 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw2*k32*k15*k33*k25 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32_pw2*k33*k26 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw2*k33*k25 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k32*k15*k33*k16 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k15_pw2*k33*k34 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k32*k15_pw2*k35 - 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k35_pw2- 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25_pw2*k36 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25_pw2*k35 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k25*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25_pw2*k36 - 8*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k24*k33*k16 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k25*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32_pw2*k16*k26 - 6*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k32*k33*k26 - 2*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k24*k33*k16 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k33*k16*k25 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k25*k36 + k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k26*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k24*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k25*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k34*k26 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k24*k33*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k25*k34 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k25*k36 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k26*k35 - 8*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k24*k33*k26 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k25*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k34*k26 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k24*k33_pw2*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k25*k34 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k24*k33_pw2*k35 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k33_pw2*k16*k34 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k35_pw2+ 4*k11*k21_pw2*k22*k31*k14*k23*k32_pw2*k15_pw2*k36 + 4*k11*k21_pw2*k31*k14*k23_pw2*k32*k15_pw2*k33*k34 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k35_pw2- k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k24*k33*k35 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k25*k34 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k24*k36 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k25*k35 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k34*k26 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k24*k33*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k25*k35 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k34*k26 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k26*k35_pw2- k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k25*k36 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k26*k35 - 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k26*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k26*k35_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k35_pw2- 12*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k34*k36 + k12*k21_pw2*k13*k22_pw2*k31*k14*k15*k33_pw2*k35 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k32*k16*k34 + k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw2*k15*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k25*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k26*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k24*k33*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k25*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k34*k26 - 8*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k33*k16*k26 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k25*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k34*k26 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k24*k33_pw2*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k25*k34 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k24*k33_pw2*k35 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k33_pw2*k16*k34 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k35_pw2- 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32*k15*k35 - 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k15*k33*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k32*k24*k33*k16*k26 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k32*k15*k26*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k25*k36 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k26*k35 + 4*k11*k21_pw2*k22_pw2*k31*k14*k32*k15_pw2*k33*k36 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32*k15*k16*k34 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k32_pw2*k26*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k25*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k26*k35 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32*k15*k33_pw2*k35 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k32_pw2*k16*k36 - 8*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k33*k16*k34 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k25*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k34*k26 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k24*k33_pw2*k36 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k25*k36 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k26*k35 - 12*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k35*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k24*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k25*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k34*k26 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k24*k33*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k25*k34 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k25*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k26*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k24*k33*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k25*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k34*k26 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k32*k16*k36 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k33*k16*k35 - 12*k11_pw2*k21_pw2*k31*k14*k32*k15*k24*k33_pw2*k26 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k32*k26*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k25*k36 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k26*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k24*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k25*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k34*k26 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k24*k33*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k25*k34 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k24*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k25*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k34*k26 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k24*k33*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k25*k34 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k25*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k26*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k24*k33*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k25*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k34*k26 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k32_pw2*k26*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k25*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k26*k35 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k32*k15*k16*k35 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15*k33*k16*k34 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32_pw2*k16*k36 + 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k33*k16*k34 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k32*k15*k16*k36 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15*k33*k16*k35 - 8*k11*k21_pw2*k22_pw2*k31*k14_pw2*k32*k33*k16*k36 - 8*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k34*k36 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32_pw2*k15*k33*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k25*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k26*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32_pw2*k33*k26*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k34*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k34*k35 + 24*k11_pw2*k21_pw2*k31_pw2*k14*k32*k24*k33*k16*k26 - 12*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k33*k25*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k32*k15*k26*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k25*k36 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k26*k35 + 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k32*k33*k16*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k24*k26*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25*k26*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k25*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k26*k35 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25*k34*k26 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k35*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k34*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k34*k26*k35 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k35*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k34*k26*k36 + 24*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k34*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k34*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k34*k35 - 2*k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k35*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k35*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k34*k26*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k35*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k34*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k34*k26*k35 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k35*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k34*k26*k36 - 8*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k34*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k34*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k34*k35 + 2*k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k35*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k24*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k25*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k26*k35 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25*k34*k26 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k24*k33*k26*k36 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25*k26*k35 - 2*k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k35*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k26*k35*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k34*k26*k36 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k15*k24*k33_pw2 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32*k24*k33_pw2 + 9*k11*k12*k21*k22_pw2*k31*k14*k23*k32*k33_pw2*k16 - 3*k11*k12*k21*k13*k22_pw2*k31*k14*k32*k33_pw2*k26 + 2*k11*k12*k21*k13*k31_pw2*k23_pw2*k32*k15*k24*k33 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k32_pw2*k15*k26 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw2*k33*k25 + 9*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw2*k33*k16 - 6*k11*k12*k21*k22_pw2*k31_pw2*k23*k32*k15*k33*k16 + 2*k11*k12*k21*k13*k22_pw2*k31_pw2*k32*k15*k33*k26 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k15*k33_pw2*k34 + 8*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32*k33*k25 - 12*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32*k33*k16 - 4*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k24*k33*k26 - 4*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k33*k25*k26 + 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k33*k16*k25 + 6*k11*k21_pw2*k13*k22*k31*k14*k32*k15*k33_pw2*k25 + 6*k11*k21_pw2*k13*k31*k14*k23*k32*k15*k24*k33_pw2 - 6*k11*k12*k21_pw2*k22*k31*k14*k32*k33_pw2*k16*k25 - 6*k11*k12*k21_pw2*k31*k14*k23*k32*k24*k33_pw2*k16 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k15*k33_pw2*k35 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k32*k16*k35 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k33*k16*k34 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k32_pw2*k15*k36 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32*k15*k35 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k15*k33*k34 - 6*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw2*k33*k16 + 6*k11_pw2*k12*k21*k22*k31*k14*k32*k33_pw2*k25*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32*k24*k33_pw2*k26 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k25*k35 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k34*k26 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k24*k33_pw2*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k24*k33*k16 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k33*k16*k25 + 6*k11*k21_pw2*k13*k22*k31*k14*k32_pw2*k15*k33*k26 + 6*k11*k21_pw2*k13*k31*k14*k23*k32_pw2*k15*k33*k25 - 12*k11*k21_pw2*k22*k31*k14*k23*k32_pw2*k15*k33*k16 + 4*k11*k12*k21_pw2*k31_pw2*k23*k32*k15*k24*k33*k16 + 4*k11*k12*k21_pw2*k22*k31_pw2*k32*k15*k33*k16*k25 - 6*k11*k12*k21_pw2*k22*k31*k14*k32_pw2*k33*k16*k26 - 6*k11*k12*k21_pw2*k31*k14*k23*k32_pw2*k33*k16*k25 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k32*k16*k36 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k33*k16*k35 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k32*k15*k36 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k15*k33*k35 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k15*k33_pw2*k34 - 4*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k24*k33*k26 - 4*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k33*k25*k26 + 6*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k33*k25*k26 + 4*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k24*k33*k26 + 4*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k33*k25*k26 - 16*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k33*k16*k25 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k25*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k26*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k24*k33*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k25*k35 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k34*k26 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k32_pw2*k26*k36 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k24*k33*k36 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k25*k35 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k34*k26 + 8*k11*k21_pw2*k22*k31*k14*k23*k32*k15_pw2*k33*k35 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k35*k36 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k34*k36 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k32*k16*k35 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k33*k16*k34 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k32_pw2*k15*k36 + 2*k12*k21_pw2*k13*k31*k14*k23_pw2*k32*k15*k33*k34 + 2*k11*k12_pw2*k21*k22_pw2*k31*k14*k32*k33*k26*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k24*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k25*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k34*k26 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k24*k33*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k25*k34 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k25*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k26*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k24*k33*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k25*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k34*k26 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k25*k36 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k26*k35 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k24*k33*k36 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k25*k35 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k34*k26 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k32*k15*k16*k35 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15*k33*k16*k34 - 16*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k33*k16*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k24*k16*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k25*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k34*k26 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k24*k33*k16*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k25*k34 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k24*k26*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25*k26*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k25*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k26*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25*k34*k26 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k25*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k26*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k24*k33*k16*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k25*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k34*k26 + 6*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k35*k36 + 2*k12*k21_pw2*k13*k22_pw2*k31*k14*k32*k15*k33*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k24*k26*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25*k26*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k25*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k26*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25*k34*k26 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k25*k26*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k24*k33*k26*k36 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25*k26*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k25*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k26*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k24*k33*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k25*k35 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k34*k26 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k25*k36 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k26*k35 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k24*k33*k36 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k25*k35 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k34*k26 + 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k33*k16*k35 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k35*k36 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k34*k36 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k35*k36 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k34*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k35*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k34*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k34*k26*k35 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k35*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k34*k26*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k26*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k34*k26*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k34*k26*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k34*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k34*k26*k35 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k35*k36 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k34*k36 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k24*k33_pw3 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k32*k16*k25 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k24*k33*k16 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k24*k36 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k25*k35 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k34*k26 - 2*k11*k12*k21*k31*k14*k23_pw3*k32*k15*k33*k34 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k24*k33*k36 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k25*k35 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k34*k26 - 8*k12*k21_pw3*k22*k31*k14*k32*k15*k33*k16*k35 - 8*k12*k21_pw3*k31*k14*k23*k32*k15*k33*k16*k34 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32*k33_pw2*k25 + 4*k11*k12*k21*k13*k22*k31_pw2*k23*k32*k15*k33*k25 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32_pw2*k33*k26 - 6*k11*k12*k21*k22*k31*k14*k23_pw2*k32*k15*k33*k35 - 6*k11*k12*k21*k22_pw2*k31*k14*k23*k32*k15*k33*k36 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k25*k36 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k26*k35 + 4*k12*k21_pw2*k13*k22*k31*k14*k23*k32*k15*k33*k35);
 
     // x^2
-    coeffs.at(2) = (k21_pw2*k13_pw4*k31_pw4*k25_pw2 + 6*k11_pw4*k31_pw4*k25_pw2*k26_pw2+ k21_pw4*k31_pw2*k15_pw4*k35_pw2+ 6*k21_pw4*k14_pw4*k35_pw2*k36_pw2+ 4*k11_pw4*k31_pw4*k24*k26_pw3 + 4*k21_pw4*k14_pw4*k34*k36_pw3 + k11_pw2*k13_pw2*k22_pw2*k31_pw4*k26_pw2+ k11_pw2*k13_pw2*k31_pw4*k23_pw2*k25_pw2 + 6*k11_pw2*k22_pw2*k31_pw4*k23_pw2*k16_pw2 + k21_pw2*k13_pw2*k22_pw2*k31_pw4*k16_pw2 + k11_pw2*k21_pw2*k14_pw2*k33_pw4*k25_pw2 + 6*k11_pw2*k21_pw2*k31_pw4*k16_pw2*k25_pw2 + k11_pw2*k31_pw2*k14_pw2*k23_pw4*k35_pw2+ k21_pw4*k31_pw2*k32_pw2*k15_pw2*k16_pw2 + k12_pw4*k21_pw2*k31_pw2*k25_pw2*k36_pw2+ k12_pw4*k21_pw2*k31_pw2*k26_pw2*k35_pw2+ 6*k21_pw4*k14_pw2*k32_pw2*k33_pw2*k16_pw2 + 6*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k35_pw2+ k21_pw4*k14_pw2*k32_pw2*k15_pw2*k36_pw2+ k21_pw4*k14_pw2*k15_pw2*k33_pw2*k35_pw2- 4*k11*k21_pw3*k31_pw4*k24*k16_pw3 + 2*k21_pw2*k13_pw4*k31_pw4*k24*k26 - 4*k21_pw4*k31_pw3*k14*k16_pw3*k34 + 2*k21_pw4*k31_pw2*k15_pw4*k34*k36 + 2*k11*k21_pw2*k22_pw2*k31_pw4*k16_pw3 + k11_pw2*k31_pw3*k23_pw4*k15_pw2*k34 + k21_pw3*k13_pw2*k14_pw2*k24*k33_pw4 + 2*k21_pw3*k13_pw2*k31_pw4*k24*k16_pw2 + 2*k21_pw4*k31_pw2*k14*k32_pw2*k16_pw3 + 2*k11_pw3*k22_pw2*k31_pw4*k16*k26_pw2+ 2*k11_pw3*k31_pw4*k23_pw2*k16*k25_pw2 + 2*k21_pw4*k31_pw3*k15_pw2*k16_pw2*k34 + 2*k21_pw4*k14_pw3*k32_pw2*k16*k36_pw2+ 2*k21_pw4*k14_pw3*k33_pw2*k16*k35_pw2- 2*k11*k21*k13_pw3*k31_pw4*k23*k25_pw2 + k11_pw3*k12*k22*k31_pw3*k32*k26_pw3 + k12*k21_pw3*k22*k31_pw3*k32*k16_pw3 - 2*k11_pw2*k13*k31_pw4*k23_pw3*k24*k16 + 4*k11_pw3*k21*k31_pw3*k14*k34*k26_pw3 - 6*k11_pw3*k13*k31_pw4*k23*k24*k26_pw2- 6*k11_pw3*k13*k22*k31_pw4*k25*k26_pw2- 2*k21_pw2*k13_pw3*k31_pw4*k23*k24*k16 - 2*k21_pw2*k13_pw3*k22*k31_pw4*k16*k25 - 2*k11*k21_pw3*k14_pw2*k24*k33_pw4*k16 + 4*k11*k21_pw3*k31*k14_pw3*k24*k36_pw3 + k12*k21_pw3*k22*k14_pw3*k32*k36_pw3 - 2*k11_pw2*k31_pw3*k14*k23_pw4*k16*k34 - 12*k11_pw3*k21*k31_pw4*k24*k16*k26_pw2- 6*k11_pw3*k13*k31_pw4*k23*k25_pw2*k26 - 12*k11_pw3*k21*k31_pw4*k16*k25_pw2*k26 + 4*k11_pw3*k31_pw4*k23_pw2*k24*k16*k26 - 2*k21_pw4*k31*k14*k15_pw3*k33*k35_pw2- 2*k21_pw4*k31_pw2*k15_pw3*k33*k16*k34 - 2*k21_pw4*k31_pw2*k32*k15_pw3*k16*k35 - 2*k21_pw4*k14_pw2*k15*k33_pw3*k16*k34 - 12*k21_pw4*k31*k14_pw3*k16*k34*k36_pw2- 6*k21_pw4*k14_pw3*k32*k15*k35*k36_pw2- 6*k21_pw4*k14_pw3*k15*k33*k34*k36_pw2- 12*k21_pw4*k31*k14_pw3*k16*k35_pw2*k36 + 4*k21_pw4*k14_pw3*k33_pw2*k16*k34*k36 - 6*k21_pw4*k14_pw3*k15*k33*k35_pw2*k36 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k26_pw2+ k12_pw2*k21_pw2*k13_pw2*k31_pw2*k33_pw2*k25_pw2 + k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k26_pw2+ k11_pw2*k21_pw2*k31_pw2*k15_pw2*k33_pw2*k25_pw2 + 6*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k33_pw2*k26_pw2+ 6*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k36_pw2+ k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k36_pw2+ k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k35_pw2+ k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k36_pw2+ k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k35_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k36_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k26_pw2*k35_pw2- 2*k11_pw2*k12_pw2*k21*k31_pw3*k34*k26_pw3 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k24*k26_pw2- 4*k11_pw2*k21*k31_pw4*k23_pw2*k24*k16_pw2 - 2*k11_pw3*k21*k31_pw2*k14*k32_pw2*k26_pw3 - 4*k11*k21_pw2*k13_pw2*k31_pw4*k16*k25_pw2 + k11*k21_pw2*k22_pw2*k14_pw2*k33_pw4*k16 - 2*k11*k21_pw2*k22_pw2*k31*k14_pw3*k36_pw3 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k33*k25_pw2 + k11_pw2*k31_pw2*k14*k23_pw4*k32_pw2*k16 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k25_pw2*k26 - 4*k11_pw2*k21*k22_pw2*k31_pw4*k16_pw2*k26 + 2*k11_pw2*k13_pw2*k31_pw4*k23_pw2*k24*k26 + 4*k11_pw2*k22*k31_pw3*k23_pw3*k15_pw2*k35 - 2*k12*k21_pw3*k31_pw2*k23*k15_pw3*k35_pw2+ 2*k11_pw2*k21_pw2*k14_pw2*k24*k33_pw4*k26 + 12*k11_pw2*k21_pw2*k31_pw4*k24*k16_pw2*k26 - k11_pw3*k22_pw2*k31_pw3*k15*k33*k26_pw2- k11_pw3*k31_pw3*k23_pw2*k15*k33*k25_pw2 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k24*k36_pw3 + 4*k21_pw3*k13_pw2*k14_pw2*k32*k33_pw3*k25 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k34*k26_pw2- k21_pw3*k13*k14_pw3*k23*k32_pw2*k36_pw2- k21_pw3*k13*k14_pw3*k23*k33_pw2*k35_pw2- 2*k11*k21_pw3*k14_pw3*k24*k33_pw2*k36_pw2+ 2*k11_pw2*k31_pw2*k14_pw2*k23_pw4*k34*k36 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k26_pw2*k36 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k25_pw2*k36 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k25*k35 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k34*k26 - 2*k12_pw2*k21_pw3*k31_pw3*k24*k16_pw2*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k24*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k25*k35 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k34*k26 - 4*k21_pw4*k31*k14_pw2*k33_pw2*k16_pw2*k34 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k26*k36_pw2- 2*k11*k21_pw3*k14_pw3*k33_pw2*k26*k35_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k24*k26*k36_pw2- 4*k21_pw4*k31_pw2*k14*k15_pw2*k16*k35_pw2- 4*k21_pw4*k31*k14_pw2*k32_pw2*k16_pw2*k36 + 2*k12_pw4*k21_pw2*k31_pw2*k34*k26_pw2*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k34*k36_pw2+ 12*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k34*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k35_pw2*k36 + 2*k21_pw4*k14_pw2*k15_pw2*k33_pw2*k34*k36 + k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k26_pw3 + k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k36_pw3 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k34*k26_pw2+ k11_pw3*k22_pw2*k31_pw2*k14*k33_pw2*k26_pw2+ k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k26_pw2+ k11_pw3*k31_pw2*k14*k23_pw2*k33_pw2*k25_pw2 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k34*k26_pw2+ k12_pw2*k21_pw2*k31_pw3*k23_pw2*k16_pw2*k34 + k12_pw2*k21_pw3*k31_pw2*k24*k33_pw2*k16_pw2 + k21_pw2*k13_pw2*k31_pw3*k23_pw2*k15_pw2*k34 + k21_pw3*k13_pw2*k31_pw2*k15_pw2*k24*k33_pw2 + k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k36_pw2+ k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k36_pw2+ k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k35_pw2+ k11_pw2*k12_pw2*k22_pw2*k31_pw3*k26_pw2*k36 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k34*k26_pw2+ 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k15_pw2*k36 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25_pw2*k36 + k12_pw2*k21_pw2*k22_pw2*k31_pw3*k16_pw2*k36 + k12_pw2*k21_pw3*k31_pw2*k32_pw2*k16_pw2*k26 + k21_pw2*k13_pw2*k22_pw2*k31_pw3*k15_pw2*k36 + k21_pw3*k13_pw2*k31_pw2*k32_pw2*k15_pw2*k26 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25_pw2*k36 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k36_pw2+ 6*k21_pw3*k13_pw2*k14_pw2*k32_pw2*k33_pw2*k26 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k26*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k26*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k32_pw2*k26*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k26*k35_pw2- 6*k11*k21*k13*k22_pw2*k31_pw4*k23*k16_pw2 - k11*k21_pw2*k13*k14_pw2*k23*k24*k33_pw4 + 2*k11*k21_pw2*k13*k31_pw4*k23*k24*k16_pw2 - k11*k21_pw2*k13*k22*k14_pw2*k33_pw4*k25 + 2*k11*k21_pw2*k13*k22*k31_pw4*k16_pw2*k25 + 4*k11*k21*k13_pw2*k31_pw4*k23_pw2*k24*k16 - 2*k11*k21*k13*k31_pw3*k23_pw3*k15_pw2*k34 + 2*k11_pw2*k21*k13*k31_pw4*k23*k16*k25_pw2 - 8*k11_pw2*k21*k22*k31_pw4*k23*k16_pw2*k25 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw4*k16*k26 + k11_pw2*k12*k31_pw3*k23_pw3*k32*k16*k25 + k11_pw2*k12*k31_pw3*k23_pw3*k24*k33*k16 + k11_pw2*k13*k31_pw3*k23_pw3*k32*k15*k25 + k11_pw2*k13*k31_pw3*k23_pw3*k15*k24*k33 - 6*k11_pw2*k13*k22*k31_pw4*k23_pw2*k16*k25 - 4*k11_pw2*k22*k31_pw3*k23_pw3*k32*k15*k16 + 3*k21_pw3*k13*k22*k31_pw3*k32*k15*k16_pw2 - 2*k12*k21_pw3*k13*k31_pw3*k32*k16_pw2*k25 - 2*k12*k21_pw3*k13*k31_pw3*k24*k33*k16_pw2 + 4*k11_pw2*k13_pw2*k22*k31_pw4*k23*k25*k26 - 6*k11_pw2*k13*k22_pw2*k31_pw4*k23*k16*k26 + 3*k11_pw3*k12*k31_pw3*k23*k32*k25*k26_pw2+ 3*k11_pw3*k12*k31_pw3*k23*k24*k33*k26_pw2+ 3*k11_pw3*k12*k22*k31_pw3*k33*k25*k26_pw2- 2*k11_pw3*k22*k31_pw3*k23*k32*k15*k26_pw2+ k21_pw2*k13_pw3*k31_pw3*k23*k32*k15*k25 + k21_pw2*k13_pw3*k31_pw3*k23*k15*k24*k33 + k21_pw2*k13_pw3*k22*k31_pw3*k32*k15*k26 + k21_pw2*k13_pw3*k22*k31_pw3*k15*k33*k25 - 2*k21_pw3*k13_pw2*k31*k14*k15*k24*k33_pw3 - 4*k21_pw3*k13*k22*k14_pw2*k32*k33_pw3*k16 - 8*k11*k21_pw2*k13_pw2*k31_pw4*k24*k16*k26 + 6*k11*k21_pw3*k31_pw3*k32*k15*k16_pw2*k25 + 6*k11*k21_pw3*k31_pw3*k15*k24*k33*k16_pw2 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k32*k25*k26 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k24*k33*k26 - k11_pw2*k31_pw2*k14*k23_pw4*k32*k15*k35 - k11_pw2*k31_pw2*k14*k23_pw4*k15*k33*k34 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k24*k36 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k25*k35 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k34*k26 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k24*k36 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k25*k35 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k34*k26 - 8*k11_pw2*k22*k31_pw3*k14*k23_pw3*k16*k35 + 3*k11_pw3*k12*k31_pw3*k23*k33*k25_pw2*k26 + 6*k11_pw3*k21*k31_pw3*k32*k15*k25*k26_pw2+ 6*k11_pw3*k21*k31_pw3*k15*k24*k33*k26_pw2+ k21_pw3*k13*k31_pw2*k23*k15_pw3*k33*k34 + k21_pw3*k13*k31_pw2*k23*k32*k15_pw3*k35 + 6*k21_pw3*k13*k31_pw3*k14*k23*k16_pw2*k34 + k21_pw3*k13*k22*k31_pw2*k15_pw3*k33*k35 + k21_pw3*k13*k22*k31_pw2*k32*k15_pw3*k36 + 6*k21_pw3*k13*k22*k31_pw3*k14*k16_pw2*k35 - 8*k11*k21_pw3*k14_pw2*k32*k33_pw3*k16*k25 - 2*k12*k21_pw3*k31_pw3*k23*k15*k16_pw2*k34 - 2*k12*k21_pw3*k22*k31_pw3*k15*k16_pw2*k35 + 6*k11_pw3*k21*k31_pw3*k15*k33*k25_pw2*k26 - 4*k11_pw3*k22*k31_pw3*k14*k23*k26_pw2*k35 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k24*k36 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k25*k35 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k34*k26 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k25*k36 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k26*k35 - 2*k21_pw3*k13_pw2*k31_pw3*k32*k15*k16*k25 - 2*k21_pw3*k13_pw2*k31_pw3*k15*k24*k33*k16 - 2*k21_pw3*k13*k31_pw3*k23*k15_pw2*k16*k34 + k21_pw3*k13*k14_pw2*k23*k15*k33_pw3*k34 - 2*k21_pw3*k13*k22*k31_pw3*k15_pw2*k16*k35 + k21_pw3*k13*k22*k14_pw2*k15*k33_pw3*k35 - 2*k21_pw3*k13*k22*k14_pw3*k32*k33*k36_pw2- 6*k21_pw4*k31*k14*k32_pw2*k15*k33*k16_pw2 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k24*k33*k36 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k25*k35 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k34*k26 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k25*k36 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k26*k35 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k25*k35 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k34*k26 + 12*k11*k21_pw3*k31_pw3*k14*k24*k16_pw2*k36 + k12*k21_pw3*k14_pw2*k23*k33_pw3*k16*k34 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k25*k35 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k34*k26 - 2*k12*k21_pw3*k13*k14_pw2*k24*k33_pw3*k36 + k12*k21_pw3*k22*k14_pw2*k33_pw3*k16*k35 - 2*k11_pw3*k31_pw3*k23_pw2*k32*k15*k25*k26 - 2*k11_pw3*k31_pw3*k23_pw2*k15*k24*k33*k26 + 12*k11_pw3*k21*k31_pw3*k14*k24*k26_pw2*k36 + 12*k11_pw3*k21*k31_pw3*k14*k25*k26_pw2*k35 + 6*k21_pw3*k13*k22*k31*k14_pw3*k35*k36_pw2+ 6*k21_pw3*k13*k31*k14_pw3*k23*k34*k36_pw2- 4*k11*k21_pw3*k31_pw3*k15_pw2*k24*k16*k36 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k25*k35 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k34*k26 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k25*k35 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k34*k26 + 2*k11*k21_pw3*k14_pw2*k15*k24*k33_pw3*k36 - 4*k11*k21_pw3*k14_pw3*k32*k33*k25*k36_pw2- 4*k12*k21_pw3*k31_pw2*k23*k15_pw3*k34*k36 - 4*k12*k21_pw3*k22*k31_pw2*k15_pw3*k35*k36 + 12*k11_pw3*k21*k31_pw3*k14*k25_pw2*k26*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k24*k16*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k25*k35 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k34*k26 + 6*k21_pw3*k13*k31*k14_pw3*k23*k35_pw2*k36 + 2*k21_pw4*k31_pw2*k14*k32*k15*k16_pw2*k35 + 2*k21_pw4*k31_pw2*k14*k15*k33*k16_pw2*k34 - 8*k21_pw4*k31*k14_pw2*k32*k33*k16_pw2*k35 + 4*k21_pw4*k31*k14*k15_pw2*k33_pw2*k16*k34 + 12*k11*k21_pw3*k31*k14_pw3*k25*k35*k36_pw2+ 12*k11*k21_pw3*k31*k14_pw3*k34*k26*k36_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k32*k35*k36_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k33*k34*k36_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k33*k35*k36_pw2- 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k26*k36 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k25*k26*k35 - 2*k21_pw3*k13*k14_pw3*k23*k33_pw2*k34*k36 - 2*k21_pw3*k13*k22*k14_pw3*k33_pw2*k35*k36 + 2*k21_pw4*k31*k14_pw2*k15*k33*k16*k35_pw2+ 4*k21_pw4*k31*k14*k32_pw2*k15_pw2*k16*k36 + 12*k11*k21_pw3*k31*k14_pw3*k26*k35_pw2*k36 + 3*k12*k21_pw3*k14_pw3*k23*k33*k35_pw2*k36 - 6*k21_pw4*k14_pw2*k32*k15*k33_pw2*k16*k35 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k25*k35*k36 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k34*k26*k36 - 8*k21_pw4*k31_pw2*k14*k15_pw2*k16*k34*k36 - 6*k21_pw4*k14_pw2*k32_pw2*k15*k33*k16*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k25*k26*k35*k36 + 4*k21_pw4*k14_pw2*k32*k15_pw2*k33*k35*k36 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k33*k26_pw2- k11_pw2*k12*k13*k31_pw3*k23_pw2*k33*k25_pw2 - 2*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k35_pw2- k12*k21_pw2*k13*k22_pw2*k31_pw3*k33*k16_pw2 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k24*k33_pw2 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k15*k33*k25_pw2 - 3*k11*k21_pw2*k22_pw2*k31_pw3*k15*k33*k16_pw2 - 2*k11_pw2*k21_pw2*k31*k14*k15*k33_pw3*k25_pw2 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k32_pw2*k26 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k24*k33_pw2 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k33_pw2*k25 - 3*k21_pw3*k13*k31_pw2*k14*k23*k32_pw2*k16_pw2 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k34*k26_pw2- k11*k21_pw2*k31_pw2*k23_pw2*k15_pw3*k33*k34 - k11*k21_pw2*k31_pw2*k23_pw2*k32*k15_pw3*k35 - 6*k11*k21_pw2*k31_pw3*k14*k23_pw2*k16_pw2*k34 - 6*k11*k21_pw3*k31_pw2*k14*k24*k33_pw2*k16_pw2 - k12*k21_pw3*k31_pw2*k23*k32_pw2*k15*k16_pw2 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k26_pw2*k35 - 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k15*k33*k16 - 6*k11_pw3*k21*k31_pw2*k14*k24*k33_pw2*k26_pw2+ 2*k12_pw2*k21_pw2*k22*k31_pw3*k23*k16_pw2*k35 - k21_pw2*k13_pw2*k22_pw2*k31_pw3*k15*k33*k16 + 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k15_pw2*k35 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k32_pw2*k26 - k21_pw3*k13*k31_pw2*k23*k32_pw2*k15_pw2*k16 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k34*k26_pw2+ 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25_pw2*k36 - k11*k21_pw2*k22_pw2*k31_pw2*k15_pw3*k33*k36 - 6*k11*k21_pw2*k22_pw2*k31_pw3*k14*k16_pw2*k36 + 2*k11*k21_pw2*k31_pw3*k23_pw2*k15_pw2*k16*k34 - k11*k21_pw2*k14_pw2*k23_pw2*k15*k33_pw3*k34 - 2*k11*k21_pw3*k31_pw2*k15_pw2*k24*k33_pw2*k16 - 6*k11*k21_pw3*k31_pw2*k14*k32_pw2*k16_pw2*k26 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k26_pw2*k36 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25*k26_pw2*k35 - 6*k11_pw2*k21_pw2*k31_pw3*k15*k33*k16*k25_pw2 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k24*k36 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k25*k35 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k34*k26 - 6*k11_pw3*k21*k31_pw2*k14*k33_pw2*k25_pw2*k26 + 2*k12_pw2*k21_pw3*k31_pw2*k32*k33*k16_pw2*k25 - 2*k21_pw2*k13_pw2*k31_pw3*k14*k23_pw2*k16*k34 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k26_pw2*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k34*k26_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14*k24*k33_pw2*k16 + 2*k21_pw3*k13_pw2*k31_pw2*k32*k15_pw2*k33*k25 + 2*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k35_pw2- 6*k21_pw3*k13*k14_pw2*k23*k32_pw2*k33_pw2*k16 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25_pw2*k36 + 2*k11*k21_pw2*k22_pw2*k31_pw3*k15_pw2*k16*k36 - k11*k21_pw2*k22_pw2*k14_pw2*k15*k33_pw3*k36 - 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34*k36_pw2- 2*k11*k21_pw3*k31_pw2*k32_pw2*k15_pw2*k16*k26 + 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k36_pw2- 6*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw2*k26*k36 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k34*k26_pw2+ 8*k11_pw2*k21_pw2*k14_pw2*k32*k33_pw3*k25*k26 - 12*k11_pw2*k22_pw2*k31_pw3*k14*k23_pw2*k16*k36 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k26*k36 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k24*k33_pw2*k26 - 2*k21_pw2*k13_pw2*k22_pw2*k31_pw3*k14*k16*k36 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k36_pw2- 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25_pw2*k36 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14*k32_pw2*k16*k26 - 6*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k35_pw2- 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k35_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k36_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k26*k35_pw2- 12*k11*k21_pw3*k14_pw2*k32_pw2*k33_pw2*k16*k26 - k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k36_pw2- k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k35_pw2+ 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k26*k36 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25*k26*k35 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25_pw2*k36 + 8*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k35*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k26*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25*k26*k35 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k36_pw2- 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k26*k35_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k25*k35 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k34*k26 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k24*k33_pw2*k36 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k34*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k26*k35_pw2+ 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25*k26*k35 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k26*k35_pw2+ 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k36_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k26*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k35*k36_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k34*k26*k36_pw2+ 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k35*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k34*k26*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k26*k35_pw2*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k35*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k34*k26*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k34*k26*k36 - 4*k11*k21*k13_pw3*k31_pw4*k23*k24*k26 - 4*k11*k21*k13_pw3*k22*k31_pw4*k25*k26 + 8*k11_pw3*k22*k31_pw4*k23*k16*k25*k26 - 4*k21_pw4*k31*k14*k15_pw3*k33*k34*k36 - 4*k21_pw4*k31*k14*k32*k15_pw3*k35*k36 + 8*k21_pw4*k14_pw3*k32*k33*k16*k35*k36 - 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k26_pw2- 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k33_pw2*k25_pw2 + 3*k11*k21_pw2*k22_pw2*k31_pw2*k14*k33_pw2*k16_pw2 + 3*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k16_pw2 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k24*k33_pw2*k26_pw2- 2*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k16*k26_pw2- 2*k11*k12_pw2*k21_pw2*k31_pw2*k33_pw2*k16*k25_pw2 + k11*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k33_pw2*k16 + k11*k21_pw2*k31_pw2*k23_pw2*k32_pw2*k15_pw2*k16 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k33_pw2*k25_pw2*k26 + 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k16 + k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k33_pw2*k16 + k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k36_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k26_pw2*k35_pw2- 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k36_pw2- 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k35_pw2+ 6*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw2*k33_pw2*k16 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k16*k26_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14*k33_pw2*k16*k25_pw2 - 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k36_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k24*k33_pw2*k26 + 6*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k36_pw2+ 6*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k35_pw2+ 2*k11_pw2*k21_pw2*k31_pw2*k15_pw2*k24*k33_pw2*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k34*k26_pw2- 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k26*k36_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k26*k35_pw2- 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k36_pw2- 2*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k35_pw2- 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k26_pw2*k36 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25_pw2*k36 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34*k36_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k26*k36_pw2+ 2*k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k34*k36 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k35_pw2*k36 + 2*k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k34*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k34*k26_pw2*k36 - k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k26_pw2- k11*k12_pw2*k21*k13*k31_pw2*k23*k33_pw2*k25_pw2 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k24*k33_pw2 - k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k26_pw2- k11_pw2*k12*k21*k31_pw2*k23*k15*k33_pw2*k25_pw2 + k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k26_pw2+ k11_pw2*k21*k13*k31_pw2*k14*k23*k33_pw2*k25_pw2 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k24*k33_pw2*k16 - k11*k21_pw2*k13*k31_pw2*k23*k15_pw2*k24*k33_pw2 - k11*k21_pw2*k13*k22*k31_pw2*k15_pw2*k33_pw2*k25 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k33_pw2*k26 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k26 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k36_pw2- 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k33_pw2*k25 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k33_pw2*k16*k26 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k32_pw2*k16*k26 - k11*k21_pw2*k13*k31_pw2*k23*k32_pw2*k15_pw2*k26 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k15*k24*k33_pw2 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k15*k33_pw2*k25 + k12*k21_pw2*k13*k22_pw2*k31_pw2*k15*k33_pw2*k16 + k12*k21_pw2*k13*k31_pw2*k23_pw2*k32_pw2*k15*k16 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k33*k25*k26_pw2- 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k24*k33_pw2*k16 - 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k33_pw2*k26 - k12_pw2*k21_pw2*k13*k31_pw2*k23*k24*k33_pw2*k16 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k33_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k24*k33_pw2*k26 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k36_pw2- 6*k11*k21_pw2*k13*k14_pw2*k23*k32_pw2*k33_pw2*k26 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k36_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k15_pw2*k33_pw2*k34 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k32_pw2*k15*k26 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k36_pw2- k12*k21_pw2*k13*k31_pw2*k23_pw2*k15_pw2*k33*k34 - k12*k21_pw2*k13*k31_pw2*k23_pw2*k32*k15_pw2*k35 - k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k35_pw2- 6*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k33*k26_pw2- 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k33_pw2*k16*k26 - 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32_pw2*k16*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k36_pw2- k12_pw2*k21_pw2*k13*k31_pw2*k23*k32_pw2*k16*k26 + 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k36_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k26_pw2*k35 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k34*k26_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k24*k33_pw2*k16*k26 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k36_pw2+ 2*k11*k21_pw2*k22_pw2*k31*k14*k15_pw2*k33_pw2*k36 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k26*k35_pw2- 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k33_pw2*k16*k34 + k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k35_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k32_pw2*k15_pw2*k36 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k15_pw2*k33*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k33*k25*k26 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k26*k35_pw2+ k12_pw2*k21_pw2*k31*k14*k23_pw2*k33_pw2*k16*k34 - k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k35_pw2- k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32*k15*k35 - k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k15*k33*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k26*k36_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25_pw2*k36 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k33_pw2*k16*k36 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32*k15*k33_pw2*k35 - 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32_pw2*k16*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k26_pw2*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k34*k26_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14*k24*k33_pw2*k16*k26 + 4*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k33*k25*k26 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k26_pw2*k35 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k15*k33*k36 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k33_pw2*k16*k36 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k32*k15*k16*k35 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15*k33*k16*k34 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k35*k36_pw2+ k12_pw2*k21_pw2*k31*k14*k23_pw2*k32_pw2*k16*k36 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k15*k33*k36 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k34*k26_pw2*k36 - 4*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k34*k36 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw2*k15*k33*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25_pw2*k36 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15*k33*k16*k36 + 4*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k35*k36 + 4*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k35*k36 + 12*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k34*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25*k26*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k26*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k35*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k34*k26*k36 - 4*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k34*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k26*k35*k36 + 8*k11*k21*k13_pw2*k22*k31_pw4*k23*k16*k25 + 4*k11*k21*k13*k31_pw3*k14*k23_pw3*k16*k34 + 4*k11_pw2*k21*k13*k31_pw4*k23*k24*k16*k26 + 4*k11_pw2*k21*k13*k22*k31_pw4*k16*k25*k26 + 4*k11*k21_pw3*k31*k14*k15*k24*k33_pw3*k16 - 4*k11_pw3*k22*k31_pw3*k23*k15*k33*k25*k26 + 8*k12*k21_pw3*k13*k31_pw3*k15*k24*k16*k36 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k25*k35 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k34*k26 - 8*k11_pw3*k22*k31_pw3*k14*k23*k25*k26*k36 + 8*k21_pw4*k31*k14*k32*k15_pw2*k33*k16*k35 - 4*k21_pw3*k13*k14_pw3*k23*k32*k33*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k26*k35*k36 + 4*k21_pw4*k31*k14_pw2*k32*k15*k16*k35*k36 + 4*k21_pw4*k31*k14_pw2*k15*k33*k16*k34*k36 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k26_pw2+ 3*k11*k12*k21*k22*k31_pw3*k23_pw2*k32*k16_pw2 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k33*k25_pw2 + 3*k11*k12*k21*k22_pw2*k31_pw3*k23*k33*k16_pw2 + k11_pw2*k12*k21*k31*k14*k23*k33_pw3*k25_pw2 - 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k26_pw2- k11*k12*k21*k31_pw2*k23_pw3*k32_pw2*k15*k16 - 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k32_pw2*k16 - 2*k12*k21_pw2*k13*k22*k31_pw3*k23*k32*k16_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k25*k26_pw2- 6*k11_pw2*k12*k21*k13*k31_pw3*k24*k33*k26_pw2- k11_pw2*k12*k21*k22*k31_pw3*k32*k16*k26_pw2- k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k34*k26_pw2- 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k26_pw2*k35 - 6*k11*k21_pw2*k22*k31_pw3*k23*k32*k15*k16_pw2 - k11*k12*k21_pw2*k31_pw3*k23*k32*k16_pw2*k25 - k11*k12*k21_pw2*k31_pw3*k23*k24*k33*k16_pw2 + 4*k11*k12*k21_pw2*k13*k31_pw3*k33*k16*k25_pw2 - k11*k12*k21_pw2*k22*k31_pw3*k32*k16_pw2*k26 - k11*k12*k21_pw2*k22*k31_pw3*k33*k16_pw2*k25 + k11*k12*k21*k31_pw2*k23_pw3*k15_pw2*k33*k34 + k11*k12*k21*k31_pw2*k23_pw3*k32*k15_pw2*k35 + k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k35_pw2- 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k32*k15*k25 - 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k15*k24*k33 - 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k15_pw2*k35 + k12*k21_pw2*k13_pw2*k22*k31*k14*k33_pw3*k25 + k12*k21_pw2*k13_pw2*k31*k14*k23*k24*k33_pw3 - k12*k21_pw2*k13*k22_pw2*k31*k14*k33_pw3*k16 - k11_pw2*k12*k21*k31_pw3*k23*k33*k16*k25_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k33*k25_pw2*k26 - k11_pw2*k21*k13*k31_pw3*k23*k15*k33*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k25_pw2*k36 - 2*k11*k21_pw2*k22_pw2*k31*k14*k15*k33_pw3*k16 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32*k33_pw3*k25 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32*k33_pw3*k26 + 8*k11*k21_pw2*k22*k14_pw2*k23*k32*k33_pw3*k16 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k34*k26_pw2- 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k15*k33*k26 - 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k15_pw2*k36 + 3*k12*k21_pw3*k22*k31*k14*k32*k33_pw2*k16_pw2 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k34*k26_pw2+ 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k26_pw2*k35 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k25*k26 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k24*k33*k26 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k32*k16*k26 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k33*k16*k25 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k34*k26_pw2- 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k26_pw2*k35 - 2*k11_pw2*k13*k31_pw2*k14*k23_pw3*k32*k33*k25 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k32*k15*k26 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k15*k33*k25 + 8*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32*k33*k16 - 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k32*k15*k16 - 6*k21_pw3*k13*k22*k31_pw2*k14*k32*k33*k16_pw2 - 2*k11*k21_pw2*k22*k31_pw2*k23*k15_pw3*k33*k35 - 2*k11*k21_pw2*k22*k31_pw2*k23*k32*k15_pw3*k36 - 12*k11*k21_pw2*k22*k31_pw3*k14*k23*k16_pw2*k35 + k11*k12_pw3*k21*k31_pw2*k23*k32*k26_pw2*k35 + k11*k12_pw3*k21*k31_pw2*k23*k33*k34*k26_pw2+ k11*k12_pw3*k21*k22*k31_pw2*k32*k26_pw2*k36 + k11*k12_pw3*k21*k22*k31_pw2*k33*k26_pw2*k35 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k25_pw2*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k24*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k25*k35 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k34*k26 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k32*k16*k25 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k24*k33*k16 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k32*k16*k26 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k33*k16*k25 - 2*k12*k21_pw3*k22*k31_pw2*k32*k15*k33*k16_pw2 + 3*k12*k21_pw3*k31*k14*k23*k32_pw2*k33*k16_pw2 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k33*k16*k26 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k25_pw2*k36 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k32*k15*k16*k25 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k15*k24*k33*k16 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k25_pw2*k36 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k15*k33*k26 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32*k33*k26_pw2- 2*k21_pw2*k13_pw3*k31_pw2*k14*k23*k32*k33*k25 - 2*k21_pw2*k13_pw3*k22*k31_pw2*k14*k32*k33*k26 - 2*k21_pw3*k13*k22*k31_pw2*k32*k15_pw2*k33*k16 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k25*k26 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k15*k24*k33*k26 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k24*k36 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k25*k35 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k34*k26 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k25*k36 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k26*k35 + 4*k11*k21_pw2*k22*k31_pw3*k23*k15_pw2*k16*k35 - 2*k11*k21_pw2*k22*k14_pw2*k23*k15*k33_pw3*k35 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k36_pw2+ k11*k12_pw3*k21*k31_pw2*k23*k33*k25_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14*k32*k33*k16_pw2*k25 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k25*k35 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k34*k26 + k11*k12*k21_pw2*k14_pw2*k23*k24*k33_pw3*k36 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k25*k36 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k26*k35 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k26*k36 - 4*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k34*k36 + 3*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k36_pw2- 4*k11_pw2*k21_pw2*k31*k14*k15*k24*k33_pw3*k26 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k25*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k26*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k24*k33*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k25*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k34*k26 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k25*k36 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k26*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k15*k33*k16*k26 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k25*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k26*k35 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k25*k36 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k26*k35 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32*k15*k36 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k15*k33*k35 - 12*k11_pw3*k21*k31_pw2*k14*k32*k33*k25*k26_pw2- 4*k21_pw2*k13_pw2*k22*k31_pw3*k14*k23*k16*k35 - 6*k21_pw3*k13_pw2*k31*k14*k32*k15*k33_pw2*k25 - k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k36_pw2- 2*k21_pw3*k13*k22*k31*k14*k15_pw2*k33_pw2*k35 - 2*k21_pw3*k13*k31*k14*k23*k15_pw2*k33_pw2*k34 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k35*k36_pw2- 4*k11*k21_pw3*k31_pw2*k32*k15_pw2*k33*k16*k25 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k24*k36 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k25*k35 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k34*k26 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k25*k36 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k26*k35 - k12*k21_pw3*k31_pw2*k14*k23*k32*k16_pw2*k35 - k12*k21_pw3*k31_pw2*k14*k23*k33*k16_pw2*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k36_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k36_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k36_pw2- k12*k21_pw3*k22*k31_pw2*k14*k32*k16_pw2*k36 - k12*k21_pw3*k22*k31_pw2*k14*k33*k16_pw2*k35 - k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k36_pw2+ 3*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k35_pw2- 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k26*k36 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k24*k16*k36 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k25*k35 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k34*k26 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k26*k36 + 4*k11_pw3*k22*k31_pw2*k14*k23*k33_pw2*k25*k26 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k24*k16*k36 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k25*k35 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k34*k26 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k25*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k26*k35 + k12_pw3*k21_pw2*k22*k31*k14*k32*k26*k36_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k36_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14*k32*k33*k16*k25 - 6*k21_pw3*k13_pw2*k31*k14*k32_pw2*k15*k33*k26 + 4*k21_pw3*k13*k22*k31*k14_pw2*k33_pw2*k16*k35 + 4*k21_pw3*k13*k31*k14_pw2*k23*k33_pw2*k16*k34 - k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k35_pw2- 2*k21_pw3*k13*k31*k14*k23*k32_pw2*k15_pw2*k36 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k26*k36 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25*k26*k35 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k36_pw2- 2*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k36_pw2- 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k25*k35 - 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k34*k26 - 4*k11*k21_pw3*k31*k14*k15_pw2*k24*k33_pw2*k36 + 4*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k35_pw2+ 3*k12*k21_pw3*k31_pw2*k23*k15_pw2*k33*k16*k34 + 3*k12*k21_pw3*k31_pw2*k23*k32*k15_pw2*k16*k35 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k24*k33*k36 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k25*k35 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k34*k26 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k26*k35_pw2- 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k25*k36 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k26*k35 + 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k26*k35_pw2+ 3*k12*k21_pw3*k22*k31_pw2*k15_pw2*k33*k16*k35 + 3*k12*k21_pw3*k22*k31_pw2*k32*k15_pw2*k16*k36 - 2*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k36_pw2- k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k35_pw2+ 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25*k26*k36 - 12*k11_pw2*k21_pw2*k31_pw3*k32*k15*k16*k25*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k15*k24*k33*k16*k26 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k26*k36 + 4*k11_pw3*k31_pw2*k14*k23_pw2*k32*k33*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k36_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k33*k26*k35_pw2+ 3*k21_pw3*k13*k14_pw2*k23*k32*k15*k33_pw2*k35 + 3*k21_pw3*k13*k22*k14_pw2*k32*k15*k33_pw2*k36 + 4*k21_pw3*k13*k31*k14_pw2*k23*k32_pw2*k16*k36 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k26*k36 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25*k26*k35 + 4*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k35*k36 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k25*k35 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k34*k26 - 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k26*k35_pw2+ 8*k11*k21_pw3*k31*k14_pw2*k24*k33_pw2*k16*k36 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k26*k36 + 3*k12*k21_pw3*k14_pw2*k23*k32*k33_pw2*k16*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k25*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k26*k35 + 3*k12*k21_pw3*k22*k14_pw2*k32*k33_pw2*k16*k36 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k35*k36_pw2- 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k34*k36_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k26*k35_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k25*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k26*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k24*k33*k16*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k25*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k34*k26 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25*k26*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k26*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25*k26*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k26*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k25*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k26*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k25*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k26*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k24*k33*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k25*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k34*k26 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k25*k36 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k26*k35 + 4*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k34*k36 + 3*k21_pw3*k13*k14_pw2*k23*k32_pw2*k15*k33*k36 + 4*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k35*k36 + 4*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k35*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k25*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k26*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k26*k36 + 3*k12*k21_pw3*k14_pw2*k23*k32_pw2*k33*k16*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k26*k36 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k35_pw2*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k26*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25*k26*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k25*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k26*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k24*k33*k16*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k25*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k34*k26 - 12*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k34*k36 - 12*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k34*k26*k36 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k26*k36 - 2*k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k34*k36 - 2*k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k35*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k35*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k34*k26*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k26*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k34*k26*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k34*k26*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k26*k35*k36 - k11*k12*k21*k13*k31*k14*k23_pw2*k24*k33_pw3 + 3*k11*k12*k21*k22_pw2*k31*k14*k23*k33_pw3*k16 - k11*k12*k21*k13*k22_pw2*k31*k14*k33_pw3*k26 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k32*k16*k25 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k24*k33*k16 + 3*k11*k12*k21*k31*k14*k23_pw3*k32_pw2*k33*k16 + 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k32*k15*k16 + 2*k11*k21_pw2*k13*k22*k31*k14*k15*k33_pw3*k25 + 2*k11*k21_pw2*k13*k31*k14*k23*k15*k24*k33_pw3 - 2*k11*k12*k21_pw2*k22*k31*k14*k33_pw3*k16*k25 - 2*k11*k12*k21_pw2*k31*k14*k23*k24*k33_pw3*k16 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k25*k26 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k24*k33*k26 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k33*k25*k26 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k33*k16*k26 - k11*k12*k21*k31*k14*k23_pw3*k15*k33_pw2*k34 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k32*k15*k26 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k15*k33*k25 + 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k15*k33*k16 + 2*k11_pw2*k12*k21*k22*k31*k14*k33_pw3*k25*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k24*k33_pw3*k26 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k32*k16*k35 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k33*k16*k34 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k24*k36 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k25*k35 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k34*k26 - k11*k12*k21*k31*k14*k23_pw3*k32_pw2*k15*k36 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k32*k15*k35 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k15*k33*k34 + 12*k11*k21*k13*k22*k31_pw3*k14*k23_pw2*k16*k35 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k33*k25*k26 - 2*k11*k21_pw2*k13*k31_pw3*k23*k32*k15*k16*k25 - 2*k11*k21_pw2*k13*k31_pw3*k23*k15*k24*k33*k16 - 2*k11*k21_pw2*k13*k22*k31_pw3*k32*k15*k16*k26 - 2*k11*k21_pw2*k13*k22*k31_pw3*k15*k33*k16*k25 + 8*k11*k12*k21_pw2*k13*k31_pw3*k32*k16*k25*k26 + 8*k11*k12*k21_pw2*k13*k31_pw3*k24*k33*k16*k26 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k26*k36 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k25*k36 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k26*k35 + 12*k11*k21*k13*k22_pw2*k31_pw3*k14*k23*k16*k36 - 2*k11_pw2*k12*k21*k31_pw3*k23*k32*k16*k25*k26 - 2*k11_pw2*k12*k21*k31_pw3*k23*k24*k33*k16*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k33*k16*k25*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k25*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k15*k24*k33*k26 - 2*k11_pw2*k21*k13*k22*k31_pw3*k15*k33*k25*k26 + 8*k11_pw2*k21*k22*k31_pw3*k23*k32*k15*k16*k26 + 8*k11_pw2*k21*k22*k31_pw3*k23*k15*k33*k16*k25 + 6*k21_pw3*k13*k22*k31*k14*k32*k15*k33_pw2*k16 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k26*k36 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k25*k26*k35 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k25*k26*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k35*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k34*k36 + 6*k21_pw3*k13*k31*k14*k23*k32_pw2*k15*k33*k16 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k24*k16*k36 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k25*k35 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k34*k26 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k25*k36 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k26*k35 + 12*k11*k21_pw3*k31*k14*k32*k15*k33_pw2*k16*k25 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k24*k16*k36 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k25*k35 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k34*k26 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k26*k36 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k25*k26*k35 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k25*k36 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k26*k35 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k26*k36 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k25*k26*k35 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k25*k26*k36 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k26*k36 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k25*k26*k35 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k25*k26*k36 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k25*k36 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k26*k35 - 4*k21_pw3*k13*k22*k31*k14*k32*k15_pw2*k33*k36 - 4*k21_pw3*k13*k31*k14*k23*k32*k15_pw2*k33*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k25*k26*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k26*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k33*k25*k26*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k33*k25*k26*k36 + 12*k11*k21_pw3*k31*k14*k32_pw2*k15*k33*k16*k26 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k25*k35 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k34*k26 + 4*k12*k21_pw3*k13*k31*k14*k15*k24*k33_pw2*k36 - 4*k12*k21_pw3*k22*k31*k14*k15*k33_pw2*k16*k35 - 4*k12*k21_pw3*k31*k14*k23*k15*k33_pw2*k16*k34 - 2*k21_pw3*k13*k31_pw2*k14*k23*k32*k15*k16*k35 - 2*k21_pw3*k13*k31_pw2*k14*k23*k15*k33*k16*k34 - 2*k21_pw3*k13*k22*k31_pw2*k14*k32*k15*k16*k36 - 2*k21_pw3*k13*k22*k31_pw2*k14*k15*k33*k16*k35 + 8*k21_pw3*k13*k22*k31*k14_pw2*k32*k33*k16*k36 + 8*k21_pw3*k13*k31*k14_pw2*k23*k32*k33*k16*k35 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k25*k36 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k26*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k25*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k26*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k24*k33*k16*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k25*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k34*k26 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k26*k36 - 4*k12*k21_pw3*k31*k14*k23*k32_pw2*k15*k16*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k25*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k26*k35 - 4*k11*k21_pw3*k31_pw2*k14*k15*k24*k33*k16*k36 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k25*k35 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k34*k26 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k25*k36 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k26*k35 + 6*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k35*k36 + 6*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k34*k36 + 6*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k35*k36 - 2*k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k35*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k35*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k34*k36 + 8*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k34*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k35*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k34*k26*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k26*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k34*k26*k36 + 8*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k35*k36 - 2*k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k35*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k35*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k26*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k26*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k34*k26*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k26*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k34*k26*k36 - 4*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k26*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k34*k26*k36 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k33*k26_pw2+ k11*k12*k21*k13*k31_pw2*k23_pw2*k15*k24*k33_pw2 + 3*k11_pw2*k12*k21*k22*k31*k14*k32*k33_pw2*k26_pw2- 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k15*k33_pw2*k16 + k11*k12*k21*k13*k22_pw2*k31_pw2*k15*k33_pw2*k26 + k11*k12*k21*k13*k31_pw2*k23_pw2*k32_pw2*k15*k26 + 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k36_pw2+ 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k33_pw2*k25 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k33_pw2*k16 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k33*k26_pw2+ 3*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k33*k26_pw2+ 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k33*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k24*k33_pw2*k26 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k33_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k33_pw2*k16*k25 + 12*k11*k21_pw2*k22*k31_pw2*k14*k23*k32*k33*k16_pw2 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k36_pw2+ 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k15_pw2*k33*k35 + 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k32*k15_pw2*k36 + 4*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32*k33*k25 + 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k33*k16*k25 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k24*k33_pw2*k16 - 2*k11*k21_pw2*k13*k31_pw2*k23*k32*k15_pw2*k33*k25 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k33_pw2*k16*k25 - 2*k11*k21_pw2*k13*k22*k31_pw2*k32*k15_pw2*k33*k26 + 4*k11*k21_pw2*k22*k31_pw2*k23*k32*k15_pw2*k33*k16 + 2*k11*k12*k21_pw2*k31_pw2*k23*k15*k24*k33_pw2*k16 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k26_pw2*k35 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k34*k26_pw2+ 2*k11*k12*k21_pw2*k22*k31_pw2*k15*k33_pw2*k16*k25 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k15_pw2*k33*k36 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32*k33_pw2*k26 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32*k33_pw2*k25 - 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k36_pw2- 3*k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw2*k33*k16 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k26_pw2*k35 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k34*k26_pw2- 2*k11_pw2*k12*k21*k31_pw2*k23*k15*k24*k33_pw2*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k26_pw2*k36 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k26_pw2*k35 - 2*k11_pw2*k12*k21*k22*k31_pw2*k15*k33_pw2*k25*k26 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k24*k33_pw2*k26 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k33_pw2*k25*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k33_pw2*k16*k25 - 6*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32*k33*k26 + 4*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32*k33*k16 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k25*k35 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k34*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k24*k33_pw2*k36 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k32_pw2*k16*k26 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k36_pw2+ 4*k11*k21_pw2*k22*k31*k14*k23*k15_pw2*k33_pw2*k35 - 6*k11*k21_pw2*k31*k14*k23_pw2*k32_pw2*k15*k33*k16 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k36_pw2+ 2*k11*k12*k21_pw2*k31_pw2*k23*k32_pw2*k15*k16*k26 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25_pw2*k36 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k26*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k36_pw2- 2*k12*k21_pw2*k13_pw2*k31_pw2*k23*k32*k15*k33*k25 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw2*k32*k15*k33*k26 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw2*k33*k26 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k15_pw2*k33*k35 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k32*k15_pw2*k36 + k12*k21_pw2*k13*k31*k14*k23_pw2*k15*k33_pw2*k34 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25_pw2*k36 - 8*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k33*k16*k25 - 2*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k33*k16*k25 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k33*k16*k26 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k36_pw2+ k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k26*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k25*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k26*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k24*k33*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k25*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k34*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k26*k36 - 8*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k33*k25*k26 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k25*k36 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k26*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k25*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k34*k26 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k24*k33_pw2*k36 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k33_pw2*k16*k35 + 4*k11*k21_pw2*k31*k14*k23_pw2*k32*k15_pw2*k33*k35 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k26*k35_pw2- k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k24*k33*k36 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k25*k35 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k34*k26 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k25*k36 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k26*k35 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k25*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k26*k35 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k26*k36 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k26*k35_pw2- 12*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k35*k36 + k12*k21_pw2*k13*k22_pw2*k31*k14*k15*k33_pw2*k36 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k32*k16*k35 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k33*k16*k34 + k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw2*k15*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k26*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k25*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k26*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k25*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k26*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k25*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k34*k26 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k24*k33_pw2*k36 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k33_pw2*k16*k35 - 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32*k15*k36 - 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k15*k33*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k32*k33*k16*k25*k26 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k26*k36 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32*k15*k16*k35 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15*k33*k16*k34 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k26*k36 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32*k15*k33_pw2*k36 - 8*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k33*k16*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k25*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k26*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k26*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k25*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k26*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k24*k33*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k25*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k34*k26 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k26*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k25*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k26*k35 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k33*k16*k36 - 12*k11_pw2*k21_pw2*k31*k14*k32*k15*k33_pw2*k25*k26 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k26*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k25*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k26*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k24*k33*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k25*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k34*k26 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k25*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k26*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k24*k33*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k25*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k34*k26 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k26*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k25*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k26*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k26*k36 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k32*k15*k16*k36 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15*k33*k16*k35 + 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k33*k16*k35 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15*k33*k16*k36 - 8*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k35*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k26*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k35*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k34*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14*k32*k33*k16*k25*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k26*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25*k26*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k26*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25*k26*k35 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k35*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k34*k26*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k26*k35*k36 + 24*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k35*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k35*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k34*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k26*k35*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k35*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k34*k26*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k26*k35*k36 - 8*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k35*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k35*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k34*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25*k26*k35 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25*k26*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k26*k35*k36 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k15*k33_pw2*k25 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32*k33_pw2*k25 + 9*k11*k12*k21*k22*k31*k14*k23_pw2*k32*k33_pw2*k16 + 2*k11*k12*k21*k13*k31_pw2*k23_pw2*k32*k15*k33*k25 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw2*k33*k26 - 6*k11*k12*k21*k22*k31_pw2*k23_pw2*k32*k15*k33*k16 - 12*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32*k33*k16 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k15*k33_pw2*k35 + 8*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32*k33*k26 - 6*k12*k21_pw2*k13*k22*k31*k14*k23*k32*k33_pw2*k16 - 4*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k33*k25*k26 + 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k33*k16*k26 + 6*k11*k21_pw2*k13*k22*k31*k14*k32*k15*k33_pw2*k26 + 6*k11*k21_pw2*k13*k31*k14*k23*k32*k15*k33_pw2*k25 - 12*k11*k21_pw2*k22*k31*k14*k23*k32*k15*k33_pw2*k16 - 6*k11*k12*k21_pw2*k22*k31*k14*k32*k33_pw2*k16*k26 - 6*k11*k12*k21_pw2*k31*k14*k23*k32*k33_pw2*k16*k25 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k15*k33_pw2*k36 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k32*k16*k36 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k33*k16*k35 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32*k15*k36 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k15*k33*k35 + 4*k12*k21_pw2*k13*k22*k31_pw2*k23*k32*k15*k33*k16 + 6*k11_pw2*k12*k21*k31*k14*k23*k32*k33_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k25*k36 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k26*k35 + 4*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k33*k16*k25 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k33*k16*k26 + 6*k11*k21_pw2*k13*k31*k14*k23*k32_pw2*k15*k33*k26 + 4*k11*k12*k21_pw2*k31_pw2*k23*k32*k15*k33*k16*k25 + 4*k11*k12*k21_pw2*k22*k31_pw2*k32*k15*k33*k16*k26 - 6*k11*k12*k21_pw2*k31*k14*k23*k32_pw2*k33*k16*k26 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k33*k16*k36 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k15*k33*k36 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k15*k33_pw2*k35 - 4*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k33*k25*k26 + 4*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k33*k25*k26 - 16*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k33*k16*k26 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k26*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k25*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k26*k35 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k25*k36 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k26*k35 + 8*k11*k21_pw2*k22*k31*k14*k23*k32*k15_pw2*k33*k36 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k35*k36 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k32*k16*k36 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k33*k16*k35 + 2*k12*k21_pw2*k13*k31*k14*k23_pw2*k32*k15*k33*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k25*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k26*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k24*k33*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k25*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k34*k26 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k26*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k25*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k26*k35 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k26*k36 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k25*k36 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k26*k35 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k32*k15*k16*k36 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15*k33*k16*k35 - 16*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k33*k16*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k25*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k26*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k24*k33*k16*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k25*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k34*k26 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25*k26*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k26*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25*k26*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k26*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k25*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k26*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25*k26*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k26*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25*k26*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25*k26*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k26*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k25*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k26*k35 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k26*k36 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k25*k36 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k26*k35 + 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k33*k16*k36 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k35*k36 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k35*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k35*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k34*k26*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k26*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k26*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k26*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k34*k26*k36 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k35*k36 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k33_pw3*k25 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k32*k16*k26 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k33*k16*k25 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k25*k36 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k26*k35 - 2*k11*k12*k21*k31*k14*k23_pw3*k32*k15*k33*k35 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k25*k36 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k26*k35 - 8*k12*k21_pw3*k22*k31*k14*k32*k15*k33*k16*k36 - 8*k12*k21_pw3*k31*k14*k23*k32*k15*k33*k16*k35 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32*k33_pw2*k26 + 4*k11*k12*k21*k13*k22*k31_pw2*k23*k32*k15*k33*k26 - 6*k11*k12*k21*k22*k31*k14*k23_pw2*k32*k15*k33*k36 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k26*k36 + 4*k12*k21_pw2*k13*k22*k31*k14*k23*k32*k15*k33*k36);
+    coeffs[2] = (k21_pw2*k13_pw4*k31_pw4*k25_pw2 + 6*k11_pw4*k31_pw4*k25_pw2*k26_pw2+ k21_pw4*k31_pw2*k15_pw4*k35_pw2+ 6*k21_pw4*k14_pw4*k35_pw2*k36_pw2+ 4*k11_pw4*k31_pw4*k24*k26_pw3 + 4*k21_pw4*k14_pw4*k34*k36_pw3 + k11_pw2*k13_pw2*k22_pw2*k31_pw4*k26_pw2+ k11_pw2*k13_pw2*k31_pw4*k23_pw2*k25_pw2 + 6*k11_pw2*k22_pw2*k31_pw4*k23_pw2*k16_pw2 + k21_pw2*k13_pw2*k22_pw2*k31_pw4*k16_pw2 + k11_pw2*k21_pw2*k14_pw2*k33_pw4*k25_pw2 + 6*k11_pw2*k21_pw2*k31_pw4*k16_pw2*k25_pw2 + k11_pw2*k31_pw2*k14_pw2*k23_pw4*k35_pw2+ k21_pw4*k31_pw2*k32_pw2*k15_pw2*k16_pw2 + k12_pw4*k21_pw2*k31_pw2*k25_pw2*k36_pw2+ k12_pw4*k21_pw2*k31_pw2*k26_pw2*k35_pw2+ 6*k21_pw4*k14_pw2*k32_pw2*k33_pw2*k16_pw2 + 6*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k35_pw2+ k21_pw4*k14_pw2*k32_pw2*k15_pw2*k36_pw2+ k21_pw4*k14_pw2*k15_pw2*k33_pw2*k35_pw2- 4*k11*k21_pw3*k31_pw4*k24*k16_pw3 + 2*k21_pw2*k13_pw4*k31_pw4*k24*k26 - 4*k21_pw4*k31_pw3*k14*k16_pw3*k34 + 2*k21_pw4*k31_pw2*k15_pw4*k34*k36 + 2*k11*k21_pw2*k22_pw2*k31_pw4*k16_pw3 + k11_pw2*k31_pw3*k23_pw4*k15_pw2*k34 + k21_pw3*k13_pw2*k14_pw2*k24*k33_pw4 + 2*k21_pw3*k13_pw2*k31_pw4*k24*k16_pw2 + 2*k21_pw4*k31_pw2*k14*k32_pw2*k16_pw3 + 2*k11_pw3*k22_pw2*k31_pw4*k16*k26_pw2+ 2*k11_pw3*k31_pw4*k23_pw2*k16*k25_pw2 + 2*k21_pw4*k31_pw3*k15_pw2*k16_pw2*k34 + 2*k21_pw4*k14_pw3*k32_pw2*k16*k36_pw2+ 2*k21_pw4*k14_pw3*k33_pw2*k16*k35_pw2- 2*k11*k21*k13_pw3*k31_pw4*k23*k25_pw2 + k11_pw3*k12*k22*k31_pw3*k32*k26_pw3 + k12*k21_pw3*k22*k31_pw3*k32*k16_pw3 - 2*k11_pw2*k13*k31_pw4*k23_pw3*k24*k16 + 4*k11_pw3*k21*k31_pw3*k14*k34*k26_pw3 - 6*k11_pw3*k13*k31_pw4*k23*k24*k26_pw2- 6*k11_pw3*k13*k22*k31_pw4*k25*k26_pw2- 2*k21_pw2*k13_pw3*k31_pw4*k23*k24*k16 - 2*k21_pw2*k13_pw3*k22*k31_pw4*k16*k25 - 2*k11*k21_pw3*k14_pw2*k24*k33_pw4*k16 + 4*k11*k21_pw3*k31*k14_pw3*k24*k36_pw3 + k12*k21_pw3*k22*k14_pw3*k32*k36_pw3 - 2*k11_pw2*k31_pw3*k14*k23_pw4*k16*k34 - 12*k11_pw3*k21*k31_pw4*k24*k16*k26_pw2- 6*k11_pw3*k13*k31_pw4*k23*k25_pw2*k26 - 12*k11_pw3*k21*k31_pw4*k16*k25_pw2*k26 + 4*k11_pw3*k31_pw4*k23_pw2*k24*k16*k26 - 2*k21_pw4*k31*k14*k15_pw3*k33*k35_pw2- 2*k21_pw4*k31_pw2*k15_pw3*k33*k16*k34 - 2*k21_pw4*k31_pw2*k32*k15_pw3*k16*k35 - 2*k21_pw4*k14_pw2*k15*k33_pw3*k16*k34 - 12*k21_pw4*k31*k14_pw3*k16*k34*k36_pw2- 6*k21_pw4*k14_pw3*k32*k15*k35*k36_pw2- 6*k21_pw4*k14_pw3*k15*k33*k34*k36_pw2- 12*k21_pw4*k31*k14_pw3*k16*k35_pw2*k36 + 4*k21_pw4*k14_pw3*k33_pw2*k16*k34*k36 - 6*k21_pw4*k14_pw3*k15*k33*k35_pw2*k36 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32_pw2*k26_pw2+ k12_pw2*k21_pw2*k13_pw2*k31_pw2*k33_pw2*k25_pw2 + k11_pw2*k21_pw2*k31_pw2*k32_pw2*k15_pw2*k26_pw2+ k11_pw2*k21_pw2*k31_pw2*k15_pw2*k33_pw2*k25_pw2 + 6*k11_pw2*k21_pw2*k14_pw2*k32_pw2*k33_pw2*k26_pw2+ 6*k11_pw2*k22_pw2*k31_pw2*k14_pw2*k23_pw2*k36_pw2+ k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k36_pw2+ k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k35_pw2+ k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14_pw2*k36_pw2+ k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k35_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25_pw2*k36_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k26_pw2*k35_pw2- 2*k11_pw2*k12_pw2*k21*k31_pw3*k34*k26_pw3 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k24*k26_pw2- 4*k11_pw2*k21*k31_pw4*k23_pw2*k24*k16_pw2 - 2*k11_pw3*k21*k31_pw2*k14*k32_pw2*k26_pw3 - 4*k11*k21_pw2*k13_pw2*k31_pw4*k16*k25_pw2 + k11*k21_pw2*k22_pw2*k14_pw2*k33_pw4*k16 - 2*k11*k21_pw2*k22_pw2*k31*k14_pw3*k36_pw3 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k33*k25_pw2 + k11_pw2*k31_pw2*k14*k23_pw4*k32_pw2*k16 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k25_pw2*k26 - 4*k11_pw2*k21*k22_pw2*k31_pw4*k16_pw2*k26 + 2*k11_pw2*k13_pw2*k31_pw4*k23_pw2*k24*k26 + 4*k11_pw2*k22*k31_pw3*k23_pw3*k15_pw2*k35 - 2*k12*k21_pw3*k31_pw2*k23*k15_pw3*k35_pw2+ 2*k11_pw2*k21_pw2*k14_pw2*k24*k33_pw4*k26 + 12*k11_pw2*k21_pw2*k31_pw4*k24*k16_pw2*k26 - k11_pw3*k22_pw2*k31_pw3*k15*k33*k26_pw2- k11_pw3*k31_pw3*k23_pw2*k15*k33*k25_pw2 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k24*k36_pw3 + 4*k21_pw3*k13_pw2*k14_pw2*k32*k33_pw3*k25 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k34*k26_pw2- k21_pw3*k13*k14_pw3*k23*k32_pw2*k36_pw2- k21_pw3*k13*k14_pw3*k23*k33_pw2*k35_pw2- 2*k11*k21_pw3*k14_pw3*k24*k33_pw2*k36_pw2+ 2*k11_pw2*k31_pw2*k14_pw2*k23_pw4*k34*k36 - 2*k11_pw3*k22_pw2*k31_pw3*k14*k26_pw2*k36 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k25_pw2*k36 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k25*k35 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k34*k26 - 2*k12_pw2*k21_pw3*k31_pw3*k24*k16_pw2*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k24*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k25*k35 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k34*k26 - 4*k21_pw4*k31*k14_pw2*k33_pw2*k16_pw2*k34 - 2*k11*k21_pw3*k14_pw3*k32_pw2*k26*k36_pw2- 2*k11*k21_pw3*k14_pw3*k33_pw2*k26*k35_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k24*k26*k36_pw2- 4*k21_pw4*k31_pw2*k14*k15_pw2*k16*k35_pw2- 4*k21_pw4*k31*k14_pw2*k32_pw2*k16_pw2*k36 + 2*k12_pw4*k21_pw2*k31_pw2*k34*k26_pw2*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k34*k36_pw2+ 12*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k34*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k35_pw2*k36 + 2*k21_pw4*k14_pw2*k15_pw2*k33_pw2*k34*k36 + k11_pw2*k12_pw2*k21*k31_pw2*k32_pw2*k26_pw3 + k12_pw2*k21_pw2*k22_pw2*k31*k14_pw2*k36_pw3 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k34*k26_pw2+ k11_pw3*k22_pw2*k31_pw2*k14*k33_pw2*k26_pw2+ k11_pw3*k31_pw2*k14*k23_pw2*k32_pw2*k26_pw2+ k11_pw3*k31_pw2*k14*k23_pw2*k33_pw2*k25_pw2 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k34*k26_pw2+ k12_pw2*k21_pw2*k31_pw3*k23_pw2*k16_pw2*k34 + k12_pw2*k21_pw3*k31_pw2*k24*k33_pw2*k16_pw2 + k21_pw2*k13_pw2*k31_pw3*k23_pw2*k15_pw2*k34 + k21_pw3*k13_pw2*k31_pw2*k15_pw2*k24*k33_pw2 + k11*k21_pw2*k22_pw2*k14_pw3*k33_pw2*k36_pw2+ k11*k21_pw2*k14_pw3*k23_pw2*k32_pw2*k36_pw2+ k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k35_pw2+ k11_pw2*k12_pw2*k22_pw2*k31_pw3*k26_pw2*k36 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k34*k26_pw2+ 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k15_pw2*k36 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25_pw2*k36 + k12_pw2*k21_pw2*k22_pw2*k31_pw3*k16_pw2*k36 + k12_pw2*k21_pw3*k31_pw2*k32_pw2*k16_pw2*k26 + k21_pw2*k13_pw2*k22_pw2*k31_pw3*k15_pw2*k36 + k21_pw3*k13_pw2*k31_pw2*k32_pw2*k15_pw2*k26 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25_pw2*k36 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k24*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k24*k36_pw2+ 6*k21_pw3*k13_pw2*k14_pw2*k32_pw2*k33_pw2*k26 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k26*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k24*k33_pw2*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k26*k35_pw2+ k12_pw2*k21_pw3*k14_pw2*k32_pw2*k26*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k26*k35_pw2- 6*k11*k21*k13*k22_pw2*k31_pw4*k23*k16_pw2 - k11*k21_pw2*k13*k14_pw2*k23*k24*k33_pw4 + 2*k11*k21_pw2*k13*k31_pw4*k23*k24*k16_pw2 - k11*k21_pw2*k13*k22*k14_pw2*k33_pw4*k25 + 2*k11*k21_pw2*k13*k22*k31_pw4*k16_pw2*k25 + 4*k11*k21*k13_pw2*k31_pw4*k23_pw2*k24*k16 - 2*k11*k21*k13*k31_pw3*k23_pw3*k15_pw2*k34 + 2*k11_pw2*k21*k13*k31_pw4*k23*k16*k25_pw2 - 8*k11_pw2*k21*k22*k31_pw4*k23*k16_pw2*k25 + 4*k11*k21*k13_pw2*k22_pw2*k31_pw4*k16*k26 + k11_pw2*k12*k31_pw3*k23_pw3*k32*k16*k25 + k11_pw2*k12*k31_pw3*k23_pw3*k24*k33*k16 + k11_pw2*k13*k31_pw3*k23_pw3*k32*k15*k25 + k11_pw2*k13*k31_pw3*k23_pw3*k15*k24*k33 - 6*k11_pw2*k13*k22*k31_pw4*k23_pw2*k16*k25 - 4*k11_pw2*k22*k31_pw3*k23_pw3*k32*k15*k16 + 3*k21_pw3*k13*k22*k31_pw3*k32*k15*k16_pw2 - 2*k12*k21_pw3*k13*k31_pw3*k32*k16_pw2*k25 - 2*k12*k21_pw3*k13*k31_pw3*k24*k33*k16_pw2 + 4*k11_pw2*k13_pw2*k22*k31_pw4*k23*k25*k26 - 6*k11_pw2*k13*k22_pw2*k31_pw4*k23*k16*k26 + 3*k11_pw3*k12*k31_pw3*k23*k32*k25*k26_pw2+ 3*k11_pw3*k12*k31_pw3*k23*k24*k33*k26_pw2+ 3*k11_pw3*k12*k22*k31_pw3*k33*k25*k26_pw2- 2*k11_pw3*k22*k31_pw3*k23*k32*k15*k26_pw2+ k21_pw2*k13_pw3*k31_pw3*k23*k32*k15*k25 + k21_pw2*k13_pw3*k31_pw3*k23*k15*k24*k33 + k21_pw2*k13_pw3*k22*k31_pw3*k32*k15*k26 + k21_pw2*k13_pw3*k22*k31_pw3*k15*k33*k25 - 2*k21_pw3*k13_pw2*k31*k14*k15*k24*k33_pw3 - 4*k21_pw3*k13*k22*k14_pw2*k32*k33_pw3*k16 - 8*k11*k21_pw2*k13_pw2*k31_pw4*k24*k16*k26 + 6*k11*k21_pw3*k31_pw3*k32*k15*k16_pw2*k25 + 6*k11*k21_pw3*k31_pw3*k15*k24*k33*k16_pw2 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k32*k25*k26 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k24*k33*k26 - k11_pw2*k31_pw2*k14*k23_pw4*k32*k15*k35 - k11_pw2*k31_pw2*k14*k23_pw4*k15*k33*k34 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k24*k36 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k25*k35 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k34*k26 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k24*k36 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k25*k35 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k34*k26 - 8*k11_pw2*k22*k31_pw3*k14*k23_pw3*k16*k35 + 3*k11_pw3*k12*k31_pw3*k23*k33*k25_pw2*k26 + 6*k11_pw3*k21*k31_pw3*k32*k15*k25*k26_pw2+ 6*k11_pw3*k21*k31_pw3*k15*k24*k33*k26_pw2+ k21_pw3*k13*k31_pw2*k23*k15_pw3*k33*k34 + k21_pw3*k13*k31_pw2*k23*k32*k15_pw3*k35 + 6*k21_pw3*k13*k31_pw3*k14*k23*k16_pw2*k34 + k21_pw3*k13*k22*k31_pw2*k15_pw3*k33*k35 + k21_pw3*k13*k22*k31_pw2*k32*k15_pw3*k36 + 6*k21_pw3*k13*k22*k31_pw3*k14*k16_pw2*k35 - 8*k11*k21_pw3*k14_pw2*k32*k33_pw3*k16*k25 - 2*k12*k21_pw3*k31_pw3*k23*k15*k16_pw2*k34 - 2*k12*k21_pw3*k22*k31_pw3*k15*k16_pw2*k35 + 6*k11_pw3*k21*k31_pw3*k15*k33*k25_pw2*k26 - 4*k11_pw3*k22*k31_pw3*k14*k23*k26_pw2*k35 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k24*k36 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k25*k35 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k34*k26 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k25*k36 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k26*k35 - 2*k21_pw3*k13_pw2*k31_pw3*k32*k15*k16*k25 - 2*k21_pw3*k13_pw2*k31_pw3*k15*k24*k33*k16 - 2*k21_pw3*k13*k31_pw3*k23*k15_pw2*k16*k34 + k21_pw3*k13*k14_pw2*k23*k15*k33_pw3*k34 - 2*k21_pw3*k13*k22*k31_pw3*k15_pw2*k16*k35 + k21_pw3*k13*k22*k14_pw2*k15*k33_pw3*k35 - 2*k21_pw3*k13*k22*k14_pw3*k32*k33*k36_pw2- 6*k21_pw4*k31*k14*k32_pw2*k15*k33*k16_pw2 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k24*k33*k36 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k25*k35 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k34*k26 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k25*k36 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k26*k35 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k25*k35 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k34*k26 + 12*k11*k21_pw3*k31_pw3*k14*k24*k16_pw2*k36 + k12*k21_pw3*k14_pw2*k23*k33_pw3*k16*k34 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k25*k35 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k34*k26 - 2*k12*k21_pw3*k13*k14_pw2*k24*k33_pw3*k36 + k12*k21_pw3*k22*k14_pw2*k33_pw3*k16*k35 - 2*k11_pw3*k31_pw3*k23_pw2*k32*k15*k25*k26 - 2*k11_pw3*k31_pw3*k23_pw2*k15*k24*k33*k26 + 12*k11_pw3*k21*k31_pw3*k14*k24*k26_pw2*k36 + 12*k11_pw3*k21*k31_pw3*k14*k25*k26_pw2*k35 + 6*k21_pw3*k13*k22*k31*k14_pw3*k35*k36_pw2+ 6*k21_pw3*k13*k31*k14_pw3*k23*k34*k36_pw2- 4*k11*k21_pw3*k31_pw3*k15_pw2*k24*k16*k36 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k25*k35 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k34*k26 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k25*k35 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k34*k26 + 2*k11*k21_pw3*k14_pw2*k15*k24*k33_pw3*k36 - 4*k11*k21_pw3*k14_pw3*k32*k33*k25*k36_pw2- 4*k12*k21_pw3*k31_pw2*k23*k15_pw3*k34*k36 - 4*k12*k21_pw3*k22*k31_pw2*k15_pw3*k35*k36 + 12*k11_pw3*k21*k31_pw3*k14*k25_pw2*k26*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k24*k16*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k25*k35 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k34*k26 + 6*k21_pw3*k13*k31*k14_pw3*k23*k35_pw2*k36 + 2*k21_pw4*k31_pw2*k14*k32*k15*k16_pw2*k35 + 2*k21_pw4*k31_pw2*k14*k15*k33*k16_pw2*k34 - 8*k21_pw4*k31*k14_pw2*k32*k33*k16_pw2*k35 + 4*k21_pw4*k31*k14*k15_pw2*k33_pw2*k16*k34 + 12*k11*k21_pw3*k31*k14_pw3*k25*k35*k36_pw2+ 12*k11*k21_pw3*k31*k14_pw3*k34*k26*k36_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k32*k35*k36_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k33*k34*k36_pw2+ 3*k12*k21_pw3*k22*k14_pw3*k33*k35*k36_pw2- 4*k11_pw3*k31_pw3*k14*k23_pw2*k24*k26*k36 - 4*k11_pw3*k31_pw3*k14*k23_pw2*k25*k26*k35 - 2*k21_pw3*k13*k14_pw3*k23*k33_pw2*k34*k36 - 2*k21_pw3*k13*k22*k14_pw3*k33_pw2*k35*k36 + 2*k21_pw4*k31*k14_pw2*k15*k33*k16*k35_pw2+ 4*k21_pw4*k31*k14*k32_pw2*k15_pw2*k16*k36 + 12*k11*k21_pw3*k31*k14_pw3*k26*k35_pw2*k36 + 3*k12*k21_pw3*k14_pw3*k23*k33*k35_pw2*k36 - 6*k21_pw4*k14_pw2*k32*k15*k33_pw2*k16*k35 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k25*k35*k36 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k34*k26*k36 - 8*k21_pw4*k31_pw2*k14*k15_pw2*k16*k34*k36 - 6*k21_pw4*k14_pw2*k32_pw2*k15*k33*k16*k36 + 4*k12_pw4*k21_pw2*k31_pw2*k25*k26*k35*k36 + 4*k21_pw4*k14_pw2*k32*k15_pw2*k33*k35*k36 - k11_pw2*k12*k13*k22_pw2*k31_pw3*k33*k26_pw2- k11_pw2*k12*k13*k31_pw3*k23_pw2*k33*k25_pw2 - 2*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k35_pw2- k12*k21_pw2*k13*k22_pw2*k31_pw3*k33*k16_pw2 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k24*k33_pw2 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k15*k33*k25_pw2 - 3*k11*k21_pw2*k22_pw2*k31_pw3*k15*k33*k16_pw2 - 2*k11_pw2*k21_pw2*k31*k14*k15*k33_pw3*k25_pw2 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k32_pw2*k26 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k24*k33_pw2 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k33_pw2*k25 - 3*k21_pw3*k13*k31_pw2*k14*k23*k32_pw2*k16_pw2 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k34*k26_pw2- k11*k21_pw2*k31_pw2*k23_pw2*k15_pw3*k33*k34 - k11*k21_pw2*k31_pw2*k23_pw2*k32*k15_pw3*k35 - 6*k11*k21_pw2*k31_pw3*k14*k23_pw2*k16_pw2*k34 - 6*k11*k21_pw3*k31_pw2*k14*k24*k33_pw2*k16_pw2 - k12*k21_pw3*k31_pw2*k23*k32_pw2*k15*k16_pw2 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k26_pw2*k35 - 6*k11_pw2*k22_pw2*k31_pw3*k23_pw2*k15*k33*k16 - 6*k11_pw3*k21*k31_pw2*k14*k24*k33_pw2*k26_pw2+ 2*k12_pw2*k21_pw2*k22*k31_pw3*k23*k16_pw2*k35 - k21_pw2*k13_pw2*k22_pw2*k31_pw3*k15*k33*k16 + 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k15_pw2*k35 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k32_pw2*k26 - k21_pw3*k13*k31_pw2*k23*k32_pw2*k15_pw2*k16 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k34*k26_pw2+ 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25_pw2*k36 - k11*k21_pw2*k22_pw2*k31_pw2*k15_pw3*k33*k36 - 6*k11*k21_pw2*k22_pw2*k31_pw3*k14*k16_pw2*k36 + 2*k11*k21_pw2*k31_pw3*k23_pw2*k15_pw2*k16*k34 - k11*k21_pw2*k14_pw2*k23_pw2*k15*k33_pw3*k34 - 2*k11*k21_pw3*k31_pw2*k15_pw2*k24*k33_pw2*k16 - 6*k11*k21_pw3*k31_pw2*k14*k32_pw2*k16_pw2*k26 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k24*k26_pw2*k36 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25*k26_pw2*k35 - 6*k11_pw2*k21_pw2*k31_pw3*k15*k33*k16*k25_pw2 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k24*k36 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k25*k35 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k34*k26 - 6*k11_pw3*k21*k31_pw2*k14*k33_pw2*k25_pw2*k26 + 2*k12_pw2*k21_pw3*k31_pw2*k32*k33*k16_pw2*k25 - 2*k21_pw2*k13_pw2*k31_pw3*k14*k23_pw2*k16*k34 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k26_pw2*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k34*k26_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14*k24*k33_pw2*k16 + 2*k21_pw3*k13_pw2*k31_pw2*k32*k15_pw2*k33*k25 + 2*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k35_pw2- 6*k21_pw3*k13*k14_pw2*k23*k32_pw2*k33_pw2*k16 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25_pw2*k36 + 2*k11*k21_pw2*k22_pw2*k31_pw3*k15_pw2*k16*k36 - k11*k21_pw2*k22_pw2*k14_pw2*k15*k33_pw3*k36 - 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k34*k36_pw2- 2*k11*k21_pw3*k31_pw2*k32_pw2*k15_pw2*k16*k26 + 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k24*k36_pw2- 6*k11_pw2*k12_pw2*k21*k31_pw3*k25_pw2*k26*k36 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k34*k26_pw2+ 8*k11_pw2*k21_pw2*k14_pw2*k32*k33_pw3*k25*k26 - 12*k11_pw2*k22_pw2*k31_pw3*k14*k23_pw2*k16*k36 - 4*k11_pw2*k21*k22_pw2*k31_pw3*k15_pw2*k26*k36 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k24*k33_pw2*k26 - 2*k21_pw2*k13_pw2*k22_pw2*k31_pw3*k14*k16*k36 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k24*k36_pw2- 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25_pw2*k36 - 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k25*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14*k32_pw2*k16*k26 - 6*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k35_pw2- 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k35_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k24*k16*k36_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k26*k35_pw2- 12*k11*k21_pw3*k14_pw2*k32_pw2*k33_pw2*k16*k26 - k12*k21_pw3*k14_pw2*k23*k32_pw2*k15*k36_pw2- k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k35_pw2+ 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k24*k26*k36 + 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25*k26*k35 - 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25_pw2*k36 + 8*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k35*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k24*k26*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25*k26*k35 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k24*k16*k36_pw2- 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k26*k35_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k25*k35 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k34*k26 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k24*k33_pw2*k36 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k34*k36 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k26*k35_pw2+ 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k24*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25*k26*k35 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k26*k35_pw2+ 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k25*k36_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k32_pw2*k26*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k25*k35*k36_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k34*k26*k36_pw2+ 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k35*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k34*k26*k36 - 6*k12_pw2*k21_pw3*k31*k14_pw2*k26*k35_pw2*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k35*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k34*k26*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k34*k26*k36 - 4*k11*k21*k13_pw3*k31_pw4*k23*k24*k26 - 4*k11*k21*k13_pw3*k22*k31_pw4*k25*k26 + 8*k11_pw3*k22*k31_pw4*k23*k16*k25*k26 - 4*k21_pw4*k31*k14*k15_pw3*k33*k34*k36 - 4*k21_pw4*k31*k14*k32*k15_pw3*k35*k36 + 8*k21_pw4*k14_pw3*k32*k33*k16*k35*k36 - 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32_pw2*k26_pw2- 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k33_pw2*k25_pw2 + 3*k11*k21_pw2*k22_pw2*k31_pw2*k14*k33_pw2*k16_pw2 + 3*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k16_pw2 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k24*k33_pw2*k26_pw2- 2*k11*k12_pw2*k21_pw2*k31_pw2*k32_pw2*k16*k26_pw2- 2*k11*k12_pw2*k21_pw2*k31_pw2*k33_pw2*k16*k25_pw2 + k11*k21_pw2*k22_pw2*k31_pw2*k15_pw2*k33_pw2*k16 + k11*k21_pw2*k31_pw2*k23_pw2*k32_pw2*k15_pw2*k16 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k33_pw2*k25_pw2*k26 + 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k16 + k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k33_pw2*k16 + k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25_pw2*k36_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k26_pw2*k35_pw2- 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15_pw2*k36_pw2- 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k35_pw2+ 6*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw2*k33_pw2*k16 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k32_pw2*k16*k26_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14*k33_pw2*k16*k25_pw2 - 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k24*k36_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k24*k33_pw2*k26 + 6*k11*k21_pw2*k22_pw2*k31_pw2*k14_pw2*k16*k36_pw2+ 6*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k35_pw2+ 2*k11_pw2*k21_pw2*k31_pw2*k15_pw2*k24*k33_pw2*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k34*k26_pw2- 4*k11_pw2*k21*k22_pw2*k31_pw2*k14_pw2*k26*k36_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k26*k35_pw2- 2*k12_pw2*k21_pw2*k22_pw2*k31_pw2*k14*k16*k36_pw2- 2*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k35_pw2- 4*k11_pw2*k21_pw2*k31*k14_pw2*k32_pw2*k26_pw2*k36 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25_pw2*k36 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k34*k36_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k24*k26*k36_pw2+ 2*k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k34*k36 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k35_pw2*k36 + 2*k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k34*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k34*k26_pw2*k36 - k11*k12_pw2*k21*k13*k31_pw2*k23*k32_pw2*k26_pw2- k11*k12_pw2*k21*k13*k31_pw2*k23*k33_pw2*k25_pw2 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k24*k33_pw2 - k11_pw2*k12*k21*k31_pw2*k23*k32_pw2*k15*k26_pw2- k11_pw2*k12*k21*k31_pw2*k23*k15*k33_pw2*k25_pw2 + k11_pw2*k21*k13*k31_pw2*k14*k23*k32_pw2*k26_pw2+ k11_pw2*k21*k13*k31_pw2*k14*k23*k33_pw2*k25_pw2 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k24*k33_pw2*k16 - k11*k21_pw2*k13*k31_pw2*k23*k15_pw2*k24*k33_pw2 - k11*k21_pw2*k13*k22*k31_pw2*k15_pw2*k33_pw2*k25 + 2*k11*k21*k13_pw2*k22_pw2*k31_pw2*k14*k33_pw2*k26 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32_pw2*k26 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14_pw2*k23*k36_pw2- 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k33_pw2*k25 + k11*k12_pw2*k21*k22_pw2*k31_pw2*k33_pw2*k16*k26 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k32_pw2*k16*k26 - k11*k21_pw2*k13*k31_pw2*k23*k32_pw2*k15_pw2*k26 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k15*k24*k33_pw2 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k15*k33_pw2*k25 + k12*k21_pw2*k13*k22_pw2*k31_pw2*k15*k33_pw2*k16 + k12*k21_pw2*k13*k31_pw2*k23_pw2*k32_pw2*k15*k16 + 6*k11_pw2*k12_pw2*k21*k31_pw2*k32*k33*k25*k26_pw2- 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k24*k33_pw2*k16 - 3*k11_pw2*k13*k22_pw2*k31_pw2*k14*k23*k33_pw2*k26 - k12_pw2*k21_pw2*k13*k31_pw2*k23*k24*k33_pw2*k16 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k33_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k24*k33_pw2*k26 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k24*k36_pw2- 6*k11*k21_pw2*k13*k14_pw2*k23*k32_pw2*k33_pw2*k26 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k25*k36_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k15_pw2*k33_pw2*k34 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k32_pw2*k15*k26 - k12*k21_pw2*k13*k22_pw2*k31*k14_pw2*k33*k36_pw2- k12*k21_pw2*k13*k31_pw2*k23_pw2*k15_pw2*k33*k34 - k12*k21_pw2*k13*k31_pw2*k23_pw2*k32*k15_pw2*k35 - k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k35_pw2- 6*k11_pw2*k21_pw2*k31*k14*k32_pw2*k15*k33*k26_pw2- 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k33_pw2*k16*k26 - 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32_pw2*k16*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k25*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k24*k36_pw2- k12_pw2*k21_pw2*k13*k31_pw2*k23*k32_pw2*k16*k26 + 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k25*k36_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k26_pw2*k35 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k34*k26_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k24*k33_pw2*k16*k26 + k11*k21_pw2*k22_pw2*k31*k14_pw2*k15*k33*k36_pw2+ 2*k11*k21_pw2*k22_pw2*k31*k14*k15_pw2*k33_pw2*k36 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k26*k35_pw2- 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k33_pw2*k16*k34 + k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k35_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k32_pw2*k15_pw2*k36 - k12*k21_pw2*k13*k22_pw2*k31_pw2*k15_pw2*k33*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k33*k25*k26 - k12_pw2*k21_pw2*k22_pw2*k31*k14*k15*k33*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k26*k35_pw2+ k12_pw2*k21_pw2*k31*k14*k23_pw2*k33_pw2*k16*k34 - k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k35_pw2- k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32*k15*k35 - k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k15*k33*k34 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k24*k26*k36_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25_pw2*k36 - 4*k11*k21_pw2*k22_pw2*k31*k14_pw2*k33_pw2*k16*k36 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32*k15*k33_pw2*k35 - 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32_pw2*k16*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k26_pw2*k35 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k34*k26_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14*k24*k33_pw2*k16*k26 + 4*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k33*k25*k26 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k26_pw2*k35 - 6*k11_pw2*k22_pw2*k31_pw2*k14*k23_pw2*k15*k33*k36 + k12_pw2*k21_pw2*k22_pw2*k31*k14*k33_pw2*k16*k36 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k32*k15*k16*k35 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15*k33*k16*k34 + 6*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k35*k36_pw2+ k12_pw2*k21_pw2*k31*k14*k23_pw2*k32_pw2*k16*k36 - k21_pw2*k13_pw2*k22_pw2*k31_pw2*k14*k15*k33*k36 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k34*k26_pw2*k36 - 4*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k34*k36 - 3*k11*k21_pw2*k14_pw2*k23_pw2*k32_pw2*k15*k33*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25_pw2*k36 - k12_pw2*k21_pw2*k22_pw2*k31_pw2*k15*k33*k16*k36 + 4*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k35*k36 + 4*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k35*k36 + 12*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k34*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25*k26*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k24*k33_pw2*k26*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k35*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k34*k26*k36 - 4*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k34*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k26*k35*k36 + 8*k11*k21*k13_pw2*k22*k31_pw4*k23*k16*k25 + 4*k11*k21*k13*k31_pw3*k14*k23_pw3*k16*k34 + 4*k11_pw2*k21*k13*k31_pw4*k23*k24*k16*k26 + 4*k11_pw2*k21*k13*k22*k31_pw4*k16*k25*k26 + 4*k11*k21_pw3*k31*k14*k15*k24*k33_pw3*k16 - 4*k11_pw3*k22*k31_pw3*k23*k15*k33*k25*k26 + 8*k12*k21_pw3*k13*k31_pw3*k15*k24*k16*k36 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k25*k35 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k34*k26 - 8*k11_pw3*k22*k31_pw3*k14*k23*k25*k26*k36 + 8*k21_pw4*k31*k14*k32*k15_pw2*k33*k16*k35 - 4*k21_pw3*k13*k14_pw3*k23*k32*k33*k35*k36 - 8*k11*k21_pw3*k14_pw3*k32*k33*k26*k35*k36 + 4*k21_pw4*k31*k14_pw2*k32*k15*k16*k35*k36 + 4*k21_pw4*k31*k14_pw2*k15*k33*k16*k34*k36 + 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k32*k26_pw2+ 3*k11*k12*k21*k22*k31_pw3*k23_pw2*k32*k16_pw2 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k33*k25_pw2 + 3*k11*k12*k21*k22_pw2*k31_pw3*k23*k33*k16_pw2 + k11_pw2*k12*k21*k31*k14*k23*k33_pw3*k25_pw2 - 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k32*k26_pw2- k11*k12*k21*k31_pw2*k23_pw3*k32_pw2*k15*k16 - 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k32_pw2*k16 - 2*k12*k21_pw2*k13*k22*k31_pw3*k23*k32*k16_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k32*k25*k26_pw2- 6*k11_pw2*k12*k21*k13*k31_pw3*k24*k33*k26_pw2- k11_pw2*k12*k21*k22*k31_pw3*k32*k16*k26_pw2- k11_pw2*k21*k13*k22*k31_pw3*k32*k15*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k34*k26_pw2- 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k26_pw2*k35 - 6*k11*k21_pw2*k22*k31_pw3*k23*k32*k15*k16_pw2 - k11*k12*k21_pw2*k31_pw3*k23*k32*k16_pw2*k25 - k11*k12*k21_pw2*k31_pw3*k23*k24*k33*k16_pw2 + 4*k11*k12*k21_pw2*k13*k31_pw3*k33*k16*k25_pw2 - k11*k12*k21_pw2*k22*k31_pw3*k32*k16_pw2*k26 - k11*k12*k21_pw2*k22*k31_pw3*k33*k16_pw2*k25 + k11*k12*k21*k31_pw2*k23_pw3*k15_pw2*k33*k34 + k11*k12*k21*k31_pw2*k23_pw3*k32*k15_pw2*k35 + k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k35_pw2- 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k32*k15*k25 - 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k15*k24*k33 - 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k15_pw2*k35 + k12*k21_pw2*k13_pw2*k22*k31*k14*k33_pw3*k25 + k12*k21_pw2*k13_pw2*k31*k14*k23*k24*k33_pw3 - k12*k21_pw2*k13*k22_pw2*k31*k14*k33_pw3*k16 - k11_pw2*k12*k21*k31_pw3*k23*k33*k16*k25_pw2 - 6*k11_pw2*k12*k21*k13*k31_pw3*k33*k25_pw2*k26 - k11_pw2*k21*k13*k31_pw3*k23*k15*k33*k25_pw2 - 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k25_pw2*k36 - 2*k11*k21_pw2*k22_pw2*k31*k14*k15*k33_pw3*k16 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32*k33_pw3*k25 - 4*k11*k21_pw2*k13*k22*k14_pw2*k32*k33_pw3*k26 + 8*k11*k21_pw2*k22*k14_pw2*k23*k32*k33_pw3*k16 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k34*k26_pw2- 2*k11*k21*k13_pw2*k22_pw2*k31_pw3*k15*k33*k26 - 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k15_pw2*k36 + 3*k12*k21_pw3*k22*k31*k14*k32*k33_pw2*k16_pw2 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k34*k26_pw2+ 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k26_pw2*k35 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k25*k26 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k24*k33*k26 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k32*k16*k26 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k33*k16*k25 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k34*k26_pw2- 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k26_pw2*k35 - 2*k11_pw2*k13*k31_pw2*k14*k23_pw3*k32*k33*k25 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k32*k15*k26 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k15*k33*k25 + 8*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32*k33*k16 - 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k32*k15*k16 - 6*k21_pw3*k13*k22*k31_pw2*k14*k32*k33*k16_pw2 - 2*k11*k21_pw2*k22*k31_pw2*k23*k15_pw3*k33*k35 - 2*k11*k21_pw2*k22*k31_pw2*k23*k32*k15_pw3*k36 - 12*k11*k21_pw2*k22*k31_pw3*k14*k23*k16_pw2*k35 + k11*k12_pw3*k21*k31_pw2*k23*k32*k26_pw2*k35 + k11*k12_pw3*k21*k31_pw2*k23*k33*k34*k26_pw2+ k11*k12_pw3*k21*k22*k31_pw2*k32*k26_pw2*k36 + k11*k12_pw3*k21*k22*k31_pw2*k33*k26_pw2*k35 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k25_pw2*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k24*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k25*k35 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k34*k26 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k32*k16*k25 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k24*k33*k16 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k32*k16*k26 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k33*k16*k25 - 2*k12*k21_pw3*k22*k31_pw2*k32*k15*k33*k16_pw2 + 3*k12*k21_pw3*k31*k14*k23*k32_pw2*k33*k16_pw2 + 3*k11_pw2*k12*k22_pw2*k31_pw3*k23*k33*k16*k26 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k25_pw2*k36 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k32*k15*k16*k25 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k15*k24*k33*k16 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k25_pw2*k36 + 3*k11_pw2*k13*k22_pw2*k31_pw3*k23*k15*k33*k26 + 4*k11_pw3*k22*k31_pw2*k14*k23*k32*k33*k26_pw2- 2*k21_pw2*k13_pw3*k31_pw2*k14*k23*k32*k33*k25 - 2*k21_pw2*k13_pw3*k22*k31_pw2*k14*k32*k33*k26 - 2*k21_pw3*k13*k22*k31_pw2*k32*k15_pw2*k33*k16 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k25*k26 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k15*k24*k33*k26 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k24*k36 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k25*k35 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k34*k26 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k25*k36 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k26*k35 + 4*k11*k21_pw2*k22*k31_pw3*k23*k15_pw2*k16*k35 - 2*k11*k21_pw2*k22*k14_pw2*k23*k15*k33_pw3*k35 + 4*k11*k21_pw2*k22*k14_pw3*k23*k32*k33*k36_pw2+ k11*k12_pw3*k21*k31_pw2*k23*k33*k25_pw2*k36 - 12*k11*k21_pw3*k31_pw2*k14*k32*k33*k16_pw2*k25 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k25*k35 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k34*k26 + k11*k12*k21_pw2*k14_pw2*k23*k24*k33_pw3*k36 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k25*k36 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k26*k35 - 4*k11*k21*k13_pw2*k22_pw2*k31_pw3*k14*k26*k36 - 4*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k34*k36 + 3*k12*k21_pw3*k22*k31*k14*k32*k15_pw2*k36_pw2- 4*k11_pw2*k21_pw2*k31*k14*k15*k24*k33_pw3*k26 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k25*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k26*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k24*k33*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k25*k35 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k34*k26 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k25*k36 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k26*k35 + 4*k11_pw2*k21*k22_pw2*k31_pw3*k15*k33*k16*k26 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k25*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k26*k35 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k25*k36 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k26*k35 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k32*k15*k36 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k15*k33*k35 - 12*k11_pw3*k21*k31_pw2*k14*k32*k33*k25*k26_pw2- 4*k21_pw2*k13_pw2*k22*k31_pw3*k14*k23*k16*k35 - 6*k21_pw3*k13_pw2*k31*k14*k32*k15*k33_pw2*k25 - k21_pw3*k13*k22*k31*k14_pw2*k32*k15*k36_pw2- 2*k21_pw3*k13*k22*k31*k14*k15_pw2*k33_pw2*k35 - 2*k21_pw3*k13*k31*k14*k23*k15_pw2*k33_pw2*k34 - 12*k11*k21_pw2*k22*k31*k14_pw3*k23*k35*k36_pw2- 4*k11*k21_pw3*k31_pw2*k32*k15_pw2*k33*k16*k25 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k24*k36 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k25*k35 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k34*k26 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k25*k36 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k26*k35 - k12*k21_pw3*k31_pw2*k14*k23*k32*k16_pw2*k35 - k12*k21_pw3*k31_pw2*k14*k23*k33*k16_pw2*k34 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k24*k36_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k25*k36_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k24*k33*k36_pw2- k12*k21_pw3*k22*k31_pw2*k14*k32*k16_pw2*k36 - k12*k21_pw3*k22*k31_pw2*k14*k33*k16_pw2*k35 - k12*k21_pw3*k22*k31*k14_pw2*k32*k16*k36_pw2+ 3*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k35_pw2- 6*k11_pw2*k12*k22_pw2*k31_pw3*k23*k15*k26*k36 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k24*k16*k36 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k25*k35 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k34*k26 + 6*k11_pw2*k13*k22_pw2*k31_pw3*k14*k23*k26*k36 + 4*k11_pw3*k22*k31_pw2*k14*k23*k33_pw2*k25*k26 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k24*k16*k36 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k25*k35 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k34*k26 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k25*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k26*k35 + k12_pw3*k21_pw2*k22*k31*k14*k32*k26*k36_pw2+ k12_pw3*k21_pw2*k22*k31*k14*k33*k25*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k25*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k24*k33*k36_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14*k32*k33*k16*k25 - 6*k21_pw3*k13_pw2*k31*k14*k32_pw2*k15*k33*k26 + 4*k21_pw3*k13*k22*k31*k14_pw2*k33_pw2*k16*k35 + 4*k21_pw3*k13*k31*k14_pw2*k23*k33_pw2*k16*k34 - k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k35_pw2- 2*k21_pw3*k13*k31*k14*k23*k32_pw2*k15_pw2*k36 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k24*k26*k36 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25*k26*k35 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k25*k36_pw2- 2*k11*k21_pw3*k31*k14_pw2*k15*k24*k33*k36_pw2- 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k25*k35 - 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k34*k26 - 4*k11*k21_pw3*k31*k14*k15_pw2*k24*k33_pw2*k36 + 4*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k35_pw2+ 3*k12*k21_pw3*k31_pw2*k23*k15_pw2*k33*k16*k34 + 3*k12*k21_pw3*k31_pw2*k23*k32*k15_pw2*k16*k35 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k24*k33*k36 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k25*k35 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k34*k26 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k26*k35_pw2- 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k25*k36 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k26*k35 + 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k26*k35_pw2+ 3*k12*k21_pw3*k22*k31_pw2*k15_pw2*k33*k16*k35 + 3*k12*k21_pw3*k22*k31_pw2*k32*k15_pw2*k16*k36 - 2*k12*k21_pw3*k22*k14_pw2*k32*k15*k33*k36_pw2- k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k35_pw2+ 4*k11_pw2*k12_pw2*k22*k31_pw3*k23*k25*k26*k36 - 12*k11_pw2*k21_pw2*k31_pw3*k32*k15*k16*k25*k26 - 12*k11_pw2*k21_pw2*k31_pw3*k15*k24*k33*k16*k26 + 8*k11_pw2*k21*k22_pw2*k31_pw3*k14*k16*k26*k36 + 4*k11_pw3*k31_pw2*k14*k23_pw2*k32*k33*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k25*k36_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k24*k33*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k33*k26*k35_pw2+ 3*k21_pw3*k13*k14_pw2*k23*k32*k15*k33_pw2*k35 + 3*k21_pw3*k13*k22*k14_pw2*k32*k15*k33_pw2*k36 + 4*k21_pw3*k13*k31*k14_pw2*k23*k32_pw2*k16*k36 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k24*k16*k26*k36 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25*k26*k35 + 4*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k35*k36 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k25*k35 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k34*k26 - 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k26*k35_pw2+ 8*k11*k21_pw3*k31*k14_pw2*k24*k33_pw2*k16*k36 - 4*k11*k21_pw3*k31*k14*k32_pw2*k15_pw2*k26*k36 + 3*k12*k21_pw3*k14_pw2*k23*k32*k33_pw2*k16*k35 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k25*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k26*k35 + 3*k12*k21_pw3*k22*k14_pw2*k32*k33_pw2*k16*k36 - 6*k12*k21_pw3*k22*k31*k14_pw2*k15*k35*k36_pw2- 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k34*k36_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k26*k35_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k25*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k26*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k24*k33*k16*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k25*k35 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k34*k26 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k32*k25*k26*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k24*k33*k26*k36 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25*k26*k35 + k12_pw3*k21_pw2*k22*k31_pw2*k32*k16*k26*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k25*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k26*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k25*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k26*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k24*k33*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k25*k35 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k34*k26 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k25*k36 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k26*k35 + 4*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k34*k36 + 3*k21_pw3*k13*k14_pw2*k23*k32_pw2*k15*k33*k36 + 4*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k35*k36 + 4*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k35*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k25*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k26*k35 + 8*k11*k21_pw3*k31*k14_pw2*k32_pw2*k16*k26*k36 + 3*k12*k21_pw3*k14_pw2*k23*k32_pw2*k33*k16*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32_pw2*k33*k26*k36 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k35_pw2*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k24*k16*k26*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25*k26*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k25*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k26*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k24*k33*k16*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k25*k35 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k34*k26 - 12*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k34*k36 - 12*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k34*k26*k36 + 6*k11*k21_pw3*k14_pw2*k32_pw2*k15*k33*k26*k36 - 2*k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k34*k36 - 2*k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k35*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k35*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k34*k26*k36 - 4*k12_pw3*k21_pw2*k22*k31_pw2*k15*k26*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k34*k26*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k34*k26*k36 + 4*k12_pw2*k21_pw3*k14_pw2*k32*k33*k26*k35*k36 - k11*k12*k21*k13*k31*k14*k23_pw2*k24*k33_pw3 + 3*k11*k12*k21*k22_pw2*k31*k14*k23*k33_pw3*k16 - k11*k12*k21*k13*k22_pw2*k31*k14*k33_pw3*k26 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k32*k16*k25 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k24*k33*k16 + 3*k11*k12*k21*k31*k14*k23_pw3*k32_pw2*k33*k16 + 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k32*k15*k16 + 2*k11*k21_pw2*k13*k22*k31*k14*k15*k33_pw3*k25 + 2*k11*k21_pw2*k13*k31*k14*k23*k15*k24*k33_pw3 - 2*k11*k12*k21_pw2*k22*k31*k14*k33_pw3*k16*k25 - 2*k11*k12*k21_pw2*k31*k14*k23*k24*k33_pw3*k16 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k25*k26 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k24*k33*k26 + 6*k11*k12*k21*k13_pw2*k22*k31_pw3*k33*k25*k26 - 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k33*k16*k26 - k11*k12*k21*k31*k14*k23_pw3*k15*k33_pw2*k34 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k32*k15*k26 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k15*k33*k25 + 6*k11*k21*k13*k22_pw2*k31_pw3*k23*k15*k33*k16 + 2*k11_pw2*k12*k21*k22*k31*k14*k33_pw3*k25*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k24*k33_pw3*k26 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k32*k16*k35 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k33*k16*k34 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k24*k36 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k25*k35 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k34*k26 - k11*k12*k21*k31*k14*k23_pw3*k32_pw2*k15*k36 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k32*k15*k35 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k15*k33*k34 + 12*k11*k21*k13*k22*k31_pw3*k14*k23_pw2*k16*k35 - 4*k11_pw2*k12*k13*k22*k31_pw3*k23*k33*k25*k26 - 2*k11*k21_pw2*k13*k31_pw3*k23*k32*k15*k16*k25 - 2*k11*k21_pw2*k13*k31_pw3*k23*k15*k24*k33*k16 - 2*k11*k21_pw2*k13*k22*k31_pw3*k32*k15*k16*k26 - 2*k11*k21_pw2*k13*k22*k31_pw3*k15*k33*k16*k25 + 8*k11*k12*k21_pw2*k13*k31_pw3*k32*k16*k25*k26 + 8*k11*k12*k21_pw2*k13*k31_pw3*k24*k33*k16*k26 + 4*k11*k12*k21*k13*k22_pw2*k31_pw3*k15*k26*k36 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k25*k36 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k26*k35 + 12*k11*k21*k13*k22_pw2*k31_pw3*k14*k23*k16*k36 - 2*k11_pw2*k12*k21*k31_pw3*k23*k32*k16*k25*k26 - 2*k11_pw2*k12*k21*k31_pw3*k23*k24*k33*k16*k26 - 2*k11_pw2*k12*k21*k22*k31_pw3*k33*k16*k25*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k25*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k15*k24*k33*k26 - 2*k11_pw2*k21*k13*k22*k31_pw3*k15*k33*k25*k26 + 8*k11_pw2*k21*k22*k31_pw3*k23*k32*k15*k16*k26 + 8*k11_pw2*k21*k22*k31_pw3*k23*k15*k33*k16*k25 + 6*k21_pw3*k13*k22*k31*k14*k32*k15*k33_pw2*k16 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k24*k26*k36 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k25*k26*k35 - 4*k11*k12_pw2*k21*k13*k22*k31_pw3*k25*k26*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k35*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k34*k36 + 6*k21_pw3*k13*k31*k14*k23*k32_pw2*k15*k33*k16 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k24*k16*k36 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k25*k35 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k34*k26 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k25*k36 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k26*k35 + 12*k11*k21_pw3*k31*k14*k32*k15*k33_pw2*k16*k25 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k24*k16*k36 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k25*k35 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k34*k26 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k24*k26*k36 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k25*k26*k35 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k25*k36 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k26*k35 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k24*k26*k36 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k25*k26*k35 + 12*k11_pw2*k12*k21*k22*k31_pw3*k15*k25*k26*k36 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k24*k26*k36 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k25*k26*k35 - 4*k11_pw2*k21*k13*k22*k31_pw3*k14*k25*k26*k36 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k25*k36 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k26*k35 - 4*k21_pw3*k13*k22*k31*k14*k32*k15_pw2*k33*k36 - 4*k21_pw3*k13*k31*k14*k23*k32*k15_pw2*k33*k35 + 2*k11*k12_pw3*k21*k31_pw2*k23*k32*k25*k26*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k24*k33*k26*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k33*k25*k26*k35 + 2*k11*k12_pw3*k21*k22*k31_pw2*k33*k25*k26*k36 + 12*k11*k21_pw3*k31*k14*k32_pw2*k15*k33*k16*k26 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k25*k35 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k34*k26 + 4*k12*k21_pw3*k13*k31*k14*k15*k24*k33_pw2*k36 - 4*k12*k21_pw3*k22*k31*k14*k15*k33_pw2*k16*k35 - 4*k12*k21_pw3*k31*k14*k23*k15*k33_pw2*k16*k34 - 2*k21_pw3*k13*k31_pw2*k14*k23*k32*k15*k16*k35 - 2*k21_pw3*k13*k31_pw2*k14*k23*k15*k33*k16*k34 - 2*k21_pw3*k13*k22*k31_pw2*k14*k32*k15*k16*k36 - 2*k21_pw3*k13*k22*k31_pw2*k14*k15*k33*k16*k35 + 8*k21_pw3*k13*k22*k31*k14_pw2*k32*k33*k16*k36 + 8*k21_pw3*k13*k31*k14_pw2*k23*k32*k33*k16*k35 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k25*k36 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k26*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k25*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k26*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k24*k33*k16*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k25*k35 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k34*k26 + 4*k12*k21_pw3*k13*k31*k14*k32_pw2*k15*k26*k36 - 4*k12*k21_pw3*k31*k14*k23*k32_pw2*k15*k16*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k25*k36 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k26*k35 - 4*k11*k21_pw3*k31_pw2*k14*k15*k24*k33*k16*k36 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k25*k35 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k34*k26 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k25*k36 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k26*k35 + 6*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k35*k36 + 6*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k34*k36 + 6*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k35*k36 - 2*k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k35*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k35*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k34*k36 + 8*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k34*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k35*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k34*k26*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k32*k26*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k34*k26*k36 + 8*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k35*k36 - 2*k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k35*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k35*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k34*k36 + 2*k12_pw3*k21_pw2*k22*k31*k14*k33*k26*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k32*k26*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k34*k26*k36 - 4*k11*k21_pw3*k31*k14_pw2*k32*k15*k26*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k34*k26*k36 - 4*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k32*k15*k26*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k34*k26*k36 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k32*k33*k26_pw2+ k11*k12*k21*k13*k31_pw2*k23_pw2*k15*k24*k33_pw2 + 3*k11_pw2*k12*k21*k22*k31*k14*k32*k33_pw2*k26_pw2- 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k15*k33_pw2*k16 + k11*k12*k21*k13*k22_pw2*k31_pw2*k15*k33_pw2*k26 + k11*k12*k21*k13*k31_pw2*k23_pw2*k32_pw2*k15*k26 + 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k32*k36_pw2+ 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k33_pw2*k25 - 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k33_pw2*k16 - 2*k11_pw2*k12*k21*k22*k31_pw2*k32*k15*k33*k26_pw2+ 3*k11_pw2*k12*k21*k31*k14*k23*k32_pw2*k33*k26_pw2+ 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k32*k33*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k24*k33_pw2*k26 - 2*k11*k12_pw2*k21*k13*k22*k31_pw2*k33_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k33_pw2*k16*k25 + 12*k11*k21_pw2*k22*k31_pw2*k14*k23*k32*k33*k16_pw2 + 3*k11*k12*k21*k22_pw2*k31*k14_pw2*k23*k33*k36_pw2+ 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k15_pw2*k33*k35 + 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k32*k15_pw2*k36 + 4*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32*k33*k25 + 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k33*k16*k25 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k24*k33_pw2*k16 - 2*k11*k21_pw2*k13*k31_pw2*k23*k32*k15_pw2*k33*k25 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k33_pw2*k16*k25 - 2*k11*k21_pw2*k13*k22*k31_pw2*k32*k15_pw2*k33*k26 + 4*k11*k21_pw2*k22*k31_pw2*k23*k32*k15_pw2*k33*k16 + 2*k11*k12*k21_pw2*k31_pw2*k23*k15*k24*k33_pw2*k16 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k26_pw2*k35 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k34*k26_pw2+ 2*k11*k12*k21_pw2*k22*k31_pw2*k15*k33_pw2*k16*k25 + 3*k11*k12*k21*k22_pw2*k31_pw2*k23*k15_pw2*k33*k36 + 3*k12*k21_pw2*k13_pw2*k22*k31*k14*k32*k33_pw2*k26 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32*k33_pw2*k25 - 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k32*k36_pw2- 3*k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw2*k33*k16 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k26_pw2*k35 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k34*k26_pw2- 2*k11_pw2*k12*k21*k31_pw2*k23*k15*k24*k33_pw2*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k32*k26_pw2*k36 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k26_pw2*k35 - 2*k11_pw2*k12*k21*k22*k31_pw2*k15*k33_pw2*k25*k26 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k24*k33_pw2*k26 + 2*k11_pw2*k21*k13*k22*k31_pw2*k14*k33_pw2*k25*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k33_pw2*k16*k25 - 6*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k32*k33*k26 + 4*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32*k33*k16 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k25*k35 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k34*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k24*k33_pw2*k36 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k32_pw2*k16*k26 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k15*k36_pw2+ 4*k11*k21_pw2*k22*k31*k14*k23*k15_pw2*k33_pw2*k35 - 6*k11*k21_pw2*k31*k14*k23_pw2*k32_pw2*k15*k33*k16 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k24*k36_pw2+ 2*k11*k12*k21_pw2*k31_pw2*k23*k32_pw2*k15*k16*k26 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25_pw2*k36 + 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k25*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k32*k26*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k25*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k25*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k24*k33*k36_pw2- 2*k12*k21_pw2*k13_pw2*k31_pw2*k23*k32*k15*k33*k25 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw2*k32*k15*k33*k26 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32_pw2*k33*k26 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k15_pw2*k33*k35 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k32*k15_pw2*k36 + k12*k21_pw2*k13*k31*k14*k23_pw2*k15*k33_pw2*k34 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25_pw2*k36 - 8*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k33*k16*k25 - 2*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k33*k16*k25 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k33*k16*k26 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k15*k36_pw2+ k11*k12_pw2*k21*k22_pw2*k31*k14*k33_pw2*k26*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k25*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k26*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k24*k33*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k25*k35 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k34*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k32_pw2*k26*k36 - 8*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k33*k25*k26 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k25*k36 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k26*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k25*k35 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k34*k26 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k24*k33_pw2*k36 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k33_pw2*k16*k35 + 4*k11*k21_pw2*k31*k14*k23_pw2*k32*k15_pw2*k33*k35 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k26*k35_pw2- k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k24*k33*k36 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k25*k35 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k34*k26 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k25*k36 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k26*k35 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k25*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k26*k35 - k11*k12*k21_pw2*k22*k31_pw2*k32*k15_pw2*k26*k36 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k26*k35_pw2- 12*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k35*k36 + k12*k21_pw2*k13*k22_pw2*k31*k14*k15*k33_pw2*k36 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k32*k16*k35 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k33*k16*k34 + k12*k21_pw2*k13*k31*k14*k23_pw2*k32_pw2*k15*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k32*k26*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k25*k36 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k26*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k25*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k26*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k25*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k34*k26 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k24*k33_pw2*k36 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k33_pw2*k16*k35 - 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k32*k15*k36 - 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k15*k33*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k32*k33*k16*k25*k26 - 2*k11*k12_pw2*k21*k22_pw2*k31_pw2*k15*k33*k26*k36 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32*k15*k16*k35 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15*k33*k16*k34 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k32_pw2*k26*k36 - 6*k11*k21_pw2*k22*k14_pw2*k23*k32*k15*k33_pw2*k36 - 8*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k33*k16*k35 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k25*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k26*k35 + 3*k11*k12*k21_pw2*k22*k14_pw2*k32*k33_pw2*k26*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k25*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k26*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k24*k33*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k25*k35 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k34*k26 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k32*k26*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k25*k36 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k26*k35 + 2*k12*k21_pw2*k13*k22_pw2*k31_pw2*k14*k33*k16*k36 - 12*k11_pw2*k21_pw2*k31*k14*k32*k15*k33_pw2*k25*k26 + 3*k11_pw2*k12*k22_pw2*k31_pw2*k14*k23*k33*k26*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k25*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k26*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k24*k33*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k25*k35 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k34*k26 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k25*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k26*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k24*k33*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k25*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k34*k26 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k32*k15*k26*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k25*k36 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k26*k35 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k32_pw2*k26*k36 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k32*k15*k16*k36 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15*k33*k16*k35 + 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k33*k16*k35 + 2*k11*k21_pw2*k22_pw2*k31_pw2*k14*k15*k33*k16*k36 - 8*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k35*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32_pw2*k33*k26*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k35*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k34*k36 + 24*k11_pw2*k21_pw2*k31_pw2*k14*k32*k33*k16*k25*k26 + 4*k11_pw2*k21*k22_pw2*k31_pw2*k14*k15*k33*k26*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k25*k26*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k24*k33*k26*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25*k26*k35 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k35*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k34*k26*k36 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k26*k35*k36 + 24*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k35*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k35*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k34*k36 - 16*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k26*k35*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k35*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k34*k26*k36 + 4*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k26*k35*k36 - 8*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k35*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k35*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k34*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k25*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k24*k33*k26*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25*k26*k35 - 16*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k25*k26*k36 - 16*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k26*k35*k36 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k15*k33_pw2*k25 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32*k33_pw2*k25 + 9*k11*k12*k21*k22*k31*k14*k23_pw2*k32*k33_pw2*k16 + 2*k11*k12*k21*k13*k31_pw2*k23_pw2*k32*k15*k33*k25 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32_pw2*k33*k26 - 6*k11*k12*k21*k22*k31_pw2*k23_pw2*k32*k15*k33*k16 - 12*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32*k33*k16 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k15*k33_pw2*k35 + 8*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k32*k33*k26 - 6*k12*k21_pw2*k13*k22*k31*k14*k23*k32*k33_pw2*k16 - 4*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k33*k25*k26 + 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k33*k16*k26 + 6*k11*k21_pw2*k13*k22*k31*k14*k32*k15*k33_pw2*k26 + 6*k11*k21_pw2*k13*k31*k14*k23*k32*k15*k33_pw2*k25 - 12*k11*k21_pw2*k22*k31*k14*k23*k32*k15*k33_pw2*k16 - 6*k11*k12*k21_pw2*k22*k31*k14*k32*k33_pw2*k16*k26 - 6*k11*k12*k21_pw2*k31*k14*k23*k32*k33_pw2*k16*k25 - 3*k11*k12*k21*k22_pw2*k31*k14*k23*k15*k33_pw2*k36 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k32*k16*k36 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k33*k16*k35 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k32*k15*k36 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k15*k33*k35 + 4*k12*k21_pw2*k13*k22*k31_pw2*k23*k32*k15*k33*k16 + 6*k11_pw2*k12*k21*k31*k14*k23*k32*k33_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k25*k36 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k26*k35 + 4*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k33*k16*k25 + 4*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k33*k16*k26 + 6*k11*k21_pw2*k13*k31*k14*k23*k32_pw2*k15*k33*k26 + 4*k11*k12*k21_pw2*k31_pw2*k23*k32*k15*k33*k16*k25 + 4*k11*k12*k21_pw2*k22*k31_pw2*k32*k15*k33*k16*k26 - 6*k11*k12*k21_pw2*k31*k14*k23*k32_pw2*k33*k16*k26 - 6*k11*k12*k21*k22_pw2*k31_pw2*k14*k23*k33*k16*k36 + 6*k11*k21*k13*k22_pw2*k31_pw2*k14*k23*k15*k33*k36 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k15*k33_pw2*k35 - 4*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k33*k25*k26 + 4*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k33*k25*k26 - 16*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k33*k16*k26 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k32*k15*k26*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k25*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k26*k35 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k25*k36 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k26*k35 + 8*k11*k21_pw2*k22*k31*k14*k23*k32*k15_pw2*k33*k36 + 6*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k35*k36 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k32*k16*k36 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k33*k16*k35 + 2*k12*k21_pw2*k13*k31*k14*k23_pw2*k32*k15*k33*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k25*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k26*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k24*k33*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k25*k35 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k34*k26 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k32*k15*k26*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k25*k36 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k26*k35 + 8*k11*k21_pw2*k13*k22*k31*k14_pw2*k32*k33*k26*k36 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k25*k36 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k26*k35 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k32*k15*k16*k36 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15*k33*k16*k35 - 16*k11*k21_pw2*k22*k31*k14_pw2*k23*k32*k33*k16*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k25*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k26*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k24*k33*k16*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k25*k35 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k34*k26 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k25*k26*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k24*k33*k26*k36 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25*k26*k35 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k32*k16*k26*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k25*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k26*k35 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k25*k26*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k24*k33*k26*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25*k26*k35 - 10*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k25*k26*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k32*k15*k26*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k25*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k26*k35 - 4*k12_pw2*k21_pw2*k13*k22*k31*k14*k32*k33*k26*k36 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k25*k36 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k26*k35 + 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k32*k33*k16*k36 - 4*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k35*k36 + 4*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k35*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k35*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k34*k26*k36 + 8*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k26*k35*k36 - 10*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k26*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k26*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k34*k26*k36 - 4*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k35*k36 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k33_pw3*k25 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k32*k16*k26 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k33*k16*k25 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k25*k36 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k26*k35 - 2*k11*k12*k21*k31*k14*k23_pw3*k32*k15*k33*k35 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k25*k36 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k26*k35 - 8*k12*k21_pw3*k22*k31*k14*k32*k15*k33*k16*k36 - 8*k12*k21_pw3*k31*k14*k23*k32*k15*k33*k16*k35 - 6*k11*k12*k21*k13*k22*k31*k14*k23*k32*k33_pw2*k26 + 4*k11*k12*k21*k13*k22*k31_pw2*k23*k32*k15*k33*k26 - 6*k11*k12*k21*k22*k31*k14*k23_pw2*k32*k15*k33*k36 + 4*k11*k12_pw2*k21*k22*k31*k14*k23*k32*k33*k26*k36 + 4*k12*k21_pw2*k13*k22*k31*k14*k23*k32*k15*k33*k36);
 
     // x^1
-    coeffs.at(1) = (4*k11_pw4*k31_pw4*k25*k26_pw3 + 4*k21_pw4*k14_pw4*k35*k36_pw3 - 2*k11_pw3*k13*k22*k31_pw4*k26_pw3 - 2*k21_pw3*k13*k22*k31_pw4*k16_pw3 - 4*k11*k21_pw3*k31_pw4*k16_pw3*k25 - 2*k21_pw4*k31_pw3*k32*k15*k16_pw3 + 2*k21_pw2*k13_pw4*k31_pw4*k25*k26 - 4*k21_pw4*k31_pw3*k14*k16_pw3*k35 - 2*k21_pw4*k14_pw3*k32*k15*k36_pw3 + 2*k21_pw4*k31_pw2*k15_pw4*k35*k36 + 4*k11_pw2*k22*k31_pw4*k23_pw3*k16_pw2 + k11_pw2*k31_pw3*k23_pw4*k15_pw2*k35 + k21_pw3*k13_pw2*k14_pw2*k33_pw4*k25 + 2*k21_pw3*k13_pw2*k31_pw4*k16_pw2*k25 + 4*k21_pw4*k14_pw2*k32*k33_pw3*k16_pw2 + 2*k21_pw4*k31_pw3*k15_pw2*k16_pw2*k35 + 4*k11*k21_pw2*k22*k31_pw4*k23*k16_pw3 - 2*k11*k21*k13_pw3*k22*k31_pw4*k26_pw2+ k11_pw3*k12*k31_pw3*k23*k32*k26_pw3 + k11_pw3*k12*k22*k31_pw3*k33*k26_pw3 + k12*k21_pw3*k31_pw3*k23*k32*k16_pw3 + k12*k21_pw3*k22*k31_pw3*k33*k16_pw3 + 2*k11_pw3*k21*k31_pw3*k32*k15*k26_pw3 - k11_pw2*k31_pw3*k23_pw4*k32*k15*k16 - 2*k11_pw2*k13*k31_pw4*k23_pw3*k16*k25 - k21_pw3*k13*k22*k14_pw2*k33_pw4*k16 + 2*k21_pw3*k13*k22*k31*k14_pw3*k36_pw3 + 4*k11_pw3*k21*k31_pw3*k14*k26_pw3*k35 - 6*k11_pw3*k13*k31_pw4*k23*k25*k26_pw2+ 4*k11_pw3*k22*k31_pw4*k23*k16*k26_pw2- 2*k21_pw2*k13_pw3*k31_pw4*k23*k16*k25 - 2*k21_pw2*k13_pw3*k22*k31_pw4*k16*k26 + 4*k21_pw4*k31_pw2*k14*k32*k33*k16_pw3 - 2*k11*k21_pw3*k14_pw2*k33_pw4*k16*k25 + 4*k11*k21_pw3*k31*k14_pw3*k25*k36_pw3 + k12*k21_pw3*k14_pw3*k23*k32*k36_pw3 + k12*k21_pw3*k22*k14_pw3*k33*k36_pw3 - 2*k11_pw2*k31_pw3*k14*k23_pw4*k16*k35 - 12*k11_pw3*k21*k31_pw4*k16*k25*k26_pw2- 2*k21_pw4*k31*k14*k32*k15_pw3*k36_pw2+ 4*k11_pw3*k31_pw4*k23_pw2*k16*k25*k26 - 2*k21_pw4*k31_pw2*k15_pw3*k33*k16*k35 - 2*k21_pw4*k31_pw2*k32*k15_pw3*k16*k36 - 2*k21_pw4*k14_pw2*k15*k33_pw3*k16*k35 + 4*k21_pw4*k14_pw3*k32*k33*k16*k36_pw2- 12*k21_pw4*k31*k14_pw3*k16*k35*k36_pw2- 6*k21_pw4*k14_pw3*k15*k33*k35*k36_pw2+ 4*k21_pw4*k14_pw3*k33_pw2*k16*k35*k36 + 2*k11_pw2*k13_pw2*k22*k31_pw4*k23*k26_pw2+ 2*k21_pw2*k13_pw2*k22*k31_pw4*k23*k16_pw2 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k32*k26_pw2- 2*k11_pw2*k12_pw2*k21*k31_pw3*k26_pw3*k35 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k25*k26_pw2- 4*k11_pw2*k21*k31_pw4*k23_pw2*k16_pw2*k25 - 2*k12*k21_pw3*k22*k31_pw2*k15_pw3*k36_pw2+ 2*k11_pw2*k13_pw2*k31_pw4*k23_pw2*k25*k26 + 4*k11_pw2*k22*k31_pw3*k23_pw3*k15_pw2*k36 - k11_pw3*k31_pw3*k23_pw2*k32*k15*k26_pw2+ 2*k11_pw2*k21_pw2*k14_pw2*k33_pw4*k25*k26 + 12*k11_pw2*k21_pw2*k31_pw4*k16_pw2*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k25*k36_pw3 + 4*k21_pw3*k13_pw2*k14_pw2*k32*k33_pw3*k26 - k21_pw3*k13*k22*k14_pw3*k33_pw2*k36_pw2+ 2*k21_pw4*k31_pw2*k32*k15_pw2*k33*k16_pw2 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k26_pw2*k35 - 2*k11*k21_pw3*k14_pw3*k33_pw2*k25*k36_pw2+ 2*k11_pw2*k31_pw2*k14_pw2*k23_pw4*k35*k36 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k25*k36 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k26*k35 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k25*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k26*k35 - 4*k21_pw4*k31*k14_pw2*k33_pw2*k16_pw2*k35 + 2*k12_pw4*k21_pw2*k31_pw2*k25*k26*k36_pw2+ 2*k21_pw4*k14_pw2*k32*k15_pw2*k33*k36_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k26_pw2*k35*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k35*k36_pw2+ 12*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k35*k36 + 2*k21_pw4*k14_pw2*k15_pw2*k33_pw2*k35*k36 + 4*k11_pw2*k21_pw2*k14_pw2*k32*k33_pw3*k26_pw2+ 4*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k36_pw2+ k11_pw2*k12_pw2*k31_pw3*k23_pw2*k26_pw2*k35 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k26_pw2*k35 + k12_pw2*k21_pw2*k31_pw3*k23_pw2*k16_pw2*k35 + k12_pw2*k21_pw3*k31_pw2*k33_pw2*k16_pw2*k25 + k21_pw2*k13_pw2*k31_pw3*k23_pw2*k15_pw2*k35 + k21_pw3*k13_pw2*k31_pw2*k15_pw2*k33_pw2*k25 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k26_pw2*k35 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k36_pw2- 2*k11_pw2*k12*k21*k13*k31_pw3*k32*k26_pw3 + k11*k12*k21*k31_pw3*k23_pw3*k32*k16_pw2 - 6*k11*k21*k13*k22*k31_pw4*k23_pw2*k16_pw2 + 2*k11_pw2*k21*k13*k22*k31_pw4*k16*k26_pw2- k11*k21_pw2*k13*k14_pw2*k23*k33_pw4*k25 + 2*k11*k21_pw2*k13*k31_pw4*k23*k16_pw2*k25 - k11*k21_pw2*k13*k22*k14_pw2*k33_pw4*k26 + 2*k11*k21_pw2*k13*k22*k31_pw4*k16_pw2*k26 + 2*k11*k21_pw2*k22*k14_pw2*k23*k33_pw4*k16 - 4*k11*k21_pw2*k22*k31*k14_pw3*k23*k36_pw3 + 4*k11*k21*k13_pw2*k31_pw4*k23_pw2*k16*k25 - 2*k11*k21*k13*k31_pw3*k23_pw3*k15_pw2*k35 + k12*k21_pw3*k22*k31*k14*k33_pw3*k16_pw2 - 8*k11_pw2*k21*k22*k31_pw4*k23*k16_pw2*k26 - 4*k11_pw3*k21*k31_pw2*k14*k32*k33*k26_pw3 + 2*k11_pw2*k31_pw2*k14*k23_pw4*k32*k33*k16 + k11_pw2*k12*k31_pw3*k23_pw3*k32*k16*k26 + k11_pw2*k12*k31_pw3*k23_pw3*k33*k16*k25 + k11_pw2*k13*k31_pw3*k23_pw3*k32*k15*k26 + k11_pw2*k13*k31_pw3*k23_pw3*k15*k33*k25 - 6*k11_pw2*k13*k22*k31_pw4*k23_pw2*k16*k26 - 4*k11_pw2*k22*k31_pw3*k23_pw3*k15*k33*k16 + 3*k21_pw3*k13*k31_pw3*k23*k32*k15*k16_pw2 + 3*k21_pw3*k13*k22*k31_pw3*k15*k33*k16_pw2 - 2*k12*k21_pw3*k13*k31_pw3*k32*k16_pw2*k26 - 2*k12*k21_pw3*k13*k31_pw3*k33*k16_pw2*k25 - 2*k12*k21_pw3*k22*k31*k14_pw2*k15*k36_pw3 + 3*k11_pw3*k12*k31_pw3*k23*k33*k25*k26_pw2- 2*k11_pw3*k22*k31_pw3*k23*k15*k33*k26_pw2+ k21_pw2*k13_pw3*k31_pw3*k23*k32*k15*k26 + k21_pw2*k13_pw3*k31_pw3*k23*k15*k33*k25 + k21_pw2*k13_pw3*k22*k31_pw3*k15*k33*k26 - 2*k21_pw3*k13_pw2*k31*k14*k15*k33_pw3*k25 - 4*k21_pw3*k13*k14_pw2*k23*k32*k33_pw3*k16 - 8*k11*k21_pw2*k13_pw2*k31_pw4*k16*k25*k26 + 6*k11*k21_pw3*k31_pw3*k32*k15*k16_pw2*k26 + 6*k11*k21_pw3*k31_pw3*k15*k33*k16_pw2*k25 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k33*k25*k26 - k11_pw2*k31_pw2*k14*k23_pw4*k32*k15*k36 - k11_pw2*k31_pw2*k14*k23_pw4*k15*k33*k35 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k25*k36 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k26*k35 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k25*k36 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k26*k35 - 8*k11_pw2*k22*k31_pw3*k14*k23_pw3*k16*k36 + 6*k11_pw3*k21*k31_pw3*k15*k33*k25*k26_pw2+ k21_pw3*k13*k31_pw2*k23*k15_pw3*k33*k35 + k21_pw3*k13*k31_pw2*k23*k32*k15_pw3*k36 + 6*k21_pw3*k13*k31_pw3*k14*k23*k16_pw2*k35 + k21_pw3*k13*k22*k31_pw2*k15_pw3*k33*k36 + 6*k21_pw3*k13*k22*k31_pw3*k14*k16_pw2*k36 - 6*k21_pw4*k31*k14*k32*k15*k33_pw2*k16_pw2 - 8*k11*k21_pw3*k14_pw2*k32*k33_pw3*k16*k26 - 2*k12*k21_pw3*k31_pw3*k23*k15*k16_pw2*k35 - 2*k12*k21_pw3*k22*k31_pw3*k15*k16_pw2*k36 - 4*k11_pw3*k22*k31_pw3*k14*k23*k26_pw2*k36 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k25*k36 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k26*k35 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k26*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k32*k15*k16*k26 - 2*k21_pw3*k13_pw2*k31_pw3*k15*k33*k16*k25 - 2*k21_pw3*k13*k31_pw3*k23*k15_pw2*k16*k35 + k21_pw3*k13*k14_pw2*k23*k15*k33_pw3*k35 - 2*k21_pw3*k13*k14_pw3*k23*k32*k33*k36_pw2- 2*k21_pw3*k13*k22*k31_pw3*k15_pw2*k16*k36 + k21_pw3*k13*k22*k14_pw2*k15*k33_pw3*k36 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k25*k36 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k26*k35 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k26*k36 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k25*k36 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k26*k35 + k12*k21_pw3*k14_pw2*k23*k33_pw3*k16*k35 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k25*k36 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k26*k35 + k12*k21_pw3*k22*k14_pw2*k33_pw3*k16*k36 - 2*k11_pw3*k31_pw3*k23_pw2*k15*k33*k25*k26 + 12*k11_pw3*k21*k31_pw3*k14*k25*k26_pw2*k36 + 6*k21_pw3*k13*k31*k14_pw3*k23*k35*k36_pw2- 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k25*k36 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k26*k35 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k25*k36 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k26*k35 - 4*k11*k21_pw3*k14_pw3*k32*k33*k26*k36_pw2- 4*k12*k21_pw3*k31_pw2*k23*k15_pw3*k35*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k25*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k26*k35 + 2*k21_pw4*k31_pw2*k14*k32*k15*k16_pw2*k36 + 2*k21_pw4*k31_pw2*k14*k15*k33*k16_pw2*k35 + 2*k21_pw4*k31*k14_pw2*k32*k15*k16*k36_pw2- 8*k21_pw4*k31*k14_pw2*k32*k33*k16_pw2*k36 + 4*k21_pw4*k31*k14*k15_pw2*k33_pw2*k16*k35 + 12*k11*k21_pw3*k31*k14_pw3*k26*k35*k36_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k33*k35*k36_pw2- 4*k11_pw3*k31_pw3*k14*k23_pw2*k25*k26*k36 - 2*k21_pw3*k13*k14_pw3*k23*k33_pw2*k35*k36 - 6*k21_pw4*k14_pw2*k32*k15*k33_pw2*k16*k36 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k26*k35*k36 - 8*k21_pw4*k31_pw2*k14*k15_pw2*k16*k35*k36 + 2*k11_pw2*k12_pw2*k21*k31_pw2*k32*k33*k26_pw3 - k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k26_pw2- k12*k21_pw2*k13*k31_pw3*k23_pw2*k32*k16_pw2 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k26_pw2- 3*k11*k21_pw2*k31_pw3*k23_pw2*k32*k15*k16_pw2 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k33_pw2*k25 + 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k33_pw2*k16 + 2*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k36_pw3 - 3*k21_pw3*k13*k22*k31_pw2*k14*k33_pw2*k16_pw2 + 4*k11*k21_pw2*k14_pw2*k23_pw2*k32*k33_pw3*k16 - k12*k21_pw3*k22*k31_pw2*k15*k33_pw2*k16_pw2 + 2*k11_pw3*k22*k31_pw2*k14*k23*k33_pw2*k26_pw2- k21_pw2*k13_pw2*k31_pw3*k23_pw2*k32*k15*k16 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k33_pw2*k25 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k33_pw2*k26 - k21_pw3*k13*k22*k31_pw2*k15_pw2*k33_pw2*k16 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k26_pw2*k35 - k11*k21_pw2*k31_pw2*k23_pw2*k15_pw3*k33*k35 - k11*k21_pw2*k31_pw2*k23_pw2*k32*k15_pw3*k36 - 6*k11*k21_pw2*k31_pw3*k14*k23_pw2*k16_pw2*k35 + 2*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k36_pw2- 6*k11*k21_pw3*k31_pw2*k14*k33_pw2*k16_pw2*k25 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k26_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k32*k15*k16*k26_pw2+ 2*k11_pw3*k31_pw2*k14*k23_pw2*k32*k33*k26_pw2- 6*k11_pw3*k21*k31_pw2*k14*k33_pw2*k25*k26_pw2+ 2*k12_pw2*k21_pw2*k22*k31_pw3*k23*k16_pw2*k36 + 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k15_pw2*k36 + 2*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k36_pw2+ 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k26_pw2*k35 + 2*k11*k21_pw2*k31_pw3*k23_pw2*k15_pw2*k16*k35 - k11*k21_pw2*k14_pw2*k23_pw2*k15*k33_pw3*k35 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k36_pw2- 2*k11*k21_pw3*k31_pw2*k15_pw2*k33_pw2*k16*k25 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25*k26_pw2*k36 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k25*k36 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k26*k35 + 2*k12_pw2*k21_pw3*k31_pw2*k32*k33*k16_pw2*k26 - 2*k21_pw2*k13_pw2*k31_pw3*k14*k23_pw2*k16*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k26_pw2*k36 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k26_pw2*k35 + 2*k21_pw3*k13_pw2*k31_pw2*k14*k33_pw2*k16*k25 + 2*k21_pw3*k13_pw2*k31_pw2*k32*k15_pw2*k33*k26 - 6*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k36_pw2- 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k35*k36_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k36_pw2- k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k36_pw2- 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k26_pw2*k35 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k33_pw2*k25*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k36_pw2- 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k26*k36_pw2- 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k36_pw2+ 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25*k26*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25*k26*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k36_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k25*k36 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k26*k35 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k35*k36 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25*k26*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k26*k36_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k26*k35*k36_pw2+ 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k26*k35*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k26*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k26*k35*k36 - 4*k11*k21*k13_pw3*k31_pw4*k23*k25*k26 - 4*k21_pw4*k31*k14*k15_pw3*k33*k35*k36 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k33_pw2*k25*k26_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k33*k26_pw2+ 2*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k33*k26_pw2+ 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k36_pw2+ 2*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k36_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k36_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k33_pw2*k25*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k15_pw2*k33_pw2*k25*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k26_pw2*k35 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k35*k36_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k26*k36_pw2+ 2*k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k35*k36 + 2*k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k35*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k26_pw2*k35*k36 - k11*k12_pw2*k21*k13*k22*k31_pw2*k33_pw2*k26_pw2- k11_pw2*k12*k21*k22*k31_pw2*k15*k33_pw2*k26_pw2+ k11_pw2*k21*k13*k22*k31_pw2*k14*k33_pw2*k26_pw2+ 6*k11*k21_pw2*k22*k31_pw2*k14*k23*k33_pw2*k16_pw2 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k25 - 6*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k36_pw2+ k11*k12_pw2*k21*k31_pw2*k23_pw2*k33_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k33*k26_pw2+ 6*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32*k33*k16_pw2 - k11*k21_pw2*k13*k31_pw2*k23*k15_pw2*k33_pw2*k25 - k11*k21_pw2*k13*k22*k31_pw2*k15_pw2*k33_pw2*k26 + 2*k11*k21_pw2*k22*k31_pw2*k23*k15_pw2*k33_pw2*k16 - 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k33_pw2*k26 + 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k33_pw2*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k33*k16*k26_pw2+ 2*k11*k21_pw2*k31_pw2*k23_pw2*k32*k15_pw2*k33*k16 - 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k36_pw2- k12*k21_pw2*k13_pw2*k31_pw2*k23*k15*k33_pw2*k25 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k15*k33_pw2*k26 - k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k36_pw2- 6*k11_pw2*k21_pw2*k31*k14*k32*k15*k33_pw2*k26_pw2- 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k33_pw2*k16*k25 - k12_pw2*k21_pw2*k13*k31_pw2*k23*k33_pw2*k16*k25 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k33_pw2*k16*k26 + 2*k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32*k33*k16 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k33_pw2*k25*k26 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k36_pw2+ 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k26*k36_pw2+ 12*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k36_pw2+ k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k36_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k15_pw2*k33_pw2*k35 - k12*k21_pw2*k13*k31_pw2*k23_pw2*k15_pw2*k33*k35 - k12*k21_pw2*k13*k31_pw2*k23_pw2*k32*k15_pw2*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32*k33*k16*k26_pw2- 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k26*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k26*k36_pw2- 4*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k36_pw2- k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k36_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k33_pw2*k16*k25*k26 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k26_pw2*k36 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k26_pw2*k35 - 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k33_pw2*k16*k35 + k12_pw2*k21_pw2*k31*k14*k23_pw2*k33_pw2*k16*k35 - k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32*k15*k36 - k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k15*k33*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k26*k36_pw2- 3*k11*k21_pw2*k14_pw2*k23_pw2*k32*k15*k33_pw2*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k33_pw2*k16*k25*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k26_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k26_pw2*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k26_pw2*k36 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k32*k15*k16*k36 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15*k33*k16*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k26_pw2*k35*k36 - 4*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k35*k36 + 12*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k35*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25*k26*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k26*k35*k36 - 4*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k35*k36 + 2*k11*k21*k13*k31_pw3*k23_pw3*k32*k15*k16 + 8*k11*k21*k13_pw2*k22*k31_pw4*k23*k16*k26 + 4*k11*k21*k13*k31_pw3*k14*k23_pw3*k16*k35 + 2*k21_pw3*k13*k22*k31*k14*k15*k33_pw3*k16 + 4*k11_pw2*k21*k13*k31_pw4*k23*k16*k25*k26 + 4*k11*k21_pw3*k31*k14*k15*k33_pw3*k16*k25 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k25*k36 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k26*k35 + 8*k21_pw4*k31*k14*k32*k15_pw2*k33*k16*k36 + 4*k21_pw4*k31*k14_pw2*k15*k33*k16*k35*k36 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k26_pw2+ 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k33*k26_pw2+ 3*k11*k12*k21*k22*k31_pw3*k23_pw2*k33*k16_pw2 + k11_pw2*k12*k21*k22*k31*k14*k33_pw3*k26_pw2- 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k33*k26_pw2+ 4*k11*k12*k21_pw2*k13*k31_pw3*k32*k16*k26_pw2+ k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k36_pw2- 2*k12*k21_pw2*k13*k22*k31_pw3*k23*k33*k16_pw2 - k11_pw2*k12*k21*k31_pw3*k23*k32*k16*k26_pw2- 6*k11_pw2*k12*k21*k13*k31_pw3*k33*k25*k26_pw2- k11_pw2*k12*k21*k22*k31_pw3*k33*k16*k26_pw2- k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k26_pw2- k11_pw2*k21*k13*k22*k31_pw3*k15*k33*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k26_pw2*k35 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k26_pw2*k36 - 6*k11*k21_pw2*k22*k31_pw3*k23*k15*k33*k16_pw2 - k11*k12*k21_pw2*k31_pw3*k23*k32*k16_pw2*k26 - k11*k12*k21_pw2*k31_pw3*k23*k33*k16_pw2*k25 - k11*k12*k21_pw2*k22*k31_pw3*k33*k16_pw2*k26 + k11*k12*k21*k31_pw2*k23_pw3*k15_pw2*k33*k35 + k11*k12*k21*k31_pw2*k23_pw3*k32*k15_pw2*k36 - 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k32*k15*k26 - 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k15*k33*k25 - 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k15_pw2*k36 + k12*k21_pw2*k13_pw2*k22*k31*k14*k33_pw3*k26 + k12*k21_pw2*k13_pw2*k31*k14*k23*k33_pw3*k25 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32*k33_pw3*k26 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k26_pw2*k35 + 3*k12*k21_pw3*k31*k14*k23*k32*k33_pw2*k16_pw2 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k26_pw2*k35 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k26_pw2*k36 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k33*k25*k26 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k33*k16*k26 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k26_pw2*k35 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k26_pw2*k36 - 2*k11_pw2*k13*k31_pw2*k14*k23_pw3*k32*k33*k26 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k15*k33*k26 - 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k15*k33*k16 - 6*k21_pw3*k13*k31_pw2*k14*k23*k32*k33*k16_pw2 - 2*k11*k21_pw2*k22*k31_pw2*k23*k15_pw3*k33*k36 - 12*k11*k21_pw2*k22*k31_pw3*k14*k23*k16_pw2*k36 + k11*k12_pw3*k21*k31_pw2*k23*k32*k26_pw2*k36 + k11*k12_pw3*k21*k31_pw2*k23*k33*k26_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k33*k26_pw2*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k25*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k26*k35 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k32*k16*k26 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k33*k16*k25 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k33*k16*k26 - 2*k12*k21_pw3*k31_pw2*k23*k32*k15*k33*k16_pw2 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k32*k15*k16*k26 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k15*k33*k16*k25 - 2*k21_pw2*k13_pw3*k31_pw2*k14*k23*k32*k33*k26 - 2*k21_pw3*k13*k31_pw2*k23*k32*k15_pw2*k33*k16 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k15*k33*k25*k26 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k25*k36 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k26*k35 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k26*k36 + 4*k11*k21_pw2*k22*k31_pw3*k23*k15_pw2*k16*k36 - 2*k11*k21_pw2*k22*k14_pw2*k23*k15*k33_pw3*k36 - 12*k11*k21_pw3*k31_pw2*k14*k32*k33*k16_pw2*k26 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k25*k36 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k26*k35 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k26*k36 - 4*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k35*k36 + 3*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k36_pw2+ 3*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k36_pw2- 4*k11_pw2*k21_pw2*k31*k14*k15*k33_pw3*k25*k26 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k26*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k25*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k26*k35 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k26*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k26*k36 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k26*k36 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k15*k33*k36 - 4*k21_pw2*k13_pw2*k22*k31_pw3*k14*k23*k16*k36 - 6*k21_pw3*k13_pw2*k31*k14*k32*k15*k33_pw2*k26 - k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k36_pw2- 2*k21_pw3*k13*k22*k31*k14*k15_pw2*k33_pw2*k36 - k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k36_pw2- 2*k21_pw3*k13*k31*k14*k23*k15_pw2*k33_pw2*k35 - 4*k11*k21_pw3*k31_pw2*k32*k15_pw2*k33*k16*k26 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k25*k36 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k26*k35 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k26*k36 - k12*k21_pw3*k31_pw2*k14*k23*k32*k16_pw2*k36 - k12*k21_pw3*k31_pw2*k14*k23*k33*k16_pw2*k35 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k36_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k26*k36_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k36_pw2+ 4*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k36_pw2- k12*k21_pw3*k22*k31_pw2*k14*k33*k16_pw2*k36 - k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k36_pw2- k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k36_pw2+ 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k25*k36 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k26*k35 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k25*k36 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k26*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k26*k36 + k12_pw3*k21_pw2*k22*k31*k14*k33*k26*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k26*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k36_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14*k32*k33*k16*k26 + 4*k21_pw3*k13*k22*k31*k14_pw2*k33_pw2*k16*k36 + 4*k21_pw3*k13*k31*k14_pw2*k23*k33_pw2*k16*k35 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25*k26*k36 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k26*k36_pw2- 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k36_pw2- 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k25*k36 - 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k26*k35 + 3*k12*k21_pw3*k31_pw2*k23*k15_pw2*k33*k16*k35 + 3*k12*k21_pw3*k31_pw2*k23*k32*k15_pw2*k16*k36 - 2*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k36_pw2- 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k25*k36 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k26*k35 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k26*k36 + 3*k12*k21_pw3*k22*k31_pw2*k15_pw2*k33*k16*k36 - 12*k11_pw2*k21_pw2*k31_pw3*k15*k33*k16*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k26*k36_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k36_pw2+ 3*k21_pw3*k13*k14_pw2*k23*k32*k15*k33_pw2*k36 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25*k26*k36 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k25*k36 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k26*k35 + 3*k12*k21_pw3*k14_pw2*k23*k32*k33_pw2*k16*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k26*k36 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k35*k36_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k26*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k25*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k26*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25*k26*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k26*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k26*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k25*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k26*k35 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k26*k36 + 4*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k35*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k26*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25*k26*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k26*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k25*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k26*k35 - 12*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k26*k35*k36 - 2*k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k35*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k26*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k26*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k26*k35*k36 - k11*k12*k21*k13*k31*k14*k23_pw2*k33_pw3*k25 + 3*k11*k12*k21*k22*k31*k14*k23_pw2*k33_pw3*k16 + 3*k11*k12*k21*k31*k14*k23_pw3*k32*k33_pw2*k16 - 2*k11*k12*k21*k31_pw2*k23_pw3*k32*k15*k33*k16 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k32*k16*k26 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k33*k16*k25 - 4*k11*k21*k13*k31_pw2*k14*k23_pw3*k32*k33*k16 + 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k15*k33*k16 - 2*k12*k21_pw2*k13*k22*k31*k14*k23*k33_pw3*k16 + 2*k11*k21_pw2*k13*k22*k31*k14*k15*k33_pw3*k26 + 2*k11*k21_pw2*k13*k31*k14*k23*k15*k33_pw3*k25 - 4*k11*k21_pw2*k22*k31*k14*k23*k15*k33_pw3*k16 - 2*k11*k12*k21_pw2*k22*k31*k14*k33_pw3*k16*k26 - 2*k11*k12*k21_pw2*k31*k14*k23*k33_pw3*k16*k25 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k33*k25*k26 - k11*k12*k21*k31*k14*k23_pw3*k15*k33_pw2*k35 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k15*k33*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k33_pw3*k25*k26 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k32*k16*k36 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k33*k16*k35 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k25*k36 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k26*k35 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k32*k15*k36 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k15*k33*k35 + 12*k11*k21*k13*k22*k31_pw3*k14*k23_pw2*k16*k36 - 2*k11*k21_pw2*k13*k31_pw3*k23*k32*k15*k16*k26 - 2*k11*k21_pw2*k13*k31_pw3*k23*k15*k33*k16*k25 - 2*k11*k21_pw2*k13*k22*k31_pw3*k15*k33*k16*k26 + 8*k11*k12*k21_pw2*k13*k31_pw3*k33*k16*k25*k26 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k26*k36 - 2*k11_pw2*k12*k21*k31_pw3*k23*k33*k16*k25*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k15*k33*k25*k26 + 8*k11_pw2*k21*k22*k31_pw3*k23*k15*k33*k16*k26 + 6*k21_pw3*k13*k31*k14*k23*k32*k15*k33_pw2*k16 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k25*k26*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k35*k36 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k25*k36 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k26*k35 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k26*k36 + 12*k11*k21_pw3*k31*k14*k32*k15*k33_pw2*k16*k26 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k25*k36 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k26*k35 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k25*k26*k36 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k26*k36 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k25*k26*k36 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k25*k26*k36 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k26*k36 - 4*k21_pw3*k13*k31*k14*k23*k32*k15_pw2*k33*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k33*k25*k26*k36 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k25*k36 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k26*k35 - 4*k12*k21_pw3*k22*k31*k14*k15*k33_pw2*k16*k36 - 4*k12*k21_pw3*k31*k14*k23*k15*k33_pw2*k16*k35 - 2*k21_pw3*k13*k31_pw2*k14*k23*k32*k15*k16*k36 - 2*k21_pw3*k13*k31_pw2*k14*k23*k15*k33*k16*k35 - 2*k21_pw3*k13*k22*k31_pw2*k14*k15*k33*k16*k36 + 8*k21_pw3*k13*k31*k14_pw2*k23*k32*k33*k16*k36 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k26*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k26*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k25*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k26*k35 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k26*k36 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k25*k36 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k26*k35 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k26*k36 + 6*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k35*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k35*k36 + 8*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k35*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k26*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k26*k35*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k26*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k26*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k26*k35*k36 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k33*k26_pw2+ k11*k12*k21*k13*k31_pw2*k23_pw2*k15*k33_pw2*k25 - 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k15*k33_pw2*k16 - 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k33_pw2*k16 + 3*k11_pw2*k12*k21*k31*k14*k23*k32*k33_pw2*k26_pw2+ 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k36_pw2+ 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k33_pw2*k26 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k33*k26_pw2+ 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k33*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k33_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k33_pw2*k16*k26 + 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k15_pw2*k33*k36 + 4*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32*k33*k26 + 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k15*k33_pw2*k16 - 3*k12*k21_pw2*k13*k31*k14*k23_pw2*k32*k33_pw2*k16 + 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k33*k16*k26 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k33_pw2*k16*k25 - 2*k11*k21_pw2*k13*k31_pw2*k23*k32*k15_pw2*k33*k26 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k33_pw2*k16*k26 - 6*k11*k21_pw2*k31*k14*k23_pw2*k32*k15*k33_pw2*k16 + 2*k11*k12*k21_pw2*k31_pw2*k23*k15*k33_pw2*k16*k25 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k26_pw2*k36 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k26_pw2*k35 + 2*k11*k12*k21_pw2*k22*k31_pw2*k15*k33_pw2*k16*k26 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32*k33_pw2*k26 + 2*k12*k21_pw2*k13*k31_pw2*k23_pw2*k32*k15*k33*k16 - 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k36_pw2- 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k26_pw2*k36 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k26_pw2*k35 - 2*k11_pw2*k12*k21*k31_pw2*k23*k15*k33_pw2*k25*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k26_pw2*k36 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k33_pw2*k25*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k33_pw2*k16*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k25*k36 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k26*k35 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k36_pw2+ 4*k11*k21_pw2*k22*k31*k14*k23*k15_pw2*k33_pw2*k36 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k36_pw2+ 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k26*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k26*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k26*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k36_pw2- 2*k12*k21_pw2*k13_pw2*k31_pw2*k23*k32*k15*k33*k26 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k15_pw2*k33*k36 + k12*k21_pw2*k13*k31*k14*k23_pw2*k15*k33_pw2*k35 - 8*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k33*k16*k26 - 2*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k33*k16*k26 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k36_pw2- 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k26*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k25*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k26*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k26*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k25*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k26*k35 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k33_pw2*k16*k36 + 4*k11*k21_pw2*k31*k14*k23_pw2*k32*k15_pw2*k33*k36 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k25*k36 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k26*k35 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k26*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k26*k36 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k32*k16*k36 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k33*k16*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k26*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k26*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k25*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k26*k35 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k33_pw2*k16*k36 - 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k15*k33*k36 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32*k15*k16*k36 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15*k33*k16*k35 - 8*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k33*k16*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k26*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k26*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k25*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k26*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k26*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k26*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k25*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k26*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k26*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k25*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k26*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k26*k36 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15*k33*k16*k36 + 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k33*k16*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k35*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25*k26*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k26*k35*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k35*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k26*k35*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k35*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25*k26*k36 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k15*k33_pw2*k26 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32*k33_pw2*k26 + 2*k11*k12*k21*k13*k31_pw2*k23_pw2*k32*k15*k33*k26 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k15*k33_pw2*k36 + 6*k11*k21_pw2*k13*k31*k14*k23*k32*k15*k33_pw2*k26 - 6*k11*k12*k21_pw2*k31*k14*k23*k32*k33_pw2*k16*k26 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k33*k16*k36 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k15*k33*k36 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k26*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k33*k16*k26 + 4*k11*k12*k21_pw2*k31_pw2*k23*k32*k15*k33*k16*k26 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k15*k33_pw2*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k26*k36 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k26*k36 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k33*k16*k36 + 2*k12*k21_pw2*k13*k31*k14*k23_pw2*k32*k15*k33*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k26*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k25*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k26*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k26*k36 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k26*k36 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15*k33*k16*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k26*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k25*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k26*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25*k26*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k26*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25*k26*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k26*k36 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k26*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k26*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k26*k35*k36 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k33_pw3*k26 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k33*k16*k26 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k26*k36 - 2*k11*k12*k21*k31*k14*k23_pw3*k32*k15*k33*k36 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k26*k36 - 8*k12*k21_pw3*k31*k14*k23*k32*k15*k33*k16*k36);
+    coeffs[1] = (4*k11_pw4*k31_pw4*k25*k26_pw3 + 4*k21_pw4*k14_pw4*k35*k36_pw3 - 2*k11_pw3*k13*k22*k31_pw4*k26_pw3 - 2*k21_pw3*k13*k22*k31_pw4*k16_pw3 - 4*k11*k21_pw3*k31_pw4*k16_pw3*k25 - 2*k21_pw4*k31_pw3*k32*k15*k16_pw3 + 2*k21_pw2*k13_pw4*k31_pw4*k25*k26 - 4*k21_pw4*k31_pw3*k14*k16_pw3*k35 - 2*k21_pw4*k14_pw3*k32*k15*k36_pw3 + 2*k21_pw4*k31_pw2*k15_pw4*k35*k36 + 4*k11_pw2*k22*k31_pw4*k23_pw3*k16_pw2 + k11_pw2*k31_pw3*k23_pw4*k15_pw2*k35 + k21_pw3*k13_pw2*k14_pw2*k33_pw4*k25 + 2*k21_pw3*k13_pw2*k31_pw4*k16_pw2*k25 + 4*k21_pw4*k14_pw2*k32*k33_pw3*k16_pw2 + 2*k21_pw4*k31_pw3*k15_pw2*k16_pw2*k35 + 4*k11*k21_pw2*k22*k31_pw4*k23*k16_pw3 - 2*k11*k21*k13_pw3*k22*k31_pw4*k26_pw2+ k11_pw3*k12*k31_pw3*k23*k32*k26_pw3 + k11_pw3*k12*k22*k31_pw3*k33*k26_pw3 + k12*k21_pw3*k31_pw3*k23*k32*k16_pw3 + k12*k21_pw3*k22*k31_pw3*k33*k16_pw3 + 2*k11_pw3*k21*k31_pw3*k32*k15*k26_pw3 - k11_pw2*k31_pw3*k23_pw4*k32*k15*k16 - 2*k11_pw2*k13*k31_pw4*k23_pw3*k16*k25 - k21_pw3*k13*k22*k14_pw2*k33_pw4*k16 + 2*k21_pw3*k13*k22*k31*k14_pw3*k36_pw3 + 4*k11_pw3*k21*k31_pw3*k14*k26_pw3*k35 - 6*k11_pw3*k13*k31_pw4*k23*k25*k26_pw2+ 4*k11_pw3*k22*k31_pw4*k23*k16*k26_pw2- 2*k21_pw2*k13_pw3*k31_pw4*k23*k16*k25 - 2*k21_pw2*k13_pw3*k22*k31_pw4*k16*k26 + 4*k21_pw4*k31_pw2*k14*k32*k33*k16_pw3 - 2*k11*k21_pw3*k14_pw2*k33_pw4*k16*k25 + 4*k11*k21_pw3*k31*k14_pw3*k25*k36_pw3 + k12*k21_pw3*k14_pw3*k23*k32*k36_pw3 + k12*k21_pw3*k22*k14_pw3*k33*k36_pw3 - 2*k11_pw2*k31_pw3*k14*k23_pw4*k16*k35 - 12*k11_pw3*k21*k31_pw4*k16*k25*k26_pw2- 2*k21_pw4*k31*k14*k32*k15_pw3*k36_pw2+ 4*k11_pw3*k31_pw4*k23_pw2*k16*k25*k26 - 2*k21_pw4*k31_pw2*k15_pw3*k33*k16*k35 - 2*k21_pw4*k31_pw2*k32*k15_pw3*k16*k36 - 2*k21_pw4*k14_pw2*k15*k33_pw3*k16*k35 + 4*k21_pw4*k14_pw3*k32*k33*k16*k36_pw2- 12*k21_pw4*k31*k14_pw3*k16*k35*k36_pw2- 6*k21_pw4*k14_pw3*k15*k33*k35*k36_pw2+ 4*k21_pw4*k14_pw3*k33_pw2*k16*k35*k36 + 2*k11_pw2*k13_pw2*k22*k31_pw4*k23*k26_pw2+ 2*k21_pw2*k13_pw2*k22*k31_pw4*k23*k16_pw2 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k32*k26_pw2- 2*k11_pw2*k12_pw2*k21*k31_pw3*k26_pw3*k35 + 6*k11_pw2*k21*k13_pw2*k31_pw4*k25*k26_pw2- 4*k11_pw2*k21*k31_pw4*k23_pw2*k16_pw2*k25 - 2*k12*k21_pw3*k22*k31_pw2*k15_pw3*k36_pw2+ 2*k11_pw2*k13_pw2*k31_pw4*k23_pw2*k25*k26 + 4*k11_pw2*k22*k31_pw3*k23_pw3*k15_pw2*k36 - k11_pw3*k31_pw3*k23_pw2*k32*k15*k26_pw2+ 2*k11_pw2*k21_pw2*k14_pw2*k33_pw4*k25*k26 + 12*k11_pw2*k21_pw2*k31_pw4*k16_pw2*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k25*k36_pw3 + 4*k21_pw3*k13_pw2*k14_pw2*k32*k33_pw3*k26 - k21_pw3*k13*k22*k14_pw3*k33_pw2*k36_pw2+ 2*k21_pw4*k31_pw2*k32*k15_pw2*k33*k16_pw2 - 2*k11_pw3*k31_pw3*k14*k23_pw2*k26_pw2*k35 - 2*k11*k21_pw3*k14_pw3*k33_pw2*k25*k36_pw2+ 2*k11_pw2*k31_pw2*k14_pw2*k23_pw4*k35*k36 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k25*k36 - 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k26*k35 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k25*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k26*k35 - 4*k21_pw4*k31*k14_pw2*k33_pw2*k16_pw2*k35 + 2*k12_pw4*k21_pw2*k31_pw2*k25*k26*k36_pw2+ 2*k21_pw4*k14_pw2*k32*k15_pw2*k33*k36_pw2+ 2*k12_pw4*k21_pw2*k31_pw2*k26_pw2*k35*k36 + 6*k21_pw4*k31*k14_pw2*k15_pw2*k35*k36_pw2+ 12*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k35*k36 + 2*k21_pw4*k14_pw2*k15_pw2*k33_pw2*k35*k36 + 4*k11_pw2*k21_pw2*k14_pw2*k32*k33_pw3*k26_pw2+ 4*k11_pw2*k22*k31_pw2*k14_pw2*k23_pw3*k36_pw2+ k11_pw2*k12_pw2*k31_pw3*k23_pw2*k26_pw2*k35 + 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k26_pw2*k35 + k12_pw2*k21_pw2*k31_pw3*k23_pw2*k16_pw2*k35 + k12_pw2*k21_pw3*k31_pw2*k33_pw2*k16_pw2*k25 + k21_pw2*k13_pw2*k31_pw3*k23_pw2*k15_pw2*k35 + k21_pw3*k13_pw2*k31_pw2*k15_pw2*k33_pw2*k25 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k26_pw2*k35 + 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k25*k36_pw2+ 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k25*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k25*k36_pw2- 2*k11_pw2*k12*k21*k13*k31_pw3*k32*k26_pw3 + k11*k12*k21*k31_pw3*k23_pw3*k32*k16_pw2 - 6*k11*k21*k13*k22*k31_pw4*k23_pw2*k16_pw2 + 2*k11_pw2*k21*k13*k22*k31_pw4*k16*k26_pw2- k11*k21_pw2*k13*k14_pw2*k23*k33_pw4*k25 + 2*k11*k21_pw2*k13*k31_pw4*k23*k16_pw2*k25 - k11*k21_pw2*k13*k22*k14_pw2*k33_pw4*k26 + 2*k11*k21_pw2*k13*k22*k31_pw4*k16_pw2*k26 + 2*k11*k21_pw2*k22*k14_pw2*k23*k33_pw4*k16 - 4*k11*k21_pw2*k22*k31*k14_pw3*k23*k36_pw3 + 4*k11*k21*k13_pw2*k31_pw4*k23_pw2*k16*k25 - 2*k11*k21*k13*k31_pw3*k23_pw3*k15_pw2*k35 + k12*k21_pw3*k22*k31*k14*k33_pw3*k16_pw2 - 8*k11_pw2*k21*k22*k31_pw4*k23*k16_pw2*k26 - 4*k11_pw3*k21*k31_pw2*k14*k32*k33*k26_pw3 + 2*k11_pw2*k31_pw2*k14*k23_pw4*k32*k33*k16 + k11_pw2*k12*k31_pw3*k23_pw3*k32*k16*k26 + k11_pw2*k12*k31_pw3*k23_pw3*k33*k16*k25 + k11_pw2*k13*k31_pw3*k23_pw3*k32*k15*k26 + k11_pw2*k13*k31_pw3*k23_pw3*k15*k33*k25 - 6*k11_pw2*k13*k22*k31_pw4*k23_pw2*k16*k26 - 4*k11_pw2*k22*k31_pw3*k23_pw3*k15*k33*k16 + 3*k21_pw3*k13*k31_pw3*k23*k32*k15*k16_pw2 + 3*k21_pw3*k13*k22*k31_pw3*k15*k33*k16_pw2 - 2*k12*k21_pw3*k13*k31_pw3*k32*k16_pw2*k26 - 2*k12*k21_pw3*k13*k31_pw3*k33*k16_pw2*k25 - 2*k12*k21_pw3*k22*k31*k14_pw2*k15*k36_pw3 + 3*k11_pw3*k12*k31_pw3*k23*k33*k25*k26_pw2- 2*k11_pw3*k22*k31_pw3*k23*k15*k33*k26_pw2+ k21_pw2*k13_pw3*k31_pw3*k23*k32*k15*k26 + k21_pw2*k13_pw3*k31_pw3*k23*k15*k33*k25 + k21_pw2*k13_pw3*k22*k31_pw3*k15*k33*k26 - 2*k21_pw3*k13_pw2*k31*k14*k15*k33_pw3*k25 - 4*k21_pw3*k13*k14_pw2*k23*k32*k33_pw3*k16 - 8*k11*k21_pw2*k13_pw2*k31_pw4*k16*k25*k26 + 6*k11*k21_pw3*k31_pw3*k32*k15*k16_pw2*k26 + 6*k11*k21_pw3*k31_pw3*k15*k33*k16_pw2*k25 - 4*k12*k21_pw2*k13_pw3*k31_pw3*k33*k25*k26 - k11_pw2*k31_pw2*k14*k23_pw4*k32*k15*k36 - k11_pw2*k31_pw2*k14*k23_pw4*k15*k33*k35 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k25*k36 - 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k26*k35 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k25*k36 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k26*k35 - 8*k11_pw2*k22*k31_pw3*k14*k23_pw3*k16*k36 + 6*k11_pw3*k21*k31_pw3*k15*k33*k25*k26_pw2+ k21_pw3*k13*k31_pw2*k23*k15_pw3*k33*k35 + k21_pw3*k13*k31_pw2*k23*k32*k15_pw3*k36 + 6*k21_pw3*k13*k31_pw3*k14*k23*k16_pw2*k35 + k21_pw3*k13*k22*k31_pw2*k15_pw3*k33*k36 + 6*k21_pw3*k13*k22*k31_pw3*k14*k16_pw2*k36 - 6*k21_pw4*k31*k14*k32*k15*k33_pw2*k16_pw2 - 8*k11*k21_pw3*k14_pw2*k32*k33_pw3*k16*k26 - 2*k12*k21_pw3*k31_pw3*k23*k15*k16_pw2*k35 - 2*k12*k21_pw3*k22*k31_pw3*k15*k16_pw2*k36 - 4*k11_pw3*k22*k31_pw3*k14*k23*k26_pw2*k36 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k25*k36 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k26*k35 + 2*k21_pw2*k13_pw3*k22*k31_pw3*k14*k26*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k32*k15*k16*k26 - 2*k21_pw3*k13_pw2*k31_pw3*k15*k33*k16*k25 - 2*k21_pw3*k13*k31_pw3*k23*k15_pw2*k16*k35 + k21_pw3*k13*k14_pw2*k23*k15*k33_pw3*k35 - 2*k21_pw3*k13*k14_pw3*k23*k32*k33*k36_pw2- 2*k21_pw3*k13*k22*k31_pw3*k15_pw2*k16*k36 + k21_pw3*k13*k22*k14_pw2*k15*k33_pw3*k36 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k25*k36 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k26*k35 + 2*k11*k21_pw3*k31_pw2*k32*k15_pw3*k26*k36 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k25*k36 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k26*k35 + k12*k21_pw3*k14_pw2*k23*k33_pw3*k16*k35 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k25*k36 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k26*k35 + k12*k21_pw3*k22*k14_pw2*k33_pw3*k16*k36 - 2*k11_pw3*k31_pw3*k23_pw2*k15*k33*k25*k26 + 12*k11_pw3*k21*k31_pw3*k14*k25*k26_pw2*k36 + 6*k21_pw3*k13*k31*k14_pw3*k23*k35*k36_pw2- 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k25*k36 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k26*k35 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k25*k36 + 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k26*k35 - 4*k11*k21_pw3*k14_pw3*k32*k33*k26*k36_pw2- 4*k12*k21_pw3*k31_pw2*k23*k15_pw3*k35*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k25*k36 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k26*k35 + 2*k21_pw4*k31_pw2*k14*k32*k15*k16_pw2*k36 + 2*k21_pw4*k31_pw2*k14*k15*k33*k16_pw2*k35 + 2*k21_pw4*k31*k14_pw2*k32*k15*k16*k36_pw2- 8*k21_pw4*k31*k14_pw2*k32*k33*k16_pw2*k36 + 4*k21_pw4*k31*k14*k15_pw2*k33_pw2*k16*k35 + 12*k11*k21_pw3*k31*k14_pw3*k26*k35*k36_pw2+ 3*k12*k21_pw3*k14_pw3*k23*k33*k35*k36_pw2- 4*k11_pw3*k31_pw3*k14*k23_pw2*k25*k26*k36 - 2*k21_pw3*k13*k14_pw3*k23*k33_pw2*k35*k36 - 6*k21_pw4*k14_pw2*k32*k15*k33_pw2*k16*k36 - 4*k11*k21_pw3*k14_pw3*k33_pw2*k26*k35*k36 - 8*k21_pw4*k31_pw2*k14*k15_pw2*k16*k35*k36 + 2*k11_pw2*k12_pw2*k21*k31_pw2*k32*k33*k26_pw3 - k11_pw2*k12*k13*k31_pw3*k23_pw2*k32*k26_pw2- k12*k21_pw2*k13*k31_pw3*k23_pw2*k32*k16_pw2 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k32*k15*k26_pw2- 3*k11*k21_pw2*k31_pw3*k23_pw2*k32*k15*k16_pw2 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k33_pw2*k25 + 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k33_pw2*k16 + 2*k12_pw2*k21_pw2*k22*k31*k14_pw2*k23*k36_pw3 - 3*k21_pw3*k13*k22*k31_pw2*k14*k33_pw2*k16_pw2 + 4*k11*k21_pw2*k14_pw2*k23_pw2*k32*k33_pw3*k16 - k12*k21_pw3*k22*k31_pw2*k15*k33_pw2*k16_pw2 + 2*k11_pw3*k22*k31_pw2*k14*k23*k33_pw2*k26_pw2- k21_pw2*k13_pw2*k31_pw3*k23_pw2*k32*k15*k16 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k33_pw2*k25 - k21_pw2*k13_pw3*k22*k31_pw2*k14*k33_pw2*k26 - k21_pw3*k13*k22*k31_pw2*k15_pw2*k33_pw2*k16 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k26_pw2*k35 - k11*k21_pw2*k31_pw2*k23_pw2*k15_pw3*k33*k35 - k11*k21_pw2*k31_pw2*k23_pw2*k32*k15_pw3*k36 - 6*k11*k21_pw2*k31_pw3*k14*k23_pw2*k16_pw2*k35 + 2*k11*k21_pw2*k22*k14_pw3*k23*k33_pw2*k36_pw2- 6*k11*k21_pw3*k31_pw2*k14*k33_pw2*k16_pw2*k25 + 2*k11_pw2*k12_pw2*k22*k31_pw3*k23*k26_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k32*k15*k16*k26_pw2+ 2*k11_pw3*k31_pw2*k14*k23_pw2*k32*k33*k26_pw2- 6*k11_pw3*k21*k31_pw2*k14*k33_pw2*k25*k26_pw2+ 2*k12_pw2*k21_pw2*k22*k31_pw3*k23*k16_pw2*k36 + 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k15_pw2*k36 + 2*k21_pw3*k13*k22*k31_pw2*k14*k15_pw2*k36_pw2+ 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k26_pw2*k35 + 2*k11*k21_pw2*k31_pw3*k23_pw2*k15_pw2*k16*k35 - k11*k21_pw2*k14_pw2*k23_pw2*k15*k33_pw3*k35 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k32*k33*k36_pw2- 2*k11*k21_pw3*k31_pw2*k15_pw2*k33_pw2*k16*k25 - 6*k11_pw2*k12_pw2*k21*k31_pw3*k25*k26_pw2*k36 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k25*k36 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k26*k35 + 2*k12_pw2*k21_pw3*k31_pw2*k32*k33*k16_pw2*k26 - 2*k21_pw2*k13_pw2*k31_pw3*k14*k23_pw2*k16*k35 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k32*k26_pw2*k36 - 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k26_pw2*k35 + 2*k21_pw3*k13_pw2*k31_pw2*k14*k33_pw2*k16*k25 + 2*k21_pw3*k13_pw2*k31_pw2*k32*k15_pw2*k33*k26 - 6*k21_pw3*k13*k22*k31_pw2*k14_pw2*k16*k36_pw2- 6*k11*k21_pw2*k31*k14_pw3*k23_pw2*k35*k36_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k25*k36_pw2- k12*k21_pw3*k22*k14_pw2*k15*k33_pw2*k36_pw2- 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k26_pw2*k35 + 2*k11_pw3*k31_pw2*k14*k23_pw2*k33_pw2*k25*k26 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k25*k36_pw2- 2*k12_pw3*k21_pw2*k22*k31_pw2*k15*k26*k36_pw2- 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k25*k36_pw2+ 2*k11_pw2*k12_pw2*k31_pw3*k23_pw2*k25*k26*k36 + 4*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k25*k26*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k25*k36_pw2- 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k25*k36 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k26*k35 + 2*k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k35*k36 + 4*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k25*k26*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k32*k33*k26*k36_pw2- 6*k12_pw2*k21_pw3*k31*k14_pw2*k26*k35*k36_pw2+ 4*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k26*k35*k36 + 4*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k26*k35*k36 + 2*k12_pw2*k21_pw3*k14_pw2*k33_pw2*k26*k35*k36 - 4*k11*k21*k13_pw3*k31_pw4*k23*k25*k26 - 4*k21_pw4*k31*k14*k15_pw3*k33*k35*k36 + 3*k11_pw2*k12_pw2*k21*k31_pw2*k33_pw2*k25*k26_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k32*k33*k26_pw2+ 2*k11_pw2*k21_pw2*k31_pw2*k32*k15_pw2*k33*k26_pw2+ 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15_pw2*k36_pw2+ 2*k21_pw2*k13_pw2*k22*k31_pw2*k14_pw2*k23*k36_pw2- 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k25*k36_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw2*k33_pw2*k25*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k15_pw2*k33_pw2*k25*k26 - 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k26_pw2*k35 + 3*k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k35*k36_pw2+ 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k25*k26*k36_pw2+ 2*k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k35*k36 + 2*k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k35*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k26_pw2*k35*k36 - k11*k12_pw2*k21*k13*k22*k31_pw2*k33_pw2*k26_pw2- k11_pw2*k12*k21*k22*k31_pw2*k15*k33_pw2*k26_pw2+ k11_pw2*k21*k13*k22*k31_pw2*k14*k33_pw2*k26_pw2+ 6*k11*k21_pw2*k22*k31_pw2*k14*k23*k33_pw2*k16_pw2 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k25 - 6*k11*k21*k13*k22*k31_pw2*k14_pw2*k23_pw2*k36_pw2+ k11*k12_pw2*k21*k31_pw2*k23_pw2*k33_pw2*k16*k25 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k32*k33*k26_pw2+ 6*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32*k33*k16_pw2 - k11*k21_pw2*k13*k31_pw2*k23*k15_pw2*k33_pw2*k25 - k11*k21_pw2*k13*k22*k31_pw2*k15_pw2*k33_pw2*k26 + 2*k11*k21_pw2*k22*k31_pw2*k23*k15_pw2*k33_pw2*k16 - 3*k11_pw2*k13*k22*k31_pw2*k14*k23_pw2*k33_pw2*k26 + 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k33_pw2*k16 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k32*k33*k16*k26_pw2+ 2*k11*k21_pw2*k31_pw2*k23_pw2*k32*k15_pw2*k33*k16 - 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15_pw2*k36_pw2- k12*k21_pw2*k13_pw2*k31_pw2*k23*k15*k33_pw2*k25 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k15*k33_pw2*k26 - k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k32*k36_pw2- 6*k11_pw2*k21_pw2*k31*k14*k32*k15*k33_pw2*k26_pw2- 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k33_pw2*k16*k25 - k12_pw2*k21_pw2*k13*k31_pw2*k23*k33_pw2*k16*k25 - k12_pw2*k21_pw2*k13*k22*k31_pw2*k33_pw2*k16*k26 + 2*k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32*k33*k16 - 4*k11*k21_pw2*k13_pw2*k31_pw2*k14*k33_pw2*k25*k26 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k25*k36_pw2+ 2*k11*k21_pw2*k13*k22*k31_pw2*k14_pw2*k26*k36_pw2+ 12*k11*k21_pw2*k22*k31_pw2*k14_pw2*k23*k16*k36_pw2+ k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k15*k36_pw2+ 2*k11*k21_pw2*k31*k14*k23_pw2*k15_pw2*k33_pw2*k35 - k12*k21_pw2*k13*k31_pw2*k23_pw2*k15_pw2*k33*k35 - k12*k21_pw2*k13*k31_pw2*k23_pw2*k32*k15_pw2*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k32*k33*k16*k26_pw2- 8*k11_pw2*k21*k22*k31_pw2*k14_pw2*k23*k26*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k25*k36_pw2+ 2*k12_pw2*k21_pw2*k13*k22*k31_pw2*k14*k26*k36_pw2- 4*k12_pw2*k21_pw2*k22*k31_pw2*k14*k23*k16*k36_pw2- k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k15*k36_pw2- 4*k11*k12_pw2*k21_pw2*k31_pw2*k33_pw2*k16*k25*k26 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k32*k15*k26_pw2*k36 + 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k26_pw2*k35 - 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k33_pw2*k16*k35 + k12_pw2*k21_pw2*k31*k14*k23_pw2*k33_pw2*k16*k35 - k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k32*k15*k36 - k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k15*k33*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k25*k26*k36_pw2- 3*k11*k21_pw2*k14_pw2*k23_pw2*k32*k15*k33_pw2*k36 + 12*k11_pw2*k21_pw2*k31_pw2*k14*k33_pw2*k16*k25*k26 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k32*k15*k26_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k26_pw2*k35 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k32*k33*k26_pw2*k36 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k32*k15*k16*k36 - k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15*k33*k16*k35 - 8*k11*k12_pw2*k21_pw2*k31_pw2*k14*k26_pw2*k35*k36 - 4*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k35*k36 + 12*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k35*k36 - 8*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k25*k26*k36 - 8*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k26*k35*k36 - 4*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k35*k36 + 2*k11*k21*k13*k31_pw3*k23_pw3*k32*k15*k16 + 8*k11*k21*k13_pw2*k22*k31_pw4*k23*k16*k26 + 4*k11*k21*k13*k31_pw3*k14*k23_pw3*k16*k35 + 2*k21_pw3*k13*k22*k31*k14*k15*k33_pw3*k16 + 4*k11_pw2*k21*k13*k31_pw4*k23*k16*k25*k26 + 4*k11*k21_pw3*k31*k14*k15*k33_pw3*k16*k25 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k25*k36 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k26*k35 + 8*k21_pw4*k31*k14*k32*k15_pw2*k33*k16*k36 + 4*k21_pw4*k31*k14_pw2*k15*k33*k16*k35*k36 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k32*k26_pw2+ 3*k11*k12*k21*k13_pw2*k22*k31_pw3*k33*k26_pw2+ 3*k11*k12*k21*k22*k31_pw3*k23_pw2*k33*k16_pw2 + k11_pw2*k12*k21*k22*k31*k14*k33_pw3*k26_pw2- 2*k11_pw2*k12*k13*k22*k31_pw3*k23*k33*k26_pw2+ 4*k11*k12*k21_pw2*k13*k31_pw3*k32*k16*k26_pw2+ k11*k12*k21*k31*k14_pw2*k23_pw3*k32*k36_pw2- 2*k12*k21_pw2*k13*k22*k31_pw3*k23*k33*k16_pw2 - k11_pw2*k12*k21*k31_pw3*k23*k32*k16*k26_pw2- 6*k11_pw2*k12*k21*k13*k31_pw3*k33*k25*k26_pw2- k11_pw2*k12*k21*k22*k31_pw3*k33*k16*k26_pw2- k11_pw2*k21*k13*k31_pw3*k23*k32*k15*k26_pw2- k11_pw2*k21*k13*k22*k31_pw3*k15*k33*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k26_pw2*k35 - 2*k11*k12_pw2*k21*k13*k22*k31_pw3*k26_pw2*k36 - 6*k11*k21_pw2*k22*k31_pw3*k23*k15*k33*k16_pw2 - k11*k12*k21_pw2*k31_pw3*k23*k32*k16_pw2*k26 - k11*k12*k21_pw2*k31_pw3*k23*k33*k16_pw2*k25 - k11*k12*k21_pw2*k22*k31_pw3*k33*k16_pw2*k26 + k11*k12*k21*k31_pw2*k23_pw3*k15_pw2*k33*k35 + k11*k12*k21*k31_pw2*k23_pw3*k32*k15_pw2*k36 - 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k32*k15*k26 - 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k15*k33*k25 - 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k15_pw2*k36 + k12*k21_pw2*k13_pw2*k22*k31*k14*k33_pw3*k26 + k12*k21_pw2*k13_pw2*k31*k14*k23*k33_pw3*k25 - 4*k11*k21_pw2*k13*k14_pw2*k23*k32*k33_pw3*k26 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k26_pw2*k35 + 3*k12*k21_pw3*k31*k14*k23*k32*k33_pw2*k16_pw2 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k26_pw2*k35 + 6*k11_pw2*k12*k21*k22*k31_pw3*k15*k26_pw2*k36 - 2*k11_pw2*k12*k13*k31_pw3*k23_pw2*k33*k25*k26 + 3*k11_pw2*k12*k22*k31_pw3*k23_pw2*k33*k16*k26 - 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k26_pw2*k35 - 2*k11_pw2*k21*k13*k22*k31_pw3*k14*k26_pw2*k36 - 2*k11_pw2*k13*k31_pw2*k14*k23_pw3*k32*k33*k26 + 3*k11_pw2*k13*k22*k31_pw3*k23_pw2*k15*k33*k26 - 2*k21_pw2*k13_pw2*k22*k31_pw3*k23*k15*k33*k16 - 6*k21_pw3*k13*k31_pw2*k14*k23*k32*k33*k16_pw2 - 2*k11*k21_pw2*k22*k31_pw2*k23*k15_pw3*k33*k36 - 12*k11*k21_pw2*k22*k31_pw3*k14*k23*k16_pw2*k36 + k11*k12_pw3*k21*k31_pw2*k23*k32*k26_pw2*k36 + k11*k12_pw3*k21*k31_pw2*k23*k33*k26_pw2*k35 + k11*k12_pw3*k21*k22*k31_pw2*k33*k26_pw2*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k25*k36 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k26*k35 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k32*k16*k26 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k33*k16*k25 + 3*k12*k21_pw2*k13_pw2*k22*k31_pw3*k33*k16*k26 - 2*k12*k21_pw3*k31_pw2*k23*k32*k15*k33*k16_pw2 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k32*k15*k16*k26 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k15*k33*k16*k25 - 2*k21_pw2*k13_pw3*k31_pw2*k14*k23*k32*k33*k26 - 2*k21_pw3*k13*k31_pw2*k23*k32*k15_pw2*k33*k16 + 4*k11*k21_pw2*k13_pw2*k31_pw3*k15*k33*k25*k26 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k25*k36 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k26*k35 + 6*k11*k21_pw2*k13*k22*k31_pw3*k15_pw2*k26*k36 + 4*k11*k21_pw2*k22*k31_pw3*k23*k15_pw2*k16*k36 - 2*k11*k21_pw2*k22*k14_pw2*k23*k15*k33_pw3*k36 - 12*k11*k21_pw3*k31_pw2*k14*k32*k33*k16_pw2*k26 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k25*k36 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k26*k35 + k11*k12*k21_pw2*k22*k14_pw2*k33_pw3*k26*k36 - 4*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k35*k36 + 3*k12*k21_pw3*k22*k31*k14*k15_pw2*k33*k36_pw2+ 3*k12*k21_pw3*k31*k14*k23*k32*k15_pw2*k36_pw2- 4*k11_pw2*k21_pw2*k31*k14*k15*k33_pw3*k25*k26 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k32*k26*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k25*k36 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k26*k35 - 6*k11_pw2*k12*k22*k31_pw3*k23_pw2*k15*k26*k36 - 8*k11_pw2*k21*k22*k31_pw3*k23*k15_pw2*k26*k36 + 6*k11_pw2*k13*k22*k31_pw3*k14*k23_pw2*k26*k36 - 4*k11_pw2*k22*k31_pw2*k14*k23_pw3*k15*k33*k36 - 4*k21_pw2*k13_pw2*k22*k31_pw3*k14*k23*k16*k36 - 6*k21_pw3*k13_pw2*k31*k14*k32*k15*k33_pw2*k26 - k21_pw3*k13*k22*k31*k14_pw2*k15*k33*k36_pw2- 2*k21_pw3*k13*k22*k31*k14*k15_pw2*k33_pw2*k36 - k21_pw3*k13*k31*k14_pw2*k23*k32*k15*k36_pw2- 2*k21_pw3*k13*k31*k14*k23*k15_pw2*k33_pw2*k35 - 4*k11*k21_pw3*k31_pw2*k32*k15_pw2*k33*k16*k26 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k25*k36 - 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k26*k35 - 2*k12*k21_pw2*k13_pw2*k22*k31_pw3*k15*k26*k36 - k12*k21_pw3*k31_pw2*k14*k23*k32*k16_pw2*k36 - k12*k21_pw3*k31_pw2*k14*k23*k33*k16_pw2*k35 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k25*k36_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k32*k26*k36_pw2+ 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k25*k36_pw2+ 4*k12*k21_pw3*k22*k31_pw2*k14*k15*k16*k36_pw2- k12*k21_pw3*k22*k31_pw2*k14*k33*k16_pw2*k36 - k12*k21_pw3*k22*k31*k14_pw2*k33*k16*k36_pw2- k12*k21_pw3*k31*k14_pw2*k23*k32*k16*k36_pw2+ 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k25*k36 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k26*k35 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k25*k36 - 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k26*k35 - 2*k12_pw2*k21_pw2*k13*k22*k31_pw3*k16*k26*k36 + k12_pw3*k21_pw2*k22*k31*k14*k33*k26*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k32*k26*k36_pw2+ k12_pw3*k21_pw2*k31*k14*k23*k33*k25*k36_pw2+ 4*k21_pw3*k13_pw2*k31_pw2*k14*k32*k33*k16*k26 + 4*k21_pw3*k13*k22*k31*k14_pw2*k33_pw2*k16*k36 + 4*k21_pw3*k13*k31*k14_pw2*k23*k33_pw2*k16*k35 + 8*k11*k21_pw2*k13_pw2*k31_pw3*k14*k25*k26*k36 - 2*k11*k21_pw3*k31*k14_pw2*k32*k15*k26*k36_pw2- 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k25*k36_pw2- 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k25*k36 - 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k26*k35 + 3*k12*k21_pw3*k31_pw2*k23*k15_pw2*k33*k16*k35 + 3*k12*k21_pw3*k31_pw2*k23*k32*k15_pw2*k16*k36 - 2*k12*k21_pw3*k14_pw2*k23*k32*k15*k33*k36_pw2- 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k25*k36 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k26*k35 - 2*k12*k21_pw3*k13*k31_pw2*k32*k15_pw2*k26*k36 + 3*k12*k21_pw3*k22*k31_pw2*k15_pw2*k33*k16*k36 - 12*k11_pw2*k21_pw2*k31_pw3*k15*k33*k16*k25*k26 - 2*k12_pw2*k21_pw3*k31*k14*k32*k15*k26*k36_pw2- 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k25*k36_pw2+ 3*k21_pw3*k13*k14_pw2*k23*k32*k15*k33_pw2*k36 + 8*k11*k12_pw2*k21_pw2*k31_pw3*k16*k25*k26*k36 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k25*k36 + 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k26*k35 + 3*k12*k21_pw3*k14_pw2*k23*k32*k33_pw2*k16*k36 - 6*k12*k21_pw3*k13*k14_pw2*k32*k33_pw2*k26*k36 - 6*k12*k21_pw3*k31*k14_pw2*k23*k15*k35*k36_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k32*k16*k26*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k25*k36 + k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k26*k35 - 4*k12_pw3*k21_pw2*k13*k31_pw2*k33*k25*k26*k36 + k12_pw3*k21_pw2*k22*k31_pw2*k33*k16*k26*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k32*k15*k26*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k25*k36 + 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k26*k35 - 8*k21_pw3*k13_pw2*k31*k14_pw2*k32*k33*k26*k36 + 4*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k35*k36 + 6*k11*k21_pw3*k14_pw2*k32*k15*k33_pw2*k26*k36 - 24*k11_pw2*k21_pw2*k31_pw3*k14*k16*k25*k26*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k32*k15*k16*k26*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k25*k36 - 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k26*k35 - 12*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k35*k36 + 8*k11*k21_pw3*k31_pw2*k14*k15_pw2*k26*k35*k36 - 2*k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k35*k36 - 4*k12_pw3*k21_pw2*k31_pw2*k23*k15*k26*k35*k36 - 24*k11*k21_pw3*k31_pw2*k14_pw2*k16*k26*k35*k36 + 8*k12_pw2*k21_pw3*k31_pw2*k14*k16*k26*k35*k36 - k11*k12*k21*k13*k31*k14*k23_pw2*k33_pw3*k25 + 3*k11*k12*k21*k22*k31*k14*k23_pw2*k33_pw3*k16 + 3*k11*k12*k21*k31*k14*k23_pw3*k32*k33_pw2*k16 - 2*k11*k12*k21*k31_pw2*k23_pw3*k32*k15*k33*k16 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k32*k16*k26 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k33*k16*k25 - 4*k11*k21*k13*k31_pw2*k14*k23_pw3*k32*k33*k16 + 6*k11*k21*k13*k22*k31_pw3*k23_pw2*k15*k33*k16 - 2*k12*k21_pw2*k13*k22*k31*k14*k23*k33_pw3*k16 + 2*k11*k21_pw2*k13*k22*k31*k14*k15*k33_pw3*k26 + 2*k11*k21_pw2*k13*k31*k14*k23*k15*k33_pw3*k25 - 4*k11*k21_pw2*k22*k31*k14*k23*k15*k33_pw3*k16 - 2*k11*k12*k21_pw2*k22*k31*k14*k33_pw3*k16*k26 - 2*k11*k12*k21_pw2*k31*k14*k23*k33_pw3*k16*k25 + 6*k11*k12*k21*k13_pw2*k31_pw3*k23*k33*k25*k26 - k11*k12*k21*k31*k14*k23_pw3*k15*k33_pw2*k35 - 4*k11*k21*k13_pw2*k22*k31_pw3*k23*k15*k33*k26 + 2*k11_pw2*k12*k21*k31*k14*k23*k33_pw3*k25*k26 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k32*k16*k36 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k33*k16*k35 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k25*k36 + 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k26*k35 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k32*k15*k36 + 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k15*k33*k35 + 12*k11*k21*k13*k22*k31_pw3*k14*k23_pw2*k16*k36 - 2*k11*k21_pw2*k13*k31_pw3*k23*k32*k15*k16*k26 - 2*k11*k21_pw2*k13*k31_pw3*k23*k15*k33*k16*k25 - 2*k11*k21_pw2*k13*k22*k31_pw3*k15*k33*k16*k26 + 8*k11*k12*k21_pw2*k13*k31_pw3*k33*k16*k25*k26 - 8*k11*k21*k13_pw2*k22*k31_pw3*k14*k23*k26*k36 - 2*k11_pw2*k12*k21*k31_pw3*k23*k33*k16*k25*k26 - 2*k11_pw2*k21*k13*k31_pw3*k23*k15*k33*k25*k26 + 8*k11_pw2*k21*k22*k31_pw3*k23*k15*k33*k16*k26 + 6*k21_pw3*k13*k31*k14*k23*k32*k15*k33_pw2*k16 - 4*k11*k12_pw2*k21*k13*k31_pw3*k23*k25*k26*k36 + 2*k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k35*k36 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k25*k36 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k26*k35 - 4*k11*k21_pw2*k13*k22*k31_pw3*k14*k16*k26*k36 + 12*k11*k21_pw3*k31*k14*k32*k15*k33_pw2*k16*k26 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k25*k36 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k26*k35 - 16*k11*k12*k21_pw2*k13*k31_pw3*k15*k25*k26*k36 - 4*k11*k12*k21_pw2*k22*k31_pw3*k15*k16*k26*k36 + 12*k11_pw2*k12*k21*k31_pw3*k23*k15*k25*k26*k36 - 4*k11_pw2*k21*k13*k31_pw3*k14*k23*k25*k26*k36 + 16*k11_pw2*k21*k22*k31_pw3*k14*k23*k16*k26*k36 - 4*k21_pw3*k13*k31*k14*k23*k32*k15_pw2*k33*k36 + 2*k11*k12_pw3*k21*k31_pw2*k23*k33*k25*k26*k36 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k25*k36 + 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k26*k35 - 4*k12*k21_pw3*k22*k31*k14*k15*k33_pw2*k16*k36 - 4*k12*k21_pw3*k31*k14*k23*k15*k33_pw2*k16*k35 - 2*k21_pw3*k13*k31_pw2*k14*k23*k32*k15*k16*k36 - 2*k21_pw3*k13*k31_pw2*k14*k23*k15*k33*k16*k35 - 2*k21_pw3*k13*k22*k31_pw2*k14*k15*k33*k16*k36 + 8*k21_pw3*k13*k31*k14_pw2*k23*k32*k33*k16*k36 - 8*k11*k21_pw3*k31*k14*k32*k15_pw2*k33*k26*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k32*k16*k26*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k25*k36 - 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k26*k35 - 4*k11*k21_pw3*k31_pw2*k14*k32*k15*k16*k26*k36 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k25*k36 - 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k26*k35 + 16*k11*k21_pw3*k31*k14_pw2*k32*k33*k16*k26*k36 + 6*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k35*k36 - 2*k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k35*k36 + 8*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k35*k36 - 16*k12*k21_pw3*k13*k31_pw2*k14*k15*k26*k35*k36 + 12*k12*k21_pw3*k13*k31*k14_pw2*k33*k26*k35*k36 - 2*k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k35*k36 + 2*k12_pw3*k21_pw2*k31*k14*k23*k33*k26*k35*k36 - 4*k11*k21_pw3*k31*k14_pw2*k15*k33*k26*k35*k36 - 4*k12_pw2*k21_pw3*k31*k14*k15*k33*k26*k35*k36 - 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k32*k33*k26_pw2+ k11*k12*k21*k13*k31_pw2*k23_pw2*k15*k33_pw2*k25 - 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k15*k33_pw2*k16 - 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k33_pw2*k16 + 3*k11_pw2*k12*k21*k31*k14*k23*k32*k33_pw2*k26_pw2+ 3*k11*k12*k21*k22*k31*k14_pw2*k23_pw2*k33*k36_pw2+ 4*k11*k21*k13_pw2*k22*k31_pw2*k14*k23*k33_pw2*k26 - 2*k11_pw2*k12*k21*k31_pw2*k23*k32*k15*k33*k26_pw2+ 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k32*k33*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw2*k23*k33_pw2*k25*k26 + 2*k11*k12_pw2*k21*k22*k31_pw2*k23*k33_pw2*k16*k26 + 3*k11*k12*k21*k22*k31_pw2*k23_pw2*k15_pw2*k33*k36 + 4*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k32*k33*k26 + 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k15*k33_pw2*k16 - 3*k12*k21_pw2*k13*k31*k14*k23_pw2*k32*k33_pw2*k16 + 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k33*k16*k26 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k33_pw2*k16*k25 - 2*k11*k21_pw2*k13*k31_pw2*k23*k32*k15_pw2*k33*k26 + 2*k11*k21_pw2*k13*k22*k31_pw2*k14*k33_pw2*k16*k26 - 6*k11*k21_pw2*k31*k14*k23_pw2*k32*k15*k33_pw2*k16 + 2*k11*k12*k21_pw2*k31_pw2*k23*k15*k33_pw2*k16*k25 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k32*k26_pw2*k36 + 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k26_pw2*k35 + 2*k11*k12*k21_pw2*k22*k31_pw2*k15*k33_pw2*k16*k26 + 3*k12*k21_pw2*k13_pw2*k31*k14*k23*k32*k33_pw2*k26 + 2*k12*k21_pw2*k13*k31_pw2*k23_pw2*k32*k15*k33*k16 - 2*k12*k21_pw2*k13*k22*k31*k14_pw2*k23*k33*k36_pw2- 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k32*k26_pw2*k36 - 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k26_pw2*k35 - 2*k11_pw2*k12*k21*k31_pw2*k23*k15*k33_pw2*k25*k26 - 5*k11_pw2*k12*k21*k22*k31_pw2*k14*k33*k26_pw2*k36 + 2*k11_pw2*k21*k13*k31_pw2*k14*k23*k33_pw2*k25*k26 - 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k33_pw2*k16*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k25*k36 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k26*k35 + 2*k11*k21_pw2*k22*k31*k14_pw2*k23*k15*k33*k36_pw2+ 4*k11*k21_pw2*k22*k31*k14*k23*k15_pw2*k33_pw2*k36 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k25*k36_pw2+ 4*k11*k12*k21_pw2*k22*k31_pw2*k14*k15*k26*k36_pw2- 5*k11*k12*k21_pw2*k22*k31*k14_pw2*k33*k26*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k32*k26*k36_pw2- 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k25*k36_pw2- 2*k12*k21_pw2*k13_pw2*k31_pw2*k23*k32*k15*k33*k26 - 2*k12*k21_pw2*k13*k22*k31_pw2*k23*k15_pw2*k33*k36 + k12*k21_pw2*k13*k31*k14*k23_pw2*k15*k33_pw2*k35 - 8*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k33*k16*k26 - 2*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k33*k16*k26 - 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k15*k33*k36_pw2- 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k32*k15*k26*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k25*k36 - 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k26*k35 + 4*k11*k21_pw2*k13*k22*k31*k14_pw2*k33_pw2*k26*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k25*k36 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k26*k35 - 8*k11*k21_pw2*k22*k31*k14_pw2*k23*k33_pw2*k16*k36 + 4*k11*k21_pw2*k31*k14*k23_pw2*k32*k15_pw2*k33*k36 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k25*k36 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k26*k35 - k11*k12*k21_pw2*k31_pw2*k23*k32*k15_pw2*k26*k36 - k11*k12*k21_pw2*k22*k31_pw2*k15_pw2*k33*k26*k36 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k32*k16*k36 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k33*k16*k35 + 3*k11_pw2*k12*k22*k31_pw2*k14*k23_pw2*k33*k26*k36 - 2*k12_pw2*k21_pw2*k13*k22*k31*k14*k33_pw2*k26*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k25*k36 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k26*k35 + 2*k12_pw2*k21_pw2*k22*k31*k14*k23*k33_pw2*k16*k36 - 2*k21_pw2*k13_pw2*k22*k31_pw2*k14*k23*k15*k33*k36 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k32*k15*k16*k36 + 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15*k33*k16*k35 - 8*k11*k21_pw2*k31*k14_pw2*k23_pw2*k32*k33*k16*k36 + 3*k11*k12*k21_pw2*k14_pw2*k23*k32*k33_pw2*k26*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k32*k26*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k25*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k26*k35 - k12*k21_pw2*k13_pw2*k22*k31_pw2*k14*k33*k26*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k32*k15*k26*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k25*k36 + 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k26*k35 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k32*k15*k26*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k25*k36 + 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k26*k35 + 3*k12_pw2*k21_pw2*k13*k22*k31_pw2*k15*k33*k26*k36 - 2*k12_pw2*k21_pw2*k22*k31_pw2*k23*k15*k33*k16*k36 + 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k32*k33*k16*k36 - 2*k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k35*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k25*k26*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k26*k35*k36 + 2*k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k35*k36 + 4*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k26*k35*k36 - 2*k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k35*k36 + 4*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k25*k26*k36 + 2*k11*k12*k21*k13*k22*k31_pw2*k23*k15*k33_pw2*k26 - 3*k11*k12*k21*k13*k31*k14*k23_pw2*k32*k33_pw2*k26 + 2*k11*k12*k21*k13*k31_pw2*k23_pw2*k32*k15*k33*k26 - 3*k11*k12*k21*k22*k31*k14*k23_pw2*k15*k33_pw2*k36 + 6*k11*k21_pw2*k13*k31*k14*k23*k32*k15*k33_pw2*k26 - 6*k11*k12*k21_pw2*k31*k14*k23*k32*k33_pw2*k16*k26 - 6*k11*k12*k21*k22*k31_pw2*k14*k23_pw2*k33*k16*k36 + 6*k11*k21*k13*k22*k31_pw2*k14*k23_pw2*k15*k33*k36 + 2*k11*k12_pw2*k21*k22*k31*k14*k23*k33_pw2*k26*k36 + 4*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k33*k16*k26 + 4*k11*k12*k21_pw2*k31_pw2*k23*k32*k15*k33*k16*k26 + 2*k12*k21_pw2*k13*k22*k31*k14*k23*k15*k33_pw2*k36 - 4*k11*k12_pw2*k21*k22*k31_pw2*k23*k15*k33*k26*k36 + 2*k11*k12_pw2*k21*k31*k14*k23_pw2*k32*k33*k26*k36 + 4*k12*k21_pw2*k13*k22*k31_pw2*k14*k23*k33*k16*k36 + 2*k12*k21_pw2*k13*k31*k14*k23_pw2*k32*k15*k33*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k32*k15*k26*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k25*k36 - 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k26*k35 - 10*k11*k21_pw2*k13*k22*k31_pw2*k14*k15*k33*k26*k36 + 8*k11*k21_pw2*k13*k31*k14_pw2*k23*k32*k33*k26*k36 + 4*k11*k21_pw2*k22*k31_pw2*k14*k23*k15*k33*k16*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k32*k16*k26*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k25*k36 + 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k26*k35 + 8*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k25*k26*k36 + 6*k11*k12*k21_pw2*k22*k31_pw2*k14*k33*k16*k26*k36 - 10*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k25*k26*k36 + 8*k11_pw2*k21*k22*k31_pw2*k14*k23*k15*k33*k26*k36 - 4*k12_pw2*k21_pw2*k13*k31*k14*k23*k32*k33*k26*k36 + 8*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k26*k35*k36 - 10*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k26*k35*k36 - 2*k11*k12*k21*k13*k22*k31*k14*k23*k33_pw3*k26 - 8*k11*k12*k21*k13*k22*k31_pw3*k23*k33*k16*k26 + 8*k11*k12*k21*k13*k22*k31_pw3*k23*k15*k26*k36 - 2*k11*k12*k21*k31*k14*k23_pw3*k32*k15*k33*k36 + 8*k12*k21_pw3*k13*k31*k14*k32*k15*k33*k26*k36 - 8*k12*k21_pw3*k31*k14*k23*k32*k15*k33*k16*k36);
 
     // 1
-    coeffs.at(0) = k11_pw4*k31_pw4*k26_pw4+ k11_pw3*k12*k31_pw3*k23*k33*k26_pw3 - 4*k11_pw3*k21*k31_pw4*k16*k26_pw3 + 4*k11_pw3*k21*k31_pw3*k14*k26_pw3*k36 + 2*k11_pw3*k21*k31_pw3*k15*k33*k26_pw3 - 2*k11_pw3*k21*k31_pw2*k14*k33_pw2*k26_pw3 - 2*k11_pw3*k13*k31_pw4*k23*k26_pw3 + 2*k11_pw3*k31_pw4*k23_pw2*k16*k26_pw2- 2*k11_pw3*k31_pw3*k14*k23_pw2*k26_pw2*k36 - k11_pw3*k31_pw3*k23_pw2*k15*k33*k26_pw2+ k11_pw3*k31_pw2*k14*k23_pw2*k33_pw2*k26_pw2- 2*k11_pw2*k12_pw2*k21*k31_pw3*k26_pw3*k36 + k11_pw2*k12_pw2*k21*k31_pw2*k33_pw2*k26_pw3 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k26_pw2*k36 - 2*k11_pw2*k12*k21*k13*k31_pw3*k33*k26_pw3 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k26_pw2*k36 - k11_pw2*k12*k21*k31_pw3*k23*k33*k16*k26_pw2- 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k26_pw2*k36 - k11_pw2*k12*k21*k31_pw2*k23*k15*k33_pw2*k26_pw2+ k11_pw2*k12*k21*k31*k14*k23*k33_pw3*k26_pw2- k11_pw2*k12*k13*k31_pw3*k23_pw2*k33*k26_pw2- 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k26*k36 + k11_pw2*k12*k31_pw3*k23_pw3*k33*k16*k26 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k26*k36 + 6*k11_pw2*k21_pw2*k31_pw4*k16_pw2*k26_pw2- 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k26_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k26_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k15*k33*k16*k26_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k26_pw2*k36_pw2+ 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k26_pw2*k36 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k33_pw2*k16*k26_pw2+ k11_pw2*k21_pw2*k31_pw2*k15_pw2*k33_pw2*k26_pw2- 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k26_pw2*k36 - 2*k11_pw2*k21_pw2*k31*k14*k15*k33_pw3*k26_pw2+ k11_pw2*k21_pw2*k14_pw2*k33_pw4*k26_pw2+ 2*k11_pw2*k21*k13_pw2*k31_pw4*k26_pw3 + 2*k11_pw2*k21*k13*k31_pw4*k23*k16*k26_pw2- 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k26_pw2*k36 - k11_pw2*k21*k13*k31_pw3*k23*k15*k33*k26_pw2+ k11_pw2*k21*k13*k31_pw2*k14*k23*k33_pw2*k26_pw2- 4*k11_pw2*k21*k31_pw4*k23_pw2*k16_pw2*k26 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k26*k36 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k26*k36 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k15*k33*k16*k26 - 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k26*k36_pw2+ 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k26*k36 - 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k33_pw2*k16*k26 + k11_pw2*k13_pw2*k31_pw4*k23_pw2*k26_pw2- 2*k11_pw2*k13*k31_pw4*k23_pw3*k16*k26 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k26*k36 + k11_pw2*k13*k31_pw3*k23_pw3*k15*k33*k26 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k33_pw2*k26 + k11_pw2*k31_pw4*k23_pw4*k16_pw2 - 2*k11_pw2*k31_pw3*k14*k23_pw4*k16*k36 + k11_pw2*k31_pw3*k23_pw4*k15_pw2*k36 - k11_pw2*k31_pw3*k23_pw4*k15*k33*k16 + k11_pw2*k31_pw2*k14_pw2*k23_pw4*k36_pw2- k11_pw2*k31_pw2*k14*k23_pw4*k15*k33*k36 + k11_pw2*k31_pw2*k14*k23_pw4*k33_pw2*k16 + k11*k12_pw3*k21*k31_pw2*k23*k33*k26_pw2*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k26_pw2*k36 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k26_pw2*k36_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k26_pw2*k36 - 2*k11*k12_pw2*k21_pw2*k31_pw2*k33_pw2*k16*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k26_pw2*k36 - k11*k12_pw2*k21*k13*k31_pw2*k23*k33_pw2*k26_pw2- 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k26*k36 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k33_pw2*k16*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k26*k36 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k26_pw2*k36 + 4*k11*k12*k21_pw2*k13*k31_pw3*k33*k16*k26_pw2+ 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k26_pw2*k36 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k26*k36 - k11*k12*k21_pw2*k31_pw3*k23*k33*k16_pw2*k26 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k26*k36_pw2+ 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k26*k36 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k26*k36 + 2*k11*k12*k21_pw2*k31_pw2*k23*k15*k33_pw2*k16*k26 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k26*k36_pw2- 2*k11*k12*k21_pw2*k31*k14*k23*k33_pw3*k16*k26 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k26*k36 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k33*k26_pw2+ 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k26*k36 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k33*k16*k26 + k11*k12*k21*k13*k31_pw2*k23_pw2*k15*k33_pw2*k26 - k11*k12*k21*k13*k31*k14*k23_pw2*k33_pw3*k26 + k11*k12*k21*k31_pw3*k23_pw3*k33*k16_pw2 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k33*k16*k36 + k11*k12*k21*k31_pw2*k23_pw3*k15_pw2*k33*k36 - k11*k12*k21*k31_pw2*k23_pw3*k15*k33_pw2*k16 + k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k36_pw2- k11*k12*k21*k31*k14*k23_pw3*k15*k33_pw2*k36 + k11*k12*k21*k31*k14*k23_pw3*k33_pw3*k16 - 4*k11*k21_pw3*k31_pw4*k16_pw3*k26 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k26*k36 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k26*k36 + 6*k11*k21_pw3*k31_pw3*k15*k33*k16_pw2*k26 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k26*k36_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k26*k36_pw2- 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k26*k36 - 6*k11*k21_pw3*k31_pw2*k14*k33_pw2*k16_pw2*k26 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k26*k36 - 2*k11*k21_pw3*k31_pw2*k15_pw2*k33_pw2*k16*k26 + 4*k11*k21_pw3*k31*k14_pw3*k26*k36_pw3 - 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k26*k36_pw2+ 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k26*k36 - 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k26*k36 + 4*k11*k21_pw3*k31*k14*k15*k33_pw3*k16*k26 - 2*k11*k21_pw3*k14_pw3*k33_pw2*k26*k36_pw2+ 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k26*k36 - 2*k11*k21_pw3*k14_pw2*k33_pw4*k16*k26 - 4*k11*k21_pw2*k13_pw2*k31_pw4*k16*k26_pw2+ 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k26_pw2*k36 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k15*k33*k26_pw2- 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k33_pw2*k26_pw2+ 2*k11*k21_pw2*k13*k31_pw4*k23*k16_pw2*k26 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k26*k36 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k26*k36 - 2*k11*k21_pw2*k13*k31_pw3*k23*k15*k33*k16*k26 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k26*k36_pw2- 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k26*k36 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k33_pw2*k16*k26 - k11*k21_pw2*k13*k31_pw2*k23*k15_pw2*k33_pw2*k26 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k26*k36 + 2*k11*k21_pw2*k13*k31*k14*k23*k15*k33_pw3*k26 - k11*k21_pw2*k13*k14_pw2*k23*k33_pw4*k26 + 2*k11*k21_pw2*k31_pw4*k23_pw2*k16_pw3 - 6*k11*k21_pw2*k31_pw3*k14*k23_pw2*k16_pw2*k36 + 2*k11*k21_pw2*k31_pw3*k23_pw2*k15_pw2*k16*k36 - 3*k11*k21_pw2*k31_pw3*k23_pw2*k15*k33*k16_pw2 + 6*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k36_pw2- 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k36_pw2+ 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15*k33*k16*k36 + 3*k11*k21_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k16_pw2 - k11*k21_pw2*k31_pw2*k23_pw2*k15_pw3*k33*k36 + k11*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k33_pw2*k16 - 2*k11*k21_pw2*k31*k14_pw3*k23_pw2*k36_pw3 + k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k36_pw2- 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k33_pw2*k16*k36 + 2*k11*k21_pw2*k31*k14*k23_pw2*k15_pw2*k33_pw2*k36 - 2*k11*k21_pw2*k31*k14*k23_pw2*k15*k33_pw3*k16 + k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k36_pw2- k11*k21_pw2*k14_pw2*k23_pw2*k15*k33_pw3*k36 + k11*k21_pw2*k14_pw2*k23_pw2*k33_pw4*k16 - 2*k11*k21*k13_pw3*k31_pw4*k23*k26_pw2+ 4*k11*k21*k13_pw2*k31_pw4*k23_pw2*k16*k26 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k26*k36 - 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k15*k33*k26 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k26 - 2*k11*k21*k13*k31_pw4*k23_pw3*k16_pw2 + 4*k11*k21*k13*k31_pw3*k14*k23_pw3*k16*k36 - 2*k11*k21*k13*k31_pw3*k23_pw3*k15_pw2*k36 + 2*k11*k21*k13*k31_pw3*k23_pw3*k15*k33*k16 - 2*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k36_pw2+ 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k15*k33*k36 - 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k33_pw2*k16 + k12_pw4*k21_pw2*k31_pw2*k26_pw2*k36_pw2- 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k26_pw2*k36 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k26*k36_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k26*k36 + k12_pw3*k21_pw2*k31*k14*k23*k33*k26*k36_pw2- 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k26*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k26*k36_pw2+ 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k26*k36_pw2- 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k26*k36 + k12_pw2*k21_pw3*k31_pw2*k33_pw2*k16_pw2*k26 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k26*k36_pw3 - 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k26*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k26*k36_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k26_pw2*k36 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k33_pw2*k26_pw2- 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k26*k36 + 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k26*k36_pw2+ 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k26*k36 - k12_pw2*k21_pw2*k13*k31_pw2*k23*k33_pw2*k16*k26 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k26*k36 + k12_pw2*k21_pw2*k31_pw3*k23_pw2*k16_pw2*k36 - 2*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k36_pw2+ k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k36_pw2- k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15*k33*k16*k36 + k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k36_pw3 - k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k36_pw2+ k12_pw2*k21_pw2*k31*k14*k23_pw2*k33_pw2*k16*k36 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k26*k36 - 2*k12*k21_pw3*k13*k31_pw3*k33*k16_pw2*k26 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k26*k36_pw2- 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k26*k36 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k26*k36 + 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k26*k36_pw2+ 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k26*k36 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k26*k36 - 2*k12*k21_pw3*k31_pw3*k23*k15*k16_pw2*k36 + k12*k21_pw3*k31_pw3*k23*k33*k16_pw3 + 4*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k36_pw2- k12*k21_pw3*k31_pw2*k14*k23*k33*k16_pw2*k36 - 2*k12*k21_pw3*k31_pw2*k23*k15_pw3*k36_pw2+ 3*k12*k21_pw3*k31_pw2*k23*k15_pw2*k33*k16*k36 - k12*k21_pw3*k31_pw2*k23*k15*k33_pw2*k16_pw2 - 2*k12*k21_pw3*k31*k14_pw2*k23*k15*k36_pw3 - k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k36_pw2+ 3*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k36_pw2- 4*k12*k21_pw3*k31*k14*k23*k15*k33_pw2*k16*k36 + k12*k21_pw3*k31*k14*k23*k33_pw3*k16_pw2 + k12*k21_pw3*k14_pw3*k23*k33*k36_pw3 - k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k36_pw2+ k12*k21_pw3*k14_pw2*k23*k33_pw3*k16*k36 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k33*k26_pw2- 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k26*k36 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k33*k16*k26 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k26*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k15*k33_pw2*k26 + k12*k21_pw2*k13_pw2*k31*k14*k23*k33_pw3*k26 - k12*k21_pw2*k13*k31_pw3*k23_pw2*k33*k16_pw2 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k33*k16*k36 - k12*k21_pw2*k13*k31_pw2*k23_pw2*k15_pw2*k33*k36 + k12*k21_pw2*k13*k31_pw2*k23_pw2*k15*k33_pw2*k16 - k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k36_pw2+ k12*k21_pw2*k13*k31*k14*k23_pw2*k15*k33_pw2*k36 - k12*k21_pw2*k13*k31*k14*k23_pw2*k33_pw3*k16 + k21_pw4*k31_pw4*k16_pw4 - 4*k21_pw4*k31_pw3*k14*k16_pw3*k36 + 2*k21_pw4*k31_pw3*k15_pw2*k16_pw2*k36 - 2*k21_pw4*k31_pw3*k15*k33*k16_pw3 + 6*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k36_pw2- 4*k21_pw4*k31_pw2*k14*k15_pw2*k16*k36_pw2+ 2*k21_pw4*k31_pw2*k14*k15*k33*k16_pw2*k36 + 2*k21_pw4*k31_pw2*k14*k33_pw2*k16_pw3 + k21_pw4*k31_pw2*k15_pw4*k36_pw2- 2*k21_pw4*k31_pw2*k15_pw3*k33*k16*k36 + k21_pw4*k31_pw2*k15_pw2*k33_pw2*k16_pw2 - 4*k21_pw4*k31*k14_pw3*k16*k36_pw3 + 2*k21_pw4*k31*k14_pw2*k15_pw2*k36_pw3 + 2*k21_pw4*k31*k14_pw2*k15*k33*k16*k36_pw2- 4*k21_pw4*k31*k14_pw2*k33_pw2*k16_pw2*k36 - 2*k21_pw4*k31*k14*k15_pw3*k33*k36_pw2+ 4*k21_pw4*k31*k14*k15_pw2*k33_pw2*k16*k36 - 2*k21_pw4*k31*k14*k15*k33_pw3*k16_pw2 + k21_pw4*k14_pw4*k36_pw4- 2*k21_pw4*k14_pw3*k15*k33*k36_pw3 + 2*k21_pw4*k14_pw3*k33_pw2*k16*k36_pw2+ k21_pw4*k14_pw2*k15_pw2*k33_pw2*k36_pw2- 2*k21_pw4*k14_pw2*k15*k33_pw3*k16*k36 + k21_pw4*k14_pw2*k33_pw4*k16_pw2 + 2*k21_pw3*k13_pw2*k31_pw4*k16_pw2*k26 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k26*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k26*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15*k33*k16*k26 + 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k26*k36_pw2+ 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k26*k36 + 2*k21_pw3*k13_pw2*k31_pw2*k14*k33_pw2*k16*k26 + k21_pw3*k13_pw2*k31_pw2*k15_pw2*k33_pw2*k26 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k26*k36 - 2*k21_pw3*k13_pw2*k31*k14*k15*k33_pw3*k26 + k21_pw3*k13_pw2*k14_pw2*k33_pw4*k26 - 2*k21_pw3*k13*k31_pw4*k23*k16_pw3 + 6*k21_pw3*k13*k31_pw3*k14*k23*k16_pw2*k36 - 2*k21_pw3*k13*k31_pw3*k23*k15_pw2*k16*k36 + 3*k21_pw3*k13*k31_pw3*k23*k15*k33*k16_pw2 - 6*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k36_pw2+ 2*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k36_pw2- 2*k21_pw3*k13*k31_pw2*k14*k23*k15*k33*k16*k36 - 3*k21_pw3*k13*k31_pw2*k14*k23*k33_pw2*k16_pw2 + k21_pw3*k13*k31_pw2*k23*k15_pw3*k33*k36 - k21_pw3*k13*k31_pw2*k23*k15_pw2*k33_pw2*k16 + 2*k21_pw3*k13*k31*k14_pw3*k23*k36_pw3 - k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k36_pw2+ 4*k21_pw3*k13*k31*k14_pw2*k23*k33_pw2*k16*k36 - 2*k21_pw3*k13*k31*k14*k23*k15_pw2*k33_pw2*k36 + 2*k21_pw3*k13*k31*k14*k23*k15*k33_pw3*k16 - k21_pw3*k13*k14_pw3*k23*k33_pw2*k36_pw2+ k21_pw3*k13*k14_pw2*k23*k15*k33_pw3*k36 - k21_pw3*k13*k14_pw2*k23*k33_pw4*k16 + k21_pw2*k13_pw4*k31_pw4*k26_pw2- 2*k21_pw2*k13_pw3*k31_pw4*k23*k16*k26 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k26*k36 + k21_pw2*k13_pw3*k31_pw3*k23*k15*k33*k26 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k33_pw2*k26 + k21_pw2*k13_pw2*k31_pw4*k23_pw2*k16_pw2 - 2*k21_pw2*k13_pw2*k31_pw3*k14*k23_pw2*k16*k36 + k21_pw2*k13_pw2*k31_pw3*k23_pw2*k15_pw2*k36 - k21_pw2*k13_pw2*k31_pw3*k23_pw2*k15*k33*k16 + k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k36_pw2- k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k15*k33*k36 + k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k16;
+    coeffs[0] = k11_pw4*k31_pw4*k26_pw4+ k11_pw3*k12*k31_pw3*k23*k33*k26_pw3 - 4*k11_pw3*k21*k31_pw4*k16*k26_pw3 + 4*k11_pw3*k21*k31_pw3*k14*k26_pw3*k36 + 2*k11_pw3*k21*k31_pw3*k15*k33*k26_pw3 - 2*k11_pw3*k21*k31_pw2*k14*k33_pw2*k26_pw3 - 2*k11_pw3*k13*k31_pw4*k23*k26_pw3 + 2*k11_pw3*k31_pw4*k23_pw2*k16*k26_pw2- 2*k11_pw3*k31_pw3*k14*k23_pw2*k26_pw2*k36 - k11_pw3*k31_pw3*k23_pw2*k15*k33*k26_pw2+ k11_pw3*k31_pw2*k14*k23_pw2*k33_pw2*k26_pw2- 2*k11_pw2*k12_pw2*k21*k31_pw3*k26_pw3*k36 + k11_pw2*k12_pw2*k21*k31_pw2*k33_pw2*k26_pw3 + k11_pw2*k12_pw2*k31_pw3*k23_pw2*k26_pw2*k36 - 2*k11_pw2*k12*k21*k13*k31_pw3*k33*k26_pw3 + 6*k11_pw2*k12*k21*k31_pw3*k23*k15*k26_pw2*k36 - k11_pw2*k12*k21*k31_pw3*k23*k33*k16*k26_pw2- 5*k11_pw2*k12*k21*k31_pw2*k14*k23*k33*k26_pw2*k36 - k11_pw2*k12*k21*k31_pw2*k23*k15*k33_pw2*k26_pw2+ k11_pw2*k12*k21*k31*k14*k23*k33_pw3*k26_pw2- k11_pw2*k12*k13*k31_pw3*k23_pw2*k33*k26_pw2- 2*k11_pw2*k12*k31_pw3*k23_pw3*k15*k26*k36 + k11_pw2*k12*k31_pw3*k23_pw3*k33*k16*k26 + k11_pw2*k12*k31_pw2*k14*k23_pw3*k33*k26*k36 + 6*k11_pw2*k21_pw2*k31_pw4*k16_pw2*k26_pw2- 12*k11_pw2*k21_pw2*k31_pw3*k14*k16*k26_pw2*k36 + 2*k11_pw2*k21_pw2*k31_pw3*k15_pw2*k26_pw2*k36 - 6*k11_pw2*k21_pw2*k31_pw3*k15*k33*k16*k26_pw2+ 6*k11_pw2*k21_pw2*k31_pw2*k14_pw2*k26_pw2*k36_pw2+ 2*k11_pw2*k21_pw2*k31_pw2*k14*k15*k33*k26_pw2*k36 + 6*k11_pw2*k21_pw2*k31_pw2*k14*k33_pw2*k16*k26_pw2+ k11_pw2*k21_pw2*k31_pw2*k15_pw2*k33_pw2*k26_pw2- 4*k11_pw2*k21_pw2*k31*k14_pw2*k33_pw2*k26_pw2*k36 - 2*k11_pw2*k21_pw2*k31*k14*k15*k33_pw3*k26_pw2+ k11_pw2*k21_pw2*k14_pw2*k33_pw4*k26_pw2+ 2*k11_pw2*k21*k13_pw2*k31_pw4*k26_pw3 + 2*k11_pw2*k21*k13*k31_pw4*k23*k16*k26_pw2- 2*k11_pw2*k21*k13*k31_pw3*k14*k23*k26_pw2*k36 - k11_pw2*k21*k13*k31_pw3*k23*k15*k33*k26_pw2+ k11_pw2*k21*k13*k31_pw2*k14*k23*k33_pw2*k26_pw2- 4*k11_pw2*k21*k31_pw4*k23_pw2*k16_pw2*k26 + 8*k11_pw2*k21*k31_pw3*k14*k23_pw2*k16*k26*k36 - 4*k11_pw2*k21*k31_pw3*k23_pw2*k15_pw2*k26*k36 + 4*k11_pw2*k21*k31_pw3*k23_pw2*k15*k33*k16*k26 - 4*k11_pw2*k21*k31_pw2*k14_pw2*k23_pw2*k26*k36_pw2+ 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k15*k33*k26*k36 - 4*k11_pw2*k21*k31_pw2*k14*k23_pw2*k33_pw2*k16*k26 + k11_pw2*k13_pw2*k31_pw4*k23_pw2*k26_pw2- 2*k11_pw2*k13*k31_pw4*k23_pw3*k16*k26 + 2*k11_pw2*k13*k31_pw3*k14*k23_pw3*k26*k36 + k11_pw2*k13*k31_pw3*k23_pw3*k15*k33*k26 - k11_pw2*k13*k31_pw2*k14*k23_pw3*k33_pw2*k26 + k11_pw2*k31_pw4*k23_pw4*k16_pw2 - 2*k11_pw2*k31_pw3*k14*k23_pw4*k16*k36 + k11_pw2*k31_pw3*k23_pw4*k15_pw2*k36 - k11_pw2*k31_pw3*k23_pw4*k15*k33*k16 + k11_pw2*k31_pw2*k14_pw2*k23_pw4*k36_pw2- k11_pw2*k31_pw2*k14*k23_pw4*k15*k33*k36 + k11_pw2*k31_pw2*k14*k23_pw4*k33_pw2*k16 + k11*k12_pw3*k21*k31_pw2*k23*k33*k26_pw2*k36 + 4*k11*k12_pw2*k21_pw2*k31_pw3*k16*k26_pw2*k36 - 4*k11*k12_pw2*k21_pw2*k31_pw2*k14*k26_pw2*k36_pw2+ 2*k11*k12_pw2*k21_pw2*k31_pw2*k15*k33*k26_pw2*k36 - 2*k11*k12_pw2*k21_pw2*k31_pw2*k33_pw2*k16*k26_pw2- 2*k11*k12_pw2*k21*k13*k31_pw3*k23*k26_pw2*k36 - k11*k12_pw2*k21*k13*k31_pw2*k23*k33_pw2*k26_pw2- 2*k11*k12_pw2*k21*k31_pw2*k23_pw2*k15*k33*k26*k36 + k11*k12_pw2*k21*k31_pw2*k23_pw2*k33_pw2*k16*k26 + k11*k12_pw2*k21*k31*k14*k23_pw2*k33_pw2*k26*k36 - 8*k11*k12*k21_pw2*k13*k31_pw3*k15*k26_pw2*k36 + 4*k11*k12*k21_pw2*k13*k31_pw3*k33*k16*k26_pw2+ 4*k11*k12*k21_pw2*k13*k31_pw2*k14*k33*k26_pw2*k36 - 4*k11*k12*k21_pw2*k31_pw3*k23*k15*k16*k26*k36 - k11*k12*k21_pw2*k31_pw3*k23*k33*k16_pw2*k26 + 4*k11*k12*k21_pw2*k31_pw2*k14*k23*k15*k26*k36_pw2+ 6*k11*k12*k21_pw2*k31_pw2*k14*k23*k33*k16*k26*k36 - k11*k12*k21_pw2*k31_pw2*k23*k15_pw2*k33*k26*k36 + 2*k11*k12*k21_pw2*k31_pw2*k23*k15*k33_pw2*k16*k26 - 5*k11*k12*k21_pw2*k31*k14_pw2*k23*k33*k26*k36_pw2- 2*k11*k12*k21_pw2*k31*k14*k23*k33_pw3*k16*k26 + k11*k12*k21_pw2*k14_pw2*k23*k33_pw3*k26*k36 + 3*k11*k12*k21*k13_pw2*k31_pw3*k23*k33*k26_pw2+ 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k15*k26*k36 - 4*k11*k12*k21*k13*k31_pw3*k23_pw2*k33*k16*k26 + k11*k12*k21*k13*k31_pw2*k23_pw2*k15*k33_pw2*k26 - k11*k12*k21*k13*k31*k14*k23_pw2*k33_pw3*k26 + k11*k12*k21*k31_pw3*k23_pw3*k33*k16_pw2 - 2*k11*k12*k21*k31_pw2*k14*k23_pw3*k33*k16*k36 + k11*k12*k21*k31_pw2*k23_pw3*k15_pw2*k33*k36 - k11*k12*k21*k31_pw2*k23_pw3*k15*k33_pw2*k16 + k11*k12*k21*k31*k14_pw2*k23_pw3*k33*k36_pw2- k11*k12*k21*k31*k14*k23_pw3*k15*k33_pw2*k36 + k11*k12*k21*k31*k14*k23_pw3*k33_pw3*k16 - 4*k11*k21_pw3*k31_pw4*k16_pw3*k26 + 12*k11*k21_pw3*k31_pw3*k14*k16_pw2*k26*k36 - 4*k11*k21_pw3*k31_pw3*k15_pw2*k16*k26*k36 + 6*k11*k21_pw3*k31_pw3*k15*k33*k16_pw2*k26 - 12*k11*k21_pw3*k31_pw2*k14_pw2*k16*k26*k36_pw2+ 4*k11*k21_pw3*k31_pw2*k14*k15_pw2*k26*k36_pw2- 4*k11*k21_pw3*k31_pw2*k14*k15*k33*k16*k26*k36 - 6*k11*k21_pw3*k31_pw2*k14*k33_pw2*k16_pw2*k26 + 2*k11*k21_pw3*k31_pw2*k15_pw3*k33*k26*k36 - 2*k11*k21_pw3*k31_pw2*k15_pw2*k33_pw2*k16*k26 + 4*k11*k21_pw3*k31*k14_pw3*k26*k36_pw3 - 2*k11*k21_pw3*k31*k14_pw2*k15*k33*k26*k36_pw2+ 8*k11*k21_pw3*k31*k14_pw2*k33_pw2*k16*k26*k36 - 4*k11*k21_pw3*k31*k14*k15_pw2*k33_pw2*k26*k36 + 4*k11*k21_pw3*k31*k14*k15*k33_pw3*k16*k26 - 2*k11*k21_pw3*k14_pw3*k33_pw2*k26*k36_pw2+ 2*k11*k21_pw3*k14_pw2*k15*k33_pw3*k26*k36 - 2*k11*k21_pw3*k14_pw2*k33_pw4*k16*k26 - 4*k11*k21_pw2*k13_pw2*k31_pw4*k16*k26_pw2+ 4*k11*k21_pw2*k13_pw2*k31_pw3*k14*k26_pw2*k36 + 2*k11*k21_pw2*k13_pw2*k31_pw3*k15*k33*k26_pw2- 2*k11*k21_pw2*k13_pw2*k31_pw2*k14*k33_pw2*k26_pw2+ 2*k11*k21_pw2*k13*k31_pw4*k23*k16_pw2*k26 - 4*k11*k21_pw2*k13*k31_pw3*k14*k23*k16*k26*k36 + 6*k11*k21_pw2*k13*k31_pw3*k23*k15_pw2*k26*k36 - 2*k11*k21_pw2*k13*k31_pw3*k23*k15*k33*k16*k26 + 2*k11*k21_pw2*k13*k31_pw2*k14_pw2*k23*k26*k36_pw2- 10*k11*k21_pw2*k13*k31_pw2*k14*k23*k15*k33*k26*k36 + 2*k11*k21_pw2*k13*k31_pw2*k14*k23*k33_pw2*k16*k26 - k11*k21_pw2*k13*k31_pw2*k23*k15_pw2*k33_pw2*k26 + 4*k11*k21_pw2*k13*k31*k14_pw2*k23*k33_pw2*k26*k36 + 2*k11*k21_pw2*k13*k31*k14*k23*k15*k33_pw3*k26 - k11*k21_pw2*k13*k14_pw2*k23*k33_pw4*k26 + 2*k11*k21_pw2*k31_pw4*k23_pw2*k16_pw3 - 6*k11*k21_pw2*k31_pw3*k14*k23_pw2*k16_pw2*k36 + 2*k11*k21_pw2*k31_pw3*k23_pw2*k15_pw2*k16*k36 - 3*k11*k21_pw2*k31_pw3*k23_pw2*k15*k33*k16_pw2 + 6*k11*k21_pw2*k31_pw2*k14_pw2*k23_pw2*k16*k36_pw2- 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15_pw2*k36_pw2+ 2*k11*k21_pw2*k31_pw2*k14*k23_pw2*k15*k33*k16*k36 + 3*k11*k21_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k16_pw2 - k11*k21_pw2*k31_pw2*k23_pw2*k15_pw3*k33*k36 + k11*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k33_pw2*k16 - 2*k11*k21_pw2*k31*k14_pw3*k23_pw2*k36_pw3 + k11*k21_pw2*k31*k14_pw2*k23_pw2*k15*k33*k36_pw2- 4*k11*k21_pw2*k31*k14_pw2*k23_pw2*k33_pw2*k16*k36 + 2*k11*k21_pw2*k31*k14*k23_pw2*k15_pw2*k33_pw2*k36 - 2*k11*k21_pw2*k31*k14*k23_pw2*k15*k33_pw3*k16 + k11*k21_pw2*k14_pw3*k23_pw2*k33_pw2*k36_pw2- k11*k21_pw2*k14_pw2*k23_pw2*k15*k33_pw3*k36 + k11*k21_pw2*k14_pw2*k23_pw2*k33_pw4*k16 - 2*k11*k21*k13_pw3*k31_pw4*k23*k26_pw2+ 4*k11*k21*k13_pw2*k31_pw4*k23_pw2*k16*k26 - 4*k11*k21*k13_pw2*k31_pw3*k14*k23_pw2*k26*k36 - 2*k11*k21*k13_pw2*k31_pw3*k23_pw2*k15*k33*k26 + 2*k11*k21*k13_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k26 - 2*k11*k21*k13*k31_pw4*k23_pw3*k16_pw2 + 4*k11*k21*k13*k31_pw3*k14*k23_pw3*k16*k36 - 2*k11*k21*k13*k31_pw3*k23_pw3*k15_pw2*k36 + 2*k11*k21*k13*k31_pw3*k23_pw3*k15*k33*k16 - 2*k11*k21*k13*k31_pw2*k14_pw2*k23_pw3*k36_pw2+ 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k15*k33*k36 - 2*k11*k21*k13*k31_pw2*k14*k23_pw3*k33_pw2*k16 + k12_pw4*k21_pw2*k31_pw2*k26_pw2*k36_pw2- 2*k12_pw3*k21_pw2*k13*k31_pw2*k33*k26_pw2*k36 - 2*k12_pw3*k21_pw2*k31_pw2*k23*k15*k26*k36_pw2+ k12_pw3*k21_pw2*k31_pw2*k23*k33*k16*k26*k36 + k12_pw3*k21_pw2*k31*k14*k23*k33*k26*k36_pw2- 2*k12_pw2*k21_pw3*k31_pw3*k16_pw2*k26*k36 + 4*k12_pw2*k21_pw3*k31_pw2*k14*k16*k26*k36_pw2+ 2*k12_pw2*k21_pw3*k31_pw2*k15_pw2*k26*k36_pw2- 2*k12_pw2*k21_pw3*k31_pw2*k15*k33*k16*k26*k36 + k12_pw2*k21_pw3*k31_pw2*k33_pw2*k16_pw2*k26 - 2*k12_pw2*k21_pw3*k31*k14_pw2*k26*k36_pw3 - 2*k12_pw2*k21_pw3*k31*k14*k15*k33*k26*k36_pw2+ k12_pw2*k21_pw3*k14_pw2*k33_pw2*k26*k36_pw2+ 2*k12_pw2*k21_pw2*k13_pw2*k31_pw3*k26_pw2*k36 + k12_pw2*k21_pw2*k13_pw2*k31_pw2*k33_pw2*k26_pw2- 2*k12_pw2*k21_pw2*k13*k31_pw3*k23*k16*k26*k36 + 2*k12_pw2*k21_pw2*k13*k31_pw2*k14*k23*k26*k36_pw2+ 3*k12_pw2*k21_pw2*k13*k31_pw2*k23*k15*k33*k26*k36 - k12_pw2*k21_pw2*k13*k31_pw2*k23*k33_pw2*k16*k26 - 2*k12_pw2*k21_pw2*k13*k31*k14*k23*k33_pw2*k26*k36 + k12_pw2*k21_pw2*k31_pw3*k23_pw2*k16_pw2*k36 - 2*k12_pw2*k21_pw2*k31_pw2*k14*k23_pw2*k16*k36_pw2+ k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15_pw2*k36_pw2- k12_pw2*k21_pw2*k31_pw2*k23_pw2*k15*k33*k16*k36 + k12_pw2*k21_pw2*k31*k14_pw2*k23_pw2*k36_pw3 - k12_pw2*k21_pw2*k31*k14*k23_pw2*k15*k33*k36_pw2+ k12_pw2*k21_pw2*k31*k14*k23_pw2*k33_pw2*k16*k36 + 8*k12*k21_pw3*k13*k31_pw3*k15*k16*k26*k36 - 2*k12*k21_pw3*k13*k31_pw3*k33*k16_pw2*k26 - 8*k12*k21_pw3*k13*k31_pw2*k14*k15*k26*k36_pw2- 4*k12*k21_pw3*k13*k31_pw2*k14*k33*k16*k26*k36 - 2*k12*k21_pw3*k13*k31_pw2*k15_pw2*k33*k26*k36 + 6*k12*k21_pw3*k13*k31*k14_pw2*k33*k26*k36_pw2+ 4*k12*k21_pw3*k13*k31*k14*k15*k33_pw2*k26*k36 - 2*k12*k21_pw3*k13*k14_pw2*k33_pw3*k26*k36 - 2*k12*k21_pw3*k31_pw3*k23*k15*k16_pw2*k36 + k12*k21_pw3*k31_pw3*k23*k33*k16_pw3 + 4*k12*k21_pw3*k31_pw2*k14*k23*k15*k16*k36_pw2- k12*k21_pw3*k31_pw2*k14*k23*k33*k16_pw2*k36 - 2*k12*k21_pw3*k31_pw2*k23*k15_pw3*k36_pw2+ 3*k12*k21_pw3*k31_pw2*k23*k15_pw2*k33*k16*k36 - k12*k21_pw3*k31_pw2*k23*k15*k33_pw2*k16_pw2 - 2*k12*k21_pw3*k31*k14_pw2*k23*k15*k36_pw3 - k12*k21_pw3*k31*k14_pw2*k23*k33*k16*k36_pw2+ 3*k12*k21_pw3*k31*k14*k23*k15_pw2*k33*k36_pw2- 4*k12*k21_pw3*k31*k14*k23*k15*k33_pw2*k16*k36 + k12*k21_pw3*k31*k14*k23*k33_pw3*k16_pw2 + k12*k21_pw3*k14_pw3*k23*k33*k36_pw3 - k12*k21_pw3*k14_pw2*k23*k15*k33_pw2*k36_pw2+ k12*k21_pw3*k14_pw2*k23*k33_pw3*k16*k36 - 2*k12*k21_pw2*k13_pw3*k31_pw3*k33*k26_pw2- 2*k12*k21_pw2*k13_pw2*k31_pw3*k23*k15*k26*k36 + 3*k12*k21_pw2*k13_pw2*k31_pw3*k23*k33*k16*k26 - k12*k21_pw2*k13_pw2*k31_pw2*k14*k23*k33*k26*k36 - k12*k21_pw2*k13_pw2*k31_pw2*k23*k15*k33_pw2*k26 + k12*k21_pw2*k13_pw2*k31*k14*k23*k33_pw3*k26 - k12*k21_pw2*k13*k31_pw3*k23_pw2*k33*k16_pw2 + 2*k12*k21_pw2*k13*k31_pw2*k14*k23_pw2*k33*k16*k36 - k12*k21_pw2*k13*k31_pw2*k23_pw2*k15_pw2*k33*k36 + k12*k21_pw2*k13*k31_pw2*k23_pw2*k15*k33_pw2*k16 - k12*k21_pw2*k13*k31*k14_pw2*k23_pw2*k33*k36_pw2+ k12*k21_pw2*k13*k31*k14*k23_pw2*k15*k33_pw2*k36 - k12*k21_pw2*k13*k31*k14*k23_pw2*k33_pw3*k16 + k21_pw4*k31_pw4*k16_pw4 - 4*k21_pw4*k31_pw3*k14*k16_pw3*k36 + 2*k21_pw4*k31_pw3*k15_pw2*k16_pw2*k36 - 2*k21_pw4*k31_pw3*k15*k33*k16_pw3 + 6*k21_pw4*k31_pw2*k14_pw2*k16_pw2*k36_pw2- 4*k21_pw4*k31_pw2*k14*k15_pw2*k16*k36_pw2+ 2*k21_pw4*k31_pw2*k14*k15*k33*k16_pw2*k36 + 2*k21_pw4*k31_pw2*k14*k33_pw2*k16_pw3 + k21_pw4*k31_pw2*k15_pw4*k36_pw2- 2*k21_pw4*k31_pw2*k15_pw3*k33*k16*k36 + k21_pw4*k31_pw2*k15_pw2*k33_pw2*k16_pw2 - 4*k21_pw4*k31*k14_pw3*k16*k36_pw3 + 2*k21_pw4*k31*k14_pw2*k15_pw2*k36_pw3 + 2*k21_pw4*k31*k14_pw2*k15*k33*k16*k36_pw2- 4*k21_pw4*k31*k14_pw2*k33_pw2*k16_pw2*k36 - 2*k21_pw4*k31*k14*k15_pw3*k33*k36_pw2+ 4*k21_pw4*k31*k14*k15_pw2*k33_pw2*k16*k36 - 2*k21_pw4*k31*k14*k15*k33_pw3*k16_pw2 + k21_pw4*k14_pw4*k36_pw4- 2*k21_pw4*k14_pw3*k15*k33*k36_pw3 + 2*k21_pw4*k14_pw3*k33_pw2*k16*k36_pw2+ k21_pw4*k14_pw2*k15_pw2*k33_pw2*k36_pw2- 2*k21_pw4*k14_pw2*k15*k33_pw3*k16*k36 + k21_pw4*k14_pw2*k33_pw4*k16_pw2 + 2*k21_pw3*k13_pw2*k31_pw4*k16_pw2*k26 - 4*k21_pw3*k13_pw2*k31_pw3*k14*k16*k26*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15_pw2*k26*k36 - 2*k21_pw3*k13_pw2*k31_pw3*k15*k33*k16*k26 + 2*k21_pw3*k13_pw2*k31_pw2*k14_pw2*k26*k36_pw2+ 6*k21_pw3*k13_pw2*k31_pw2*k14*k15*k33*k26*k36 + 2*k21_pw3*k13_pw2*k31_pw2*k14*k33_pw2*k16*k26 + k21_pw3*k13_pw2*k31_pw2*k15_pw2*k33_pw2*k26 - 4*k21_pw3*k13_pw2*k31*k14_pw2*k33_pw2*k26*k36 - 2*k21_pw3*k13_pw2*k31*k14*k15*k33_pw3*k26 + k21_pw3*k13_pw2*k14_pw2*k33_pw4*k26 - 2*k21_pw3*k13*k31_pw4*k23*k16_pw3 + 6*k21_pw3*k13*k31_pw3*k14*k23*k16_pw2*k36 - 2*k21_pw3*k13*k31_pw3*k23*k15_pw2*k16*k36 + 3*k21_pw3*k13*k31_pw3*k23*k15*k33*k16_pw2 - 6*k21_pw3*k13*k31_pw2*k14_pw2*k23*k16*k36_pw2+ 2*k21_pw3*k13*k31_pw2*k14*k23*k15_pw2*k36_pw2- 2*k21_pw3*k13*k31_pw2*k14*k23*k15*k33*k16*k36 - 3*k21_pw3*k13*k31_pw2*k14*k23*k33_pw2*k16_pw2 + k21_pw3*k13*k31_pw2*k23*k15_pw3*k33*k36 - k21_pw3*k13*k31_pw2*k23*k15_pw2*k33_pw2*k16 + 2*k21_pw3*k13*k31*k14_pw3*k23*k36_pw3 - k21_pw3*k13*k31*k14_pw2*k23*k15*k33*k36_pw2+ 4*k21_pw3*k13*k31*k14_pw2*k23*k33_pw2*k16*k36 - 2*k21_pw3*k13*k31*k14*k23*k15_pw2*k33_pw2*k36 + 2*k21_pw3*k13*k31*k14*k23*k15*k33_pw3*k16 - k21_pw3*k13*k14_pw3*k23*k33_pw2*k36_pw2+ k21_pw3*k13*k14_pw2*k23*k15*k33_pw3*k36 - k21_pw3*k13*k14_pw2*k23*k33_pw4*k16 + k21_pw2*k13_pw4*k31_pw4*k26_pw2- 2*k21_pw2*k13_pw3*k31_pw4*k23*k16*k26 + 2*k21_pw2*k13_pw3*k31_pw3*k14*k23*k26*k36 + k21_pw2*k13_pw3*k31_pw3*k23*k15*k33*k26 - k21_pw2*k13_pw3*k31_pw2*k14*k23*k33_pw2*k26 + k21_pw2*k13_pw2*k31_pw4*k23_pw2*k16_pw2 - 2*k21_pw2*k13_pw2*k31_pw3*k14*k23_pw2*k16*k36 + k21_pw2*k13_pw2*k31_pw3*k23_pw2*k15_pw2*k36 - k21_pw2*k13_pw2*k31_pw3*k23_pw2*k15*k33*k16 + k21_pw2*k13_pw2*k31_pw2*k14_pw2*k23_pw2*k36_pw2- k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k15*k33*k36 + k21_pw2*k13_pw2*k31_pw2*k14*k23_pw2*k33_pw2*k16;
 
     // Find roots -> lambda3
 
-    std::vector<double> lambda3;
-    solveRoots<8>(coeffs, lambda3);
+    double lambda3[8];
+    int nLambda3;
+    solveRoots<8>(coeffs, lambda3, nLambda3);
 
     // depths from minimal solution
-    std::vector<std::vector<double> > lambda;
+    double lambda[k_maxgP3PSolutions][3];
+    int nLambda = 0;
 
     // check every solution of lambda3
-    for (size_t i = 0; i < lambda3.size(); ++i)
+    for (int i = 0; i < nLambda3; ++i)
     {
         // solve for lambda2
-        std::vector<double> lambda2;
-        solveOtherRoots(k[2], lambda3.at(i), lambda2);
+        double lambda2[2];
+        int nLambda2;
+        solveOtherRoots(k[2], lambda3[i], lambda2, nLambda2);
 
         // disambiguate solutions
-        for (size_t j = 0; j < lambda2.size(); ++j)
+        for (int j = 0; j < nLambda2; ++j)
         {
             // solve for two possible lambda1
-            std::vector<double> lambda13;
-            std::vector<double> lambda12;
+            double lambda13[2], lambda12[2];
+            int nLambda13, nLambda12;
 
-            solveOtherRoots(k[1], lambda3.at(i), lambda13);
-            solveOtherRoots(k[0], lambda2.at(j), lambda12);
+            solveOtherRoots(k[1], lambda3[i], lambda13, nLambda13);
+            solveOtherRoots(k[0], lambda2[j], lambda12, nLambda12);
 
-            for (size_t k = 0; k < lambda13.size(); ++k)
+            for (int k = 0; k < nLambda13; ++k)
             {
-                for (size_t l = 0; l < lambda12.size(); ++l)
+                for (int l = 0; l < nLambda12; ++l)
                 {
-                    if (fabs(lambda13.at(k) - lambda12.at(l)) < 1e-5)
+                    if (fabs(lambda13[k] - lambda12[l]) < 1e-5 &&
+                        nLambda < k_maxgP3PSolutions)
                     {
-                        std::vector<double> d;
-                        d.push_back(lambda12.at(l));
-                        d.push_back(lambda2.at(j));
-                        d.push_back(lambda3.at(i));
-                        lambda.push_back(d);
+                        lambda[nLambda][0] = lambda12[l];
+                        lambda[nLambda][1] = lambda2[j];
+                        lambda[nLambda][2] = lambda3[i];
+                        ++nLambda;
                     }
                 }
             }
         }
     }
 
-    if (lambda.empty())
+    if (nLambda == 0)
     {
         return false;
     }
 
-    solutions.reserve(lambda.size());
-    for (size_t i = 0; i < lambda.size(); ++i)
+    for (int i = 0; i < nLambda; ++i)
     {
         // compute coordinates of world points in camera frame
         Eigen::Vector3d P_cam[3];
         for (size_t j = 0; j < 3; ++j)
         {
-            P_cam[j] = skew(l[j].directionVector()) * l[j].momentVector() + lambda.at(i).at(j) * l[j].directionVector();
+            P_cam[j] = skew(l[j].directionVector()) * l[j].momentVector() + lambda[i][j] * l[j].directionVector();
         }
 
         // absolute orientation
@@ -403,10 +407,33 @@ bool solvegP3P(const std::vector<PLine, Eigen::aligned_allocator<PLine> >& pline
 //        solution.block<3,3>(0,0) = R;
 //        solution.block<3,1>(0,3) = t;
 
-        solutions.push_back(solution);
+        solutions[nSolutions++] = solution;
     }
 
     return true;
 }
 
+bool solvegP3P(const std::vector<PLine, Eigen::aligned_allocator<PLine> >& plineVectors,
+               const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& worldPoints,
+               std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> >& solutions)
+{
+    solutions.clear();
+
+    if (plineVectors.size() < 3 || worldPoints.size() < 3)
+    {
+        return false;
+    }
+
+    Eigen::Matrix4d H[k_maxgP3PSolutions];
+    int nSolutions;
+    if (!solvegP3P(&plineVectors[0], &worldPoints[0], H, nSolutions))
+    {
+        return false;
+    }
+
+    solutions.assign(H, H + nSolutions);
+
+    return true;
+}
+
 }
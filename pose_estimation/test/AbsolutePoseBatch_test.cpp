@@ -0,0 +1,200 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <limits>
+
+#include "cauldron/Random.h"
+#include "pose_estimation/AbsolutePoseBatch.h"
+#include "pose_estimation/P3P.h"
+
+namespace px
+{
+
+Eigen::Matrix4d
+randomPose(Xoshiro256& rng)
+{
+    Eigen::Vector3d axis(rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0));
+
+    Eigen::Matrix4d H = Eigen::Matrix4d::Identity();
+    H.block<3,3>(0,0) = Eigen::AngleAxisd(rng.uniform(-M_PI, M_PI), axis.normalized()).toRotationMatrix();
+    H.block<3,1>(0,3) << rng.uniform(-10.0, 10.0), rng.uniform(-10.0, 10.0), rng.uniform(-10.0, 10.0);
+
+    return H;
+}
+
+// Fills the batch with points seen by the given cameras, or by a single
+// camera at the system origin if central is set, and replaces a fraction
+// of the rays by outliers. H_world_sys maps the system frame to the world
+// frame. Returns the number of inliers.
+size_t
+generateScene(Xoshiro256& rng, const Eigen::Matrix4d& H_world_sys,
+              const std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> >& H_sys_cam,
+              size_t nPoints, double outlierRatio, bool central,
+              AbsolutePoseBatch& batch)
+{
+    batch.clear();
+
+    size_t nInliers = 0;
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        Eigen::Matrix4d H_cam = Eigen::Matrix4d::Identity();
+        if (!central)
+        {
+            H_cam = H_sys_cam.at(i % H_sys_cam.size());
+        }
+
+        // point in front of the camera
+        Eigen::Vector3d P_cam(rng.uniform(-2.0, 2.0), rng.uniform(-2.0, 2.0), rng.uniform(2.0, 8.0));
+        Eigen::Vector3d P_sys = H_cam.block<3,3>(0,0) * P_cam + H_cam.block<3,1>(0,3);
+        Eigen::Vector3d P_world = H_world_sys.block<3,3>(0,0) * P_sys + H_world_sys.block<3,1>(0,3);
+
+        Eigen::Vector3d ray = P_cam.normalized();
+        if (rng.uniform() < outlierRatio)
+        {
+            ray = Eigen::Vector3d(rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0), 1.0).normalized();
+        }
+        else
+        {
+            ++nInliers;
+        }
+
+        if (central)
+        {
+            batch.add(P_world, ray);
+        }
+        else
+        {
+            batch.add(P_world, ray, H_cam);
+        }
+    }
+
+    return nInliers;
+}
+
+TEST(AbsolutePoseBatch, P3PArray)
+{
+    Xoshiro256 rng(3);
+
+    for (int i = 0; i < 20; ++i)
+    {
+        Eigen::Matrix4d H = randomPose(rng);
+
+        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > rays(3), worldPoints(3);
+        for (int j = 0; j < 3; ++j)
+        {
+            Eigen::Vector3d P_cam(rng.uniform(-2.0, 2.0), rng.uniform(-2.0, 2.0), rng.uniform(2.0, 8.0));
+
+            rays.at(j) = P_cam.normalized();
+            worldPoints.at(j) = H.block<3,3>(0,0) * P_cam + H.block<3,1>(0,3);
+        }
+
+        std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > solutions;
+        ASSERT_TRUE(solveP3P(rays, worldPoints, solutions));
+
+        Eigen::Matrix4d solutionArray[4];
+        int nSolutions;
+        ASSERT_TRUE(solveP3P(&rays[0], &worldPoints[0], solutionArray, nSolutions));
+        ASSERT_EQ(static_cast<int>(solutions.size()), nSolutions);
+
+        double normMin = std::numeric_limits<double>::max();
+        for (int j = 0; j < nSolutions; ++j)
+        {
+            EXPECT_EQ(solutions.at(j), solutionArray[j]);
+
+            normMin = std::min(normMin, (solutionArray[j] - H).norm());
+        }
+        EXPECT_LT(normMin, 1e-6);
+    }
+}
+
+TEST(AbsolutePoseBatch, CountInliers)
+{
+    Xoshiro256 rng(5);
+
+    const double k_cosThresh = 0.999976;
+
+    std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > H_sys_cam(2);
+    H_sys_cam.at(0).setIdentity();
+    H_sys_cam.at(1) = randomPose(rng);
+
+    for (int central = 0; central < 2; ++central)
+    {
+        Eigen::Matrix4d H = randomPose(rng);
+
+        AbsolutePoseBatch batch;
+        size_t nInliers = generateScene(rng, H, H_sys_cam, 1000, 0.3, central, batch);
+        EXPECT_EQ(central != 0, batch.isCentral());
+
+        // reference: the per-match test of the VO front ends
+        Eigen::Matrix4d H_inv = H.inverse();
+        size_t nInliersRef = 0;
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            Eigen::Vector3d P_sys = H_inv.block<3,3>(0,0) * batch.worldPoint(i) + H_inv.block<3,1>(0,3);
+
+            double err = fabs((P_sys - batch.cameraCenter(i)).normalized().dot(batch.ray(i)));
+            if (err >= k_cosThresh)
+            {
+                ++nInliersRef;
+            }
+        }
+
+        EXPECT_EQ(nInliers, nInliersRef);
+        EXPECT_EQ(nInliersRef, batch.countInliers(H, k_cosThresh));
+
+        std::vector<bool> inliers;
+        batch.inliers(H, k_cosThresh, inliers);
+        EXPECT_EQ(nInliersRef, static_cast<size_t>(std::count(inliers.begin(), inliers.end(), true)));
+
+        // preemptive scoring stops below the count to beat
+        EXPECT_LE(batch.countInliers(H, k_cosThresh, batch.size()), batch.size());
+        EXPECT_EQ(nInliersRef, batch.countInliers(H, k_cosThresh, nInliersRef - 1));
+    }
+}
+
+TEST(AbsolutePoseBatch, SolveAndScore)
+{
+    Xoshiro256 rng(7);
+
+    const double k_cosThresh = 0.999976;
+
+    std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > H_sys_cam(2);
+    H_sys_cam.at(0).setIdentity();
+    H_sys_cam.at(0).block<3,1>(0,3) << 1.0, 0.0, 0.0;
+    H_sys_cam.at(1) << 1.0, 0.0, 0.0, 0.0,
+                       0.0, 0.0, 1.0, 1.0,
+                       0.0, -1.0, 0.0, 0.0,
+                       0.0, 0.0, 0.0, 1.0;
+
+    for (int central = 0; central < 2; ++central)
+    {
+        Eigen::Matrix4d H = randomPose(rng);
+
+        AbsolutePoseBatch batch;
+        size_t nInliers = generateScene(rng, H, H_sys_cam, 500, 0.4, central, batch);
+
+        const int nSamples = 100;
+        std::vector<size_t> sampleIds, sample;
+        for (int i = 0; i < nSamples; ++i)
+        {
+            ASSERT_TRUE(sampleKofN(rng, 3, batch.size(), sample));
+            sampleIds.insert(sampleIds.end(), sample.begin(), sample.end());
+        }
+
+        Eigen::Matrix4d H_best;
+        size_t nInliers_best = 0;
+        int nHypotheses = batch.solveAndScore(&sampleIds[0], nSamples, k_cosThresh,
+                                              H_best, nInliers_best);
+
+        EXPECT_GE(nHypotheses, nSamples / 2);
+        EXPECT_EQ(nInliers, nInliers_best);
+        EXPECT_LT((H_best - H).norm(), 1e-6);
+    }
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,222 @@
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include "cauldron/Random.h"
+#include "pose_estimation/AbsolutePoseRansac.h"
+
+namespace px
+{
+
+Eigen::Matrix4d
+randomPose(Xoshiro256& rng)
+{
+    Eigen::Vector3d axis(rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0));
+
+    Eigen::Matrix4d H = Eigen::Matrix4d::Identity();
+    H.block<3,3>(0,0) = Eigen::AngleAxisd(rng.uniform(-M_PI, M_PI), axis.normalized()).toRotationMatrix();
+    H.block<3,1>(0,3) << rng.uniform(-10.0, 10.0), rng.uniform(-10.0, 10.0), rng.uniform(-10.0, 10.0);
+
+    return H;
+}
+
+// Points seen by two cameras of a rig, or by one camera at the system
+// origin if central is set. Rays get isotropic noise of sigma (rad), and
+// a fraction of them are replaced by outliers.
+void
+generateScene(Xoshiro256& rng, const Eigen::Matrix4d& H_world_sys,
+              size_t nPoints, double sigma, double outlierRatio, bool central,
+              AbsolutePoseBatch& batch, std::vector<bool>& isInlier)
+{
+    Eigen::Matrix4d H_sys_cam[2];
+    H_sys_cam[0].setIdentity();
+    H_sys_cam[0].block<3,1>(0,3) << 0.5, 0.0, 0.0;
+    H_sys_cam[1] << 1.0, 0.0, 0.0, 0.0,
+                    0.0, 0.0, 1.0, 0.5,
+                    0.0, -1.0, 0.0, 0.0,
+                    0.0, 0.0, 0.0, 1.0;
+
+    batch.clear();
+    isInlier.clear();
+    for (size_t i = 0; i < nPoints; ++i)
+    {
+        Eigen::Matrix4d H_cam = central ? Eigen::Matrix4d::Identity() : H_sys_cam[i % 2];
+
+        Eigen::Vector3d P_cam(rng.uniform(-4.0, 4.0), rng.uniform(-4.0, 4.0), rng.uniform(1.0, 10.0));
+        Eigen::Vector3d P_sys = H_cam.block<3,3>(0,0) * P_cam + H_cam.block<3,1>(0,3);
+        Eigen::Vector3d P_world = H_world_sys.block<3,3>(0,0) * P_sys + H_world_sys.block<3,1>(0,3);
+
+        Eigen::Vector3d ray = P_cam.normalized();
+        bool inlier = rng.uniform() >= outlierRatio;
+        if (inlier)
+        {
+            ray += Eigen::Vector3d(rng.normal(), rng.normal(), rng.normal()) * sigma;
+        }
+        else
+        {
+            ray = Eigen::Vector3d(rng.uniform(-1.0, 1.0), rng.uniform(-1.0, 1.0), 1.0);
+        }
+
+        if (central)
+        {
+            batch.add(P_world, ray);
+        }
+        else
+        {
+            batch.add(P_world, ray, H_cam);
+        }
+        isInlier.push_back(inlier);
+    }
+}
+
+double
+rotationError(const Eigen::Matrix4d& H1, const Eigen::Matrix4d& H2)
+{
+    Eigen::Matrix3d dR = H1.block<3,3>(0,0).transpose() * H2.block<3,3>(0,0);
+
+    return Eigen::AngleAxisd(dR).angle();
+}
+
+TEST(AbsolutePoseRansac, Refinement)
+{
+    Xoshiro256 rng(13);
+
+    for (int central = 0; central < 2; ++central)
+    {
+        Eigen::Matrix4d H = randomPose(rng);
+
+        AbsolutePoseBatch batch;
+        std::vector<bool> isInlier;
+        generateScene(rng, H, 50, 0.0, 0.0, central, batch, isInlier);
+
+        std::vector<size_t> ids;
+        for (size_t i = 0; i < batch.size(); ++i)
+        {
+            ids.push_back(i);
+        }
+
+        Eigen::Matrix4d H_est = H;
+        H_est.block<3,3>(0,0) = Eigen::AngleAxisd(0.05, Eigen::Vector3d(1.0, -1.0, 2.0).normalized()).toRotationMatrix()
+                                * H.block<3,3>(0,0);
+        H_est.block<3,1>(0,3) += Eigen::Vector3d(0.1, -0.2, 0.1);
+
+        int nIterations = refineAbsolutePose(batch, ids, H_est, 20);
+
+        EXPECT_LT(nIterations, 20);
+        EXPECT_LT(rotationError(H, H_est), 1e-9);
+        EXPECT_LT((H.block<3,1>(0,3) - H_est.block<3,1>(0,3)).norm(), 1e-8);
+    }
+}
+
+TEST(AbsolutePoseRansac, LocalOptimization)
+{
+    const double k_sigma = 1e-3;
+
+    double rotationErrorLO = 0.0, rotationErrorPlain = 0.0;
+    double translationErrorLO = 0.0, translationErrorPlain = 0.0;
+    for (int trial = 0; trial < 20; ++trial)
+    {
+        Xoshiro256 rng(100 + trial);
+
+        Eigen::Matrix4d H = randomPose(rng);
+
+        AbsolutePoseBatch batch;
+        std::vector<bool> isInlier;
+        generateScene(rng, H, 300, k_sigma, 0.4, trial % 2, batch, isInlier);
+
+        AbsolutePoseRansac ransac;
+        ransac.threshold() = cos(3.0 * k_sigma * sqrt(2.0));
+
+        setRandomSeed(trial);
+        Eigen::Matrix4d H_lo;
+        std::vector<bool> inliers;
+        ASSERT_TRUE(ransac.estimate(batch, H_lo, inliers));
+        EXPECT_GT(ransac.localOptimizationCount(), 0);
+
+        // nearly all true inliers are recovered, and few outliers accepted
+        size_t nTrue = 0, nFalse = 0;
+        for (size_t i = 0; i < inliers.size(); ++i)
+        {
+            if (!inliers.at(i))
+            {
+                continue;
+            }
+
+            if (isInlier.at(i))
+            {
+                ++nTrue;
+            }
+            else
+            {
+                ++nFalse;
+            }
+        }
+        EXPECT_GT(nTrue, 0.95 * std::count(isInlier.begin(), isInlier.end(), true));
+        EXPECT_LT(nFalse, 5u);
+
+        setRandomSeed(trial);
+        ransac.localIterations() = 0;
+        Eigen::Matrix4d H_plain;
+        ASSERT_TRUE(ransac.estimate(batch, H_plain, inliers));
+        EXPECT_EQ(0, ransac.localOptimizationCount());
+
+        rotationErrorLO += rotationError(H, H_lo);
+        rotationErrorPlain += rotationError(H, H_plain);
+        translationErrorLO += (H.block<3,1>(0,3) - H_lo.block<3,1>(0,3)).norm();
+        translationErrorPlain += (H.block<3,1>(0,3) - H_plain.block<3,1>(0,3)).norm();
+    }
+
+    EXPECT_LT(rotationErrorLO / 20.0, 1e-3);
+    EXPECT_LT(rotationErrorLO, 0.5 * rotationErrorPlain);
+    EXPECT_LT(translationErrorLO, 0.5 * translationErrorPlain);
+}
+
+TEST(AbsolutePoseRansac, RotationPrior)
+{
+    const double k_sigma = 1e-3;
+
+    for (int central = 0; central < 2; ++central)
+    {
+        Xoshiro256 rng(200 + central);
+
+        Eigen::Matrix4d H = randomPose(rng);
+
+        // exact rotation, exact rays
+        AbsolutePoseBatch batch;
+        std::vector<bool> isInlier;
+        generateScene(rng, H, 20, 0.0, 0.0, central, batch, isInlier);
+
+        size_t ids[2] = {3, 11};
+        Eigen::Matrix4d H_est;
+        ASSERT_TRUE(batch.solveWithRotation(ids, H.block<3,3>(0,0), H_est));
+        EXPECT_LT((H_est - H).norm(), 1e-9);
+
+        // a prior a few mrad off, as from integrated gyro rates
+        generateScene(rng, H, 300, k_sigma, 0.4, central, batch, isInlier);
+
+        Eigen::Matrix3d R_prior = Eigen::AngleAxisd(3e-3, Eigen::Vector3d(1.0, 2.0, -1.0).normalized()).toRotationMatrix()
+                                  * H.block<3,3>(0,0);
+
+        AbsolutePoseRansac ransac;
+        ransac.threshold() = cos(3.0 * k_sigma * sqrt(2.0));
+
+        setRandomSeed(central);
+        std::vector<bool> inliers;
+        ASSERT_TRUE(ransac.estimate(batch, R_prior, H_est, inliers));
+        int nIterationsPrior = ransac.iterationCount();
+
+        EXPECT_LT(rotationError(H, H_est), 1e-3);
+        EXPECT_LT((H.block<3,1>(0,3) - H_est.block<3,1>(0,3)).norm(), 0.02);
+
+        setRandomSeed(central);
+        ASSERT_TRUE(ransac.estimate(batch, H_est, inliers));
+        EXPECT_LT(nIterationsPrior, ransac.iterationCount());
+    }
+}
+
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
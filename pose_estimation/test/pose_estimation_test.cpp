@@ -16,8 +16,6 @@ generateExample(Eigen::Matrix4d& H_sys_expected,
                 std::vector<PLine, Eigen::aligned_allocator<PLine> >& plineVec,
                 std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& scenePoints)
 {
-    srand(time(0));
-
     CameraPtr camera1(new EquidistantCamera("camera", 1280, 800,
                                             -0.01648, -0.00203, 0.00069, -0.00048,
                                             419.22826, 420.42160, 655.45487, 389.66377));
@@ -77,8 +75,9 @@ generateExample(Eigen::Matrix4d& H_sys_expected,
 
     // system pose
     H_sys_expected = Eigen::Matrix4d::Identity();
-    H_sys_expected.block<3,3>(0,0) = Eigen::AngleAxisd(random(-M_PI, M_PI), Eigen::Vector3d::Random().normalized()).toRotationMatrix();
-    H_sys_expected.block<3,1>(0,3) = Eigen::Vector3d::Random() * 10.0;
+    Eigen::Vector3d axis(random(-1.0, 1.0), random(-1.0, 1.0), random(-1.0, 1.0));
+    H_sys_expected.block<3,3>(0,0) = Eigen::AngleAxisd(random(-M_PI, M_PI), axis.normalized()).toRotationMatrix();
+    H_sys_expected.block<3,1>(0,3) << random(-10.0, 10.0), random(-10.0, 10.0), random(-10.0, 10.0);
 
     for (int i = 0; i < 3; ++i)
     {
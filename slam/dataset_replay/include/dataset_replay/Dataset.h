@@ -0,0 +1,70 @@
+#ifndef DATASET_H
+#define DATASET_H
+
+#include <opencv2/core/core.hpp>
+#include <ros/time.h>
+#include <sensor_msgs/Imu.h>
+
+#include "camera_systems/CameraSystem.h"
+#include "dataset_replay/TrajectoryEvaluation.h"
+
+namespace px
+{
+
+// A recorded or synthetic sequence on disk, readable without ROS:
+//
+//   camera_system/    CameraSystem::writeToDirectory
+//   frames.txt        stamp_ns image_0 ... image_N-1 (relative paths)
+//   imu.txt           stamp_ns wx wy wz ax ay az [qx qy qz qw] (system frame)
+//   groundtruth.txt   stamp_ns tx ty tz qx qy qz qw (system to world)
+//
+// Lines starting with '#' are comments. IMU and ground truth are
+// optional. The attitude of an IMU sample is the one recorded from the
+// attitude filter of the vehicle; where it is missing, the orientation is
+// the identity and orientation_covariance[0] is -1, as for an IMU that
+// reports no orientation. The ground truth is only used for evaluation.
+// Images are only read on demand.
+class Dataset
+{
+public:
+    Dataset();
+
+    bool read(const std::string& directory);
+    // writes everything except the images, which the caller stores under
+    // the relative paths given to addFrame()
+    bool write(const std::string& directory) const;
+
+    const std::string& directory(void) const;
+
+    CameraSystemPtr& cameraSystem(void);
+    CameraSystemConstPtr cameraSystem(void) const;
+
+    size_t frameCount(void) const;
+    const ros::Time& frameStamp(size_t idx) const;
+    const std::vector<std::string>& frameImageFilenames(size_t idx) const;
+    void addFrame(const ros::Time& stamp,
+                  const std::vector<std::string>& imageFilenames);
+
+    // reads the images of a frame as 8-bit grayscale
+    bool readImages(size_t idx, std::vector<cv::Mat>& images) const;
+
+    std::vector<sensor_msgs::ImuConstPtr>& imuMeasurements(void);
+    const std::vector<sensor_msgs::ImuConstPtr>& imuMeasurements(void) const;
+
+    Trajectory& groundTruth(void);
+    const Trajectory& groundTruth(void) const;
+
+private:
+    std::string m_directory;
+    CameraSystemPtr m_cameraSystem;
+
+    std::vector<ros::Time> m_frameStamps;
+    std::vector<std::vector<std::string> > m_frameImageFilenames;
+
+    std::vector<sensor_msgs::ImuConstPtr> m_imuMeasurements;
+    Trajectory m_groundTruth;
+};
+
+}
+
+#endif
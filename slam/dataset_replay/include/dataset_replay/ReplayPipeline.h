@@ -0,0 +1,98 @@
+#ifndef REPLAYPIPELINE_H
+#define REPLAYPIPELINE_H
+
+#include <boost/shared_ptr.hpp>
+#include <Eigen/Dense>
+#include <opencv2/core/core.hpp>
+#include <ros/ros.h>
+#include <sensor_msgs/Imu.h>
+
+#include "camera_systems/CameraSystem.h"
+
+namespace px
+{
+
+class GCamSLAM;
+class GCamVO;
+class StereoVO;
+
+// Adapts a VO or SLAM pipeline to the replayer: one call per frame with
+// the images of all cameras, returning the pose of the system with
+// respect to the world frame.
+class ReplayPipeline
+{
+public:
+    virtual ~ReplayPipeline() {}
+
+    virtual bool init(void) = 0;
+
+    virtual void addImuMeasurement(const sensor_msgs::ImuConstPtr& imu) {}
+
+    virtual bool processFrames(const ros::Time& stamp,
+                               const std::vector<cv::Mat>& imageVec,
+                               const sensor_msgs::ImuConstPtr& imu,
+                               Eigen::Matrix4d& H_sys_world) = 0;
+};
+
+typedef boost::shared_ptr<ReplayPipeline> ReplayPipelinePtr;
+
+class GCamVOReplayPipeline: public ReplayPipeline
+{
+public:
+    GCamVOReplayPipeline(const CameraSystemConstPtr& cameraSystem);
+
+    bool init(void);
+
+    void addImuMeasurement(const sensor_msgs::ImuConstPtr& imu);
+
+    bool processFrames(const ros::Time& stamp,
+                       const std::vector<cv::Mat>& imageVec,
+                       const sensor_msgs::ImuConstPtr& imu,
+                       Eigen::Matrix4d& H_sys_world);
+
+private:
+    boost::shared_ptr<GCamVO> m_vo;
+};
+
+// runs on the first two cameras of the camera system
+class StereoVOReplayPipeline: public ReplayPipeline
+{
+public:
+    StereoVOReplayPipeline(const CameraSystemConstPtr& cameraSystem);
+
+    bool init(void);
+
+    bool processFrames(const ros::Time& stamp,
+                       const std::vector<cv::Mat>& imageVec,
+                       const sensor_msgs::ImuConstPtr& imu,
+                       Eigen::Matrix4d& H_sys_world);
+
+private:
+    boost::shared_ptr<StereoVO> m_vo;
+};
+
+// GCamSLAM advertises its topics, so it needs a running ROS master
+class GCamSLAMReplayPipeline: public ReplayPipeline
+{
+public:
+    GCamSLAMReplayPipeline(ros::NodeHandle& nh,
+                           const CameraSystemConstPtr& cameraSystem,
+                           const std::string& vocFilename);
+
+    bool init(void);
+
+    void addImuMeasurement(const sensor_msgs::ImuConstPtr& imu);
+
+    bool processFrames(const ros::Time& stamp,
+                       const std::vector<cv::Mat>& imageVec,
+                       const sensor_msgs::ImuConstPtr& imu,
+                       Eigen::Matrix4d& H_sys_world);
+
+private:
+    boost::shared_ptr<GCamSLAM> m_slam;
+    std::string m_vocFilename;
+};
+
+}
+
+#endif
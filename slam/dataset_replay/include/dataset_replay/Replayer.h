@@ -0,0 +1,50 @@
+#ifndef REPLAYER_H
+#define REPLAYER_H
+
+#include "dataset_replay/Dataset.h"
+#include "dataset_replay/ReplayPipeline.h"
+#include "dataset_replay/TrajectoryEvaluation.h"
+
+namespace px
+{
+
+// Feeds the frames and IMU measurements of a dataset to a pipeline in
+// time order, and records the estimated trajectory and the wall-clock
+// time spent in the pipeline on each frame.
+class Replayer
+{
+public:
+    // rate is a multiple of real time; 0 replays as fast as possible
+    Replayer(const Dataset& dataset,
+             const ReplayPipelinePtr& pipeline,
+             double rate = 0.0);
+
+    // replays at most maxFrames frames if it is non-zero
+    bool run(size_t maxFrames = 0);
+
+    const Trajectory& trajectory(void) const;
+
+    // seconds spent in processFrames, one entry per replayed frame
+    const std::vector<double>& processingTimes(void) const;
+
+    // frames on which the pipeline returned false
+    size_t failedFrameCount(void) const;
+    // frames that were handed over after their replay time because the
+    // pipeline had not finished the previous one; frames are never
+    // dropped, so a slow pipeline falls behind instead
+    size_t lateFrameCount(void) const;
+
+private:
+    const Dataset& m_dataset;
+    ReplayPipelinePtr m_pipeline;
+    double m_rate;
+
+    Trajectory m_trajectory;
+    std::vector<double> m_processingTimes;
+    size_t m_failedFrameCount;
+    size_t m_lateFrameCount;
+};
+
+}
+
+#endif
@@ -0,0 +1,84 @@
+#ifndef SYNTHETICDATASETGENERATOR_H
+#define SYNTHETICDATASETGENERATOR_H
+
+#include <opencv2/core/core.hpp>
+
+#include "camera_systems/CameraSystem.h"
+#include "cauldron/Random.h"
+#include "dataset_replay/Dataset.h"
+
+namespace px
+{
+
+// Renders a multi-camera sequence inside a box-shaped room whose walls,
+// floor and ceiling carry a random mosaic texture, along the closed
+// SyntheticTrajectory with known IMU measurements. The world frame is z-up
+// and centered on the floor of the room. IMU samples carry the true
+// attitude perturbed by attitudeNoise(), so that no estimate is given the
+// ground truth.
+class SyntheticDatasetGenerator
+{
+public:
+    SyntheticDatasetGenerator(const CameraSystemConstPtr& cameraSystem,
+                              uint64_t seed = 0);
+
+    // two stereo pairs of 640x480 pinhole cameras with a 0.1 m baseline,
+    // facing forward and backward
+    static CameraSystemPtr createDefaultCameraSystem(void);
+
+    double& duration(void);         // [s], one loop of the trajectory
+    double& frameRate(void);        // [Hz]
+    double& imuRate(void);          // [Hz]
+    double& gyroNoiseDensity(void);  // [rad/s/sqrt(Hz)]
+    double& accelNoiseDensity(void); // [m/s^2/sqrt(Hz)]
+    // [rad] standard deviation about each axis of the attitude recorded
+    // with each IMU sample, as an attitude filter would report it
+    double& attitudeNoise(void);
+    double& imageNoise(void);       // standard deviation in gray levels
+    Eigen::Vector3d& roomSize(void); // [m]
+
+    // Writes the dataset and its images to the directory, and returns it
+    // as read back from there.
+    bool generate(const std::string& directory, Dataset& dataset);
+
+    // pose of the system with respect to the world frame at time t since
+    // the start, its linear acceleration in the world frame and its
+    // angular velocity in the system frame
+    void systemState(double t, Eigen::Matrix4d& H_sys_world,
+                     Eigen::Vector3d& accel, Eigen::Vector3d& omega) const;
+
+    // noise-free IMU measurement in the system frame
+    void imuMeasurement(double t, Eigen::Vector3d& gyro,
+                        Eigen::Vector3d& accel) const;
+
+    void renderImage(int cameraIdx, const Eigen::Matrix4d& H_sys_world,
+                     cv::Mat& image);
+
+private:
+    void computeRays(void);
+
+    unsigned char textureValue(int face, double u, double v) const;
+
+    const double k_textureCellSize;
+
+    CameraSystemConstPtr m_cameraSystem;
+
+    double m_duration;
+    double m_frameRate;
+    double m_imuRate;
+    double m_gyroNoiseDensity;
+    double m_accelNoiseDensity;
+    double m_attitudeNoise;
+    double m_imageNoise;
+    Eigen::Vector3d m_roomSize;
+
+    uint64_t m_textureSeed;
+    Xoshiro256 m_rng;
+
+    // unit ray of each pixel in the camera frame, per camera
+    std::vector<std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > > m_rays;
+};
+
+}
+
+#endif
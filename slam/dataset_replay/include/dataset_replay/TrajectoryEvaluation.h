@@ -0,0 +1,75 @@
+#ifndef TRAJECTORYEVALUATION_H
+#define TRAJECTORYEVALUATION_H
+
+#include <Eigen/Dense>
+#include <Eigen/StdVector>
+#include <ros/time.h>
+#include <string>
+#include <vector>
+
+namespace px
+{
+
+class StampedPose
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    StampedPose();
+    StampedPose(const ros::Time& stamp, const Eigen::Matrix4d& H);
+
+    ros::Time stamp;
+    Eigen::Matrix4d H;      // system to world
+};
+
+typedef std::vector<StampedPose, Eigen::aligned_allocator<StampedPose> > Trajectory;
+
+class ErrorStatistics
+{
+public:
+    ErrorStatistics();
+
+    void compute(std::vector<double> errors);
+
+    size_t count;
+    double rmse;
+    double mean;
+    double median;
+    double max;
+};
+
+// one line per pose: stamp_ns tx ty tz qx qy qz qw
+bool readTrajectory(const std::string& filename, Trajectory& trajectory);
+bool writeTrajectory(const std::string& filename, const Trajectory& trajectory);
+
+// Pairs each estimated pose with the ground-truth pose nearest in time,
+// if it is within maxTimeDifference seconds. Both trajectories must be
+// sorted by time.
+void associateTrajectories(const Trajectory& estimate,
+                           const Trajectory& groundTruth,
+                           double maxTimeDifference,
+                           std::vector<std::pair<size_t,size_t> >& pairs);
+
+// Absolute trajectory error (Sturm et al., IROS 2012): the translation
+// error of the associated poses after the rigid-body transform H_align
+// from the estimate's world frame to the ground truth's that minimizes
+// it (Umeyama). VO starts from an arbitrary frame, so this is the only
+// meaningful absolute measure.
+bool computeATE(const Trajectory& estimate,
+                const Trajectory& groundTruth,
+                const std::vector<std::pair<size_t,size_t> >& pairs,
+                ErrorStatistics& translationError,
+                Eigen::Matrix4d& H_align);
+
+// Relative pose error over associated pairs delta poses apart, in meters
+// and radians. Independent of the alignment, it measures drift.
+bool computeRPE(const Trajectory& estimate,
+                const Trajectory& groundTruth,
+                const std::vector<std::pair<size_t,size_t> >& pairs,
+                size_t delta,
+                ErrorStatistics& translationError,
+                ErrorStatistics& rotationError);
+
+}
+
+#endif
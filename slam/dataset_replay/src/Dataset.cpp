@@ -0,0 +1,295 @@
+#include "dataset_replay/Dataset.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <fstream>
+#include <iomanip>
+#include <opencv2/highgui/highgui.hpp>
+#include <ros/console.h>
+#include <sstream>
+
+namespace px
+{
+
+Dataset::Dataset()
+ : m_cameraSystem(boost::make_shared<CameraSystem>())
+{
+
+}
+
+bool
+Dataset::read(const std::string& directory)
+{
+    boost::filesystem::path path(directory);
+
+    if (!m_cameraSystem->readFromDirectory((path / "camera_system").string()))
+    {
+        ROS_ERROR("Failed to read camera system in %s.", directory.c_str());
+        return false;
+    }
+
+    m_directory = directory;
+
+    // frames
+    std::ifstream ifs((path / "frames.txt").string().c_str());
+    if (!ifs.is_open())
+    {
+        ROS_ERROR("Failed to open frames.txt in %s.", directory.c_str());
+        return false;
+    }
+
+    m_frameStamps.clear();
+    m_frameImageFilenames.clear();
+
+    std::string line;
+    while (std::getline(ifs, line))
+    {
+        if (line.empty() || line.at(0) == '#')
+        {
+            continue;
+        }
+
+        std::istringstream iss(line);
+
+        uint64_t stamp;
+        iss >> stamp;
+
+        std::vector<std::string> imageFilenames;
+        std::string imageFilename;
+        while (iss >> imageFilename)
+        {
+            imageFilenames.push_back(imageFilename);
+        }
+
+        if (iss.bad() || imageFilenames.size() != static_cast<size_t>(m_cameraSystem->cameraCount()))
+        {
+            ROS_ERROR("Malformed line in frames.txt: %s", line.c_str());
+            return false;
+        }
+
+        ros::Time frameStamp;
+        frameStamp.fromNSec(stamp);
+
+        addFrame(frameStamp, imageFilenames);
+    }
+    ifs.close();
+
+    // IMU measurements
+    m_imuMeasurements.clear();
+
+    ifs.open((path / "imu.txt").string().c_str());
+    if (ifs.is_open())
+    {
+        while (std::getline(ifs, line))
+        {
+            if (line.empty() || line.at(0) == '#')
+            {
+                continue;
+            }
+
+            std::istringstream iss(line);
+
+            uint64_t stamp;
+            sensor_msgs::ImuPtr imu = boost::make_shared<sensor_msgs::Imu>();
+            if (!(iss >> stamp
+                      >> imu->angular_velocity.x >> imu->angular_velocity.y >> imu->angular_velocity.z
+                      >> imu->linear_acceleration.x >> imu->linear_acceleration.y >> imu->linear_acceleration.z))
+            {
+                ROS_ERROR("Malformed line in imu.txt: %s", line.c_str());
+                return false;
+            }
+
+            imu->header.stamp.fromNSec(stamp);
+
+            double qx, qy, qz, qw;
+            if (iss >> qx >> qy >> qz >> qw)
+            {
+                imu->orientation.x = qx;
+                imu->orientation.y = qy;
+                imu->orientation.z = qz;
+                imu->orientation.w = qw;
+            }
+            else
+            {
+                imu->orientation.w = 1.0;
+                imu->orientation_covariance[0] = -1.0;
+            }
+
+            m_imuMeasurements.push_back(imu);
+        }
+        ifs.close();
+    }
+
+    // ground truth
+    m_groundTruth.clear();
+
+    boost::filesystem::path groundTruthPath = path / "groundtruth.txt";
+    if (boost::filesystem::exists(groundTruthPath) &&
+        !readTrajectory(groundTruthPath.string(), m_groundTruth))
+    {
+        ROS_ERROR("Failed to read groundtruth.txt in %s.", directory.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool
+Dataset::write(const std::string& directory) const
+{
+    boost::filesystem::path path(directory);
+
+    boost::filesystem::create_directories(path);
+
+    if (!m_cameraSystem->writeToDirectory((path / "camera_system").string()))
+    {
+        return false;
+    }
+
+    std::ofstream ofs((path / "frames.txt").string().c_str());
+    if (!ofs.is_open())
+    {
+        return false;
+    }
+
+    ofs << "# stamp_ns image_0 ... image_N-1" << std::endl;
+    for (size_t i = 0; i < m_frameStamps.size(); ++i)
+    {
+        ofs << m_frameStamps.at(i).toNSec();
+
+        const std::vector<std::string>& imageFilenames = m_frameImageFilenames.at(i);
+        for (size_t j = 0; j < imageFilenames.size(); ++j)
+        {
+            ofs << " " << imageFilenames.at(j);
+        }
+        ofs << std::endl;
+    }
+    ofs.close();
+
+    if (!m_imuMeasurements.empty())
+    {
+        ofs.open((path / "imu.txt").string().c_str());
+        if (!ofs.is_open())
+        {
+            return false;
+        }
+
+        ofs << "# stamp_ns wx wy wz ax ay az [qx qy qz qw]" << std::endl;
+        ofs << std::setprecision(12);
+        for (size_t i = 0; i < m_imuMeasurements.size(); ++i)
+        {
+            const sensor_msgs::Imu& imu = *m_imuMeasurements.at(i);
+
+            ofs << imu.header.stamp.toNSec() << " "
+                << imu.angular_velocity.x << " " << imu.angular_velocity.y << " " << imu.angular_velocity.z << " "
+                << imu.linear_acceleration.x << " " << imu.linear_acceleration.y << " " << imu.linear_acceleration.z;
+            if (imu.orientation_covariance[0] != -1.0)
+            {
+                ofs << " " << imu.orientation.x << " " << imu.orientation.y
+                    << " " << imu.orientation.z << " " << imu.orientation.w;
+            }
+            ofs << std::endl;
+        }
+        ofs.close();
+    }
+
+    if (!m_groundTruth.empty() &&
+        !writeTrajectory((path / "groundtruth.txt").string(), m_groundTruth))
+    {
+        return false;
+    }
+
+    return true;
+}
+
+const std::string&
+Dataset::directory(void) const
+{
+    return m_directory;
+}
+
+CameraSystemPtr&
+Dataset::cameraSystem(void)
+{
+    return m_cameraSystem;
+}
+
+CameraSystemConstPtr
+Dataset::cameraSystem(void) const
+{
+    return m_cameraSystem;
+}
+
+size_t
+Dataset::frameCount(void) const
+{
+    return m_frameStamps.size();
+}
+
+const ros::Time&
+Dataset::frameStamp(size_t idx) const
+{
+    return m_frameStamps.at(idx);
+}
+
+const std::vector<std::string>&
+Dataset::frameImageFilenames(size_t idx) const
+{
+    return m_frameImageFilenames.at(idx);
+}
+
+void
+Dataset::addFrame(const ros::Time& stamp,
+                  const std::vector<std::string>& imageFilenames)
+{
+    m_frameStamps.push_back(stamp);
+    m_frameImageFilenames.push_back(imageFilenames);
+}
+
+bool
+Dataset::readImages(size_t idx, std::vector<cv::Mat>& images) const
+{
+    const std::vector<std::string>& imageFilenames = m_frameImageFilenames.at(idx);
+
+    images.resize(imageFilenames.size());
+    for (size_t i = 0; i < imageFilenames.size(); ++i)
+    {
+        boost::filesystem::path imagePath(m_directory);
+        imagePath /= imageFilenames.at(i);
+
+        images.at(i) = cv::imread(imagePath.string(), CV_LOAD_IMAGE_GRAYSCALE);
+        if (images.at(i).empty())
+        {
+            ROS_ERROR("Failed to read image %s.", imagePath.string().c_str());
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::vector<sensor_msgs::ImuConstPtr>&
+Dataset::imuMeasurements(void)
+{
+    return m_imuMeasurements;
+}
+
+const std::vector<sensor_msgs::ImuConstPtr>&
+Dataset::imuMeasurements(void) const
+{
+    return m_imuMeasurements;
+}
+
+Trajectory&
+Dataset::groundTruth(void)
+{
+    return m_groundTruth;
+}
+
+const Trajectory&
+Dataset::groundTruth(void) const
+{
+    return m_groundTruth;
+}
+
+}
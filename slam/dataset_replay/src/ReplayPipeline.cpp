@@ -0,0 +1,129 @@
+#include "dataset_replay/ReplayPipeline.h"
+
+#include "cauldron/EigenUtils.h"
+#include "gcam_slam/GCamSLAM.h"
+#include "gcam_vo/GCamVO.h"
+#include "stereo_vo/StereoVO.h"
+
+namespace px
+{
+
+GCamVOReplayPipeline::GCamVOReplayPipeline(const CameraSystemConstPtr& cameraSystem)
+ : m_vo(new GCamVO(cameraSystem, false, true))
+{
+
+}
+
+bool
+GCamVOReplayPipeline::init(void)
+{
+    return m_vo->init("STAR", "ORB", "BruteForce-Hamming");
+}
+
+void
+GCamVOReplayPipeline::addImuMeasurement(const sensor_msgs::ImuConstPtr& imu)
+{
+    m_vo->addImuMeasurement(imu);
+}
+
+bool
+GCamVOReplayPipeline::processFrames(const ros::Time& stamp,
+                                    const std::vector<cv::Mat>& imageVec,
+                                    const sensor_msgs::ImuConstPtr& imu,
+                                    Eigen::Matrix4d& H_sys_world)
+{
+    FrameSetPtr frameSet;
+    if (!m_vo->processFrames(stamp, imageVec, imu, frameSet))
+    {
+        return false;
+    }
+
+    H_sys_world = invertHomogeneousTransform(frameSet->systemPose()->toMatrix());
+
+    // same keying policy as gcam_vo_node
+    if (m_vo->getCurrentCorrespondenceCount() < 50)
+    {
+        m_vo->keyCurrentFrameSet();
+    }
+
+    return true;
+}
+
+StereoVOReplayPipeline::StereoVOReplayPipeline(const CameraSystemConstPtr& cameraSystem)
+ : m_vo(new StereoVO(cameraSystem, 0, 1, false))
+{
+
+}
+
+bool
+StereoVOReplayPipeline::init(void)
+{
+    return m_vo->init("STAR", "ORB", "BruteForce-Hamming");
+}
+
+bool
+StereoVOReplayPipeline::processFrames(const ros::Time& stamp,
+                                      const std::vector<cv::Mat>& imageVec,
+                                      const sensor_msgs::ImuConstPtr& imu,
+                                      Eigen::Matrix4d& H_sys_world)
+{
+    if (imageVec.size() < 2)
+    {
+        ROS_ERROR("StereoVO needs at least two images per frame.");
+        return false;
+    }
+
+    if (!m_vo->readFrames(stamp, imageVec.at(0), imageVec.at(1)))
+    {
+        return false;
+    }
+
+    FrameSetPtr frameSet;
+    if (!m_vo->processFrames(frameSet) ||
+        !m_vo->getCurrentPose(H_sys_world))
+    {
+        return false;
+    }
+
+    // same keying policy as stereo_vo_node
+    if (m_vo->getCurrent2D3DCorrespondenceCount() < 40)
+    {
+        m_vo->keyCurrentFrameSet();
+    }
+
+    return true;
+}
+
+GCamSLAMReplayPipeline::GCamSLAMReplayPipeline(ros::NodeHandle& nh,
+                                               const CameraSystemConstPtr& cameraSystem,
+                                               const std::string& vocFilename)
+ : m_slam(new GCamSLAM(nh, cameraSystem))
+ , m_vocFilename(vocFilename)
+{
+
+}
+
+bool
+GCamSLAMReplayPipeline::init(void)
+{
+    return m_slam->init("STAR", "ORB", "BruteForce-Hamming",
+                        "pose", m_vocFilename);
+}
+
+void
+GCamSLAMReplayPipeline::addImuMeasurement(const sensor_msgs::ImuConstPtr& imu)
+{
+    m_slam->addImuMeasurement(imu);
+}
+
+bool
+GCamSLAMReplayPipeline::processFrames(const ros::Time& stamp,
+                                      const std::vector<cv::Mat>& imageVec,
+                                      const sensor_msgs::ImuConstPtr& imu,
+                                      Eigen::Matrix4d& H_sys_world)
+{
+    return m_slam->processFrames(stamp, imageVec, imu) &&
+           m_slam->getCurrentPose(H_sys_world);
+}
+
+}
@@ -0,0 +1,135 @@
+#include "dataset_replay/Replayer.h"
+
+#include <boost/make_shared.hpp>
+
+#include "cauldron/Profiler.h"
+
+namespace px
+{
+
+Replayer::Replayer(const Dataset& dataset,
+                   const ReplayPipelinePtr& pipeline,
+                   double rate)
+ : m_dataset(dataset)
+ , m_pipeline(pipeline)
+ , m_rate(rate)
+ , m_failedFrameCount(0)
+ , m_lateFrameCount(0)
+{
+
+}
+
+bool
+Replayer::run(size_t maxFrames)
+{
+    m_trajectory.clear();
+    m_processingTimes.clear();
+    m_failedFrameCount = 0;
+    m_lateFrameCount = 0;
+
+    size_t frameCount = m_dataset.frameCount();
+    if (maxFrames > 0 && maxFrames < frameCount)
+    {
+        frameCount = maxFrames;
+    }
+
+    if (frameCount == 0)
+    {
+        ROS_ERROR("Dataset has no frames.");
+        return false;
+    }
+
+    const std::vector<sensor_msgs::ImuConstPtr>& imuMeasurements = m_dataset.imuMeasurements();
+    size_t imuIdx = 0;
+
+    // GCamVO needs an attitude for every frame set
+    sensor_msgs::ImuPtr imuIdentity = boost::make_shared<sensor_msgs::Imu>();
+    imuIdentity->orientation.w = 1.0;
+    sensor_msgs::ImuConstPtr imuLast = imuIdentity;
+
+    ros::Time stampStart = m_dataset.frameStamp(0);
+    ros::WallTime wallStart = ros::WallTime::now();
+
+    std::vector<cv::Mat> imageVec;
+    for (size_t i = 0; i < frameCount; ++i)
+    {
+        const ros::Time& stamp = m_dataset.frameStamp(i);
+
+        // reading images is not part of the replay time
+        if (!m_dataset.readImages(i, imageVec))
+        {
+            return false;
+        }
+
+        while (imuIdx < imuMeasurements.size() &&
+               imuMeasurements.at(imuIdx)->header.stamp <= stamp)
+        {
+            imuLast = imuMeasurements.at(imuIdx);
+            m_pipeline->addImuMeasurement(imuLast);
+
+            ++imuIdx;
+        }
+
+        if (m_rate > 0.0)
+        {
+            ros::WallTime wallDue = wallStart + ros::WallDuration((stamp - stampStart).toSec() / m_rate);
+            ros::WallTime wallNow = ros::WallTime::now();
+
+            if (wallNow < wallDue)
+            {
+                (wallDue - wallNow).sleep();
+            }
+            else if (i > 0)
+            {
+                ++m_lateFrameCount;
+            }
+        }
+
+        Eigen::Matrix4d H_sys_world;
+
+        uint64_t tsStart = Profiler::now();
+        bool success = m_pipeline->processFrames(stamp, imageVec, imuLast, H_sys_world);
+        uint64_t tsEnd = Profiler::now();
+
+        m_processingTimes.push_back((tsEnd - tsStart) * 1e-9);
+
+        if (success)
+        {
+            m_trajectory.push_back(StampedPose(stamp, H_sys_world));
+        }
+        else
+        {
+            ++m_failedFrameCount;
+        }
+
+        Profiler::instance()->collect();
+    }
+
+    return true;
+}
+
+const Trajectory&
+Replayer::trajectory(void) const
+{
+    return m_trajectory;
+}
+
+const std::vector<double>&
+Replayer::processingTimes(void) const
+{
+    return m_processingTimes;
+}
+
+size_t
+Replayer::failedFrameCount(void) const
+{
+    return m_failedFrameCount;
+}
+
+size_t
+Replayer::lateFrameCount(void) const
+{
+    return m_lateFrameCount;
+}
+
+}
@@ -0,0 +1,319 @@
+#include "dataset_replay/SyntheticDatasetGenerator.h"
+
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <cstdio>
+#include <limits>
+#include <opencv2/highgui/highgui.hpp>
+#include <opencv2/imgproc/imgproc.hpp>
+#include <ros/console.h>
+
+#include "cauldron/EigenUtils.h"
+#include "synthetic_scene/SyntheticScene.h"
+#include "synthetic_scene/SyntheticTrajectory.h"
+
+namespace px
+{
+
+SyntheticDatasetGenerator::SyntheticDatasetGenerator(const CameraSystemConstPtr& cameraSystem,
+                                                     uint64_t seed)
+ : k_textureCellSize(0.3)
+ , m_cameraSystem(cameraSystem)
+ , m_duration(30.0)
+ , m_frameRate(20.0)
+ , m_imuRate(200.0)
+ , m_gyroNoiseDensity(1.7e-4)
+ , m_accelNoiseDensity(2.0e-3)
+ , m_attitudeNoise(0.01)
+ , m_imageNoise(2.0)
+ , m_roomSize(16.0, 12.0, 4.0)
+ , m_textureSeed(seed)
+ , m_rng(seed)
+{
+    computeRays();
+}
+
+CameraSystemPtr
+SyntheticDatasetGenerator::createDefaultCameraSystem(void)
+{
+    return SyntheticScene::createStereoCameraSystem();
+}
+
+double&
+SyntheticDatasetGenerator::duration(void)
+{
+    return m_duration;
+}
+
+double&
+SyntheticDatasetGenerator::frameRate(void)
+{
+    return m_frameRate;
+}
+
+double&
+SyntheticDatasetGenerator::imuRate(void)
+{
+    return m_imuRate;
+}
+
+double&
+SyntheticDatasetGenerator::gyroNoiseDensity(void)
+{
+    return m_gyroNoiseDensity;
+}
+
+double&
+SyntheticDatasetGenerator::accelNoiseDensity(void)
+{
+    return m_accelNoiseDensity;
+}
+
+double&
+SyntheticDatasetGenerator::attitudeNoise(void)
+{
+    return m_attitudeNoise;
+}
+
+double&
+SyntheticDatasetGenerator::imageNoise(void)
+{
+    return m_imageNoise;
+}
+
+Eigen::Vector3d&
+SyntheticDatasetGenerator::roomSize(void)
+{
+    return m_roomSize;
+}
+
+bool
+SyntheticDatasetGenerator::generate(const std::string& directory, Dataset& dataset)
+{
+    boost::filesystem::path path(directory);
+
+    Dataset synth;
+    *synth.cameraSystem() = *m_cameraSystem;
+
+    // stamps start at 1 s so that none is zero
+    const double t0 = 1.0;
+
+    // ground truth at the IMU rate
+    size_t imuCount = static_cast<size_t>(m_duration * m_imuRate) + 1;
+    double gyroSigma = m_gyroNoiseDensity * sqrt(m_imuRate);
+    double accelSigma = m_accelNoiseDensity * sqrt(m_imuRate);
+    for (size_t i = 0; i < imuCount; ++i)
+    {
+        double t = i / m_imuRate;
+
+        ros::Time stamp(t0 + t);
+
+        Eigen::Matrix4d H_sys_world;
+        Eigen::Vector3d accel, omega;
+        systemState(t, H_sys_world, accel, omega);
+
+        synth.groundTruth().push_back(StampedPose(stamp, H_sys_world));
+
+        Eigen::Vector3d gyro;
+        imuMeasurement(t, gyro, accel);
+
+        sensor_msgs::ImuPtr imu = boost::make_shared<sensor_msgs::Imu>();
+        imu->header.stamp = stamp;
+        imu->angular_velocity.x = gyro(0) + m_rng.normal(0.0, gyroSigma);
+        imu->angular_velocity.y = gyro(1) + m_rng.normal(0.0, gyroSigma);
+        imu->angular_velocity.z = gyro(2) + m_rng.normal(0.0, gyroSigma);
+        imu->linear_acceleration.x = accel(0) + m_rng.normal(0.0, accelSigma);
+        imu->linear_acceleration.y = accel(1) + m_rng.normal(0.0, accelSigma);
+        imu->linear_acceleration.z = accel(2) + m_rng.normal(0.0, accelSigma);
+
+        Eigen::Vector3d attitudeError(m_rng.normal(0.0, m_attitudeNoise),
+                                      m_rng.normal(0.0, m_attitudeNoise),
+                                      m_rng.normal(0.0, m_attitudeNoise));
+        Eigen::Quaterniond q(Eigen::Matrix3d(H_sys_world.block<3,3>(0,0)) *
+                             AngleAxisToRotationMatrix(attitudeError));
+        imu->orientation.w = q.w();
+        imu->orientation.x = q.x();
+        imu->orientation.y = q.y();
+        imu->orientation.z = q.z();
+
+        synth.imuMeasurements().push_back(imu);
+    }
+
+    for (int i = 0; i < m_cameraSystem->cameraCount(); ++i)
+    {
+        char cameraDir[16];
+        snprintf(cameraDir, sizeof(cameraDir), "cam%d", i);
+
+        boost::filesystem::create_directories(path / "images" / cameraDir);
+    }
+
+    size_t frameCount = static_cast<size_t>(m_duration * m_frameRate);
+    for (size_t i = 0; i < frameCount; ++i)
+    {
+        double t = i / m_frameRate;
+
+        Eigen::Matrix4d H_sys_world;
+        Eigen::Vector3d accel, omega;
+        systemState(t, H_sys_world, accel, omega);
+
+        std::vector<std::string> imageFilenames;
+        for (int j = 0; j < m_cameraSystem->cameraCount(); ++j)
+        {
+            char imageFilename[64];
+            snprintf(imageFilename, sizeof(imageFilename), "images/cam%d/%06lu.png", j, i);
+
+            cv::Mat image;
+            renderImage(j, H_sys_world, image);
+
+            if (!cv::imwrite((path / imageFilename).string(), image))
+            {
+                ROS_ERROR("Failed to write image %s.", imageFilename);
+                return false;
+            }
+
+            imageFilenames.push_back(imageFilename);
+        }
+
+        synth.addFrame(ros::Time(t0 + t), imageFilenames);
+    }
+
+    if (!synth.write(directory))
+    {
+        ROS_ERROR("Failed to write dataset to %s.", directory.c_str());
+        return false;
+    }
+
+    return dataset.read(directory);
+}
+
+void
+SyntheticDatasetGenerator::systemState(double t, Eigen::Matrix4d& H_sys_world,
+                                       Eigen::Vector3d& accel, Eigen::Vector3d& omega) const
+{
+    Eigen::Vector3d velocity;
+    SyntheticTrajectory(m_roomSize, m_duration).state(t, H_sys_world, velocity, accel, omega);
+}
+
+void
+SyntheticDatasetGenerator::imuMeasurement(double t, Eigen::Vector3d& gyro,
+                                          Eigen::Vector3d& accel) const
+{
+    SyntheticTrajectory(m_roomSize, m_duration).imuMeasurement(t, gyro, accel);
+}
+
+void
+SyntheticDatasetGenerator::renderImage(int cameraIdx, const Eigen::Matrix4d& H_sys_world,
+                                       cv::Mat& image)
+{
+    CameraConstPtr camera = m_cameraSystem->getCamera(cameraIdx);
+
+    Eigen::Matrix4d H_cam_world = H_sys_world * m_cameraSystem->getGlobalCameraPose(cameraIdx);
+    Eigen::Matrix3d R = H_cam_world.block<3,3>(0,0);
+    Eigen::Vector3d o = H_cam_world.block<3,1>(0,3);
+
+    Eigen::Vector3d boxMin(-0.5 * m_roomSize(0), -0.5 * m_roomSize(1), 0.0);
+    Eigen::Vector3d boxMax(0.5 * m_roomSize(0), 0.5 * m_roomSize(1), m_roomSize(2));
+
+    const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& rays = m_rays.at(cameraIdx);
+
+    cv::Mat render(camera->imageHeight(), camera->imageWidth(), CV_8UC1);
+    for (int r = 0; r < render.rows; ++r)
+    {
+        unsigned char* row = render.ptr<unsigned char>(r);
+        for (int c = 0; c < render.cols; ++c)
+        {
+            Eigen::Vector3d d = R * rays.at(r * render.cols + c);
+
+            // the ray leaves the box through the nearest of the three
+            // faces it points towards
+            double tHit = std::numeric_limits<double>::max();
+            int face = 0;
+            for (int k = 0; k < 3; ++k)
+            {
+                double tk;
+                if (d(k) > 1e-12)
+                {
+                    tk = (boxMax(k) - o(k)) / d(k);
+                }
+                else if (d(k) < -1e-12)
+                {
+                    tk = (boxMin(k) - o(k)) / d(k);
+                }
+                else
+                {
+                    continue;
+                }
+
+                if (tk < tHit)
+                {
+                    tHit = tk;
+                    face = 2 * k + (d(k) > 0.0 ? 1 : 0);
+                }
+            }
+
+            Eigen::Vector3d P = o + tHit * d;
+
+            int k = face / 2;
+            row[c] = textureValue(face, P((k + 1) % 3), P((k + 2) % 3));
+        }
+    }
+
+    // soften the cell edges as a lens would, then add sensor noise
+    cv::GaussianBlur(render, image, cv::Size(3, 3), 0.8);
+
+    if (m_imageNoise > 0.0)
+    {
+        for (int r = 0; r < image.rows; ++r)
+        {
+            unsigned char* row = image.ptr<unsigned char>(r);
+            for (int c = 0; c < image.cols; ++c)
+            {
+                row[c] = cv::saturate_cast<unsigned char>(row[c] + m_rng.normal(0.0, m_imageNoise));
+            }
+        }
+    }
+}
+
+void
+SyntheticDatasetGenerator::computeRays(void)
+{
+    m_rays.resize(m_cameraSystem->cameraCount());
+
+    for (int i = 0; i < m_cameraSystem->cameraCount(); ++i)
+    {
+        CameraConstPtr camera = m_cameraSystem->getCamera(i);
+
+        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& rays = m_rays.at(i);
+        rays.resize(camera->imageWidth() * camera->imageHeight());
+
+        for (int r = 0; r < camera->imageHeight(); ++r)
+        {
+            for (int c = 0; c < camera->imageWidth(); ++c)
+            {
+                Eigen::Vector3d P;
+                camera->liftSphere(Eigen::Vector2d(c, r), P);
+
+                rays.at(r * camera->imageWidth() + c) = P.normalized();
+            }
+        }
+    }
+}
+
+unsigned char
+SyntheticDatasetGenerator::textureValue(int face, double u, double v) const
+{
+    // a random gray level per square cell, from a hash of the cell
+    int64_t i = static_cast<int64_t>(floor(u / k_textureCellSize));
+    int64_t j = static_cast<int64_t>(floor(v / k_textureCellSize));
+
+    uint64_t z = m_textureSeed + 0x9e3779b97f4a7c15ULL * (face + 1);
+    z ^= static_cast<uint64_t>(i) * 0xbf58476d1ce4e5b9ULL;
+    z ^= static_cast<uint64_t>(j) * 0x94d049bb133111ebULL;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    z ^= z >> 31;
+
+    return static_cast<unsigned char>(20 + z % 216);
+}
+
+}
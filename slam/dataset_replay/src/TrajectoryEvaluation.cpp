@@ -0,0 +1,236 @@
+#include "dataset_replay/TrajectoryEvaluation.h"
+
+#include <algorithm>
+#include <cmath>
+#include <Eigen/Geometry>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace px
+{
+
+StampedPose::StampedPose()
+ : H(Eigen::Matrix4d::Identity())
+{
+
+}
+
+StampedPose::StampedPose(const ros::Time& _stamp, const Eigen::Matrix4d& _H)
+ : stamp(_stamp)
+ , H(_H)
+{
+
+}
+
+ErrorStatistics::ErrorStatistics()
+ : count(0)
+ , rmse(0.0)
+ , mean(0.0)
+ , median(0.0)
+ , max(0.0)
+{
+
+}
+
+void
+ErrorStatistics::compute(std::vector<double> errors)
+{
+    count = errors.size();
+    rmse = 0.0;
+    mean = 0.0;
+    median = 0.0;
+    max = 0.0;
+
+    if (errors.empty())
+    {
+        return;
+    }
+
+    double sumSq = 0.0;
+    for (size_t i = 0; i < errors.size(); ++i)
+    {
+        double e = errors.at(i);
+
+        mean += e;
+        sumSq += e * e;
+        max = std::max(max, e);
+    }
+    mean /= count;
+    rmse = sqrt(sumSq / count);
+
+    std::nth_element(errors.begin(), errors.begin() + count / 2, errors.end());
+    median = errors.at(count / 2);
+}
+
+bool
+readTrajectory(const std::string& filename, Trajectory& trajectory)
+{
+    std::ifstream ifs(filename.c_str());
+    if (!ifs.is_open())
+    {
+        return false;
+    }
+
+    trajectory.clear();
+
+    std::string line;
+    while (std::getline(ifs, line))
+    {
+        if (line.empty() || line.at(0) == '#')
+        {
+            continue;
+        }
+
+        std::istringstream iss(line);
+
+        uint64_t stamp;
+        Eigen::Vector3d t;
+        Eigen::Quaterniond q;
+        if (!(iss >> stamp >> t(0) >> t(1) >> t(2) >> q.x() >> q.y() >> q.z() >> q.w()))
+        {
+            return false;
+        }
+
+        StampedPose pose;
+        pose.stamp.fromNSec(stamp);
+        pose.H.block<3,3>(0,0) = q.normalized().toRotationMatrix();
+        pose.H.block<3,1>(0,3) = t;
+
+        trajectory.push_back(pose);
+    }
+
+    return true;
+}
+
+bool
+writeTrajectory(const std::string& filename, const Trajectory& trajectory)
+{
+    std::ofstream ofs(filename.c_str());
+    if (!ofs.is_open())
+    {
+        return false;
+    }
+
+    ofs << "# stamp_ns tx ty tz qx qy qz qw" << std::endl;
+    ofs << std::fixed << std::setprecision(9);
+    for (size_t i = 0; i < trajectory.size(); ++i)
+    {
+        const StampedPose& pose = trajectory.at(i);
+
+        Eigen::Quaterniond q(pose.H.block<3,3>(0,0));
+        Eigen::Vector3d t = pose.H.block<3,1>(0,3);
+
+        ofs << pose.stamp.toNSec() << " "
+            << t(0) << " " << t(1) << " " << t(2) << " "
+            << q.x() << " " << q.y() << " " << q.z() << " " << q.w() << std::endl;
+    }
+
+    return true;
+}
+
+void
+associateTrajectories(const Trajectory& estimate,
+                      const Trajectory& groundTruth,
+                      double maxTimeDifference,
+                      std::vector<std::pair<size_t,size_t> >& pairs)
+{
+    pairs.clear();
+
+    if (groundTruth.empty())
+    {
+        return;
+    }
+
+    size_t j = 0;
+    for (size_t i = 0; i < estimate.size(); ++i)
+    {
+        const ros::Time& stamp = estimate.at(i).stamp;
+
+        // advance while the next ground-truth pose is at least as close
+        while (j + 1 < groundTruth.size() &&
+               fabs((groundTruth.at(j + 1).stamp - stamp).toSec()) <=
+               fabs((groundTruth.at(j).stamp - stamp).toSec()))
+        {
+            ++j;
+        }
+
+        if (fabs((groundTruth.at(j).stamp - stamp).toSec()) <= maxTimeDifference)
+        {
+            pairs.push_back(std::make_pair(i, j));
+        }
+    }
+}
+
+bool
+computeATE(const Trajectory& estimate,
+           const Trajectory& groundTruth,
+           const std::vector<std::pair<size_t,size_t> >& pairs,
+           ErrorStatistics& translationError,
+           Eigen::Matrix4d& H_align)
+{
+    if (pairs.size() < 3)
+    {
+        return false;
+    }
+
+    Eigen::Matrix3Xd src(3, pairs.size());
+    Eigen::Matrix3Xd dst(3, pairs.size());
+    for (size_t i = 0; i < pairs.size(); ++i)
+    {
+        src.col(i) = estimate.at(pairs.at(i).first).H.block<3,1>(0,3);
+        dst.col(i) = groundTruth.at(pairs.at(i).second).H.block<3,1>(0,3);
+    }
+
+    H_align = Eigen::umeyama(src, dst, false);
+
+    std::vector<double> errors(pairs.size());
+    for (size_t i = 0; i < pairs.size(); ++i)
+    {
+        Eigen::Vector3d P = H_align.block<3,3>(0,0) * src.col(i) + H_align.block<3,1>(0,3);
+
+        errors.at(i) = (P - dst.col(i)).norm();
+    }
+
+    translationError.compute(errors);
+
+    return true;
+}
+
+bool
+computeRPE(const Trajectory& estimate,
+           const Trajectory& groundTruth,
+           const std::vector<std::pair<size_t,size_t> >& pairs,
+           size_t delta,
+           ErrorStatistics& translationError,
+           ErrorStatistics& rotationError)
+{
+    if (delta == 0 || pairs.size() <= delta)
+    {
+        return false;
+    }
+
+    std::vector<double> translationErrors, rotationErrors;
+    for (size_t i = 0; i + delta < pairs.size(); ++i)
+    {
+        const std::pair<size_t,size_t>& p1 = pairs.at(i);
+        const std::pair<size_t,size_t>& p2 = pairs.at(i + delta);
+
+        Eigen::Matrix4d H_est = estimate.at(p1.first).H.inverse() * estimate.at(p2.first).H;
+        Eigen::Matrix4d H_gt = groundTruth.at(p1.second).H.inverse() * groundTruth.at(p2.second).H;
+
+        Eigen::Matrix4d H_err = H_gt.inverse() * H_est;
+
+        translationErrors.push_back(H_err.block<3,1>(0,3).norm());
+
+        Eigen::AngleAxisd aa(Eigen::Matrix3d(H_err.block<3,3>(0,0)));
+        rotationErrors.push_back(fabs(aa.angle()));
+    }
+
+    translationError.compute(translationErrors);
+    rotationError.compute(rotationErrors);
+
+    return true;
+}
+
+}
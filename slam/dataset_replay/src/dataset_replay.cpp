@@ -0,0 +1,213 @@
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/program_options.hpp>
+#include <fstream>
+#include <iomanip>
+#include <ros/ros.h>
+#include <sstream>
+
+#include "cauldron/Profiler.h"
+#include "cauldron/Random.h"
+#include "dataset_replay/Dataset.h"
+#include "dataset_replay/ReplayPipeline.h"
+#include "dataset_replay/Replayer.h"
+#include "dataset_replay/TrajectoryEvaluation.h"
+
+void
+printErrorStatistics(std::ostream& out, const std::string& name,
+                     const px::ErrorStatistics& stats, double scale,
+                     const std::string& unit)
+{
+    out << std::left << std::setw(24) << name << std::right
+        << " count " << std::setw(6) << stats.count
+        << " rmse " << std::setw(10) << stats.rmse * scale
+        << " mean " << std::setw(10) << stats.mean * scale
+        << " median " << std::setw(10) << stats.median * scale
+        << " max " << std::setw(10) << stats.max * scale
+        << " " << unit << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+    std::string datasetDir;
+    std::string pipelineName;
+    double rate;
+    size_t maxFrames;
+    std::string outputDir;
+    std::string vocFilename;
+    int randomSeed;
+    size_t rpeDelta;
+    double maxTimeDifference;
+    bool trace;
+
+    boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("dataset,d", boost::program_options::value<std::string>(&datasetDir), "Dataset directory.")
+        ("pipeline,p", boost::program_options::value<std::string>(&pipelineName)->default_value("gcam_vo"), "gcam_vo, stereo_vo or gcam_slam.")
+        ("rate,r", boost::program_options::value<double>(&rate)->default_value(0.0), "Replay rate as a multiple of real time; 0 replays as fast as possible.")
+        ("max-frames", boost::program_options::value<size_t>(&maxFrames)->default_value(0), "Number of frames to replay; 0 replays all.")
+        ("output,o", boost::program_options::value<std::string>(&outputDir)->default_value("replay"), "Output directory for the trajectory and reports.")
+        ("voc", boost::program_options::value<std::string>(&vocFilename)->default_value("orb.yml.gz"), "Vocabulary file for gcam_slam.")
+        ("seed", boost::program_options::value<int>(&randomSeed)->default_value(0), "Random seed.")
+        ("rpe-delta", boost::program_options::value<size_t>(&rpeDelta)->default_value(10), "Frame distance for the relative pose error.")
+        ("max-dt", boost::program_options::value<double>(&maxTimeDifference)->default_value(0.02), "Maximum time difference in seconds to associate a pose with ground truth.")
+        ("trace", boost::program_options::bool_switch(&trace)->default_value(false), "Write a Chrome trace to the output directory.")
+        ;
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (vm.count("help") || datasetDir.empty())
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    ros::init(argc, argv, "dataset_replay", ros::init_options::AnonymousName);
+
+    px::setRandomSeed(randomSeed);
+
+    px::Dataset dataset;
+    if (!dataset.read(datasetDir))
+    {
+        return 1;
+    }
+
+    ROS_INFO("Read %lu frames and %lu IMU measurements from %s.",
+             dataset.frameCount(), dataset.imuMeasurements().size(),
+             datasetDir.c_str());
+
+    boost::shared_ptr<ros::NodeHandle> nh;
+    px::ReplayPipelinePtr pipeline;
+    if (pipelineName == "gcam_vo")
+    {
+        pipeline = boost::make_shared<px::GCamVOReplayPipeline>(dataset.cameraSystem());
+    }
+    else if (pipelineName == "stereo_vo")
+    {
+        pipeline = boost::make_shared<px::StereoVOReplayPipeline>(dataset.cameraSystem());
+    }
+    else if (pipelineName == "gcam_slam")
+    {
+        if (!ros::master::check())
+        {
+            ROS_ERROR("gcam_slam needs a running ROS master.");
+            return 1;
+        }
+
+        nh = boost::make_shared<ros::NodeHandle>();
+        pipeline.reset(new px::GCamSLAMReplayPipeline(*nh,
+                                                       dataset.cameraSystem(),
+                                                       vocFilename));
+    }
+    else
+    {
+        ROS_ERROR("Unknown pipeline: %s", pipelineName.c_str());
+        return 1;
+    }
+
+    if (!pipeline->init())
+    {
+        ROS_ERROR("Failed to initialize pipeline %s.", pipelineName.c_str());
+        return 1;
+    }
+
+    boost::filesystem::path outputPath(outputDir);
+    boost::filesystem::create_directories(outputPath);
+
+    px::Profiler* profiler = px::Profiler::instance();
+    if (trace)
+    {
+        profiler->startTrace((outputPath / "trace.json").string());
+    }
+
+    px::Replayer replayer(dataset, pipeline, rate);
+
+    ros::WallTime tsStart = ros::WallTime::now();
+    if (!replayer.run(maxFrames))
+    {
+        return 1;
+    }
+    double replayTime = (ros::WallTime::now() - tsStart).toSec();
+
+    if (trace)
+    {
+        profiler->stopTrace();
+    }
+    profiler->collect();
+
+    // trajectory and per-frame timing
+    const px::Trajectory& trajectory = replayer.trajectory();
+    px::writeTrajectory((outputPath / "trajectory.txt").string(), trajectory);
+
+    const std::vector<double>& processingTimes = replayer.processingTimes();
+
+    std::ofstream ofs((outputPath / "timing.txt").string().c_str());
+    ofs << "# frame stamp_ns processing_time_s" << std::endl;
+    for (size_t i = 0; i < processingTimes.size(); ++i)
+    {
+        ofs << i << " " << dataset.frameStamp(i).toNSec() << " "
+            << processingTimes.at(i) << std::endl;
+    }
+    ofs.close();
+
+    // report
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(4);
+
+    report << "pipeline " << pipelineName << ", dataset " << datasetDir << std::endl;
+    report << "frames: " << processingTimes.size()
+           << ", failed: " << replayer.failedFrameCount()
+           << ", late: " << replayer.lateFrameCount() << std::endl;
+    report << "replay time: " << replayTime << " s, "
+           << processingTimes.size() / replayTime << " frames/s" << std::endl;
+
+    px::ErrorStatistics timeStats;
+    timeStats.compute(processingTimes);
+    printErrorStatistics(report, "processing time", timeStats, 1e3, "ms");
+
+    const px::Trajectory& groundTruth = dataset.groundTruth();
+    if (groundTruth.empty())
+    {
+        report << "no ground truth" << std::endl;
+    }
+    else
+    {
+        std::vector<std::pair<size_t,size_t> > pairs;
+        px::associateTrajectories(trajectory, groundTruth, maxTimeDifference, pairs);
+
+        px::ErrorStatistics ate;
+        Eigen::Matrix4d H_align;
+        if (px::computeATE(trajectory, groundTruth, pairs, ate, H_align))
+        {
+            printErrorStatistics(report, "ATE translation", ate, 1.0, "m");
+        }
+        else
+        {
+            report << "ATE: too few poses associated with ground truth" << std::endl;
+        }
+
+        px::ErrorStatistics rpeTranslation, rpeRotation;
+        if (px::computeRPE(trajectory, groundTruth, pairs, rpeDelta,
+                           rpeTranslation, rpeRotation))
+        {
+            std::ostringstream oss;
+            oss << "RPE/" << rpeDelta;
+
+            printErrorStatistics(report, oss.str() + " translation", rpeTranslation, 1.0, "m");
+            printErrorStatistics(report, oss.str() + " rotation", rpeRotation, 180.0 / M_PI, "deg");
+        }
+    }
+
+    report << std::endl << profiler->summary();
+
+    ofs.open((outputPath / "report.txt").string().c_str());
+    ofs << report.str();
+    ofs.close();
+
+    std::cout << report.str();
+
+    return 0;
+}
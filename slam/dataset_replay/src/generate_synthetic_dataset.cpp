@@ -0,0 +1,78 @@
+#include <boost/make_shared.hpp>
+#include <boost/program_options.hpp>
+#include <ros/ros.h>
+
+#include "dataset_replay/SyntheticDatasetGenerator.h"
+
+int main(int argc, char** argv)
+{
+    std::string outputDir;
+    std::string cameraSystemDir;
+    double duration;
+    double frameRate;
+    double imuRate;
+    double attitudeNoise;
+    double imageNoise;
+    int seed;
+
+    boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("output,o", boost::program_options::value<std::string>(&outputDir)->default_value("synthetic"), "Output dataset directory.")
+        ("camera-system,c", boost::program_options::value<std::string>(&cameraSystemDir), "Camera system directory; defaults to two stereo pairs facing forward and backward.")
+        ("duration", boost::program_options::value<double>(&duration)->default_value(30.0), "Duration of one loop in seconds.")
+        ("frame-rate", boost::program_options::value<double>(&frameRate)->default_value(20.0), "Frame rate in Hz.")
+        ("imu-rate", boost::program_options::value<double>(&imuRate)->default_value(200.0), "IMU rate in Hz.")
+        ("attitude-noise", boost::program_options::value<double>(&attitudeNoise)->default_value(0.01), "Standard deviation in radians of the attitude recorded with each IMU sample.")
+        ("image-noise", boost::program_options::value<double>(&imageNoise)->default_value(2.0), "Standard deviation of image noise in gray levels.")
+        ("seed", boost::program_options::value<int>(&seed)->default_value(0), "Seed for the texture and noise.")
+        ;
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    ros::Time::init();
+
+    px::CameraSystemPtr cameraSystem;
+    if (cameraSystemDir.empty())
+    {
+        cameraSystem = px::SyntheticDatasetGenerator::createDefaultCameraSystem();
+    }
+    else
+    {
+        cameraSystem = boost::make_shared<px::CameraSystem>();
+        if (!cameraSystem->readFromDirectory(cameraSystemDir))
+        {
+            ROS_ERROR("Failed to read camera system from %s.", cameraSystemDir.c_str());
+            return 1;
+        }
+    }
+
+    px::SyntheticDatasetGenerator generator(cameraSystem, seed);
+    generator.duration() = duration;
+    generator.frameRate() = frameRate;
+    generator.imuRate() = imuRate;
+    generator.attitudeNoise() = attitudeNoise;
+    generator.imageNoise() = imageNoise;
+
+    ros::WallTime tsStart = ros::WallTime::now();
+
+    px::Dataset dataset;
+    if (!generator.generate(outputDir, dataset))
+    {
+        return 1;
+    }
+
+    ROS_INFO("Generated %lu frames and %lu IMU measurements in %s in %.1f seconds.",
+             dataset.frameCount(), dataset.imuMeasurements().size(),
+             outputDir.c_str(), (ros::WallTime::now() - tsStart).toSec());
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include "cauldron/ImuPreintegration.h"
+#include "dataset_replay/SyntheticDatasetGenerator.h"
+
+namespace px
+{
+
+TEST(SyntheticDatasetGenerator, ImuConsistency)
+{
+    SyntheticDatasetGenerator generator(SyntheticDatasetGenerator::createDefaultCameraSystem());
+
+    const double t_i = 3.0;
+    const double t_j = 4.0;
+    const double dt = 1e-3;
+    const double h = 1e-5;
+
+    // integrate noise-free measurements at the middle of each step
+    ImuPreintegration preintegration;
+    for (double t = t_i; t < t_j - 0.5 * dt; t += dt)
+    {
+        Eigen::Vector3d gyro, accel;
+        generator.imuMeasurement(t + 0.5 * dt, gyro, accel);
+
+        preintegration.integrate(gyro, accel, dt);
+    }
+
+    Eigen::Matrix4d H_i, H_j, H_a, H_b;
+    Eigen::Vector3d a, omega;
+    generator.systemState(t_i, H_i, a, omega);
+    generator.systemState(t_j, H_j, a, omega);
+
+    // velocity by central differences
+    generator.systemState(t_i - h, H_a, a, omega);
+    generator.systemState(t_i + h, H_b, a, omega);
+    Eigen::Vector3d v_i = (H_b.block<3,1>(0,3) - H_a.block<3,1>(0,3)) / (2.0 * h);
+
+    Eigen::Matrix3d R_j;
+    Eigen::Vector3d v_j, p_j;
+    preintegration.predict(H_i.block<3,3>(0,0), v_i, H_i.block<3,1>(0,3),
+                           Eigen::Vector3d(0.0, 0.0, -9.81), R_j, v_j, p_j);
+
+    Eigen::AngleAxisd dR(Eigen::Matrix3d(R_j.transpose() * H_j.block<3,3>(0,0)));
+    EXPECT_LT(fabs(dR.angle()), 1e-4);
+    EXPECT_LT((p_j - H_j.block<3,1>(0,3)).norm(), 1e-3);
+}
+
+TEST(SyntheticDatasetGenerator, Render)
+{
+    CameraSystemPtr cameraSystem = SyntheticDatasetGenerator::createDefaultCameraSystem();
+    SyntheticDatasetGenerator generator(cameraSystem);
+    generator.imageNoise() = 0.0;
+
+    Eigen::Matrix4d H_sys_world;
+    Eigen::Vector3d a, omega;
+    generator.systemState(0.0, H_sys_world, a, omega);
+
+    for (int i = 0; i < cameraSystem->cameraCount(); ++i)
+    {
+        cv::Mat image;
+        generator.renderImage(i, H_sys_world, image);
+
+        ASSERT_EQ(CV_8UC1, image.type());
+        EXPECT_EQ(480, image.rows);
+        EXPECT_EQ(640, image.cols);
+
+        // textured everywhere
+        cv::Scalar mean, stddev;
+        cv::meanStdDev(image, mean, stddev);
+        EXPECT_GT(stddev[0], 20.0);
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include "dataset_replay/TrajectoryEvaluation.h"
+
+namespace px
+{
+
+Trajectory
+createTrajectory(size_t poseCount, double startTime, double interval)
+{
+    Trajectory trajectory;
+    for (size_t i = 0; i < poseCount; ++i)
+    {
+        double t = i * 0.1;
+
+        Eigen::Matrix4d H = Eigen::Matrix4d::Identity();
+        H.block<3,3>(0,0) = Eigen::AngleAxisd(t, Eigen::Vector3d::UnitZ()).toRotationMatrix();
+        H.block<3,1>(0,3) << 3.0 * cos(t), 2.0 * sin(t), 0.5 * sin(2.0 * t);
+
+        trajectory.push_back(StampedPose(ros::Time(startTime + i * interval), H));
+    }
+
+    return trajectory;
+}
+
+TEST(TrajectoryEvaluation, Association)
+{
+    Trajectory groundTruth = createTrajectory(100, 10.0, 0.01);
+    Trajectory estimate = createTrajectory(10, 10.003, 0.1);
+
+    std::vector<std::pair<size_t,size_t> > pairs;
+    associateTrajectories(estimate, groundTruth, 0.005, pairs);
+
+    ASSERT_EQ(10u, pairs.size());
+    for (size_t i = 0; i < pairs.size(); ++i)
+    {
+        EXPECT_EQ(i, pairs.at(i).first);
+        EXPECT_EQ(i * 10, pairs.at(i).second);
+    }
+
+    associateTrajectories(estimate, groundTruth, 0.002, pairs);
+    EXPECT_TRUE(pairs.empty());
+}
+
+TEST(TrajectoryEvaluation, RigidTransform)
+{
+    Trajectory groundTruth = createTrajectory(50, 1.0, 0.05);
+
+    // the same trajectory in a different world frame
+    Eigen::Matrix4d H_world = Eigen::Matrix4d::Identity();
+    H_world.block<3,3>(0,0) = Eigen::AngleAxisd(0.7, Eigen::Vector3d(1.0, 2.0, 3.0).normalized()).toRotationMatrix();
+    H_world.block<3,1>(0,3) << 5.0, -1.0, 2.0;
+
+    Trajectory estimate = groundTruth;
+    for (size_t i = 0; i < estimate.size(); ++i)
+    {
+        estimate.at(i).H = H_world * estimate.at(i).H;
+    }
+
+    std::vector<std::pair<size_t,size_t> > pairs;
+    associateTrajectories(estimate, groundTruth, 0.001, pairs);
+    ASSERT_EQ(50u, pairs.size());
+
+    ErrorStatistics ate;
+    Eigen::Matrix4d H_align;
+    ASSERT_TRUE(computeATE(estimate, groundTruth, pairs, ate, H_align));
+    EXPECT_NEAR(0.0, ate.rmse, 1e-9);
+    EXPECT_TRUE((H_align * H_world).isIdentity(1e-9));
+
+    ErrorStatistics rpeTranslation, rpeRotation;
+    ASSERT_TRUE(computeRPE(estimate, groundTruth, pairs, 5, rpeTranslation, rpeRotation));
+    EXPECT_EQ(45u, rpeTranslation.count);
+    EXPECT_NEAR(0.0, rpeTranslation.max, 1e-9);
+    EXPECT_NEAR(0.0, rpeRotation.max, 1e-9);
+}
+
+TEST(TrajectoryEvaluation, Drift)
+{
+    Trajectory groundTruth = createTrajectory(50, 1.0, 0.05);
+
+    // a constant error of 1 cm in every relative motion
+    Trajectory estimate = groundTruth;
+    for (size_t i = 1; i < estimate.size(); ++i)
+    {
+        Eigen::Matrix4d H_rel = groundTruth.at(i - 1).H.inverse() * groundTruth.at(i).H;
+        H_rel(0,3) += 0.01;
+
+        estimate.at(i).H = estimate.at(i - 1).H * H_rel;
+    }
+
+    std::vector<std::pair<size_t,size_t> > pairs;
+    associateTrajectories(estimate, groundTruth, 0.001, pairs);
+
+    ErrorStatistics rpeTranslation, rpeRotation;
+    ASSERT_TRUE(computeRPE(estimate, groundTruth, pairs, 1, rpeTranslation, rpeRotation));
+    EXPECT_NEAR(0.01, rpeTranslation.rmse, 1e-9);
+    EXPECT_NEAR(0.01, rpeTranslation.median, 1e-9);
+    EXPECT_NEAR(0.0, rpeRotation.max, 1e-9);
+
+    ErrorStatistics ate;
+    Eigen::Matrix4d H_align;
+    ASSERT_TRUE(computeATE(estimate, groundTruth, pairs, ate, H_align));
+    EXPECT_GT(ate.rmse, 0.01);
+    EXPECT_GE(ate.max, ate.rmse);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
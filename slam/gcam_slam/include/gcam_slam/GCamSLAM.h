@@ -1,6 +1,8 @@
 #ifndef GCAMSLAM_H
 #define GCAMSLAM_H
 
+#include <boost/thread.hpp>
+#include <deque>
 #include <ros/ros.h>
 #include <sensor_msgs/Imu.h>
 
@@ -12,14 +14,25 @@ namespace px
 
 class GCamDWBA;
 class GCamVO;
+class MapManager;
 class OrbLocationRecognition;
 class SparseGraphViz;
 
+// Loop closures are found on a persistent background thread with its own
+// queue of key frame sets, so that tracking never waits for place
+// recognition or geometric verification. The map mutex guards the map:
+// the background thread only holds it to copy the candidates proposed by
+// location recognition. Visual odometry holds it while it links the new
+// frame set to the key frame sets and their scene points, and
+// processFrames() holds it while it integrates the loop closures found so
+// far, optimizes and adds key frame sets. The map is visualized on another
+// background thread at a limited rate.
 class GCamSLAM
 {
 public:
     GCamSLAM(ros::NodeHandle& nh,
              const CameraSystemConstPtr& cameraSystem);
+    ~GCamSLAM();
 
     bool init(const std::string& detectorType,
               const std::string& descriptorExtractorType,
@@ -31,18 +44,76 @@ public:
                        const std::vector<cv::Mat>& imageVec,
                        const sensor_msgs::ImuConstPtr& imu);
 
+    // Writes the oldest segments of key frame sets to directory while more
+    // than maxResidentSegmentCount are in memory, and reads them back for
+    // loop closure.
+    bool setMapSpilling(const std::string& directory, int maxResidentSegmentCount);
+
+    // forwards to GCamVO::addImuMeasurement
+    void addImuMeasurement(const sensor_msgs::ImuConstPtr& imu);
+
+    // pose of the last processed frame set with respect to the world frame
+    bool getCurrentPose(Eigen::Matrix4d& pose) const;
+
     bool writePosesToTextFile(const std::string& filename, bool wrtWorld = false) const;
     bool writeScenePointsToTextFile(const std::string& filename) const;
 
 private:
-    void findLoopClosures(std::vector<std::pair<LoopClosureEdge,LoopClosureEdge> >& edges);
+    struct LoopClosureQuery
+    {
+        FrameSetPtr frameSet;
+        // per stereo pair, tags of reloaded frames to match instead of
+        // querying location recognition
+        std::vector<std::vector<FrameTag> > reloadedMatches;
+    };
+
+    // copy of a frame proposed by location recognition, taken while
+    // holding the map mutex
+    struct LoopClosureCandidate
+    {
+        EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+        FrameTag tag;
+        FrameConstPtr frame;
+        cv::Mat dtors;
+        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > scenePoints;
+        Eigen::Matrix4d systemPose;
+    };
+
+    struct LoopClosureResult
+    {
+        FrameSetPtr frameSet;
+        // per stereo pair
+        std::vector<std::pair<LoopClosureEdge,LoopClosureEdge> > edges;
+        std::vector<FrameTag> matchTags;
+        // tags of the similar frames that were culled or spilled
+        std::vector<std::vector<FrameTag> > removedMatches;
+    };
+
+    void loopClosureThread(void);
+    void stopLoopClosureThread(void);
+    void queueLoopClosureQuery(const LoopClosureQuery& query);
+
+    // call with the map mutex held
+    void integrateLoopClosures(void);
+    void integrateLoopClosure(const LoopClosureResult& result);
+
+    void findLoopClosures(const LoopClosureQuery& query,
+                          LoopClosureResult& result);
     void findLoopClosuresHelper(const FrameConstPtr& frameQuery,
-                                std::pair<LoopClosureEdge,LoopClosureEdge>& edge);
+                                const std::vector<FrameTag>& reloadedMatches,
+                                std::pair<LoopClosureEdge,LoopClosureEdge>& edge,
+                                FrameTag& matchTag,
+                                std::vector<FrameTag>& removedMatches);
+    void matchLoopClosure(const FrameConstPtr& frameQuery,
+                          const std::vector<LoopClosureCandidate, Eigen::aligned_allocator<LoopClosureCandidate> >& candidates,
+                          std::pair<LoopClosureEdge,LoopClosureEdge>& edge,
+                          FrameTag& matchTag);
 
     void getDescriptorMat(const FrameConstPtr& frame, cv::Mat& dmat) const;
 
-    void solveP3PRansac(const FrameConstPtr& frame1,
-                        const FrameConstPtr& frame2,
+    void solveP3PRansac(const LoopClosureCandidate& candidate,
+                        const FrameConstPtr& frameQuery,
                         const std::vector<cv::DMatch>& matches,
                         Eigen::Matrix4d& H,
                         std::vector<cv::DMatch>& inliers) const;
@@ -55,14 +126,28 @@ private:
     boost::shared_ptr<SparseGraphViz> m_sgv;
     ros::Publisher m_posePub;
     boost::shared_ptr<OrbLocationRecognition> m_locRec;
+    boost::shared_ptr<MapManager> m_mapManager;
     boost::shared_ptr<GCamDWBA> m_dwba;
 
-    FrameSetPtr m_frameSetKey;
+    FrameSetPtr m_frameSetCurr;
+
+    mutable boost::mutex m_mapMutex;
+
+    std::deque<LoopClosureQuery> m_loopClosureQueries;
+    std::deque<LoopClosureResult> m_loopClosureResults;
+    boost::mutex m_loopClosureMutex;
+    boost::condition_variable m_loopClosureCond;
+    bool m_loopClosureThreadRunning;
+    boost::shared_ptr<boost::thread> m_loopClosureThread;
 
     size_t k_minVOCorrespondenceCount;
     size_t k_minLoopCorrespondenceCount;
     int k_nLocationMatches;
     double k_sphericalErrorThresh;
+    // the oldest queries are dropped beyond this
+    size_t k_maxLoopClosureQueueSize;
+    // maximum rate of visualization updates [Hz]
+    double k_vizRate;
 };
 
 }
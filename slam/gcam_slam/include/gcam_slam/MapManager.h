@@ -0,0 +1,141 @@
+#ifndef MAPMANAGER_H
+#define MAPMANAGER_H
+
+#include <deque>
+#include <string>
+
+#include "camera_systems/CameraSystem.h"
+#include "sparse_graph/SparseGraph.h"
+
+namespace px
+{
+
+class OrbLocationRecognition;
+
+// Keeps the key frame set map of a long run within bounded memory.
+// Segment 0 of the sparse graph holds the resident key frame sets in
+// keying order. As each key frame set is added, the map manager
+//
+// - merges scene points that its covisible key frame sets observe as
+//   duplicates of the scene points it observes,
+// - culls covisible key frame sets whose scene points are nearly all
+//   observed by enough other key frame sets (Mur-Artal et al., 2015),
+// - strips descriptors from the frames of older key frame sets that
+//   location recognition never queries, and all images, and
+// - if a spill directory is set, writes the least recently covisible
+//   segment of key frame sets to disk once too many are resident.
+//
+// Spilled segments are read back on demand when location recognition
+// proposes one of their frames for loop closure. Only call the map
+// manager while no other thread reads the sparse graph.
+class MapManager
+{
+public:
+    MapManager(const CameraSystemConstPtr& cameraSystem,
+               const SparseGraphPtr& sparseGraph,
+               const boost::shared_ptr<OrbLocationRecognition>& locRec = boost::shared_ptr<OrbLocationRecognition>());
+
+    // number of key frame sets per segment
+    int& segmentSize(void);
+    // segments kept in memory when spilling; 0 keeps all of them
+    int& maxResidentSegmentCount(void);
+    // the newest key frame sets are never culled
+    int& protectedKeyFrameSetCount(void);
+    // a key frame set is culled if at least this fraction of its scene
+    // points is observed by at least redundantObservationCount() other
+    // key frame sets
+    double& redundancyRatio(void);
+    int& redundantObservationCount(void);
+
+    // creates the directory; an empty directory disables spilling
+    bool setSpillDirectory(const std::string& directory);
+
+    // Adds the newest key frame set to segment 0 and maintains the map
+    // around it.
+    void addKeyFrameSet(const FrameSetPtr& frameSet);
+
+    // Returns the frames with the given location recognition tags,
+    // reading back spilled segments that contain them. Frames of culled
+    // key frame sets are skipped.
+    bool reloadFrames(const std::vector<FrameTag>& tags,
+                      std::vector<FrameConstPtr>& frames);
+
+    // system poses of all key frame sets that were not culled, spilled
+    // or not, in keying order
+    void getSystemPoses(std::vector<PoseConstPtr>& poses) const;
+
+    // whether the key frame set is in segment 0, neither culled nor
+    // spilled
+    bool isResident(const FrameSet* frameSet) const;
+
+    size_t residentKeyFrameSetCount(void) const;
+    size_t spilledKeyFrameSetCount(void) const;
+    size_t culledKeyFrameSetCount(void) const;
+    size_t mergedScenePointCount(void) const;
+
+    // Moves the observations of scenePoint2 to scenePoint1.
+    static void mergeScenePoints(const Point3DFeaturePtr& scenePoint1,
+                                 const Point3DFeaturePtr& scenePoint2);
+
+private:
+    struct Segment
+    {
+        Segment();
+
+        size_t firstSeq;
+        size_t keyFrameSetCount;
+        size_t lastAccess;
+        bool spilled;
+        // system poses of the key frame sets while spilled
+        std::vector<PosePtr> systemPoses;
+    };
+
+    void findCovisibleFrameSets(FrameSet* frameSet,
+                                std::vector<FrameSet*>& covisibleFrameSets) const;
+
+    void fuseScenePoints(FrameSet* frameSet,
+                         const std::vector<FrameSet*>& covisibleFrameSets);
+    bool isRedundant(FrameSet* frameSet) const;
+    void cullFrameSet(FrameSet* frameSet);
+
+    void stripFrameSet(FrameSet* frameSet) const;
+
+    int segmentId(size_t seq) const;
+    std::string segmentFilename(int segmentId) const;
+    bool spillSegment(int segmentId);
+    bool reloadSegment(int segmentId);
+
+    bool isProtected(const FrameSet* frameSet) const;
+    void detachFrameSet(FrameSet* frameSet) const;
+    void removeFromLocationRecognition(FrameSet* frameSet) const;
+
+    CameraSystemConstPtr m_cameraSystem;
+    SparseGraphPtr m_sparseGraph;
+    boost::shared_ptr<OrbLocationRecognition> m_locRec;
+
+    std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > m_H_cam_sys;
+
+    std::string m_spillDirectory;
+    std::vector<Segment> m_segments;
+    // sequence numbers of the protected key frame sets
+    std::deque<size_t> m_recentSeqs;
+
+    size_t m_keyFrameSetCount;
+    size_t m_spilledKeyFrameSetCount;
+    size_t m_culledKeyFrameSetCount;
+    size_t m_mergedScenePointCount;
+
+    int k_segmentSize;
+    int k_maxResidentSegmentCount;
+    int k_protectedKeyFrameSetCount;
+    double k_redundancyRatio;
+    int k_redundantObservationCount;
+    size_t k_maxCovisibleFrameSetCount;
+    double k_fusionRayThresh;
+    double k_fusionDistanceRatio;
+    int k_maxDescriptorDistance;
+};
+
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include "camera_models/CostFunctionFactory.h"
 #include "cauldron/EigenQuaternionParameterization.h"
 #include "cauldron/EigenUtils.h"
+#include "cauldron/Profiler.h"
 #include "ceres/ceres.h"
 #include "PoseGraphError.h"
 
@@ -74,6 +75,8 @@ sortFunction(std::pair<size_t, FrameSet*> x, std::pair<size_t, FrameSet*> y)
 void
 GCamDWBA::optimize(FrameSetPtr& refFrameSet)
 {
+    PX_PROFILE_SCOPE("gcam_slam.double_window_ba");
+
     // construct double windows
     int N = k_M1 + k_M2;
 
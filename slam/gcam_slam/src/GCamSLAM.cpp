@@ -1,14 +1,18 @@
 #include "gcam_slam/GCamSLAM.h"
 
+#include <algorithm>
 #include <boost/make_shared.hpp>
 #include <boost/unordered_set.hpp>
 #include <geometry_msgs/PoseWithCovarianceStamped.h>
 
 #include "cauldron/EigenUtils.h"
+#include "cauldron/Profiler.h"
+#include "cauldron/Random.h"
 #include "gcam_slam/GCamDWBA.h"
+#include "gcam_slam/MapManager.h"
 #include "gcam_vo/GCamVO.h"
 #include "location_recognition/OrbLocationRecognition.h"
-#include "pose_estimation/P3P.h"
+#include "pose_estimation/AbsolutePoseBatch.h"
 #include "sparse_graph/SparseGraphViz.h"
 
 namespace px
@@ -20,12 +24,24 @@ GCamSLAM::GCamSLAM(ros::NodeHandle& nh,
  , m_cameraSystem(cameraSystem)
  , m_vo(boost::make_shared<GCamVO>(boost::ref(cameraSystem), false, false))
  , m_sparseGraph(boost::make_shared<SparseGraph>())
+ , m_locRec(boost::make_shared<OrbLocationRecognition>())
+ , m_loopClosureThreadRunning(false)
  , k_minVOCorrespondenceCount(50)
  , k_minLoopCorrespondenceCount(15)
  , k_nLocationMatches(5)
  , k_sphericalErrorThresh(0.999976)
+ , k_maxLoopClosureQueueSize(5)
+ , k_vizRate(2.0)
 {
     m_sgv = boost::make_shared<SparseGraphViz>(boost::ref(nh), m_sparseGraph);
+    m_mapManager = boost::make_shared<MapManager>(boost::ref(cameraSystem), boost::ref(m_sparseGraph), boost::ref(m_locRec));
+}
+
+GCamSLAM::~GCamSLAM()
+{
+    // both threads hold the map mutex at times
+    m_sgv->stopThread();
+    stopLoopClosureThread();
 }
 
 bool
@@ -42,20 +58,41 @@ GCamSLAM::init(const std::string& detectorType,
         return false;
     }
 
+    // visual odometry links new frame sets into the key frame sets of
+    // the map
+    m_vo->setMapMutex(m_mapMutex);
+
     m_posePub = m_nh.advertise<geometry_msgs::PoseWithCovarianceStamped>(poseTopicName, 2);
 
     cv::Size imageSize;
     imageSize.width = m_cameraSystem->getCamera(0)->imageWidth();
     imageSize.height = m_cameraSystem->getCamera(0)->imageHeight();
 
-    m_locRec = boost::make_shared<OrbLocationRecognition>();
     m_locRec->setup(vocFilename);
 
     m_dwba = boost::make_shared<GCamDWBA>(boost::ref(m_nh), boost::ref(m_cameraSystem), 15, 50);
 
+    if (!m_loopClosureThread)
+    {
+        m_loopClosureThreadRunning = true;
+        m_loopClosureThread = boost::make_shared<boost::thread>(boost::bind(&GCamSLAM::loopClosureThread, this));
+    }
+
+    m_sgv->startThread(m_mapMutex, k_vizRate);
+
     return true;
 }
 
+bool
+GCamSLAM::setMapSpilling(const std::string& directory, int maxResidentSegmentCount)
+{
+    boost::mutex::scoped_lock lock(m_mapMutex);
+
+    m_mapManager->maxResidentSegmentCount() = maxResidentSegmentCount;
+
+    return m_mapManager->setSpillDirectory(directory);
+}
+
 bool
 GCamSLAM::processFrames(const ros::Time& stamp,
                         const std::vector<cv::Mat>& imageVec,
@@ -66,109 +103,26 @@ GCamSLAM::processFrames(const ros::Time& stamp,
         return false;
     }
 
-    // find loop closure edges
-    boost::shared_ptr<boost::thread> loopClosureThread;
-    std::vector<std::pair<LoopClosureEdge,LoopClosureEdge> > edges;
-    if (m_frameSetKey)
-    {
-        loopClosureThread = boost::make_shared<boost::thread>(boost::bind(&GCamSLAM::findLoopClosures,
-                                                                          this,
-                                                                          boost::ref(edges)));
-    }
-
-    boost::shared_ptr<boost::thread> vizThread;
-    if (!m_sparseGraph->frameSetSegment(0).empty())
-    {
-        vizThread = boost::make_shared<boost::thread>(&SparseGraphViz::visualize, m_sgv.get(), 0);
-    }
+    PX_PROFILE_SCOPE("gcam_slam.process_frames");
 
     px::FrameSetPtr frameSet;
     bool success = m_vo->processFrames(stamp, imageVec, imu, frameSet);
 
-    if (loopClosureThread)
-    {
-        loopClosureThread->join();
-    }
-    if (vizThread)
-    {
-        vizThread->join();
-    }
-
     if (!success)
     {
         return false;
     }
 
-    if (m_frameSetKey)
-    {
-        // add loop closure edges to graph
-
-        int nStereoCams = m_cameraSystem->cameraCount() / 2;
-
-        for (int i = 0; i < nStereoCams; ++i)
-        {
-            if (edges.at(i).first.inFrame() == 0)
-            {
-                continue;
-            }
-
-            FramePtr& frameQuery = m_frameSetKey->frames().at(i * 2);
-
-            frameQuery->loopClosureEdges().push_back(edges.at(i).first);
-
-            Frame* frameMatch = edges.at(i).first.inFrame();
-
-            frameMatch->loopClosureEdges().push_back(edges.at(i).second);
-
-            // merge pairs of scene points
-            const std::vector<size_t>& inMatchIds = edges.at(i).first.inMatchIds();
-            const std::vector<size_t>& outMatchIds = edges.at(i).first.outMatchIds();
-
-            for (size_t j = 0; j < inMatchIds.size(); ++j)
-            {
-                Point3DFeaturePtr& scenePoint1 = frameQuery->features2D().at(outMatchIds.at(j))->feature3D();
-                Point3DFeaturePtr& scenePoint2 = frameMatch->features2D().at(inMatchIds.at(j))->feature3D();
-
-                if (scenePoint1 == scenePoint2)
-                {
-                    continue;
-                }
-
-                for (size_t k = 0; k < scenePoint2->features2D().size(); ++k)
-                {
-                    Point2DFeature* feature2 = scenePoint2->features2D().at(k);
-
-                    bool found = false;
-                    for (size_t l = 0; l < scenePoint1->features2D().size(); ++l)
-                    {
-                        Point2DFeature* feature1 = scenePoint1->features2D().at(l);
-
-                        if (feature1 == feature2)
-                        {
-                            found = true;
-                            break;
-                        }
-                    }
-
-                    if (!found)
-                    {
-                        scenePoint1->features2D().push_back(feature2);
-                    }
-                }
-
-                for (size_t k = 0; k < scenePoint1->features2D().size(); ++k)
-                {
-                    Point2DFeature* feature = scenePoint1->features2D().at(k);
-                    feature->feature3D() = scenePoint1;
-                }
-            }
-        }
+    // the loop closure and visualization threads hold the map only to
+    // copy from it; visual odometry held it while it linked frameSet
+    boost::mutex::scoped_lock mapLock(m_mapMutex);
 
-        m_frameSetKey.reset();
-    }
+    integrateLoopClosures();
 
     m_dwba->optimize(frameSet);
 
+    m_frameSetCurr = frameSet;
+
     Eigen::Quaterniond q = frameSet->systemPose()->rotation().conjugate();
     Eigen::Vector3d t = q * (- frameSet->systemPose()->translation());
 
@@ -189,10 +143,33 @@ GCamSLAM::processFrames(const ros::Time& stamp,
     {
         m_vo->keyCurrentFrameSet();
 
-        m_sparseGraph->frameSetSegment(0).push_back(frameSet);
+        m_mapManager->addKeyFrameSet(frameSet);
 
-        m_frameSetKey = frameSet;
+        LoopClosureQuery query;
+        query.frameSet = frameSet;
+        queueLoopClosureQuery(query);
     }
+
+    return true;
+}
+
+void
+GCamSLAM::addImuMeasurement(const sensor_msgs::ImuConstPtr& imu)
+{
+    m_vo->addImuMeasurement(imu);
+}
+
+bool
+GCamSLAM::getCurrentPose(Eigen::Matrix4d& pose) const
+{
+    if (!m_frameSetCurr)
+    {
+        return false;
+    }
+
+    pose = invertHomogeneousTransform(m_frameSetCurr->systemPose()->toMatrix());
+
+    return true;
 }
 
 bool
@@ -206,10 +183,13 @@ GCamSLAM::writePosesToTextFile(const std::string& filename, bool wrtWorld) const
 
     ofs << std::fixed << std::setprecision(20);
 
-    const std::vector<FrameSetPtr>& frameSets = m_sparseGraph->frameSetSegment(0);
-    for (size_t i = 0; i < frameSets.size(); ++i)
+    boost::mutex::scoped_lock lock(m_mapMutex);
+
+    std::vector<PoseConstPtr> poses;
+    m_mapManager->getSystemPoses(poses);
+    for (size_t i = 0; i < poses.size(); ++i)
     {
-        const PosePtr& pose = frameSets.at(i)->systemPose();
+        const PoseConstPtr& pose = poses.at(i);
 
         Eigen::Quaterniond q;
         Eigen::Vector3d t;
@@ -252,6 +232,8 @@ GCamSLAM::writeScenePointsToTextFile(const std::string& filename) const
 
     ofs << std::fixed << std::setprecision(20);
 
+    boost::mutex::scoped_lock lock(m_mapMutex);
+
     boost::unordered_set<Point3DFeature*> scenePoints;
     const std::vector<FrameSetPtr>& frameSets = m_sparseGraph->frameSetSegment(0);
     for (size_t i = 0; i < frameSets.size(); ++i)
@@ -294,25 +276,220 @@ GCamSLAM::writeScenePointsToTextFile(const std::string& filename) const
 }
 
 void
-GCamSLAM::findLoopClosures(std::vector<std::pair<LoopClosureEdge,LoopClosureEdge> >& edges)
+GCamSLAM::loopClosureThread(void)
 {
+    while (true)
+    {
+        LoopClosureQuery query;
+        {
+            boost::unique_lock<boost::mutex> lock(m_loopClosureMutex);
+
+            while (m_loopClosureThreadRunning && m_loopClosureQueries.empty())
+            {
+                m_loopClosureCond.wait(lock);
+            }
+
+            if (!m_loopClosureThreadRunning)
+            {
+                break;
+            }
+
+            query = m_loopClosureQueries.front();
+            m_loopClosureQueries.pop_front();
+        }
+
+        LoopClosureResult result;
+        findLoopClosures(query, result);
+
+        {
+            // swapped in so that this thread keeps no reference to the
+            // frame set once the result can be integrated
+            boost::lock_guard<boost::mutex> lock(m_loopClosureMutex);
+            m_loopClosureResults.push_back(LoopClosureResult());
+            std::swap(m_loopClosureResults.back(), result);
+        }
+
+        // The frame set may have been culled while the query ran. Its
+        // destructor then unlinks its features from the shared scene
+        // points, which must happen under the map mutex.
+        boost::lock_guard<boost::mutex> lock(m_mapMutex);
+        query = LoopClosureQuery();
+    }
+}
+
+void
+GCamSLAM::stopLoopClosureThread(void)
+{
+    if (!m_loopClosureThread)
+    {
+        return;
+    }
+
+    {
+        boost::lock_guard<boost::mutex> lock(m_loopClosureMutex);
+        m_loopClosureThreadRunning = false;
+    }
+    m_loopClosureCond.notify_one();
+
+    m_loopClosureThread->join();
+    m_loopClosureThread.reset();
+}
+
+void
+GCamSLAM::queueLoopClosureQuery(const LoopClosureQuery& query)
+{
+    {
+        boost::lock_guard<boost::mutex> lock(m_loopClosureMutex);
+
+        // when loop closure falls behind, the newest key frame sets are
+        // the most useful to query
+        if (m_loopClosureQueries.size() >= k_maxLoopClosureQueueSize)
+        {
+            m_loopClosureQueries.pop_front();
+
+            Profiler::instance()->addCount("gcam_slam.loop_closure_queries_dropped");
+        }
+
+        m_loopClosureQueries.push_back(query);
+    }
+    m_loopClosureCond.notify_one();
+}
+
+void
+GCamSLAM::integrateLoopClosures(void)
+{
+    std::deque<LoopClosureResult> results;
+    {
+        boost::lock_guard<boost::mutex> lock(m_loopClosureMutex);
+        results.swap(m_loopClosureResults);
+    }
+
+    if (results.empty())
+    {
+        return;
+    }
+
+    PX_PROFILE_SCOPE("gcam_slam.map_integration");
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        integrateLoopClosure(results.at(i));
+    }
+}
+
+void
+GCamSLAM::integrateLoopClosure(const LoopClosureResult& result)
+{
+    // the key frame set was culled while its query was processed
+    if (!m_mapManager->isResident(result.frameSet.get()))
+    {
+        return;
+    }
+
     int nStereoCams = m_cameraSystem->cameraCount() / 2;
 
-    edges.clear();
-    edges.resize(nStereoCams);
+    // read back spilled key frame sets that location recognition proposed
+    // and match them on the loop closure thread
+    LoopClosureQuery query;
+    for (int i = 0; i < nStereoCams; ++i)
+    {
+        if (result.edges.at(i).first.inFrame() != 0 || result.removedMatches.at(i).empty())
+        {
+            continue;
+        }
+
+        std::vector<FrameConstPtr> frameMatches;
+        if (m_mapManager->reloadFrames(result.removedMatches.at(i), frameMatches))
+        {
+            query.reloadedMatches.resize(nStereoCams);
+            query.reloadedMatches.at(i) = result.removedMatches.at(i);
+        }
+    }
 
-    std::vector<boost::shared_ptr<boost::thread> > threads(nStereoCams);
+    if (!query.reloadedMatches.empty())
+    {
+        query.frameSet = result.frameSet;
+        queueLoopClosureQuery(query);
+    }
+
+    // add loop closure edges to graph
     for (int i = 0; i < nStereoCams; ++i)
     {
-        FramePtr& frameQuery = m_frameSetKey->frames().at(i * 2);
+        const std::pair<LoopClosureEdge,LoopClosureEdge>& edge = result.edges.at(i);
 
-        threads.at(i) = boost::make_shared<boost::thread>(boost::bind(&GCamSLAM::findLoopClosuresHelper,
-                                                                      this,
-                                                                      frameQuery,
-                                                                      boost::ref(edges.at(i))));
+        if (edge.first.inFrame() == 0)
+        {
+            continue;
+        }
+
+        // the matched key frame set was culled or spilled since
+        if (m_locRec->findFrame(result.matchTags.at(i)).get() != edge.first.inFrame())
+        {
+            continue;
+        }
+
+        FramePtr& frameQuery = result.frameSet->frames().at(i * 2);
+
+        frameQuery->loopClosureEdges().push_back(edge.first);
+
+        Frame* frameMatch = edge.first.inFrame();
+
+        frameMatch->loopClosureEdges().push_back(edge.second);
+
+        // merge pairs of scene points
+        const std::vector<size_t>& inMatchIds = edge.first.inMatchIds();
+        const std::vector<size_t>& outMatchIds = edge.first.outMatchIds();
+
+        for (size_t j = 0; j < inMatchIds.size(); ++j)
+        {
+            Point3DFeaturePtr& scenePoint1 = frameQuery->features2D().at(outMatchIds.at(j))->feature3D();
+            Point3DFeaturePtr& scenePoint2 = frameMatch->features2D().at(inMatchIds.at(j))->feature3D();
+
+            MapManager::mergeScenePoints(scenePoint1, scenePoint2);
+        }
     }
+}
+
+void
+GCamSLAM::findLoopClosures(const LoopClosureQuery& query,
+                           LoopClosureResult& result)
+{
+    PX_PROFILE_SCOPE("gcam_slam.loop_closure");
 
+    int nStereoCams = m_cameraSystem->cameraCount() / 2;
+
+    result.frameSet = query.frameSet;
+    result.edges.clear();
+    result.edges.resize(nStereoCams);
+    result.matchTags.clear();
+    result.matchTags.resize(nStereoCams);
+    result.removedMatches.clear();
+    result.removedMatches.resize(nStereoCams);
+
+    std::vector<boost::shared_ptr<boost::thread> > threads;
     for (int i = 0; i < nStereoCams; ++i)
+    {
+        const FramePtr& frameQuery = query.frameSet->frames().at(i * 2);
+
+        if (query.reloadedMatches.empty())
+        {
+            threads.push_back(boost::make_shared<boost::thread>(boost::bind(&GCamSLAM::findLoopClosuresHelper,
+                                                                            this,
+                                                                            frameQuery,
+                                                                            std::vector<FrameTag>(),
+                                                                            boost::ref(result.edges.at(i)),
+                                                                            boost::ref(result.matchTags.at(i)),
+                                                                            boost::ref(result.removedMatches.at(i)))));
+        }
+        else if (!query.reloadedMatches.at(i).empty())
+        {
+            findLoopClosuresHelper(frameQuery, query.reloadedMatches.at(i),
+                                   result.edges.at(i), result.matchTags.at(i),
+                                   result.removedMatches.at(i));
+        }
+    }
+
+    for (size_t i = 0; i < threads.size(); ++i)
     {
         threads.at(i)->join();
     }
@@ -320,34 +497,94 @@ GCamSLAM::findLoopClosures(std::vector<std::pair<LoopClosureEdge,LoopClosureEdge
 
 void
 GCamSLAM::findLoopClosuresHelper(const FrameConstPtr& frameQuery,
-                                 std::pair<LoopClosureEdge,LoopClosureEdge>& edge)
+                                 const std::vector<FrameTag>& reloadedMatches,
+                                 std::pair<LoopClosureEdge,LoopClosureEdge>& edge,
+                                 FrameTag& matchTag,
+                                 std::vector<FrameTag>& removedMatches)
 {
-    cv::BFMatcher descriptorMatcher(cv::NORM_HAMMING, true);
+    std::vector<FrameTag> tags = reloadedMatches;
+    if (tags.empty())
+    {
+        // place recognition only reads the descriptors of the query frame,
+        // which the map manager does not strip, so it needs no map mutex
+        uint64_t tsRecognition = Profiler::now();
+        m_locRec->detectSimilarLocations(frameQuery, k_nLocationMatches, tags);
+        Profiler::instance()->addTimer("gcam_slam.place_recognition", tsRecognition, Profiler::now());
+    }
 
-    std::vector<FrameConstPtr> frameMatches;
-    if (!m_locRec->detectSimilarLocations(frameQuery, k_nLocationMatches,
-                                          frameMatches))
+    std::vector<LoopClosureCandidate, Eigen::aligned_allocator<LoopClosureCandidate> > candidates;
+    {
+        boost::mutex::scoped_lock lock(m_mapMutex);
+
+        // the key frame set was culled before location recognition added
+        // it
+        if (!m_mapManager->isResident(frameQuery->frameSet()))
+        {
+            m_locRec->removeFrame(frameQuery);
+            return;
+        }
+
+        for (size_t i = 0; i < tags.size(); ++i)
+        {
+            FrameConstPtr frameMatch = m_locRec->findFrame(tags.at(i));
+            if (!frameMatch)
+            {
+                // reloaded frames may have been spilled again
+                if (reloadedMatches.empty())
+                {
+                    removedMatches.push_back(tags.at(i));
+                }
+                continue;
+            }
+
+            candidates.push_back(LoopClosureCandidate());
+
+            LoopClosureCandidate& candidate = candidates.back();
+            candidate.tag = tags.at(i);
+            candidate.frame = frameMatch;
+            candidate.systemPose = frameMatch->frameSet()->systemPose()->toMatrix();
+
+            getDescriptorMat(frameMatch, candidate.dtors);
+
+            const std::vector<Point2DFeaturePtr>& features = frameMatch->features2D();
+            candidate.scenePoints.resize(features.size());
+            for (size_t j = 0; j < features.size(); ++j)
+            {
+                candidate.scenePoints.at(j) = features.at(j)->feature3D()->point();
+            }
+        }
+    }
+
+    matchLoopClosure(frameQuery, candidates, edge, matchTag);
+}
+
+void
+GCamSLAM::matchLoopClosure(const FrameConstPtr& frameQuery,
+                           const std::vector<LoopClosureCandidate, Eigen::aligned_allocator<LoopClosureCandidate> >& candidates,
+                           std::pair<LoopClosureEdge,LoopClosureEdge>& edge,
+                           FrameTag& matchTag)
+{
+    if (candidates.empty())
     {
         return;
     }
 
+    cv::BFMatcher descriptorMatcher(cv::NORM_HAMMING, true);
+
     cv::Mat dtorsQuery;
     getDescriptorMat(frameQuery, dtorsQuery);
 
     std::vector<cv::DMatch> matchesBest;
     Transform transformBest;
-    FrameConstPtr frameBest;
+    const LoopClosureCandidate* candidateBest = 0;
 
-    for (size_t i = 0; i < frameMatches.size(); ++i)
+    for (size_t i = 0; i < candidates.size(); ++i)
     {
-        FrameConstPtr& frameMatch = frameMatches.at(i);
+        const LoopClosureCandidate& candidate = candidates.at(i);
 
         // find 2D-3D correspondences
-        cv::Mat dtorsMatch;
-        getDescriptorMat(frameMatch, dtorsMatch);
-
         std::vector<cv::DMatch> rawMatches;
-        descriptorMatcher.match(dtorsMatch, dtorsQuery, rawMatches);
+        descriptorMatcher.match(candidate.dtors, dtorsQuery, rawMatches);
 
         if (rawMatches.size() < k_minLoopCorrespondenceCount)
         {
@@ -357,7 +594,7 @@ GCamSLAM::findLoopClosuresHelper(const FrameConstPtr& frameQuery,
         // find camera pose from P3P RANSAC
         Eigen::Matrix4d systemPose;
         std::vector<cv::DMatch> matches;
-        solveP3PRansac(frameMatch, frameQuery, rawMatches, systemPose, matches);
+        solveP3PRansac(candidate, frameQuery, rawMatches, systemPose, matches);
 
         int nInliers = matches.size();
 
@@ -368,11 +605,11 @@ GCamSLAM::findLoopClosuresHelper(const FrameConstPtr& frameQuery,
 
         if (nInliers > matchesBest.size())
         {
-            frameBest = frameMatch;
+            candidateBest = &candidate;
             matchesBest = matches;
 
             // compute loop closure constraint
-            Eigen::Matrix4d H_01 = frameBest->frameSet()->systemPose()->toMatrix() *
+            Eigen::Matrix4d H_01 = candidate.systemPose *
                                    invertHomogeneousTransform(systemPose);
 
             transformBest.rotation() = Eigen::Quaterniond(H_01.block<3,3>(0,0));
@@ -380,10 +617,15 @@ GCamSLAM::findLoopClosuresHelper(const FrameConstPtr& frameQuery,
         }
     }
 
-    if (frameBest)
+    if (candidateBest)
     {
+        Profiler::instance()->addCount("gcam_slam.loop_closures");
+        Profiler::instance()->addSample("gcam_slam.loop_closure_inliers", matchesBest.size());
+
+        matchTag = candidateBest->tag;
+
         LoopClosureEdge& outEdge = edge.first;
-        outEdge.inFrame() = const_cast<Frame*>(frameBest.get());
+        outEdge.inFrame() = const_cast<Frame*>(candidateBest->frame.get());
         outEdge.measurement() = transformBest;
 
         outEdge.inMatchIds().resize(matchesBest.size());
@@ -436,12 +678,14 @@ GCamSLAM::getDescriptorMat(const FrameConstPtr& frame, cv::Mat& dmat) const
 }
 
 void
-GCamSLAM::solveP3PRansac(const FrameConstPtr& frame1,
-                         const FrameConstPtr& frame2,
+GCamSLAM::solveP3PRansac(const LoopClosureCandidate& candidate,
+                         const FrameConstPtr& frameQuery,
                          const std::vector<cv::DMatch>& matches,
                          Eigen::Matrix4d& H,
                          std::vector<cv::DMatch>& inliers) const
 {
+    PX_PROFILE_SCOPE("gcam_slam.ransac");
+
     inliers.clear();
 
     double p = 0.99; // probability that at least one set of random samples does not contain an outlier
@@ -450,76 +694,55 @@ GCamSLAM::solveP3PRansac(const FrameConstPtr& frame1,
     double u = 1.0 - v;
     int N = static_cast<int>(log(1.0 - p) / log(1.0 - u * u * u) + 0.5);
 
-    std::vector<size_t> indices;
+    const std::vector<Point2DFeaturePtr>& featuresQuery = frameQuery->features2D();
+
+    AbsolutePoseBatch batch;
+    batch.reserve(matches.size());
     for (size_t i = 0; i < matches.size(); ++i)
     {
-        indices.push_back(i);
-    }
+        const cv::DMatch& match = matches.at(i);
 
-    const std::vector<Point2DFeaturePtr>& features1 = frame1->features2D();
-    const std::vector<Point2DFeaturePtr>& features2 = frame2->features2D();
+        batch.add(candidate.scenePoints.at(match.queryIdx),
+                  featuresQuery.at(match.trainIdx)->ray());
+    }
 
-    // run RANSAC to find best H
-    Eigen::Matrix4d H_best;
-    std::vector<size_t> inlierIds_best;
+    Xoshiro256& rng = threadRng();
+    std::vector<size_t> sampleIds, sample;
+    sampleIds.reserve(N * 3);
     for (int i = 0; i < N; ++i)
     {
-        std::random_shuffle(indices.begin(), indices.end());
-
-        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > rays(3);
-        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > worldPoints(3);
-        for (int j = 0; j < 3; ++j)
+        if (!sampleKofN(rng, 3, matches.size(), sample))
         {
-            const cv::DMatch& match = matches.at(indices.at(j));
-
-            worldPoints.at(j) = features1.at(match.queryIdx)->feature3D()->point();
-            rays.at(j) = features2.at(match.trainIdx)->ray();
+            break;
         }
 
-        std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > solutions;
-        if (!solveP3P(rays, worldPoints, solutions))
-        {
-            continue;
-        }
-
-        for (size_t j = 0; j < solutions.size(); ++j)
-        {
-            Eigen::Matrix4d H_inv = invertHomogeneousTransform(solutions.at(j));
-
-            std::vector<size_t> inliersIds;
-            for (size_t k = 0; k < matches.size(); ++k)
-            {
-                const cv::DMatch& match = matches.at(k);
-
-                Eigen::Vector3d P1 = features1.at(match.queryIdx)->feature3D()->point();
-
-                Eigen::Vector3d P2 = transformPoint(H_inv, P1);
-
-                const Point2DFeatureConstPtr& f2 = features2.at(match.trainIdx);
+        sampleIds.insert(sampleIds.end(), sample.begin(), sample.end());
+    }
 
-                double err = fabs(P2.normalized().dot(f2->ray()));
-                if (err < k_sphericalErrorThresh)
-                {
-                    continue;
-                }
+    // run RANSAC to find best H
+    Eigen::Matrix4d H_best = Eigen::Matrix4d::Identity();
+    size_t nInliers_best = 0;
+    if (!sampleIds.empty())
+    {
+        batch.solveAndScore(&sampleIds[0], sampleIds.size() / 3,
+                            k_sphericalErrorThresh, H_best, nInliers_best);
+    }
 
-                inliersIds.push_back(k);
-            }
+    if (nInliers_best > 0)
+    {
+        std::vector<bool> inlierFlags;
+        batch.inliers(H_best, k_sphericalErrorThresh, inlierFlags);
 
-            if (inliersIds.size() > inlierIds_best.size())
+        for (size_t i = 0; i < inlierFlags.size(); ++i)
+        {
+            if (inlierFlags.at(i))
             {
-                H_best = H_inv;
-                inlierIds_best = inliersIds;
+                inliers.push_back(matches.at(i));
             }
         }
     }
 
-    for (size_t i = 0; i < inlierIds_best.size(); ++i)
-    {
-        inliers.push_back(matches.at(inlierIds_best.at(i)));
-    }
-
-    H = m_cameraSystem->getGlobalCameraPose(frame2->cameraId()) * H_best;
+    H = m_cameraSystem->getGlobalCameraPose(frameQuery->cameraId()) * invertHomogeneousTransform(H_best);
 }
 
 }
@@ -0,0 +1,1390 @@
+#include "gcam_slam/MapManager.h"
+
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/unordered_set.hpp>
+#include <cstdio>
+#include <fstream>
+#include <ros/console.h>
+
+#include "cauldron/EigenUtils.h"
+#include "cauldron/Profiler.h"
+#include "location_recognition/OrbLocationRecognition.h"
+
+namespace px
+{
+
+namespace
+{
+
+// "PXMS", little endian
+const uint32_t k_segmentFileMagic = 0x534d5850;
+const uint32_t k_segmentFileVersion = 1;
+
+template<typename T>
+void
+writeData(std::ofstream& ofs, T data)
+{
+    ofs.write(reinterpret_cast<const char*>(&data), sizeof(T));
+}
+
+template<typename T>
+void
+readData(std::ifstream& ifs, T& data)
+{
+    ifs.read(reinterpret_cast<char*>(&data), sizeof(T));
+}
+
+void
+writeTransform(std::ofstream& ofs, const Transform& transform)
+{
+    writeData(ofs, transform.rotation().x());
+    writeData(ofs, transform.rotation().y());
+    writeData(ofs, transform.rotation().z());
+    writeData(ofs, transform.rotation().w());
+    writeData(ofs, transform.translation()(0));
+    writeData(ofs, transform.translation()(1));
+    writeData(ofs, transform.translation()(2));
+}
+
+void
+readTransform(std::ifstream& ifs, Transform& transform)
+{
+    readData(ifs, transform.rotation().x());
+    readData(ifs, transform.rotation().y());
+    readData(ifs, transform.rotation().z());
+    readData(ifs, transform.rotation().w());
+    readData(ifs, transform.translation()(0));
+    readData(ifs, transform.translation()(1));
+    readData(ifs, transform.translation()(2));
+}
+
+bool
+seqLess(const FrameSetPtr& frameSet, size_t seq)
+{
+    return frameSet->seq() < seq;
+}
+
+bool
+compareSeq(const FrameSetPtr& frameSet1, const FrameSetPtr& frameSet2)
+{
+    return frameSet1->seq() < frameSet2->seq();
+}
+
+bool
+compareTimeStamp(const PoseConstPtr& pose1, const PoseConstPtr& pose2)
+{
+    return pose1->timeStamp() < pose2->timeStamp();
+}
+
+bool
+compareCovisibility(const std::pair<int, FrameSet*>& x,
+                    const std::pair<int, FrameSet*>& y)
+{
+    return x.first > y.first;
+}
+
+// Writes key frame sets in a compact format: no covariances, IMU
+// measurements, ground truth, images or loop closure edges, single
+// precision keypoints and rays, and descriptors only where they were
+// not stripped. Feature matches to frame sets outside the segment are
+// dropped.
+bool
+writeSegmentFile(const std::string& filename,
+                 const std::vector<FrameSetPtr>& frameSets)
+{
+    std::ofstream ofs(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!ofs.is_open())
+    {
+        return false;
+    }
+
+    writeData(ofs, k_segmentFileMagic);
+    writeData(ofs, k_segmentFileVersion);
+
+    // scene points
+    boost::unordered_map<const Point3DFeature*, int32_t> scenePointMap;
+    std::vector<const Point3DFeature*> scenePoints;
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        const std::vector<FramePtr>& frames = frameSets.at(i)->frames();
+
+        for (size_t j = 0; j < frames.size(); ++j)
+        {
+            const std::vector<Point2DFeaturePtr>& features = frames.at(j)->features2D();
+
+            for (size_t k = 0; k < features.size(); ++k)
+            {
+                const Point3DFeature* scenePoint = features.at(k)->feature3D().get();
+
+                if (scenePoint == 0 || scenePointMap.find(scenePoint) != scenePointMap.end())
+                {
+                    continue;
+                }
+
+                scenePointMap.insert(std::make_pair(scenePoint, static_cast<int32_t>(scenePoints.size())));
+                scenePoints.push_back(scenePoint);
+            }
+        }
+    }
+
+    writeData(ofs, static_cast<uint32_t>(scenePoints.size()));
+    for (size_t i = 0; i < scenePoints.size(); ++i)
+    {
+        const Point3DFeature* scenePoint = scenePoints.at(i);
+
+        for (int j = 0; j < 3; ++j)
+        {
+            writeData(ofs, scenePoint->point()(j));
+        }
+        for (int j = 0; j < 3; ++j)
+        {
+            writeData(ofs, scenePoint->pointFromStereo()(j));
+        }
+        writeData(ofs, static_cast<int32_t>(scenePoint->attributes()));
+        writeData(ofs, scenePoint->weight());
+    }
+
+    // index of each feature within its frame
+    boost::unordered_map<const Point2DFeature*, int32_t> featureMap;
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        const std::vector<FramePtr>& frames = frameSets.at(i)->frames();
+
+        for (size_t j = 0; j < frames.size(); ++j)
+        {
+            const std::vector<Point2DFeaturePtr>& features = frames.at(j)->features2D();
+
+            for (size_t k = 0; k < features.size(); ++k)
+            {
+                featureMap.insert(std::make_pair(features.at(k).get(), static_cast<int32_t>(k)));
+            }
+        }
+    }
+
+    writeData(ofs, static_cast<uint32_t>(frameSets.size()));
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        const FrameSetPtr& frameSet = frameSets.at(i);
+
+        // linked to the previous frame set in the file
+        FrameSet* frameSetPrev = (i > 0) ? frameSets.at(i - 1).get() : 0;
+        bool linked = (frameSetPrev != 0 && frameSet->prevFrameSet() == frameSetPrev);
+
+        writeData(ofs, static_cast<uint64_t>(frameSet->seq()));
+        writeData(ofs, static_cast<uint64_t>(frameSet->systemPose()->timeStamp().toNSec()));
+        writeTransform(ofs, *frameSet->systemPose());
+        writeData(ofs, static_cast<uint8_t>(linked));
+        writeTransform(ofs, frameSet->prevTransformMeasurement());
+        writeTransform(ofs, frameSet->nextTransformMeasurement());
+
+        const std::vector<FramePtr>& frames = frameSet->frames();
+        writeData(ofs, static_cast<uint32_t>(frames.size()));
+
+        for (size_t j = 0; j < frames.size(); ++j)
+        {
+            const FramePtr& frame = frames.at(j);
+            const std::vector<Point2DFeaturePtr>& features = frame->features2D();
+
+            // descriptors are either stripped from all features of a frame
+            // or kept for all of them
+            int32_t dtorType = -1;
+            int32_t dtorSize = 0;
+            if (!features.empty() && !features.front()->descriptor().empty())
+            {
+                const cv::Mat& dtor = features.front()->descriptor();
+
+                dtorType = dtor.type();
+                dtorSize = dtor.cols * dtor.elemSize();
+            }
+
+            writeData(ofs, static_cast<int32_t>(frame->cameraId()));
+            writeData(ofs, static_cast<uint32_t>(features.size()));
+            writeData(ofs, dtorType);
+            writeData(ofs, dtorSize);
+
+            for (size_t k = 0; k < features.size(); ++k)
+            {
+                const Point2DFeaturePtr& feature = features.at(k);
+                const cv::KeyPoint& keypoint = feature->keypoint();
+
+                writeData(ofs, keypoint.pt.x);
+                writeData(ofs, keypoint.pt.y);
+                writeData(ofs, keypoint.size);
+                writeData(ofs, keypoint.angle);
+                writeData(ofs, keypoint.response);
+                writeData(ofs, static_cast<int32_t>(keypoint.octave));
+                for (int l = 0; l < 3; ++l)
+                {
+                    writeData(ofs, static_cast<float>(feature->ray()(l)));
+                }
+                writeData(ofs, static_cast<uint32_t>(feature->index()));
+
+                int32_t scenePointId = -1;
+                if (feature->feature3D())
+                {
+                    scenePointId = scenePointMap[feature->feature3D().get()];
+                }
+                writeData(ofs, scenePointId);
+
+                // match in the same camera of the previous frame set
+                int32_t prevMatchId = -1;
+                if (linked && !feature->prevMatches().empty())
+                {
+                    const Point2DFeature* featurePrev = feature->prevMatch();
+
+                    if (featurePrev->frame() == frameSetPrev->frames().at(j).get())
+                    {
+                        prevMatchId = featureMap[featurePrev];
+                    }
+                }
+                writeData(ofs, prevMatchId);
+
+                // stereo match in another frame of the same frame set
+                int32_t matchFrameId = -1;
+                int32_t matchId = -1;
+                if (!feature->matches().empty())
+                {
+                    const Point2DFeature* featureMatch = feature->match();
+
+                    for (size_t l = 0; l < frames.size(); ++l)
+                    {
+                        if (featureMatch->frame() == frames.at(l).get())
+                        {
+                            matchFrameId = l;
+                            matchId = featureMap[featureMatch];
+                            break;
+                        }
+                    }
+                }
+                writeData(ofs, matchFrameId);
+                writeData(ofs, matchId);
+            }
+
+            if (dtorSize > 0)
+            {
+                for (size_t k = 0; k < features.size(); ++k)
+                {
+                    const cv::Mat& dtor = features.at(k)->descriptor();
+
+                    ofs.write(reinterpret_cast<const char*>(dtor.ptr(0)), dtorSize);
+                }
+            }
+        }
+    }
+
+    return ofs.good();
+}
+
+bool
+readSegmentFile(const std::string& filename,
+                std::vector<FrameSetPtr>& frameSets)
+{
+    frameSets.clear();
+
+    std::ifstream ifs(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!ifs.is_open())
+    {
+        return false;
+    }
+
+    uint32_t magic, version;
+    readData(ifs, magic);
+    readData(ifs, version);
+    if (!ifs.good() || magic != k_segmentFileMagic || version != k_segmentFileVersion)
+    {
+        return false;
+    }
+
+    uint32_t nScenePoints;
+    readData(ifs, nScenePoints);
+
+    std::vector<Point3DFeaturePtr> scenePoints(nScenePoints);
+    for (size_t i = 0; i < scenePoints.size(); ++i)
+    {
+        Point3DFeaturePtr& scenePoint = scenePoints.at(i);
+        scenePoint = boost::make_shared<Point3DFeature>();
+
+        for (int j = 0; j < 3; ++j)
+        {
+            readData(ifs, scenePoint->point()(j));
+        }
+        for (int j = 0; j < 3; ++j)
+        {
+            readData(ifs, scenePoint->pointFromStereo()(j));
+        }
+
+        int32_t attributes;
+        readData(ifs, attributes);
+        scenePoint->attributes() = attributes;
+
+        readData(ifs, scenePoint->weight());
+    }
+
+    uint32_t nFrameSets;
+    readData(ifs, nFrameSets);
+    if (!ifs.good())
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < nFrameSets; ++i)
+    {
+        FrameSetPtr frameSet = boost::make_shared<FrameSet>();
+        FrameSet* frameSetPrev = frameSets.empty() ? 0 : frameSets.back().get();
+
+        uint64_t seq, stamp;
+        readData(ifs, seq);
+        readData(ifs, stamp);
+        frameSet->seq() = seq;
+
+        frameSet->systemPose() = boost::make_shared<Pose>();
+        frameSet->systemPose()->timeStamp().fromNSec(stamp);
+        readTransform(ifs, *frameSet->systemPose());
+
+        uint8_t linked;
+        readData(ifs, linked);
+        readTransform(ifs, frameSet->prevTransformMeasurement());
+        readTransform(ifs, frameSet->nextTransformMeasurement());
+
+        if (linked && frameSetPrev != 0)
+        {
+            frameSet->prevFrameSet() = frameSetPrev;
+            frameSetPrev->nextFrameSet() = frameSet.get();
+        }
+
+        uint32_t nFrames;
+        readData(ifs, nFrames);
+        if (!ifs.good())
+        {
+            return false;
+        }
+
+        // stereo matches are resolved once all frames are read
+        std::vector<std::vector<std::pair<int32_t,int32_t> > > matchIds(nFrames);
+
+        for (size_t j = 0; j < nFrames; ++j)
+        {
+            FramePtr frame = boost::make_shared<Frame>();
+            frame->frameSet() = frameSet.get();
+            frameSet->frames().push_back(frame);
+
+            int32_t cameraId;
+            uint32_t nFeatures;
+            int32_t dtorType, dtorSize;
+            readData(ifs, cameraId);
+            readData(ifs, nFeatures);
+            readData(ifs, dtorType);
+            readData(ifs, dtorSize);
+            if (!ifs.good())
+            {
+                return false;
+            }
+
+            frame->cameraId() = cameraId;
+
+            std::vector<Point2DFeaturePtr>& features = frame->features2D();
+            features.resize(nFeatures);
+            matchIds.at(j).resize(nFeatures);
+
+            for (size_t k = 0; k < nFeatures; ++k)
+            {
+                Point2DFeaturePtr& feature = features.at(k);
+                feature = boost::make_shared<Point2DFeature>();
+                feature->frame() = frame.get();
+
+                cv::KeyPoint& keypoint = feature->keypoint();
+                readData(ifs, keypoint.pt.x);
+                readData(ifs, keypoint.pt.y);
+                readData(ifs, keypoint.size);
+                readData(ifs, keypoint.angle);
+                readData(ifs, keypoint.response);
+
+                int32_t octave;
+                readData(ifs, octave);
+                keypoint.octave = octave;
+
+                for (int l = 0; l < 3; ++l)
+                {
+                    float r;
+                    readData(ifs, r);
+                    feature->ray()(l) = r;
+                }
+
+                uint32_t index;
+                readData(ifs, index);
+                feature->index() = index;
+
+                int32_t scenePointId, prevMatchId;
+                readData(ifs, scenePointId);
+                readData(ifs, prevMatchId);
+                readData(ifs, matchIds.at(j).at(k).first);
+                readData(ifs, matchIds.at(j).at(k).second);
+                if (!ifs.good())
+                {
+                    return false;
+                }
+
+                if (scenePointId >= 0 && static_cast<size_t>(scenePointId) < scenePoints.size())
+                {
+                    feature->feature3D() = scenePoints.at(scenePointId);
+                    scenePoints.at(scenePointId)->features2D().push_back(feature.get());
+                }
+
+                if (prevMatchId >= 0 && frameSet->prevFrameSet() != 0 &&
+                    j < frameSetPrev->frames().size() &&
+                    static_cast<size_t>(prevMatchId) < frameSetPrev->frames().at(j)->features2D().size())
+                {
+                    Point2DFeature* featurePrev = frameSetPrev->frames().at(j)->features2D().at(prevMatchId).get();
+
+                    featurePrev->nextMatches().push_back(feature.get());
+                    featurePrev->bestNextMatchId() = 0;
+
+                    feature->prevMatches().push_back(featurePrev);
+                    feature->bestPrevMatchId() = 0;
+                }
+            }
+
+            if (dtorSize > 0)
+            {
+                for (size_t k = 0; k < nFeatures; ++k)
+                {
+                    cv::Mat dtor(1, dtorSize / CV_ELEM_SIZE(dtorType), dtorType);
+                    ifs.read(reinterpret_cast<char*>(dtor.ptr(0)), dtorSize);
+
+                    features.at(k)->descriptor() = dtor;
+                }
+            }
+        }
+
+        for (size_t j = 0; j < nFrames; ++j)
+        {
+            std::vector<Point2DFeaturePtr>& features = frameSet->frames().at(j)->features2D();
+
+            for (size_t k = 0; k < features.size(); ++k)
+            {
+                int32_t matchFrameId = matchIds.at(j).at(k).first;
+                int32_t matchId = matchIds.at(j).at(k).second;
+
+                if (matchFrameId < 0 || static_cast<size_t>(matchFrameId) >= nFrames ||
+                    matchId < 0 || static_cast<size_t>(matchId) >= frameSet->frames().at(matchFrameId)->features2D().size())
+                {
+                    continue;
+                }
+
+                features.at(k)->matches().push_back(frameSet->frames().at(matchFrameId)->features2D().at(matchId).get());
+                features.at(k)->bestMatchId() = 0;
+            }
+        }
+
+        frameSets.push_back(frameSet);
+    }
+
+    return ifs.good();
+}
+
+}
+
+MapManager::Segment::Segment()
+ : firstSeq(0)
+ , keyFrameSetCount(0)
+ , lastAccess(0)
+ , spilled(false)
+{
+
+}
+
+MapManager::MapManager(const CameraSystemConstPtr& cameraSystem,
+                       const SparseGraphPtr& sparseGraph,
+                       const boost::shared_ptr<OrbLocationRecognition>& locRec)
+ : m_cameraSystem(cameraSystem)
+ , m_sparseGraph(sparseGraph)
+ , m_locRec(locRec)
+ , m_keyFrameSetCount(0)
+ , m_spilledKeyFrameSetCount(0)
+ , m_culledKeyFrameSetCount(0)
+ , m_mergedScenePointCount(0)
+ , k_segmentSize(50)
+ , k_maxResidentSegmentCount(0)
+ , k_protectedKeyFrameSetCount(20)
+ , k_redundancyRatio(0.9)
+ , k_redundantObservationCount(3)
+ , k_maxCovisibleFrameSetCount(10)
+ , k_fusionRayThresh(0.999976)
+ , k_fusionDistanceRatio(0.1)
+ , k_maxDescriptorDistance(50)
+{
+    for (int i = 0; i < cameraSystem->cameraCount(); ++i)
+    {
+        m_H_cam_sys.push_back(cameraSystem->getGlobalCameraPose(i));
+    }
+}
+
+int&
+MapManager::segmentSize(void)
+{
+    return k_segmentSize;
+}
+
+int&
+MapManager::maxResidentSegmentCount(void)
+{
+    return k_maxResidentSegmentCount;
+}
+
+int&
+MapManager::protectedKeyFrameSetCount(void)
+{
+    return k_protectedKeyFrameSetCount;
+}
+
+double&
+MapManager::redundancyRatio(void)
+{
+    return k_redundancyRatio;
+}
+
+int&
+MapManager::redundantObservationCount(void)
+{
+    return k_redundantObservationCount;
+}
+
+bool
+MapManager::setSpillDirectory(const std::string& directory)
+{
+    if (!directory.empty())
+    {
+        boost::system::error_code ec;
+        boost::filesystem::create_directories(directory, ec);
+
+        if (!boost::filesystem::is_directory(directory))
+        {
+            ROS_ERROR("Failed to create map spill directory %s.", directory.c_str());
+            return false;
+        }
+    }
+
+    m_spillDirectory = directory;
+
+    return true;
+}
+
+void
+MapManager::addKeyFrameSet(const FrameSetPtr& frameSet)
+{
+    PX_PROFILE_SCOPE("gcam_slam.map_management");
+
+    if (m_segments.empty() ||
+        m_segments.back().keyFrameSetCount >= static_cast<size_t>(k_segmentSize))
+    {
+        m_segments.push_back(Segment());
+        m_segments.back().firstSeq = frameSet->seq();
+    }
+
+    ++m_keyFrameSetCount;
+
+    Segment& segment = m_segments.back();
+    ++segment.keyFrameSetCount;
+    segment.lastAccess = m_keyFrameSetCount;
+
+    FrameSetSegment& frameSets = m_sparseGraph->frameSetSegment(0);
+
+    // VO no longer matches against the previous key frame set
+    if (!frameSets.empty())
+    {
+        stripFrameSet(frameSets.back().get());
+    }
+
+    frameSets.push_back(frameSet);
+
+    m_recentSeqs.push_back(frameSet->seq());
+    while (m_recentSeqs.size() > static_cast<size_t>(std::max(k_protectedKeyFrameSetCount, 1)))
+    {
+        m_recentSeqs.pop_front();
+    }
+
+    std::vector<FrameSet*> covisibleFrameSets;
+    findCovisibleFrameSets(frameSet.get(), covisibleFrameSets);
+
+    fuseScenePoints(frameSet.get(), covisibleFrameSets);
+
+    for (size_t i = 0; i < covisibleFrameSets.size(); ++i)
+    {
+        FrameSet* covisibleFrameSet = covisibleFrameSets.at(i);
+
+        m_segments.at(segmentId(covisibleFrameSet->seq())).lastAccess = m_keyFrameSetCount;
+
+        if (!isProtected(covisibleFrameSet) && isRedundant(covisibleFrameSet))
+        {
+            cullFrameSet(covisibleFrameSet);
+        }
+    }
+
+    if (m_spillDirectory.empty() || k_maxResidentSegmentCount <= 0)
+    {
+        return;
+    }
+
+    int nResidentSegments = 0;
+    for (size_t i = 0; i < m_segments.size(); ++i)
+    {
+        if (!m_segments.at(i).spilled)
+        {
+            ++nResidentSegments;
+        }
+    }
+
+    while (nResidentSegments > k_maxResidentSegmentCount)
+    {
+        // spill the least recently covisible segment without protected
+        // key frame sets
+        int segmentIdLRU = -1;
+        for (size_t i = 0; i + 1 < m_segments.size(); ++i)
+        {
+            const Segment& segment = m_segments.at(i);
+
+            if (segment.spilled || m_segments.at(i + 1).firstSeq > m_recentSeqs.front())
+            {
+                continue;
+            }
+
+            if (segmentIdLRU == -1 ||
+                segment.lastAccess < m_segments.at(segmentIdLRU).lastAccess)
+            {
+                segmentIdLRU = i;
+            }
+        }
+
+        if (segmentIdLRU == -1 || !spillSegment(segmentIdLRU))
+        {
+            break;
+        }
+
+        --nResidentSegments;
+    }
+}
+
+bool
+MapManager::reloadFrames(const std::vector<FrameTag>& tags,
+                         std::vector<FrameConstPtr>& frames)
+{
+    frames.clear();
+
+    for (size_t i = 0; i < tags.size(); ++i)
+    {
+        const FrameTag& tag = tags.at(i);
+
+        int id = segmentId(tag.frameSetId);
+        if (id == -1)
+        {
+            continue;
+        }
+
+        Segment& segment = m_segments.at(id);
+        if (segment.spilled && !reloadSegment(id))
+        {
+            continue;
+        }
+
+        segment.lastAccess = m_keyFrameSetCount;
+
+        const FrameSetSegment& frameSets = m_sparseGraph->frameSetSegment(0);
+
+        FrameSetSegment::const_iterator it = std::lower_bound(frameSets.begin(), frameSets.end(),
+                                                              static_cast<size_t>(tag.frameSetId), seqLess);
+        if (it == frameSets.end() || (*it)->seq() != static_cast<size_t>(tag.frameSetId))
+        {
+            // culled
+            continue;
+        }
+
+        const FrameSetPtr& frameSet = *it;
+        if (tag.frameId < 0 || static_cast<size_t>(tag.frameId) >= frameSet->frames().size())
+        {
+            continue;
+        }
+
+        frames.push_back(frameSet->frames().at(tag.frameId));
+    }
+
+    return !frames.empty();
+}
+
+void
+MapManager::getSystemPoses(std::vector<PoseConstPtr>& poses) const
+{
+    poses.clear();
+
+    for (size_t i = 0; i < m_segments.size(); ++i)
+    {
+        const Segment& segment = m_segments.at(i);
+
+        poses.insert(poses.end(), segment.systemPoses.begin(), segment.systemPoses.end());
+    }
+
+    const FrameSetSegment& frameSets = m_sparseGraph->frameSetSegment(0);
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        poses.push_back(frameSets.at(i)->systemPose());
+    }
+
+    std::sort(poses.begin(), poses.end(), compareTimeStamp);
+}
+
+bool
+MapManager::isResident(const FrameSet* frameSet) const
+{
+    const FrameSetSegment& frameSets = m_sparseGraph->frameSetSegment(0);
+    FrameSetSegment::const_iterator it = std::lower_bound(frameSets.begin(), frameSets.end(),
+                                                          frameSet->seq(), seqLess);
+
+    return it != frameSets.end() && it->get() == frameSet;
+}
+
+size_t
+MapManager::residentKeyFrameSetCount(void) const
+{
+    return m_sparseGraph->frameSetSegment(0).size();
+}
+
+size_t
+MapManager::spilledKeyFrameSetCount(void) const
+{
+    return m_spilledKeyFrameSetCount;
+}
+
+size_t
+MapManager::culledKeyFrameSetCount(void) const
+{
+    return m_culledKeyFrameSetCount;
+}
+
+size_t
+MapManager::mergedScenePointCount(void) const
+{
+    return m_mergedScenePointCount;
+}
+
+void
+MapManager::mergeScenePoints(const Point3DFeaturePtr& scenePoint1,
+                             const Point3DFeaturePtr& scenePoint2)
+{
+    if (scenePoint1 == scenePoint2)
+    {
+        return;
+    }
+
+    // the features of scenePoint2 may hold its last references
+    Point3DFeaturePtr scenePointKeep = scenePoint1;
+    Point3DFeaturePtr scenePointMerge = scenePoint2;
+
+    for (size_t i = 0; i < scenePointMerge->features2D().size(); ++i)
+    {
+        Point2DFeature* feature2 = scenePointMerge->features2D().at(i);
+
+        bool found = false;
+        for (size_t j = 0; j < scenePointKeep->features2D().size(); ++j)
+        {
+            Point2DFeature* feature1 = scenePointKeep->features2D().at(j);
+
+            if (feature1 == feature2)
+            {
+                found = true;
+                break;
+            }
+        }
+
+        if (!found)
+        {
+            scenePointKeep->features2D().push_back(feature2);
+        }
+    }
+
+    for (size_t i = 0; i < scenePointKeep->features2D().size(); ++i)
+    {
+        Point2DFeature* feature = scenePointKeep->features2D().at(i);
+        feature->feature3D() = scenePointKeep;
+    }
+}
+
+void
+MapManager::findCovisibleFrameSets(FrameSet* frameSet,
+                                   std::vector<FrameSet*>& covisibleFrameSets) const
+{
+    covisibleFrameSets.clear();
+
+    // number of scene points shared with each other frame set
+    boost::unordered_map<FrameSet*,int> weights;
+    boost::unordered_set<Point3DFeature*> scenePoints;
+    std::vector<FrameSet*> observers;
+
+    for (size_t i = 0; i < frameSet->frames().size(); i += 2)
+    {
+        const std::vector<Point2DFeaturePtr>& features = frameSet->frames().at(i)->features2D();
+
+        for (size_t j = 0; j < features.size(); ++j)
+        {
+            Point3DFeature* scenePoint = features.at(j)->feature3D().get();
+
+            if (scenePoint == 0 || !scenePoints.insert(scenePoint).second)
+            {
+                continue;
+            }
+
+            observers.clear();
+            for (size_t k = 0; k < scenePoint->features2D().size(); ++k)
+            {
+                FrameSet* observer = scenePoint->features2D().at(k)->frame()->frameSet();
+
+                if (observer == frameSet ||
+                    std::find(observers.begin(), observers.end(), observer) != observers.end())
+                {
+                    continue;
+                }
+
+                observers.push_back(observer);
+                ++weights[observer];
+            }
+        }
+    }
+
+    std::vector<std::pair<int, FrameSet*> > neighbors;
+    for (boost::unordered_map<FrameSet*,int>::iterator it = weights.begin();
+         it != weights.end(); ++it)
+    {
+        neighbors.push_back(std::make_pair(it->second, it->first));
+    }
+
+    std::sort(neighbors.begin(), neighbors.end(), compareCovisibility);
+
+    for (size_t i = 0; i < neighbors.size() && i < k_maxCovisibleFrameSetCount; ++i)
+    {
+        covisibleFrameSets.push_back(neighbors.at(i).second);
+    }
+}
+
+void
+MapManager::fuseScenePoints(FrameSet* frameSet,
+                            const std::vector<FrameSet*>& covisibleFrameSets)
+{
+    // A scene point of a covisible frame set is a duplicate of a scene
+    // point of the new key frame set if it projects onto a feature of the
+    // same appearance that observes a nearby scene point, as it does when
+    // VO loses a track and triangulates the point again.
+    boost::unordered_set<Point3DFeature*> scenePoints;
+    for (size_t i = 0; i < frameSet->frames().size(); ++i)
+    {
+        const std::vector<Point2DFeaturePtr>& features = frameSet->frames().at(i)->features2D();
+
+        for (size_t j = 0; j < features.size(); ++j)
+        {
+            scenePoints.insert(features.at(j)->feature3D().get());
+        }
+    }
+
+    std::vector<Point3DFeaturePtr> candidates;
+    std::vector<cv::Mat> candidateDtors;
+    for (size_t i = 0; i < covisibleFrameSets.size(); ++i)
+    {
+        FrameSet* covisibleFrameSet = covisibleFrameSets.at(i);
+
+        for (size_t j = 0; j < covisibleFrameSet->frames().size(); j += 2)
+        {
+            const std::vector<Point2DFeaturePtr>& features = covisibleFrameSet->frames().at(j)->features2D();
+
+            for (size_t k = 0; k < features.size(); ++k)
+            {
+                const Point2DFeaturePtr& feature = features.at(k);
+
+                if (!feature->feature3D() || feature->descriptor().empty() ||
+                    !scenePoints.insert(feature->feature3D().get()).second)
+                {
+                    continue;
+                }
+
+                candidates.push_back(feature->feature3D());
+                candidateDtors.push_back(feature->descriptor());
+            }
+        }
+    }
+
+    std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > H_cam_world;
+    for (size_t i = 0; i < frameSet->frames().size(); i += 2)
+    {
+        Eigen::Matrix4d H_sys_cam = invertHomogeneousTransform(m_H_cam_sys.at(frameSet->frames().at(i)->cameraId()));
+
+        H_cam_world.push_back(H_sys_cam * frameSet->systemPose()->toMatrix());
+    }
+
+    std::vector<Frame*> frames;
+    for (size_t i = 0; i < candidates.size(); ++i)
+    {
+        const Point3DFeaturePtr& candidate = candidates.at(i);
+        const cv::Mat& candidateDtor = candidateDtors.at(i);
+
+        // merged into an earlier candidate
+        if (candidate->features2D().empty() ||
+            candidate->features2D().front()->feature3D() != candidate)
+        {
+            continue;
+        }
+
+        for (size_t j = 0; j < frameSet->frames().size(); j += 2)
+        {
+            const Eigen::Matrix4d& H = H_cam_world.at(j / 2);
+
+            Eigen::Vector3d P = transformPoint(H, candidate->point());
+            double range = P.norm();
+            if (range < 1e-6)
+            {
+                continue;
+            }
+
+            Eigen::Vector3d ray = P / range;
+
+            const std::vector<Point2DFeaturePtr>& features = frameSet->frames().at(j)->features2D();
+
+            Point2DFeature* featureBest = 0;
+            int distanceBest = k_maxDescriptorDistance + 1;
+            for (size_t k = 0; k < features.size(); ++k)
+            {
+                Point2DFeature* feature = features.at(k).get();
+
+                if (!feature->feature3D() || feature->descriptor().empty() ||
+                    feature->descriptor().type() != candidateDtor.type() ||
+                    feature->descriptor().cols != candidateDtor.cols ||
+                    feature->ray().dot(ray) < k_fusionRayThresh)
+                {
+                    continue;
+                }
+
+                int distance = cv::norm(feature->descriptor(), candidateDtor, cv::NORM_HAMMING);
+                if (distance < distanceBest)
+                {
+                    featureBest = feature;
+                    distanceBest = distance;
+                }
+            }
+
+            if (featureBest == 0)
+            {
+                continue;
+            }
+
+            Point3DFeaturePtr scenePoint = featureBest->feature3D();
+
+            if ((transformPoint(H, scenePoint->point()) - P).norm() > k_fusionDistanceRatio * range)
+            {
+                continue;
+            }
+
+            // two scene points observed in the same frame are distinct
+            frames.clear();
+            for (size_t k = 0; k < scenePoint->features2D().size(); ++k)
+            {
+                frames.push_back(scenePoint->features2D().at(k)->frame());
+            }
+
+            bool distinct = false;
+            for (size_t k = 0; k < candidate->features2D().size(); ++k)
+            {
+                if (std::find(frames.begin(), frames.end(),
+                              candidate->features2D().at(k)->frame()) != frames.end())
+                {
+                    distinct = true;
+                    break;
+                }
+            }
+
+            if (distinct)
+            {
+                continue;
+            }
+
+            if (scenePoint->features2D().size() >= candidate->features2D().size())
+            {
+                mergeScenePoints(scenePoint, candidate);
+            }
+            else
+            {
+                mergeScenePoints(candidate, scenePoint);
+            }
+
+            ++m_mergedScenePointCount;
+            Profiler::instance()->addCount("gcam_slam.merged_scene_points");
+
+            break;
+        }
+    }
+}
+
+bool
+MapManager::isRedundant(FrameSet* frameSet) const
+{
+    for (size_t i = 0; i < frameSet->frames().size(); ++i)
+    {
+        // anchors loop closures
+        if (!frameSet->frames().at(i)->loopClosureEdges().empty())
+        {
+            return false;
+        }
+    }
+
+    boost::unordered_set<Point3DFeature*> scenePoints;
+    std::vector<FrameSet*> observers;
+    size_t nRedundant = 0;
+
+    for (size_t i = 0; i < frameSet->frames().size(); i += 2)
+    {
+        const std::vector<Point2DFeaturePtr>& features = frameSet->frames().at(i)->features2D();
+
+        for (size_t j = 0; j < features.size(); ++j)
+        {
+            Point3DFeature* scenePoint = features.at(j)->feature3D().get();
+
+            if (scenePoint == 0 || !scenePoints.insert(scenePoint).second)
+            {
+                continue;
+            }
+
+            observers.clear();
+            for (size_t k = 0; k < scenePoint->features2D().size(); ++k)
+            {
+                FrameSet* observer = scenePoint->features2D().at(k)->frame()->frameSet();
+
+                if (observer != frameSet &&
+                    std::find(observers.begin(), observers.end(), observer) == observers.end())
+                {
+                    observers.push_back(observer);
+                }
+            }
+
+            if (observers.size() >= static_cast<size_t>(k_redundantObservationCount))
+            {
+                ++nRedundant;
+            }
+        }
+    }
+
+    return !scenePoints.empty() &&
+           nRedundant >= k_redundancyRatio * scenePoints.size();
+}
+
+void
+MapManager::cullFrameSet(FrameSet* frameSet)
+{
+    FrameSetSegment& frameSets = m_sparseGraph->frameSetSegment(0);
+    FrameSetSegment::iterator it = std::lower_bound(frameSets.begin(), frameSets.end(),
+                                                    frameSet->seq(), seqLess);
+    if (it == frameSets.end() || it->get() != frameSet)
+    {
+        return;
+    }
+
+    // the frame set destructor removes its observations from scene points
+    FrameSetPtr frameSetCulled = *it;
+    frameSets.erase(it);
+
+    FrameSet* frameSetPrev = frameSet->prevFrameSet();
+    FrameSet* frameSetNext = frameSet->nextFrameSet();
+
+    // bridge feature tracks over the culled key frame set
+    for (size_t i = 0; i < frameSet->frames().size(); ++i)
+    {
+        std::vector<Point2DFeaturePtr>& features = frameSet->frames().at(i)->features2D();
+
+        for (size_t j = 0; j < features.size(); ++j)
+        {
+            Point2DFeature* feature = features.at(j).get();
+
+            Point2DFeature* featurePrev = feature->prevMatches().empty() ? 0 : feature->prevMatch();
+            Point2DFeature* featureNext = feature->nextMatches().empty() ? 0 : feature->nextMatch();
+
+            if (featurePrev)
+            {
+                featurePrev->nextMatches().clear();
+                featurePrev->bestNextMatchId() = -1;
+            }
+            if (featureNext)
+            {
+                featureNext->prevMatches().clear();
+                featureNext->bestPrevMatchId() = -1;
+            }
+            if (featurePrev && featureNext)
+            {
+                featurePrev->nextMatches().push_back(featureNext);
+                featurePrev->bestNextMatchId() = 0;
+                featureNext->prevMatches().push_back(featurePrev);
+                featureNext->bestPrevMatchId() = 0;
+            }
+
+            feature->prevMatches().clear();
+            feature->bestPrevMatchId() = -1;
+            feature->nextMatches().clear();
+            feature->bestNextMatchId() = -1;
+        }
+    }
+
+    // H_prev_next = H_prev_culled * H_culled_next
+    if (frameSetPrev && frameSetNext)
+    {
+        frameSetNext->prevTransformMeasurement() = Transform(frameSet->prevTransformMeasurement().toMatrix() *
+                                                             frameSetNext->prevTransformMeasurement().toMatrix());
+        frameSetPrev->nextTransformMeasurement() = Transform(frameSet->nextTransformMeasurement().toMatrix() *
+                                                             frameSetPrev->nextTransformMeasurement().toMatrix());
+    }
+    if (frameSetPrev)
+    {
+        frameSetPrev->nextFrameSet() = frameSetNext;
+    }
+    if (frameSetNext)
+    {
+        frameSetNext->prevFrameSet() = frameSetPrev;
+    }
+    frameSet->prevFrameSet() = 0;
+    frameSet->nextFrameSet() = 0;
+
+    removeFromLocationRecognition(frameSet);
+
+    ++m_culledKeyFrameSetCount;
+    Profiler::instance()->addCount("gcam_slam.culled_key_frame_sets");
+}
+
+void
+MapManager::stripFrameSet(FrameSet* frameSet) const
+{
+    for (size_t i = 0; i < frameSet->frames().size(); ++i)
+    {
+        Frame* frame = frameSet->frames().at(i).get();
+
+        frame->image() = cv::Mat();
+
+        // location recognition only queries the first camera of each
+        // stereo pair
+        if (frame->cameraId() % 2 == 0)
+        {
+            continue;
+        }
+
+        std::vector<Point2DFeaturePtr>& features = frame->features2D();
+        for (size_t j = 0; j < features.size(); ++j)
+        {
+            features.at(j)->descriptor() = cv::Mat();
+        }
+    }
+}
+
+int
+MapManager::segmentId(size_t seq) const
+{
+    for (int i = static_cast<int>(m_segments.size()) - 1; i >= 0; --i)
+    {
+        if (m_segments.at(i).firstSeq <= seq)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+std::string
+MapManager::segmentFilename(int segmentId) const
+{
+    char filename[32];
+    snprintf(filename, sizeof(filename), "segment_%06d.bin", segmentId);
+
+    return (boost::filesystem::path(m_spillDirectory) / filename).string();
+}
+
+bool
+MapManager::spillSegment(int segmentId)
+{
+    PX_PROFILE_SCOPE("gcam_slam.map_spill");
+
+    FrameSetSegment& frameSets = m_sparseGraph->frameSetSegment(0);
+
+    std::vector<FrameSetPtr> spilledFrameSets;
+    FrameSetSegment residentFrameSets;
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        if (this->segmentId(frameSets.at(i)->seq()) == segmentId)
+        {
+            spilledFrameSets.push_back(frameSets.at(i));
+        }
+        else
+        {
+            residentFrameSets.push_back(frameSets.at(i));
+        }
+    }
+
+    std::string filename = segmentFilename(segmentId);
+    if (!writeSegmentFile(filename, spilledFrameSets))
+    {
+        ROS_ERROR("Failed to write map segment %s.", filename.c_str());
+        return false;
+    }
+
+    Segment& segment = m_segments.at(segmentId);
+    for (size_t i = 0; i < spilledFrameSets.size(); ++i)
+    {
+        FrameSet* frameSet = spilledFrameSets.at(i).get();
+
+        segment.systemPoses.push_back(frameSet->systemPose());
+
+        detachFrameSet(frameSet);
+    }
+    segment.spilled = true;
+
+    frameSets.swap(residentFrameSets);
+
+    m_spilledKeyFrameSetCount += spilledFrameSets.size();
+    Profiler::instance()->addCount("gcam_slam.spilled_key_frame_sets", spilledFrameSets.size());
+
+    return true;
+}
+
+bool
+MapManager::reloadSegment(int segmentId)
+{
+    PX_PROFILE_SCOPE("gcam_slam.map_reload");
+
+    std::string filename = segmentFilename(segmentId);
+
+    std::vector<FrameSetPtr> reloadedFrameSets;
+    if (!readSegmentFile(filename, reloadedFrameSets))
+    {
+        ROS_ERROR("Failed to read map segment %s.", filename.c_str());
+        return false;
+    }
+
+    for (size_t i = 0; i < reloadedFrameSets.size(); ++i)
+    {
+        const FrameSetPtr& frameSet = reloadedFrameSets.at(i);
+
+        if (!m_locRec)
+        {
+            break;
+        }
+
+        for (size_t j = 0; j < frameSet->frames().size(); ++j)
+        {
+            m_locRec->restoreFrame(frameSet->frames().at(j));
+        }
+    }
+
+    FrameSetSegment& frameSets = m_sparseGraph->frameSetSegment(0);
+
+    FrameSetSegment residentFrameSets;
+    residentFrameSets.reserve(frameSets.size() + reloadedFrameSets.size());
+    std::merge(frameSets.begin(), frameSets.end(),
+               reloadedFrameSets.begin(), reloadedFrameSets.end(),
+               std::back_inserter(residentFrameSets), compareSeq);
+    frameSets.swap(residentFrameSets);
+
+    Segment& segment = m_segments.at(segmentId);
+    segment.spilled = false;
+    segment.systemPoses.clear();
+    segment.lastAccess = m_keyFrameSetCount;
+
+    m_spilledKeyFrameSetCount -= reloadedFrameSets.size();
+    Profiler::instance()->addCount("gcam_slam.reloaded_key_frame_sets", reloadedFrameSets.size());
+
+    return true;
+}
+
+bool
+MapManager::isProtected(const FrameSet* frameSet) const
+{
+    return m_recentSeqs.empty() || frameSet->seq() >= m_recentSeqs.front();
+}
+
+void
+MapManager::detachFrameSet(FrameSet* frameSet) const
+{
+    removeFromLocationRecognition(frameSet);
+
+    // loop closure edges are not spilled; their constraints are already
+    // part of the optimized poses
+    for (size_t i = 0; i < frameSet->frames().size(); ++i)
+    {
+        Frame* frame = frameSet->frames().at(i).get();
+
+        std::vector<LoopClosureEdge>& edges = frame->loopClosureEdges();
+        for (size_t j = 0; j < edges.size(); ++j)
+        {
+            std::vector<LoopClosureEdge>& edgesIn = edges.at(j).inFrame()->loopClosureEdges();
+
+            std::vector<LoopClosureEdge>::iterator it = edgesIn.begin();
+            while (it != edgesIn.end())
+            {
+                if (it->inFrame() == frame)
+                {
+                    it = edgesIn.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        edges.clear();
+    }
+
+    // cut all tracks, so that the frame set destructor does not follow
+    // them into released frame sets
+    for (size_t i = 0; i < frameSet->frames().size(); ++i)
+    {
+        std::vector<Point2DFeaturePtr>& features = frameSet->frames().at(i)->features2D();
+
+        for (size_t j = 0; j < features.size(); ++j)
+        {
+            Point2DFeature* feature = features.at(j).get();
+
+            for (size_t k = 0; k < feature->prevMatches().size(); ++k)
+            {
+                feature->prevMatches().at(k)->nextMatches().clear();
+                feature->prevMatches().at(k)->bestNextMatchId() = -1;
+            }
+            for (size_t k = 0; k < feature->nextMatches().size(); ++k)
+            {
+                feature->nextMatches().at(k)->prevMatches().clear();
+                feature->nextMatches().at(k)->bestPrevMatchId() = -1;
+            }
+
+            feature->prevMatches().clear();
+            feature->bestPrevMatchId() = -1;
+            feature->nextMatches().clear();
+            feature->bestNextMatchId() = -1;
+        }
+    }
+
+    if (frameSet->prevFrameSet())
+    {
+        frameSet->prevFrameSet()->nextFrameSet() = 0;
+        frameSet->prevFrameSet() = 0;
+    }
+    if (frameSet->nextFrameSet())
+    {
+        frameSet->nextFrameSet()->prevFrameSet() = 0;
+        frameSet->nextFrameSet() = 0;
+    }
+}
+
+void
+MapManager::removeFromLocationRecognition(FrameSet* frameSet) const
+{
+    if (!m_locRec)
+    {
+        return;
+    }
+
+    for (size_t i = 0; i < frameSet->frames().size(); ++i)
+    {
+        m_locRec->removeFrame(frameSet->frames().at(i));
+    }
+}
+
+}
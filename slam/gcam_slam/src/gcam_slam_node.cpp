@@ -1,12 +1,14 @@
+#include <algorithm>
 #include <boost/program_options.hpp>
 #include <cv_bridge/cv_bridge.h>
-#include <message_filters/subscriber.h>
-#include <message_filters/time_synchronizer.h>
+#include <multicam_msgs/FrameSet.h>
 
 #include "camera_models/CameraFactory.h"
 #include "camera_systems/CameraSystem.h"
 #include "cauldron/DataBuffer.h"
+#include "cauldron/Random.h"
 #include "gcam_slam/GCamSLAM.h"
+#include "gcam_vo/ProfilerDiagnostics.h"
 
 void
 cameraInfoCallback(const px_comm::CameraInfoConstPtr& msg,
@@ -19,21 +21,57 @@ cameraInfoCallback(const px_comm::CameraInfoConstPtr& msg,
 
 void
 imuCallback(const sensor_msgs::ImuConstPtr& imuMsg,
-            px::DataBuffer<sensor_msgs::ImuConstPtr>& imuBuffer)
+            px::DataBuffer<sensor_msgs::ImuConstPtr>& imuBuffer,
+            boost::shared_ptr<px::GCamSLAM>& slam)
 {
     imuBuffer.push(imuMsg->header.stamp, imuMsg);
+    slam->addImuMeasurement(imuMsg);
+}
+
+bool
+readFrameSet(const multicam_msgs::FrameSetConstPtr& frameSetMsg,
+             const std::vector<std::string>& cameraNsVec,
+             std::vector<cv::Mat>& imageVec)
+{
+    for (size_t i = 0; i < cameraNsVec.size(); ++i)
+    {
+        std::vector<std::string>::const_iterator it =
+            std::find(frameSetMsg->camera_ns.begin(), frameSetMsg->camera_ns.end(),
+                      cameraNsVec.at(i));
+        if (it == frameSetMsg->camera_ns.end())
+        {
+            ROS_WARN("Frame set has no image from camera %s.", cameraNsVec.at(i).c_str());
+            return false;
+        }
+
+        const sensor_msgs::Image& imageMsg =
+            frameSetMsg->images.at(it - frameSetMsg->camera_ns.begin());
+
+        try
+        {
+            cv_bridge::CvImageConstPtr cv_ptr = cv_bridge::toCvShare(imageMsg, frameSetMsg);
+
+            cv_ptr->image.copyTo(imageVec.at(i));
+        }
+        catch (cv_bridge::Exception& e)
+        {
+            ROS_ERROR("cv_bridge exception: %s", e.what());
+            return false;
+        }
+    }
+
+    return true;
 }
 
 void
-dataCallback(const sensor_msgs::ImageConstPtr& imageMsg0,
-             const sensor_msgs::ImageConstPtr& imageMsg1,
-             const sensor_msgs::ImageConstPtr& imageMsg2,
-             const sensor_msgs::ImageConstPtr& imageMsg3,
+dataCallback(const multicam_msgs::FrameSetConstPtr& frameSetMsg,
+             const std::vector<std::string>& cameraNsVec,
              std::vector<cv::Mat>& imageVec,
              px::DataBuffer<sensor_msgs::ImuConstPtr>& imuBuffer,
              boost::shared_ptr<px::GCamSLAM>& slam)
 {
-    ros::Time stamp = imageMsg0->header.stamp;
+    // all images in a frame set share the same stamp
+    ros::Time stamp = frameSetMsg->header.stamp;
 
     sensor_msgs::ImuConstPtr imuMsg;
     if (!imuBuffer.find(stamp, imuMsg))
@@ -42,24 +80,8 @@ dataCallback(const sensor_msgs::ImageConstPtr& imageMsg0,
         return;
     }
 
-    std::vector<sensor_msgs::ImageConstPtr> imageMsgs;
-    imageMsgs.push_back(imageMsg0);
-    imageMsgs.push_back(imageMsg1);
-    imageMsgs.push_back(imageMsg2);
-    imageMsgs.push_back(imageMsg3);
-
-    try
+    if (!readFrameSet(frameSetMsg, cameraNsVec, imageVec))
     {
-        for (size_t i = 0; i < imageMsgs.size(); ++i)
-        {
-            cv_bridge::CvImageConstPtr cv_ptr = cv_bridge::toCvShare(imageMsgs.at(i));
-
-            cv_ptr->image.copyTo(imageVec.at(i));
-        }
-    }
-    catch (cv_bridge::Exception& e)
-    {
-        ROS_ERROR("cv_bridge exception: %s", e.what());
         return;
     }
 
@@ -85,6 +107,22 @@ int main(int argc, char** argv)
 
     ros::NodeHandle pnh("~");
 
+    // RANSAC draws from generators derived from this seed, so that runs
+    // on the same data are reproducible
+    int randomSeed;
+    pnh.param("random_seed", randomSeed, 0);
+    px::setRandomSeed(randomSeed);
+
+    // per-stage timing statistics go to /diagnostics, and optionally to
+    // a Chrome trace file
+    px::ProfilerDiagnostics profilerDiagnostics(nh, "gcam_slam");
+
+    std::string traceFilename;
+    if (pnh.getParam("trace_file", traceFilename))
+    {
+        profilerDiagnostics.startTrace(traceFilename);
+    }
+
     // get IMU topic name
     std::string imuTopicName;
     if (!pnh.getParam("imu_topic", imuTopicName))
@@ -109,6 +147,14 @@ int main(int argc, char** argv)
         return 1;
     }
 
+    // get frame set topic name
+    std::string frameSetTopicName;
+    if (!pnh.getParam("frame_set_topic", frameSetTopicName))
+    {
+        ROS_ERROR("Cannot retrieve parameter: frame_set_topic");
+        return 1;
+    }
+
     // get namespaces of all cameras
     std::vector<std::string> cameraNsVec;
     while (1)
@@ -122,7 +168,8 @@ int main(int argc, char** argv)
             break;
         }
 
-        cameraNsVec.push_back(cameraNs);
+        // frame sets identify cameras by their resolved namespace
+        cameraNsVec.push_back(ros::names::resolve(cameraNs));
     }
 
     if (cameraNsVec.empty())
@@ -194,31 +241,30 @@ int main(int argc, char** argv)
         return 1;
     }
 
-    std::vector<cv::Mat> imageVec(cameraSystem->cameraCount());
-    px::DataBuffer<sensor_msgs::ImuConstPtr> imuBuffer(50);
-    ros::Subscriber imuSub = nh.subscribe<sensor_msgs::Imu>(imuTopicName, 10, boost::bind(imuCallback, _1, boost::ref(imuBuffer)));
-
-    std::vector<boost::shared_ptr<message_filters::Subscriber<sensor_msgs::Image> > > imageSubs(cameraSystem->cameraCount());
-    for (size_t i = 0; i < cameraNsVec.size(); ++i)
+    // bound the memory of long runs by spilling old parts of the map to
+    // disk, from where loop closure reads them back
+    std::string mapSpillDir;
+    if (pnh.getParam("map_spill_dir", mapSpillDir))
     {
-        imageSubs.at(i) = boost::make_shared<message_filters::Subscriber<sensor_msgs::Image> >(boost::ref(nh),
-                                                                                               ros::names::append(cameraNsVec.at(i), "image_raw"),
-                                                                                               1);
+        int maxResidentMapSegments;
+        pnh.param("max_resident_map_segments", maxResidentMapSegments, 20);
+
+        if (!slam->setMapSpilling(mapSpillDir, maxResidentMapSegments))
+        {
+            return 1;
+        }
     }
 
-    // assume for now that 4 cameras are used
-    message_filters::TimeSynchronizer<sensor_msgs::Image,
-                                      sensor_msgs::Image,
-                                      sensor_msgs::Image,
-                                      sensor_msgs::Image> sync(*imageSubs.at(0),
-                                                               *imageSubs.at(1),
-                                                               *imageSubs.at(2),
-                                                               *imageSubs.at(3),
-                                                               1);
-    sync.registerCallback(boost::bind(dataCallback, _1, _2, _3, _4,
-                                      boost::ref(imageVec),
-                                      boost::ref(imuBuffer),
-                                      boost::ref(slam)));
+    std::vector<cv::Mat> imageVec(cameraSystem->cameraCount());
+    px::DataBuffer<sensor_msgs::ImuConstPtr> imuBuffer(50);
+    ros::Subscriber imuSub = nh.subscribe<sensor_msgs::Imu>(imuTopicName, 10, boost::bind(imuCallback, _1, boost::ref(imuBuffer), boost::ref(slam)));
+
+    ros::Subscriber frameSetSub = nh.subscribe<multicam_msgs::FrameSet>(frameSetTopicName, 1,
+                                                                        boost::bind(dataCallback, _1,
+                                                                                    boost::cref(cameraNsVec),
+                                                                                    boost::ref(imageVec),
+                                                                                    boost::ref(imuBuffer),
+                                                                                    boost::ref(slam)));
 
     ros::AsyncSpinner spinner(0);
     spinner.start();
@@ -0,0 +1,282 @@
+#include <boost/filesystem.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/unordered_map.hpp>
+#include <boost/unordered_set.hpp>
+#include <gtest/gtest.h>
+
+#include "gcam_slam/MapManager.h"
+#include "synthetic_scene/SyntheticScene.h"
+
+namespace px
+{
+
+void
+generateFrameSets(const CameraSystemConstPtr& cameraSystem,
+                  size_t frameSetCount,
+                  std::vector<FrameSetPtr>& frameSets)
+{
+    SyntheticScene scene(cameraSystem);
+    scene.scenePointCount() = 5000;
+    scene.frameSetCount() = frameSetCount;
+    scene.frameRate() = 10.0;
+    scene.maxFeaturesPerFrame() = 150;
+
+    SparseGraphPtr graph = boost::make_shared<SparseGraph>();
+    scene.generateGraph(graph);
+
+    frameSets = graph->frameSetSegment(0);
+}
+
+// Every observation of a scene point is in a resident frame set, tracks
+// only link consecutive resident frame sets, and no two scene points of
+// the synthetic scene were merged.
+void
+checkConsistency(const SparseGraphConstPtr& graph)
+{
+    const FrameSetSegment& frameSets = graph->frameSetSegment(0);
+
+    boost::unordered_set<const FrameSet*> residentFrameSets;
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        residentFrameSets.insert(frameSets.at(i).get());
+    }
+
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        const FrameSetPtr& frameSet = frameSets.at(i);
+
+        if (frameSet->prevFrameSet())
+        {
+            EXPECT_EQ(frameSet.get(), frameSet->prevFrameSet()->nextFrameSet());
+        }
+
+        for (size_t j = 0; j < frameSet->frames().size(); ++j)
+        {
+            const std::vector<Point2DFeaturePtr>& features = frameSet->frames().at(j)->features2D();
+
+            for (size_t k = 0; k < features.size(); ++k)
+            {
+                const Point2DFeature* feature = features.at(k).get();
+
+                if (!feature->prevMatches().empty())
+                {
+                    ASSERT_EQ(frameSet->prevFrameSet(), feature->prevMatch()->frame()->frameSet());
+                    EXPECT_EQ(feature, feature->prevMatch()->nextMatch());
+                }
+
+                const Point3DFeatureConstPtr& scenePoint = feature->feature3D();
+                ASSERT_TRUE(scenePoint);
+
+                for (size_t l = 0; l < scenePoint->features2D().size(); ++l)
+                {
+                    const Point2DFeature* observation = scenePoint->features2D().at(l);
+
+                    ASSERT_TRUE(residentFrameSets.find(observation->frame()->frameSet()) != residentFrameSets.end());
+                    EXPECT_EQ(feature->index(), observation->index());
+                }
+            }
+        }
+    }
+}
+
+TEST(MapManager, Culling)
+{
+    CameraSystemPtr cameraSystem = SyntheticScene::createStereoCameraSystem();
+
+    std::vector<FrameSetPtr> frameSets;
+    generateFrameSets(cameraSystem, 60, frameSets);
+
+    SparseGraphPtr graph = boost::make_shared<SparseGraph>();
+
+    MapManager mapManager(cameraSystem, graph);
+    mapManager.protectedKeyFrameSetCount() = 5;
+
+    // the map manager must hold the only references
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        mapManager.addKeyFrameSet(frameSets.at(i));
+        frameSets.at(i).reset();
+    }
+
+    EXPECT_GT(mapManager.culledKeyFrameSetCount(), 0u);
+    EXPECT_EQ(60u, mapManager.residentKeyFrameSetCount() + mapManager.culledKeyFrameSetCount());
+
+    checkConsistency(graph);
+
+    // only the newest key frame set keeps the descriptors of the second
+    // camera of each stereo pair
+    const FrameSetSegment& residentFrameSets = graph->frameSetSegment(0);
+    for (size_t i = 0; i < residentFrameSets.size(); ++i)
+    {
+        const FrameSetPtr& frameSet = residentFrameSets.at(i);
+        bool newest = (i + 1 == residentFrameSets.size());
+
+        EXPECT_FALSE(frameSet->frame(0)->features2D().front()->descriptor().empty());
+        EXPECT_EQ(newest, !frameSet->frame(1)->features2D().front()->descriptor().empty());
+    }
+
+    std::vector<PoseConstPtr> poses;
+    mapManager.getSystemPoses(poses);
+    EXPECT_EQ(residentFrameSets.size(), poses.size());
+}
+
+TEST(MapManager, Fusion)
+{
+    CameraSystemPtr cameraSystem = SyntheticScene::createStereoCameraSystem();
+
+    std::vector<FrameSetPtr> frameSets;
+    generateFrameSets(cameraSystem, 10, frameSets);
+
+    size_t scenePointCount;
+    {
+        SparseGraphPtr graph = boost::make_shared<SparseGraph>();
+        graph->frameSetSegment(0) = frameSets;
+        scenePointCount = graph->scenePointCount();
+    }
+
+    // VO loses the tracks of half of the scene points at the sixth frame
+    // set and triangulates them again
+    boost::unordered_map<Point3DFeature*, Point3DFeaturePtr> duplicates;
+    for (size_t i = 5; i < frameSets.size(); ++i)
+    {
+        const FrameSetPtr& frameSet = frameSets.at(i);
+
+        for (size_t j = 0; j < frameSet->frames().size(); ++j)
+        {
+            std::vector<Point2DFeaturePtr>& features = frameSet->frames().at(j)->features2D();
+
+            for (size_t k = 0; k < features.size(); ++k)
+            {
+                Point2DFeature* feature = features.at(k).get();
+                Point3DFeaturePtr scenePoint = feature->feature3D();
+
+                if (feature->index() % 2 != 0)
+                {
+                    continue;
+                }
+
+                Point3DFeaturePtr& duplicate = duplicates[scenePoint.get()];
+                if (!duplicate)
+                {
+                    duplicate = boost::make_shared<Point3DFeature>();
+                    duplicate->point() = scenePoint->point();
+                }
+
+                std::vector<Point2DFeature*>& observations = scenePoint->features2D();
+                observations.erase(std::find(observations.begin(), observations.end(), feature));
+
+                duplicate->features2D().push_back(feature);
+                feature->feature3D() = duplicate;
+            }
+        }
+    }
+
+    SparseGraphPtr graph = boost::make_shared<SparseGraph>();
+
+    MapManager mapManager(cameraSystem, graph);
+    mapManager.redundancyRatio() = 2.0;
+
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        mapManager.addKeyFrameSet(frameSets.at(i));
+    }
+
+    EXPECT_EQ(0u, mapManager.culledKeyFrameSetCount());
+    EXPECT_GT(mapManager.mergedScenePointCount(), duplicates.size() / 4);
+
+    // duplicates that the first five frame sets never observed remain
+    EXPECT_LT(graph->scenePointCount(), scenePointCount + duplicates.size() / 2);
+
+    checkConsistency(graph);
+}
+
+TEST(MapManager, Spilling)
+{
+    CameraSystemPtr cameraSystem = SyntheticScene::createStereoCameraSystem();
+
+    std::vector<FrameSetPtr> frameSets;
+    generateFrameSets(cameraSystem, 60, frameSets);
+
+    std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > systemPoses;
+    std::vector<size_t> featureCounts;
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        systemPoses.push_back(frameSets.at(i)->systemPose()->toMatrix());
+        featureCounts.push_back(frameSets.at(i)->frame(0)->features2D().size());
+    }
+    size_t seq = frameSets.front()->seq();
+
+    boost::filesystem::path spillDir = boost::filesystem::temp_directory_path() /
+                                       boost::filesystem::unique_path("map_manager_test_%%%%%%%%");
+
+    SparseGraphPtr graph = boost::make_shared<SparseGraph>();
+
+    MapManager mapManager(cameraSystem, graph);
+    mapManager.segmentSize() = 10;
+    mapManager.maxResidentSegmentCount() = 2;
+    mapManager.protectedKeyFrameSetCount() = 5;
+    mapManager.redundancyRatio() = 2.0;
+    ASSERT_TRUE(mapManager.setSpillDirectory(spillDir.string()));
+
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        mapManager.addKeyFrameSet(frameSets.at(i));
+        frameSets.at(i).reset();
+    }
+
+    EXPECT_EQ(40u, mapManager.spilledKeyFrameSetCount());
+    EXPECT_EQ(20u, mapManager.residentKeyFrameSetCount());
+
+    checkConsistency(graph);
+
+    std::vector<PoseConstPtr> poses;
+    mapManager.getSystemPoses(poses);
+    ASSERT_EQ(60u, poses.size());
+    for (size_t i = 0; i < poses.size(); ++i)
+    {
+        EXPECT_TRUE(poses.at(i)->toMatrix().isApprox(systemPoses.at(i)));
+    }
+
+    // location recognition proposes a frame of the first key frame set
+    FrameTag tag;
+    tag.frameSetSegmentId = 0;
+    tag.frameSetId = seq;
+    tag.frameId = 0;
+
+    std::vector<FrameConstPtr> frames;
+    ASSERT_TRUE(mapManager.reloadFrames(std::vector<FrameTag>(1, tag), frames));
+    ASSERT_EQ(1u, frames.size());
+    EXPECT_EQ(30u, mapManager.spilledKeyFrameSetCount());
+    EXPECT_EQ(30u, mapManager.residentKeyFrameSetCount());
+
+    const FrameConstPtr& frame = frames.front();
+    EXPECT_EQ(seq, frame->frameSet()->seq());
+    EXPECT_TRUE(frame->frameSet()->systemPose()->toMatrix().isApprox(systemPoses.front()));
+    ASSERT_EQ(featureCounts.front(), frame->features2D().size());
+
+    for (size_t i = 0; i < frame->features2D().size(); ++i)
+    {
+        const Point2DFeatureConstPtr& feature = frame->features2D().at(i);
+
+        EXPECT_EQ(32, feature->descriptor().cols);
+        EXPECT_NEAR(1.0, feature->ray().norm(), 1e-6);
+        ASSERT_TRUE(feature->feature3D());
+        if (!feature->matches().empty())
+        {
+            EXPECT_EQ(1, feature->match()->frame()->cameraId());
+            EXPECT_EQ(feature->index(), feature->match()->index());
+        }
+    }
+
+    checkConsistency(graph);
+
+    boost::filesystem::remove_all(spillDir);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
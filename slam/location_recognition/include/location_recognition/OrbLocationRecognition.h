@@ -28,6 +28,26 @@ public:
 
     bool detectSimilarLocations(const FrameConstPtr& frame, int k,
                                 std::vector<FrameConstPtr>& matches);
+    // also returns the tags of similar frames that were removed
+    bool detectSimilarLocations(const FrameConstPtr& frame, int k,
+                                std::vector<FrameConstPtr>& matches,
+                                std::vector<FrameTag>& removedMatches);
+    // tags of all similar frames, removed or not; resolve them with
+    // findFrame()
+    bool detectSimilarLocations(const FrameConstPtr& frame, int k,
+                                std::vector<FrameTag>& matches);
+
+    // tag under which detectSimilarLocations() adds a frame
+    FrameTag frameTag(const FrameConstPtr& frame) const;
+
+    // Releases a frame added by detectSimilarLocations(). It stays in the
+    // database, so that queries still report it as a removed match, until
+    // it is restored.
+    void removeFrame(const FrameConstPtr& frame);
+    void restoreFrame(const FrameConstPtr& frame);
+
+    // frame with the given tag, or null if it was removed or never added
+    FrameConstPtr findFrame(const FrameTag& tag);
 
     void knnMatch(const FrameConstPtr& frame, int k, std::vector<FrameTag>& matches) const;
     void knnMatch(const FrameConstPtr& frame, int k, const std::vector<FrameTag>& validMatches,
@@ -151,13 +151,47 @@ OrbLocationRecognition::setup(const std::string& vocFilename,
 bool
 OrbLocationRecognition::detectSimilarLocations(const FrameConstPtr& frame, int k,
                                                std::vector<FrameConstPtr>& matches)
+{
+    std::vector<FrameTag> removedMatches;
+
+    return detectSimilarLocations(frame, k, matches, removedMatches);
+}
+
+bool
+OrbLocationRecognition::detectSimilarLocations(const FrameConstPtr& frame, int k,
+                                               std::vector<FrameConstPtr>& matches,
+                                               std::vector<FrameTag>& removedMatches)
+{
+    std::vector<FrameTag> tags;
+    detectSimilarLocations(frame, k, tags);
+
+    matches.reserve(tags.size());
+    removedMatches.clear();
+    for (size_t i = 0; i < tags.size(); ++i)
+    {
+        const FrameTag& match = tags.at(i);
+
+        FrameConstPtr frameMatch = findFrame(match);
+        if (frameMatch)
+        {
+            matches.push_back(frameMatch);
+        }
+        else
+        {
+            removedMatches.push_back(match);
+        }
+    }
+
+    return !matches.empty() || !removedMatches.empty();
+}
+
+bool
+OrbLocationRecognition::detectSimilarLocations(const FrameConstPtr& frame, int k,
+                                               std::vector<FrameTag>& matches)
 {
     std::vector<DVision::ORB::bitset> features = frameToFeatures(frame);
 
-    FrameTag tag;
-    tag.frameSetSegmentId = 0;
-    tag.frameSetId = frame->frameSet()->seq();
-    tag.frameId = frame->cameraId();
+    FrameTag tag = frameTag(frame);
 
     m_dbMutex.lock();
 
@@ -167,15 +201,16 @@ OrbLocationRecognition::detectSimilarLocations(const FrameConstPtr& frame, int k
 
     m_dbMutex.unlock();
 
-    std::vector<FrameConstPtr> rawMatches;
+    std::vector<FrameTag> rawMatches;
     knnMatch(frame, k, rawMatches);
 
+    matches.clear();
     matches.reserve(rawMatches.size());
     for (size_t i = 0; i < rawMatches.size(); ++i)
     {
-        FrameConstPtr& match = rawMatches.at(i);
+        const FrameTag& match = rawMatches.at(i);
 
-        if (std::abs(tag.frameSetId - match->frameSet()->seq()) < 10)
+        if (std::abs(tag.frameSetId - match.frameSetId) < 10)
         {
             continue;
         }
@@ -192,6 +227,59 @@ OrbLocationRecognition::detectSimilarLocations(const FrameConstPtr& frame, int k
     return !matches.empty();
 }
 
+FrameTag
+OrbLocationRecognition::frameTag(const FrameConstPtr& frame) const
+{
+    FrameTag tag;
+    tag.frameSetSegmentId = 0;
+    tag.frameSetId = frame->frameSet()->seq();
+    tag.frameId = frame->cameraId();
+
+    return tag;
+}
+
+void
+OrbLocationRecognition::removeFrame(const FrameConstPtr& frame)
+{
+    boost::mutex::scoped_lock lock(m_dbMutex);
+
+    boost::unordered_map<FrameTag, size_t>::iterator it = m_frameTagMap.find(frameTag(frame));
+    if (it == m_frameTagMap.end())
+    {
+        return;
+    }
+
+    m_frames.at(it->second).reset();
+}
+
+void
+OrbLocationRecognition::restoreFrame(const FrameConstPtr& frame)
+{
+    boost::mutex::scoped_lock lock(m_dbMutex);
+
+    boost::unordered_map<FrameTag, size_t>::iterator it = m_frameTagMap.find(frameTag(frame));
+    if (it == m_frameTagMap.end())
+    {
+        return;
+    }
+
+    m_frames.at(it->second) = frame;
+}
+
+FrameConstPtr
+OrbLocationRecognition::findFrame(const FrameTag& tag)
+{
+    boost::mutex::scoped_lock lock(m_dbMutex);
+
+    boost::unordered_map<FrameTag, size_t>::iterator it = m_frameTagMap.find(tag);
+    if (it == m_frameTagMap.end())
+    {
+        return FrameConstPtr();
+    }
+
+    return m_frames.at(it->second);
+}
+
 void
 OrbLocationRecognition::knnMatch(const FrameConstPtr& frame, int k,
                                  std::vector<FrameTag>& matches) const
@@ -261,6 +349,12 @@ OrbLocationRecognition::knnMatch(const FrameConstPtr& frame, int k,
     {
         const FrameConstPtr& frame = m_frames.at(ret.at(i).Id);
 
+        // removed frames
+        if (!frame)
+        {
+            continue;
+        }
+
         matches.push_back(frame);
     }
 }
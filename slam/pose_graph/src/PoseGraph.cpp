@@ -7,8 +7,9 @@
 #include <ros/ros.h>
 
 #include "cauldron/EigenQuaternionParameterization.h"
+#include "cauldron/Random.h"
 #include "location_recognition/OrbLocationRecognition.h"
-#include "pose_estimation/P3P.h"
+#include "pose_estimation/AbsolutePoseBatch.h"
 #include "PoseGraphError.h"
 
 namespace px
@@ -612,76 +613,56 @@ PoseGraph::solveP3PRansac(const FrameConstPtr& frame1,
     double u = 1.0 - v;
     int N = static_cast<int>(log(1.0 - p) / log(1.0 - u * u * u) + 0.5);
 
-    std::vector<size_t> indices;
-    for (size_t i = 0; i < matches.size(); ++i)
-    {
-        indices.push_back(i);
-    }
-
     const std::vector<Point2DFeaturePtr>& features1 = frame1->features2D();
     const std::vector<Point2DFeaturePtr>& features2 = frame2->features2D();
 
-    // run RANSAC to find best H
-    Eigen::Matrix4d H_best;
-    std::vector<size_t> inlierIds_best;
-    for (int i = 0; i < N; ++i)
+    AbsolutePoseBatch batch;
+    batch.reserve(matches.size());
+    for (size_t i = 0; i < matches.size(); ++i)
     {
-        std::random_shuffle(indices.begin(), indices.end());
-
-        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > rays(3);
-        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > worldPoints(3);
-        for (int j = 0; j < 3; ++j)
-        {
-            const cv::DMatch& match = matches.at(indices.at(j));
+        const cv::DMatch& match = matches.at(i);
 
-            worldPoints.at(j) = features1.at(match.queryIdx)->feature3D()->point();
-            rays.at(j) = features2.at(match.trainIdx)->ray();
-        }
+        batch.add(features1.at(match.queryIdx)->feature3D()->point(),
+                  features2.at(match.trainIdx)->ray());
+    }
 
-        std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > solutions;
-        if (!solveP3P(rays, worldPoints, solutions))
+    Xoshiro256& rng = threadRng();
+    std::vector<size_t> sampleIds, sample;
+    sampleIds.reserve(N * 3);
+    for (int i = 0; i < N; ++i)
+    {
+        if (!sampleKofN(rng, 3, matches.size(), sample))
         {
-            continue;
+            break;
         }
 
-        for (size_t j = 0; j < solutions.size(); ++j)
-        {
-            Eigen::Matrix4d H_inv = solutions.at(j).inverse();
-
-            std::vector<size_t> inliersIds;
-            for (size_t k = 0; k < matches.size(); ++k)
-            {
-                const cv::DMatch& match = matches.at(k);
-
-                Eigen::Vector3d P1 = features1.at(match.queryIdx)->feature3D()->point();
-
-                Eigen::Vector3d P2 = transformPoint(H_inv, P1);
-
-                const Point2DFeatureConstPtr& f2 = features2.at(match.trainIdx);
+        sampleIds.insert(sampleIds.end(), sample.begin(), sample.end());
+    }
 
-                double err = fabs(P2.normalized().dot(f2->ray()));
-                if (err < k_sphericalErrorThresh)
-                {
-                    continue;
-                }
+    // run RANSAC to find best H
+    Eigen::Matrix4d H_best = Eigen::Matrix4d::Identity();
+    size_t nInliers_best = 0;
+    if (!sampleIds.empty())
+    {
+        batch.solveAndScore(&sampleIds[0], sampleIds.size() / 3,
+                            k_sphericalErrorThresh, H_best, nInliers_best);
+    }
 
-                inliersIds.push_back(k);
-            }
+    if (nInliers_best > 0)
+    {
+        std::vector<bool> inlierFlags;
+        batch.inliers(H_best, k_sphericalErrorThresh, inlierFlags);
 
-            if (inliersIds.size() > inlierIds_best.size())
+        for (size_t i = 0; i < inlierFlags.size(); ++i)
+        {
+            if (inlierFlags.at(i))
             {
-                H_best = H_inv;
-                inlierIds_best = inliersIds;
+                inliers.push_back(matches.at(i));
             }
         }
     }
 
-    for (size_t i = 0; i < inlierIds_best.size(); ++i)
-    {
-        inliers.push_back(matches.at(inlierIds_best.at(i)));
-    }
-
-    H = m_cameraSystem->getGlobalCameraPose(frame2->cameraId()) * H_best;
+    H = m_cameraSystem->getGlobalCameraPose(frame2->cameraId()) * H_best.inverse();
 }
 
 }
@@ -1,32 +1,106 @@
 #ifndef SPARSEGRAPHVIZ_H
 #define SPARSEGRAPHVIZ_H
 
+#include <boost/thread.hpp>
+#include <map>
 #include <ros/ros.h>
+#include <visualization_msgs/Marker.h>
 
 #include "sparse_graph/SparseGraph.h"
 
 namespace px
 {
 
+// Publishes the scene points and system poses of segment 0 of a sparse
+// graph as markers. Nothing is done while no one subscribes.
+//
+// With a window size of 0, the segment is published as one map marker
+// and one pose marker per chunk of chunkSize() consecutive frame set
+// sequence numbers, with the chunk number as marker ID. Only chunks whose
+// frame sets, poses or loop closure edges changed since the last call
+// are rebuilt and published, and chunks whose frame sets are all gone
+// are deleted.
 class SparseGraphViz
 {
 public:
     SparseGraphViz(ros::NodeHandle& nh,
                    const SparseGraphConstPtr& sparseGraph,
                    const std::string& ns = "");
+    ~SparseGraphViz();
+
+    int& chunkSize(void);
 
     void visualize(int windowSize = 0);
 
+    // Visualizes the whole segment at most maxRate times per second on a
+    // low-priority thread, which holds graphMutex only while it copies
+    // from the graph. Everything that changes the frame sets, frames and
+    // scene points of the graph must hold graphMutex too, including
+    // visual odometry linking a new frame set to the last key frame set.
+    // Do not call visualize() until the thread is stopped.
+    void startThread(boost::mutex& graphMutex, double maxRate);
+    void stopThread(void);
+
 private:
+    struct Chunk
+    {
+        Chunk();
+
+        size_t frameSetCount;
+        size_t loopClosureEdgeCount;
+        // fingerprint of the system poses
+        double poseSignature;
+    };
+
+    // what a changed chunk draws, copied from the graph
+    struct ChunkData
+    {
+        ChunkData();
+
+        int id;
+        // system to world
+        std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > poses;
+        // position of the first frame set of the next chunk
+        bool hasNext;
+        Eigen::Vector3d nextPosition;
+        // pairs of end points
+        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > loopClosureEdges;
+        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > scenePoints;
+    };
+
     void visualizeMap(int windowSize);
     void visualizePoses(void);
-    
+
+    bool hasSubscribers(void);
+    int chunkId(size_t seq) const;
+    void copyChangedChunks(std::vector<ChunkData>& chunks,
+                           std::vector<int>& deletedChunkIds);
+    void publishChunks(const std::vector<ChunkData>& chunks,
+                       const std::vector<int>& deletedChunkIds);
+
+    void initMapMarker(visualization_msgs::Marker& marker, int id) const;
+    void initPoseMarker(visualization_msgs::Marker& marker, int id) const;
+    void addAxes(visualization_msgs::Marker& marker,
+                 const Eigen::Matrix4d& H_world_sys) const;
+
+    void vizThread(boost::mutex* graphMutex, double maxRate);
+
     ros::NodeHandle m_nh;
     ros::Publisher m_mapVizPub;
     ros::Publisher m_poseVizPub;
 
     const SparseGraphConstPtr k_sparseGraph;
     const std::string k_ns;
+
+    std::map<int, Chunk> m_chunks;
+    size_t m_subscriberCount;
+
+    boost::mutex m_threadMutex;
+    boost::condition_variable m_threadCond;
+    bool m_threadRunning;
+    boost::shared_ptr<boost::thread> m_thread;
+
+    int k_chunkSize;
 };
 
 }
@@ -1,71 +1,144 @@
 #include "sparse_graph/SparseGraphViz.h"
 
+#include <boost/make_shared.hpp>
 #include <boost/unordered_set.hpp>
-#include <visualization_msgs/Marker.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
 
 #include "cauldron/EigenUtils.h"
 
 namespace px
 {
 
+namespace
+{
+
+geometry_msgs::Point
+toPoint(const Eigen::Vector3d& P)
+{
+    geometry_msgs::Point p;
+    p.x = P(0);
+    p.y = P(1);
+    p.z = P(2);
+
+    return p;
+}
+
+double
+poseSignature(const FrameSet* frameSet)
+{
+    const PoseConstPtr& pose = frameSet->systemPose();
+
+    return pose->translation().sum() +
+           pose->rotation().coeffs().dot(Eigen::Vector4d(1.0, 2.0, 3.0, 4.0)) +
+           frameSet->seq();
+}
+
+}
+
+SparseGraphViz::Chunk::Chunk()
+ : frameSetCount(0)
+ , loopClosureEdgeCount(0)
+ , poseSignature(0.0)
+{
+
+}
+
+SparseGraphViz::ChunkData::ChunkData()
+ : id(0)
+ , hasNext(false)
+ , nextPosition(Eigen::Vector3d::Zero())
+{
+
+}
+
 SparseGraphViz::SparseGraphViz(ros::NodeHandle& nh,
                                const SparseGraphConstPtr& sparseGraph,
                                const std::string& ns)
  : m_nh(nh)
  , k_sparseGraph(sparseGraph)
  , k_ns(ns)
+ , m_subscriberCount(0)
+ , m_threadRunning(false)
+ , k_chunkSize(50)
 {
-    m_mapVizPub = nh.advertise<visualization_msgs::Marker>("map_marker", 1);
-    m_poseVizPub = nh.advertise<visualization_msgs::Marker>("pose_marker", 1);
+    // chunks are published in bursts
+    m_mapVizPub = nh.advertise<visualization_msgs::Marker>("map_marker", 100);
+    m_poseVizPub = nh.advertise<visualization_msgs::Marker>("pose_marker", 100);
 }
 
-void
-SparseGraphViz::visualize(int windowSize)
+SparseGraphViz::~SparseGraphViz()
 {
-    visualizeMap(windowSize);
-    visualizePoses();
+    stopThread();
 }
 
-void
-SparseGraphViz::visualizeMap(int windowSize)
+int&
+SparseGraphViz::chunkSize(void)
 {
-    visualization_msgs::Marker marker;
-
-    marker.header.frame_id = "vmav";
-    marker.header.stamp = ros::Time::now();
+    return k_chunkSize;
+}
 
-    if (k_ns.empty())
+void
+SparseGraphViz::visualize(int windowSize)
+{
+    if (!hasSubscribers())
     {
-        marker.ns = "map";
+        return;
     }
-    else
+
+    if (windowSize > 0)
     {
-        marker.ns = k_ns + "_map";
+        visualizeMap(windowSize);
+        visualizePoses();
+
+        // the window markers replace the first chunk
+        m_chunks.clear();
+
+        return;
     }
-    marker.id = 0;
 
-    marker.type = visualization_msgs::Marker::SPHERE_LIST;
+    std::vector<ChunkData> chunks;
+    std::vector<int> deletedChunkIds;
+    copyChangedChunks(chunks, deletedChunkIds);
+    publishChunks(chunks, deletedChunkIds);
+}
 
-    marker.action = visualization_msgs::Marker::ADD;
+void
+SparseGraphViz::startThread(boost::mutex& graphMutex, double maxRate)
+{
+    if (m_thread || maxRate <= 0.0)
+    {
+        return;
+    }
 
-    marker.pose.position.x = 0.0;
-    marker.pose.position.y = 0.0;
-    marker.pose.position.z = 0.0;
-    marker.pose.orientation.x = 0.0;
-    marker.pose.orientation.y = 0.0;
-    marker.pose.orientation.z = 0.0;
-    marker.pose.orientation.w = 1.0;
+    m_threadRunning = true;
+    m_thread = boost::make_shared<boost::thread>(boost::bind(&SparseGraphViz::vizThread, this, &graphMutex, maxRate));
+}
 
-    marker.scale.x = 0.02;
-    marker.scale.y = 0.0;
-    marker.scale.z = 0.0;
+void
+SparseGraphViz::stopThread(void)
+{
+    if (!m_thread)
+    {
+        return;
+    }
 
-    marker.color.r = 0.0f;
-    marker.color.g = 1.0f;
-    marker.color.b = 0.0f;
-    marker.color.a = 1.0f;
+    {
+        boost::lock_guard<boost::mutex> lock(m_threadMutex);
+        m_threadRunning = false;
+    }
+    m_threadCond.notify_one();
 
-    marker.lifetime = ros::Duration();
+    m_thread->join();
+    m_thread.reset();
+}
+
+void
+SparseGraphViz::visualizeMap(int windowSize)
+{
+    visualization_msgs::Marker marker;
+    initMapMarker(marker, 0);
 
     const FrameSetSegment& frameSetSegment = k_sparseGraph->frameSetSegment(0);
 
@@ -114,14 +187,7 @@ SparseGraphViz::visualizeMap(int windowSize)
     for (boost::unordered_set<Point3DFeatureConstPtr>::iterator it = scenePointMap.begin();
          it != scenePointMap.end(); ++it)
     {
-        Eigen::Vector3d P = (*it)->point();
-
-        geometry_msgs::Point p;
-        p.x = P(0);
-        p.y = P(1);
-        p.z = P(2);
-
-        marker.points.push_back(p);
+        marker.points.push_back(toPoint((*it)->point()));
     }
 
     m_mapVizPub.publish(marker);
@@ -131,107 +197,15 @@ void
 SparseGraphViz::visualizePoses(void)
 {
     visualization_msgs::Marker marker;
-
-    marker.header.frame_id = "vmav";
-    marker.header.stamp = ros::Time::now();
-
-    if (k_ns.empty())
-    {
-        marker.ns = "cam_poses";
-    }
-    else
-    {
-        marker.ns = k_ns + "_cam_poses";
-    }
-    marker.id = 0;
-
-    marker.type = visualization_msgs::Marker::LINE_LIST;
-
-    marker.action = visualization_msgs::Marker::ADD;
-
-    marker.pose.position.x = 0.0;
-    marker.pose.position.y = 0.0;
-    marker.pose.position.z = 0.0;
-    marker.pose.orientation.x = 0.0;
-    marker.pose.orientation.y = 0.0;
-    marker.pose.orientation.z = 0.0;
-    marker.pose.orientation.w = 1.0;
-
-    marker.scale.x = 0.01;
-    marker.scale.y = 0.0;
-    marker.scale.z = 0.0;
-
-    marker.color.r = 0.0f;
-    marker.color.g = 1.0f;
-    marker.color.b = 0.0f;
-    marker.color.a = 1.f;
-
-    marker.lifetime = ros::Duration();
-
-    std_msgs::ColorRGBA axisColors[3];
-
-    // x-axis
-    axisColors[0].r = 1.0f;
-    axisColors[0].g = 0.0f;
-    axisColors[0].b = 0.0f;
-
-    // y-axis
-    axisColors[1].r = 0.0f;
-    axisColors[1].g = 1.0f;
-    axisColors[1].b = 0.0f;
-
-    // z-axis
-    axisColors[2].r = 0.0f;
-    axisColors[2].g = 0.0f;
-    axisColors[2].b = 1.0f;
-
-    double axisLength = 0.1;
+    initPoseMarker(marker, 0);
 
     const FrameSetSegment& frameSetSegment = k_sparseGraph->frameSetSegment(0);
 
     for (size_t i = 0; i < frameSetSegment.size(); ++i)
     {
         Eigen::Matrix4d systemPose = frameSetSegment.at(i)->systemPose()->toMatrix();
-        Eigen::Matrix4d systemPose_inv = invertHomogeneousTransform(systemPose);
-
-        geometry_msgs::Point p[4];
-
-        Eigen::Vector3d p_o = systemPose_inv.block<3,1>(0,3);
-        p[0].x = p_o(0);
-        p[0].y = p_o(1);
-        p[0].z = p_o(2);
 
-        // point along x-axis
-        Eigen::Vector3d p_x = transformPoint(systemPose_inv, Eigen::Vector3d(axisLength, 0.0, 0.0));
-        p[1].x = p_x(0);
-        p[1].y = p_x(1);
-        p[1].z = p_x(2);
-
-        // point along y-axis
-        Eigen::Vector3d p_y = transformPoint(systemPose_inv, Eigen::Vector3d(0.0, axisLength, 0.0));
-        p[2].x = p_y(0);
-        p[2].y = p_y(1);
-        p[2].z = p_y(2);
-
-        // point along z-axis
-        Eigen::Vector3d p_z = transformPoint(systemPose_inv, Eigen::Vector3d(0.0, 0.0, axisLength));
-        p[3].x = p_z(0);
-        p[3].y = p_z(1);
-        p[3].z = p_z(2);
-
-        marker.points.push_back(p[0]);
-        marker.points.push_back(p[1]);
-        marker.points.push_back(p[0]);
-        marker.points.push_back(p[2]);
-        marker.points.push_back(p[0]);
-        marker.points.push_back(p[3]);
-
-        marker.colors.push_back(axisColors[0]);
-        marker.colors.push_back(axisColors[0]);
-        marker.colors.push_back(axisColors[1]);
-        marker.colors.push_back(axisColors[1]);
-        marker.colors.push_back(axisColors[2]);
-        marker.colors.push_back(axisColors[2]);
+        addAxes(marker, invertHomogeneousTransform(systemPose));
     }
 
     // VO edges
@@ -243,11 +217,7 @@ SparseGraphViz::visualizePoses(void)
             Eigen::Matrix4d systemPose = frameSetSegment.at(i)->systemPose()->toMatrix();
             Eigen::Matrix4d systemPose_inv = invertHomogeneousTransform(systemPose);
 
-            Eigen::Vector3d p = systemPose_inv.block<3,1>(0,3);
-
-            positions.at(i).x = p(0);
-            positions.at(i).y = p(1);
-            positions.at(i).z = p(2);
+            positions.at(i) = toPoint(systemPose_inv.block<3,1>(0,3));
         }
 
         std_msgs::ColorRGBA color;
@@ -287,10 +257,7 @@ SparseGraphViz::visualizePoses(void)
 
             Eigen::Matrix4d systemPose1 = frameSet1->systemPose()->toMatrix();
             Eigen::Matrix4d systemPose1_inv = invertHomogeneousTransform(systemPose1);
-            geometry_msgs::Point p1;
-            p1.x = systemPose1_inv(0,3);
-            p1.y = systemPose1_inv(1,3);
-            p1.z = systemPose1_inv(2,3);
+            geometry_msgs::Point p1 = toPoint(systemPose1_inv.block<3,1>(0,3));
 
             for (size_t k = 0; k < frame1->loopClosureEdges().size(); ++k)
             {
@@ -301,10 +268,7 @@ SparseGraphViz::visualizePoses(void)
 
                 Eigen::Matrix4d systemPose2 = frameSet2->systemPose()->toMatrix();
                 Eigen::Matrix4d systemPose2_inv = invertHomogeneousTransform(systemPose2);
-                geometry_msgs::Point p2;
-                p2.x = systemPose2_inv(0,3);
-                p2.y = systemPose2_inv(1,3);
-                p2.z = systemPose2_inv(2,3);
+                geometry_msgs::Point p2 = toPoint(systemPose2_inv.block<3,1>(0,3));
 
                 marker.points.push_back(p1);
                 marker.points.push_back(p2);
@@ -318,4 +282,412 @@ SparseGraphViz::visualizePoses(void)
     m_poseVizPub.publish(marker);
 }
 
+bool
+SparseGraphViz::hasSubscribers(void)
+{
+    size_t subscriberCount = m_mapVizPub.getNumSubscribers() + m_poseVizPub.getNumSubscribers();
+
+    // markers are not latched, so new subscribers need all chunks
+    if (subscriberCount > m_subscriberCount)
+    {
+        m_chunks.clear();
+    }
+    m_subscriberCount = subscriberCount;
+
+    return subscriberCount > 0;
+}
+
+int
+SparseGraphViz::chunkId(size_t seq) const
+{
+    return seq / k_chunkSize;
+}
+
+void
+SparseGraphViz::copyChangedChunks(std::vector<ChunkData>& chunks,
+                                  std::vector<int>& deletedChunkIds)
+{
+    chunks.clear();
+    deletedChunkIds.clear();
+
+    const FrameSetSegment& frameSets = k_sparseGraph->frameSetSegment(0);
+
+    // fingerprint all chunks, which only reads the poses
+    std::map<int, Chunk> currentChunks;
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        const FrameSet* frameSet = frameSets.at(i).get();
+        int id = chunkId(frameSet->seq());
+
+        Chunk& chunk = currentChunks[id];
+        ++chunk.frameSetCount;
+        chunk.poseSignature += poseSignature(frameSet);
+
+        for (size_t j = 0; j < frameSet->frames().size(); ++j)
+        {
+            chunk.loopClosureEdgeCount += frameSet->frames().at(j)->loopClosureEdges().size();
+        }
+
+        // a chunk draws the VO edge to the next chunk
+        if (i > 0)
+        {
+            int prevId = chunkId(frameSets.at(i - 1)->seq());
+            if (prevId != id)
+            {
+                currentChunks[prevId].poseSignature += poseSignature(frameSet);
+            }
+        }
+    }
+
+    for (std::map<int, Chunk>::const_iterator it = m_chunks.begin(); it != m_chunks.end(); ++it)
+    {
+        if (currentChunks.find(it->first) == currentChunks.end())
+        {
+            deletedChunkIds.push_back(it->first);
+        }
+    }
+
+    std::map<int, size_t> changedChunks;
+    for (std::map<int, Chunk>::const_iterator it = currentChunks.begin(); it != currentChunks.end(); ++it)
+    {
+        std::map<int, Chunk>::const_iterator itPrev = m_chunks.find(it->first);
+        if (itPrev != m_chunks.end() &&
+            itPrev->second.frameSetCount == it->second.frameSetCount &&
+            itPrev->second.loopClosureEdgeCount == it->second.loopClosureEdgeCount &&
+            itPrev->second.poseSignature == it->second.poseSignature)
+        {
+            continue;
+        }
+
+        changedChunks[it->first] = chunks.size();
+
+        chunks.push_back(ChunkData());
+        chunks.back().id = it->first;
+    }
+
+    m_chunks.swap(currentChunks);
+
+    if (chunks.empty())
+    {
+        return;
+    }
+
+    // copy what the changed chunks draw
+    boost::unordered_set<const Point3DFeature*> scenePoints;
+    for (size_t i = 0; i < frameSets.size(); ++i)
+    {
+        const FrameSet* frameSet = frameSets.at(i).get();
+        int id = chunkId(frameSet->seq());
+
+        std::map<int, size_t>::const_iterator itChunk = changedChunks.find(id);
+        if (itChunk == changedChunks.end())
+        {
+            continue;
+        }
+
+        ChunkData& chunk = chunks.at(itChunk->second);
+
+        Eigen::Matrix4d H_world_sys = invertHomogeneousTransform(frameSet->systemPose()->toMatrix());
+        chunk.poses.push_back(H_world_sys);
+
+        if (i + 1 < frameSets.size() && chunkId(frameSets.at(i + 1)->seq()) != id)
+        {
+            chunk.hasNext = true;
+            chunk.nextPosition = invertHomogeneousTransform(frameSets.at(i + 1)->systemPose()->toMatrix()).block<3,1>(0,3);
+        }
+
+        for (size_t j = 0; j < frameSet->frames().size(); ++j)
+        {
+            const FrameConstPtr& frame = frameSet->frames().at(j);
+
+            for (size_t k = 0; k < frame->loopClosureEdges().size(); ++k)
+            {
+                const FrameSet* frameSet2 = frame->loopClosureEdges().at(k).inFrame()->frameSet();
+
+                chunk.loopClosureEdges.push_back(H_world_sys.block<3,1>(0,3));
+                chunk.loopClosureEdges.push_back(invertHomogeneousTransform(frameSet2->systemPose()->toMatrix()).block<3,1>(0,3));
+            }
+
+            // each scene point is drawn by the chunk of the oldest frame
+            // set that observes it; its observations may include the
+            // frame set that visual odometry is tracking, which only
+            // changes them with the graph mutex held
+            const std::vector<Point2DFeaturePtr>& features = frame->features2D();
+            for (size_t k = 0; k < features.size(); ++k)
+            {
+                const Point3DFeatureConstPtr& scenePoint = features.at(k)->feature3D();
+
+                if (!scenePoint || scenePoint->features2D().size() <= 2)
+                {
+                    continue;
+                }
+
+                if (!scenePoints.insert(scenePoint.get()).second)
+                {
+                    continue;
+                }
+
+                size_t minSeq = frameSet->seq();
+                const std::vector<Point2DFeature*>& observations = scenePoint->features2D();
+                for (size_t l = 0; l < observations.size(); ++l)
+                {
+                    minSeq = std::min(minSeq, observations.at(l)->frame()->frameSet()->seq());
+                }
+
+                if (chunkId(minSeq) == id)
+                {
+                    chunk.scenePoints.push_back(scenePoint->point());
+                }
+            }
+        }
+    }
+}
+
+void
+SparseGraphViz::publishChunks(const std::vector<ChunkData>& chunks,
+                              const std::vector<int>& deletedChunkIds)
+{
+    std_msgs::ColorRGBA voEdgeColor;
+    voEdgeColor.r = 0.5f;
+    voEdgeColor.g = 0.5f;
+    voEdgeColor.b = 0.5f;
+
+    std_msgs::ColorRGBA loopClosureEdgeColor;
+    loopClosureEdgeColor.r = 0.0f;
+    loopClosureEdgeColor.g = 1.0f;
+    loopClosureEdgeColor.b = 0.0f;
+
+    for (size_t i = 0; i < chunks.size(); ++i)
+    {
+        const ChunkData& chunk = chunks.at(i);
+
+        visualization_msgs::Marker mapMarker;
+        initMapMarker(mapMarker, chunk.id);
+
+        mapMarker.points.reserve(chunk.scenePoints.size());
+        for (size_t j = 0; j < chunk.scenePoints.size(); ++j)
+        {
+            mapMarker.points.push_back(toPoint(chunk.scenePoints.at(j)));
+        }
+
+        m_mapVizPub.publish(mapMarker);
+
+        visualization_msgs::Marker poseMarker;
+        initPoseMarker(poseMarker, chunk.id);
+
+        for (size_t j = 0; j < chunk.poses.size(); ++j)
+        {
+            addAxes(poseMarker, chunk.poses.at(j));
+        }
+
+        // VO edges
+        std::vector<geometry_msgs::Point> positions;
+        for (size_t j = 0; j < chunk.poses.size(); ++j)
+        {
+            positions.push_back(toPoint(chunk.poses.at(j).block<3,1>(0,3)));
+        }
+        if (chunk.hasNext)
+        {
+            positions.push_back(toPoint(chunk.nextPosition));
+        }
+
+        for (size_t j = 1; j < positions.size(); ++j)
+        {
+            poseMarker.points.push_back(positions.at(j - 1));
+            poseMarker.points.push_back(positions.at(j));
+
+            poseMarker.colors.push_back(voEdgeColor);
+            poseMarker.colors.push_back(voEdgeColor);
+        }
+
+        // loop closure edges
+        for (size_t j = 0; j < chunk.loopClosureEdges.size(); ++j)
+        {
+            poseMarker.points.push_back(toPoint(chunk.loopClosureEdges.at(j)));
+            poseMarker.colors.push_back(loopClosureEdgeColor);
+        }
+
+        m_poseVizPub.publish(poseMarker);
+    }
+
+    for (size_t i = 0; i < deletedChunkIds.size(); ++i)
+    {
+        visualization_msgs::Marker marker;
+
+        initMapMarker(marker, deletedChunkIds.at(i));
+        marker.action = visualization_msgs::Marker::DELETE;
+        m_mapVizPub.publish(marker);
+
+        initPoseMarker(marker, deletedChunkIds.at(i));
+        marker.action = visualization_msgs::Marker::DELETE;
+        m_poseVizPub.publish(marker);
+    }
+}
+
+void
+SparseGraphViz::initMapMarker(visualization_msgs::Marker& marker, int id) const
+{
+    marker.header.frame_id = "vmav";
+    marker.header.stamp = ros::Time::now();
+
+    if (k_ns.empty())
+    {
+        marker.ns = "map";
+    }
+    else
+    {
+        marker.ns = k_ns + "_map";
+    }
+    marker.id = id;
+
+    marker.type = visualization_msgs::Marker::SPHERE_LIST;
+
+    marker.action = visualization_msgs::Marker::ADD;
+
+    marker.pose.position.x = 0.0;
+    marker.pose.position.y = 0.0;
+    marker.pose.position.z = 0.0;
+    marker.pose.orientation.x = 0.0;
+    marker.pose.orientation.y = 0.0;
+    marker.pose.orientation.z = 0.0;
+    marker.pose.orientation.w = 1.0;
+
+    marker.scale.x = 0.02;
+    marker.scale.y = 0.0;
+    marker.scale.z = 0.0;
+
+    marker.color.r = 0.0f;
+    marker.color.g = 1.0f;
+    marker.color.b = 0.0f;
+    marker.color.a = 1.0f;
+
+    marker.lifetime = ros::Duration();
+}
+
+void
+SparseGraphViz::initPoseMarker(visualization_msgs::Marker& marker, int id) const
+{
+    marker.header.frame_id = "vmav";
+    marker.header.stamp = ros::Time::now();
+
+    if (k_ns.empty())
+    {
+        marker.ns = "cam_poses";
+    }
+    else
+    {
+        marker.ns = k_ns + "_cam_poses";
+    }
+    marker.id = id;
+
+    marker.type = visualization_msgs::Marker::LINE_LIST;
+
+    marker.action = visualization_msgs::Marker::ADD;
+
+    marker.pose.position.x = 0.0;
+    marker.pose.position.y = 0.0;
+    marker.pose.position.z = 0.0;
+    marker.pose.orientation.x = 0.0;
+    marker.pose.orientation.y = 0.0;
+    marker.pose.orientation.z = 0.0;
+    marker.pose.orientation.w = 1.0;
+
+    marker.scale.x = 0.01;
+    marker.scale.y = 0.0;
+    marker.scale.z = 0.0;
+
+    marker.color.r = 0.0f;
+    marker.color.g = 1.0f;
+    marker.color.b = 0.0f;
+    marker.color.a = 1.f;
+
+    marker.lifetime = ros::Duration();
+}
+
+void
+SparseGraphViz::addAxes(visualization_msgs::Marker& marker,
+                        const Eigen::Matrix4d& H_world_sys) const
+{
+    std_msgs::ColorRGBA axisColors[3];
+
+    // x-axis
+    axisColors[0].r = 1.0f;
+    axisColors[0].g = 0.0f;
+    axisColors[0].b = 0.0f;
+
+    // y-axis
+    axisColors[1].r = 0.0f;
+    axisColors[1].g = 1.0f;
+    axisColors[1].b = 0.0f;
+
+    // z-axis
+    axisColors[2].r = 0.0f;
+    axisColors[2].g = 0.0f;
+    axisColors[2].b = 1.0f;
+
+    double axisLength = 0.1;
+
+    geometry_msgs::Point p[4];
+
+    p[0] = toPoint(H_world_sys.block<3,1>(0,3));
+
+    // points along x-, y- and z-axes
+    p[1] = toPoint(transformPoint(H_world_sys, Eigen::Vector3d(axisLength, 0.0, 0.0)));
+    p[2] = toPoint(transformPoint(H_world_sys, Eigen::Vector3d(0.0, axisLength, 0.0)));
+    p[3] = toPoint(transformPoint(H_world_sys, Eigen::Vector3d(0.0, 0.0, axisLength)));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        marker.points.push_back(p[0]);
+        marker.points.push_back(p[i + 1]);
+
+        marker.colors.push_back(axisColors[i]);
+        marker.colors.push_back(axisColors[i]);
+    }
+}
+
+void
+SparseGraphViz::vizThread(boost::mutex* graphMutex, double maxRate)
+{
+    // visualization must not take CPU time from tracking
+    if (setpriority(PRIO_PROCESS, syscall(SYS_gettid), 19) != 0)
+    {
+        ROS_WARN("Failed to lower the priority of the visualization thread.");
+    }
+
+    boost::posix_time::time_duration period = boost::posix_time::microseconds(static_cast<int64_t>(1e6 / maxRate));
+
+    std::vector<ChunkData> chunks;
+    std::vector<int> deletedChunkIds;
+    while (true)
+    {
+        {
+            boost::unique_lock<boost::mutex> lock(m_threadMutex);
+
+            if (m_threadRunning)
+            {
+                m_threadCond.timed_wait(lock, period);
+            }
+
+            if (!m_threadRunning)
+            {
+                break;
+            }
+        }
+
+        if (!hasSubscribers())
+        {
+            continue;
+        }
+
+        {
+            boost::lock_guard<boost::mutex> lock(*graphMutex);
+
+            copyChangedChunks(chunks, deletedChunkIds);
+        }
+
+        publishChunks(chunks, deletedChunkIds);
+    }
+}
+
 }
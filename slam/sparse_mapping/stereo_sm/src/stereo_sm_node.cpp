@@ -1,8 +1,10 @@
+#include <algorithm>
 #include <boost/foreach.hpp>
 #include <boost/program_options.hpp>
 #include <cv_bridge/cv_bridge.h>
 #include <message_filters/subscriber.h>
 #include <message_filters/time_synchronizer.h>
+#include <multicam_msgs/FrameSet.h>
 #include <px_comm/CameraInfo.h>
 #include <ros/ros.h>
 #include <rosbag/bag.h>
@@ -13,9 +15,11 @@
 #include "stereo_sm/StereoSM.h"
 
 void
-voCallback(const sensor_msgs::ImageConstPtr& imageMsg1,
-           const sensor_msgs::ImageConstPtr& imageMsg2,
-           boost::shared_ptr<px::StereoSM> ssm)
+processFrames(const ros::Time& stamp,
+              const sensor_msgs::Image& imageMsg1,
+              const sensor_msgs::Image& imageMsg2,
+              const boost::shared_ptr<void const>& trackedObject,
+              boost::shared_ptr<px::StereoSM> ssm)
 {
     cv_bridge::CvImageConstPtr cv_ptr;
 
@@ -23,10 +27,10 @@ voCallback(const sensor_msgs::ImageConstPtr& imageMsg1,
 
     try
     {
-        cv_ptr = cv_bridge::toCvShare(imageMsg1);
+        cv_ptr = cv_bridge::toCvShare(imageMsg1, trackedObject);
         cv_ptr->image.copyTo(image1);
 
-        cv_ptr = cv_bridge::toCvShare(imageMsg2);
+        cv_ptr = cv_bridge::toCvShare(imageMsg2, trackedObject);
         cv_ptr->image.copyTo(image2);
     }
     catch (cv_bridge::Exception& e)
@@ -35,11 +39,43 @@ voCallback(const sensor_msgs::ImageConstPtr& imageMsg1,
         return;
     }
 
-    ssm->readFrames(imageMsg1->header.stamp, image1, image2);
+    ssm->readFrames(stamp, image1, image2);
 
     ssm->processFrames();
 
-    ROS_INFO("Processed images with timestamp %f.", imageMsg1->header.stamp.toSec());
+    ROS_INFO("Processed images with timestamp %f.", stamp.toSec());
+}
+
+void
+voCallback(const sensor_msgs::ImageConstPtr& imageMsg1,
+           const sensor_msgs::ImageConstPtr& imageMsg2,
+           boost::shared_ptr<px::StereoSM> ssm)
+{
+    processFrames(imageMsg1->header.stamp, *imageMsg1, *imageMsg2, imageMsg1, ssm);
+}
+
+void
+frameSetCallback(const multicam_msgs::FrameSetConstPtr& frameSetMsg,
+                 const std::string& cameraNs1,
+                 const std::string& cameraNs2,
+                 boost::shared_ptr<px::StereoSM> ssm)
+{
+    const std::vector<std::string>& cameraNs = frameSetMsg->camera_ns;
+
+    std::vector<std::string>::const_iterator it1 = std::find(cameraNs.begin(), cameraNs.end(), cameraNs1);
+    std::vector<std::string>::const_iterator it2 = std::find(cameraNs.begin(), cameraNs.end(), cameraNs2);
+    if (it1 == cameraNs.end() || it2 == cameraNs.end())
+    {
+        ROS_WARN("Frame set has no images from cameras %s and %s.",
+                 cameraNs1.c_str(), cameraNs2.c_str());
+        return;
+    }
+
+    // all images in a frame set share the same stamp
+    processFrames(frameSetMsg->header.stamp,
+                  frameSetMsg->images.at(it1 - cameraNs.begin()),
+                  frameSetMsg->images.at(it2 - cameraNs.begin()),
+                  frameSetMsg, ssm);
 }
 
 template<class M>
@@ -58,6 +94,7 @@ main(int argc, char** argv)
     std::string bagFilename;
     std::string vocFilename;
     std::string cameraNs1, cameraNs2;
+    std::string frameSetTopicName;
     std::string extrinsicFilename;
 
     boost::program_options::options_description desc("Allowed options");
@@ -67,6 +104,7 @@ main(int argc, char** argv)
         ("voc", boost::program_options::value<std::string>(&vocFilename)->default_value("orb.yml.gz"), "Vocabulary filename.")
         ("camera_ns_1", boost::program_options::value<std::string>(&cameraNs1), "Namespace of camera 1.")
         ("camera_ns_2", boost::program_options::value<std::string>(&cameraNs2), "Namespace of camera 2.")
+        ("frame_set_topic", boost::program_options::value<std::string>(&frameSetTopicName), "Frame set topic; if not given, per-camera image topics are synchronized.")
         ("extrinsics", boost::program_options::value<std::string>(&extrinsicFilename), "Extrinsic filename.")
         ;
 
@@ -108,9 +146,20 @@ main(int argc, char** argv)
 
     std::vector<std::string> topics;
     topics.push_back(camInfo1TopicName);
-    topics.push_back(camImage1TopicName);
     topics.push_back(camInfo2TopicName);
-    topics.push_back(camImage2TopicName);
+    if (frameSetTopicName.empty())
+    {
+        topics.push_back(camImage1TopicName);
+        topics.push_back(camImage2TopicName);
+    }
+    else
+    {
+        topics.push_back(frameSetTopicName);
+    }
+
+    // frame sets identify cameras by their resolved namespace
+    std::string resolvedCameraNs1 = ros::names::resolve(cameraNs1);
+    std::string resolvedCameraNs2 = ros::names::resolve(cameraNs2);
 
     rosbag::View view(bag, rosbag::TopicQuery(topics));
 
@@ -175,7 +224,10 @@ main(int argc, char** argv)
                 return 1;
             }
 
-            sync.registerCallback(boost::bind(&voCallback, _1, _2, ssm));
+            if (frameSetTopicName.empty())
+            {
+                sync.registerCallback(boost::bind(&voCallback, _1, _2, ssm));
+            }
 
             ROS_INFO("Initialized stereo sparse mapping.");
 
@@ -184,6 +236,16 @@ main(int argc, char** argv)
 
         if (camera1 && camera2)
         {
+            if (m.getTopic() == frameSetTopicName)
+            {
+                multicam_msgs::FrameSet::ConstPtr frameSet = m.instantiate<multicam_msgs::FrameSet>();
+
+                if (frameSet)
+                {
+                    frameSetCallback(frameSet, resolvedCameraNs1, resolvedCameraNs2, ssm);
+                }
+            }
+
             if (m.getTopic() == camImage1TopicName)
             {
                 sensor_msgs::Image::ConstPtr img = m.instantiate<sensor_msgs::Image>();
@@ -0,0 +1,127 @@
+#ifndef SYNTHETICSCENE_H
+#define SYNTHETICSCENE_H
+
+#include <opencv2/core/core.hpp>
+#include <sensor_msgs/Imu.h>
+
+#include "camera_systems/CameraSystem.h"
+#include "cauldron/Random.h"
+#include "sparse_graph/SparseGraph.h"
+#include "synthetic_scene/SyntheticTrajectory.h"
+
+namespace px
+{
+
+// Generates multi-camera scenes of arbitrary size for tests and scaling
+// benchmarks: scene points scattered near the walls, floor and ceiling of
+// a room, observed by a camera system moving along a SyntheticTrajectory.
+//
+// generateGraph() builds a SparseGraph as the VO front ends would: one
+// frame set per frame, features with noisy rays, keypoints and ORB-sized
+// descriptors, feature tracks linked through prevMatches/nextMatches,
+// stereo matches between the two cameras of a stereo pair, and a shared
+// Point3DFeature per scene point. The true system pose is kept as the
+// ground-truth measurement of each frame set, while the system pose and
+// the scene points can be perturbed to give optimizers work to do.
+// Outliers are observations whose pixel is drawn uniformly from the
+// image, so that they keep their association with the scene point.
+//
+// The index of each feature is the id of its scene point.
+class SyntheticScene
+{
+public:
+    SyntheticScene(const CameraSystemConstPtr& cameraSystem,
+                   uint64_t seed = 0);
+
+    // two stereo pairs of 640x480 pinhole cameras with a 0.1 m baseline,
+    // facing forward and backward
+    static CameraSystemPtr createStereoCameraSystem(void);
+    // cameraCount 1280x1024 fisheye cameras with a field of view of about
+    // 185 degrees, spread evenly around the vertical axis of the system
+    static CameraSystemPtr createFisheyeCameraSystem(int cameraCount = 4);
+
+    CameraSystemConstPtr cameraSystem(void) const;
+
+    SyntheticTrajectory& trajectory(void);
+    const SyntheticTrajectory& trajectory(void) const;
+
+    size_t& scenePointCount(void);
+    size_t& frameSetCount(void);
+    double& frameRate(void);            // [Hz]
+    size_t& maxFeaturesPerFrame(void);
+    double& maxRange(void);             // [m]
+    double& pixelNoise(void);           // standard deviation [px]
+    double& outlierRatio(void);
+    int& descriptorNoiseBits(void);     // bits flipped per observation
+    double& poseRotationNoise(void);    // standard deviation [rad]
+    double& poseTranslationNoise(void); // standard deviation [m]
+    double& scenePointNoise(void);      // standard deviation [m]
+    double& gyroNoiseDensity(void);     // [rad/s/sqrt(Hz)]
+    double& accelNoiseDensity(void);    // [m/s^2/sqrt(Hz)]
+
+    // Draws scenePointCount scene points. Called by generateGraph() if
+    // there are none yet.
+    void generateScenePoints(void);
+    const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >& scenePoints(void) const;
+
+    // time since the start of the trajectory of frame set idx
+    double frameSetTime(size_t idx) const;
+
+    // Builds frameSetCount frame sets into segment 0 of the graph.
+    void generateGraph(SparseGraphPtr& graph);
+
+    // statistics of the last call to generateGraph
+    size_t observationCount(void) const;
+    size_t outlierCount(void) const;
+
+    // IMU measurements from time 0 to the last frame set at the given
+    // rate, with white noise and the true orientation
+    void generateImuMeasurements(double rate,
+                                 std::vector<sensor_msgs::ImuConstPtr>& imuMeasurements);
+
+    // Renders the scene points visible to a camera as discs of random
+    // gray levels on a uniform background, nearer discs on top.
+    void renderImage(int cameraIdx, const Eigen::Matrix4d& H_sys_world,
+                     cv::Mat& image);
+
+private:
+    bool projectScenePoint(int cameraIdx, const Eigen::Matrix4d& H_world_cam,
+                           size_t scenePointId, Eigen::Vector2d& p,
+                           double& depth) const;
+
+    sensor_msgs::ImuPtr imuMeasurement(double t, double rate);
+
+    PosePtr perturbPose(const Eigen::Matrix4d& H);
+
+    static const int k_descriptorBytes = 32;
+
+    CameraSystemConstPtr m_cameraSystem;
+    SyntheticTrajectory m_trajectory;
+
+    size_t m_scenePointCount;
+    size_t m_frameSetCount;
+    double m_frameRate;
+    size_t m_maxFeaturesPerFrame;
+    double m_maxRange;
+    double m_pixelNoise;
+    double m_outlierRatio;
+    int m_descriptorNoiseBits;
+    double m_poseRotationNoise;
+    double m_poseTranslationNoise;
+    double m_scenePointNoise;
+    double m_gyroNoiseDensity;
+    double m_accelNoiseDensity;
+
+    Xoshiro256 m_rng;
+
+    std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > m_scenePoints;
+    cv::Mat m_scenePointDescriptors;
+    std::vector<unsigned char> m_scenePointIntensities;
+
+    size_t m_observationCount;
+    size_t m_outlierCount;
+};
+
+}
+
+#endif
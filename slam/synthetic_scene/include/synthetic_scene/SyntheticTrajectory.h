@@ -0,0 +1,47 @@
+#ifndef SYNTHETICTRAJECTORY_H
+#define SYNTHETICTRAJECTORY_H
+
+#include <Eigen/Dense>
+
+namespace px
+{
+
+// A smooth closed trajectory inside a box-shaped room: an ellipse with a
+// height oscillation, flown once per period, with the heading near the
+// direction of travel and gentle roll and pitch. The world frame is z-up
+// and centered on the floor of the room. All derivatives are analytic,
+// so that IMU measurements are exact.
+class SyntheticTrajectory
+{
+public:
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
+    SyntheticTrajectory(const Eigen::Vector3d& roomSize = Eigen::Vector3d(16.0, 12.0, 4.0),
+                        double period = 30.0);
+
+    const Eigen::Vector3d& roomSize(void) const;
+    double period(void) const;
+
+    // pose of the system with respect to the world frame at time t
+    Eigen::Matrix4d pose(double t) const;
+
+    // as above, with the linear velocity and acceleration in the world
+    // frame and the angular velocity in the system frame
+    void state(double t, Eigen::Matrix4d& H_sys_world,
+               Eigen::Vector3d& velocity, Eigen::Vector3d& accel,
+               Eigen::Vector3d& omega) const;
+
+    // noise-free gyro and accelerometer measurements in the system frame
+    void imuMeasurement(double t, Eigen::Vector3d& gyro,
+                        Eigen::Vector3d& accel) const;
+
+    static const double k_gravity;
+
+private:
+    Eigen::Vector3d m_roomSize;
+    double m_period;
+};
+
+}
+
+#endif
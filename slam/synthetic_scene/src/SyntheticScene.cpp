@@ -0,0 +1,675 @@
+#include "synthetic_scene/SyntheticScene.h"
+
+#include <algorithm>
+#include <boost/make_shared.hpp>
+#include <boost/unordered_map.hpp>
+#include <cstdio>
+#include <opencv2/imgproc/imgproc.hpp>
+
+#include "camera_models/CataCamera.h"
+#include "camera_models/PinholeCamera.h"
+#include "cauldron/EigenUtils.h"
+
+namespace px
+{
+
+namespace
+{
+
+// cosine of the half field of view of the fisheye cameras
+const double k_fisheyeMinViewCos = -0.0436;
+
+}
+
+SyntheticScene::SyntheticScene(const CameraSystemConstPtr& cameraSystem,
+                               uint64_t seed)
+ : m_cameraSystem(cameraSystem)
+ , m_scenePointCount(10000)
+ , m_frameSetCount(100)
+ , m_frameRate(20.0)
+ , m_maxFeaturesPerFrame(300)
+ , m_maxRange(20.0)
+ , m_pixelNoise(0.5)
+ , m_outlierRatio(0.0)
+ , m_descriptorNoiseBits(8)
+ , m_poseRotationNoise(0.0)
+ , m_poseTranslationNoise(0.0)
+ , m_scenePointNoise(0.0)
+ , m_gyroNoiseDensity(1.7e-4)
+ , m_accelNoiseDensity(2.0e-3)
+ , m_rng(seed)
+ , m_observationCount(0)
+ , m_outlierCount(0)
+{
+
+}
+
+CameraSystemPtr
+SyntheticScene::createStereoCameraSystem(void)
+{
+    CameraSystemPtr cameraSystem = boost::make_shared<CameraSystem>(4);
+
+    // camera z-axis forward along the system x-axis, x-axis right and
+    // y-axis down
+    Eigen::Matrix3d R_front;
+    R_front << 0.0, 0.0, 1.0,
+               -1.0, 0.0, 0.0,
+               0.0, -1.0, 0.0;
+    Eigen::Matrix3d R_back = Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitZ()) * R_front;
+
+    const double baseline = 0.1;
+
+    for (int i = 0; i < 4; ++i)
+    {
+        char cameraName[16];
+        snprintf(cameraName, sizeof(cameraName), "cam%d", i);
+
+        CameraPtr camera(new PinholeCamera(cameraName, "stereo", 640, 480,
+                                           0.0, 0.0, 0.0, 0.0,
+                                           320.0, 320.0, 320.0, 240.0));
+        cameraSystem->setCamera(i, camera);
+
+        // the second camera of each pair is to the right of the first
+        const Eigen::Matrix3d& R = (i < 2) ? R_front : R_back;
+        Eigen::Vector3d centre = R.col(2) * 0.1 + R.col(0) * baseline * ((i % 2 == 0) ? -0.5 : 0.5);
+
+        Eigen::Matrix4d H = Eigen::Matrix4d::Identity();
+        H.block<3,3>(0,0) = R;
+        H.block<3,1>(0,3) = centre;
+
+        cameraSystem->setGlobalCameraPose(i, H);
+    }
+
+    return cameraSystem;
+}
+
+CameraSystemPtr
+SyntheticScene::createFisheyeCameraSystem(int cameraCount)
+{
+    CameraSystemPtr cameraSystem = boost::make_shared<CameraSystem>(cameraCount);
+
+    Eigen::Matrix3d R_front;
+    R_front << 0.0, 0.0, 1.0,
+               -1.0, 0.0, 0.0,
+               0.0, -1.0, 0.0;
+
+    for (int i = 0; i < cameraCount; ++i)
+    {
+        char cameraName[16];
+        snprintf(cameraName, sizeof(cameraName), "cam%d", i);
+
+        // xi = 1 maps a ray at angle theta from the optical axis to
+        // gamma * tan(theta / 2) pixels from the principal point
+        CameraPtr camera(new CataCamera(cameraName, "mono", 1280, 1024,
+                                        1.0, 0.0, 0.0, 0.0, 0.0,
+                                        400.0, 400.0, 640.0, 512.0));
+        cameraSystem->setCamera(i, camera);
+
+        Eigen::Matrix3d R = Eigen::AngleAxisd(2.0 * M_PI * i / cameraCount, Eigen::Vector3d::UnitZ()) * R_front;
+
+        Eigen::Matrix4d H = Eigen::Matrix4d::Identity();
+        H.block<3,3>(0,0) = R;
+        H.block<3,1>(0,3) = R.col(2) * 0.2;
+
+        cameraSystem->setGlobalCameraPose(i, H);
+    }
+
+    return cameraSystem;
+}
+
+CameraSystemConstPtr
+SyntheticScene::cameraSystem(void) const
+{
+    return m_cameraSystem;
+}
+
+SyntheticTrajectory&
+SyntheticScene::trajectory(void)
+{
+    return m_trajectory;
+}
+
+const SyntheticTrajectory&
+SyntheticScene::trajectory(void) const
+{
+    return m_trajectory;
+}
+
+size_t&
+SyntheticScene::scenePointCount(void)
+{
+    return m_scenePointCount;
+}
+
+size_t&
+SyntheticScene::frameSetCount(void)
+{
+    return m_frameSetCount;
+}
+
+double&
+SyntheticScene::frameRate(void)
+{
+    return m_frameRate;
+}
+
+size_t&
+SyntheticScene::maxFeaturesPerFrame(void)
+{
+    return m_maxFeaturesPerFrame;
+}
+
+double&
+SyntheticScene::maxRange(void)
+{
+    return m_maxRange;
+}
+
+double&
+SyntheticScene::pixelNoise(void)
+{
+    return m_pixelNoise;
+}
+
+double&
+SyntheticScene::outlierRatio(void)
+{
+    return m_outlierRatio;
+}
+
+int&
+SyntheticScene::descriptorNoiseBits(void)
+{
+    return m_descriptorNoiseBits;
+}
+
+double&
+SyntheticScene::poseRotationNoise(void)
+{
+    return m_poseRotationNoise;
+}
+
+double&
+SyntheticScene::poseTranslationNoise(void)
+{
+    return m_poseTranslationNoise;
+}
+
+double&
+SyntheticScene::scenePointNoise(void)
+{
+    return m_scenePointNoise;
+}
+
+double&
+SyntheticScene::gyroNoiseDensity(void)
+{
+    return m_gyroNoiseDensity;
+}
+
+double&
+SyntheticScene::accelNoiseDensity(void)
+{
+    return m_accelNoiseDensity;
+}
+
+void
+SyntheticScene::generateScenePoints(void)
+{
+    const Eigen::Vector3d& roomSize = m_trajectory.roomSize();
+
+    Eigen::Vector3d boxMin(-0.5 * roomSize(0), -0.5 * roomSize(1), 0.0);
+    Eigen::Vector3d boxMax(0.5 * roomSize(0), 0.5 * roomSize(1), roomSize(2));
+
+    // faces are drawn in proportion to their area
+    double faceArea[3] = {roomSize(1) * roomSize(2),
+                          roomSize(0) * roomSize(2),
+                          roomSize(0) * roomSize(1)};
+    double totalArea = 2.0 * (faceArea[0] + faceArea[1] + faceArea[2]);
+
+    m_scenePoints.resize(m_scenePointCount);
+    m_scenePointDescriptors.create(m_scenePointCount, k_descriptorBytes, CV_8U);
+    m_scenePointIntensities.resize(m_scenePointCount);
+
+    for (size_t i = 0; i < m_scenePointCount; ++i)
+    {
+        double r = m_rng.uniform(0.0, totalArea);
+
+        int axis = 0;
+        while (axis < 2 && r >= 2.0 * faceArea[axis])
+        {
+            r -= 2.0 * faceArea[axis];
+            ++axis;
+        }
+        bool maxFace = r >= faceArea[axis];
+
+        Eigen::Vector3d& P = m_scenePoints.at(i);
+        for (int k = 0; k < 3; ++k)
+        {
+            P(k) = m_rng.uniform(boxMin(k), boxMax(k));
+        }
+
+        // up to half a meter in front of the face, so that the scene is
+        // not piecewise planar
+        double offset = m_rng.uniform(0.0, 0.5);
+        P(axis) = maxFace ? boxMax(axis) - offset : boxMin(axis) + offset;
+
+        unsigned char* dtor = m_scenePointDescriptors.ptr<unsigned char>(i);
+        for (int k = 0; k < k_descriptorBytes; ++k)
+        {
+            dtor[k] = static_cast<unsigned char>(m_rng() >> 56);
+        }
+
+        m_scenePointIntensities.at(i) = static_cast<unsigned char>(m_rng.uniform(140.0, 255.0));
+    }
+}
+
+const std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> >&
+SyntheticScene::scenePoints(void) const
+{
+    return m_scenePoints;
+}
+
+double
+SyntheticScene::frameSetTime(size_t idx) const
+{
+    return idx / m_frameRate;
+}
+
+void
+SyntheticScene::generateGraph(SparseGraphPtr& graph)
+{
+    if (m_scenePoints.size() != m_scenePointCount)
+    {
+        generateScenePoints();
+    }
+
+    m_observationCount = 0;
+    m_outlierCount = 0;
+
+    int nCameras = m_cameraSystem->cameraCount();
+
+    std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > H_cam_sys(nCameras);
+    for (int i = 0; i < nCameras; ++i)
+    {
+        H_cam_sys.at(i) = m_cameraSystem->getGlobalCameraPose(i);
+    }
+
+    std::vector<Point3DFeaturePtr> scenePoints(m_scenePoints.size());
+
+    // features of the previous frame of each camera by scene point id
+    std::vector<boost::unordered_map<size_t, Point2DFeature*> > tracks(nCameras);
+
+    FrameSetSegment& segment = graph->frameSetSegment(0);
+    FrameSetPtr frameSetPrev;
+
+    // per scene point, reset after each frame
+    std::vector<Eigen::Vector2d, Eigen::aligned_allocator<Eigen::Vector2d> > imagePoints(m_scenePoints.size());
+    std::vector<char> visible(m_scenePoints.size(), 0);
+    std::vector<char> selected(m_scenePoints.size(), 0);
+
+    std::vector<size_t> visibleIds;
+    std::vector<size_t> selectedIds;
+    for (size_t i = 0; i < m_frameSetCount; ++i)
+    {
+        double t = frameSetTime(i);
+        Eigen::Matrix4d H_sys_world = m_trajectory.pose(t);
+
+        FrameSetPtr frameSet = boost::make_shared<FrameSet>();
+        frameSet->seq() = i;
+
+        ros::Time stamp(1.0 + t);
+
+        Eigen::Matrix4d H_world_sys = invertHomogeneousTransform(H_sys_world);
+
+        PosePtr groundTruth = boost::make_shared<Pose>(H_world_sys);
+        groundTruth->timeStamp() = stamp;
+        frameSet->groundTruthMeasurement() = groundTruth;
+
+        frameSet->systemPose() = perturbPose(H_world_sys);
+        frameSet->systemPose()->timeStamp() = stamp;
+
+        frameSet->imuMeasurement() = imuMeasurement(t, m_frameRate);
+
+        if (frameSetPrev)
+        {
+            frameSet->prevFrameSet() = frameSetPrev.get();
+            frameSetPrev->nextFrameSet() = frameSet.get();
+        }
+
+        std::vector<boost::unordered_map<size_t, Point2DFeature*> > features(nCameras);
+        for (int j = 0; j < nCameras; ++j)
+        {
+            CameraConstPtr camera = m_cameraSystem->getCamera(j);
+
+            FramePtr frame = boost::make_shared<Frame>();
+            frame->cameraId() = j;
+            frame->frameSet() = frameSet.get();
+            frameSet->frames().push_back(frame);
+
+            Eigen::Matrix4d H_cam_world = H_sys_world * H_cam_sys.at(j);
+            Eigen::Matrix4d H_world_cam = invertHomogeneousTransform(H_cam_world);
+
+            // The second camera of a stereo pair first keeps the scene
+            // points of the first, for stereo matches; every camera then
+            // keeps its tracks, and fills up with random new points.
+            bool secondOfPair = j > 0 && m_cameraSystem->isPartOfStereoPair(j) &&
+                                m_cameraSystem->isPartOfStereoPair(j - 1) && j % 2 == 1;
+
+            visibleIds.clear();
+            selectedIds.clear();
+
+            for (size_t k = 0; k < m_scenePoints.size(); ++k)
+            {
+                double depth;
+                if (projectScenePoint(j, H_world_cam, k, imagePoints.at(k), depth))
+                {
+                    visibleIds.push_back(k);
+                    visible.at(k) = 1;
+                }
+            }
+
+            if (secondOfPair)
+            {
+                boost::unordered_map<size_t, Point2DFeature*>::const_iterator it;
+                for (it = features.at(j - 1).begin(); it != features.at(j - 1).end(); ++it)
+                {
+                    if (visible.at(it->first) && selectedIds.size() < m_maxFeaturesPerFrame)
+                    {
+                        selectedIds.push_back(it->first);
+                        selected.at(it->first) = 1;
+                    }
+                }
+            }
+
+            boost::unordered_map<size_t, Point2DFeature*>::const_iterator it;
+            for (it = tracks.at(j).begin(); it != tracks.at(j).end(); ++it)
+            {
+                if (visible.at(it->first) && !selected.at(it->first) &&
+                    selectedIds.size() < m_maxFeaturesPerFrame)
+                {
+                    selectedIds.push_back(it->first);
+                    selected.at(it->first) = 1;
+                }
+            }
+
+            // partial Fisher-Yates shuffle of the remaining visible points
+            for (size_t k = 0; k < visibleIds.size() &&
+                               selectedIds.size() < m_maxFeaturesPerFrame; ++k)
+            {
+                size_t l = k + m_rng(static_cast<long>(visibleIds.size() - k));
+                std::swap(visibleIds.at(k), visibleIds.at(l));
+
+                size_t id = visibleIds.at(k);
+                if (!selected.at(id))
+                {
+                    selectedIds.push_back(id);
+                    selected.at(id) = 1;
+                }
+            }
+
+            for (size_t k = 0; k < selectedIds.size(); ++k)
+            {
+                size_t id = selectedIds.at(k);
+
+                Eigen::Vector2d p = imagePoints.at(id);
+
+                if (m_rng.uniform() < m_outlierRatio)
+                {
+                    p << m_rng.uniform(0.0, camera->imageWidth() - 1.0),
+                         m_rng.uniform(0.0, camera->imageHeight() - 1.0);
+
+                    ++m_outlierCount;
+                }
+                else if (m_pixelNoise > 0.0)
+                {
+                    p(0) += m_rng.normal(0.0, m_pixelNoise);
+                    p(1) += m_rng.normal(0.0, m_pixelNoise);
+                }
+
+                Point2DFeaturePtr feature = boost::make_shared<Point2DFeature>();
+                feature->frame() = frame.get();
+                feature->index() = id;
+                feature->keypoint() = cv::KeyPoint(p(0), p(1), 7.0f);
+
+                camera->liftSphere(p, feature->ray());
+                feature->ray().normalize();
+
+                m_scenePointDescriptors.row(id).copyTo(feature->descriptor());
+                unsigned char* dtor = feature->descriptor().ptr<unsigned char>(0);
+                for (int l = 0; l < m_descriptorNoiseBits; ++l)
+                {
+                    int bit = m_rng(k_descriptorBytes * 8);
+                    dtor[bit / 8] ^= static_cast<unsigned char>(1 << (bit % 8));
+                }
+
+                Point3DFeaturePtr& scenePoint = scenePoints.at(id);
+                if (!scenePoint)
+                {
+                    scenePoint = boost::make_shared<Point3DFeature>();
+                    scenePoint->point() = m_scenePoints.at(id);
+                    if (m_scenePointNoise > 0.0)
+                    {
+                        for (int l = 0; l < 3; ++l)
+                        {
+                            scenePoint->point()(l) += m_rng.normal(0.0, m_scenePointNoise);
+                        }
+                    }
+                }
+                feature->feature3D() = scenePoint;
+                scenePoint->features2D().push_back(feature.get());
+
+                boost::unordered_map<size_t, Point2DFeature*>::iterator itPrev = tracks.at(j).find(id);
+                if (itPrev != tracks.at(j).end())
+                {
+                    Point2DFeature* featurePrev = itPrev->second;
+
+                    featurePrev->nextMatches().push_back(feature.get());
+                    featurePrev->bestNextMatchId() = 0;
+
+                    feature->prevMatches().push_back(featurePrev);
+                    feature->bestPrevMatchId() = 0;
+                }
+
+                if (secondOfPair)
+                {
+                    boost::unordered_map<size_t, Point2DFeature*>::iterator itStereo = features.at(j - 1).find(id);
+                    if (itStereo != features.at(j - 1).end())
+                    {
+                        Point2DFeature* feature1 = itStereo->second;
+
+                        feature1->matches().push_back(feature.get());
+                        feature1->bestMatchId() = 0;
+
+                        feature->matches().push_back(feature1);
+                        feature->bestMatchId() = 0;
+                    }
+                }
+
+                frame->features2D().push_back(feature);
+                features.at(j)[id] = feature.get();
+            }
+
+            m_observationCount += selectedIds.size();
+
+            for (size_t k = 0; k < visibleIds.size(); ++k)
+            {
+                visible.at(visibleIds.at(k)) = 0;
+                selected.at(visibleIds.at(k)) = 0;
+            }
+        }
+
+        tracks.swap(features);
+
+        segment.push_back(frameSet);
+        frameSetPrev = frameSet;
+    }
+}
+
+size_t
+SyntheticScene::observationCount(void) const
+{
+    return m_observationCount;
+}
+
+size_t
+SyntheticScene::outlierCount(void) const
+{
+    return m_outlierCount;
+}
+
+void
+SyntheticScene::generateImuMeasurements(double rate,
+                                        std::vector<sensor_msgs::ImuConstPtr>& imuMeasurements)
+{
+    imuMeasurements.clear();
+
+    double duration = frameSetTime(m_frameSetCount > 0 ? m_frameSetCount - 1 : 0);
+
+    size_t count = static_cast<size_t>(duration * rate) + 1;
+    for (size_t i = 0; i < count; ++i)
+    {
+        imuMeasurements.push_back(imuMeasurement(i / rate, rate));
+    }
+}
+
+void
+SyntheticScene::renderImage(int cameraIdx, const Eigen::Matrix4d& H_sys_world,
+                            cv::Mat& image)
+{
+    if (m_scenePoints.size() != m_scenePointCount)
+    {
+        generateScenePoints();
+    }
+
+    CameraConstPtr camera = m_cameraSystem->getCamera(cameraIdx);
+
+    Eigen::Matrix4d H_cam_world = H_sys_world * m_cameraSystem->getGlobalCameraPose(cameraIdx);
+    Eigen::Matrix4d H_world_cam = invertHomogeneousTransform(H_cam_world);
+
+    std::vector<std::pair<double,size_t> > visible;
+    std::vector<Eigen::Vector2d, Eigen::aligned_allocator<Eigen::Vector2d> > imagePoints(m_scenePoints.size());
+    for (size_t i = 0; i < m_scenePoints.size(); ++i)
+    {
+        double depth;
+        if (projectScenePoint(cameraIdx, H_world_cam, i, imagePoints.at(i), depth))
+        {
+            visible.push_back(std::make_pair(depth, i));
+        }
+    }
+
+    // painter's algorithm
+    std::sort(visible.begin(), visible.end());
+
+    cv::Mat render(camera->imageHeight(), camera->imageWidth(), CV_8UC1, cv::Scalar(60));
+    for (size_t i = visible.size(); i-- > 0; )
+    {
+        size_t id = visible.at(i).second;
+
+        // a disc of 5 cm radius, measured at its center in the image
+        Eigen::Vector3d P = transformPoint(H_world_cam, m_scenePoints.at(id));
+        Eigen::Vector3d dP = P.cross(Eigen::Vector3d::UnitY());
+        if (dP.squaredNorm() < 1e-12)
+        {
+            dP = P.cross(Eigen::Vector3d::UnitX());
+        }
+        dP *= 0.05 / dP.norm();
+
+        Eigen::Vector2d p2;
+        camera->spaceToPlane(P + dP, p2);
+
+        const Eigen::Vector2d& p = imagePoints.at(id);
+        int radius = std::max(1, static_cast<int>((p2 - p).norm() + 0.5));
+
+        cv::circle(render, cv::Point(cvRound(p(0) * 16.0), cvRound(p(1) * 16.0)),
+                   radius * 16, cv::Scalar(m_scenePointIntensities.at(id)),
+                   -1, CV_AA, 4);
+    }
+
+    cv::GaussianBlur(render, image, cv::Size(3, 3), 0.8);
+}
+
+bool
+SyntheticScene::projectScenePoint(int cameraIdx, const Eigen::Matrix4d& H_world_cam,
+                                  size_t scenePointId, Eigen::Vector2d& p,
+                                  double& depth) const
+{
+    Eigen::Vector3d P = transformPoint(H_world_cam, m_scenePoints.at(scenePointId));
+
+    depth = P.norm();
+    if (depth > m_maxRange)
+    {
+        return false;
+    }
+
+    CameraConstPtr camera = m_cameraSystem->getCamera(cameraIdx);
+    if (camera->modelType() == Camera::PINHOLE)
+    {
+        if (P(2) < 0.1)
+        {
+            return false;
+        }
+    }
+    else if (P(2) < k_fisheyeMinViewCos * depth)
+    {
+        return false;
+    }
+
+    camera->spaceToPlane(P, p);
+
+    return p(0) >= 0.0 && p(0) <= camera->imageWidth() - 1.0 &&
+           p(1) >= 0.0 && p(1) <= camera->imageHeight() - 1.0;
+}
+
+sensor_msgs::ImuPtr
+SyntheticScene::imuMeasurement(double t, double rate)
+{
+    Eigen::Vector3d gyro, accel;
+    m_trajectory.imuMeasurement(t, gyro, accel);
+
+    double gyroSigma = m_gyroNoiseDensity * sqrt(rate);
+    double accelSigma = m_accelNoiseDensity * sqrt(rate);
+
+    Eigen::Quaterniond q(Eigen::Matrix3d(m_trajectory.pose(t).block<3,3>(0,0)));
+
+    sensor_msgs::ImuPtr imu = boost::make_shared<sensor_msgs::Imu>();
+    imu->header.stamp = ros::Time(1.0 + t);
+    imu->orientation.w = q.w();
+    imu->orientation.x = q.x();
+    imu->orientation.y = q.y();
+    imu->orientation.z = q.z();
+    imu->angular_velocity.x = gyro(0) + m_rng.normal(0.0, gyroSigma);
+    imu->angular_velocity.y = gyro(1) + m_rng.normal(0.0, gyroSigma);
+    imu->angular_velocity.z = gyro(2) + m_rng.normal(0.0, gyroSigma);
+    imu->linear_acceleration.x = accel(0) + m_rng.normal(0.0, accelSigma);
+    imu->linear_acceleration.y = accel(1) + m_rng.normal(0.0, accelSigma);
+    imu->linear_acceleration.z = accel(2) + m_rng.normal(0.0, accelSigma);
+
+    return imu;
+}
+
+PosePtr
+SyntheticScene::perturbPose(const Eigen::Matrix4d& H)
+{
+    Eigen::Matrix4d H_noisy = H;
+
+    if (m_poseRotationNoise > 0.0)
+    {
+        Eigen::Vector3d w(m_rng.normal(0.0, m_poseRotationNoise),
+                          m_rng.normal(0.0, m_poseRotationNoise),
+                          m_rng.normal(0.0, m_poseRotationNoise));
+
+        H_noisy.block<3,3>(0,0) = Eigen::AngleAxisd(w.norm(), w.normalized()).toRotationMatrix() * H.block<3,3>(0,0);
+    }
+    if (m_poseTranslationNoise > 0.0)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            H_noisy(i,3) += m_rng.normal(0.0, m_poseTranslationNoise);
+        }
+    }
+
+    return boost::make_shared<Pose>(H_noisy);
+}
+
+}
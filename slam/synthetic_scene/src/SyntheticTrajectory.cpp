@@ -0,0 +1,99 @@
+#include "synthetic_scene/SyntheticTrajectory.h"
+
+#include <cmath>
+#include <Eigen/Geometry>
+
+namespace px
+{
+
+const double SyntheticTrajectory::k_gravity = 9.81;
+
+SyntheticTrajectory::SyntheticTrajectory(const Eigen::Vector3d& roomSize,
+                                         double period)
+ : m_roomSize(roomSize)
+ , m_period(period)
+{
+
+}
+
+const Eigen::Vector3d&
+SyntheticTrajectory::roomSize(void) const
+{
+    return m_roomSize;
+}
+
+double
+SyntheticTrajectory::period(void) const
+{
+    return m_period;
+}
+
+Eigen::Matrix4d
+SyntheticTrajectory::pose(double t) const
+{
+    Eigen::Matrix4d H_sys_world;
+    Eigen::Vector3d velocity, accel, omega;
+    state(t, H_sys_world, velocity, accel, omega);
+
+    return H_sys_world;
+}
+
+void
+SyntheticTrajectory::state(double t, Eigen::Matrix4d& H_sys_world,
+                           Eigen::Vector3d& velocity, Eigen::Vector3d& accel,
+                           Eigen::Vector3d& omega) const
+{
+    double w = 2.0 * M_PI / m_period;
+    double a = 0.25 * m_roomSize(0);
+    double b = 0.25 * m_roomSize(1);
+    double c = 0.1 * m_roomSize(2);
+    double h = 0.5 * m_roomSize(2);
+
+    double wt = w * t;
+
+    Eigen::Vector3d p(a * cos(wt), b * sin(wt), h + c * sin(2.0 * wt));
+    velocity << -a * w * sin(wt),
+                b * w * cos(wt),
+                2.0 * c * w * cos(2.0 * wt);
+    accel << -a * w * w * cos(wt),
+             -b * w * w * sin(wt),
+             -4.0 * c * w * w * sin(2.0 * wt);
+
+    double yaw = wt + M_PI_2 + 0.2 * sin(wt);
+    double pitch = 0.05 * cos(3.0 * wt);
+    double roll = 0.05 * sin(2.0 * wt);
+
+    double yawRate = w + 0.2 * w * cos(wt);
+    double pitchRate = -0.15 * w * sin(3.0 * wt);
+    double rollRate = 0.1 * w * cos(2.0 * wt);
+
+    Eigen::Matrix3d R;
+    R = Eigen::AngleAxisd(yaw, Eigen::Vector3d::UnitZ()) *
+        Eigen::AngleAxisd(pitch, Eigen::Vector3d::UnitY()) *
+        Eigen::AngleAxisd(roll, Eigen::Vector3d::UnitX());
+
+    // body rates of z-y-x Euler angles
+    omega << rollRate - yawRate * sin(pitch),
+             pitchRate * cos(roll) + yawRate * cos(pitch) * sin(roll),
+             -pitchRate * sin(roll) + yawRate * cos(pitch) * cos(roll);
+
+    H_sys_world.setIdentity();
+    H_sys_world.block<3,3>(0,0) = R;
+    H_sys_world.block<3,1>(0,3) = p;
+}
+
+void
+SyntheticTrajectory::imuMeasurement(double t, Eigen::Vector3d& gyro,
+                                    Eigen::Vector3d& accel) const
+{
+    Eigen::Matrix4d H_sys_world;
+    Eigen::Vector3d velocity, a;
+    state(t, H_sys_world, velocity, a, gyro);
+
+    // specific force: the accelerometer measures the acceleration minus
+    // gravity, in the system frame
+    Eigen::Vector3d g(0.0, 0.0, -k_gravity);
+    accel = H_sys_world.block<3,3>(0,0).transpose() * (a - g);
+}
+
+}
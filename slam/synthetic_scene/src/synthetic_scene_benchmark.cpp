@@ -0,0 +1,278 @@
+#include <algorithm>
+#include <boost/make_shared.hpp>
+#include <boost/program_options.hpp>
+#include <cstdio>
+#include <iostream>
+#include <time.h>
+
+#include "cauldron/EigenUtils.h"
+#include "cauldron/Random.h"
+#include "pose_estimation/AbsolutePoseBatch.h"
+#include "pose_estimation/AbsolutePoseRansac.h"
+#include "pose_graph/PoseGraph.h"
+#include "synthetic_scene/SyntheticScene.h"
+
+// Generates scenes of growing size and measures the generator, the
+// binary serialization of the sparse graph, and AbsolutePoseRansac on the
+// 2D-3D correspondences of each frame set against the true poses. Given
+// an ORB vocabulary, PoseGraph loop closure detection and optimization are
+// timed on the smaller scenes; the number of loop closure candidates grows
+// with the square of the number of frame sets. The largest graph can be
+// written out for the offline optimizers.
+
+namespace
+{
+
+double
+monotonicTime(void)
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// median distance between the estimated and the true positions of the
+// frame sets of a segment
+double
+medianPositionError(const px::FrameSetSegment& segment)
+{
+    std::vector<double> errors;
+    for (size_t i = 0; i < segment.size(); ++i)
+    {
+        const px::FrameSetPtr& frameSet = segment.at(i);
+
+        Eigen::Matrix4d H = px::invertHomogeneousTransform(frameSet->systemPose()->toMatrix());
+        Eigen::Matrix4d H_true = px::invertHomogeneousTransform(frameSet->groundTruthMeasurement()->toMatrix());
+
+        errors.push_back((H.block<3,1>(0,3) - H_true.block<3,1>(0,3)).norm());
+    }
+
+    if (errors.empty())
+    {
+        return 0.0;
+    }
+
+    std::nth_element(errors.begin(), errors.begin() + errors.size() / 2, errors.end());
+
+    return errors.at(errors.size() / 2);
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    std::string cameraSystemType;
+    size_t frameSetCount;
+    size_t scenePointCount;
+    size_t maxFeatures;
+    double pixelNoise;
+    double outlierRatio;
+    int steps;
+    size_t ransacFrameSets;
+    std::string vocFilename;
+    size_t poseGraphFrameSets;
+    double poseRotationNoise;
+    double poseTranslationNoise;
+    int seed;
+    std::string outputFilename;
+
+    boost::program_options::options_description desc("Allowed options");
+    desc.add_options()
+        ("help", "produce help message")
+        ("camera-system", boost::program_options::value<std::string>(&cameraSystemType)->default_value("fisheye"), "fisheye or stereo.")
+        ("frame-sets", boost::program_options::value<size_t>(&frameSetCount)->default_value(2000), "Number of frame sets of the largest scene.")
+        ("scene-points", boost::program_options::value<size_t>(&scenePointCount)->default_value(200000), "Number of scene points of the largest scene.")
+        ("features", boost::program_options::value<size_t>(&maxFeatures)->default_value(300), "Maximum number of features per frame.")
+        ("pixel-noise", boost::program_options::value<double>(&pixelNoise)->default_value(0.5), "Standard deviation of pixel noise.")
+        ("outliers", boost::program_options::value<double>(&outlierRatio)->default_value(0.3), "Fraction of outlier observations.")
+        ("steps", boost::program_options::value<int>(&steps)->default_value(4), "Number of scene sizes, each twice the previous.")
+        ("ransac-frame-sets", boost::program_options::value<size_t>(&ransacFrameSets)->default_value(100), "Number of frame sets per scene to run RANSAC on.")
+        ("voc", boost::program_options::value<std::string>(&vocFilename), "ORB vocabulary file; the pose graph is only benchmarked if given.")
+        ("pose-graph-frame-sets", boost::program_options::value<size_t>(&poseGraphFrameSets)->default_value(250), "Largest scene to build and optimize the pose graph of.")
+        ("pose-rotation-noise", boost::program_options::value<double>(&poseRotationNoise)->default_value(0.005), "Standard deviation of the rotation noise of the system poses [rad].")
+        ("pose-translation-noise", boost::program_options::value<double>(&poseTranslationNoise)->default_value(0.05), "Standard deviation of the translation noise of the system poses [m].")
+        ("seed", boost::program_options::value<int>(&seed)->default_value(0), "Random seed.")
+        ("output,o", boost::program_options::value<std::string>(&outputFilename), "Binary file to write the largest sparse graph to.")
+        ;
+
+    boost::program_options::variables_map vm;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, desc), vm);
+    boost::program_options::notify(vm);
+
+    if (vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 1;
+    }
+
+    px::CameraSystemPtr cameraSystem;
+    if (cameraSystemType == "fisheye")
+    {
+        cameraSystem = px::SyntheticScene::createFisheyeCameraSystem(4);
+    }
+    else if (cameraSystemType == "stereo")
+    {
+        cameraSystem = px::SyntheticScene::createStereoCameraSystem();
+    }
+    else
+    {
+        std::cerr << "# ERROR: Unknown camera system: " << cameraSystemType << std::endl;
+        return 1;
+    }
+
+    for (int step = steps - 1; step >= 0; --step)
+    {
+        px::SyntheticScene scene(cameraSystem, seed);
+        scene.frameSetCount() = std::max(static_cast<size_t>(1), frameSetCount >> step);
+        scene.scenePointCount() = std::max(static_cast<size_t>(1), scenePointCount >> step);
+        scene.maxFeaturesPerFrame() = maxFeatures;
+        scene.pixelNoise() = pixelNoise;
+        scene.outlierRatio() = outlierRatio;
+        scene.poseRotationNoise() = poseRotationNoise;
+        scene.poseTranslationNoise() = poseTranslationNoise;
+        // keep the trajectory speed of the largest scene
+        scene.trajectory() = px::SyntheticTrajectory(scene.trajectory().roomSize(),
+                                                     frameSetCount / scene.frameRate());
+
+        double t = monotonicTime();
+        scene.generateScenePoints();
+        double scenePointTime = monotonicTime() - t;
+
+        px::SparseGraphPtr graph = boost::make_shared<px::SparseGraph>();
+
+        t = monotonicTime();
+        scene.generateGraph(graph);
+        double graphTime = monotonicTime() - t;
+
+        printf("%s, %zu frame sets, %zu scene points (%zu observed), %zu observations, %zu outliers\n",
+               cameraSystemType.c_str(), scene.frameSetCount(), scene.scenePointCount(),
+               graph->scenePointCount(), scene.observationCount(), scene.outlierCount());
+        printf("  %-24s %10.3f s\n", "scene points", scenePointTime);
+        printf("  %-24s %10.3f s   %8.1f us/observation\n", "sparse graph", graphTime,
+               graphTime / std::max(static_cast<size_t>(1), scene.observationCount()) * 1e6);
+
+        std::string filename = (step == 0 && !outputFilename.empty()) ? outputFilename : "synthetic_scene_benchmark.bin";
+
+        t = monotonicTime();
+        graph->writeToBinaryFile(filename);
+        double writeTime = monotonicTime() - t;
+
+        px::SparseGraph graphRead;
+        t = monotonicTime();
+        graphRead.readFromBinaryFile(filename);
+        double readTime = monotonicTime() - t;
+
+        if (filename != outputFilename)
+        {
+            std::remove(filename.c_str());
+        }
+
+        printf("  %-24s %10.3f s\n", "binary write", writeTime);
+        printf("  %-24s %10.3f s\n", "binary read", readTime);
+
+        // pose RANSAC per frame set, against the true pose
+        const px::FrameSetSegment& segment = graph->frameSetSegment(0);
+        size_t stride = std::max(static_cast<size_t>(1), segment.size() / ransacFrameSets);
+
+        std::vector<double> rotationErrors, translationErrors;
+        double ransacTime = 0.0;
+        size_t nCorrespondences = 0;
+        int nIterations = 0;
+        for (size_t i = 0; i < segment.size(); i += stride)
+        {
+            const px::FrameSetPtr& frameSet = segment.at(i);
+
+            px::AbsolutePoseBatch batch;
+            for (size_t j = 0; j < frameSet->frames().size(); ++j)
+            {
+                const px::FramePtr& frame = frameSet->frames().at(j);
+                Eigen::Matrix4d H_sys_cam = cameraSystem->getGlobalCameraPose(frame->cameraId());
+
+                for (size_t k = 0; k < frame->features2D().size(); ++k)
+                {
+                    const px::Point2DFeaturePtr& feature = frame->features2D().at(k);
+
+                    batch.add(feature->feature3D()->point(), feature->ray(), H_sys_cam);
+                }
+            }
+            nCorrespondences += batch.size();
+
+            px::AbsolutePoseRansac ransac;
+            px::setRandomSeed(seed + i);
+
+            Eigen::Matrix4d H;
+            std::vector<bool> inliers;
+
+            t = monotonicTime();
+            bool success = ransac.estimate(batch, H, inliers);
+            ransacTime += monotonicTime() - t;
+            nIterations += ransac.iterationCount();
+
+            if (!success)
+            {
+                continue;
+            }
+
+            Eigen::Matrix4d H_true = px::invertHomogeneousTransform(frameSet->groundTruthMeasurement()->toMatrix());
+
+            Eigen::Matrix3d dR = H.block<3,3>(0,0).transpose() * H_true.block<3,3>(0,0);
+            rotationErrors.push_back(Eigen::AngleAxisd(dR).angle());
+            translationErrors.push_back((H.block<3,1>(0,3) - H_true.block<3,1>(0,3)).norm());
+        }
+
+        size_t nRuns = (segment.size() + stride - 1) / stride;
+        std::sort(rotationErrors.begin(), rotationErrors.end());
+        std::sort(translationErrors.begin(), translationErrors.end());
+
+        printf("  %-24s %10.1f us/run   %6.1f correspondences   %5.1f iterations   %zu/%zu solved\n",
+               "pose RANSAC", ransacTime / nRuns * 1e6,
+               static_cast<double>(nCorrespondences) / nRuns,
+               static_cast<double>(nIterations) / nRuns,
+               rotationErrors.size(), nRuns);
+        if (!rotationErrors.empty())
+        {
+            printf("  %-24s rot. %.3f mrad   trans. %.2f mm\n", "median error",
+                   rotationErrors.at(rotationErrors.size() / 2) * 1e3,
+                   translationErrors.at(translationErrors.size() / 2) * 1e3);
+        }
+
+        // pose graph over the perturbed system poses
+        if (vocFilename.empty())
+        {
+            continue;
+        }
+
+        if (segment.size() > poseGraphFrameSets)
+        {
+            printf("  %-24s skipped above %zu frame sets\n", "pose graph", poseGraphFrameSets);
+            continue;
+        }
+
+        cv::Mat matchingMask = cv::Mat::ones(cameraSystem->cameraCount(), cameraSystem->cameraCount(), CV_8U);
+        px::PoseGraph poseGraph(cameraSystem, graph, matchingMask, 50, 10);
+        px::setRandomSeed(seed);
+
+        double errorBefore = medianPositionError(segment);
+
+        t = monotonicTime();
+        poseGraph.buildEdges(vocFilename);
+        double edgeTime = monotonicTime() - t;
+
+        t = monotonicTime();
+        poseGraph.optimize(true);
+        double optimizeTime = monotonicTime() - t;
+
+        double errorAfter = medianPositionError(segment);
+
+        printf("  %-24s %10.3f s   %zu VO edges   %zu loop closures (%zu rejected)\n",
+               "pose graph edges", edgeTime, poseGraph.getVOEdges().size(),
+               poseGraph.getLoopClosureEdges(true).size(),
+               poseGraph.getLoopClosureEdges(false).size());
+        printf("  %-24s %10.3f s   median position error %.1f -> %.1f mm\n",
+               "pose graph optimization", optimizeTime,
+               errorBefore * 1e3, errorAfter * 1e3);
+    }
+
+    return 0;
+}
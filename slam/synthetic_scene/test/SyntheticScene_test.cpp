@@ -0,0 +1,222 @@
+#include <boost/make_shared.hpp>
+#include <gtest/gtest.h>
+
+#include "cauldron/EigenUtils.h"
+#include "cauldron/ImuPreintegration.h"
+#include "synthetic_scene/SyntheticScene.h"
+
+namespace px
+{
+
+// angle between the ray of a feature and the direction to its true scene
+// point, in the camera frame
+double
+rayError(const CameraSystemConstPtr& cameraSystem,
+         const SyntheticScene& scene,
+         const FrameSetConstPtr& frameSet,
+         const Point2DFeature& feature)
+{
+    int cameraId = feature.frame()->cameraId();
+
+    Eigen::Matrix4d H_world_cam = invertHomogeneousTransform(cameraSystem->getGlobalCameraPose(cameraId)) *
+                                  frameSet->groundTruthMeasurement()->toMatrix();
+
+    Eigen::Vector3d P = transformPoint(H_world_cam, scene.scenePoints().at(feature.index()));
+
+    return acos(std::min(1.0, P.normalized().dot(feature.ray())));
+}
+
+TEST(SyntheticScene, FisheyeGraph)
+{
+    CameraSystemPtr cameraSystem = SyntheticScene::createFisheyeCameraSystem(4);
+
+    SyntheticScene scene(cameraSystem);
+    scene.scenePointCount() = 5000;
+    scene.frameSetCount() = 20;
+    scene.maxFeaturesPerFrame() = 200;
+    scene.pixelNoise() = 0.0;
+
+    SparseGraphPtr graph = boost::make_shared<SparseGraph>();
+    scene.generateGraph(graph);
+
+    const FrameSetSegment& segment = graph->frameSetSegment(0);
+    ASSERT_EQ(20u, segment.size());
+    EXPECT_EQ(0u, scene.outlierCount());
+
+    size_t observationCount = 0;
+    size_t trackedCount = 0;
+    for (size_t i = 0; i < segment.size(); ++i)
+    {
+        const FrameSetPtr& frameSet = segment.at(i);
+
+        ASSERT_EQ(4u, frameSet->frames().size());
+        EXPECT_TRUE(frameSet->systemPose()->toMatrix().isApprox(frameSet->groundTruthMeasurement()->toMatrix()));
+        ASSERT_TRUE(frameSet->imuMeasurement());
+
+        for (size_t j = 0; j < frameSet->frames().size(); ++j)
+        {
+            const FramePtr& frame = frameSet->frames().at(j);
+
+            EXPECT_EQ(200u, frame->features2D().size());
+
+            for (size_t k = 0; k < frame->features2D().size(); ++k)
+            {
+                const Point2DFeature& feature = *frame->features2D().at(k);
+
+                EXPECT_LT(rayError(cameraSystem, scene, frameSet, feature), 1e-6);
+                EXPECT_TRUE(feature.feature3D()->point().isApprox(scene.scenePoints().at(feature.index())));
+
+                if (!feature.prevMatches().empty())
+                {
+                    EXPECT_EQ(feature.index(), feature.prevMatch()->index());
+                    EXPECT_EQ(static_cast<int>(j), feature.prevMatch()->frame()->cameraId());
+                    EXPECT_EQ(frameSet->prevFrameSet(), feature.prevMatch()->frame()->frameSet());
+
+                    ++trackedCount;
+                }
+            }
+
+            observationCount += frame->features2D().size();
+        }
+    }
+
+    EXPECT_EQ(scene.observationCount(), observationCount);
+    // at 20 Hz, most features are tracked from the previous frame
+    EXPECT_GT(trackedCount, observationCount * 3 / 4);
+}
+
+TEST(SyntheticScene, StereoOutliers)
+{
+    CameraSystemPtr cameraSystem = SyntheticScene::createStereoCameraSystem();
+
+    SyntheticScene scene(cameraSystem, 1);
+    scene.scenePointCount() = 5000;
+    scene.frameSetCount() = 10;
+    scene.pixelNoise() = 0.5;
+    scene.outlierRatio() = 0.3;
+
+    SparseGraphPtr graph = boost::make_shared<SparseGraph>();
+    scene.generateGraph(graph);
+
+    EXPECT_NEAR(0.3, static_cast<double>(scene.outlierCount()) / scene.observationCount(), 0.03);
+
+    // outliers are far from their scene points; inliers are within the
+    // pixel noise, at most ~1.5 px at 320 px focal length
+    size_t farCount = 0;
+    size_t stereoMatchCount = 0;
+    const FrameSetSegment& segment = graph->frameSetSegment(0);
+    for (size_t i = 0; i < segment.size(); ++i)
+    {
+        const FrameSetPtr& frameSet = segment.at(i);
+
+        for (size_t j = 0; j < frameSet->frames().size(); ++j)
+        {
+            const FramePtr& frame = frameSet->frames().at(j);
+
+            for (size_t k = 0; k < frame->features2D().size(); ++k)
+            {
+                const Point2DFeature& feature = *frame->features2D().at(k);
+
+                if (rayError(cameraSystem, scene, frameSet, feature) > 5e-3)
+                {
+                    ++farCount;
+                }
+
+                if (!feature.matches().empty())
+                {
+                    EXPECT_EQ(feature.index(), feature.match()->index());
+                    EXPECT_EQ(static_cast<int>(j / 2), feature.match()->frame()->cameraId() / 2);
+
+                    ++stereoMatchCount;
+                }
+            }
+        }
+    }
+
+    EXPECT_NEAR(static_cast<double>(scene.outlierCount()), static_cast<double>(farCount),
+                0.02 * scene.observationCount());
+    EXPECT_GT(stereoMatchCount, scene.observationCount() / 2);
+}
+
+TEST(SyntheticScene, ImuConsistency)
+{
+    SyntheticScene scene(SyntheticScene::createStereoCameraSystem());
+    scene.frameSetCount() = 41;
+    scene.gyroNoiseDensity() = 0.0;
+    scene.accelNoiseDensity() = 0.0;
+
+    const double rate = 1000.0;
+
+    std::vector<sensor_msgs::ImuConstPtr> imuMeasurements;
+    scene.generateImuMeasurements(rate, imuMeasurements);
+    ASSERT_EQ(2001u, imuMeasurements.size());
+
+    // from the frame set at 1 s to the one at 2 s
+    ImuPreintegration preintegration;
+    for (size_t i = 1000; i < 2000; ++i)
+    {
+        const sensor_msgs::Imu& imu0 = *imuMeasurements.at(i);
+        const sensor_msgs::Imu& imu1 = *imuMeasurements.at(i + 1);
+
+        Eigen::Vector3d gyro(imu0.angular_velocity.x + imu1.angular_velocity.x,
+                             imu0.angular_velocity.y + imu1.angular_velocity.y,
+                             imu0.angular_velocity.z + imu1.angular_velocity.z);
+        Eigen::Vector3d accel(imu0.linear_acceleration.x + imu1.linear_acceleration.x,
+                              imu0.linear_acceleration.y + imu1.linear_acceleration.y,
+                              imu0.linear_acceleration.z + imu1.linear_acceleration.z);
+
+        preintegration.integrate(0.5 * gyro, 0.5 * accel, 1.0 / rate);
+    }
+
+    Eigen::Matrix4d H_i, H_j;
+    Eigen::Vector3d v_i, v, a, omega;
+    scene.trajectory().state(1.0, H_i, v_i, a, omega);
+    scene.trajectory().state(2.0, H_j, v, a, omega);
+
+    Eigen::Matrix3d R_j;
+    Eigen::Vector3d v_j, p_j;
+    preintegration.predict(H_i.block<3,3>(0,0), v_i, H_i.block<3,1>(0,3),
+                           Eigen::Vector3d(0.0, 0.0, -SyntheticTrajectory::k_gravity),
+                           R_j, v_j, p_j);
+
+    Eigen::AngleAxisd dR(Eigen::Matrix3d(R_j.transpose() * H_j.block<3,3>(0,0)));
+    EXPECT_LT(fabs(dR.angle()), 1e-4);
+    EXPECT_LT((v_j - v).norm(), 1e-3);
+    EXPECT_LT((p_j - H_j.block<3,1>(0,3)).norm(), 1e-3);
+
+    // the orientation is that of the system
+    const sensor_msgs::Imu& imu = *imuMeasurements.at(1000);
+    Eigen::Quaterniond q(imu.orientation.w, imu.orientation.x,
+                         imu.orientation.y, imu.orientation.z);
+    EXPECT_TRUE(q.toRotationMatrix().isApprox(H_i.block<3,3>(0,0), 1e-9));
+}
+
+TEST(SyntheticScene, Render)
+{
+    CameraSystemPtr cameraSystem = SyntheticScene::createFisheyeCameraSystem(4);
+
+    SyntheticScene scene(cameraSystem);
+    scene.scenePointCount() = 20000;
+
+    for (int i = 0; i < cameraSystem->cameraCount(); ++i)
+    {
+        cv::Mat image;
+        scene.renderImage(i, scene.trajectory().pose(0.0), image);
+
+        ASSERT_EQ(CV_8UC1, image.type());
+        EXPECT_EQ(1024, image.rows);
+        EXPECT_EQ(1280, image.cols);
+
+        cv::Scalar mean, stddev;
+        cv::meanStdDev(image, mean, stddev);
+        EXPECT_GT(stddev[0], 20.0);
+    }
+}
+
+}
+
+int main(int argc, char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1,10 +1,12 @@
 #ifndef GCAMLOCALBA_H
 #define GCAMLOCALBA_H
 
+#include <boost/unordered_map.hpp>
 #include <Eigen/Dense>
 #include <list>
 
 #include "camera_systems/CameraSystem.h"
+#include "cauldron/ImuPreintegration.h"
 #include "sparse_graph/SparseGraph.h"
 
 namespace px
@@ -16,13 +18,37 @@ public:
     GCamLocalBA(const CameraSystemConstPtr& cameraSystem,
                 int N = 8);
 
-    bool addFrameSet(FrameSetPtr& frameSet, bool replaceCurrentFrameSet);
+    // gravity in the world frame, (0, 0, -9.81) by default
+    Eigen::Vector3d& gravity(void);
+
+    // preintegration holds the IMU measurements between the last frame set
+    // of the window and frameSet. If it spans any time, the two are also
+    // linked by an inertial factor, and frameSet gets velocity and bias
+    // estimates.
+    bool addFrameSet(FrameSetPtr& frameSet, bool replaceCurrentFrameSet,
+                     const ImuPreintegration& preintegration = ImuPreintegration());
+
+    // velocity in the world frame and IMU biases of a frame set in the
+    // window; false if it has no inertial factor
+    bool getImuState(const FrameSet* frameSet, Eigen::Vector3d& velocity,
+                     Eigen::Vector3d& gyroBias, Eigen::Vector3d& accelBias) const;
 
 private:
+    struct ImuState
+    {
+        // velocity, gyro bias and accelerometer bias
+        double velocityBias[ImuFactor::k_velocityBiasSize];
+        // measurements from the previous frame set in the window
+        boost::shared_ptr<ImuPreintegration> preintegration;
+    };
+
     void optimize(void);
 
     const int k_N;
 
+    Eigen::Vector3d m_gravity;
+    boost::unordered_map<FrameSet*, ImuState> m_imuStates;
+
     std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > m_H_cam_sys;
     std::vector<Transform, Eigen::aligned_allocator<Transform> > m_T_sys_cam;
 
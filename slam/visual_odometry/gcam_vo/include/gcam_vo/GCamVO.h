@@ -2,6 +2,7 @@
 #define GCAMVO_H
 
 #include <boost/thread.hpp>
+#include <deque>
 #include <opencv2/features2d/features2d.hpp>
 
 #include "camera_systems/CameraSystem.h"
@@ -10,8 +11,10 @@
 namespace px
 {
 
+class AbsolutePoseBatch;
 class GCamIMU;
 class GCamLocalBA;
+class ImuPreintegration;
 
 class GCamVO
 {
@@ -23,11 +26,22 @@ public:
               const std::string& descriptorExtractorType,
               const std::string& descriptorMatcherType);
 
+    // Holds mapMutex while changing frame sets and scene points that a map
+    // may share with other threads: unlinking the previous non-key frame
+    // set, and from linking the new frame set to the previous key frame
+    // set on. Feature extraction, matching and RANSAC run without it.
+    void setMapMutex(boost::mutex& mapMutex);
+
     bool processFrames(const ros::Time& stamp,
                        const std::vector<cv::Mat>& imageVec,
                        const sensor_msgs::ImuConstPtr& imu,
                        FrameSetPtr& frameSet);
 
+    // Queues a gyro and accelerometer measurement, given in the system
+    // frame, for preintegration between frame sets. Measurements must
+    // arrive in time order. Thread-safe.
+    void addImuMeasurement(const sensor_msgs::ImuConstPtr& imu);
+
     size_t getCurrentCorrespondenceCount(void) const;
 
     void keyCurrentFrameSet(void);
@@ -65,15 +79,30 @@ private:
                           DescriptorMatchMethod matchMethod = BEST_MATCH,
                           float matchParam = 0.0f) const;
 
+    // masks, if given, are indexed by camera and restrict the matches as
+    // in DescriptorMatcher::match
     void matchCorrespondences(const FrameSetConstPtr& frameSet1,
                               const FrameSetConstPtr& frameSet2,
-                              std::vector<std::vector<cv::DMatch> >& matches) const;
+                              std::vector<std::vector<cv::DMatch> >& matches,
+                              const std::vector<cv::Mat>& masks = std::vector<cv::Mat>()) const;
     void matchStereoCorrespondences(const cv::Mat& dtors11,
                                     const cv::Mat& dtors12,
                                     const cv::Mat& dtors21,
                                     const cv::Mat& dtors22,
+                                    const cv::Mat& mask1,
+                                    const cv::Mat& mask2,
                                     std::vector<cv::DMatch>& matches) const;
 
+    // Allows a feature of frameSet1 to match only those features of
+    // frameSet2 whose rays lie within k_maxPriorRayAngle of its ray rotated
+    // by R, the rotation from the first system frame to the second.
+    void computeRotationPriorMasks(const FrameSetConstPtr& frameSet1,
+                                   const FrameSetConstPtr& frameSet2,
+                                   const Eigen::Matrix3d& R,
+                                   std::vector<cv::Mat>& masks) const;
+
+    void integrateImuMeasurements(const ros::Time& stamp);
+
     void processFrame(CameraMetadata& metadata) const;
 
     void processStereoFrame(CameraMetadata& metadata1,
@@ -97,12 +126,28 @@ private:
                         const std::vector<std::vector<cv::DMatch> >& matches,
                         Eigen::Matrix4d& systemPose,
                         std::vector<std::vector<cv::DMatch> >& inliers) const;
+    // as solveP3PRansac, with hypotheses from pairs of matches and the
+    // rotation R of frameSet2 from the first system frame to the second
+    void solveP2PRansac(const FrameSetConstPtr& frameSet1,
+                        const FrameSetConstPtr& frameSet2,
+                        const std::vector<std::vector<cv::DMatch> >& matches,
+                        const Eigen::Matrix3d& R,
+                        Eigen::Matrix4d& systemPose,
+                        std::vector<std::vector<cv::DMatch> >& inliers) const;
+    // 2D-3D correspondences of the matches across all stereo cameras, and
+    // the (stereo camera, match) index of each
+    void buildAbsolutePoseBatch(const FrameSetConstPtr& frameSet1,
+                                const FrameSetConstPtr& frameSet2,
+                                const std::vector<std::vector<cv::DMatch> >& matches,
+                                AbsolutePoseBatch& batch,
+                                std::vector<std::pair<size_t,size_t> >& indices) const;
 
     void visualizeCorrespondences(const FrameSetConstPtr& frameSetPrev,
                                   const FrameSetConstPtr& frameSetCurr) const;
 
     const double k_epipolarThresh;
     const float k_maxDistanceRatio;
+    const double k_maxPriorRayAngle;
     const double k_maxStereoRange;
     const bool k_preUndistort;
     const double k_sphericalErrorThresh;
@@ -130,7 +175,16 @@ private:
     boost::shared_ptr<GCamIMU> m_gcam;
     boost::shared_ptr<GCamLocalBA> m_lba;
 
+    // IMU measurements not yet integrated, and the preintegration since
+    // the previous frame set
+    boost::mutex m_imuMutex;
+    std::deque<sensor_msgs::ImuConstPtr> m_imuQueue;
+    sensor_msgs::ImuConstPtr m_imuPrev;
+    ros::Time m_imuTime;
+    boost::shared_ptr<ImuPreintegration> m_imuPreintegration;
+
     boost::mutex m_globalMutex;
+    boost::mutex* m_mapMutex;
     size_t m_nCorrespondences;
     bool m_debug;
 };
@@ -0,0 +1,35 @@
+#ifndef PROFILERDIAGNOSTICS_H
+#define PROFILERDIAGNOSTICS_H
+
+#include <ros/ros.h>
+
+namespace px
+{
+
+// Periodically collects the Profiler records of all threads and
+// publishes the statistics of every stage as a diagnostic_msgs/
+// DiagnosticArray on /diagnostics, where rqt_runtime_monitor and
+// rosbag can pick them up. The Chrome trace, if started, is written at
+// each collection and closed on destruction.
+class ProfilerDiagnostics
+{
+public:
+    ProfilerDiagnostics(ros::NodeHandle& nh,
+                        const std::string& hardwareId,
+                        double period = 1.0);
+    ~ProfilerDiagnostics();
+
+    bool startTrace(const std::string& filename);
+
+private:
+    void publish(const ros::TimerEvent& event);
+
+    std::string m_hardwareId;
+    ros::Publisher m_diagnosticsPub;
+    ros::Timer m_timer;
+    bool m_tracing;
+};
+
+}
+
+#endif
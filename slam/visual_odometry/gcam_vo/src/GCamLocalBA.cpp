@@ -1,10 +1,12 @@
 #include "gcam_vo/GCamLocalBA.h"
 
+#include <algorithm>
 #include <boost/unordered_set.hpp>
 
 #include "camera_models/CostFunctionFactory.h"
 #include "cauldron/EigenQuaternionParameterization.h"
 #include "cauldron/EigenUtils.h"
+#include "cauldron/Profiler.h"
 #include "ceres/ceres.h"
 
 namespace px
@@ -13,6 +15,7 @@ namespace px
 GCamLocalBA::GCamLocalBA(const CameraSystemConstPtr& cameraSystem,
                          int N)
  : k_N(N)
+ , m_gravity(0.0, 0.0, -9.81)
 {
     for (int i = 0; i < cameraSystem->cameraCount(); ++i)
     {
@@ -26,17 +29,59 @@ GCamLocalBA::GCamLocalBA(const CameraSystemConstPtr& cameraSystem,
     }
 }
 
+Eigen::Vector3d&
+GCamLocalBA::gravity(void)
+{
+    return m_gravity;
+}
+
 bool
-GCamLocalBA::addFrameSet(FrameSetPtr& frameSet, bool replaceCurrentFrameSet)
+GCamLocalBA::addFrameSet(FrameSetPtr& frameSet, bool replaceCurrentFrameSet,
+                         const ImuPreintegration& preintegration)
 {
     if (replaceCurrentFrameSet)
     {
+        m_imuStates.erase(m_window.back().get());
         m_window.pop_back();
     }
 
+    if (preintegration.deltaTime() > 0.0 && !m_window.empty())
+    {
+        FrameSet* frameSetPrev = m_window.back().get();
+
+        // the first frame set with IMU measurements is assumed to be at rest
+        if (m_imuStates.find(frameSetPrev) == m_imuStates.end())
+        {
+            ImuState& statePrev = m_imuStates[frameSetPrev];
+
+            Eigen::Map<Eigen::Vector3d>(statePrev.velocityBias).setZero();
+            Eigen::Map<Eigen::Vector3d>(statePrev.velocityBias + 3) = preintegration.gyroBias();
+            Eigen::Map<Eigen::Vector3d>(statePrev.velocityBias + 6) = preintegration.accelBias();
+        }
+
+        ImuState& statePrev = m_imuStates[frameSetPrev];
+        ImuState& state = m_imuStates[frameSet.get()];
+        state.preintegration.reset(new ImuPreintegration(preintegration));
+
+        // predict the velocity from the previous frame set; the biases
+        // carry over
+        Eigen::Matrix4d H_prev = invertHomogeneousTransform(frameSetPrev->systemPose()->toMatrix());
+
+        Eigen::Matrix3d R_j;
+        Eigen::Vector3d v_j, p_j;
+        preintegration.predict(H_prev.block<3,3>(0,0),
+                               Eigen::Map<Eigen::Vector3d>(statePrev.velocityBias),
+                               H_prev.block<3,1>(0,3), m_gravity, R_j, v_j, p_j);
+
+        Eigen::Map<Eigen::Vector3d>(state.velocityBias) = v_j;
+        std::copy(statePrev.velocityBias + 3, statePrev.velocityBias + 9,
+                  state.velocityBias + 3);
+    }
+
     m_window.push_back(frameSet);
     while (m_window.size() > k_N)
     {
+        m_imuStates.erase(m_window.front().get());
         m_window.pop_front();
     }
 
@@ -48,9 +93,31 @@ GCamLocalBA::addFrameSet(FrameSetPtr& frameSet, bool replaceCurrentFrameSet)
     return true;
 }
 
+bool
+GCamLocalBA::getImuState(const FrameSet* frameSet, Eigen::Vector3d& velocity,
+                         Eigen::Vector3d& gyroBias, Eigen::Vector3d& accelBias) const
+{
+    boost::unordered_map<FrameSet*, ImuState>::const_iterator it =
+        m_imuStates.find(const_cast<FrameSet*>(frameSet));
+    if (it == m_imuStates.end())
+    {
+        return false;
+    }
+
+    const double* velocityBias = it->second.velocityBias;
+
+    velocity = Eigen::Map<const Eigen::Vector3d>(velocityBias);
+    gyroBias = Eigen::Map<const Eigen::Vector3d>(velocityBias + 3);
+    accelBias = Eigen::Map<const Eigen::Vector3d>(velocityBias + 6);
+
+    return true;
+}
+
 void
 GCamLocalBA::optimize(void)
 {
+    PX_PROFILE_SCOPE("gcam_vo.local_ba");
+
     ceres::Problem problem;
 
     boost::unordered_set<FrameSet*> frameSetsActive;
@@ -123,6 +190,36 @@ GCamLocalBA::optimize(void)
         }
     }
 
+    // inertial factors between consecutive frame sets in the window
+    FrameSet* frameSetPrev = 0;
+    for (std::list<FrameSetPtr>::iterator it = m_window.begin(); it != m_window.end(); ++it)
+    {
+        FrameSet* frameSet = it->get();
+
+        boost::unordered_map<FrameSet*, ImuState>::iterator itState = m_imuStates.find(frameSet);
+        if (frameSetPrev && itState != m_imuStates.end() && itState->second.preintegration)
+        {
+            ImuState& state = itState->second;
+            ImuState& statePrev = m_imuStates.find(frameSetPrev)->second;
+
+            ceres::CostFunction* costFunction =
+                new ceres::AutoDiffCostFunction<ImuFactor, ImuFactor::k_residualCount,
+                                                4, 3, ImuFactor::k_velocityBiasSize,
+                                                4, 3, ImuFactor::k_velocityBiasSize>(
+                    new ImuFactor(*state.preintegration, m_gravity));
+
+            problem.AddResidualBlock(costFunction, NULL,
+                                     frameSetPrev->systemPose()->rotationData(),
+                                     frameSetPrev->systemPose()->translationData(),
+                                     statePrev.velocityBias,
+                                     frameSet->systemPose()->rotationData(),
+                                     frameSet->systemPose()->translationData(),
+                                     state.velocityBias);
+        }
+
+        frameSetPrev = frameSet;
+    }
+
     for (boost::unordered_set<FrameSet*>::iterator it = frameSetsActive.begin();
              it != frameSetsActive.end(); ++it)
     {
@@ -7,21 +7,37 @@
 #include <ros/ros.h>
 
 #include "cauldron/EigenUtils.h"
+#include "cauldron/ImuPreintegration.h"
+#include "cauldron/Profiler.h"
+#include "cauldron/Random.h"
 #include "gcam/GCamIMU.h"
 #include "gcam_vo/GCamLocalBA.h"
-#include "pose_estimation/gP3P.h"
+#include "pose_estimation/AbsolutePoseRansac.h"
 
 namespace px
 {
 
+namespace
+{
+
+Eigen::Vector3d
+toEigen(const geometry_msgs::Vector3& v)
+{
+    return Eigen::Vector3d(v.x, v.y, v.z);
+}
+
+}
+
 GCamVO::GCamVO(const CameraSystemConstPtr& cameraSystem,
                bool preUndistort, bool useLocalBA)
  : k_epipolarThresh(0.00005)
  , k_maxDistanceRatio(0.7f)
+ , k_maxPriorRayAngle(0.2)
  , k_maxStereoRange(20.0)
  , k_preUndistort(preUndistort)
  , k_sphericalErrorThresh(0.999976)
  , m_cameraSystem(cameraSystem)
+ , m_mapMutex(0)
  , m_nCorrespondences(0)
  , m_debug(false)
 {
@@ -60,6 +76,7 @@ GCamVO::GCamVO(const CameraSystemConstPtr& cameraSystem,
     }
 
     m_gcam = boost::make_shared<GCamIMU>(cameraSystem);
+    m_imuPreintegration.reset(new ImuPreintegration);
 
     if (useLocalBA)
     {
@@ -102,6 +119,14 @@ GCamVO::init(const std::string& detectorType,
     return true;
 }
 
+void
+GCamVO::setMapMutex(boost::mutex& mapMutex)
+{
+    boost::lock_guard<boost::mutex> lock(m_globalMutex);
+
+    m_mapMutex = &mapMutex;
+}
+
 bool
 GCamVO::processFrames(const ros::Time& stamp,
                       const std::vector<cv::Mat>& imageVec,
@@ -110,6 +135,8 @@ GCamVO::processFrames(const ros::Time& stamp,
 {
     boost::lock_guard<boost::mutex> lock(m_globalMutex);
 
+    PX_PROFILE_SCOPE("gcam_vo.process_frames");
+
     ros::Time tsStart = ros::Time::now();
 
     int nCameras = m_cameraSystem->cameraCount();
@@ -156,6 +183,7 @@ GCamVO::processFrames(const ros::Time& stamp,
     }
 
     frameSet->imuMeasurement() = imu;
+    integrateImuMeasurements(stamp);
     for (int i = 0; i < nCameras; ++i)
     {
         FramePtr frame = boost::make_shared<Frame>();
@@ -197,9 +225,23 @@ GCamVO::processFrames(const ros::Time& stamp,
         }
     }
 
+    // the previous frame set and the scene points seen in it may be in
+    // the map
+    boost::unique_lock<boost::mutex> mapLock;
+    if (m_mapMutex)
+    {
+        boost::unique_lock<boost::mutex> lock(*m_mapMutex, boost::defer_lock);
+        mapLock.swap(lock);
+    }
+
     bool replaceCurrentFrameSet = false;
     if (m_frameSetCurr)
     {
+        if (mapLock.mutex())
+        {
+            mapLock.lock();
+        }
+
         // Current frame set is not keyed. Remove all references to
         // the current frame set.
         for (size_t i = 0; i < m_frameSetPrev->frames().size(); ++i)
@@ -250,6 +292,11 @@ GCamVO::processFrames(const ros::Time& stamp,
         m_frameSetCurr->prevFrameSet() = 0;
 
         replaceCurrentFrameSet = true;
+
+        if (mapLock.owns_lock())
+        {
+            mapLock.unlock();
+        }
     }
 
     if (!m_frameSetPrev)
@@ -267,6 +314,17 @@ GCamVO::processFrames(const ros::Time& stamp,
         Eigen::Matrix4d H = Eigen::Matrix4d::Identity();
         H.block<3,3>(0,0) = R.transpose();
 
+        // the system is assumed to be at rest, so that the accelerometer
+        // measures the reaction to gravity
+        if (m_lba)
+        {
+            Eigen::Vector3d accel = toEigen(imu->linear_acceleration);
+            if (accel.norm() > 0.0)
+            {
+                m_lba->gravity() = -(R * accel).normalized() * 9.81;
+            }
+        }
+
         PosePtr pose = boost::make_shared<Pose>(H);
         pose->timeStamp() = stamp;
 
@@ -276,9 +334,20 @@ GCamVO::processFrames(const ros::Time& stamp,
     {
         ros::Time tsStartPoseEst = ros::Time::now();
 
+        // The integrated gyro rates give the rotation from the previous
+        // system frame to the current one.
+        bool hasRotationPrior = m_imuPreintegration->deltaTime() > 0.0;
+        Eigen::Matrix3d R_prior = m_imuPreintegration->deltaR().transpose();
+
         // Find feature correspondences between previous and current frames.
+        std::vector<cv::Mat> masks;
+        if (hasRotationPrior)
+        {
+            computeRotationPriorMasks(m_frameSetPrev, frameSet, R_prior, masks);
+        }
+
         std::vector<std::vector<cv::DMatch> > rawMatches;
-        matchCorrespondences(m_frameSetPrev, frameSet, rawMatches);
+        matchCorrespondences(m_frameSetPrev, frameSet, rawMatches, masks);
 
         size_t nRawMatches = 0;
         for (size_t i = 0; i < rawMatches.size(); ++i)
@@ -294,8 +363,7 @@ GCamVO::processFrames(const ros::Time& stamp,
         Eigen::Matrix4d systemPose;
         std::vector<std::vector<cv::DMatch> > matches;
 
-        if ((frameSet->systemPose()->timeStamp() -
-             m_frameSetPrev->systemPose()->timeStamp()).toSec() > 0.3)
+        if ((stamp - m_frameSetPrev->systemPose()->timeStamp()).toSec() > 0.3)
         {
             if (m_debug)
             {
@@ -305,6 +373,15 @@ GCamVO::processFrames(const ros::Time& stamp,
             // Estimate pose from 3-pt RANSAC
             solve3PRansac(m_frameSetPrev, frameSet, rawMatches, systemPose, matches);
         }
+        else if (hasRotationPrior)
+        {
+            if (m_debug)
+            {
+                ROS_INFO("Estimating pose with 2-pt RANSAC and gyro rotation...");
+            }
+
+            solveP2PRansac(m_frameSetPrev, frameSet, rawMatches, R_prior, systemPose, matches);
+        }
         else
         {
             if (m_debug)
@@ -321,6 +398,7 @@ GCamVO::processFrames(const ros::Time& stamp,
         {
             m_nCorrespondences += matches.at(i).size();
         }
+        Profiler::instance()->addSample("gcam_vo.temporal_inliers", m_nCorrespondences);
 
         if (m_nCorrespondences < 10)
         {
@@ -333,6 +411,13 @@ GCamVO::processFrames(const ros::Time& stamp,
 
         frameSet->systemPose() = pose;
 
+        // held until the end, as local BA also moves the frame sets and
+        // scene points of the map
+        if (mapLock.mutex())
+        {
+            mapLock.lock();
+        }
+
         for (int i = 0; i < nStereoCameras; ++i)
         {
             int cameraId1 = i * 2;
@@ -433,7 +518,7 @@ GCamVO::processFrames(const ros::Time& stamp,
 
     if (m_lba)
     {
-        m_lba->addFrameSet(frameSet, replaceCurrentFrameSet);
+        m_lba->addFrameSet(frameSet, replaceCurrentFrameSet, *m_imuPreintegration);
     }
 
     // remove stereo correspondences that have high reprojection errors
@@ -550,6 +635,9 @@ GCamVO::processFrames(const ros::Time& stamp,
     if (!m_frameSetPrev)
     {
         m_frameSetPrev = frameSet;
+
+        m_imuPreintegration->reset(m_imuPreintegration->gyroBias(),
+                                   m_imuPreintegration->accelBias());
     }
     else
     {
@@ -569,6 +657,21 @@ GCamVO::processFrames(const ros::Time& stamp,
     return true;
 }
 
+void
+GCamVO::addImuMeasurement(const sensor_msgs::ImuConstPtr& imu)
+{
+    boost::lock_guard<boost::mutex> lock(m_imuMutex);
+
+    // bound the queue if no frame sets are processed
+    const size_t k_maxQueueSize = 2000;
+    if (m_imuQueue.size() >= k_maxQueueSize)
+    {
+        m_imuQueue.pop_front();
+    }
+
+    m_imuQueue.push_back(imu);
+}
+
 size_t
 GCamVO::getCurrentCorrespondenceCount(void) const
 {
@@ -586,6 +689,17 @@ GCamVO::keyCurrentFrameSet(void)
     m_frameSetPrev = m_frameSetCurr;
     m_frameSetCurr.reset();
 
+    // integrate from the new key frame set on, with the latest bias
+    // estimates
+    Eigen::Vector3d velocity;
+    Eigen::Vector3d gyroBias = m_imuPreintegration->gyroBias();
+    Eigen::Vector3d accelBias = m_imuPreintegration->accelBias();
+    if (m_lba)
+    {
+        m_lba->getImuState(m_frameSetPrev.get(), velocity, gyroBias, accelBias);
+    }
+    m_imuPreintegration->reset(gyroBias, accelBias);
+
     if (m_debug)
     {
         ROS_INFO("Keyed frameset.");
@@ -692,8 +806,11 @@ GCamVO::matchDescriptors(const cv::Mat& queryDescriptors,
 void
 GCamVO::matchCorrespondences(const FrameSetConstPtr& frameSet1,
                              const FrameSetConstPtr& frameSet2,
-                             std::vector<std::vector<cv::DMatch> >& matches) const
+                             std::vector<std::vector<cv::DMatch> >& matches,
+                             const std::vector<cv::Mat>& masks) const
 {
+    PX_PROFILE_SCOPE("gcam_vo.temporal_matching");
+
     std::vector<cv::Mat> dtors1;
     getDescriptorMatVec(frameSet1, dtors1);
 
@@ -705,6 +822,9 @@ GCamVO::matchCorrespondences(const FrameSetConstPtr& frameSet1,
 
     matches.resize(nStereoCameras);
 
+    std::vector<cv::Mat> noMasks(m_cameraSystem->cameraCount());
+    const std::vector<cv::Mat>& cameraMasks = masks.empty() ? noMasks : masks;
+
     for (int i = 0; i < nStereoCameras; ++i)
     {
         int cameraId1 = i * 2;
@@ -716,6 +836,8 @@ GCamVO::matchCorrespondences(const FrameSetConstPtr& frameSet1,
                                                                       boost::cref(dtors1.at(cameraId2)),
                                                                       boost::cref(dtors2.at(cameraId1)),
                                                                       boost::cref(dtors2.at(cameraId2)),
+                                                                      boost::cref(cameraMasks.at(cameraId1)),
+                                                                      boost::cref(cameraMasks.at(cameraId2)),
                                                                       boost::ref(matches.at(i))));
     }
     for (int i = 0; i < nStereoCameras; ++i)
@@ -729,6 +851,8 @@ GCamVO::matchStereoCorrespondences(const cv::Mat& dtors11,
                                    const cv::Mat& dtors12,
                                    const cv::Mat& dtors21,
                                    const cv::Mat& dtors22,
+                                   const cv::Mat& mask1,
+                                   const cv::Mat& mask2,
                                    std::vector<cv::DMatch>& matches) const
 {
     matches.clear();
@@ -738,11 +862,11 @@ GCamVO::matchStereoCorrespondences(const cv::Mat& dtors11,
 
     threads[0] = boost::make_shared<boost::thread>(boost::bind(&GCamVO::matchDescriptors, this,
                                                                boost::cref(dtors11), boost::cref(dtors21), boost::ref(rawMatches1),
-                                                               cv::Mat(), BEST_MATCH, k_maxDistanceRatio));
+                                                               mask1, BEST_MATCH, k_maxDistanceRatio));
 
     threads[1] = boost::make_shared<boost::thread>(boost::bind(&GCamVO::matchDescriptors, this,
                                                                boost::cref(dtors12), boost::cref(dtors22), boost::ref(rawMatches2),
-                                                               cv::Mat(), BEST_MATCH, k_maxDistanceRatio));
+                                                               mask2, BEST_MATCH, k_maxDistanceRatio));
 
     threads[0]->join();
     threads[1]->join();
@@ -787,6 +911,83 @@ GCamVO::matchStereoCorrespondences(const cv::Mat& dtors11,
     }
 }
 
+void
+GCamVO::computeRotationPriorMasks(const FrameSetConstPtr& frameSet1,
+                                  const FrameSetConstPtr& frameSet2,
+                                  const Eigen::Matrix3d& R,
+                                  std::vector<cv::Mat>& masks) const
+{
+    double cosThresh = cos(k_maxPriorRayAngle);
+
+    int nCameras = m_cameraSystem->cameraCount();
+    masks.resize(nCameras);
+    for (int i = 0; i < nCameras; ++i)
+    {
+        const std::vector<Point2DFeaturePtr>& features1 = frameSet1->frame(i)->features2D();
+        const std::vector<Point2DFeaturePtr>& features2 = frameSet2->frame(i)->features2D();
+
+        // rotation of the camera between the frame sets
+        Eigen::Matrix3d R_cam_sys = m_cameraSystem->getGlobalCameraPose(i).block<3,3>(0,0);
+        Eigen::Matrix3d R_cam = R_cam_sys.transpose() * R * R_cam_sys;
+
+        Eigen::MatrixXd rays2(3, features2.size());
+        for (size_t k = 0; k < features2.size(); ++k)
+        {
+            rays2.col(k) = features2.at(k)->ray();
+        }
+
+        cv::Mat& mask = masks.at(i);
+        mask = cv::Mat::zeros(features1.size(), features2.size(), CV_8U);
+        for (size_t j = 0; j < features1.size(); ++j)
+        {
+            Eigen::RowVectorXd cosAngles = (R_cam * features1.at(j)->ray()).transpose() * rays2;
+
+            unsigned char* row = mask.ptr<unsigned char>(j);
+            for (size_t k = 0; k < features2.size(); ++k)
+            {
+                row[k] = cosAngles(k) >= cosThresh;
+            }
+        }
+    }
+}
+
+void
+GCamVO::integrateImuMeasurements(const ros::Time& stamp)
+{
+    boost::lock_guard<boost::mutex> lock(m_imuMutex);
+
+    // each measurement holds until the next one
+    while (!m_imuQueue.empty() && m_imuQueue.front()->header.stamp <= stamp)
+    {
+        // a sample older than the integrated interval arrived late, and
+        // must not move m_imuTime back
+        if (m_imuPrev && m_imuQueue.front()->header.stamp < m_imuTime)
+        {
+            m_imuQueue.pop_front();
+            continue;
+        }
+
+        if (m_imuPrev)
+        {
+            m_imuPreintegration->integrate(toEigen(m_imuPrev->angular_velocity),
+                                           toEigen(m_imuPrev->linear_acceleration),
+                                           (m_imuQueue.front()->header.stamp - m_imuTime).toSec());
+        }
+
+        m_imuPrev = m_imuQueue.front();
+        m_imuTime = m_imuPrev->header.stamp;
+        m_imuQueue.pop_front();
+    }
+
+    if (m_imuPrev && stamp > m_imuTime)
+    {
+        m_imuPreintegration->integrate(toEigen(m_imuPrev->angular_velocity),
+                                       toEigen(m_imuPrev->linear_acceleration),
+                                       (stamp - m_imuTime).toSec());
+        m_imuTime = stamp;
+    }
+}
+
 void
 GCamVO::processFrame(CameraMetadata& metadata) const
 {
@@ -805,7 +1006,10 @@ GCamVO::processFrame(CameraMetadata& metadata) const
     }
 
     // Detect features.
+    uint64_t tsDetect = Profiler::now();
     m_featureDetector->detect(metadata.procImage, metadata.kpts);
+    Profiler::instance()->addTimer("gcam_vo.detection", tsDetect, Profiler::now());
+    Profiler::instance()->addSample("gcam_vo.features", metadata.kpts.size());
 
     // Backproject feature coordinates to rays with spherical coordinates.
     metadata.spts.resize(metadata.kpts.size());
@@ -817,6 +1021,8 @@ GCamVO::processFrame(CameraMetadata& metadata) const
                                     metadata.spts.at(i));
     }
 
+    PX_PROFILE_SCOPE("gcam_vo.description");
+
     m_descriptorExtractor->compute(metadata.procImage, metadata.kpts,
                                    metadata.dtors);
 }
@@ -825,6 +1031,8 @@ void
 GCamVO::processStereoFrame(CameraMetadata& metadata1,
                            CameraMetadata& metadata2) const
 {
+    PX_PROFILE_SCOPE("gcam_vo.stereo_matching");
+
     // Match descriptors between stereo images.
     std::vector<cv::DMatch> rawMatches;
     matchDescriptors(metadata1.dtors, metadata2.dtors, rawMatches,
@@ -1003,6 +1211,8 @@ GCamVO::solve3PRansac(const FrameSetConstPtr& frameSet1,
                       Eigen::Matrix4d& systemPose,
                       std::vector<std::vector<cv::DMatch> >& inliers) const
 {
+    PX_PROFILE_SCOPE("gcam_vo.ransac");
+
     inliers.clear();
 
     double p = 0.99; // probability that at least one set of random samples does not contain an outlier
@@ -1031,21 +1241,29 @@ GCamVO::solve3PRansac(const FrameSetConstPtr& frameSet1,
         }
     }
 
+    Xoshiro256& rng = threadRng();
+    std::vector<size_t> sampleIds;
+
     // run RANSAC to find best H
     Eigen::Matrix4d H_best;
     size_t nInliers_best = 0;
     std::vector<std::vector<size_t> > inlierIds_best;
     for (int i = 0; i < N; ++i)
     {
-        std::random_shuffle(indices.begin(), indices.end());
+        if (!sampleKofN(rng, 3, indices.size(), sampleIds))
+        {
+            break;
+        }
 
         std::vector<PLineCorrespondence, Eigen::aligned_allocator<PLineCorrespondence> > lcVec;
         for (int j = 0; j < 3; ++j)
         {
-            int cameraId = indices.at(j).first * 2;
-            int matchId = indices.at(j).second;
+            const std::pair<size_t,size_t>& idx = indices.at(sampleIds.at(j));
+
+            int cameraId = idx.first * 2;
+            int matchId = idx.second;
 
-            const cv::DMatch& match = matches.at(indices.at(j).first).at(matchId);
+            const cv::DMatch& match = matches.at(idx.first).at(matchId);
 
             lcVec.push_back(PLineCorrespondence(cameraId,
                                                 frameSet1->frame(cameraId)->features2D().at(match.queryIdx)->ray(),
@@ -1126,6 +1344,8 @@ GCamVO::solveP3PRansac(const FrameSetConstPtr& frameSet1,
                        Eigen::Matrix4d& systemPose,
                        std::vector<std::vector<cv::DMatch> >& inliers) const
 {
+    PX_PROFILE_SCOPE("gcam_vo.ransac");
+
     inliers.clear();
 
     double p = 0.99; // probability that at least one set of random samples does not contain an outlier
@@ -1134,109 +1354,124 @@ GCamVO::solveP3PRansac(const FrameSetConstPtr& frameSet1,
     double u = 1.0 - v;
     int N = static_cast<int>(log(1.0 - p) / log(1.0 - u * u * u) + 0.5);
 
+    AbsolutePoseBatch batch;
     std::vector<std::pair<size_t,size_t> > indices;
-    int nMatches = 0;
-    for (size_t i = 0; i < matches.size(); ++i)
-    {
-        size_t nSubMatches = matches.at(i).size();
-
-        indices.reserve(indices.size() + nSubMatches);
-        for (size_t j = 0; j < nSubMatches; ++j)
-        {
-            indices.push_back(std::make_pair(i,j));
-        }
-    }
+    buildAbsolutePoseBatch(frameSet1, frameSet2, matches, batch, indices);
 
     // run RANSAC to find best H
+    AbsolutePoseRansac ransac;
+    ransac.threshold() = k_sphericalErrorThresh;
+    ransac.confidence() = p;
+    ransac.maxIterations() = N;
+
     Eigen::Matrix4d H_best;
-    size_t nInliers_best = 0;
-    std::vector<std::vector<size_t> > inlierIds_best;
-    for (int i = 0; i < N; ++i)
+    std::vector<bool> inlierFlags;
+    if (ransac.estimate(batch, H_best, inlierFlags))
     {
-        std::random_shuffle(indices.begin(), indices.end());
-
-        std::vector<PLine, Eigen::aligned_allocator<PLine> > plines(3);
-        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > worldPoints(3);
-        for (int j = 0; j < 3; ++j)
+        inliers.resize(matches.size());
+        for (size_t i = 0; i < inlierFlags.size(); ++i)
         {
-            int stereoId = indices.at(j).first;
-            int cameraId = stereoId * 2;
-            int matchId = indices.at(j).second;
-
-            const cv::DMatch& match = matches.at(stereoId).at(matchId);
-
-            worldPoints.at(j) = frameSet1->frame(cameraId)->features2D().at(match.queryIdx)->feature3D()->point();
-            plines.at(j) = PLine(frameSet2->frame(cameraId)->features2D().at(match.trainIdx)->ray(),
-                                 m_cameraSystem->getGlobalCameraPose(cameraId));
-        }
+            if (inlierFlags.at(i))
+            {
+                const std::pair<size_t,size_t>& index = indices.at(i);
 
-        std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > H;
-        if (!solvegP3P(plines, worldPoints, H))
-        {
-            continue;
+                inliers.at(index.first).push_back(matches.at(index.first).at(index.second));
+            }
         }
+    }
+    else
+    {
+        H_best.setIdentity();
+    }
 
-        for (size_t j = 0; j < H.size(); ++j)
-        {
-            Eigen::Matrix4d H_inv = invertHomogeneousTransform(H.at(j));
-
-            size_t nInliers = 0;
-            std::vector<std::vector<size_t> > inlierIds(matches.size());
-            for (size_t k = 0; k < matches.size(); ++k)
-            {
-                const std::vector<cv::DMatch>& subMatches = matches.at(k);
-                std::vector<size_t>& subInlierIds = inlierIds.at(k);
+    systemPose = invertHomogeneousTransform(H_best);
+}
 
-                int cameraId = k * 2;
-                const std::vector<Point2DFeaturePtr>& features1 = frameSet1->frame(cameraId)->features2D();
-                const std::vector<Point2DFeaturePtr>& features2 = frameSet2->frame(cameraId)->features2D();
-                Eigen::Matrix4d H_cam = invertHomogeneousTransform(m_cameraSystem->getGlobalCameraPose(cameraId)) * H_inv;
+void
+GCamVO::solveP2PRansac(const FrameSetConstPtr& frameSet1,
+                       const FrameSetConstPtr& frameSet2,
+                       const std::vector<std::vector<cv::DMatch> >& matches,
+                       const Eigen::Matrix3d& R,
+                       Eigen::Matrix4d& systemPose,
+                       std::vector<std::vector<cv::DMatch> >& inliers) const
+{
+    PX_PROFILE_SCOPE("gcam_vo.ransac");
 
-                subInlierIds.reserve(subMatches.size());
-                for (size_t l = 0; l < subMatches.size(); ++l)
-                {
-                    const cv::DMatch& match = subMatches.at(l);
+    inliers.clear();
 
-                    Eigen::Vector3d P = features1.at(match.queryIdx)->feature3D()->point();
+    double p = 0.99; // probability that at least one set of random samples does not contain an outlier
+    double v = 0.6; // probability of observing an outlier
 
-                    Eigen::Vector3d P_cam_pred = transformPoint(H_cam, P);
+    double u = 1.0 - v;
+    int N = static_cast<int>(log(1.0 - p) / log(1.0 - u * u) + 0.5);
 
-                    const Point2DFeatureConstPtr& f2 = features2.at(match.trainIdx);
+    AbsolutePoseBatch batch;
+    std::vector<std::pair<size_t,size_t> > indices;
+    buildAbsolutePoseBatch(frameSet1, frameSet2, matches, batch, indices);
 
-                    double err = fabs(P_cam_pred.normalized().dot(f2->ray()));
-                    if (err < k_sphericalErrorThresh)
-                    {
-                        continue;
-                    }
+    // rotation of the current system frame to the world frame
+    Eigen::Matrix3d R_world_sys = frameSet1->systemPose()->toMatrix().block<3,3>(0,0).transpose() *
+                                  R.transpose();
 
-                    subInlierIds.push_back(l);
-                    ++nInliers;
-                }
-            }
+    // run RANSAC to find best H
+    AbsolutePoseRansac ransac;
+    ransac.threshold() = k_sphericalErrorThresh;
+    ransac.confidence() = p;
+    ransac.maxIterations() = N;
 
-            if (nInliers > nInliers_best)
+    Eigen::Matrix4d H_best;
+    std::vector<bool> inlierFlags;
+    if (ransac.estimate(batch, R_world_sys, H_best, inlierFlags))
+    {
+        inliers.resize(matches.size());
+        for (size_t i = 0; i < inlierFlags.size(); ++i)
+        {
+            if (inlierFlags.at(i))
             {
-                H_best = H_inv;
-                nInliers_best = nInliers;
-                inlierIds_best = inlierIds;
+                const std::pair<size_t,size_t>& index = indices.at(i);
+
+                inliers.at(index.first).push_back(matches.at(index.first).at(index.second));
             }
         }
     }
+    else
+    {
+        H_best.setIdentity();
+    }
 
-    inliers.resize(inlierIds_best.size());
-    for (size_t i = 0; i < inlierIds_best.size(); ++i)
+    systemPose = invertHomogeneousTransform(H_best);
+}
+
+void
+GCamVO::buildAbsolutePoseBatch(const FrameSetConstPtr& frameSet1,
+                               const FrameSetConstPtr& frameSet2,
+                               const std::vector<std::vector<cv::DMatch> >& matches,
+                               AbsolutePoseBatch& batch,
+                               std::vector<std::pair<size_t,size_t> >& indices) const
+{
+    batch.clear();
+    indices.clear();
+
+    for (size_t i = 0; i < matches.size(); ++i)
     {
-        std::vector<cv::DMatch>& subInliers = inliers.at(i);
-        std::vector<size_t>& subInlierIds_best = inlierIds_best.at(i);
         const std::vector<cv::DMatch>& subMatches = matches.at(i);
 
-        for (size_t j = 0; j < subInlierIds_best.size(); ++j)
+        int cameraId = i * 2;
+        const std::vector<Point2DFeaturePtr>& features1 = frameSet1->frame(cameraId)->features2D();
+        const std::vector<Point2DFeaturePtr>& features2 = frameSet2->frame(cameraId)->features2D();
+        Eigen::Matrix4d H_sys_cam = m_cameraSystem->getGlobalCameraPose(cameraId);
+
+        batch.reserve(batch.size() + subMatches.size());
+        indices.reserve(indices.size() + subMatches.size());
+        for (size_t j = 0; j < subMatches.size(); ++j)
         {
-            subInliers.push_back(subMatches.at(subInlierIds_best.at(j)));
+            const cv::DMatch& match = subMatches.at(j);
+
+            batch.add(features1.at(match.queryIdx)->feature3D()->point(),
+                      features2.at(match.trainIdx)->ray(), H_sys_cam);
+            indices.push_back(std::make_pair(i,j));
         }
     }
-
-    systemPose = H_best;
 }
 
 void
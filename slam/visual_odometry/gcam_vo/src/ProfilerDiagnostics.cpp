@@ -0,0 +1,114 @@
+#include "gcam_vo/ProfilerDiagnostics.h"
+
+#include <diagnostic_msgs/DiagnosticArray.h>
+#include <sstream>
+
+#include "cauldron/Profiler.h"
+
+namespace px
+{
+
+namespace
+{
+
+void
+addKeyValue(diagnostic_msgs::DiagnosticStatus& status,
+            const std::string& key, double value)
+{
+    std::ostringstream oss;
+    oss << value;
+
+    diagnostic_msgs::KeyValue keyValue;
+    keyValue.key = key;
+    keyValue.value = oss.str();
+
+    status.values.push_back(keyValue);
+}
+
+}
+
+ProfilerDiagnostics::ProfilerDiagnostics(ros::NodeHandle& nh,
+                                         const std::string& hardwareId,
+                                         double period)
+ : m_hardwareId(hardwareId)
+ , m_tracing(false)
+{
+    m_diagnosticsPub = nh.advertise<diagnostic_msgs::DiagnosticArray>("/diagnostics", 1);
+    m_timer = nh.createTimer(ros::Duration(period), &ProfilerDiagnostics::publish, this);
+}
+
+ProfilerDiagnostics::~ProfilerDiagnostics()
+{
+    m_timer.stop();
+
+    if (m_tracing)
+    {
+        Profiler::instance()->stopTrace();
+    }
+}
+
+bool
+ProfilerDiagnostics::startTrace(const std::string& filename)
+{
+    if (!Profiler::instance()->startTrace(filename))
+    {
+        ROS_ERROR("Failed to open trace file %s.", filename.c_str());
+        return false;
+    }
+
+    m_tracing = true;
+
+    return true;
+}
+
+void
+ProfilerDiagnostics::publish(const ros::TimerEvent& event)
+{
+    Profiler* profiler = Profiler::instance();
+    profiler->collect();
+
+    std::vector<Profiler::Statistics> statistics;
+    profiler->getStatistics(statistics);
+
+    diagnostic_msgs::DiagnosticArray msg;
+    msg.header.stamp = ros::Time::now();
+
+    for (size_t i = 0; i < statistics.size(); ++i)
+    {
+        const Profiler::Statistics& s = statistics.at(i);
+
+        diagnostic_msgs::DiagnosticStatus status;
+        status.name = s.name;
+        status.hardware_id = m_hardwareId;
+
+        if (profiler->droppedRecordCount() > 0)
+        {
+            status.level = diagnostic_msgs::DiagnosticStatus::WARN;
+            status.message = "Records were dropped.";
+        }
+        else
+        {
+            status.level = diagnostic_msgs::DiagnosticStatus::OK;
+        }
+
+        // timers are reported in milliseconds
+        double scale = (s.type == Profiler::TIMER) ? 1e3 : 1.0;
+
+        addKeyValue(status, "count", s.count);
+        addKeyValue(status, "mean", s.mean() * scale);
+        addKeyValue(status, "p50", s.percentile(0.5) * scale);
+        addKeyValue(status, "p90", s.percentile(0.9) * scale);
+        addKeyValue(status, "p99", s.percentile(0.99) * scale);
+        addKeyValue(status, "max", s.max * scale);
+        if (s.type == Profiler::COUNTER)
+        {
+            addKeyValue(status, "sum", s.sum);
+        }
+
+        msg.status.push_back(status);
+    }
+
+    m_diagnosticsPub.publish(msg);
+}
+
+}
@@ -1,26 +1,30 @@
+#include <algorithm>
 #include <cv_bridge/cv_bridge.h>
 #include <geometry_msgs/PoseStamped.h>
-#include <message_filters/subscriber.h>
-#include <message_filters/time_synchronizer.h>
+#include <multicam_msgs/FrameSet.h>
 #include <ros/ros.h>
 #include <sensor_msgs/Imu.h>
 
 #include "camera_models/CameraFactory.h"
 #include "camera_systems/CameraSystem.h"
 #include "cauldron/DataBuffer.h"
+#include "cauldron/Random.h"
 #include "sparse_graph/SparseGraphViz.h"
 #include "gcam_vo/GCamVO.h"
+#include "gcam_vo/ProfilerDiagnostics.h"
 
 class Container
 {
 public:
-    Container(std::vector<cv::Mat>& _imageVec,
+    Container(const std::vector<std::string>& _cameraNsVec,
+              std::vector<cv::Mat>& _imageVec,
               px::DataBuffer<sensor_msgs::ImuConstPtr>& _imuBuffer,
               px::GCamVO& _gvo,
               px::SparseGraphPtr& _sparseGraph,
               px::SparseGraphViz& _sgv,
               ros::Publisher& _posePub)
-     : imageVec(_imageVec)
+     : cameraNsVec(_cameraNsVec)
+     , imageVec(_imageVec)
      , imuBuffer(_imuBuffer)
      , gvo(_gvo)
      , sparseGraph(_sparseGraph)
@@ -30,6 +34,7 @@ public:
 
     }
 
+    const std::vector<std::string>& cameraNsVec;
     std::vector<cv::Mat>& imageVec;
     px::DataBuffer<sensor_msgs::ImuConstPtr>& imuBuffer;
     px::GCamVO& gvo;
@@ -49,19 +54,54 @@ cameraInfoCallback(const px_comm::CameraInfoConstPtr& msg,
 
 void
 imuCallback(const sensor_msgs::ImuConstPtr& imuMsg,
-            px::DataBuffer<sensor_msgs::ImuConstPtr>& imuBuffer)
+            px::DataBuffer<sensor_msgs::ImuConstPtr>& imuBuffer,
+            px::GCamVO& gvo)
 {
     imuBuffer.push(imuMsg->header.stamp, imuMsg);
+    gvo.addImuMeasurement(imuMsg);
+}
+
+bool
+readFrameSet(const multicam_msgs::FrameSetConstPtr& frameSetMsg,
+             const std::vector<std::string>& cameraNsVec,
+             std::vector<cv::Mat>& imageVec)
+{
+    for (size_t i = 0; i < cameraNsVec.size(); ++i)
+    {
+        std::vector<std::string>::const_iterator it =
+            std::find(frameSetMsg->camera_ns.begin(), frameSetMsg->camera_ns.end(),
+                      cameraNsVec.at(i));
+        if (it == frameSetMsg->camera_ns.end())
+        {
+            ROS_WARN("Frame set has no image from camera %s.", cameraNsVec.at(i).c_str());
+            return false;
+        }
+
+        const sensor_msgs::Image& imageMsg =
+            frameSetMsg->images.at(it - frameSetMsg->camera_ns.begin());
+
+        try
+        {
+            cv_bridge::CvImageConstPtr cv_ptr = cv_bridge::toCvShare(imageMsg, frameSetMsg);
+
+            cv_ptr->image.copyTo(imageVec.at(i));
+        }
+        catch (cv_bridge::Exception& e)
+        {
+            ROS_ERROR("cv_bridge exception: %s", e.what());
+            return false;
+        }
+    }
+
+    return true;
 }
 
 void
-dataCallback(const sensor_msgs::ImageConstPtr& imageMsg0,
-             const sensor_msgs::ImageConstPtr& imageMsg1,
-             const sensor_msgs::ImageConstPtr& imageMsg2,
-             const sensor_msgs::ImageConstPtr& imageMsg3,
+dataCallback(const multicam_msgs::FrameSetConstPtr& frameSetMsg,
              Container& container)
 {
-    ros::Time stamp = imageMsg0->header.stamp;
+    // all images in a frame set share the same stamp
+    ros::Time stamp = frameSetMsg->header.stamp;
 
     sensor_msgs::ImuConstPtr imuMsg;
     if (!container.imuBuffer.find(stamp, imuMsg))
@@ -70,24 +110,8 @@ dataCallback(const sensor_msgs::ImageConstPtr& imageMsg0,
         return;
     }
 
-    std::vector<sensor_msgs::ImageConstPtr> imageMsgs;
-    imageMsgs.push_back(imageMsg0);
-    imageMsgs.push_back(imageMsg1);
-    imageMsgs.push_back(imageMsg2);
-    imageMsgs.push_back(imageMsg3);
-
-    try
-    {
-        for (size_t i = 0; i < imageMsgs.size(); ++i)
-        {
-            cv_bridge::CvImageConstPtr cv_ptr = cv_bridge::toCvShare(imageMsgs.at(i));
-
-            cv_ptr->image.copyTo(container.imageVec.at(i));
-        }
-    }
-    catch (cv_bridge::Exception& e)
+    if (!readFrameSet(frameSetMsg, container.cameraNsVec, container.imageVec))
     {
-        ROS_ERROR("cv_bridge exception: %s", e.what());
         return;
     }
 
@@ -130,6 +154,22 @@ main(int argc, char** argv)
 
     ros::NodeHandle nh;
 
+    // RANSAC draws from generators derived from this seed, so that runs
+    // on the same data are reproducible
+    int randomSeed;
+    nh.param("random_seed", randomSeed, 0);
+    px::setRandomSeed(randomSeed);
+
+    // per-stage timing statistics go to /diagnostics, and optionally to
+    // a Chrome trace file
+    px::ProfilerDiagnostics profilerDiagnostics(nh, "gcam_vo");
+
+    std::string traceFilename;
+    if (nh.getParam("trace_file", traceFilename))
+    {
+        profilerDiagnostics.startTrace(traceFilename);
+    }
+
     // get IMU topic name
     std::string imuTopicName;
     if (!nh.getParam("imu_topic", imuTopicName))
@@ -146,6 +186,14 @@ main(int argc, char** argv)
         return 1;
     }
 
+    // get frame set topic name
+    std::string frameSetTopicName;
+    if (!nh.getParam("frame_set_topic", frameSetTopicName))
+    {
+        ROS_ERROR("Cannot retrieve parameter: frame_set_topic");
+        return 1;
+    }
+
     // get namespaces of all cameras
     std::vector<std::string> cameraNsVec;
     while (1)
@@ -159,7 +207,8 @@ main(int argc, char** argv)
             break;
         }
 
-        cameraNsVec.push_back(cameraNs);
+        // frame sets identify cameras by their resolved namespace
+        cameraNsVec.push_back(ros::names::resolve(cameraNs));
     }
 
     if (cameraNsVec.empty())
@@ -217,34 +266,16 @@ main(int argc, char** argv)
 
     std::vector<cv::Mat> imageVec(cameraSystem->cameraCount());
     px::DataBuffer<sensor_msgs::ImuConstPtr> imuBuffer(50);
-    ros::Subscriber imuSub = nh.subscribe<sensor_msgs::Imu>(imuTopicName, 10, boost::bind(imuCallback, _1, boost::ref(imuBuffer)));
-
-    std::vector<boost::shared_ptr<message_filters::Subscriber<sensor_msgs::Image> > > imageSubs(cameraSystem->cameraCount());
-    for (size_t i = 0; i < cameraNsVec.size(); ++i)
-    {
-        imageSubs.at(i) = boost::make_shared<message_filters::Subscriber<sensor_msgs::Image> >(boost::ref(nh),
-                                                                                               ros::names::append(cameraNsVec.at(i), "image_raw"),
-                                                                                               2);
-    }
+    ros::Subscriber imuSub = nh.subscribe<sensor_msgs::Imu>(imuTopicName, 10, boost::bind(imuCallback, _1, boost::ref(imuBuffer), boost::ref(gvo)));
 
     ros::Publisher posePub = nh.advertise<geometry_msgs::PoseStamped>(poseTopicName, 2);
 
-    // assume for now that 4 cameras are used
-    message_filters::TimeSynchronizer<sensor_msgs::Image,
-                                      sensor_msgs::Image,
-                                      sensor_msgs::Image,
-                                      sensor_msgs::Image> sync(*imageSubs.at(0),
-                                                               *imageSubs.at(1),
-                                                               *imageSubs.at(2),
-                                                               *imageSubs.at(3),
-                                                               2);
-
     px::SparseGraphPtr sparseGraph = boost::make_shared<px::SparseGraph>();
     px::SparseGraphViz sgv(nh, sparseGraph);
-    Container container(imageVec, imuBuffer, gvo, sparseGraph, sgv, posePub);
+    Container container(cameraNsVec, imageVec, imuBuffer, gvo, sparseGraph, sgv, posePub);
 
-    sync.registerCallback(boost::bind(dataCallback, _1, _2, _3, _4,
-                                      boost::ref(container)));
+    ros::Subscriber frameSetSub = nh.subscribe<multicam_msgs::FrameSet>(frameSetTopicName, 2,
+                                                                        boost::bind(dataCallback, _1, boost::ref(container)));
 
     ros::AsyncSpinner spinner(0);
     spinner.start();
@@ -5,6 +5,7 @@
 #include "camera_models/CostFunctionFactory.h"
 #include "cauldron/EigenQuaternionParameterization.h"
 #include "cauldron/EigenUtils.h"
+#include "cauldron/Profiler.h"
 #include "ceres/ceres.h"
 
 namespace px
@@ -46,6 +47,8 @@ LocalMonoBA::addFrameSet(FrameSetPtr& frameSet, bool replaceCurrentFrameSet)
 void
 LocalMonoBA::optimize(void)
 {
+    PX_PROFILE_SCOPE("mono_vo.local_ba");
+
     ceres::Problem problem;
 
     boost::unordered_set<FrameSet*> frameSetsActive;
@@ -1,14 +1,14 @@
 #include "mono_vo/MonoVO.h"
 
-#include <opencv2/core/eigen.hpp>
 #include <opencv2/calib3d/calib3d.hpp>
 #include <opencv2/highgui/highgui.hpp>
 #include <opencv2/imgproc/imgproc.hpp>
 #include <ros/ros.h>
 
 #include "cauldron/EigenUtils.h"
-#include "fivepoint/fivepoint.hpp"
-#include "pose_estimation/P3P.h"
+#include "cauldron/Profiler.h"
+#include "fivepoint/FivePoint.h"
+#include "pose_estimation/AbsolutePoseRansac.h"
 
 namespace px
 {
@@ -91,6 +91,8 @@ MonoVO::processFrames(FrameSetPtr& frameSet)
 {
     boost::lock_guard<boost::mutex> lock(m_globalMutex);
 
+    PX_PROFILE_SCOPE("mono_vo.process_frames");
+
     ros::Time tsStart = ros::Time::now();
 
     std::vector<cv::KeyPoint> kpts;
@@ -757,6 +759,8 @@ MonoVO::match2D2DCorrespondences(const FrameSetConstPtr& frameSet1,
                                  const FrameSetConstPtr& frameSet2,
                                  std::vector<cv::DMatch>& matches) const
 {
+    PX_PROFILE_SCOPE("mono_vo.temporal_matching");
+
     matches.clear();
 
     std::vector<cv::Mat> dtors1;
@@ -813,7 +817,10 @@ MonoVO::processFrame(const ImageMetadata& metadata,
     }
 
     // Detect features.
+    uint64_t tsDetect = Profiler::now();
     m_featureDetector->detect(imageProc, kpts, cv::Mat());
+    Profiler::instance()->addTimer("mono_vo.detection", tsDetect, Profiler::now());
+    Profiler::instance()->addSample("mono_vo.features", kpts.size());
 
     // Backproject feature coordinates to rays with spherical coordinates.
     spts.resize(kpts.size());
@@ -824,6 +831,8 @@ MonoVO::processFrame(const ImageMetadata& metadata,
         metadata.cam->liftSphere(Eigen::Vector2d(kpt.pt.x, kpt.pt.y), spts.at(i));
     }
 
+    PX_PROFILE_SCOPE("mono_vo.description");
+
     m_descriptorExtractor->compute(imageProc, kpts, dtors);
 }
 
@@ -943,53 +952,43 @@ MonoVO::solve5PointRansac(const FrameConstPtr& frame1,
                           Eigen::Matrix4d& relativeMotion,
                           std::vector<bool>& inliers) const
 {
+    PX_PROFILE_SCOPE("mono_vo.ransac");
+
     inliers.clear();
     inliers.resize(matches.size(), false);
 
-    std::vector<cv::Point2f> imagePoints[2];
+    std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > rays1, rays2;
+    rays1.reserve(matches.size());
+    rays2.reserve(matches.size());
     for (size_t i = 0; i < matches.size(); ++i)
     {
         const cv::DMatch& match = matches.at(i);
 
-        Eigen::Vector3d ray;
-
-        ray = frame1->features2D().at(match.queryIdx)->ray();
-        ray /= ray(2);
+        // bearing vectors, so that rays outside the image plane, as from
+        // fisheye and omnidirectional cameras, are handled as well
+        rays1.push_back(frame1->features2D().at(match.queryIdx)->ray().normalized());
+        rays2.push_back(frame2->features2D().at(match.trainIdx)->ray().normalized());
+    }
 
-        imagePoints[0].push_back(cv::Point2f(ray(0), ray(1)));
+    relativeMotion.setIdentity();
 
-        ray = frame2->features2D().at(match.trainIdx)->ray();
-        ray /= ray(2);
+    FivePointRansac<double> ransac;
+    ransac.threshold() = k_reprojErrorThresh / k_nominalFocalLength;
+    ransac.confidence() = 0.99;
+    ransac.maxIterations() = 100;
 
-        imagePoints[1].push_back(cv::Point2f(ray(0), ray(1)));
+    Eigen::Matrix3d E;
+    if (!ransac.estimate(rays1, rays2, E, inliers))
+    {
+        return;
     }
 
-    cv::Mat inlierMat;
-    cv::Mat E = findEssentialMat(imagePoints[0], imagePoints[1], 1.0,
-                                 cv::Point2d(0.0, 0.0), CV_FM_RANSAC, 0.99,
-                                 k_reprojErrorThresh / k_nominalFocalLength,
-                                 100, inlierMat);
-    cv::Mat R_cv, t_cv;
-    recoverPose(E, imagePoints[0], imagePoints[1],
-                R_cv, t_cv, 1.0, cv::Point2d(0.0, 0.0), inlierMat);
-
     Eigen::Matrix3d R;
-    cv::cv2eigen(R_cv, R);
-
     Eigen::Vector3d t;
-    cv::cv2eigen(t_cv, t);
+    recoverPose(E, rays1, rays2, inliers, R, t);
 
-    relativeMotion.setIdentity();
     relativeMotion.block<3,3>(0,0) = R;
     relativeMotion.block<3,1>(0,3) = t;
-
-    for (int i = 0; i < inlierMat.cols; ++i)
-    {
-        if (inlierMat.at<unsigned char>(0,i))
-        {
-            inliers.at(i) = true;
-        }
-    }
 }
 
 void
@@ -999,6 +998,8 @@ MonoVO::solveP3PRansac(const FrameConstPtr& frame1,
                        Eigen::Matrix4d& H,
                        std::vector<bool>& inliers) const
 {
+    PX_PROFILE_SCOPE("mono_vo.ransac");
+
     inliers.clear();
     inliers.resize(matches.size(), false);
 
@@ -1008,76 +1009,32 @@ MonoVO::solveP3PRansac(const FrameConstPtr& frame1,
     double u = 1.0 - v;
     int N = static_cast<int>(log(1.0 - p) / log(1.0 - u * u * u) + 0.5);
 
-    std::vector<size_t> indices;
-    for (size_t i = 0; i < matches.size(); ++i)
-    {
-        indices.push_back(i);
-    }
-
     const std::vector<Point2DFeaturePtr>& features1 = frame1->features2D();
     const std::vector<Point2DFeaturePtr>& features2 = frame2->features2D();
 
-    // run RANSAC to find best H
-    Eigen::Matrix4d H_best;
-    std::vector<size_t> inlierIds_best;
-    for (int i = 0; i < N; ++i)
+    AbsolutePoseBatch batch;
+    batch.reserve(matches.size());
+    for (size_t i = 0; i < matches.size(); ++i)
     {
-        std::random_shuffle(indices.begin(), indices.end());
-
-        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > rays(3);
-        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > worldPoints(3);
-        for (int j = 0; j < 3; ++j)
-        {
-            const cv::DMatch& match = matches.at(indices.at(j));
-
-            worldPoints.at(j) = features1.at(match.queryIdx)->feature3D()->point();
-            rays.at(j) = features2.at(match.trainIdx)->ray();
-        }
-
-        std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > H;
-        if (!solveP3P(rays, worldPoints, H))
-        {
-            continue;
-        }
-
-        for (size_t j = 0; j < H.size(); ++j)
-        {
-            Eigen::Matrix4d H_inv = invertHomogeneousTransform(H.at(j));
-
-            std::vector<size_t> inliersIds;
-            for (size_t k = 0; k < matches.size(); ++k)
-            {
-                const cv::DMatch& match = matches.at(k);
-
-                Eigen::Vector3d P_1 = features1.at(match.queryIdx)->feature3D()->point();
-
-                Eigen::Vector3d P_2_pred = transformPoint(H_inv, P_1);
-
-                const Point2DFeatureConstPtr& f2 = features2.at(match.trainIdx);
-
-                double err = fabs(P_2_pred.normalized().dot(f2->ray()));
-                if (err < k_sphericalErrorThresh)
-                {
-                    continue;
-                }
-
-                inliersIds.push_back(k);
-            }
+        const cv::DMatch& match = matches.at(i);
 
-            if (inliersIds.size() > inlierIds_best.size())
-            {
-                H_best = H_inv;
-                inlierIds_best = inliersIds;
-            }
-        }
+        batch.add(features1.at(match.queryIdx)->feature3D()->point(),
+                  features2.at(match.trainIdx)->ray());
     }
 
-    for (size_t i = 0; i < inlierIds_best.size(); ++i)
+    // run RANSAC to find best H
+    AbsolutePoseRansac ransac;
+    ransac.threshold() = k_sphericalErrorThresh;
+    ransac.confidence() = p;
+    ransac.maxIterations() = N;
+
+    Eigen::Matrix4d H_best;
+    if (!ransac.estimate(batch, H_best, inliers))
     {
-        inliers.at(inlierIds_best.at(i)) = true;
+        H_best.setIdentity();
     }
 
-    H = H_best;
+    H = invertHomogeneousTransform(H_best);
 }
 
 void
@@ -4,6 +4,7 @@
 #include <ros/ros.h>
 
 #include "cauldron/AtomicContainer.h"
+#include "cauldron/Random.h"
 #include "camera_models/CameraFactory.h"
 #include "camera_systems/CameraSystem.h"
 #include "sparse_graph/SparseGraphViz.h"
@@ -101,6 +102,12 @@ main(int argc, char** argv)
 
     ros::NodeHandle nh;
 
+    // RANSAC draws from generators derived from this seed, so that runs
+    // on the same data are reproducible
+    int randomSeed;
+    nh.param("random_seed", randomSeed, 0);
+    px::setRandomSeed(randomSeed);
+
     // get camera namespace
     std::string cameraNs;
     if (!nh.getParam("camera_ns", cameraNs))
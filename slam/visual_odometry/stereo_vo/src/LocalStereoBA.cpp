@@ -5,6 +5,7 @@
 #include "camera_models/CostFunctionFactory.h"
 #include "cauldron/EigenQuaternionParameterization.h"
 #include "cauldron/EigenUtils.h"
+#include "cauldron/Profiler.h"
 #include "ceres/ceres.h"
 
 namespace px
@@ -53,6 +54,8 @@ LocalStereoBA::addFrameSet(FrameSetPtr& frameSet, bool replaceCurrentFrameSet)
 void
 LocalStereoBA::optimize(void)
 {
+    PX_PROFILE_SCOPE("stereo_vo.local_ba");
+
     ceres::Problem problem;
 
     boost::unordered_set<FrameSet*> frameSetsActive;
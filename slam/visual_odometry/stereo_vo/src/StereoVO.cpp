@@ -7,7 +7,8 @@
 #include <ros/ros.h>
 
 #include "cauldron/EigenUtils.h"
-#include "pose_estimation/P3P.h"
+#include "cauldron/Profiler.h"
+#include "pose_estimation/AbsolutePoseRansac.h"
 
 namespace px
 {
@@ -97,6 +98,8 @@ StereoVO::processFrames(FrameSetPtr& frameSet)
 {
     boost::lock_guard<boost::mutex> lock(m_globalMutex);
 
+    PX_PROFILE_SCOPE("stereo_vo.process_frames");
+
     ros::Time tsStart = ros::Time::now();
 
     std::vector<cv::KeyPoint> kpts1, kpts2;
@@ -684,6 +687,8 @@ StereoVO::match2D3DCorrespondences(const FrameSetConstPtr& frameSet1,
                                    const FrameSetConstPtr& frameSet2,
                                    std::vector<cv::DMatch>& matches) const
 {
+    PX_PROFILE_SCOPE("stereo_vo.temporal_matching");
+
     matches.clear();
 
     std::vector<cv::Mat> dtors1;
@@ -767,7 +772,10 @@ StereoVO::processFrame(const ImageMetadata& metadata,
     }
 
     // Detect features.
+    uint64_t tsDetect = Profiler::now();
     m_featureDetector->detect(imageProc, kpts, cv::Mat());
+    Profiler::instance()->addTimer("stereo_vo.detection", tsDetect, Profiler::now());
+    Profiler::instance()->addSample("stereo_vo.features", kpts.size());
 
     // Backproject feature coordinates to rays with spherical coordinates.
     spts.resize(kpts.size());
@@ -778,6 +786,8 @@ StereoVO::processFrame(const ImageMetadata& metadata,
         metadata.cam->liftSphere(Eigen::Vector2d(kpt.pt.x, kpt.pt.y), spts.at(i));
     }
 
+    PX_PROFILE_SCOPE("stereo_vo.description");
+
     m_descriptorExtractor->compute(imageProc, kpts, dtors);
 }
 
@@ -950,6 +960,8 @@ StereoVO::solveP3PRansac(const FrameConstPtr& frame1,
                          Eigen::Matrix4d& H,
                          std::vector<cv::DMatch>& inliers) const
 {
+    PX_PROFILE_SCOPE("stereo_vo.ransac");
+
     inliers.clear();
 
     double p = 0.99; // probability that at least one set of random samples does not contain an outlier
@@ -958,76 +970,43 @@ StereoVO::solveP3PRansac(const FrameConstPtr& frame1,
     double u = 1.0 - v;
     int N = static_cast<int>(log(1.0 - p) / log(1.0 - u * u * u) + 0.5);
 
-    std::vector<size_t> indices;
-    for (size_t i = 0; i < matches.size(); ++i)
-    {
-        indices.push_back(i);
-    }
-
     const std::vector<Point2DFeaturePtr>& features1 = frame1->features2D();
     const std::vector<Point2DFeaturePtr>& features2 = frame2->features2D();
 
-    // run RANSAC to find best H
-    Eigen::Matrix4d H_best;
-    std::vector<size_t> inlierIds_best;
-    for (int i = 0; i < N; ++i)
+    AbsolutePoseBatch batch;
+    batch.reserve(matches.size());
+    for (size_t i = 0; i < matches.size(); ++i)
     {
-        std::random_shuffle(indices.begin(), indices.end());
-
-        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > rays(3);
-        std::vector<Eigen::Vector3d, Eigen::aligned_allocator<Eigen::Vector3d> > worldPoints(3);
-        for (int j = 0; j < 3; ++j)
-        {
-            const cv::DMatch& match = matches.at(indices.at(j));
+        const cv::DMatch& match = matches.at(i);
 
-            worldPoints.at(j) = features1.at(match.queryIdx)->feature3D()->point();
-            rays.at(j) = features2.at(match.trainIdx)->ray();
-        }
+        batch.add(features1.at(match.queryIdx)->feature3D()->point(),
+                  features2.at(match.trainIdx)->ray());
+    }
 
-        std::vector<Eigen::Matrix4d, Eigen::aligned_allocator<Eigen::Matrix4d> > H;
-        if (!solveP3P(rays, worldPoints, H))
-        {
-            continue;
-        }
+    // run RANSAC to find best H
+    AbsolutePoseRansac ransac;
+    ransac.threshold() = k_sphericalErrorThresh;
+    ransac.confidence() = p;
+    ransac.maxIterations() = N;
 
-        for (size_t j = 0; j < H.size(); ++j)
+    Eigen::Matrix4d H_best;
+    std::vector<bool> inlierFlags;
+    if (ransac.estimate(batch, H_best, inlierFlags))
+    {
+        for (size_t i = 0; i < inlierFlags.size(); ++i)
         {
-            Eigen::Matrix4d H_inv = invertHomogeneousTransform(H.at(j));
-
-            std::vector<size_t> inliersIds;
-            for (size_t k = 0; k < matches.size(); ++k)
-            {
-                const cv::DMatch& match = matches.at(k);
-
-                Eigen::Vector3d P_1 = features1.at(match.queryIdx)->feature3D()->point();
-
-                Eigen::Vector3d P_2_pred = transformPoint(H_inv, P_1);
-
-                const Point2DFeatureConstPtr& f2 = features2.at(match.trainIdx);
-
-                double err = fabs(P_2_pred.normalized().dot(f2->ray()));
-                if (err < k_sphericalErrorThresh)
-                {
-                    continue;
-                }
-
-                inliersIds.push_back(k);
-            }
-
-            if (inliersIds.size() > inlierIds_best.size())
+            if (inlierFlags.at(i))
             {
-                H_best = H_inv;
-                inlierIds_best = inliersIds;
+                inliers.push_back(matches.at(i));
             }
         }
     }
-
-    for (size_t i = 0; i < inlierIds_best.size(); ++i)
+    else
     {
-        inliers.push_back(matches.at(inlierIds_best.at(i)));
+        H_best.setIdentity();
     }
 
-    H = H_best;
+    H = invertHomogeneousTransform(H_best);
 }
 
 void
@@ -4,6 +4,7 @@
 #include <ros/ros.h>
 
 #include "cauldron/AtomicContainer.h"
+#include "cauldron/Random.h"
 #include "camera_models/CameraFactory.h"
 #include "camera_systems/CameraSystem.h"
 #include "sparse_graph/SparseGraphViz.h"
@@ -102,6 +103,12 @@ main(int argc, char** argv)
 
     ros::NodeHandle nh;
 
+    // RANSAC draws from generators derived from this seed, so that runs
+    // on the same data are reproducible
+    int randomSeed;
+    nh.param("random_seed", randomSeed, 0);
+    px::setRandomSeed(randomSeed);
+
     // get namespaces of both cameras
     std::string cameraNs1, cameraNs2;
     if (!nh.getParam("camera_ns_1", cameraNs1))